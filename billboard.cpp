@@ -1,14 +1,14 @@
 /****************************************
- * billboard.cpp (P)
+ * billboard.cpp (改善版)
  *
- * Tv:
- *   r{[h`惂W[
- *   - Jɏɐʂʂ`
- *   - eNX`t
+ * 概要:
+ *   ビルボード描画モジュール
+ *   - カメラに常に正面を向く平面を描画
+ *   - テクスチャ付き
  *
- * ύX_:
- *   - [xXe[g̐ĂяoɈϏ
- *   - p[eBN`ł̐[xݐɑΉ
+ * 変更点:
+ *   - 深度ステートの制御を呼び出し側に委譲
+ *   - パーティクル描画での深度書き込み制御に対応
  ****************************************/
 #include "billboard.h"
 #include <DirectXMath.h>
@@ -22,58 +22,58 @@
 using namespace DirectX;
 
 //======================================
-// 萔EO[oϐ
+// 定数・グローバル変数
 //======================================
-static constexpr int NUM_VERTEX = 4; // r{[h4_̋`
+static constexpr int NUM_VERTEX = 4; // ビルボードは4頂点の矩形
 
-static ID3D11Buffer* g_pVertexBuffer = nullptr; // _obt@
+static ID3D11Buffer* g_pVertexBuffer = nullptr; // 頂点バッファ
 
-// ɊOnfoCXEReLXg
-// Releasesv
+// 初期化時に外部から渡されるデバイス・コンテキスト
+// Release不要
 static ID3D11Device* g_pDevice = nullptr;
 static ID3D11DeviceContext* g_pContext = nullptr;
 
 static XMFLOAT4X4 g_mtxView{};
 
-// _\
+// 頂点構造体
 struct Vertex3d
 {
-    XMFLOAT3 position; // _W
-    XMFLOAT4 color; // _J[
-    XMFLOAT2 uv; // eNX`UV
+    XMFLOAT3 position; // 頂点座標
+    XMFLOAT4 color; // 頂点カラー
+    XMFLOAT2 uv; // テクスチャUV
 };
 
 //======================================
-// r{[h_f[^(4_)
-// S_Ƃ`
+// ビルボード頂点データ(4頂点)
+// 中心を原点とした正方形
 //======================================
 static Vertex3d g_BillboardVertex[] = {
-    // 
+    // 左上
     { { -0.5f, 0.5f, 0.0f }, { 1.0f, 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f } },
-    // E
+    // 右上
     { { 0.5f, 0.5f, 0.0f }, { 1.0f, 1.0f, 1.0f, 1.0f }, { 1.0f, 0.0f } },
-    // 
+    // 左下
     { { -0.5f, -0.5f, 0.0f }, { 1.0f, 1.0f, 1.0f, 1.0f }, { 0.0f, 1.0f } },
-    // E
+    // 右下
     { { 0.5f, -0.5f, 0.0f }, { 1.0f, 1.0f, 1.0f, 1.0f }, { 1.0f, 1.0f } },
 };
 
 //======================================
-// Jʌs擾
+// カメラ正面向き行列を取得
 //======================================
 static XMMATRIX GetBillboardMatrix()
 {
-    // r[s񂩂]݂̂𒊏oA̋ts߂
+    // ビュー行列から回転成分のみを抽出し、その逆行列を求める
     XMMATRIX view = XMLoadFloat4x4(&g_mtxView);
 
-    // r[s̉](3x3)𒊏o
+    // ビュー行列の回転部分(3x3)を抽出
     XMVECTOR right = XMVectorSet(XMVectorGetX(view.r[0]), XMVectorGetX(view.r[1]), XMVectorGetX(view.r[2]), 0.0f);
 
     XMVECTOR up = XMVectorSet(XMVectorGetY(view.r[0]), XMVectorGetY(view.r[1]), XMVectorGetY(view.r[2]), 0.0f);
 
     XMVECTOR forward = XMVectorSet(XMVectorGetZ(view.r[0]), XMVectorGetZ(view.r[1]), XMVectorGetZ(view.r[2]), 0.0f);
 
-    // r{[hs\z(J̋t)
+    // ビルボード行列を構築(カメラの逆向き)
     XMMATRIX billboard;
     billboard.r[0] = right;
     billboard.r[1] = up;
@@ -84,25 +84,25 @@ static XMMATRIX GetBillboardMatrix()
 }
 
 //======================================
-// 
+// 初期化処理
 //======================================
 void Billboard_Initialize()
 {
     hal::dout << "Billboard_Initialize: begin" << std::endl;
 
-    // foCXEReLXg̑Ó`FbN
+    // デバイス・コンテキストの妥当性チェック
     if (!Direct3D_GetDevice() || !Direct3D_GetContext())
     {
-        hal::dout << "Billboard_Initialize() : ȃfoCX܂̓ReLXg" << std::endl;
+        hal::dout << "Billboard_Initialize() : 無効なデバイスまたはコンテキスト" << std::endl;
         return;
     }
 
     g_pDevice = Direct3D_GetDevice();
     g_pContext = Direct3D_GetContext();
 
-    // _obt@ݒ
+    // 頂点バッファ生成設定
     D3D11_BUFFER_DESC bd = {};
-    bd.Usage = D3D11_USAGE_DEFAULT; // ÓIobt@
+    bd.Usage = D3D11_USAGE_DEFAULT; // 静的バッファ
     bd.ByteWidth = sizeof(Vertex3d) * NUM_VERTEX;
     bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
     bd.CPUAccessFlags = 0;
@@ -114,11 +114,11 @@ void Billboard_Initialize()
     sd.SysMemPitch = 0;
     sd.SysMemSlicePitch = 0;
 
-    // _obt@
+    // 頂点バッファ生成
     HRESULT hr = g_pDevice->CreateBuffer(&bd, &sd, &g_pVertexBuffer);
     if (FAILED(hr))
     {
-        hal::dout << "Billboard_Initialize: _obt@̍쐬Ɏs hr=0x" << std::hex << hr << std::endl;
+        hal::dout << "Billboard_Initialize: 頂点バッファの作成に失敗 hr=0x" << std::hex << hr << std::endl;
         return;
     }
 
@@ -126,7 +126,7 @@ void Billboard_Initialize()
 }
 
 //======================================
-// 
+// 解放処理
 //======================================
 void Billboard_Finalize()
 {
@@ -138,60 +138,60 @@ void Billboard_Finalize()
 }
 
 //======================================
-// XV
+// 更新処理
 //======================================
 void Billboard_Update(double deltaTime)
 {
     (void)deltaTime;
-    // ݂͓ɍXVȂ
-    // Aj[VȂǂKvȏꍇ͂Ɏ
+    // 現在は特に更新処理なし
+    // アニメーションなどが必要な場合はここに実装
 }
 
 //======================================
-// `揈
+// 描画処理
 //======================================
 void Billboard_Draw(int texId, const DirectX::XMFLOAT3& position, const XMFLOAT2& scale, const XMFLOAT2& pivot, const XMFLOAT4& color)
 {
 
     if (!g_pContext || !g_pVertexBuffer)
     {
-        hal::dout << "Billboard_Draw: ȃReLXg܂͒_obt@" << std::endl;
+        hal::dout << "Billboard_Draw: 無効なコンテキストまたは頂点バッファ" << std::endl;
         return;
     }
 
-    // VF[_[Jn
+    // シェーダーを開始
     Shader_Billboard_Begin();
 
     Shader_Billboard_SetUVParameter({ { 1.0f, 1.0f }, { 0.0f, 0.0f } });
-    // J[ݒ
+    // カラーを設定
     Shader_Billboard_SetColor(color);
 
 
-    // eNX`Zbg
+    // テクスチャをセット
     Texture_SetTexture(texId);
 
-    // _obt@`pCvCɐݒ
+    // 頂点バッファを描画パイプラインに設定
     UINT stride = sizeof(Vertex3d);
     UINT offset = 0;
     g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
 
-    // v~eBug|Wݒ(gCAOXgbv4_2Op``)
+    // プリミティブトポロジ設定(トライアングルストリップで4頂点から2三角形を描画)
     g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
-    // Jʌs擾
+    // カメラ正面向き行列を取得
     XMMATRIX billboardMatrix = GetBillboardMatrix();
 
-    // [hϊs̍쐬
-    // XP[  s{bgItZbg  r{[h]  sړ̏
+    // ワールド変換行列の作成
+    // スケール → ピボットオフセット → ビルボード回転 → 平行移動の順
     XMMATRIX matScale = XMMatrixScaling(scale.x, scale.y, 1.0f);
     XMMATRIX pivotOffset = XMMatrixTranslation(-pivot.x, -pivot.y, 0.0f);
     XMMATRIX matTranslation = XMMatrixTranslation(position.x, position.y, position.z);
     XMMATRIX matWorld = matScale * pivotOffset * billboardMatrix * matTranslation;
 
-    // [hϊs𒸓_VF[_[ɐݒ
+    // ワールド変換行列を頂点シェーダーに設定
     Shader_Billboard_SetWorldMatrix(matWorld);
 
-    // `s(4_ŃgCAOXgbv)
+    // 描画実行(4頂点でトライアングルストリップ)
     g_pContext->Draw(NUM_VERTEX, 0);
 }
 
@@ -205,44 +205,44 @@ void Billboard_Draw(int texId, const DirectX::XMFLOAT3& position, const DirectX:
 
     if (!g_pContext || !g_pVertexBuffer)
     {
-        hal::dout << "Billboard_Draw: ȃReLXg܂͒_obt@" << std::endl;
+        hal::dout << "Billboard_Draw: 無効なコンテキストまたは頂点バッファ" << std::endl;
         return;
     }
 
-    // VF[_[Jn
+    // シェーダーを開始
     Shader_Billboard_Begin();
     
     Shader_Billboard_SetUVParameter({ { uv_w, uv_h }, { uv_x, uv_y } });
 
-    // J[ݒ
+    // カラーを設定
     Shader_Billboard_SetColor(color);
 
 
-    // eNX`Zbg
+    // テクスチャをセット
     Texture_SetTexture(texId);
 
-    // _obt@`pCvCɐݒ
+    // 頂点バッファを描画パイプラインに設定
     UINT stride = sizeof(Vertex3d);
     UINT offset = 0;
     g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
 
-    // v~eBug|Wݒ(gCAOXgbv4_2Op``)
+    // プリミティブトポロジ設定(トライアングルストリップで4頂点から2三角形を描画)
     g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
-    // Jʌs擾
+    // カメラ正面向き行列を取得
     XMMATRIX billboardMatrix = GetBillboardMatrix();
 
-    // [hϊs̍쐬
-    // XP[  s{bgItZbg  r{[h]  sړ̏
+    // ワールド変換行列の作成
+    // スケール → ピボットオフセット → ビルボード回転 → 平行移動の順
     XMMATRIX matScale = XMMatrixScaling(scale.x, scale.y, 1.0f);
     XMMATRIX pivotOffset = XMMatrixTranslation(-pivot.x, -pivot.y, 0.0f);
     XMMATRIX matTranslation = XMMatrixTranslation(position.x, position.y, position.z);
     XMMATRIX matWorld = matScale * pivotOffset * billboardMatrix * matTranslation;
 
-    // [hϊs𒸓_VF[_[ɐݒ
+    // ワールド変換行列を頂点シェーダーに設定
     Shader_Billboard_SetWorldMatrix(matWorld);
 
-    // `s(4_ŃgCAOXgbv)
+    // 描画実行(4頂点でトライアングルストリップ)
     g_pContext->Draw(NUM_VERTEX, 0);
 }
 
@@ -1,6 +1,6 @@
 /**
  * @file billboard.h
- * @brief XvCg\
+ * @brief スプライト表示
  * @author Natsume Shidara
  * @date 2025/06/12
  */
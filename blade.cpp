@@ -1,14 +1,15 @@
 /****************************************
  * @file blade.cpp
- * @brief u[hil̎_j
+ * @brief ブレード制御（一人称視点）
  * @author Natsume Shidara
  * @date 2026/01/07
- * @update 2026/01/10 - t@N^O
- * @update 2026/01/13 - ؒf@vZ̏C
- * @update 2026/01/13 - TEhΉ
- * @update 2026/02/03 - X^CbVaAj[V
- * @update 2026/02/03 - ガEx
- * @update 2026/02/03 - atF[Y̏펞ؒf`FbN
+ * @update 2026/01/10 - リファクタリング
+ * @update 2026/01/13 - 切断法線計算の修正
+ * @update 2026/01/13 - サウンド対応
+ * @update 2026/02/03 - スタイリッシュ斬撃アニメーション
+ * @update 2026/02/03 - 横薙ぎ復旧・速度調整
+ * @update 2026/02/03 - 斬撃フェーズ中の常時切断チェック
+ * @update 2026/10/18 - 切断候補を前フレームからの刃の掃引範囲で探索
  ****************************************/
 
 #include "blade.h"
@@ -17,6 +18,7 @@
 #include "input_manager.h"
 #include "ray.h"
 #include "prop_manager.h"
+#include "slicer.h"
 #include "enemy.h"
 #include "key_logger.h"
 #include "trail.h"
@@ -24,12 +26,13 @@
 #include "shader_shadow_map.h"
 #include "sound_manager.h"
 #include <cmath>
+#include <algorithm>
 #include <random>
 
 using namespace DirectX;
 
 //======================================
-// ؒfp[^\
+// 切断パラメータ構造体
 //======================================
 struct SliceParams
 {
@@ -39,32 +42,32 @@ struct SliceParams
 };
 
 //======================================
-// ap^[\
+// 斬撃パターン構造体
 //======================================
 struct SlashPattern
 {
-    // Jnp
+    // 開始姿勢
     XMFLOAT3 startRotation;
     XMFLOAT3 startOffset;
 
-    // Ip
+    // 終了姿勢
     XMFLOAT3 endRotation;
     XMFLOAT3 endOffset;
 
-    // ^C~O
-    float windupRatio;      // U肩Ԃ莞Ԃ̊
-    float strikeRatio;      // aԂ̊ic̓Jo[j
-    float duration;         // Ŝ̒
+    // タイミング
+    float windupRatio;      // 振りかぶり時間の割合
+    float strikeRatio;      // 斬撃時間の割合（残りはリカバリー）
+    float duration;         // 全体の長さ
 
-    // ؒfiJWnj
+    // 切断方向（カメラ座標系）
     XMFLOAT3 sliceDirection;
 
-    // TEh
+    // サウンド
     SoundID soundId;
 };
 
 //======================================
-// 萔
+// 定数
 //======================================
 namespace
 {
@@ -76,7 +79,7 @@ namespace
     constexpr float IDLE_SWAY_SPEED = 2.0f;
     constexpr float IDLE_SWAY_AMOUNT = 0.01f;
 
-    // ガpp[^
+    // 横薙ぎ専用パラメータ
     constexpr float HORIZONTAL_SLASH_DURATION = 0.35f;
     constexpr float HORIZONTAL_ROT_X = 0.0f;
     constexpr float HORIZONTAL_ROT_Z = 3.0f;
@@ -99,10 +102,10 @@ namespace
     };
 
     //======================================
-    // ap^[`
+    // 斬撃パターン定義
     //======================================
 
-    // p^[1: EとiUaj
+    // パターン1: 右上→左下（袈裟斬り）
     const SlashPattern SLASH_KESA = {
         .startRotation = { -0.6f, -0.4f, -0.8f },
         .startOffset = { 0.15f, 0.1f, 0.0f },
@@ -115,7 +118,7 @@ namespace
         .soundId = SOUND_SE_SLASH_HEAVY
     };
 
-    // p^[2: とEitUj
+    // パターン2: 左上→右下（逆袈裟）
     const SlashPattern SLASH_REVERSE_KESA = {
         .startRotation = { -0.5f, 0.5f, 0.9f },
         .startOffset = { -0.1f, 0.12f, 0.0f },
@@ -128,7 +131,7 @@ namespace
         .soundId = SOUND_SE_SLASH_HEAVY
     };
 
-    // p^[3: Eガ
+    // パターン3: 右横薙ぎ
     const SlashPattern SLASH_RIGHT_SWEEP = {
         .startRotation = { 0.0f, -0.6f, -1.2f },
         .startOffset = { 0.2f, 0.0f, 0.0f },
@@ -141,7 +144,7 @@ namespace
         .soundId = SOUND_SE_SLASH
     };
 
-    // p^[4: ガ
+    // パターン4: 左横薙ぎ
     const SlashPattern SLASH_LEFT_SWEEP = {
         .startRotation = { 0.0f, 0.6f, 1.0f },
         .startOffset = { -0.15f, 0.0f, 0.0f },
@@ -154,7 +157,7 @@ namespace
         .soundId = SOUND_SE_SLASH
     };
 
-    // p^[5: ˂グaiցj
+    // パターン5: 突き上げ斬り（下から上へ）
     const SlashPattern SLASH_RISING = {
         .startRotation = { 1.0f, 0.2f, 0.3f },
         .startOffset = { 0.05f, -0.15f, 0.05f },
@@ -167,7 +170,7 @@ namespace
         .soundId = SOUND_SE_SLASH_HEAVY
     };
 
-    // p^[6: sca
+    // パターン6: 鋭い縦斬り
     const SlashPattern SLASH_QUICK_VERTICAL = {
         .startRotation = { -0.7f, 0.0f, 0.0f },
         .startOffset = { 0.0f, 0.08f, 0.0f },
@@ -180,7 +183,7 @@ namespace
         .soundId = SOUND_SE_SLASH
     };
 
-    // p^[z
+    // パターン配列
     const SlashPattern* SLASH_PATTERNS[] = {
         &SLASH_KESA,
         &SLASH_REVERSE_KESA,
@@ -197,13 +200,18 @@ namespace
     constexpr double TRAIL_LIFETIME = 0.15;
     constexpr float TRAIL_SPAWN_THRESHOLD = 2.0f;
 
+    // 切断平面の法線（刃の向き×振り方向）の長さの2乗がこれ以下なら切断しない
+    constexpr float SLICE_PLANE_THRESHOLD = 0.001f;
+    // 前フレームからの移動がこれ未満なら掃引範囲の代わりに振り方向へ広げた四角形を使う
+    constexpr float SWEEP_MIN_MOVE = 0.01f;
+
 #ifdef _DEBUG
     constexpr float DEBUG_ADJUST_SPEED = 0.02f;
 #endif
 }
 
 //======================================
-// C[WO֐
+// イージング関数
 //======================================
 namespace Easing
 {
@@ -233,7 +241,7 @@ namespace Easing
 }
 
 //======================================
-// ϐ
+// 内部変数
 //======================================
 static MODEL* g_pModel = nullptr;
 static BladeState g_State = BladeState::Idle;
@@ -251,23 +259,27 @@ static bool g_IsDragging = false;
 static float g_SliceMouseAccumX = 0.0f;
 static float g_SliceMouseAccumY = 0.0f;
 
-// ap^[Ǘ
+// 斬撃パターン管理
 static int g_CurrentPatternIndex = 0;
 static int g_LastPatternIndex = -1;
 static std::mt19937 g_Rng;
 
 static XMMATRIX g_BladeWorldMatrix = XMMatrixIdentity();
 
+// 前フレームの切断線（先端から伸ばした線分）。連続して切断判定したフレームの間だけ有効
+static XMFLOAT3 g_PrevSliceStart;
+static XMFLOAT3 g_PrevSliceEnd;
+static bool g_HasPrevSlice = false;
+static bool g_SlicedThisFrame = false;
+
 #ifdef _DEBUG
 static int g_DebugMode = 0;
-static XMFLOAT3 g_DebugRayOrigin;
-static XMFLOAT3 g_DebugRayEnd;
-static XMFLOAT3 g_DebugRayEnd2;
-static bool g_DebugRayValid = false;
+static SliceSweep g_DebugSweep;
+static bool g_DebugSweepValid = false;
 #endif
 
 //======================================
-// ֐vg^Cv
+// 内部関数プロトタイプ
 //======================================
 static void ChangeState(BladeState newState);
 static void UpdateState_Idle(float dt);
@@ -287,7 +299,7 @@ static void DebugUpdate();
 #endif
 
 //======================================
-// [eBeB֐
+// ユーティリティ関数
 //======================================
 static XMFLOAT3 LerpFloat3(const XMFLOAT3& a, const XMFLOAT3& b, float t)
 {
@@ -316,7 +328,7 @@ static int SelectNextPattern()
     std::uniform_int_distribution<int> dist(0, NUM_SLASH_PATTERNS - 1);
     int next = dist(g_Rng);
 
-    // Aœp^[iő3񎎍sj
+    // 連続で同じパターンを避ける（最大3回試行）
     for (int i = 0; i < 3 && next == g_LastPatternIndex; ++i)
     {
         next = dist(g_Rng);
@@ -327,7 +339,7 @@ static int SelectNextPattern()
 }
 
 //======================================
-// 
+// 初期化
 //======================================
 void Blade_Initialize()
 {
@@ -346,18 +358,19 @@ void Blade_Initialize()
     g_ModelRotationOffset = MODEL_ROTATION_OFFSET;
     g_Scale = MODEL_SCALE;
 
-    // 
+    // 乱数初期化
     std::random_device rd;
     g_Rng.seed(rd());
     g_LastPatternIndex = -1;
+    g_HasPrevSlice = false;
 
 #ifdef _DEBUG
-    g_DebugRayValid = false;
+    g_DebugSweepValid = false;
 #endif
 }
 
 //======================================
-// I
+// 終了
 //======================================
 void Blade_Finalize()
 {
@@ -369,7 +382,7 @@ void Blade_Finalize()
 }
 
 //======================================
-// ԑJ
+// 状態遷移
 //======================================
 static void ChangeState(BladeState newState)
 {
@@ -378,6 +391,9 @@ static void ChangeState(BladeState newState)
     g_State = newState;
     g_StateTimer = 0.0f;
 
+    // 別の振りの切断線とはつながない
+    g_HasPrevSlice = false;
+
     switch (newState)
     {
         case BladeState::Idle:
@@ -405,7 +421,7 @@ static void ChangeState(BladeState newState)
 }
 
 //======================================
-// JUp擾
+// カメラのUp方向を取得
 //======================================
 static XMFLOAT3 GetCameraUp()
 {
@@ -419,7 +435,7 @@ static XMFLOAT3 GetCameraUp()
 }
 
 //======================================
-// ԕʍXV: ҋ@
+// 状態別更新: 待機
 //======================================
 static void UpdateState_Idle(float dt)
 {
@@ -441,7 +457,7 @@ static void UpdateState_Idle(float dt)
 }
 
 //======================================
-// ԕʍXV: Ra
+// 状態別更新: 自由斬撃
 //======================================
 static void UpdateState_FreeSlice(float dt)
 {
@@ -497,7 +513,7 @@ static void UpdateState_FreeSlice(float dt)
 }
 
 //======================================
-// ԕʍXV: X^CbVa
+// 状態別更新: スタイリッシュ斬撃
 //======================================
 static void UpdateState_StylishSlash(float dt)
 {
@@ -514,7 +530,7 @@ static void UpdateState_StylishSlash(float dt)
 
     if (t < windupEnd)
     {
-        // U肩ԂtF[Y
+        // 振りかぶりフェーズ
         float phaseT = t / windupEnd;
         float eased = Easing::OutQuad(phaseT);
 
@@ -523,17 +539,17 @@ static void UpdateState_StylishSlash(float dt)
     }
     else if (t < strikeEnd)
     {
-        // atF[Y
+        // 斬撃フェーズ
         float phaseT = (t - windupEnd) / pattern.strikeRatio;
         float eased = Easing::InOutExpo(phaseT);
 
         targetRot = LerpFloat3(pattern.startRotation, pattern.endRotation, eased);
         targetOffset = LerpFloat3(pattern.startOffset, pattern.endOffset, eased);
 
-        // gC
+        // トレイル生成
         SpawnTrailAtBladeTip();
 
-        // ؒf`FbNit[sj
+        // 切断チェック（毎フレーム実行）
         XMFLOAT3 worldSliceDir = GetWorldSliceDirection(pattern.sliceDirection);
         XMVECTOR vDir = XMVector3Normalize(XMLoadFloat3(&worldSliceDir));
         XMStoreFloat3(&worldSliceDir, vDir);
@@ -542,7 +558,7 @@ static void UpdateState_StylishSlash(float dt)
     }
     else
     {
-        // Jo[tF[Y
+        // リカバリーフェーズ
         float phaseT = (t - strikeEnd) / (1.0f - strikeEnd);
         float eased = Easing::OutCubic(phaseT);
 
@@ -560,14 +576,14 @@ static void UpdateState_StylishSlash(float dt)
 }
 
 //======================================
-// ԕʍXV: ȂUiAirDashpj
+// 状態別更新: 横なぎ攻撃（AirDash専用）
 //======================================
 static void UpdateState_HorizontalSlash(float dt)
 {
     g_StateTimer += dt;
     float t = g_StateTimer / HORIZONTAL_SLASH_DURATION;
 
-    // C[YAEgiŏA㔼j
+    // イーズアウト（最初速く、後半減速）
     float easeT = 1.0f - (1.0f - t) * (1.0f - t);
 
     g_ModelRotationOffset.x = HORIZONTAL_ROT_X;
@@ -576,10 +592,10 @@ static void UpdateState_HorizontalSlash(float dt)
 
     g_LocalRotation = { 0.0f, 0.0f, 0.0f };
 
-    // gC
+    // トレイル生成
     SpawnTrailAtBladeTip();
 
-    // ؒf`FbNiatF[Y͖t[sj
+    // 切断チェック（斬撃フェーズ中は毎フレーム実行）
     if (t > 0.15f && t < 0.85f)
     {
         PerformSlice(GetCameraUp(), HORIZONTAL_SLICE);
@@ -593,7 +609,7 @@ static void UpdateState_HorizontalSlash(float dt)
 }
 
 //======================================
-// fobOXV
+// デバッグ更新
 //======================================
 #ifdef _DEBUG
 static void DebugUpdate()
@@ -630,7 +646,7 @@ static void DebugUpdate()
 #endif
 
 //======================================
-// XV
+// 更新
 //======================================
 void Blade_Update(double elapsed_time)
 {
@@ -640,6 +656,8 @@ void Blade_Update(double elapsed_time)
 
     float dt = static_cast<float>(elapsed_time);
 
+    g_SlicedThisFrame = false;
+
     switch (g_State)
     {
         case BladeState::Idle:
@@ -655,10 +673,16 @@ void Blade_Update(double elapsed_time)
             UpdateState_HorizontalSlash(dt);
             break;
     }
+
+    // 切断判定が途切れたら、次の判定は前フレームとつながない
+    if (!g_SlicedThisFrame)
+    {
+        g_HasPrevSlice = false;
+    }
 }
 
 //======================================
-// `
+// 描画
 //======================================
 void Blade_Draw()
 {
@@ -692,7 +716,7 @@ void Blade_Draw()
 }
 
 //======================================
-// VhE}bv`
+// シャドウマップ描画
 //======================================
 void Blade_DrawShadow()
 {
@@ -701,7 +725,7 @@ void Blade_DrawShadow()
 }
 
 //======================================
-// u[h[̃[hʒu擾
+// ブレード先端のワールド位置を取得
 //======================================
 static XMFLOAT3 GetBladeTipWorldPosition()
 {
@@ -714,7 +738,7 @@ static XMFLOAT3 GetBladeTipWorldPosition()
 }
 
 //======================================
-// gC
+// トレイル生成
 //======================================
 static void SpawnTrailAtBladeTip()
 {
@@ -722,7 +746,7 @@ static void SpawnTrailAtBladeTip()
 }
 
 //======================================
-// ؒfs
+// 切断を実行
 //======================================
 static void PerformSlice(const XMFLOAT3& sliceNormal, const SliceParams& params)
 {
@@ -731,37 +755,61 @@ static void PerformSlice(const XMFLOAT3& sliceNormal, const SliceParams& params)
     XMVECTOR vLocalDir = XMLoadFloat3(&params.rayDirection);
     XMVECTOR vWorldDir = XMVector3Normalize(XMVector3TransformNormal(vLocalDir, g_BladeWorldMatrix));
 
-    XMFLOAT3 rayDir;
-    XMStoreFloat3(&rayDir, vWorldDir);
+    XMVECTOR vStart = XMLoadFloat3(&rayOrigin);
+    XMVECTOR vEnd = vStart + vWorldDir * params.rayLength;
 
-    XMFLOAT3 dir1 = {
-        rayDir.x * params.rayLength,
-        rayDir.y * params.rayLength,
-        rayDir.z * params.rayLength
-    };
+    // 切断平面は刃の向きと振り方向を含む面
+    XMVECTOR vSliceNormal = XMLoadFloat3(&sliceNormal);
+    XMVECTOR vPlaneNormal = XMVector3Cross(vWorldDir, vSliceNormal);
+    if (XMVectorGetX(XMVector3LengthSq(vPlaneNormal)) <= SLICE_PLANE_THRESHOLD)
+    {
+        return;
+    }
 
-    XMFLOAT3 dir2 = {
-        dir1.x + sliceNormal.x * params.planeSpread,
-        dir1.y + sliceNormal.y * params.planeSpread,
-        dir1.z + sliceNormal.z * params.planeSpread
-    };
+    SliceSweep sweep;
+    sweep.planePoint = rayOrigin;
+    XMStoreFloat3(&sweep.planeNormal, XMVector3Normalize(vPlaneNormal));
+
+    // 前フレームの切断線から今フレームの切断線までの四角形を候補の探索範囲にする
+    const XMVECTOR vPrevStart = XMLoadFloat3(&g_PrevSliceStart);
+    const XMVECTOR vPrevEnd = XMLoadFloat3(&g_PrevSliceEnd);
+    const float move = std::max(
+        XMVectorGetX(XMVector3Length(vStart - vPrevStart)),
+        XMVectorGetX(XMVector3Length(vEnd - vPrevEnd)));
+
+    if (g_HasPrevSlice && move >= SWEEP_MIN_MOVE)
+    {
+        XMStoreFloat3(&sweep.corners[0], vPrevStart);
+        XMStoreFloat3(&sweep.corners[1], vPrevEnd);
+        XMStoreFloat3(&sweep.corners[2], vEnd);
+        XMStoreFloat3(&sweep.corners[3], vStart);
+    }
+    else
+    {
+        // 振り始め・静止中は振り方向へ planeSpread だけ広げる
+        XMVECTOR vSpread = vSliceNormal * params.planeSpread;
+        XMStoreFloat3(&sweep.corners[0], vStart);
+        XMStoreFloat3(&sweep.corners[1], vEnd);
+        XMStoreFloat3(&sweep.corners[2], vEnd + vSpread);
+        XMStoreFloat3(&sweep.corners[3], vStart + vSpread);
+    }
+
+    XMStoreFloat3(&g_PrevSliceStart, vStart);
+    XMStoreFloat3(&g_PrevSliceEnd, vEnd);
+    g_HasPrevSlice = true;
+    g_SlicedThisFrame = true;
 
 #ifdef _DEBUG
-    g_DebugRayOrigin = rayOrigin;
-    g_DebugRayEnd = { rayOrigin.x + dir1.x, rayOrigin.y + dir1.y, rayOrigin.z + dir1.z };
-    g_DebugRayEnd2 = { rayOrigin.x + dir2.x, rayOrigin.y + dir2.y, rayOrigin.z + dir2.z };
-    g_DebugRayValid = true;
+    g_DebugSweep = sweep;
+    g_DebugSweepValid = true;
 #endif
 
-    Ray startRay(rayOrigin, dir1);
-    Ray endRay(rayOrigin, dir2);
-
-    PropManager_TrySlice(startRay, endRay);
-    Enemy_TrySlice(endRay, sliceNormal);
+    PropManager_TrySlice(sweep);
+    Enemy_TrySlice(sweep);
 }
 
 //======================================
-// fobO`
+// デバッグ描画
 //======================================
 void Blade_DebugDraw()
 {
@@ -783,16 +831,18 @@ void Blade_DebugDraw()
     DebugRenderer::DrawSphere({ rayOrigin, 0.05f }, { 1.0f, 1.0f, 0.0f, 1.0f });
     DebugRenderer::DrawSphere({ rayEnd, 0.05f }, { 1.0f, 0.0f, 0.0f, 1.0f });
 
-    if (g_DebugRayValid && Blade_IsAttacking())
+    if (g_DebugSweepValid && Blade_IsAttacking())
     {
-        DebugRenderer::DrawLine(g_DebugRayOrigin, g_DebugRayEnd, { 1.0f, 0.0f, 1.0f, 1.0f });
-        DebugRenderer::DrawLine(g_DebugRayOrigin, g_DebugRayEnd2, { 1.0f, 0.5f, 1.0f, 1.0f });
+        for (int i = 0; i < 4; ++i)
+        {
+            DebugRenderer::DrawLine(g_DebugSweep.corners[i], g_DebugSweep.corners[(i + 1) % 4], { 1.0f, 0.0f, 1.0f, 1.0f });
+        }
     }
 #endif
 }
 
 //======================================
-// Qb^[
+// ゲッター
 //======================================
 BladeState Blade_GetState()
 {
@@ -821,7 +871,7 @@ int Blade_GetCurrentPatternIndex()
 }
 
 //======================================
-// ݒ
+// 設定
 //======================================
 void Blade_SetScreenOffset(const XMFLOAT3& offset)
 {
@@ -834,7 +884,7 @@ void Blade_SetScale(float scale)
 }
 
 //======================================
-// OgK[
+// 外部トリガー
 //======================================
 void Blade_TriggerVerticalSlash()
 {
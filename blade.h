@@ -1,34 +1,34 @@
 /****************************************
  * @file blade.h
- * @brief u[hil̎_j
+ * @brief ブレード制御（一人称視点）
  * @author Natsume Shidara
  * @date 2026/01/07
- * @update 2026/01/10 - t@N^O
- * @update 2026/02/03 - X^CbVaΉ
+ * @update 2026/01/10 - リファクタリング
+ * @update 2026/02/03 - スタイリッシュ斬撃対応
  ****************************************/
 #ifndef BLADE_H
 #define BLADE_H
 #include <DirectXMath.h>
 
  //======================================
- // u[h̏
+ // ブレードの状態
  //======================================
 enum class BladeState
 {
-    Idle,              // ҋ@
-    FreeSlice,         // RaiENbN+hbOj
-    FixedAttack,       // ŒUiNbNj- X^CbVa
-    HorizontalSlash,   // ȂUiAirDashAj
+    Idle,              // 待機
+    FreeSlice,         // 自由斬撃（右クリック+ドラッグ）
+    FixedAttack,       // 固定攻撃（左クリック）- スタイリッシュ斬撃
+    HorizontalSlash,   // 横なぎ攻撃（AirDash連動）
 };
 
 //======================================
-// EI
+// 初期化・終了
 //======================================
 void Blade_Initialize();
 void Blade_Finalize();
 
 //======================================
-// XVE`
+// 更新・描画
 //======================================
 void Blade_Update(double elapsed_time);
 void Blade_Draw();
@@ -36,13 +36,13 @@ void Blade_DrawShadow();
 void Blade_DebugDraw();
 
 //======================================
-// OgK[ivC[Ăяoj
+// 外部トリガー（プレイヤーから呼び出し）
 //======================================
-void Blade_TriggerVerticalSlash();    // X^CbVaiʏUj
-void Blade_TriggerHorizontalSlash();  // ȂiAirDashUj
+void Blade_TriggerVerticalSlash();    // スタイリッシュ斬撃（通常攻撃）
+void Blade_TriggerHorizontalSlash();  // 横なぎ（AirDash攻撃）
 
 //======================================
-// Qb^[
+// ゲッター
 //======================================
 BladeState Blade_GetState();
 bool Blade_IsAttacking();
@@ -50,7 +50,7 @@ int Blade_GetDebugMode();
 int Blade_GetCurrentPatternIndex();
 
 //======================================
-// ݒ
+// 設定
 //======================================
 void Blade_SetScreenOffset(const DirectX::XMFLOAT3& offset);
 void Blade_SetScale(float scale);
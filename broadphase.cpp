@@ -0,0 +1,150 @@
+﻿/****************************************
+ * @file broadphase.cpp
+ * @brief 動的オブジェクト用ブロードフェーズの実装
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 衝突フィルターによるペア生成時の除外
+ * @update 2026/10/18 - ペアのマージ先を作業用メンバーにして毎回の確保をなくす
+ ****************************************/
+
+#include "broadphase.h"
+#include <algorithm>
+#include <iterator>
+
+using namespace DirectX;
+
+//======================================
+// プロキシ管理
+//======================================
+int Broadphase::CreateProxy(const AABB& aabb, void* userData, const CollisionFilter& filter)
+{
+    int proxyId = m_Tree.CreateProxy(aabb, userData);
+    if (static_cast<int>(m_Filters.size()) <= proxyId)
+    {
+        m_Filters.resize(proxyId + 1);
+    }
+    m_Filters[proxyId] = filter;
+
+    m_MoveBuffer.push_back(proxyId);
+    return proxyId;
+}
+
+void Broadphase::DestroyProxy(int proxyId)
+{
+    // 移動バッファと永続ペアから除外
+    m_MoveBuffer.erase(std::remove(m_MoveBuffer.begin(), m_MoveBuffer.end(), proxyId), m_MoveBuffer.end());
+    m_Pairs.erase(std::remove_if(m_Pairs.begin(), m_Pairs.end(), [proxyId](const BroadphasePair& pair)
+    {
+        return pair.proxyA == proxyId || pair.proxyB == proxyId;
+    }), m_Pairs.end());
+
+    m_Tree.DestroyProxy(proxyId);
+}
+
+void Broadphase::MoveProxy(int proxyId, const AABB& aabb, const XMFLOAT3& displacement)
+{
+    if (m_Tree.MoveProxy(proxyId, aabb, displacement))
+    {
+        m_MoveBuffer.push_back(proxyId);
+    }
+}
+
+void Broadphase::SetProxyFilter(int proxyId, const CollisionFilter& filter)
+{
+    m_Filters[proxyId] = filter;
+
+    // 移動扱いにして既存ペアの除去・新規ペアの追加を UpdatePairs に任せる
+    m_MoveBuffer.push_back(proxyId);
+}
+
+void Broadphase::Clear()
+{
+    m_Tree.Clear();
+    m_MoveBuffer.clear();
+    m_Pairs.clear();
+    m_NewPairs.clear();
+    m_MergedPairs.clear();
+    m_MovedFlags.clear();
+    m_Filters.clear();
+}
+
+//======================================
+// ペア更新
+//======================================
+void Broadphase::UpdatePairs()
+{
+    if (m_MoveBuffer.empty())
+    {
+        return;
+    }
+
+    std::sort(m_MoveBuffer.begin(), m_MoveBuffer.end());
+    m_MoveBuffer.erase(std::unique(m_MoveBuffer.begin(), m_MoveBuffer.end()), m_MoveBuffer.end());
+
+    // 移動フラグの準備（proxyIdはツリーのノード番号）
+    const int maxProxyId = m_MoveBuffer.back();
+    if (static_cast<int>(m_MovedFlags.size()) <= maxProxyId)
+    {
+        m_MovedFlags.resize(maxProxyId + 1, 0);
+    }
+    for (int proxyId : m_MoveBuffer)
+    {
+        m_MovedFlags[proxyId] = 1;
+    }
+
+    auto isMoved = [this](int proxyId)
+    {
+        return proxyId < static_cast<int>(m_MovedFlags.size()) && m_MovedFlags[proxyId] != 0;
+    };
+
+    // 1. 移動したプロキシを含む既存ペアのうち、太らせたAABBが離れたもの・フィルターで除外されたものを除去
+    m_Pairs.erase(std::remove_if(m_Pairs.begin(), m_Pairs.end(), [&](const BroadphasePair& pair)
+    {
+        if (!isMoved(pair.proxyA) && !isMoved(pair.proxyB)) return false;
+        if (!CollisionFilter::ShouldCollide(m_Filters[pair.proxyA], m_Filters[pair.proxyB])) return true;
+        return !Collision_IsOverlapAABB(m_Tree.GetFatAABB(pair.proxyA), m_Tree.GetFatAABB(pair.proxyB));
+    }), m_Pairs.end());
+
+    // 2. 移動したプロキシごとにツリーを検索し新規ペアを収集
+    m_NewPairs.clear();
+    for (int queryProxy : m_MoveBuffer)
+    {
+        const AABB& fatAABB = m_Tree.GetFatAABB(queryProxy);
+        const CollisionFilter& queryFilter = m_Filters[queryProxy];
+        m_Tree.Query(fatAABB, [&](int proxyId)
+        {
+            if (proxyId == queryProxy) return true;
+
+            // 双方が移動している場合は片側からのみ登録
+            if (isMoved(proxyId) && proxyId < queryProxy) return true;
+
+            // レイヤー・マスク・切断グループで衝突しない組み合わせは接触判定へ回さない
+            if (!CollisionFilter::ShouldCollide(queryFilter, m_Filters[proxyId])) return true;
+
+            BroadphasePair pair;
+            pair.proxyA = std::min(proxyId, queryProxy);
+            pair.proxyB = std::max(proxyId, queryProxy);
+            m_NewPairs.push_back(pair);
+            return true;
+        });
+    }
+
+    // 3. 既存リストへソート順を保ってマージ
+    std::sort(m_NewPairs.begin(), m_NewPairs.end());
+    m_NewPairs.erase(std::unique(m_NewPairs.begin(), m_NewPairs.end()), m_NewPairs.end());
+
+    if (!m_NewPairs.empty())
+    {
+        // 入れ替えた後も双方の容量を使い回す
+        m_MergedPairs.clear();
+        m_MergedPairs.reserve(m_Pairs.size() + m_NewPairs.size());
+        std::set_union(m_Pairs.begin(), m_Pairs.end(), m_NewPairs.begin(), m_NewPairs.end(), std::back_inserter(m_MergedPairs));
+        m_Pairs.swap(m_MergedPairs);
+    }
+
+    for (int proxyId : m_MoveBuffer)
+    {
+        m_MovedFlags[proxyId] = 0;
+    }
+    m_MoveBuffer.clear();
+}
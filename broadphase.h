@@ -0,0 +1,82 @@
+﻿/****************************************
+ * @file broadphase.h
+ * @brief 動的オブジェクト用ブロードフェーズ
+ * @detail 動的AABBツリーと永続ペアリストにより、移動したプロキシ分だけペアを更新する
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 衝突フィルターによるペア生成時の除外
+ * @update 2026/10/18 - ペアのマージ先を作業用メンバーにして毎回の確保をなくす
+ ****************************************/
+
+#ifndef BROADPHASE_H
+#define BROADPHASE_H
+
+#include <DirectXMath.h>
+#include <vector>
+#include "dynamic_aabb_tree.h"
+#include "collider.h"
+
+//--------------------------------------
+// 重なり候補ペア（proxyA < proxyB）
+//--------------------------------------
+struct BroadphasePair
+{
+    int proxyA;
+    int proxyB;
+
+    bool operator<(const BroadphasePair& other) const
+    {
+        return (proxyA != other.proxyA) ? (proxyA < other.proxyA) : (proxyB < other.proxyB);
+    }
+    bool operator==(const BroadphasePair& other) const
+    {
+        return proxyA == other.proxyA && proxyB == other.proxyB;
+    }
+};
+
+class Broadphase
+{
+public:
+    Broadphase() = default;
+    ~Broadphase() = default;
+
+    // プロキシ管理
+    int CreateProxy(const AABB& aabb, void* userData, const CollisionFilter& filter = CollisionFilter());
+    void DestroyProxy(int proxyId);
+    void MoveProxy(int proxyId, const AABB& aabb, const DirectX::XMFLOAT3& displacement);
+
+    /**
+     * @brief プロキシの衝突フィルターを変更
+     * @detail 次の UpdatePairs で、このプロキシを含むペアをフィルターに従って作り直す
+     */
+    void SetProxyFilter(int proxyId, const CollisionFilter& filter);
+    const CollisionFilter& GetProxyFilter(int proxyId) const { return m_Filters[proxyId]; }
+
+    /**
+     * @brief 移動したプロキシについてペアリストを更新
+     * @detail 移動していないプロキシ同士のペアは前回の結果を維持する。
+     *         衝突フィルターで除外される組み合わせはペアにしない
+     */
+    void UpdatePairs();
+
+    void Clear();
+
+    // ペアリスト（ソート済み・重複なし）
+    const std::vector<BroadphasePair>& GetPairs() const { return m_Pairs; }
+
+    void* GetUserData(int proxyId) const { return m_Tree.GetUserData(proxyId); }
+    const AABB& GetFatAABB(int proxyId) const { return m_Tree.GetFatAABB(proxyId); }
+    const DynamicAABBTree& GetTree() const { return m_Tree; }
+    int GetProxyCount() const { return m_Tree.GetProxyCount(); }
+
+private:
+    DynamicAABBTree m_Tree;
+    std::vector<int> m_MoveBuffer;          // 今ステップで再挿入・生成されたプロキシ
+    std::vector<BroadphasePair> m_Pairs;        // 永続ペアリスト
+    std::vector<BroadphasePair> m_NewPairs;     // 作業用
+    std::vector<BroadphasePair> m_MergedPairs;  // 作業用（マージ先）
+    std::vector<char> m_MovedFlags;         // proxyId -> 移動フラグ（作業用）
+    std::vector<CollisionFilter> m_Filters; // proxyId -> 衝突フィルター
+};
+
+#endif // BROADPHASE_H
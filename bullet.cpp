@@ -1,28 +1,37 @@
 #include "bullet.h"
 #include "model.h"
+#include "slot_map.h"
 #include "trail.h"
+#include "fixed_step.h"
 using namespace DirectX;
 
 class Bullet
 {
 private:
     XMFLOAT3 m_position{};
+    XMFLOAT3 m_prevPosition{};  // 直前ステップの位置（描画補間用）
     XMFLOAT3 m_velocity{};
     double m_accumulatedTime{ 0.0 };
     static constexpr double MAX_LIFE_TIME = 3.0;
 
 public:
-    Bullet(const XMFLOAT3& position, const XMFLOAT3& velocity) : m_position(position), m_velocity(velocity) {}
+    Bullet(const XMFLOAT3& position, const XMFLOAT3& velocity) : m_position(position), m_prevPosition(position), m_velocity(velocity) {}
 
     void Update(double elapsed_time)
     {
         m_accumulatedTime += elapsed_time;
+        m_prevPosition = m_position;
         XMStoreFloat3(&m_position, XMLoadFloat3(&m_position) + XMLoadFloat3(&m_velocity) * static_cast<float>(elapsed_time));
         Trail_Create(m_position, {0.2f,0.2f,0.6f,0.15f},2.0f,1.0f);
     }
 
     const XMFLOAT3& GetPosition() const { return m_position; }
 
+    XMVECTOR GetRenderPosition(float alpha) const
+    {
+        return XMVectorLerp(XMLoadFloat3(&m_prevPosition), XMLoadFloat3(&m_position), alpha);
+    }
+
     XMFLOAT3 GetFront() const
     {
         XMFLOAT3 front;
@@ -34,65 +43,44 @@ public:
 };
 
 static constexpr int MAX_BULLET = 2048;
-static Bullet* g_pBullets[MAX_BULLET]{};
-static int g_BulletCount{ 0 };
+static SlotMap<Bullet> g_Bullets;
 static MODEL* g_pBulletModel{ nullptr };
 
 void Bullet_Initialize()
 {
     //g_pBulletModel = ModelLoad("assets/fbx/IRR_CAN/ST_IRR_CAN001_bullet.fbx",10.0f);
 
-    // SĂ̒eۂ폜ď
-    for (int i = 0; i < MAX_BULLET; i++)
-    {
-        if (g_pBullets[i] != nullptr)
-        {
-            delete g_pBullets[i];
-            g_pBullets[i] = nullptr;
-        }
-    }
-    g_BulletCount = 0;
+    // 全ての弾丸を削除して初期化
+    g_Bullets.Clear();
+    g_Bullets.Reserve(MAX_BULLET);
 }
 
 void Bullet_Finalize()
 {
-    for (int i = 0; i < g_BulletCount; i++)
-    {
-        if (g_pBullets[i] != nullptr)
-        {
-            delete g_pBullets[i];
-            g_pBullets[i] = nullptr;
-        }
-    }
-    g_BulletCount = 0;
+    g_Bullets.Clear();
     ModelRelease(g_pBulletModel);
     g_pBulletModel = nullptr;
 }
 
 void Bullet_Update(double elapsed_time)
 {
-    // ɑSĂ̒eۂXV
-    for (int i = 0; i < g_BulletCount; i++)
+    // 先に全ての弾丸を更新
+    for (Bullet& bullet : g_Bullets)
     {
-        g_pBullets[i]->Update(elapsed_time);
+        bullet.Update(elapsed_time);
     }
 
-    // ؂̒eۂ폜(납烋[vĔz̍Ĕzu)
-    for (int i = g_BulletCount - 1; i >= 0; i--)
-    {
-        if (g_pBullets[i]->IsDestroy())
-        {
-            Bullet_Destory(i);
-        }
-    }
+    // 寿命切れの弾丸を削除
+    g_Bullets.RemoveIf([](const Bullet& bullet) { return bullet.IsDestroy(); });
 }
 
 void Bullet_Draw()
 {
     XMMATRIX mtxWorld;
-    for (int i = 0; i < g_BulletCount; i++)
+    const float alpha = FixedStep_GetAlpha();
+    for (const Bullet& bullet : g_Bullets)
     {
-        XMVECTOR position = XMLoadFloat3(&g_pBullets[i]->GetPosition());
+        XMVECTOR position = bullet.GetRenderPosition(alpha);
         mtxWorld = XMMatrixTranslationFromVector(position);
         ModelDraw(g_pBulletModel, mtxWorld);
     }
@@ -100,30 +88,21 @@ void Bullet_Draw()
 
 void Bullet_Create(const XMFLOAT3& position, const XMFLOAT3& velocity)
 {
-    if (g_BulletCount >= MAX_BULLET)
+    if (g_Bullets.Size() >= MAX_BULLET)
     {
         return;
     }
 
-    // ÓI͂̂߂ɖIɃCfbNX𕪗
-    int index = g_BulletCount;
-    if (index < MAX_BULLET) // ǉ̈S`FbN
-    {
-        g_pBullets[index] = new Bullet(position, velocity);
-        g_BulletCount++;
-    }
+    g_Bullets.Emplace(position, velocity);
 }
 
 void Bullet_Destory(int index)
 {
-    delete g_pBullets[index];
-    g_pBullets[index] = g_pBullets[g_BulletCount - 1];
-    g_pBullets[g_BulletCount - 1] = nullptr;
-    g_BulletCount--;
+    g_Bullets.RemoveAt(index);
 }
 
-int Bullet_GetBulletCount() { return g_BulletCount; }
+int Bullet_GetBulletCount() { return static_cast<int>(g_Bullets.Size()); }
 
-const AABB Bullet_GetAABB(int index) { return Model_GetAABB(g_pBulletModel, g_pBullets[index]->GetPosition()); }
+const AABB Bullet_GetAABB(int index) { return Model_GetAABB(g_pBulletModel, g_Bullets[index].GetPosition()); }
 
-const XMFLOAT3& Bullet_GetPosition(int index) { return g_pBullets[index]->GetPosition(); }
+const XMFLOAT3& Bullet_GetPosition(int index) { return g_Bullets[index].GetPosition(); }
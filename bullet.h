@@ -1,8 +1,9 @@
 /**
  * @file bullet.h
- * @brief eۂ̏
+ * @brief 弾丸の処理
  * @author Natsume Shidara
  * @date 2025/11/12
+ * @update 2026/10/18 - index は生存中の弾の通し番号（Bullet_Destory で末尾の弾がその位置へ移る）
  */
 #ifndef BULLET_H
 #define BULLET_H
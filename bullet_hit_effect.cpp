@@ -1,5 +1,6 @@
 #include "bullet_hit_effect.h"
 #include "DirectXMath.h"
+#include "slot_map.h"
 #include "sprite_anim.h"
 #include "texture.h"
 #include "direct3d.h"
@@ -8,19 +9,19 @@ using namespace DirectX;
 
 int g_TexId = -1;
 int g_AnimPatternId = -1;
-int g_EffectsCount = 0;
 
 class BulletHitEffect
 {
 private:
     XMFLOAT3 m_position{};
-    int m_anim_play_id = -1;
+    SlotHandle m_anim_play_id;
     bool m_is_destroy{ false };
 
 public:
     BulletHitEffect(const XMFLOAT3& position) : m_position(position), m_anim_play_id(SpriteAnim_CreatePlayer(g_AnimPatternId)) {}
 
-    ~BulletHitEffect() { SpriteAnim_DestroyPlayer(m_anim_play_id); }
+    // 値で SlotMap 内を移動するためデストラクタでは解放しない（削除時に Release を呼ぶ）
+    void Release() const { SpriteAnim_DestroyPlayer(m_anim_play_id); }
 
     void Update();
     void Draw() const;
@@ -28,63 +29,58 @@ public:
 };
 
 static constexpr int EFFECT_MAX = 256;
-static BulletHitEffect* g_pEffects[EFFECT_MAX]{};
+static SlotMap<BulletHitEffect> g_Effects;
 
 void BulletHItEffect_Initialize()
 {
     g_TexId = Texture_Load(L"assets/Explosion.png");
     g_AnimPatternId = SpriteAnim_RegisterPattern(g_TexId, 16, 4, 0.01, { 256, 256 }, { 0, 0 }, false);
-    g_EffectsCount = 0; // 𖾎I
+    g_Effects.Clear();
+    g_Effects.Reserve(EFFECT_MAX);
 }
 
 void BulletHItEffect_Finalize(void)
 {
-    for (int i = 0; i < g_EffectsCount; i++)
+    for (const BulletHitEffect& effect : g_Effects)
     {
-        delete g_pEffects[i];
-        g_pEffects[i] = nullptr; // Ônullptr
+        effect.Release();
     }
-    g_EffectsCount = 0;
+    g_Effects.Clear();
 }
 
 void BulletHItEffect_Update(double elapsed_time)
 {
     (void)elapsed_time;
-    // SGtFNgXV
-    for (int i = 0; i < g_EffectsCount; i++)
+    // 全エフェクトを更新
+    for (BulletHitEffect& effect : g_Effects)
     {
-        g_pEffects[i]->Update();
+        effect.Update();
     }
 
-    // jtÔ폜
-    for (int i = g_EffectsCount - 1; i >= 0; i--)
+    // 破棄フラグが立ったものを削除
+    g_Effects.RemoveIf([](const BulletHitEffect& effect)
     {
-        if (g_pEffects[i]->IsDestroy())
-        {
-            delete g_pEffects[i];
-            g_pEffects[i] = g_pEffects[g_EffectsCount - 1];
-            g_pEffects[g_EffectsCount - 1] = nullptr; // Ô
-            g_EffectsCount--;
-        }
-    }
+        if (!effect.IsDestroy()) return false;
+        effect.Release();
+        return true;
+    });
 }
 
 void BulletHItEffect_Create(const DirectX::XMFLOAT3 position)
 {
-    // z̏`FbN
-    if (g_EffectsCount >= EFFECT_MAX)
+    // 配列の上限チェック
+    if (g_Effects.Size() >= EFFECT_MAX)
         return;
 
-    // q[vɊmہiC_j
-    g_pEffects[g_EffectsCount++] = new BulletHitEffect(position);
+    g_Effects.Emplace(position);
 }
 
 void BulletHItEffect_Draw()
 {
     Direct3D_SetDepthWriteEnable(false);
-    for (int i = 0; i < g_EffectsCount; i++)
+    for (const BulletHitEffect& effect : g_Effects)
     {
-        g_pEffects[i]->Draw();
+        effect.Draw();
     }
     Direct3D_SetDepthWriteEnable(true);
 }
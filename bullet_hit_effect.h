@@ -1,6 +1,6 @@
 /**
  * @file camera.h
- * @brief J
+ * @brief カメラ制御
  *
  * @author Natsume Shidara
  * @date 2025/09/11
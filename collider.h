@@ -1,44 +1,88 @@
 /****************************************
  * @file    collider.h
- * @brief   RC_[VXeigŁj
+ * @brief   統合コライダーシステム（拡張版）
  * @author  Natsume Shidara
  * @date    2025/01/02
+ * @update  2026/10/18 - 凸包コライダーを追加
+ * @update  2026/10/18 - 衝突レイヤー・マスク・グループによるペアの事前除外
  ****************************************/
 #ifndef COLLIDER_H
 #define COLLIDER_H
 
 #include <DirectXMath.h>
-#include "collision.h" // Sphere, OBB, AABBȂǂ̒`
+#include "collision.h" // Sphere, OBB, AABBなどの定義
 #include <algorithm>
+#include <cstdint>
 
  //--------------------------------------
- // RC_[̎
+ // コライダーの種類
  //--------------------------------------
 enum class ColliderType
 {
-    Sphere,   // `
-    Box,      // OBBiLE{bNXj
-    AABB,     // sE{bNX
-    Capsule,  // JvZi~̗[j
-    Triangle, // Op`
+    Sphere,   // 球形
+    Box,      // OBB（有向境界ボックス）
+    AABB,     // 軸並行境界ボックス
+    Capsule,  // カプセル（円柱の両端が半球）
+    Triangle, // 三角形面
+    ConvexHull, // 凸包（GJK / EPA で判定）
 };
 
 //--------------------------------------
-// JvZ`̒`
+// 衝突レイヤー（ビット）
 //--------------------------------------
-/** @struct Capsule @brief 3D JvZ` */
+namespace CollisionLayer
+{
+    constexpr uint32_t None = 0;
+    constexpr uint32_t Debris = 1u << 0;        // 切断された残骸・小道具
+    constexpr uint32_t EnemyPiece = 1u << 1;    // 敵本体・敵の切断片
+    constexpr uint32_t Player = 1u << 2;
+    constexpr uint32_t Static = 1u << 3;        // マップ・地形
+    constexpr uint32_t Projectile = 1u << 4;    // 弾
+    constexpr uint32_t Trigger = 1u << 5;       // 押し返さない判定領域
+    constexpr uint32_t All = 0xFFFFFFFFu;
+}
+
+//--------------------------------------
+// 衝突フィルター
+//--------------------------------------
+/**
+ * @struct CollisionFilter
+ * @brief  所属レイヤーと衝突相手マスク、切断グループの組
+ * @detail 互いのマスクに相手のレイヤーが含まれ、かつ同じグループ（0以外）でない場合のみ衝突する。
+ *         ブロードフェーズのペア生成時に判定し、除外したペアは接触判定まで進まない
+ */
+struct CollisionFilter
+{
+    uint32_t layer = CollisionLayer::Debris;
+    uint32_t mask = CollisionLayer::All;
+    int groupId = 0;    // 同じ切断で生じた破片同士（0=グループなし）
+
+    // 相手がレイヤー単位でしか表せない（マップ・プレイヤーなど）場合の判定
+    bool CanTouch(uint32_t otherLayer) const { return (mask & otherLayer) != 0; }
+
+    static bool ShouldCollide(const CollisionFilter& a, const CollisionFilter& b)
+    {
+        if ((a.mask & b.layer) == 0 || (b.mask & a.layer) == 0) return false;
+        return a.groupId == 0 || a.groupId != b.groupId;
+    }
+};
+
+//--------------------------------------
+// カプセル形状の定義
+//--------------------------------------
+/** @struct Capsule @brief 3D カプセル形状 */
 struct Capsule {
-    DirectX::XMFLOAT3 start;  // ̎n_
-    DirectX::XMFLOAT3 end;    // ̏I_
-    float radius;             // a
+    DirectX::XMFLOAT3 start;  // 線分の始点
+    DirectX::XMFLOAT3 end;    // 線分の終点
+    float radius;             // 半径
 
-    // RXgN^
+    // コンストラクタ
     Capsule() : start{ 0,0,0 }, end{ 0,1,0 }, radius(0.5f) {}
     Capsule(const DirectX::XMFLOAT3& s, const DirectX::XMFLOAT3& e, float r)
         : start(s), end(e), radius(r) {
     }
 
-    // Ɣa琂JvZ쐬
+    // 高さと半径から垂直カプセルを作成
     static Capsule CreateVertical(const DirectX::XMFLOAT3& center, float height, float radius) {
         float halfHeight = height * 0.5f;
         return Capsule(
@@ -48,7 +92,7 @@ struct Capsule {
         );
     }
 
-    // SW擾
+    // 中心座標を取得
     DirectX::XMFLOAT3 GetCenter() const {
         return DirectX::XMFLOAT3(
             (start.x + end.x) * 0.5f,
@@ -57,7 +101,7 @@ struct Capsule {
         );
     }
 
-    // xNg擾
+    // 軸方向ベクトルを取得
     DirectX::XMFLOAT3 GetAxis() const {
         using namespace DirectX;
         XMVECTOR s = XMLoadFloat3(&start);
@@ -67,7 +111,7 @@ struct Capsule {
         return result;
     }
 
-    // 擾
+    // 高さを取得
     float GetHeight() const {
         using namespace DirectX;
         XMVECTOR s = XMLoadFloat3(&start);
@@ -77,13 +121,13 @@ struct Capsule {
 };
 
 //--------------------------------------
-// RC_[\
+// 統合コライダー構造体
 //--------------------------------------
 struct Collider
 {
     ColliderType type;
 
-    // p̂Ńߖ
+    // 共用体でメモリを節約
     union
     {
         Sphere sphere;
@@ -91,19 +135,20 @@ struct Collider
         AABB aabb;
         Capsule capsule;
         Triangle triangle;
+        ConvexHull hull;
     };
 
     //--------------------------------------
-    // RXgN^Q
+    // コンストラクタ群
     //--------------------------------------
 
-    // ftHg: a1̋
+    // デフォルト: 半径1の球
     Collider() : type(ColliderType::Sphere) {
         sphere.center = { 0, 0, 0 };
         sphere.radius = 1.0f;
     }
 
-    // `RC_[쐬
+    // 球形コライダー作成
     static Collider CreateSphere(const DirectX::XMFLOAT3& center, float radius) {
         Collider col;
         col.type = ColliderType::Sphere;
@@ -112,7 +157,7 @@ struct Collider
         return col;
     }
 
-    // OBBRC_[쐬
+    // OBBコライダー作成
     static Collider CreateOBB(const DirectX::XMFLOAT3& center,
         const DirectX::XMFLOAT3& extents,
         const DirectX::XMFLOAT4& orientation = { 0,0,0,1 }) {
@@ -124,7 +169,7 @@ struct Collider
         return col;
     }
 
-    // AABBRC_[쐬iŏEő_j
+    // AABBコライダー作成（最小・最大点から）
     static Collider CreateAABB(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max) {
         Collider col;
         col.type = ColliderType::AABB;
@@ -133,7 +178,7 @@ struct Collider
         return col;
     }
 
-    // AABBRC_[쐬iSƃTCYj
+    // AABBコライダー作成（中心とサイズから）
     static Collider CreateAABBFromCenterSize(const DirectX::XMFLOAT3& center,
         const DirectX::XMFLOAT3& size) {
         DirectX::XMFLOAT3 halfSize = {
@@ -147,7 +192,7 @@ struct Collider
         );
     }
 
-    // JvZRC_[쐬
+    // カプセルコライダー作成
     static Collider CreateCapsule(const DirectX::XMFLOAT3& start,
         const DirectX::XMFLOAT3& end,
         float radius) {
@@ -159,7 +204,7 @@ struct Collider
         return col;
     }
 
-    // JvZRC_[쐬iLN^[pj
+    // 垂直カプセルコライダー作成（キャラクター用）
     static Collider CreateVerticalCapsule(const DirectX::XMFLOAT3& center,
         float height,
         float radius) {
@@ -169,7 +214,7 @@ struct Collider
         return col;
     }
 
-    // Op`RC_[쐬
+    // 三角形コライダー作成
     static Collider CreateTriangle(const DirectX::XMFLOAT3& p0,
         const DirectX::XMFLOAT3& p1,
         const DirectX::XMFLOAT3& p2,
@@ -183,11 +228,25 @@ struct Collider
         return col;
     }
 
+    // 凸包コライダー作成（頂点配列は呼び出し側が保持し続けること）
+    static Collider CreateConvexHull(const DirectX::XMFLOAT3* points,
+        int pointCount,
+        const DirectX::XMFLOAT3& center = { 0,0,0 },
+        const DirectX::XMFLOAT4& orientation = { 0,0,0,1 }) {
+        Collider col;
+        col.type = ColliderType::ConvexHull;
+        col.hull.points = points;
+        col.hull.pointCount = pointCount;
+        col.hull.center = center;
+        col.hull.orientation = orientation;
+        return col;
+    }
+
     //--------------------------------------
-    // [eBeB֐
+    // ユーティリティ関数
     //--------------------------------------
 
-    // SW擾
+    // 中心座標を取得
     DirectX::XMFLOAT3 GetCenter() const {
         switch (type) {
         case ColliderType::Sphere:
@@ -207,12 +266,14 @@ struct Collider
             XMStoreFloat3(&result, (v0 + v1 + v2) / 3.0f);
             return result;
         }
+        case ColliderType::ConvexHull:
+            return hull.center;
         default:
             return DirectX::XMFLOAT3(0, 0, 0);
         }
     }
 
-    // ʒuݒiSWړj
+    // 位置を設定（中心座標を移動）
     void SetPosition(const DirectX::XMFLOAT3& pos) {
         using namespace DirectX;
 
@@ -257,10 +318,13 @@ struct Collider
             XMStoreFloat3(&triangle.p2, v2 + offset);
             break;
         }
+        case ColliderType::ConvexHull:
+            hull.center = pos;
+            break;
         }
     }
 
-    // oEfBO{bNX擾iAABB`j
+    // バウンディングボックスを取得（AABB形式）
     AABB GetBoundingBox() const {
         using namespace DirectX;
 
@@ -274,7 +338,7 @@ struct Collider
             };
         }
         case ColliderType::Box: {
-            // OBB8_vZAABB쐬
+            // OBBの8頂点を計算してAABBを作成
             XMMATRIX rot = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.orientation));
             XMVECTOR center = XMLoadFloat3(&obb.center);
             XMVECTOR ext = XMLoadFloat3(&obb.extents);
@@ -326,12 +390,29 @@ struct Collider
 
             return AABB{ minPoint, maxPoint };
         }
+        case ColliderType::ConvexHull: {
+            XMVECTOR q = XMLoadFloat4(&hull.orientation);
+            XMVECTOR center = XMLoadFloat3(&hull.center);
+            XMVECTOR vMin = XMVectorReplicate(FLT_MAX);
+            XMVECTOR vMax = XMVectorReplicate(-FLT_MAX);
+
+            for (int i = 0; i < hull.pointCount; ++i) {
+                XMVECTOR p = XMVector3Rotate(XMLoadFloat3(&hull.points[i]), q) + center;
+                vMin = XMVectorMin(vMin, p);
+                vMax = XMVectorMax(vMax, p);
+            }
+
+            XMFLOAT3 minPoint, maxPoint;
+            XMStoreFloat3(&minPoint, vMin);
+            XMStoreFloat3(&maxPoint, vMax);
+            return AABB{ minPoint, maxPoint };
+        }
         default:
             return AABB{ {0,0,0}, {0,0,0} };
         }
     }
 
-    // fobOpF^擾
+    // デバッグ用：型名を取得
     const char* GetTypeName() const {
         switch (type) {
         case ColliderType::Sphere: return "Sphere";
@@ -339,6 +420,7 @@ struct Collider
         case ColliderType::AABB: return "AABB";
         case ColliderType::Capsule: return "Capsule";
         case ColliderType::Triangle: return "Triangle";
+        case ColliderType::ConvexHull: return "ConvexHull";
         default: return "Unknown";
         }
     }
@@ -1,72 +1,827 @@
 /****************************************
  * @file collider_generator.cpp
- * @brief RC_[̎
- * @detail DirectXCollision𗘗pOBBZo
+ * @brief コライダー自動生成の実装
+ * @detail 点列を SoA に並べ替え、DirectXMath のベクトル演算で4点ずつ処理する。
+ *         最小球は move-to-front 版の Welzl 法、OBB は主成分分析の向きを起点に各軸まわりの回転で体積を詰め、
+ *         カプセルはその OBB の最も長い軸を芯にする
  * @author Natsume Shidara
  * @update 2025/12/15
+ * @update 2026/10/18 - 形状別の専用フィッターに置き換え（球を指定しても OBB を書き込んでいた）
  ****************************************/
 
 #include "collider_generator.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
 #include <vector>
-#include <DirectXCollision.h> // BoundingOrientedBoxp
 
 using namespace DirectX;
+using namespace ColliderGeneratorConfig;
 
 //======================================
-// OBB
+// 点列の SoA 表現
+//======================================
+namespace
+{
+    constexpr size_t LANE_COUNT = 4;
+    constexpr float SPHERE_VOLUME_CONSTANT = 4.18879f;  // 4/3 * PI
+
+    /**
+     * @struct PointStream
+     * @brief 4点単位で読めるよう末尾を先頭の点で埋めた SoA の点列
+     * @detail 埋めた点は最小・最大・最遠の計算には影響しない。合計を取る場合は差し引くこと
+     */
+    struct PointStream
+    {
+        std::vector<float> x, y, z;
+        size_t count = 0;           // 実際の点数
+        size_t paddedCount = 0;     // LANE_COUNT の倍数
+
+        XMVECTOR LoadX(size_t i) const { return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&x[i])); }
+        XMVECTOR LoadY(size_t i) const { return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&y[i])); }
+        XMVECTOR LoadZ(size_t i) const { return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&z[i])); }
+        XMFLOAT3 Get(size_t i) const { return { x[i], y[i], z[i] }; }
+    };
+
+    PointStream MakeStream(const XMFLOAT3* points, size_t count)
+    {
+        PointStream stream;
+        stream.count = count;
+        stream.paddedCount = (count + LANE_COUNT - 1) / LANE_COUNT * LANE_COUNT;
+        stream.x.resize(stream.paddedCount);
+        stream.y.resize(stream.paddedCount);
+        stream.z.resize(stream.paddedCount);
+
+        for (size_t i = 0; i < stream.paddedCount; ++i)
+        {
+            const XMFLOAT3& p = points[i < count ? i : 0];
+            stream.x[i] = p.x;
+            stream.y[i] = p.y;
+            stream.z[i] = p.z;
+        }
+        return stream;
+    }
+
+    float HorizontalMin(FXMVECTOR v)
+    {
+        XMFLOAT4 f;
+        XMStoreFloat4(&f, v);
+        return std::min(std::min(f.x, f.y), std::min(f.z, f.w));
+    }
+
+    float HorizontalMax(FXMVECTOR v)
+    {
+        XMFLOAT4 f;
+        XMStoreFloat4(&f, v);
+        return std::max(std::max(f.x, f.y), std::max(f.z, f.w));
+    }
+
+    double HorizontalSum(FXMVECTOR v)
+    {
+        XMFLOAT4 f;
+        XMStoreFloat4(&f, v);
+        return static_cast<double>(f.x) + f.y + f.z + f.w;
+    }
+
+    // 4点分の axis との内積
+    XMVECTOR Project(FXMVECTOR px, FXMVECTOR py, FXMVECTOR pz, const XMFLOAT3& axis)
+    {
+        XMVECTOR d = XMVectorMultiply(px, XMVectorReplicate(axis.x));
+        d = XMVectorMultiplyAdd(py, XMVectorReplicate(axis.y), d);
+        return XMVectorMultiplyAdd(pz, XMVectorReplicate(axis.z), d);
+    }
+}
+
+//======================================
+// OBB
+//======================================
+namespace
+{
+    /**
+     * @struct Frame
+     * @brief 直交する3軸と、各軸へ射影した点列の範囲
+     */
+    struct Frame
+    {
+        XMFLOAT3 axes[3];
+        float min[3];
+        float max[3];
+
+        float GetVolume() const
+        {
+            return (max[0] - min[0]) * (max[1] - min[1]) * (max[2] - min[2]);
+        }
+    };
+
+    void MeasureFrame(const PointStream& stream, Frame& frame)
+    {
+        XMVECTOR vMin[3], vMax[3];
+        for (int k = 0; k < 3; ++k)
+        {
+            vMin[k] = XMVectorReplicate(FLT_MAX);
+            vMax[k] = XMVectorReplicate(-FLT_MAX);
+        }
+
+        for (size_t i = 0; i < stream.paddedCount; i += LANE_COUNT)
+        {
+            const XMVECTOR px = stream.LoadX(i);
+            const XMVECTOR py = stream.LoadY(i);
+            const XMVECTOR pz = stream.LoadZ(i);
+            for (int k = 0; k < 3; ++k)
+            {
+                const XMVECTOR d = Project(px, py, pz, frame.axes[k]);
+                vMin[k] = XMVectorMin(vMin[k], d);
+                vMax[k] = XMVectorMax(vMax[k], d);
+            }
+        }
+
+        for (int k = 0; k < 3; ++k)
+        {
+            frame.min[k] = HorizontalMin(vMin[k]);
+            frame.max[k] = HorizontalMax(vMax[k]);
+        }
+    }
+
+    /**
+     * @brief 点列の共分散行列（2パス：平均、平均からのずれ）
+     */
+    void ComputeCovariance(const PointStream& stream, double (&outCovariance)[3][3])
+    {
+        const double padding = static_cast<double>(stream.paddedCount - stream.count);
+        const XMFLOAT3 first = stream.Get(0);
+
+        XMVECTOR sumX = XMVectorZero(), sumY = XMVectorZero(), sumZ = XMVectorZero();
+        for (size_t i = 0; i < stream.paddedCount; i += LANE_COUNT)
+        {
+            sumX = XMVectorAdd(sumX, stream.LoadX(i));
+            sumY = XMVectorAdd(sumY, stream.LoadY(i));
+            sumZ = XMVectorAdd(sumZ, stream.LoadZ(i));
+        }
+        const double invCount = 1.0 / static_cast<double>(stream.count);
+        const XMFLOAT3 mean = {
+            static_cast<float>((HorizontalSum(sumX) - padding * first.x) * invCount),
+            static_cast<float>((HorizontalSum(sumY) - padding * first.y) * invCount),
+            static_cast<float>((HorizontalSum(sumZ) - padding * first.z) * invCount),
+        };
+
+        const XMVECTOR meanX = XMVectorReplicate(mean.x);
+        const XMVECTOR meanY = XMVectorReplicate(mean.y);
+        const XMVECTOR meanZ = XMVectorReplicate(mean.z);
+        XMVECTOR xx = XMVectorZero(), xy = XMVectorZero(), xz = XMVectorZero();
+        XMVECTOR yy = XMVectorZero(), yz = XMVectorZero(), zz = XMVectorZero();
+        for (size_t i = 0; i < stream.paddedCount; i += LANE_COUNT)
+        {
+            const XMVECTOR dx = XMVectorSubtract(stream.LoadX(i), meanX);
+            const XMVECTOR dy = XMVectorSubtract(stream.LoadY(i), meanY);
+            const XMVECTOR dz = XMVectorSubtract(stream.LoadZ(i), meanZ);
+            xx = XMVectorMultiplyAdd(dx, dx, xx);
+            xy = XMVectorMultiplyAdd(dx, dy, xy);
+            xz = XMVectorMultiplyAdd(dx, dz, xz);
+            yy = XMVectorMultiplyAdd(dy, dy, yy);
+            yz = XMVectorMultiplyAdd(dy, dz, yz);
+            zz = XMVectorMultiplyAdd(dz, dz, zz);
+        }
+
+        const double fx = static_cast<double>(first.x) - mean.x;
+        const double fy = static_cast<double>(first.y) - mean.y;
+        const double fz = static_cast<double>(first.z) - mean.z;
+        outCovariance[0][0] = (HorizontalSum(xx) - padding * fx * fx) * invCount;
+        outCovariance[0][1] = (HorizontalSum(xy) - padding * fx * fy) * invCount;
+        outCovariance[0][2] = (HorizontalSum(xz) - padding * fx * fz) * invCount;
+        outCovariance[1][1] = (HorizontalSum(yy) - padding * fy * fy) * invCount;
+        outCovariance[1][2] = (HorizontalSum(yz) - padding * fy * fz) * invCount;
+        outCovariance[2][2] = (HorizontalSum(zz) - padding * fz * fz) * invCount;
+        outCovariance[1][0] = outCovariance[0][1];
+        outCovariance[2][0] = outCovariance[0][2];
+        outCovariance[2][1] = outCovariance[1][2];
+    }
+
+    /**
+     * @brief 対称3x3行列の固有ベクトル（ヤコビ法、固有値の大きい順に並べて返す）
+     */
+    void ComputeEigenVectors(double (&matrix)[3][3], XMFLOAT3 (&outAxes)[3])
+    {
+        double vectors[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };   // 列が固有ベクトル
+
+        constexpr int MAX_SWEEPS = 32;
+        for (int sweep = 0; sweep < MAX_SWEEPS; ++sweep)
+        {
+            const double offDiagonal = std::abs(matrix[0][1]) + std::abs(matrix[0][2]) + std::abs(matrix[1][2]);
+            if (offDiagonal < 1e-15) break;
+
+            for (int p = 0; p < 2; ++p)
+            {
+                for (int q = p + 1; q < 3; ++q)
+                {
+                    if (std::abs(matrix[p][q]) < 1e-30) continue;
+
+                    // a[p][q] を 0 にする回転
+                    const double theta = (matrix[q][q] - matrix[p][p]) / (2.0 * matrix[p][q]);
+                    const double t = (theta >= 0.0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+                    const double c = 1.0 / std::sqrt(t * t + 1.0);
+                    const double s = t * c;
+
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        const double kp = matrix[k][p], kq = matrix[k][q];
+                        matrix[k][p] = c * kp - s * kq;
+                        matrix[k][q] = s * kp + c * kq;
+                    }
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        const double pk = matrix[p][k], qk = matrix[q][k];
+                        matrix[p][k] = c * pk - s * qk;
+                        matrix[q][k] = s * pk + c * qk;
+                    }
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        const double kp = vectors[k][p], kq = vectors[k][q];
+                        vectors[k][p] = c * kp - s * kq;
+                        vectors[k][q] = s * kp + c * kq;
+                    }
+                }
+            }
+        }
+
+        int order[3] = { 0, 1, 2 };
+        std::sort(order, order + 3, [&](int a, int b) { return matrix[a][a] > matrix[b][b]; });
+        for (int k = 0; k < 3; ++k)
+        {
+            const int column = order[k];
+            outAxes[k] = { static_cast<float>(vectors[0][column]), static_cast<float>(vectors[1][column]), static_cast<float>(vectors[2][column]) };
+        }
+
+        // 右手系の正規直交基底にそろえる（回転として表せるように）
+        XMVECTOR a0 = XMVector3Normalize(XMLoadFloat3(&outAxes[0]));
+        XMVECTOR a1 = XMVector3Normalize(XMLoadFloat3(&outAxes[1]));
+        a1 = XMVector3Normalize(XMVectorSubtract(a1, XMVectorMultiply(XMVector3Dot(a0, a1), a0)));
+        XMStoreFloat3(&outAxes[0], a0);
+        XMStoreFloat3(&outAxes[1], a1);
+        XMStoreFloat3(&outAxes[2], XMVector3Cross(a0, a1));
+    }
+
+    /**
+     * @brief base の軸 k を固定し、残り2軸を angle だけ回した軸
+     */
+    void RotateAxes(const XMFLOAT3 (&base)[3], int k, float angle, XMFLOAT3 (&outAxes)[3])
+    {
+        const int i = (k + 1) % 3;
+        const int j = (k + 2) % 3;
+        const float c = std::cos(angle);
+        const float s = std::sin(angle);
+
+        outAxes[k] = base[k];
+        outAxes[i] = { base[i].x * c + base[j].x * s, base[i].y * c + base[j].y * s, base[i].z * c + base[j].z * s };
+        outAxes[j] = { base[j].x * c - base[i].x * s, base[j].y * c - base[i].y * s, base[j].z * c - base[i].z * s };
+    }
+
+    /**
+     * @brief 軸 k まわりの回転角を探索し、体積が小さくなれば frame を置き換える
+     * @detail 直方体の断面積は 90 度周期なので [0, 90) を粗く探し、最良の角度の前後を半分ずつ詰める
+     */
+    void RefineFrameAroundAxis(const PointStream& stream, int k, Frame& frame)
+    {
+        const XMFLOAT3 base[3] = { frame.axes[0], frame.axes[1], frame.axes[2] };
+        float bestAngle = 0.0f;
+        float bestVolume = frame.GetVolume();
+        Frame best = frame;
+
+        auto evaluate = [&](float angle) {
+            Frame candidate;
+            RotateAxes(base, k, angle, candidate.axes);
+            MeasureFrame(stream, candidate);
+            if (candidate.GetVolume() < bestVolume)
+            {
+                bestVolume = candidate.GetVolume();
+                bestAngle = angle;
+                best = candidate;
+            }
+        };
+
+        float step = XM_PIDIV2 / OBB_COARSE_STEPS;
+        for (int i = 1; i < OBB_COARSE_STEPS; ++i)
+        {
+            evaluate(step * i);
+        }
+        for (int i = 0; i < OBB_REFINE_STEPS; ++i)
+        {
+            step *= 0.5f;
+            const float center = bestAngle;
+            evaluate(center - step);
+            evaluate(center + step);
+        }
+        frame = best;
+    }
+
+    Frame FitFrame(const PointStream& stream)
+    {
+        // 主成分の向きと軸並行のうち小さい方から詰める（点が平面上に並ぶと主成分が不安定なため）
+        Frame principal;
+        double covariance[3][3];
+        ComputeCovariance(stream, covariance);
+        ComputeEigenVectors(covariance, principal.axes);
+        MeasureFrame(stream, principal);
+
+        Frame aligned = { { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } } };
+        MeasureFrame(stream, aligned);
+
+        Frame frame = (aligned.GetVolume() <= principal.GetVolume()) ? aligned : principal;
+        for (int k = 0; k < 3; ++k)
+        {
+            RefineFrameAroundAxis(stream, k, frame);
+        }
+        return frame;
+    }
+
+    OBB FrameToOBB(const Frame& frame)
+    {
+        OBB obb;
+        XMVECTOR center = XMVectorZero();
+        float extents[3];
+        for (int k = 0; k < 3; ++k)
+        {
+            const float middle = (frame.min[k] + frame.max[k]) * 0.5f;
+            center = XMVectorMultiplyAdd(XMLoadFloat3(&frame.axes[k]), XMVectorReplicate(middle), center);
+            extents[k] = (frame.max[k] - frame.min[k]) * 0.5f;
+        }
+        XMStoreFloat3(&obb.center, center);
+        obb.extents = { extents[0], extents[1], extents[2] };
+
+        // XMMatrixRotationQuaternion の各行が軸になる回転
+        XMMATRIX rotation = XMMatrixIdentity();
+        rotation.r[0] = XMLoadFloat3(&frame.axes[0]);
+        rotation.r[1] = XMLoadFloat3(&frame.axes[1]);
+        rotation.r[2] = XMLoadFloat3(&frame.axes[2]);
+        XMStoreFloat4(&obb.orientation, XMQuaternionNormalize(XMQuaternionRotationMatrix(rotation)));
+        return obb;
+    }
+}
+
+//======================================
+// 最小球（Welzl 法）
+//======================================
+namespace
+{
+    struct Ball
+    {
+        double center[3];
+        double radiusSq;
+    };
+
+    struct Point3d
+    {
+        double x, y, z;
+    };
+
+    Point3d ToPoint3d(const XMFLOAT3& p) { return { p.x, p.y, p.z }; }
+    Point3d operator-(const Point3d& a, const Point3d& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+    Point3d operator+(const Point3d& a, const Point3d& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+    Point3d operator*(const Point3d& a, double s) { return { a.x * s, a.y * s, a.z * s }; }
+    double Dot(const Point3d& a, const Point3d& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+    Point3d Cross(const Point3d& a, const Point3d& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+
+    Ball MakeBall(const Point3d& center, const Point3d& onSurface)
+    {
+        const Point3d d = onSurface - center;
+        return { { center.x, center.y, center.z }, Dot(d, d) };
+    }
+
+    bool Contains(const Ball& ball, const Point3d& p)
+    {
+        const Point3d d = p - Point3d{ ball.center[0], ball.center[1], ball.center[2] };
+        return Dot(d, d) <= ball.radiusSq * (1.0 + SPHERE_EPSILON) + 1e-12;
+    }
+
+    Ball BallFrom2(const Point3d& a, const Point3d& b)
+    {
+        return MakeBall((a + b) * 0.5, a);
+    }
+
+    /**
+     * @brief 3点を通る最小の球（外接円）。一直線なら最も離れた2点の球
+     */
+    Ball BallFrom3(const Point3d& a, const Point3d& b, const Point3d& c)
+    {
+        const Point3d u = b - a;
+        const Point3d v = c - a;
+        const Point3d w = Cross(u, v);
+        const double wSq = Dot(w, w);
+        if (wSq <= 1e-12 * Dot(u, u) * Dot(v, v))
+        {
+            const Point3d bc = c - b;
+            if (Dot(u, u) >= Dot(v, v) && Dot(u, u) >= Dot(bc, bc)) return BallFrom2(a, b);
+            if (Dot(v, v) >= Dot(bc, bc)) return BallFrom2(a, c);
+            return BallFrom2(b, c);
+        }
+
+        const Point3d offset = (Cross(w, u) * Dot(v, v) + Cross(v, w) * Dot(u, u)) * (1.0 / (2.0 * wSq));
+        return MakeBall(a + offset, a);
+    }
+
+    /**
+     * @brief 4点を通る球（外接球）。同一平面なら4点を包む3点の球のうち最小のもの
+     */
+    Ball BallFrom4(const Point3d& a, const Point3d& b, const Point3d& c, const Point3d& d)
+    {
+        const Point3d u = b - a;
+        const Point3d v = c - a;
+        const Point3d w = d - a;
+        const double det = Dot(u, Cross(v, w));
+        const double scale = std::sqrt(Dot(u, u) * Dot(v, v) * Dot(w, w));
+        if (std::abs(det) <= 1e-9 * scale)
+        {
+            const Point3d points[4] = { a, b, c, d };
+            const Ball candidates[4] = { BallFrom3(a, b, c), BallFrom3(a, b, d), BallFrom3(a, c, d), BallFrom3(b, c, d) };
+            Ball best = { { 0, 0, 0 }, DBL_MAX };
+            for (int i = 0; i < 4; ++i)
+            {
+                if (candidates[i].radiusSq < best.radiusSq && Contains(candidates[i], points[(3 - i)]))
+                {
+                    best = candidates[i];
+                }
+            }
+            return (best.radiusSq < DBL_MAX) ? best : candidates[0];
+        }
+
+        const Point3d offset = (Cross(v, w) * Dot(u, u) + Cross(w, u) * Dot(v, v) + Cross(u, v) * Dot(w, w)) * (1.0 / (2.0 * det));
+        return MakeBall(a + offset, a);
+    }
+
+    /**
+     * @brief [begin, end) で球の外にある最初の点（無ければ end）
+     */
+    size_t FindOutside(const PointStream& stream, size_t begin, size_t end, const Ball& ball)
+    {
+        const float threshold = static_cast<float>(ball.radiusSq * (1.0 + SPHERE_EPSILON) + 1e-12);
+        const float cx = static_cast<float>(ball.center[0]);
+        const float cy = static_cast<float>(ball.center[1]);
+        const float cz = static_cast<float>(ball.center[2]);
+
+        auto isOutside = [&](size_t i) {
+            const float dx = stream.x[i] - cx, dy = stream.y[i] - cy, dz = stream.z[i] - cz;
+            return dx * dx + dy * dy + dz * dz > threshold;
+        };
+
+        size_t i = begin;
+        for (; i < end && (i % LANE_COUNT) != 0; ++i)
+        {
+            if (isOutside(i)) return i;
+        }
+
+        const XMVECTOR vcx = XMVectorReplicate(cx);
+        const XMVECTOR vcy = XMVectorReplicate(cy);
+        const XMVECTOR vcz = XMVectorReplicate(cz);
+        const XMVECTOR vThreshold = XMVectorReplicate(threshold);
+        for (; i + LANE_COUNT <= end; i += LANE_COUNT)
+        {
+            const XMVECTOR dx = XMVectorSubtract(stream.LoadX(i), vcx);
+            const XMVECTOR dy = XMVectorSubtract(stream.LoadY(i), vcy);
+            const XMVECTOR dz = XMVectorSubtract(stream.LoadZ(i), vcz);
+            const XMVECTOR distSq = XMVectorMultiplyAdd(dz, dz, XMVectorMultiplyAdd(dy, dy, XMVectorMultiply(dx, dx)));
+            if (XMVector4LessOrEqual(distSq, vThreshold)) continue;
+
+            for (size_t lane = i; lane < i + LANE_COUNT; ++lane)
+            {
+                if (isOutside(lane)) return lane;
+            }
+        }
+
+        for (; i < end; ++i)
+        {
+            if (isOutside(i)) return i;
+        }
+        return end;
+    }
+
+    float MaxDistanceSq(const PointStream& stream, const XMFLOAT3& center)
+    {
+        const XMVECTOR vcx = XMVectorReplicate(center.x);
+        const XMVECTOR vcy = XMVectorReplicate(center.y);
+        const XMVECTOR vcz = XMVectorReplicate(center.z);
+        XMVECTOR vMax = XMVectorZero();
+        for (size_t i = 0; i < stream.paddedCount; i += LANE_COUNT)
+        {
+            const XMVECTOR dx = XMVectorSubtract(stream.LoadX(i), vcx);
+            const XMVECTOR dy = XMVectorSubtract(stream.LoadY(i), vcy);
+            const XMVECTOR dz = XMVectorSubtract(stream.LoadZ(i), vcz);
+            vMax = XMVectorMax(vMax, XMVectorMultiplyAdd(dz, dz, XMVectorMultiplyAdd(dy, dy, XMVectorMultiply(dx, dx))));
+        }
+        return HorizontalMax(vMax);
+    }
+
+    /**
+     * @brief 境界に載る点（0～4個）だけから決まる最小の球。0個なら全点を外とみなす空の球
+     */
+    Ball BallFromSupport(const Point3d* support, int supportCount)
+    {
+        switch (supportCount)
+        {
+        case 0:  return { { 0.0, 0.0, 0.0 }, -1.0 };
+        case 1:  return MakeBall(support[0], support[0]);
+        case 2:  return BallFrom2(support[0], support[1]);
+        case 3:  return BallFrom3(support[0], support[1], support[2]);
+        default: return BallFrom4(support[0], support[1], support[2], support[3]);
+        }
+    }
+
+    /**
+     * @brief index 番目の点を先頭へ移し、[0, index) を1つ後ろへずらす
+     */
+    void MoveToFront(PointStream& stream, size_t index)
+    {
+        std::rotate(stream.x.begin(), stream.x.begin() + index, stream.x.begin() + index + 1);
+        std::rotate(stream.y.begin(), stream.y.begin() + index, stream.y.begin() + index + 1);
+        std::rotate(stream.z.begin(), stream.z.begin() + index, stream.z.begin() + index + 1);
+    }
+
+    /**
+     * @brief [0, end) を support とともに包む最小の球（move-to-front 版 Welzl 法）
+     * @detail 外にあった点を境界に固定して包み直したあと、その点を先頭へ移す。
+     *         球を大きく広げた点ほど前に集まり、以降の走査で早く外側判定されるため、
+     *         包み直しで点列の後半まで読み直す回数が減る
+     */
+    Ball MoveToFrontBall(PointStream& stream, size_t end, Point3d* support, int supportCount)
+    {
+        Ball ball = BallFromSupport(support, supportCount);
+        if (supportCount == 4) return ball;
+
+        for (size_t i = FindOutside(stream, 0, end, ball); i < end; i = FindOutside(stream, i + 1, end, ball))
+        {
+            support[supportCount] = ToPoint3d(stream.Get(i));
+            ball = MoveToFrontBall(stream, i, support, supportCount + 1);
+            MoveToFront(stream, i);
+        }
+        return ball;
+    }
+
+    /**
+     * @brief シャッフル済みの点列に対する最小球（点列は move-to-front で並べ替えられる）
+     */
+    Sphere FitSphereStream(PointStream& stream)
+    {
+        Point3d support[4];
+        const Ball ball = MoveToFrontBall(stream, stream.count, support, 0);
+
+        // 許容誤差で外に残った点も含むよう、半径は最遠点までの距離で取り直す
+        Sphere sphere;
+        sphere.center = { static_cast<float>(ball.center[0]), static_cast<float>(ball.center[1]), static_cast<float>(ball.center[2]) };
+        sphere.radius = std::sqrt(MaxDistanceSq(stream, sphere.center));
+        return sphere;
+    }
+}
+
+//======================================
+// カプセル
+//======================================
+namespace
+{
+    /**
+     * @brief OBB の最も長い軸を芯にしたカプセル
+     * @detail 半径は芯からの最遠距離。端点は各点が半球に収まる範囲まで芯を縮める
+     */
+    Capsule FitCapsuleStream(const PointStream& stream, const OBB& obb)
+    {
+        const XMMATRIX rotation = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.orientation));
+        const float extents[3] = { obb.extents.x, obb.extents.y, obb.extents.z };
+        const int longest = (extents[0] >= extents[1] && extents[0] >= extents[2]) ? 0 : (extents[1] >= extents[2] ? 1 : 2);
+
+        XMFLOAT3 axis;
+        XMStoreFloat3(&axis, rotation.r[longest]);
+        const XMVECTOR vcx = XMVectorReplicate(obb.center.x);
+        const XMVECTOR vcy = XMVectorReplicate(obb.center.y);
+        const XMVECTOR vcz = XMVectorReplicate(obb.center.z);
+
+        // 芯からの距離の2乗と芯方向の位置
+        auto load = [&](size_t i, XMVECTOR& outT, XMVECTOR& outRadialSq) {
+            const XMVECTOR dx = XMVectorSubtract(stream.LoadX(i), vcx);
+            const XMVECTOR dy = XMVectorSubtract(stream.LoadY(i), vcy);
+            const XMVECTOR dz = XMVectorSubtract(stream.LoadZ(i), vcz);
+            outT = Project(dx, dy, dz, axis);
+            const XMVECTOR lengthSq = XMVectorMultiplyAdd(dz, dz, XMVectorMultiplyAdd(dy, dy, XMVectorMultiply(dx, dx)));
+            outRadialSq = XMVectorMax(XMVectorSubtract(lengthSq, XMVectorMultiply(outT, outT)), XMVectorZero());
+        };
+
+        XMVECTOR vRadiusSq = XMVectorZero();
+        for (size_t i = 0; i < stream.paddedCount; i += LANE_COUNT)
+        {
+            XMVECTOR t, radialSq;
+            load(i, t, radialSq);
+            vRadiusSq = XMVectorMax(vRadiusSq, radialSq);
+        }
+        const float radiusSq = HorizontalMax(vRadiusSq);
+        const XMVECTOR vRadiusSqAll = XMVectorReplicate(radiusSq);
+
+        XMVECTOR vTop = XMVectorReplicate(-FLT_MAX);
+        XMVECTOR vBottom = XMVectorReplicate(FLT_MAX);
+        for (size_t i = 0; i < stream.paddedCount; i += LANE_COUNT)
+        {
+            XMVECTOR t, radialSq;
+            load(i, t, radialSq);
+            const XMVECTOR reach = XMVectorSqrt(XMVectorMax(XMVectorSubtract(vRadiusSqAll, radialSq), XMVectorZero()));
+            vTop = XMVectorMax(vTop, XMVectorSubtract(t, reach));
+            vBottom = XMVectorMin(vBottom, XMVectorAdd(t, reach));
+        }
+
+        float top = HorizontalMax(vTop);
+        float bottom = HorizontalMin(vBottom);
+        if (bottom > top)
+        {
+            // 1つの球に収まる場合は芯を点に潰す
+            top = bottom = (top + bottom) * 0.5f;
+        }
+
+        const XMVECTOR vCenter = XMLoadFloat3(&obb.center);
+        const XMVECTOR vAxis = XMLoadFloat3(&axis);
+        XMFLOAT3 start, end;
+        XMStoreFloat3(&start, XMVectorMultiplyAdd(vAxis, XMVectorReplicate(bottom), vCenter));
+        XMStoreFloat3(&end, XMVectorMultiplyAdd(vAxis, XMVectorReplicate(top), vCenter));
+        return Capsule(start, end, std::sqrt(radiusSq));
+    }
+
+    /**
+     * @brief 点が無い場合の既定の形状（half は箱の半分の大きさ・球とカプセルの半径）
+     */
+    Collider MakeDefault(ColliderType colliderType, float half)
+    {
+        switch (colliderType)
+        {
+        case ColliderType::Sphere:
+            return Collider::CreateSphere({ 0.0f, 0.0f, 0.0f }, half);
+        case ColliderType::Capsule:
+            return Collider::CreateCapsule({ 0.0f, -half, 0.0f }, { 0.0f, half, 0.0f }, half);
+        default:
+            return Collider::CreateOBB({ 0.0f, 0.0f, 0.0f }, { half, half, half });
+        }
+    }
+
+    constexpr float DEFAULT_HALF_SIZE_NO_MODEL = 1.0f;
+    constexpr float DEFAULT_HALF_SIZE_NO_POINTS = 0.5f;
+
+    // モデルの全メッシュの頂点を1つのリストに集約
+    std::vector<XMFLOAT3> CollectPoints(const std::vector<MeshData>& meshes)
+    {
+        std::vector<XMFLOAT3> points;
+        for (const auto& mesh : meshes)
+        {
+            points.reserve(points.size() + mesh.vertices.size());
+            for (const auto& v : mesh.vertices)
+            {
+                points.push_back(v.position);
+            }
+        }
+        return points;
+    }
+}
+
+//======================================
+// 公開関数
 //======================================
 Collider ColliderGenerator::GenerateBestFit(const MODEL* pModel, ColliderType colliderType)
 {
-    Collider col;
-    col.type = colliderType;
+    // モデルが無効ならデフォルト値を返却
+    if (!pModel || pModel->Meshes.empty())
+    {
+        return MakeDefault(colliderType, DEFAULT_HALF_SIZE_NO_MODEL);
+    }
 
-    // fȂftHglԋp
+    const std::vector<XMFLOAT3> points = CollectPoints(pModel->Meshes);
+    return FitPoints(points.data(), points.size(), colliderType);
+}
+
+Collider ColliderGenerator::GenerateTightestFit(const MODEL* pModel, uint32_t shapes)
+{
     if (!pModel || pModel->Meshes.empty())
     {
-        col.obb.center = XMFLOAT3(0, 0, 0);
-        col.obb.extents = XMFLOAT3(1, 1, 1);
-        XMStoreFloat4(&col.obb.orientation, XMQuaternionIdentity());
-        return col;
+        return MakeDefault(ColliderType::Box, DEFAULT_HALF_SIZE_NO_MODEL);
+    }
+    return GenerateTightestFit(pModel->Meshes, shapes);
+}
+
+Collider ColliderGenerator::GenerateTightestFit(const std::vector<MeshData>& meshes, uint32_t shapes)
+{
+    const std::vector<XMFLOAT3> points = CollectPoints(meshes);
+    return FitTightest(points.data(), points.size(), shapes);
+}
+
+Collider ColliderGenerator::FitPoints(const XMFLOAT3* points, size_t count, ColliderType colliderType)
+{
+    if (!points || count == 0)
+    {
+        return MakeDefault(colliderType, DEFAULT_HALF_SIZE_NO_POINTS);
+    }
+
+    switch (colliderType)
+    {
+    case ColliderType::Sphere:
+    {
+        const Sphere sphere = FitSphere(points, count);
+        return Collider::CreateSphere(sphere.center, sphere.radius);
     }
+    case ColliderType::Capsule:
+    {
+        const Capsule capsule = FitCapsule(points, count);
+        return Collider::CreateCapsule(capsule.start, capsule.end, capsule.radius);
+    }
+    default:
+    {
+        const OBB obb = FitOBB(points, count);
+        return Collider::CreateOBB(obb.center, obb.extents, obb.orientation);
+    }
+    }
+}
 
-    // ---------------------------------------------------
-    // 1. S_̒o
-    // ---------------------------------------------------
-    std::vector<XMFLOAT3> points;
+Collider ColliderGenerator::FitTightest(const XMFLOAT3* points, size_t count, uint32_t shapes)
+{
+    if (!points || count == 0)
+    {
+        return MakeDefault(ColliderType::Box, DEFAULT_HALF_SIZE_NO_POINTS);
+    }
 
-    // SbV̒_1̃XgɏW
-    for (const auto& mesh : pModel->Meshes)
+    const PointStream stream = MakeStream(points, count);
+    const OBB obb = FrameToOBB(FitFrame(stream));
+
+    // OBB は候補に無くてもカプセルの芯に使うため常に求める
+    Collider best = Collider::CreateOBB(obb.center, obb.extents, obb.orientation);
+    float bestVolume = (shapes & ColliderFitShape::Box) ? GetVolume(best) : FLT_MAX;
+
+    if (shapes & ColliderFitShape::Sphere)
     {
-        points.reserve(points.size() + mesh.vertices.size());
-        for (const auto& v : mesh.vertices)
+        const Sphere sphere = FitSphere(points, count);
+        const Collider candidate = Collider::CreateSphere(sphere.center, sphere.radius);
+        if (GetVolume(candidate) < bestVolume)
         {
-            points.push_back(v.position);
+            bestVolume = GetVolume(candidate);
+            best = candidate;
         }
     }
+    if (shapes & ColliderFitShape::Capsule)
+    {
+        const Capsule capsule = FitCapsuleStream(stream, obb);
+        const Collider candidate = Collider::CreateCapsule(capsule.start, capsule.end, capsule.radius);
+        if (GetVolume(candidate) < bestVolume)
+        {
+            bestVolume = GetVolume(candidate);
+            best = candidate;
+        }
+    }
+    return best;
+}
 
-    if (points.empty())
+Sphere ColliderGenerator::FitSphere(const XMFLOAT3* points, size_t count)
+{
+    if (!points || count == 0)
     {
-        col.obb.center = XMFLOAT3(0, 0, 0);
-        col.obb.extents = XMFLOAT3(0.5f, 0.5f, 0.5f);
-        XMStoreFloat4(&col.obb.orientation, XMQuaternionIdentity());
-        return col;
+        return { { 0.0f, 0.0f, 0.0f }, 0.0f };
     }
 
-    // ---------------------------------------------------
-    // 2. œKOBB̌vZ (DirectXCollisionp)
-    // ---------------------------------------------------
-    BoundingOrientedBox dxObb;
+    // 入力順の偏り（走査順に外側へ広がるメッシュ）で最悪計算量にならないよう並べ替える
+    std::vector<XMFLOAT3> shuffled(points, points + count);
+    std::mt19937 rng(SPHERE_SHUFFLE_SEED);
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
 
-    // CreateFromPoints͓ŋUsp
-    // _QɃtBbgpƃTCYvZĂ
-    BoundingOrientedBox::CreateFromPoints(dxObb, points.size(), points.data(), sizeof(XMFLOAT3));
+    PointStream stream = MakeStream(shuffled.data(), count);
+    return FitSphereStream(stream);
+}
 
-    // ---------------------------------------------------
-    // 3. ʂ̊i[
-    // ---------------------------------------------------
-    col.obb.center = dxObb.Center;
-    col.obb.extents = dxObb.Extents;
-    col.obb.orientation = dxObb.Orientation;
+OBB ColliderGenerator::FitOBB(const XMFLOAT3* points, size_t count)
+{
+    if (!points || count == 0)
+    {
+        return MakeDefault(ColliderType::Box, DEFAULT_HALF_SIZE_NO_POINTS).obb;
+    }
+    return FrameToOBB(FitFrame(MakeStream(points, count)));
+}
+
+Capsule ColliderGenerator::FitCapsule(const XMFLOAT3* points, size_t count)
+{
+    if (!points || count == 0)
+    {
+        return MakeDefault(ColliderType::Capsule, DEFAULT_HALF_SIZE_NO_POINTS).capsule;
+    }
+    const PointStream stream = MakeStream(points, count);
+    return FitCapsuleStream(stream, FrameToOBB(FitFrame(stream)));
+}
 
-    return col;
-}
\ No newline at end of file
+float ColliderGenerator::GetVolume(const Collider& collider)
+{
+    switch (collider.type)
+    {
+    case ColliderType::Sphere:
+        return SPHERE_VOLUME_CONSTANT * collider.sphere.radius * collider.sphere.radius * collider.sphere.radius;
+    case ColliderType::Box:
+        return 8.0f * collider.obb.extents.x * collider.obb.extents.y * collider.obb.extents.z;
+    case ColliderType::AABB:
+    {
+        const XMFLOAT3 size = collider.aabb.GetSize();
+        return size.x * size.y * size.z;
+    }
+    case ColliderType::Capsule:
+    {
+        const float r = collider.capsule.radius;
+        return XM_PI * r * r * collider.capsule.GetHeight() + SPHERE_VOLUME_CONSTANT * r * r * r;
+    }
+    default:
+        return 0.0f;
+    }
+}
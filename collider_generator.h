@@ -1,44 +1,109 @@
 /****************************************
  * @file collider_generator.h
- * @brief RC_[wp[
+ * @brief コライダー自動生成ヘルパー
  * @author Natsume Shidara
  * @date 2025/12/15
  * @update 2025/12/15
+ * @update 2026/10/18 - 形状別の専用フィッター（最小球・主成分OBB・主軸カプセル）と体積による自動選択
  ****************************************/
 
 #ifndef COLLIDER_GENERATOR_H
 #define COLLIDER_GENERATOR_H
 
+#include <DirectXMath.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 #include "model.h"
 #include "collider.h"
 
+//--------------------------------------
+// 自動選択の候補（ビットで指定）
+//--------------------------------------
+namespace ColliderFitShape
+{
+    constexpr uint32_t Sphere = 1u << 0;
+    constexpr uint32_t Box = 1u << 1;
+    constexpr uint32_t Capsule = 1u << 2;
+    constexpr uint32_t Dynamic = Sphere | Box;     // RigidBody が扱える形状
+    constexpr uint32_t All = Sphere | Box | Capsule;
+}
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace ColliderGeneratorConfig
+{
+    // OBB の向きの詰め：主軸まわりの粗い角度探索の分割数と、その後の二分割の回数
+    constexpr int OBB_COARSE_STEPS = 8;
+    constexpr int OBB_REFINE_STEPS = 8;
+    // 最小球の内外判定で丸めを吸収する相対許容（半径の2乗に対して）
+    constexpr float SPHERE_EPSILON = 1e-5f;
+    // 最小球の入力を並べ替える乱数のシード（結果を毎回同じにする）
+    constexpr unsigned int SPHERE_SHUFFLE_SEED = 7u;
+}
+
  //--------------------------------------
- // NX錾
+ // クラス宣言
  //--------------------------------------
  /****************************************
   * @class ColliderGenerator
-  * @brief f`󂩂œKȃRC_[𐶐ÓINX
+  * @brief モデル形状から最適なコライダーを生成する静的クラス
   *
-  * f̑S_W͂AłtBbg
-  * OBBiLE{bNXjZo܂B
+  * モデルの全頂点座標を解析し、指定された形状で点群を包む最小に近い
+  * コライダーを算出します。点列版の関数は共有状態を持たないため、
+  * ワーカースレッドから同時に呼び出せます。
   ****************************************/
 class ColliderGenerator
 {
 public:
     //======================================
-    // J֐
+    // 公開関数
     //======================================
     /**
-     * @brief fɍœKȃRC_[(OBB)𐶐
-     * @param pModel ͑Ώۂ̃ff[^
-     * @return ꂽRC_[\
+     * @brief モデルに最適なコライダーを生成
+     * @param pModel 解析対象のモデルデータ
+     * @param colliderType 生成する形状（Sphere / Box / Capsule、それ以外は Box として扱う）
+     * @return 生成されたコライダー構造体（type に対応する共用体メンバーのみ有効）
      */
     static Collider GenerateBestFit(const MODEL* pModel, ColliderType colliderType = ColliderType::Box);
 
+    /**
+     * @brief 候補の形状をすべて当てはめ、体積が最も小さいものを返す
+     * @param shapes ColliderFitShape の組み合わせ
+     */
+    static Collider GenerateTightestFit(const MODEL* pModel, uint32_t shapes = ColliderFitShape::Dynamic);
+    // GPU リソースを作る前のメッシュデータ版（切断ワーカーから呼ぶ）
+    static Collider GenerateTightestFit(const std::vector<MeshData>& meshes, uint32_t shapes = ColliderFitShape::Dynamic);
+
+    // --- 点列版 ---
+    static Collider FitPoints(const DirectX::XMFLOAT3* points, size_t count, ColliderType colliderType);
+    static Collider FitTightest(const DirectX::XMFLOAT3* points, size_t count, uint32_t shapes);
+
+    /**
+     * @brief 点群を包む最小球（move-to-front 版 Welzl 法、入力をシャッフルして期待線形時間）
+     */
+    static Sphere FitSphere(const DirectX::XMFLOAT3* points, size_t count);
+
+    /**
+     * @brief 主成分分析で向きを決め、各軸まわりの回転で体積を詰めた OBB
+     */
+    static OBB FitOBB(const DirectX::XMFLOAT3* points, size_t count);
+
+    /**
+     * @brief OBB の最も長い軸を芯にしたカプセル
+     */
+    static Capsule FitCapsule(const DirectX::XMFLOAT3* points, size_t count);
+
+    /**
+     * @brief コライダーの体積（球・OBB・AABB・カプセル以外は 0）
+     */
+    static float GetVolume(const Collider& collider);
+
 private:
-    // CX^X֎~
+    // インスタンス化禁止
     ColliderGenerator() = delete;
     ~ColliderGenerator() = delete;
 };
 
-#endif // COLLIDER_GENERATOR_H
\ No newline at end of file
+#endif // COLLIDER_GENERATOR_H
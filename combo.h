@@ -1,6 +1,6 @@
 /****************************************
  * @file combo.h
- * @brief R{ǗVXe
+ * @brief コンボ管理システム
  * @author Natsume Shidara
  * @date 2026/01/12
  ****************************************/
@@ -9,46 +9,46 @@
 #define COMBO_H
 
  /**
-  * @brief R{
+  * @brief コンボ初期化
   */
 void Combo_Initialize();
 
 /**
- * @brief R{I
+ * @brief コンボ終了処理
  */
 void Combo_Finalize();
 
 /**
- * @brief R{XV
- * @param elapsed_time f^^C
+ * @brief コンボ更新
+ * @param elapsed_time デルタタイム
  */
 void Combo_Update(double elapsed_time);
 
 /**
- * @brief R{`
+ * @brief コンボ描画
  */
 void Combo_Draw();
 
 /**
- * @brief R{ǉiGؒfɌĂԁj
- * @param count ǉR{iftHg1j
+ * @brief コンボ追加（敵切断時に呼ぶ）
+ * @param count 追加コンボ数（デフォルト1）
  */
 void Combo_Add(int count = 1);
 
 /**
- * @brief ݂̃R{擾
- * @return R{
+ * @brief 現在のコンボ数を取得
+ * @return コンボ数
  */
 int Combo_GetCount();
 
 /**
- * @brief R{Zbg
+ * @brief コンボリセット
  */
 void Combo_Reset();
 
 /**
- * @brief R{{[iXXRA擾
- * @return R{ɉ{[iXXRA
+ * @brief コンボボーナススコアを取得
+ * @return コンボに応じたボーナススコア
  */
 int Combo_GetBonusScore();
 
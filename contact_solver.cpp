@@ -0,0 +1,646 @@
+﻿/****************************************
+ * @file contact_solver.cpp
+ * @brief 永続接触マニフォールドと逐次インパルスソルバーの実装
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 面クリッピングで得た複数点をまとめて設定する SetContacts を追加
+ * @update 2026/10/18 - 剛体を共有しないマニフォールドを色分けし、色ごとに並列で解く
+ ****************************************/
+
+#include "contact_solver.h"
+#include "rigid_body.h"
+#include "physics_job_system.h"
+#include <cmath>
+#include <algorithm>
+#include <bit>
+
+using namespace DirectX;
+
+//======================================
+// 内部ヘルパー関数
+//======================================
+namespace
+{
+    XMVECTOR LocalToWorld(const XMFLOAT3& local, const RigidBody* body)
+    {
+        const XMFLOAT4 rot = body->GetRotation();
+        const XMFLOAT3 pos = body->GetPosition();
+        return XMVectorAdd(XMVector3Rotate(XMLoadFloat3(&local), XMLoadFloat4(&rot)), XMLoadFloat3(&pos));
+    }
+
+    XMFLOAT3 WorldToLocal(FXMVECTOR world, const RigidBody* body)
+    {
+        const XMFLOAT4 rot = body->GetRotation();
+        const XMFLOAT3 pos = body->GetPosition();
+        XMFLOAT3 local;
+        XMStoreFloat3(&local, XMVector3InverseRotate(XMVectorSubtract(world, XMLoadFloat3(&pos)), XMLoadFloat4(&rot)));
+        return local;
+    }
+
+    /**
+     * @brief 法線に直交する接線基底を決定的に生成
+     */
+    void ComputeTangentBasis(const XMFLOAT3& normal, XMFLOAT3& outTangent1, XMFLOAT3& outTangent2)
+    {
+        XMVECTOR n = XMLoadFloat3(&normal);
+        XMVECTOR t1 = (std::abs(normal.x) >= 0.57735f)
+            ? XMVectorSet(normal.y, -normal.x, 0.0f, 0.0f)
+            : XMVectorSet(0.0f, normal.z, -normal.y, 0.0f);
+        t1 = XMVector3Normalize(t1);
+        XMStoreFloat3(&outTangent1, t1);
+        XMStoreFloat3(&outTangent2, XMVector3Cross(n, t1));
+    }
+
+    /**
+     * @brief 中点の接触点と深さから、各剛体ローカルの接触点を作る
+     */
+    ContactPoint MakeContactPoint(FXMVECTOR contact, FXMVECTOR normal, float depth, const RigidBody* bodyA, const RigidBody* bodyB)
+    {
+        XMVECTOR halfDepth = XMVectorScale(normal, depth * 0.5f);
+
+        ContactPoint cp{};
+        cp.localPointA = WorldToLocal(XMVectorAdd(contact, halfDepth), bodyA);
+        cp.localPointB = WorldToLocal(XMVectorSubtract(contact, halfDepth), bodyB);
+        cp.depth = depth;
+        return cp;
+    }
+
+    /**
+     * @brief A側ローカル座標で最も近いキャッシュ点（マージ距離外なら -1）
+     */
+    int FindNearestPoint(const ContactPoint* points, int pointCount, const XMFLOAT3& localPointA)
+    {
+        const float mergeSq = ContactConfig::CONTACT_MERGE_DISTANCE * ContactConfig::CONTACT_MERGE_DISTANCE;
+        XMVECTOR target = XMLoadFloat3(&localPointA);
+        int nearest = -1;
+        float nearestSq = mergeSq;
+
+        for (int i = 0; i < pointCount; ++i)
+        {
+            float distSq = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(XMLoadFloat3(&points[i].localPointA), target)));
+            if (distSq < nearestSq)
+            {
+                nearestSq = distSq;
+                nearest = i;
+            }
+        }
+        return nearest;
+    }
+
+    /**
+     * @brief 4点が張る四角形の広さの指標（対角線の外積の最大値）
+     */
+    float QuadAreaMetric(FXMVECTOR p0, FXMVECTOR p1, FXMVECTOR p2, GXMVECTOR p3)
+    {
+        float a0 = XMVectorGetX(XMVector3LengthSq(XMVector3Cross(XMVectorSubtract(p0, p1), XMVectorSubtract(p2, p3))));
+        float a1 = XMVectorGetX(XMVector3LengthSq(XMVector3Cross(XMVectorSubtract(p0, p2), XMVectorSubtract(p1, p3))));
+        float a2 = XMVectorGetX(XMVector3LengthSq(XMVector3Cross(XMVectorSubtract(p0, p3), XMVectorSubtract(p1, p2))));
+        return std::max(a0, std::max(a1, a2));
+    }
+
+    float ComputeEffectiveMass(FXMVECTOR dir, FXMVECTOR rA, FXMVECTOR rB, float invMassA, float invMassB,
+                               const XMFLOAT3X3& invInertiaA, const XMFLOAT3X3& invInertiaB)
+    {
+        XMVECTOR rAxD = XMVector3Cross(rA, dir);
+        XMVECTOR rBxD = XMVector3Cross(rB, dir);
+        float rotA = XMVectorGetX(XMVector3Dot(XMVector3TransformNormal(rAxD, XMLoadFloat3x3(&invInertiaA)), rAxD));
+        float rotB = XMVectorGetX(XMVector3Dot(XMVector3TransformNormal(rBxD, XMLoadFloat3x3(&invInertiaB)), rBxD));
+        float k = invMassA + invMassB + rotA + rotB;
+        return (k > 0.0f) ? 1.0f / k : 0.0f;
+    }
+}
+
+//======================================
+// ContactManifold
+//======================================
+void ContactManifold::Refresh()
+{
+    XMVECTOR n = XMLoadFloat3(&normal);
+    const float breakingSq = ContactConfig::CONTACT_BREAKING_THRESHOLD * ContactConfig::CONTACT_BREAKING_THRESHOLD;
+
+    for (int i = pointCount - 1; i >= 0; --i)
+    {
+        ContactPoint& cp = points[i];
+        XMVECTOR d = XMVectorSubtract(LocalToWorld(cp.localPointA, bodyA), LocalToWorld(cp.localPointB, bodyB));
+
+        cp.depth = XMVectorGetX(XMVector3Dot(d, n));
+        float driftSq = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(d, XMVectorScale(n, cp.depth))));
+
+        // 法線方向に離れた点・接線方向にずれた点は破棄
+        if (cp.depth < -ContactConfig::CONTACT_BREAKING_THRESHOLD || driftSq > breakingSq)
+        {
+            points[i] = points[pointCount - 1];
+            --pointCount;
+        }
+    }
+}
+
+void ContactManifold::AddContact(const Hit& hit)
+{
+    XMVECTOR n = XMVector3Normalize(XMVectorNegate(XMLoadFloat3(&hit.normal)));
+
+    // 法線が大きく変わった場合はキャッシュを作り直す
+    if (pointCount > 0 && XMVectorGetX(XMVector3Dot(n, XMLoadFloat3(&normal))) < ContactConfig::NORMAL_COHERENCE)
+    {
+        pointCount = 0;
+    }
+    XMStoreFloat3(&normal, n);
+
+    // 接触点を中点とみなし、各剛体側の最深点を求める
+    ContactPoint cp = MakeContactPoint(XMLoadFloat3(&hit.contactPoint), n, hit.depth, bodyA, bodyB);
+    XMVECTOR newLocalA = XMLoadFloat3(&cp.localPointA);
+
+    // 近い既存点があれば蓄積インパルスを引き継いで置換
+    int nearest = FindNearestPoint(points, pointCount, cp.localPointA);
+    if (nearest >= 0)
+    {
+        cp.normalImpulse = points[nearest].normalImpulse;
+        cp.tangentImpulse[0] = points[nearest].tangentImpulse[0];
+        cp.tangentImpulse[1] = points[nearest].tangentImpulse[1];
+        points[nearest] = cp;
+        return;
+    }
+
+    if (pointCount < ContactConfig::MAX_MANIFOLD_POINTS)
+    {
+        points[pointCount++] = cp;
+        return;
+    }
+
+    // 満杯：新しい点より深い最深点は残し、面積が最大になるよう1点を置換
+    int deepest = -1;
+    float maxDepth = cp.depth;
+    for (int i = 0; i < pointCount; ++i)
+    {
+        if (points[i].depth > maxDepth)
+        {
+            maxDepth = points[i].depth;
+            deepest = i;
+        }
+    }
+
+    XMVECTOR p[ContactConfig::MAX_MANIFOLD_POINTS];
+    for (int i = 0; i < pointCount; ++i)
+    {
+        p[i] = XMLoadFloat3(&points[i].localPointA);
+    }
+
+    int replaceIndex = 0;
+    float bestArea = -1.0f;
+    for (int i = 0; i < pointCount; ++i)
+    {
+        if (i == deepest) continue;
+
+        XMVECTOR q[ContactConfig::MAX_MANIFOLD_POINTS] = { p[0], p[1], p[2], p[3] };
+        q[i] = newLocalA;
+        float area = QuadAreaMetric(q[0], q[1], q[2], q[3]);
+        if (area > bestArea)
+        {
+            bestArea = area;
+            replaceIndex = i;
+        }
+    }
+
+    points[replaceIndex] = cp;
+}
+
+void ContactManifold::SetContacts(const ContactSet& contacts)
+{
+    XMVECTOR n = XMVector3Normalize(XMVectorNegate(XMLoadFloat3(&contacts.normal)));
+
+    // 法線が大きく変わった場合は引き継がない
+    int oldCount = pointCount;
+    if (oldCount > 0 && XMVectorGetX(XMVector3Dot(n, XMLoadFloat3(&normal))) < ContactConfig::NORMAL_COHERENCE)
+    {
+        oldCount = 0;
+    }
+    XMStoreFloat3(&normal, n);
+
+    ContactPoint newPoints[ContactConfig::MAX_MANIFOLD_POINTS];
+    const int count = std::min(contacts.count, ContactConfig::MAX_MANIFOLD_POINTS);
+
+    for (int i = 0; i < count; ++i)
+    {
+        ContactPoint& cp = newPoints[i];
+        cp = MakeContactPoint(XMLoadFloat3(&contacts.points[i]), n, contacts.depths[i], bodyA, bodyB);
+
+        int nearest = FindNearestPoint(points, oldCount, cp.localPointA);
+        if (nearest >= 0)
+        {
+            cp.normalImpulse = points[nearest].normalImpulse;
+            cp.tangentImpulse[0] = points[nearest].tangentImpulse[0];
+            cp.tangentImpulse[1] = points[nearest].tangentImpulse[1];
+        }
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        points[i] = newPoints[i];
+    }
+    pointCount = count;
+}
+
+//======================================
+// ContactSolver
+//======================================
+int ContactSolver::FindOrAddBody(RigidBody* body)
+{
+    auto it = m_BodyLookup.find(body);
+    if (it != m_BodyLookup.end())
+    {
+        return it->second;
+    }
+
+    const RigidBody::Params& params = body->GetParams();
+    const bool isStatic = params.isKinematic || params.mass <= RigidBody::MIN_MASS;
+
+    SolverBody solverBody;
+    solverBody.body = body;
+    solverBody.linearVelocity = body->GetVelocity();
+    solverBody.angularVelocity = body->GetAngularVelocity();
+    solverBody.invMass = isStatic ? 0.0f : 1.0f / params.mass;
+    if (isStatic)
+    {
+        XMStoreFloat3x3(&solverBody.invInertia, XMMatrixSet(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0));
+    }
+    else
+    {
+        solverBody.invInertia = body->GetInvInertiaTensorWorld();
+    }
+
+    int index = static_cast<int>(m_Bodies.size());
+    m_Bodies.push_back(solverBody);
+    m_BodyLookup.emplace(body, index);
+    return index;
+}
+
+void ContactSolver::Begin(std::vector<ContactManifold*>& manifolds, float dt)
+{
+    End();
+
+    m_Manifolds = manifolds;
+    m_BodyIndexA.reserve(m_Manifolds.size());
+    m_BodyIndexB.reserve(m_Manifolds.size());
+
+    for (ContactManifold* manifold : m_Manifolds)
+    {
+        m_BodyIndexA.push_back(FindOrAddBody(manifold->bodyA));
+        m_BodyIndexB.push_back(FindOrAddBody(manifold->bodyB));
+    }
+
+    BuildColors();
+
+    // 反発の判定は積分直後の速度で行うため、ウォームスタートで速度を書き換える前に全マニフォールドを準備する
+    ForEachManifold([this, dt](int i) {
+        PreStep(*m_Manifolds[i], m_Bodies[m_BodyIndexA[i]], m_Bodies[m_BodyIndexB[i]], dt);
+    });
+    ForEachManifold([this](int i) {
+        WarmStart(*m_Manifolds[i], m_Bodies[m_BodyIndexA[i]], m_Bodies[m_BodyIndexB[i]]);
+    });
+}
+
+void ContactSolver::BuildColors()
+{
+    const int manifoldCount = static_cast<int>(m_Manifolds.size());
+    m_BodyColorMask.assign(m_Bodies.size(), 0u);
+    m_ManifoldColor.resize(manifoldCount);
+
+    // 登録順に、両剛体がまだ使っていない最小の色を割り当てる（静的剛体は書き込まれないため制約にしない）
+    int colorSizes[ContactConfig::MAX_COLORS + 1] = {};
+    m_ColorCount = 0;
+
+    for (int i = 0; i < manifoldCount; ++i)
+    {
+        const int indexA = m_BodyIndexA[i];
+        const int indexB = m_BodyIndexB[i];
+        const bool isDynamicA = m_Bodies[indexA].invMass > 0.0f;
+        const bool isDynamicB = m_Bodies[indexB].invMass > 0.0f;
+
+        uint32_t usedMask = 0u;
+        if (isDynamicA) usedMask |= m_BodyColorMask[indexA];
+        if (isDynamicB) usedMask |= m_BodyColorMask[indexB];
+
+        // 全色使用済みなら countr_zero が MAX_COLORS を返し、溢れ分に入る
+        const int color = std::countr_zero(static_cast<uint32_t>(~usedMask));
+        if (color < ContactConfig::MAX_COLORS)
+        {
+            if (isDynamicA) m_BodyColorMask[indexA] |= 1u << color;
+            if (isDynamicB) m_BodyColorMask[indexB] |= 1u << color;
+            m_ColorCount = std::max(m_ColorCount, color + 1);
+        }
+
+        m_ManifoldColor[i] = static_cast<uint8_t>(color);
+        ++colorSizes[color];
+    }
+
+    // 色順に並べる（同じ色の中は登録順を維持して決定的にする）
+    m_ColorOffsets.assign(ContactConfig::MAX_COLORS + 2, 0);
+    for (int color = 0; color <= ContactConfig::MAX_COLORS; ++color)
+    {
+        m_ColorOffsets[color + 1] = m_ColorOffsets[color] + colorSizes[color];
+    }
+
+    m_ColorOrder.resize(manifoldCount);
+    int cursor[ContactConfig::MAX_COLORS + 1];
+    for (int color = 0; color <= ContactConfig::MAX_COLORS; ++color)
+    {
+        cursor[color] = m_ColorOffsets[color];
+    }
+    for (int i = 0; i < manifoldCount; ++i)
+    {
+        m_ColorOrder[cursor[m_ManifoldColor[i]]++] = i;
+    }
+}
+
+void ContactSolver::ForEachManifold(const std::function<void(int index)>& function) const
+{
+    const int manifoldCount = static_cast<int>(m_Manifolds.size());
+    if (!m_ParallelEnabled)
+    {
+        for (int i = 0; i < manifoldCount; ++i)
+        {
+            function(i);
+        }
+        return;
+    }
+
+    for (int color = 0; color <= ContactConfig::MAX_COLORS; ++color)
+    {
+        const int begin = m_ColorOffsets[color];
+        const int size = m_ColorOffsets[color + 1] - begin;
+        const bool isOverflow = (color == ContactConfig::MAX_COLORS);
+
+        if (!isOverflow && size >= ContactConfig::PARALLEL_MIN_COLOR_SIZE)
+        {
+            PhysicsJobSystem::ParallelFor(size, ContactConfig::PARALLEL_BATCH_SIZE,
+                [this, begin, &function](int batchBegin, int batchEnd, int) {
+                    for (int i = batchBegin; i < batchEnd; ++i)
+                    {
+                        function(m_ColorOrder[begin + i]);
+                    }
+                });
+        }
+        else
+        {
+            for (int i = 0; i < size; ++i)
+            {
+                function(m_ColorOrder[begin + i]);
+            }
+        }
+    }
+}
+
+void ContactSolver::PreStep(ContactManifold& manifold, const SolverBody& bodyA, const SolverBody& bodyB, float dt) const
+{
+    const RigidBody::Params& pA = manifold.bodyA->GetParams();
+    const RigidBody::Params& pB = manifold.bodyB->GetParams();
+    manifold.friction = std::sqrt(pA.friction * pB.friction);
+    manifold.restitution = std::min(pA.restitution, pB.restitution);
+
+    ComputeTangentBasis(manifold.normal, manifold.tangent[0], manifold.tangent[1]);
+
+    XMVECTOR n = XMLoadFloat3(&manifold.normal);
+    XMVECTOR t1 = XMLoadFloat3(&manifold.tangent[0]);
+    XMVECTOR t2 = XMLoadFloat3(&manifold.tangent[1]);
+    const XMFLOAT3 fPosA = manifold.bodyA->GetPosition();
+    const XMFLOAT3 fPosB = manifold.bodyB->GetPosition();
+    XMVECTOR posA = XMLoadFloat3(&fPosA);
+    XMVECTOR posB = XMLoadFloat3(&fPosB);
+    XMVECTOR vA = XMLoadFloat3(&bodyA.linearVelocity);
+    XMVECTOR wA = XMLoadFloat3(&bodyA.angularVelocity);
+    XMVECTOR vB = XMLoadFloat3(&bodyB.linearVelocity);
+    XMVECTOR wB = XMLoadFloat3(&bodyB.angularVelocity);
+
+    float maxDepth = 0.0f;
+    for (int i = 0; i < manifold.pointCount; ++i)
+    {
+        maxDepth = std::max(maxDepth, manifold.points[i].depth);
+    }
+    manifold.positionOnly = (maxDepth > ContactConfig::DEEP_PENETRATION_DEPTH);
+
+    for (int i = 0; i < manifold.pointCount; ++i)
+    {
+        ContactPoint& cp = manifold.points[i];
+
+        XMVECTOR contact = XMVectorScale(XMVectorAdd(LocalToWorld(cp.localPointA, manifold.bodyA), LocalToWorld(cp.localPointB, manifold.bodyB)), 0.5f);
+        XMVECTOR rA = XMVectorSubtract(contact, posA);
+        XMVECTOR rB = XMVectorSubtract(contact, posB);
+        XMStoreFloat3(&cp.rA, rA);
+        XMStoreFloat3(&cp.rB, rB);
+
+        cp.normalMass = ComputeEffectiveMass(n, rA, rB, bodyA.invMass, bodyB.invMass, bodyA.invInertia, bodyB.invInertia);
+        cp.tangentMass[0] = ComputeEffectiveMass(t1, rA, rB, bodyA.invMass, bodyB.invMass, bodyA.invInertia, bodyB.invInertia);
+        cp.tangentMass[1] = ComputeEffectiveMass(t2, rA, rB, bodyA.invMass, bodyB.invMass, bodyA.invInertia, bodyB.invInertia);
+
+        // 反発は十分な接近速度がある場合のみ。離れている点は隙間を詰める分だけ接近を許す
+        XMVECTOR dv = XMVectorSubtract(XMVectorAdd(vB, XMVector3Cross(wB, rB)), XMVectorAdd(vA, XMVector3Cross(wA, rA)));
+        float vn = XMVectorGetX(XMVector3Dot(dv, n));
+
+        cp.velocityBias = 0.0f;
+        if (vn < -ContactConfig::RESTITUTION_VELOCITY_THRESHOLD)
+        {
+            cp.velocityBias = -manifold.restitution * vn;
+        }
+        else if (cp.depth < 0.0f && dt > 0.0f)
+        {
+            cp.velocityBias = cp.depth / dt;
+        }
+
+        if (manifold.positionOnly)
+        {
+            cp.normalImpulse = 0.0f;
+            cp.tangentImpulse[0] = 0.0f;
+            cp.tangentImpulse[1] = 0.0f;
+        }
+        else
+        {
+            cp.normalImpulse *= ContactConfig::WARM_START_FACTOR;
+            cp.tangentImpulse[0] *= ContactConfig::WARM_START_FACTOR;
+            cp.tangentImpulse[1] *= ContactConfig::WARM_START_FACTOR;
+        }
+    }
+}
+
+void ContactSolver::WarmStart(const ContactManifold& manifold, SolverBody& bodyA, SolverBody& bodyB) const
+{
+    if (manifold.positionOnly) return;
+
+    XMVECTOR n = XMLoadFloat3(&manifold.normal);
+    XMVECTOR t1 = XMLoadFloat3(&manifold.tangent[0]);
+    XMVECTOR t2 = XMLoadFloat3(&manifold.tangent[1]);
+    XMMATRIX invInertiaA = XMLoadFloat3x3(&bodyA.invInertia);
+    XMMATRIX invInertiaB = XMLoadFloat3x3(&bodyB.invInertia);
+
+    XMVECTOR vA = XMLoadFloat3(&bodyA.linearVelocity);
+    XMVECTOR wA = XMLoadFloat3(&bodyA.angularVelocity);
+    XMVECTOR vB = XMLoadFloat3(&bodyB.linearVelocity);
+    XMVECTOR wB = XMLoadFloat3(&bodyB.angularVelocity);
+
+    for (int i = 0; i < manifold.pointCount; ++i)
+    {
+        const ContactPoint& cp = manifold.points[i];
+        XMVECTOR P = XMVectorAdd(XMVectorScale(n, cp.normalImpulse),
+                     XMVectorAdd(XMVectorScale(t1, cp.tangentImpulse[0]), XMVectorScale(t2, cp.tangentImpulse[1])));
+
+        XMVECTOR rA = XMLoadFloat3(&cp.rA);
+        XMVECTOR rB = XMLoadFloat3(&cp.rB);
+        vA = XMVectorSubtract(vA, XMVectorScale(P, bodyA.invMass));
+        wA = XMVectorSubtract(wA, XMVector3TransformNormal(XMVector3Cross(rA, P), invInertiaA));
+        vB = XMVectorAdd(vB, XMVectorScale(P, bodyB.invMass));
+        wB = XMVectorAdd(wB, XMVector3TransformNormal(XMVector3Cross(rB, P), invInertiaB));
+    }
+
+    // 静的剛体は複数の色から参照されるため書き戻さない
+    if (bodyA.invMass > 0.0f)
+    {
+        XMStoreFloat3(&bodyA.linearVelocity, vA);
+        XMStoreFloat3(&bodyA.angularVelocity, wA);
+    }
+    if (bodyB.invMass > 0.0f)
+    {
+        XMStoreFloat3(&bodyB.linearVelocity, vB);
+        XMStoreFloat3(&bodyB.angularVelocity, wB);
+    }
+}
+
+void ContactSolver::SolveVelocities()
+{
+    ForEachManifold([this](int i) {
+        SolveManifold(*m_Manifolds[i], m_Bodies[m_BodyIndexA[i]], m_Bodies[m_BodyIndexB[i]]);
+    });
+}
+
+void ContactSolver::SolveManifold(ContactManifold& manifold, SolverBody& bodyA, SolverBody& bodyB) const
+{
+    if (manifold.positionOnly) return;
+
+    XMVECTOR n = XMLoadFloat3(&manifold.normal);
+    XMVECTOR tangents[2] = { XMLoadFloat3(&manifold.tangent[0]), XMLoadFloat3(&manifold.tangent[1]) };
+    XMMATRIX invInertiaA = XMLoadFloat3x3(&bodyA.invInertia);
+    XMMATRIX invInertiaB = XMLoadFloat3x3(&bodyB.invInertia);
+
+    XMVECTOR vA = XMLoadFloat3(&bodyA.linearVelocity);
+    XMVECTOR wA = XMLoadFloat3(&bodyA.angularVelocity);
+    XMVECTOR vB = XMLoadFloat3(&bodyB.linearVelocity);
+    XMVECTOR wB = XMLoadFloat3(&bodyB.angularVelocity);
+
+    auto applyImpulse = [&](FXMVECTOR P, FXMVECTOR rA, FXMVECTOR rB)
+    {
+        vA = XMVectorSubtract(vA, XMVectorScale(P, bodyA.invMass));
+        wA = XMVectorSubtract(wA, XMVector3TransformNormal(XMVector3Cross(rA, P), invInertiaA));
+        vB = XMVectorAdd(vB, XMVectorScale(P, bodyB.invMass));
+        wB = XMVectorAdd(wB, XMVector3TransformNormal(XMVector3Cross(rB, P), invInertiaB));
+    };
+
+    for (int i = 0; i < manifold.pointCount; ++i)
+    {
+        ContactPoint& cp = manifold.points[i];
+        XMVECTOR rA = XMLoadFloat3(&cp.rA);
+        XMVECTOR rB = XMLoadFloat3(&cp.rB);
+
+        // 摩擦：蓄積インパルスを摩擦円錐（の各軸成分）にクランプ
+        const float maxFriction = manifold.friction * cp.normalImpulse;
+        for (int k = 0; k < 2; ++k)
+        {
+            XMVECTOR dv = XMVectorSubtract(XMVectorAdd(vB, XMVector3Cross(wB, rB)), XMVectorAdd(vA, XMVector3Cross(wA, rA)));
+            float vt = XMVectorGetX(XMVector3Dot(dv, tangents[k]));
+            float lambda = -vt * cp.tangentMass[k];
+
+            float oldImpulse = cp.tangentImpulse[k];
+            cp.tangentImpulse[k] = std::clamp(oldImpulse + lambda, -maxFriction, maxFriction);
+            lambda = cp.tangentImpulse[k] - oldImpulse;
+
+            applyImpulse(XMVectorScale(tangents[k], lambda), rA, rB);
+        }
+
+        // 法線：蓄積インパルスを非負にクランプ
+        XMVECTOR dv = XMVectorSubtract(XMVectorAdd(vB, XMVector3Cross(wB, rB)), XMVectorAdd(vA, XMVector3Cross(wA, rA)));
+        float vn = XMVectorGetX(XMVector3Dot(dv, n));
+        float lambda = -cp.normalMass * (vn - cp.velocityBias);
+
+        float oldImpulse = cp.normalImpulse;
+        cp.normalImpulse = std::clamp(oldImpulse + lambda, 0.0f, RigidBody::MAX_IMPULSE);
+        lambda = cp.normalImpulse - oldImpulse;
+
+        applyImpulse(XMVectorScale(n, lambda), rA, rB);
+    }
+
+    if (bodyA.invMass > 0.0f)
+    {
+        XMStoreFloat3(&bodyA.linearVelocity, vA);
+        XMStoreFloat3(&bodyA.angularVelocity, wA);
+    }
+    if (bodyB.invMass > 0.0f)
+    {
+        XMStoreFloat3(&bodyB.linearVelocity, vB);
+        XMStoreFloat3(&bodyB.angularVelocity, wB);
+    }
+}
+
+void ContactSolver::StoreVelocities()
+{
+    for (const SolverBody& solverBody : m_Bodies)
+    {
+        if (solverBody.invMass <= 0.0f) continue;
+
+        solverBody.body->SetVelocity(solverBody.linearVelocity);
+        solverBody.body->SetAngularVelocity(solverBody.angularVelocity);
+    }
+}
+
+void ContactSolver::SolvePositions()
+{
+    for (int iter = 0; iter < ContactConfig::POSITION_ITERATIONS; ++iter)
+    {
+        ForEachManifold([this](int i) { SolvePosition(i); });
+    }
+}
+
+void ContactSolver::SolvePosition(int index)
+{
+    ContactManifold& manifold = *m_Manifolds[index];
+    const float invMassA = m_Bodies[m_BodyIndexA[index]].invMass;
+    const float invMassB = m_Bodies[m_BodyIndexB[index]].invMass;
+    const float totalInvMass = invMassA + invMassB;
+    if (totalInvMass <= 0.0f) return;
+
+    // 現在の姿勢での最大めり込み
+    XMVECTOR n = XMLoadFloat3(&manifold.normal);
+    float maxDepth = 0.0f;
+    for (int p = 0; p < manifold.pointCount; ++p)
+    {
+        const ContactPoint& cp = manifold.points[p];
+        XMVECTOR d = XMVectorSubtract(LocalToWorld(cp.localPointA, manifold.bodyA), LocalToWorld(cp.localPointB, manifold.bodyB));
+        maxDepth = std::max(maxDepth, XMVectorGetX(XMVector3Dot(d, n)));
+    }
+
+    float correctionDepth = maxDepth - RigidBody::CORRECTION_SLOP;
+    if (correctionDepth <= 0.0f) return;
+
+    XMVECTOR correction = XMVectorScale(n, correctionDepth / totalInvMass * RigidBody::CORRECTION_PERCENT);
+
+    if (invMassA > 0.0f)
+    {
+        XMFLOAT3 pos = manifold.bodyA->GetPosition();
+        XMStoreFloat3(&pos, XMVectorSubtract(XMLoadFloat3(&pos), XMVectorScale(correction, invMassA)));
+        manifold.bodyA->CorrectPosition(pos);
+    }
+    if (invMassB > 0.0f)
+    {
+        XMFLOAT3 pos = manifold.bodyB->GetPosition();
+        XMStoreFloat3(&pos, XMVectorAdd(XMLoadFloat3(&pos), XMVectorScale(correction, invMassB)));
+        manifold.bodyB->CorrectPosition(pos);
+    }
+}
+
+void ContactSolver::End()
+{
+    m_Manifolds.clear();
+    m_BodyIndexA.clear();
+    m_BodyIndexB.clear();
+    m_Bodies.clear();
+    m_BodyLookup.clear();
+    m_ColorOrder.clear();
+    m_ColorOffsets.clear();
+    m_ColorCount = 0;
+}
@@ -0,0 +1,189 @@
+﻿/****************************************
+ * @file contact_solver.h
+ * @brief 永続接触マニフォールドと逐次インパルスソルバー
+ * @detail 剛体ペアごとに最大4点の接触点を保持し、蓄積インパルスで次フレームをウォームスタートする
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 面クリッピングで得た複数点をまとめて設定する SetContacts を追加
+ * @update 2026/10/18 - 剛体を共有しないマニフォールドを色分けし、色ごとに並列で解く
+ ****************************************/
+
+#ifndef CONTACT_SOLVER_H
+#define CONTACT_SOLVER_H
+
+#include <DirectXMath.h>
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include "collision.h"
+
+class RigidBody;
+
+//======================================
+// 定数定義
+//======================================
+namespace ContactConfig
+{
+    constexpr int MAX_MANIFOLD_POINTS = 4;
+
+    // この距離以上離れた／ずれたキャッシュ点は破棄
+    constexpr float CONTACT_BREAKING_THRESHOLD = 0.02f;
+    // 既存点とみなして蓄積インパルスを引き継ぐ距離
+    constexpr float CONTACT_MERGE_DISTANCE = 0.04f;
+    // 法線がこれ以上変化したらマニフォールドを作り直す（cos）
+    constexpr float NORMAL_COHERENCE = 0.95f;
+
+    // 反発を適用する最小接近速度
+    constexpr float RESTITUTION_VELOCITY_THRESHOLD = 1.0f;
+    // 深くめり込んでいる場合は速度を解かず位置補正のみ
+    constexpr float DEEP_PENETRATION_DEPTH = 0.5f;
+    // 前フレームの蓄積インパルスの引き継ぎ率
+    constexpr float WARM_START_FACTOR = 0.9f;
+
+    constexpr int POSITION_ITERATIONS = 2;
+
+    // 色数の上限（使える色が無いマニフォールドは最後にまとめて直列で解く）
+    constexpr int MAX_COLORS = 32;
+    // この数未満の色は呼び出しスレッドだけで解く（ジョブ投入の方が高くつく）
+    constexpr int PARALLEL_MIN_COLOR_SIZE = 64;
+    // 並列時の1ジョブあたりのマニフォールド数
+    constexpr int PARALLEL_BATCH_SIZE = 16;
+}
+
+//--------------------------------------
+// 接触点（剛体ローカル座標でキャッシュ）
+//--------------------------------------
+struct ContactPoint
+{
+    DirectX::XMFLOAT3 localPointA;  // A側の接触点（Aのローカル座標）
+    DirectX::XMFLOAT3 localPointB;  // B側の接触点（Bのローカル座標）
+    float depth;                    // めり込み量（負なら離れている）
+
+    // 蓄積インパルス（ウォームスタート用）
+    float normalImpulse;
+    float tangentImpulse[2];
+
+    // ソルバー作業用
+    DirectX::XMFLOAT3 rA;
+    DirectX::XMFLOAT3 rB;
+    float normalMass;
+    float tangentMass[2];
+    float velocityBias;
+};
+
+//--------------------------------------
+// 接触マニフォールド（proxyA < proxyB のペア単位）
+//--------------------------------------
+struct ContactManifold
+{
+    int proxyA = -1;
+    int proxyB = -1;
+    RigidBody* bodyA = nullptr;
+    RigidBody* bodyB = nullptr;
+
+    DirectX::XMFLOAT3 normal{ 0.0f, 1.0f, 0.0f };   // A→B方向
+    DirectX::XMFLOAT3 tangent[2]{};
+    ContactPoint points[ContactConfig::MAX_MANIFOLD_POINTS]{};
+    int pointCount = 0;
+
+    float friction = 0.0f;
+    float restitution = 0.0f;
+    bool positionOnly = false;
+
+    /**
+     * @brief 現在の剛体姿勢からキャッシュ点の深さを再計算し、離れた点を破棄
+     */
+    void Refresh();
+
+    /**
+     * @brief 衝突判定結果を接触点として追加（近い既存点はインパルスを引き継いで置換）
+     * @param hit Collision_Detect(A, B) の結果（法線はB→A）
+     */
+    void AddContact(const Hit& hit);
+
+    /**
+     * @brief 面クリッピングで得た接触点で全点を置き換える（近い旧点のインパルスは引き継ぐ）
+     * @param contacts Collision_ClipOBBOBB(A, B) の結果（法線はB→A）
+     */
+    void SetContacts(const ContactSet& contacts);
+
+    void Clear() { pointCount = 0; }
+};
+
+//--------------------------------------
+// 逐次インパルスソルバー
+//--------------------------------------
+class ContactSolver
+{
+public:
+    ContactSolver() = default;
+    ~ContactSolver() = default;
+
+    /**
+     * @brief 解くマニフォールドを登録し、質量・バイアスの事前計算とウォームスタートを行う
+     */
+    void Begin(std::vector<ContactManifold*>& manifolds, float dt);
+
+    /**
+     * @brief 速度拘束を1反復分解く（摩擦→法線の順）
+     */
+    void SolveVelocities();
+
+    /**
+     * @brief 解いた速度を剛体へ書き戻す
+     */
+    void StoreVelocities();
+
+    /**
+     * @brief キャッシュ点から現在のめり込みを求めて位置補正
+     */
+    void SolvePositions();
+
+    void End();
+
+    /**
+     * @brief 色分けによる並列化の有効／無効（無効時は登録順に直列で解く）
+     * @detail 同じ色の中では剛体を共有しないため、結果はスレッド数や実行順に依存しない
+     */
+    void SetParallelEnabled(bool enabled) { m_ParallelEnabled = enabled; }
+    bool IsParallelEnabled() const { return m_ParallelEnabled; }
+
+    // 直近の Begin で使った色数（溢れ分を除く）
+    int GetColorCount() const { return m_ColorCount; }
+
+private:
+    struct SolverBody
+    {
+        RigidBody* body;
+        DirectX::XMFLOAT3 linearVelocity;
+        DirectX::XMFLOAT3 angularVelocity;
+        DirectX::XMFLOAT3X3 invInertia;
+        float invMass;
+    };
+
+    int FindOrAddBody(RigidBody* body);
+    void BuildColors();
+    // マニフォールド添字ごとに function を呼ぶ（並列時は色ごとにワーカーへ分配）
+    void ForEachManifold(const std::function<void(int index)>& function) const;
+    void SolvePosition(int index);
+    void PreStep(ContactManifold& manifold, const SolverBody& bodyA, const SolverBody& bodyB, float dt) const;
+    void WarmStart(const ContactManifold& manifold, SolverBody& bodyA, SolverBody& bodyB) const;
+    void SolveManifold(ContactManifold& manifold, SolverBody& bodyA, SolverBody& bodyB) const;
+
+    std::vector<ContactManifold*> m_Manifolds;
+    std::vector<int> m_BodyIndexA;
+    std::vector<int> m_BodyIndexB;
+    std::vector<SolverBody> m_Bodies;
+    std::unordered_map<const RigidBody*, int> m_BodyLookup;
+
+    // 色分け（色順に並べたマニフォールド添字と、色ごとの開始位置。最後の区間が溢れ分）
+    std::vector<int> m_ColorOrder;
+    std::vector<int> m_ColorOffsets;
+    std::vector<uint32_t> m_BodyColorMask;
+    std::vector<uint8_t> m_ManifoldColor;
+    int m_ColorCount = 0;
+    bool m_ParallelEnabled = true;
+};
+
+#endif // CONTACT_SOLVER_H
@@ -1,7 +1,7 @@
 /****************************************
  * @file    debug_renderer.cpp
- * @brief   fobO`̎
- * @detail  LINELISTg|WpȈՃv~eBu`
+ * @brief   デバッグ描画の実装
+ * @detail  LINELISTトポロジを用いた簡易プリミティブ描画
  ****************************************/
 
 #include "debug_renderer.h"
@@ -17,7 +17,7 @@ using namespace DirectX;
 namespace DebugRenderer
 {
     //--------------------------------------
-    // \̒`
+    // 内部構造体定義
     //--------------------------------------
     struct DebugVertex
     {
@@ -31,7 +31,7 @@ namespace DebugRenderer
     };
 
     //--------------------------------------
-    // \[X
+    // 内部リソース
     //--------------------------------------
     static ID3D11Buffer* g_pVertexBuffer = nullptr;
     static ID3D11Buffer* g_pConstantBuffer = nullptr;
@@ -42,7 +42,7 @@ namespace DebugRenderer
     static std::vector<DebugVertex> g_LineList;
 
     //======================================
-    // VF[_[R[h
+    // シェーダーコード
     //======================================
     static const char* g_ShaderCode = R"(
         cbuffer ConstantBuffer : register(b0) {
@@ -68,7 +68,7 @@ namespace DebugRenderer
     )";
 
     //======================================
-    // {֐Q
+    // 基本動作関数群
     //======================================
 
     void Initialize()
@@ -80,7 +80,7 @@ namespace DebugRenderer
         ID3DBlob* psBlob = nullptr;
         ID3DBlob* errorBlob = nullptr;
 
-        // _VF[_[̃RpCƍ쐬
+        // 頂点シェーダーのコンパイルと作成
         HRESULT hr = D3DCompile(g_ShaderCode, strlen(g_ShaderCode), nullptr, nullptr, nullptr, "VS", "vs_5_0", 0, 0, &vsBlob, &errorBlob);
         if (FAILED(hr)) {
             if (errorBlob) errorBlob->Release();
@@ -88,14 +88,14 @@ namespace DebugRenderer
         }
         dev->CreateVertexShader(vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(), nullptr, &g_pVertexShader);
 
-        // sNZVF[_[̃RpCƍ쐬
+        // ピクセルシェーダーのコンパイルと作成
         hr = D3DCompile(g_ShaderCode, strlen(g_ShaderCode), nullptr, nullptr, nullptr, "PS", "ps_5_0", 0, 0, &psBlob, nullptr);
         if (SUCCEEDED(hr)) {
             dev->CreatePixelShader(psBlob->GetBufferPointer(), psBlob->GetBufferSize(), nullptr, &g_pPixelShader);
             psBlob->Release();
         }
 
-        // ̓CAEg̍쐬
+        // 入力レイアウトの作成
         D3D11_INPUT_ELEMENT_DESC layout[] = {
             { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 0,  D3D11_INPUT_PER_VERTEX_DATA, 0 },
             { "COLOR",    0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
@@ -103,15 +103,15 @@ namespace DebugRenderer
         dev->CreateInputLayout(layout, 2, vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(), &g_pInputLayout);
         vsBlob->Release();
 
-        // _obt@̍쐬iIXVpj
+        // 頂点バッファの作成（動的更新用）
         D3D11_BUFFER_DESC bd = {};
         bd.Usage = D3D11_USAGE_DYNAMIC;
-        bd.ByteWidth = sizeof(DebugVertex) * 20000; // eʂ₵2_
+        bd.ByteWidth = sizeof(DebugVertex) * 20000; // 容量を少し増やして2万頂点
         bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
         bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
         dev->CreateBuffer(&bd, nullptr, &g_pVertexBuffer);
 
-        // 萔obt@̍쐬
+        // 定数バッファの作成
         bd.Usage = D3D11_USAGE_DEFAULT;
         bd.ByteWidth = sizeof(ConstantBuffer);
         bd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
@@ -129,7 +129,7 @@ namespace DebugRenderer
     }
 
     //======================================
-    // `o^֐Q
+    // 描画登録関数群
     //======================================
 
     void DrawLine(const XMFLOAT3& p1, const XMFLOAT3& p2, const XMFLOAT4& color)
@@ -147,7 +147,7 @@ namespace DebugRenderer
             { aabb.min.x, aabb.max.y, aabb.max.z }, { aabb.max.x, aabb.max.y, aabb.max.z }
         };
 
-        // 12{̐ō\
+        // 12本の線で構成
         DrawLine(p[0], p[1], color); DrawLine(p[1], p[5], color);
         DrawLine(p[5], p[4], color); DrawLine(p[4], p[0], color);
         DrawLine(p[2], p[3], color); DrawLine(p[3], p[7], color);
@@ -162,7 +162,7 @@ namespace DebugRenderer
         XMVECTOR e = XMLoadFloat3(&obb.extents);
         XMMATRIX matRot = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.orientation));
 
-        // xNgɔ͈͂Z
+        // 基底ベクトルに範囲を乗算
         XMVECTOR u0 = matRot.r[0] * XMVectorGetX(e);
         XMVECTOR u1 = matRot.r[1] * XMVectorGetY(e);
         XMVECTOR u2 = matRot.r[2] * XMVectorGetZ(e);
@@ -190,10 +190,10 @@ namespace DebugRenderer
         XMVECTOR c = XMLoadFloat3(&sphere.center);
         float r = sphere.radius;
 
-        // eɉ~`
+        // 各軸周りに円を描画
         for (int axis = 0; axis < 3; ++axis)
         {
-            // x C4701 ̂߁A_[vOŌvZ
+            // 警告 C4701 回避のため、初期頂点をループ外で計算
             XMVECTOR prevPos;
             {
                 XMVECTOR startOffset;
@@ -240,7 +240,7 @@ namespace DebugRenderer
     }
 
     //======================================
-    // `s
+    // 描画実行処理
     //======================================
 
     void Render(const XMFLOAT4X4& view, const XMFLOAT4X4& proj)
@@ -250,11 +250,11 @@ namespace DebugRenderer
         ID3D11DeviceContext* ctx = Direct3D_GetContext();
         if (!ctx) return;
 
-        // _obt@̍XV
+        // 頂点バッファの更新
         D3D11_MAPPED_SUBRESOURCE ms;
         size_t drawCount = g_LineList.size();
 
-        // obt@TCY߂hK[hiKvɉăobt@Đj
+        // バッファサイズ超過を防ぐガード（必要に応じてバッファ再生成を検討）
         if (drawCount > 20000) drawCount = 20000;
 
         if (SUCCEEDED(ctx->Map(g_pVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &ms)))
@@ -263,7 +263,7 @@ namespace DebugRenderer
             ctx->Unmap(g_pVertexBuffer, 0);
         }
 
-        // 萔obt@̍XV
+        // 定数バッファの更新
         XMMATRIX mView = XMLoadFloat4x4(&view);
         XMMATRIX mProj = XMLoadFloat4x4(&proj);
         XMMATRIX mWVP = mView * mProj;
@@ -272,7 +272,7 @@ namespace DebugRenderer
         XMStoreFloat4x4(&cb.wvp, XMMatrixTranspose(mWVP));
         ctx->UpdateSubresource(g_pConstantBuffer, 0, nullptr, &cb, 0, 0);
 
-        // pCvCݒ
+        // パイプライン設定
         ctx->IASetInputLayout(g_pInputLayout);
         ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
 
@@ -286,7 +286,7 @@ namespace DebugRenderer
 
         ctx->Draw(static_cast<UINT>(drawCount), 0);
 
-        // t[ɌăXgNA
+        // 次フレームに向けてリストをクリア
         g_LineList.clear();
     }
 }
\ No newline at end of file
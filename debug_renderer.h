@@ -1,6 +1,6 @@
 /****************************************
  * @file debug_renderer.h
- * @brief fobOpv~eBu`惂W[
+ * @brief デバッグ用プリミティブ描画モジュール
  * @author Natsume Shidara
  * @date 2025/12/19
  ****************************************/
@@ -9,66 +9,66 @@
 #define DEBUG_RENDERER_H
 
  //--------------------------------------
- // CN[hK[h^ˑwb_
+ // インクルードガード／依存ヘッダ
  //--------------------------------------
 #include <DirectXMath.h>
 #include <vector>
 #include "collision.h"
 
 //--------------------------------------
-// NXEOԐ錾
+// クラス・名前空間宣言
 //--------------------------------------
 namespace DebugRenderer
 {
     //======================================
-    // {֐Q
+    // 基本動作関数群
     //======================================
 
     /**
-     * @brief 
-     * @detail DirectX11\[Xiobt@AVF[_[j̐
+     * @brief 初期化処理
+     * @detail DirectX11リソース（バッファ、シェーダー）の生成
      */
     void Initialize();
 
     /**
-     * @brief I
-     * @detail mۂ\[X̉
+     * @brief 終了処理
+     * @detail 確保したリソースの解放
      */
     void Finalize();
 
     /**
-     * @brief `s
-     * @param view r[s
-     * @param proj vWFNVs
+     * @brief 描画実行
+     * @param view ビュー行列
+     * @param proj プロジェクション行列
      */
     void Render(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& proj);
 
     //======================================
-    // `o^֐Q
+    // 形状登録関数群
     //======================================
 
     /**
-     * @brief ̕`o^
+     * @brief 線分の描画登録
      */
     void DrawLine(const DirectX::XMFLOAT3& p1, const DirectX::XMFLOAT3& p2, const DirectX::XMFLOAT4& color);
 
     /**
-     * @brief AABB̕`o^
+     * @brief AABBの描画登録
      */
     void DrawAABB(const AABB& aabb, const DirectX::XMFLOAT4& color);
 
     /**
-     * @brief OBB̕`o^
+     * @brief OBBの描画登録
      */
     void DrawOBB(const OBB& obb, const DirectX::XMFLOAT4& color);
 
     /**
-     * @brief ̕`o^
+     * @brief 球の描画登録
      */
     void DrawSphere(const Sphere& sphere, const DirectX::XMFLOAT4& color);
 
     /**
-     * @brief Obh̕`o^
+     * @brief グリッドの描画登録
      */
     void DrawGrid(float size, int divisions, const DirectX::XMFLOAT4& color);
 }
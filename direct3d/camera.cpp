@@ -1,14 +1,14 @@
 /****************************************
  * @file camera.cpp
- * @brief fobOpJ䃂W[
+ * @brief デバッグ用カメラ制御モジュール
  * @detail
- * - FPSJIȈړE]
- * - _s / es񐶐
- * - fobOpJ\
+ * - FPSカメラ的な移動・回転操作
+ * - 視点行列 / 投影行列生成
+ * - デバッグ用カメラ情報表示
  * @author Natsume Shidara
- * @update 2025/12/19 (LXgΉ)
- * @update 2026/01/10 - BladefobO𕪗
- * @update 2026/01/13 - ReleaserhNbVC
+ * @update 2025/12/19 (キャスト明示化対応)
+ * @update 2026/01/10 - Bladeデバッグ情報を分離
+ * @update 2026/01/13 - Releaseビルドクラッシュ修正
  ****************************************/
 
 #include "camera.h"
@@ -29,62 +29,62 @@
 using namespace DirectX;
 
 //--------------------------------------
-// O[oϐQiJԁj
+// グローバル変数群（カメラ状態）
 //--------------------------------------
-static XMFLOAT3 g_CameraPosition = { 0.0f, 0.0f, 0.0f }; // JW
-static XMFLOAT3 g_CameraFront = { 0.0f, 0.0f, 1.0f };    // OxNg
-static XMFLOAT3 g_CameraUp = { 0.0f, 1.0f, 0.0f };       // xNg
-static XMFLOAT3 g_CameraRight = { 1.0f, 0.0f, 0.0f };    // ExNg
+static XMFLOAT3 g_CameraPosition = { 0.0f, 0.0f, 0.0f }; // カメラ座標
+static XMFLOAT3 g_CameraFront = { 0.0f, 0.0f, 1.0f };    // 前方向ベクトル
+static XMFLOAT3 g_CameraUp = { 0.0f, 1.0f, 0.0f };       // 上方向ベクトル
+static XMFLOAT3 g_CameraRight = { 1.0f, 0.0f, 0.0f };    // 右方向ベクトル
 
-// 萔`
-constexpr float CAMERA_MOVE_SPEED = 7.5f;                          // ړx[m/s]
-constexpr float CAMERA_ROTATION_SPEED = XMConvertToRadians(60.0f); // ]x[rad/s]
+// 定数定義
+constexpr float CAMERA_MOVE_SPEED = 7.5f;                          // 移動速度[m/s]
+constexpr float CAMERA_ROTATION_SPEED = XMConvertToRadians(60.0f); // 回転速度[rad/s]
 
-static XMFLOAT4X4 g_CameraViewMatrix;  // r[s
-static XMFLOAT4X4 g_PerspectiveMatrix; // es
+static XMFLOAT4X4 g_CameraViewMatrix;  // ビュー行列
+static XMFLOAT4X4 g_PerspectiveMatrix; // 投影行列
 
-static float g_Fov = XMConvertToRadians(60.0f); // piWAj
+static float g_Fov = XMConvertToRadians(60.0f); // 視野角（ラジアン）
 
 //--------------------------------------
-// VXe\[X
+// システムリソース
 //--------------------------------------
 #ifdef _DEBUG
-static std::unique_ptr<hal::DebugText> g_pDebugText = nullptr; // fobO`p
+static std::unique_ptr<hal::DebugText> g_pDebugText = nullptr; // デバッグ描画用
 #endif
 
-static ID3D11Buffer* g_pVSConstantBuffer1 = nullptr; // View Matrix p萔obt@
-static ID3D11Buffer* g_pVSConstantBuffer2 = nullptr; // Projection Matrix p萔obt@
+static ID3D11Buffer* g_pVSConstantBuffer1 = nullptr; // View Matrix 用定数バッファ
+static ID3D11Buffer* g_pVSConstantBuffer2 = nullptr; // Projection Matrix 用定数バッファ
 
-static bool g_Initialized = false; // tO
+static bool g_Initialized = false; // 初期化フラグ
 
 //======================================
-//  / I
+// 初期化 / 終了処理
 //======================================
 
 /**
- * @brief JiʒuEOEwj
- * @param position ʒu
- * @param front    OxNg
- * @param up       xNg
+ * @brief カメラ初期化（位置・前・上を指定）
+ * @param position 初期位置
+ * @param front    前方向ベクトル
+ * @param up       上方向ベクトル
  */
 void Camera_Initialize(const DirectX::XMFLOAT3& position, const DirectX::XMFLOAT3& front, const DirectX::XMFLOAT3& up)
 {
-    // {iʂ̏ݒĂяoj
+    // 基本初期化（共通の初期設定を呼び出し）
     Camera_Initialize();
 
-    // xNgǂݍ
+    // ベクトルを読み込み
     XMVECTOR _front = XMLoadFloat3(&front);
     XMVECTOR _up = XMLoadFloat3(&up);
 
-    // K
+    // 正規化
     _front = XMVector3Normalize(_front);
     _up = XMVector3Normalize(_up);
 
-    // ExNgvZ
+    // 右ベクトル計算
     XMVECTOR _right = XMVector3Cross(_up, _front);
     _right = XMVector3Normalize(_right);
 
-    // O[oɕۑ
+    // グローバルに保存
     XMStoreFloat3(&g_CameraFront, _front);
     XMStoreFloat3(&g_CameraUp, _up);
     XMStoreFloat3(&g_CameraRight, _right);
@@ -93,12 +93,12 @@ void Camera_Initialize(const DirectX::XMFLOAT3& position, const DirectX::XMFLOAT
 }
 
 /**
- * @brief J{ilj
- * @detail \[X̊mۂƊp[^̐ݒs
+ * @brief カメラ基本初期化（既定値）
+ * @detail リソースの確保と既定パラメータの設定を行う
  */
 void Camera_Initialize()
 {
-    // ɏς݂̏ꍇ̓XLbvidh~j
+    // 既に初期化済みの場合はスキップ（二重初期化防止）
     if (g_Initialized)
     {
         return;
@@ -110,7 +110,7 @@ void Camera_Initialize()
     g_CameraRight = { 1.0f, 0.0f, 0.0f };
     g_Fov = XMConvertToRadians(60.0f);
 
-    // s񏉊
+    // 行列初期化
     XMStoreFloat4x4(&g_CameraViewMatrix, XMMatrixIdentity());
     XMStoreFloat4x4(&g_PerspectiveMatrix, XMMatrixIdentity());
 
@@ -130,7 +130,7 @@ void Camera_Initialize()
     );
 #endif
 
-    // foCX擾
+    // デバイス取得
     ID3D11Device* pDevice = Direct3D_GetDevice();
     if (pDevice == nullptr)
     {
@@ -138,7 +138,7 @@ void Camera_Initialize()
         return;
     }
 
-    // 萔obt@쐬
+    // 定数バッファ作成
     D3D11_BUFFER_DESC bufferDesc = {};
     bufferDesc.ByteWidth = sizeof(XMFLOAT4X4);
     bufferDesc.Usage = D3D11_USAGE_DEFAULT;
@@ -150,7 +150,7 @@ void Camera_Initialize()
 
     if (FAILED(hr1) || FAILED(hr2))
     {
-        // obt@쐬s̓N[Abv
+        // バッファ作成失敗時はクリーンアップ
         SAFE_RELEASE(g_pVSConstantBuffer1);
         SAFE_RELEASE(g_pVSConstantBuffer2);
         g_Initialized = false;
@@ -161,8 +161,8 @@ void Camera_Initialize()
 }
 
 /**
- * @brief JI
- * @detail fobOeLXgƒ萔obt@
+ * @brief カメラ終了処理
+ * @detail デバッグテキストと定数バッファを解放
  */
 void Camera_Finalize()
 {
@@ -177,27 +177,27 @@ void Camera_Finalize()
 }
 
 //======================================
-// JXV
+// カメラ更新処理
 //======================================
 
 /**
- * @brief JXV
- * @param elapsed_time Ot[̌oߎԁibj
- * @detail L[͂ɂړE]Aэs̍ČvZs
+ * @brief カメラ更新処理
+ * @param elapsed_time 前フレームからの経過時間（秒）
+ * @detail キー入力による移動・回転、および行列の再計算を行う
  */
 void Camera_Update(double elapsed_time)
 {
-    // doublefloat֖IɃLXg
+    // doubleからfloatへ明示的にキャスト
     const float dt = static_cast<float>(elapsed_time);
 
-    // ݂̃xNgǂݍ
+    // 現在のベクトル読み込み
     XMVECTOR cameraPosition = XMLoadFloat3(&g_CameraPosition);
     XMVECTOR cameraFront = XMLoadFloat3(&g_CameraFront);
     XMVECTOR cameraUp = XMLoadFloat3(&g_CameraUp);
     XMVECTOR cameraRight = XMLoadFloat3(&g_CameraRight);
 
     //--------------------------------------
-    // ړiWASD + ㉺j
+    // 移動処理（WASD + 上下）
     //--------------------------------------
     if (KeyLogger_IsPressed(KK_W))
     {
@@ -227,7 +227,7 @@ void Camera_Update(double elapsed_time)
     }
 
     //--------------------------------------
-    // FOV
+    // FOV調整
     //--------------------------------------
     if (KeyLogger_IsPressed(KK_Z))
     {
@@ -239,9 +239,9 @@ void Camera_Update(double elapsed_time)
     }
 
     //--------------------------------------
-    // ]iL[j
+    // 回転処理（矢印キー）
     //--------------------------------------
-    // ㉺: sb`
+    // 上下: ピッチ
     if (KeyLogger_IsPressed(KK_DOWN))
     {
         XMMATRIX rotation = XMMatrixRotationAxis(cameraRight, CAMERA_ROTATION_SPEED * dt);
@@ -255,7 +255,7 @@ void Camera_Update(double elapsed_time)
         cameraUp = XMVector3Normalize(XMVector3Cross(cameraFront, cameraRight));
     }
 
-    // E: [
+    // 左右: ヨー
     if (KeyLogger_IsPressed(KK_LEFT))
     {
         XMMATRIX rotation = XMMatrixRotationY(-CAMERA_ROTATION_SPEED * dt);
@@ -271,21 +271,21 @@ void Camera_Update(double elapsed_time)
         cameraRight = XMVector3Normalize(XMVector3Cross(cameraUp, cameraFront));
     }
 
-    // XVxNgi[
+    // 更新したベクトルを格納
     XMStoreFloat3(&g_CameraPosition, cameraPosition);
     XMStoreFloat3(&g_CameraFront, cameraFront);
     XMStoreFloat3(&g_CameraUp, cameraUp);
     XMStoreFloat3(&g_CameraRight, cameraRight);
 
     //--------------------------------------
-    // r[sXV
+    // ビュー行列更新
     //--------------------------------------
     XMMATRIX mtxView = XMMatrixLookAtLH(cameraPosition, cameraPosition + cameraFront, cameraUp);
     XMStoreFloat4x4(&g_CameraViewMatrix, mtxView);
 
 
     //--------------------------------------
-    // esXV
+    // 投影行列更新
     //--------------------------------------
     float width = static_cast<float>(Direct3D_GetBackBufferWidth());
     float height = static_cast<float>(Direct3D_GetBackBufferHeight());
@@ -299,7 +299,7 @@ void Camera_Update(double elapsed_time)
 }
 
 //======================================
-// Qb^[֐Q
+// ゲッター関数群
 //======================================
 const XMFLOAT4X4& Camera_GetViewMatrix() { return g_CameraViewMatrix; }
 const XMFLOAT4X4& Camera_GetPerspectiveMatrix() { return g_PerspectiveMatrix; }
@@ -310,12 +310,12 @@ const float& Camera_GetFov() { return g_Fov; }
 const XMFLOAT3& Camera_GetPosition() { return g_CameraPosition; }
 
 //======================================
-// fobO`
+// デバッグ描画
 //======================================
 
 /**
- * @brief JfobO`
- * @detail JʒuExNgEFOVeLXgƂĉʂɏd\
+ * @brief カメラ情報デバッグ描画
+ * @detail カメラ位置・方向ベクトル・FOVをテキストとして画面に重畳表示する
  */
 void Camera_DebugDraw()
 {
@@ -337,18 +337,18 @@ void Camera_DebugDraw()
 }
 
 //======================================
-// sݒ֐
+// 行列設定関数
 //======================================
 
 /**
- * @brief r[sƓes萔obt@ɐݒ
- * @param view r[s
- * @param projection es
- * @detail s]uGPU̒萔obt@(Slot 1, 2)֓]
+ * @brief ビュー行列と投影行列を定数バッファに設定
+ * @param view ビュー行列
+ * @param projection 投影行列
+ * @detail 行列を転置してGPUの定数バッファ(Slot 1, 2)へ転送する
  */
 void Camera_SetMatrix(const XMMATRIX& view, const XMMATRIX& projection)
 {
-    // NULL`FbNFobt@쐬̏ꍇ͉Ȃ
+    // NULLチェック：バッファが未作成の場合は何もしない
     if (g_pVSConstantBuffer1 == nullptr || g_pVSConstantBuffer2 == nullptr)
     {
         return;
@@ -360,17 +360,17 @@ void Camera_SetMatrix(const XMMATRIX& view, const XMMATRIX& projection)
         return;
     }
 
-    // s]uiDirectX̍srow-majorGPUVF[_[͒ʏcolumn-major҂̂߁j
+    // 行列を転置（DirectXの行列はrow-majorだがGPUシェーダーは通常column-major期待のため）
     XMFLOAT4X4 viewTranspose, projectionTranspose;
 
     XMStoreFloat4x4(&viewTranspose, XMMatrixTranspose(view));
     XMStoreFloat4x4(&projectionTranspose, XMMatrixTranspose(projection));
 
-    // 萔obt@XV
+    // 定数バッファ更新
     pContext->UpdateSubresource(g_pVSConstantBuffer1, 0, nullptr, &viewTranspose, 0, 0);
     pContext->UpdateSubresource(g_pVSConstantBuffer2, 0, nullptr, &projectionTranspose, 0, 0);
 
-    // _VF[_[ɒ萔obt@ݒ
+    // 頂点シェーダーに定数バッファを設定
     pContext->VSSetConstantBuffers(1, 1, &g_pVSConstantBuffer1);
     pContext->VSSetConstantBuffers(2, 1, &g_pVSConstantBuffer2);
 }
\ No newline at end of file
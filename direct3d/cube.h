@@ -1,6 +1,6 @@
 /**
  * @file cube.h
- * @brief 3DL[u̕\
+ * @brief 3Dキューブの表示
  * @author Natsume Shidara
  * @date 2025/09/09
  */
@@ -19,7 +19,7 @@ void Cube_Draw(int texId, const DirectX::XMMATRIX& mtxWorld = DirectX::XMMatrixI
 
 AABB Cube_GetAABB(const DirectX::XMFLOAT3& position);
 
-// ep
+// 影生成用
 void Cube_DrawShadow(const DirectX::XMMATRIX& mtxWorld);
 
 #endif // CUBE_H
\ No newline at end of file
@@ -1,6 +1,6 @@
 /****************************************
  * @file direct3d.h
- * @brief Direct3D̏уfoCXǗ
+ * @brief Direct3Dの初期化およびデバイス管理
  * @author Natsume Shidara
  * @date 2025/06/06
  * @update 2025/12/10
@@ -14,53 +14,53 @@
 #include <DirectXMath.h>
 
  //--------------------------------------
- // }N`
+ // マクロ定義
  //--------------------------------------
- // Z[t[X}N
+ // セーフリリースマクロ
 #ifndef SAFE_RELEASE
 #define SAFE_RELEASE(p) { if(p){ (p)->Release(); (p)=NULL; } }
 #endif
 
 //======================================
-// ֐vg^Cv錾
+// 関数プロトタイプ宣言
 //======================================
 
 //--------------------------------------
-// {EI
+// 基本初期化・終了処理
 //--------------------------------------
 /**
- * @brief Direct3D̏
- * @param hWnd EBhEnh
- * @return  true
+ * @brief Direct3Dの初期化
+ * @param hWnd ウィンドウハンドル
+ * @return 成功時 true
  */
 bool Direct3D_Initialize(HWND hWnd);
 
 /**
- * @brief Direct3D̏I
+ * @brief Direct3Dの終了処理
  */
 void Direct3D_Finalize();
 
 //--------------------------------------
-// `揈
+// 描画処理
 //--------------------------------------
 /**
- * @brief obNobt@̃NA
+ * @brief バックバッファのクリア
  */
 void Direct3D_Clear();
 
 /**
- * @brief obNobt@̕\itbvj
+ * @brief バックバッファの表示（フリップ）
  */
 void Direct3D_Present();
 
 /**
- * @brief `obNobt@iʁjɖ߂
- * @detail RenderTargetNXŃItXN[`sɎgp
+ * @brief 描画先をバックバッファ（画面）に戻す
+ * @detail RenderTargetクラス等でオフスクリーン描画を行った後に使用する
  */
 void Direct3D_SetBackBufferRenderTarget();
 
 //--------------------------------------
-// 擾
+// 情報取得
 //--------------------------------------
 unsigned int Direct3D_GetBackBufferWidth();
 unsigned int Direct3D_GetBackBufferHeight();
@@ -68,60 +68,60 @@ ID3D11Device* Direct3D_GetDevice();
 ID3D11DeviceContext* Direct3D_GetContext();
 
 //--------------------------------------
-// [xXeV
+// 深度ステンシル制御
 //--------------------------------------
 /**
- * @brief [xeXg̗L/؂ւ
- * @param isEnable true:L(ʏ) / false:(2D`擙)
+ * @brief 深度テストの有効/無効切り替え
+ * @param isEnable true:有効(通常) / false:無効(2D描画等)
  */
 void Direct3D_DepthStencilStateDepthIsEnable(bool isEnable = true);
 
 /**
- * @brief [x݂̗L/؂ւ
- * @param isEnable true:ݗL / false:ݖ(`p)
+ * @brief 深度書き込みの有効/無効切り替え
+ * @param isEnable true:書き込み有効 / false:書き込み無効(半透明描画用)
  */
 void Direct3D_SetDepthWriteEnable(bool isEnable = true);
 
 //--------------------------------------
-// uh[h
+// ブレンドモード
 //--------------------------------------
 enum class BlendMode
 {
-    None,      // uhȂisj
-    Alpha,     // ʏiAt@uhj
-    Add,       // Z
-    Multiply   // Z
+    None,      // ブレンドなし（不透明）
+    Alpha,     // 通常（アルファブレンド）
+    Add,       // 加算合成
+    Multiply   // 乗算合成
 };
 
 /**
- * @brief uhXe[g̐ݒ
- * @param mode ݒ肵uh[h
+ * @brief ブレンドステートの設定
+ * @param mode 設定したいブレンドモード
  */
 void Direct3D_SetBlendState(BlendMode mode);
 
 //--------------------------------------
-// Wϊwp[
+// 座標変換ヘルパー
 //--------------------------------------
 /**
- * @brief r[|[gs̎擾
+ * @brief ビューポート行列の取得
  */
 DirectX::XMMATRIX Direct3D_MatrixViewPort();
 
 /**
- * @brief XN[W烏[hWւ̕ϊiCLXgpȂǁj
+ * @brief スクリーン座標からワールド座標への変換（レイキャスト用など）
  */
 DirectX::XMFLOAT3 Direct3D_ScreenToWorld(int x, int y, float depth,
                                          const DirectX::XMFLOAT4X4& view,
                                          const DirectX::XMFLOAT4X4& projection);
 
 /**
- * @brief [hWXN[Wւ̕ϊiUIǏ]Ȃǁj
+ * @brief ワールド座標からスクリーン座標への変換（UI追従など）
  */
 DirectX::XMFLOAT2 Direct3D_WorldToScreen(const DirectX::XMFLOAT3& position,
                                          const DirectX::XMFLOAT4X4& view,
                                          const DirectX::XMFLOAT4X4& projection);
 
-// ===== X^CU[Xe[g =====
-void Direct3D_SetRasterizerState_Shadow(); // epioCAXj
-void Direct3D_SetRasterizerState_Default(); // ʏ`p
+// ===== ラスタライザーステート =====
+void Direct3D_SetRasterizerState_Shadow(); // 影生成用（バイアスあり）
+void Direct3D_SetRasterizerState_Default(); // 通常描画用
 #endif // DIRECT3D_H
\ No newline at end of file
@@ -1,6 +1,6 @@
 /**
  * @file grid.cpp
- * @brief XZʃObh̕\
+ * @brief XZ平面グリッドの表示
  * 
  * @author Natsume Shidara
  * @date 2025/09/11
@@ -33,30 +33,30 @@ static constexpr float GRID_HALF_EXTENT_Z = (GRID_V_COUNT * GRID_SIZE) * 0.5f;
 static constexpr Color::COLOR GRID_H_COLOR = Color::NEON_GREEN;
 static constexpr Color::COLOR GRID_V_COLOR = Color::RED;
 
-static ID3D11Buffer* g_pVertexBuffer = nullptr; // _obt@
+static ID3D11Buffer* g_pVertexBuffer = nullptr; // 頂点バッファ
 
-// ӁIŊOݒ肳́BReleasesvB
+// 注意！初期化で外部から設定されるもの。Release不要。
 static ID3D11Device* g_pDevice = nullptr;
 static ID3D11DeviceContext* g_pContext = nullptr;
 
 static int g_GridTexId = -1;
 static std::wstring TEXTURE_PATH = L"assets/white.png";
 
-// _\
+// 頂点構造体
 struct Vertex3d
 {
-    XMFLOAT3 position; // _W
-    XMFLOAT4 color; // F
+    XMFLOAT3 position; // 頂点座標
+    XMFLOAT4 color; // 色
 };
 
 static Vertex3d g_GridVertex[NUM_VERTEX]{};
 
 void Grid_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 {
-    // foCXƃfoCXReLXg̃`FbN
+    // デバイスとデバイスコンテキストのチェック
     if (!pDevice || !pContext)
     {
-        hal::dout << "Polygon_Initialize() : ^ꂽfoCXReLXgsł" << std::endl;
+        hal::dout << "Polygon_Initialize() : 与えられたデバイスかコンテキストが不正です" << std::endl;
         return;
     }
 
@@ -97,10 +97,10 @@ void Grid_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
         g_GridVertex[i * 2 + 1 + index_offset].color = GRID_V_COLOR;
     }
     
-    // _obt@
+    // 頂点バッファ生成
     D3D11_BUFFER_DESC bd = {};
-    // bd.Usage = D3D11_USAGE_DYNAMIC; // Ďg܂
-    bd.Usage = D3D11_USAGE_DEFAULT; // ϊs񂪂邽߁AȂĂł
+    // bd.Usage = D3D11_USAGE_DYNAMIC; // 書き換えて使えます
+    bd.Usage = D3D11_USAGE_DEFAULT; // 変換行列があるため、実質動かなくていいです
     bd.ByteWidth = sizeof(Vertex3d) * NUM_VERTEX;
     bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
     bd.CPUAccessFlags = 0;
@@ -123,20 +123,20 @@ void Grid_Draw()
     Shader3D_Begin();
     Direct3D_DepthStencilStateDepthIsEnable(true);
 
-    // _obt@`pCvCɐݒ
+    // 頂点バッファを描画パイプラインに設定
     UINT stride = sizeof(Vertex3d);
     UINT offset = 0;
     g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
 
-    // _VF[_[ɕϊsݒ
-    // [hWϊs
+    // 頂点シェーダーに変換行列を設定
+    // ワールド座標変換行列
     XMMATRIX mtxWorld = XMMatrixIdentity();
     Shader3D_SetWorldMatrix(mtxWorld);
 
-    // v~eBug|Wݒ
+    // プリミティブトポロジ設定
     g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
 
-    // |S`施ߔs
+    // ポリゴン描画命令発行
     // g_pContext->Draw(NUM_VERTEX, 0);
     Texture_SetTexture(g_GridTexId);
     g_pContext->Draw(NUM_VERTEX, 0);
@@ -1,6 +1,6 @@
 /**
  * @file grid.h
- * @brief XZʃObh̕\
+ * @brief XZ平面グリッドの表示
  * 
  * @author Natsume Shidara
  * @date 2025/09/11
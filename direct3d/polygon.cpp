@@ -6,12 +6,12 @@ using namespace DirectX;
 #include "shader.h"
 #include "debug_ostream.h"
 
-static constexpr int NUM_VERTEX = 4; // _
+static constexpr int NUM_VERTEX = 4; // 頂点数
 
-static ID3D11Buffer* g_pVertexBuffer = nullptr; // _obt@
-static ID3D11ShaderResourceView* g_pTexture = nullptr; // eNX`obt@
+static ID3D11Buffer* g_pVertexBuffer = nullptr; // 頂点バッファ
+static ID3D11ShaderResourceView* g_pTexture = nullptr; // テクスチャバッファ
 
-// ӁIŊOݒ肳́BReleasesvB
+// 注意！初期化で外部から設定されるもの。Release不要。
 static ID3D11Device* g_pDevice = nullptr;
 static ID3D11DeviceContext* g_pContext = nullptr;
 
@@ -21,31 +21,31 @@ static float g_Cx = 500.0f;
 static float g_Cy = 500.0f;
 
 
-// _\
+// 頂点構造体
 struct Vertex
 {
-    XMFLOAT3 position; // _W
-    XMFLOAT4 color; // F
-    XMFLOAT2 texcoord; // eNX`[
+    XMFLOAT3 position; // 頂点座標
+    XMFLOAT4 color; // 色
+    XMFLOAT2 texcoord; // テクスチャー
 };
 
 void Polygon_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 {
-    // foCXƃfoCXReLXg̃`FbN
+    // デバイスとデバイスコンテキストのチェック
     if (!pDevice || !pContext)
     {
-        hal::dout << "Polygon_Initialize() : ^ꂽfoCXReLXgsł" << std::endl;
+        hal::dout << "Polygon_Initialize() : 与えられたデバイスかコンテキストが不正です" << std::endl;
         return;
     }
 
-    // foCXƃfoCXReLXg̕ۑ
+    // デバイスとデバイスコンテキストの保存
     g_pDevice = pDevice;
     g_pContext = pContext;
 
-    // _̐Zo
+    // 点の数を算出
     g_NumVertex = static_cast<int>(g_Radius * 2.0f * XM_PI);
 
-    // _obt@
+    // 頂点バッファ生成
     D3D11_BUFFER_DESC bd = {};
     bd.Usage = D3D11_USAGE_DYNAMIC;
     bd.ByteWidth = sizeof(Vertex) * g_NumVertex;
@@ -63,17 +63,17 @@ void Polygon_Finalize(void)
 
 void Polygon_Draw(void)
 {
-    // VF[_[`pCvCɐݒ
+    // シェーダーを描画パイプラインに設定
     Shader_Begin();
 
-    // _obt@bN
+    // 頂点バッファをロックする
     D3D11_MAPPED_SUBRESOURCE msr;
     g_pContext->Map(g_pVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
 
-    // _obt@ւ̉z|C^擾
+    // 頂点バッファへの仮想ポインタを取得
     Vertex* v = (Vertex*)msr.pData;
 
-    // _
+    // 頂点情報を書き込み
     const float SCREEN_WIDTH = (float)Direct3D_GetBackBufferWidth();
     const float SCREEN_HEIGHT = (float)Direct3D_GetBackBufferHeight();
 
@@ -88,23 +88,23 @@ void Polygon_Draw(void)
         v[i].texcoord = {0.0f, 1.0f};
     }
 
-    // _obt@̃bN
+    // 頂点バッファのロックを解除
     g_pContext->Unmap(g_pVertexBuffer, 0);
 
-    // _obt@`pCvCɐݒ
+    // 頂点バッファを描画パイプラインに設定
     UINT stride = sizeof(Vertex);
     UINT offset = 0;
     g_pContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
 
-    // _VF[_[ɕϊsݒ
+    // 頂点シェーダーに変換行列を設定
     Shader_SetProjectionMatrix(XMMatrixOrthographicOffCenterLH(0.0f, SCREEN_WIDTH, SCREEN_HEIGHT, 0.0f, 0.0f, 1.0f));
     Shader_SetWorldMatrix(XMMatrixIdentity());
     
     // Shader_SetColor();
     
-    // v~eBug|Wݒ
+    // プリミティブトポロジ設定
     g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_POINTLIST);
     
-    // |S`施ߔs
+    // ポリゴン描画命令発行
     g_pContext->Draw(g_NumVertex, 0);
 }
@@ -1,6 +1,6 @@
 /**
  * @file sampler.cpp
- * @brief Tv[̐ݒ胆[eBeB[
+ * @brief サンプラーの設定ユーティリティー
  * @author Natsume Shidara
  * @date 2025/09/18
  */
@@ -19,10 +19,10 @@ void Sampler_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
     g_pDevice = pDevice;
     g_pContext = pContext;
 
-    // Tv[Xe[gݒ
+    // サンプラーステート設定
     D3D11_SAMPLER_DESC sampler_desc{};
 
-    // UVQƊO̎舵iUVAhbVO[hj
+    // UV参照外の取り扱い（UVアドレッシングモード）
     sampler_desc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
     sampler_desc.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
     sampler_desc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
@@ -32,7 +32,7 @@ void Sampler_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
     sampler_desc.MinLOD = 0;
     sampler_desc.MaxLOD = D3D11_FLOAT32_MAX;
 
-    // tB^O
+    // フィルタリング
     sampler_desc.Filter = D3D11_FILTER_MIN_LINEAR_MAG_MIP_POINT;
     g_pDevice->CreateSamplerState(&sampler_desc, &g_pSamplerStatePoint);
 
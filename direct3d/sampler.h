@@ -1,6 +1,6 @@
 /**
  * @file sampler.h
- * @brief Tv[̐ݒ胆[eBeB[
+ * @brief サンプラーの設定ユーティリティー
  * @author Natsume Shidara
  * @date 2025/09/18
  */
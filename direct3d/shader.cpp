@@ -1,6 +1,6 @@
 /**
  * @file shader.cpp
- * @brief VF[_[
+ * @brief シェーダー
  * @author Natsume Shidara
  * @date 2025/06/10
  */
@@ -19,97 +19,97 @@ static ID3D11VertexShader* g_pVertexShader = nullptr;
 static ID3D11InputLayout* g_pInputLayout = nullptr;
 static ID3D11PixelShader* g_pPixelShader = nullptr;
 
-// 萔obt@[
+// 定数バッファー
 static ID3D11Buffer* g_pVSConstantBuffer0 = nullptr; // Projection Matrix
 static ID3D11Buffer* g_pVSConstantBuffer1 = nullptr; // World Matrix
 
-// ӁIŊOݒ肳́BReleasesvB
+// 注意！初期化で外部から設定されるもの。Release不要。
 static ID3D11Device* g_pDevice = nullptr;
 static ID3D11DeviceContext* g_pContext = nullptr;
 
 
 bool Shader_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 {
-    HRESULT hr; // ߂li[p
+    HRESULT hr; // 戻り値格納用
 
-    // foCXƃfoCXReLXg̃`FbN
+    // デバイスとデバイスコンテキストのチェック
     if (!pDevice || !pContext)
     {
-        hal::dout << "Shader_Initialize() : ^ꂽfoCXReLXgsł" << std::endl;
+        hal::dout << "Shader_Initialize() : 与えられたデバイスかコンテキストが不正です" << std::endl;
         return false;
     }
 
-    // foCXƃfoCXReLXg̕ۑ
+    // デバイスとデバイスコンテキストの保存
     g_pDevice = pDevice;
     g_pContext = pContext;
 
 
-    // ORpCςݒ_VF[_[̓ǂݍ
+    // 事前コンパイル済み頂点シェーダーの読み込み
     std::ifstream ifs_vs("assets/shader/shader_vertex_2d.cso", std::ios::binary);
 
     if (!ifs_vs)
     {
-        MessageBox(nullptr, "_VF[_[̓ǂݍ݂Ɏs܂\n\nshader_vertex_2d.cso", "G[", MB_OK);
+        MessageBox(nullptr, "頂点シェーダーの読み込みに失敗しました\n\nshader_vertex_2d.cso", "エラー", MB_OK);
         return false;
     }
 
-    // t@CTCY擾
-    ifs_vs.seekg(0, std::ios::end); // t@C|C^𖖔Ɉړ
-    std::streamsize filesize = ifs_vs.tellg(); // t@C|C^̈ʒu擾i܂t@CTCYj
-    ifs_vs.seekg(0, std::ios::beg); // t@C|C^擪ɖ߂
+    // ファイルサイズを取得
+    ifs_vs.seekg(0, std::ios::end); // ファイルポインタを末尾に移動
+    std::streamsize filesize = ifs_vs.tellg(); // ファイルポインタの位置を取得（つまりファイルサイズ）
+    ifs_vs.seekg(0, std::ios::beg); // ファイルポインタを先頭に戻す
 
-    // oCif[^i[邽߂̃obt@m
+    // バイナリデータを格納するためのバッファを確保
     unsigned char* vsbinary_pointer = new unsigned char[filesize];
 
-    ifs_vs.read((char*)vsbinary_pointer, filesize); // oCif[^ǂݍ
-    ifs_vs.close(); // t@C
+    ifs_vs.read((char*)vsbinary_pointer, filesize); // バイナリデータを読み込む
+    ifs_vs.close(); // ファイルを閉じる
 
-    // _VF[_[̍쐬
+    // 頂点シェーダーの作成
     hr = g_pDevice->CreateVertexShader(vsbinary_pointer, filesize, nullptr, &g_pVertexShader);
 
     if (FAILED(hr))
     {
-        hal::dout << "Shader_Initialize() : _VF[_[̍쐬Ɏs܂" << std::endl;
-        delete[] vsbinary_pointer; // [NȂ悤ɃoCif[^̃obt@
+        hal::dout << "Shader_Initialize() : 頂点シェーダーの作成に失敗しました" << std::endl;
+        delete[] vsbinary_pointer; // メモリリークしないようにバイナリデータのバッファを解放
         return false;
     }
 
 
-    // _CAEg̒`
+    // 頂点レイアウトの定義
     D3D11_INPUT_ELEMENT_DESC layout[] = {
         {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
         {"COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
         {"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
     };
 
-    UINT num_elements = ARRAYSIZE(layout); // z̗vf擾
+    UINT num_elements = ARRAYSIZE(layout); // 配列の要素数を取得
 
-    // _CAEg̍쐬
+    // 頂点レイアウトの作成
     hr = g_pDevice->CreateInputLayout(layout, num_elements, vsbinary_pointer, filesize, &g_pInputLayout);
 
-    delete[] vsbinary_pointer; // oCif[^̃obt@
+    delete[] vsbinary_pointer; // バイナリデータのバッファを解放
 
     if (FAILED(hr))
     {
-        hal::dout << "Shader_Initialize() : _CAEg̍쐬Ɏs܂" << std::endl;
+        hal::dout << "Shader_Initialize() : 頂点レイアウトの作成に失敗しました" << std::endl;
         return false;
     }
 
 
-    // _VF[_[p萔obt@̍쐬
+    // 頂点シェーダー用定数バッファの作成
     D3D11_BUFFER_DESC buffer_desc{};
-    buffer_desc.ByteWidth = sizeof(XMFLOAT4X4); // obt@̃TCY
-    buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER; // oChtO
+    buffer_desc.ByteWidth = sizeof(XMFLOAT4X4); // バッファのサイズ
+    buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER; // バインドフラグ
 
     g_pDevice->CreateBuffer(&buffer_desc, nullptr, &g_pVSConstantBuffer0);
     g_pDevice->CreateBuffer(&buffer_desc, nullptr, &g_pVSConstantBuffer1);
 
 
-    // ORpCς݃sNZVF[_[̓ǂݍ
+    // 事前コンパイル済みピクセルシェーダーの読み込み
     std::ifstream ifs_ps("assets/shader/shader_pixel_2d.cso", std::ios::binary);
     if (!ifs_ps)
     {
-        MessageBox(nullptr, "sNZVF[_[̓ǂݍ݂Ɏs܂\n\nshader_pixel_2d.cso", "G[", MB_OK);
+        MessageBox(nullptr, "ピクセルシェーダーの読み込みに失敗しました\n\nshader_pixel_2d.cso", "エラー", MB_OK);
         return false;
     }
 
@@ -121,24 +121,24 @@ bool Shader_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
     ifs_ps.read((char*)psbinary_pointer, filesize);
     ifs_ps.close();
 
-    // sNZVF[_[̍쐬
+    // ピクセルシェーダーの作成
     hr = g_pDevice->CreatePixelShader(psbinary_pointer, filesize, nullptr, &g_pPixelShader);
 
-    delete[] psbinary_pointer; // oCif[^̃obt@
+    delete[] psbinary_pointer; // バイナリデータのバッファを解放
 
     if (FAILED(hr))
     {
-        hal::dout << "Shader_Initialize() : sNZVF[_[̍쐬Ɏs܂" << std::endl;
+        hal::dout << "Shader_Initialize() : ピクセルシェーダーの作成に失敗しました" << std::endl;
         return false;
     }
     
-    // Tv[Xe[gݒ
+    // サンプラーステート設定
     D3D11_SAMPLER_DESC sampler_desc{};
 
-    // tB^O
+    // フィルタリング
     sampler_desc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT;
 
-    // UVQƊO̎舵iUVAhbVO[hj
+    // UV参照外の取り扱い（UVアドレッシングモード）
     sampler_desc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
     sampler_desc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
     sampler_desc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
@@ -162,13 +162,13 @@ void Shader_Finalize()
 
 void Shader_SetProjectionMatrix(const DirectX::XMMATRIX& matrix)
 {
-    // 萔obt@i[ps̍\̂`
+    // 定数バッファ格納用行列の構造体を定義
     XMFLOAT4X4 transpose;
 
-    // s]uĒ萔obt@i[psɕϊ
+    // 行列を転置して定数バッファ格納用行列に変換
     XMStoreFloat4x4(&transpose, XMMatrixTranspose(matrix));
 
-    // 萔obt@ɍsZbg
+    // 定数バッファに行列をセット
     g_pContext->UpdateSubresource(g_pVSConstantBuffer0, 0, nullptr, &transpose, 0, 0);
 }
 
@@ -183,17 +183,17 @@ void Shader_SetWorldMatrix(const DirectX::XMMATRIX& matrix)
 
 void Shader_Begin()
 {
-    // _VF[_[ƃsNZVF[_[`pCvCɐݒ
+    // 頂点シェーダーとピクセルシェーダーを描画パイプラインに設定
     g_pContext->VSSetShader(g_pVertexShader, nullptr, 0);
     g_pContext->PSSetShader(g_pPixelShader, nullptr, 0);
 
-    // _CAEg`pCvCɐݒ
+    // 頂点レイアウトを描画パイプラインに設定
     g_pContext->IASetInputLayout(g_pInputLayout);
 
-    // 萔obt@`pCvCɐݒ
+    // 定数バッファを描画パイプラインに設定
     g_pContext->VSSetConstantBuffers(0, 1, &g_pVSConstantBuffer0);
     g_pContext->VSSetConstantBuffers(1, 1, &g_pVSConstantBuffer1);
 
-    // Tv[Xe[g`pCvCɐݒ
+    // サンプラーステートを描画パイプラインに設定
     Sampler_SetFilterPoint();
 }
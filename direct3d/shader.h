@@ -1,6 +1,6 @@
 /**
  * @file shader.h
- * @brief VF[_[
+ * @brief シェーダー
  * @author Natsume Shidara
  * @date 2025/06/10
  */
@@ -1,6 +1,6 @@
 /****************************************
  * @file shader3d.h
- * @brief VF[_[i3D`EShadowMapΉj
+ * @brief シェーダー（3D描画・ShadowMap対応）
  * @author Natsume Shidara
  * @date 2025/09/10
  * @update 2025/12/10
@@ -13,56 +13,56 @@
 #include <DirectXMath.h>
 
  //=============================================================================
- // EI
+ // 初期化・終了処理
  //=============================================================================
  /**
-  * @brief VF[_[\[X̏
-  * @detail _EsNZVF[_[̓ǂݍ݁A萔obt@̍쐬s
-  * @param pDevice Direct3DfoCX
-  * @param pContext Direct3DfoCXReLXg
-  * @return trueAsfalse
+  * @brief シェーダーリソースの初期化
+  * @detail 頂点・ピクセルシェーダーの読み込み、定数バッファの作成を行う
+  * @param pDevice Direct3Dデバイス
+  * @param pContext Direct3Dデバイスコンテキスト
+  * @return 成功時はtrue、失敗時はfalse
   */
 bool Shader3D_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
 
 /**
- * @brief VF[_[\[X̉
+ * @brief シェーダーリソースの解放
  */
 void Shader3D_Finalize();
 
 //=============================================================================
-// p[^ݒ֐Q
+// パラメータ設定関数群
 //=============================================================================
 /**
- * @brief [hs̐ݒ (Vertex Shader b0)
- * @param matrix [hs
+ * @brief ワールド行列の設定 (Vertex Shader b0)
+ * @param matrix ワールド行列
  */
 void Shader3D_SetWorldMatrix(const DirectX::XMMATRIX& matrix);
 
 /**
- * @brief Cgr[vWFNVs̐ݒ (Vertex Shader b3)
- * @detail VhE}bṽCg_sݒ肷
- * @param matrix Cgr[vWFNVs
+ * @brief ライトビュープロジェクション行列の設定 (Vertex Shader b3)
+ * @detail シャドウマップ生成時のライト視点行列を設定する
+ * @param matrix ライトビュープロジェクション行列
  */
 void Shader3D_SetLightViewProjection(const DirectX::XMFLOAT4X4& matrix);
 
 /**
- * @brief VhE}bveNX`̐ݒ (Pixel Shader Slot 1)
- * @param pShadowSRV [xobt@쐬ꂽSRV
+ * @brief シャドウマップテクスチャの設定 (Pixel Shader Slot 1)
+ * @param pShadowSRV 深度バッファから作成されたSRV
  */
 void Shader3D_SetShadowMap(ID3D11ShaderResourceView* pShadowSRV);
 
 /**
- * @brief }eAJ[̐ݒ (Pixel Shader b0)
- * @param color RGBAJ[
+ * @brief マテリアルカラーの設定 (Pixel Shader b0)
+ * @param color RGBAカラー
  */
 void Shader3D_SetColor(const DirectX::XMFLOAT4& color);
 
 //=============================================================================
-// `Jn
+// 描画開始
 //=============================================================================
 /**
- * @brief VF[_[̗L
- * @detail VF[_[ACAEgA萔obt@ATvReLXgɐݒ肷
+ * @brief シェーダーの有効化
+ * @detail シェーダー、レイアウト、定数バッファ、サンプラをコンテキストに設定する
  */
 void Shader3D_Begin();
 
@@ -1,6 +1,6 @@
 /**
  * @file sprite.h
- * @brief XvCg\
+ * @brief スプライト表示
  * @author Natsume Shidara
  * @date 2025/06/12
  * @update 2025/12/10
@@ -12,40 +12,40 @@
 #include <d3d11.h>
 #include <DirectXMath.h>
 
- // EI
+ // 初期化・終了
 void Sprite_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
 void Sprite_Finalize(void);
 
-// `Jn
+// 描画開始
 void Sprite_Begin();
 
 //-------------------------------------------------------------
-// ̕`֐ieNX`IDwj
+// 既存の描画関数（テクスチャID指定）
 //-------------------------------------------------------------
-// ʏ`
+// 通常描画
 void Sprite_Draw(int texid, float display_x, float display_y, float angle = 0.0f, const DirectX::XMFLOAT4& color = DirectX::XMFLOAT4(1, 1, 1, 1));
 
-// TCYw`
+// サイズ指定描画
 void Sprite_Draw(int texid, float display_x, float display_y, float display_w, float display_h, float angle = 0.0f, const DirectX::XMFLOAT4& color = DirectX::XMFLOAT4(1, 1, 1, 1));
 
-// ؂蔲`
+// 切り抜き描画
 void Sprite_Draw(int texid, float display_x, float display_y, float uvcut_x, float uvcut_y, float uvcut_w, float uvcut_h, float angle = 0.0f, const DirectX::XMFLOAT4& color = DirectX::XMFLOAT4(1, 1, 1, 1));
 
-// tXybN`
+// フルスペック描画
 void Sprite_Draw(int texid, float display_x, float display_y, float uvcut_x, float uvcut_y, float uvcut_w, float uvcut_h, float display_w, float display_h, float angle = 0.0f, const DirectX::XMFLOAT4& color = DirectX::XMFLOAT4(1, 1, 1, 1));
 
 //-------------------------------------------------------------
-//SRVڕ`֐iItXN[_OʂȂǂ̕`pj
+//SRV直接描画関数（オフスクリーンレンダリング結果などの描画用）
 //-------------------------------------------------------------
 /**
- * @brief VF[_[\[Xr[𒼐ڎw肵ĕ`
- * @param pSRV `悵eNX`̃\[Xr[
- * @param display_x XW
- * @param display_y YW
- * @param display_w `敝
- * @param display_h `捂
- * @param angle ]pxiWAj
- * @param color _J[
+ * @brief シェーダーリソースビューを直接指定して描画
+ * @param pSRV 描画したいテクスチャのリソースビュー
+ * @param display_x 画面X座標
+ * @param display_y 画面Y座標
+ * @param display_w 描画幅
+ * @param display_h 描画高さ
+ * @param angle 回転角度（ラジアン）
+ * @param color 頂点カラー
  */
 void Sprite_Draw(ID3D11ShaderResourceView* pSRV, float display_x, float display_y, float display_w, float display_h, float angle = 0.0f, const DirectX::XMFLOAT4& color = DirectX::XMFLOAT4(1, 1, 1, 1));
 
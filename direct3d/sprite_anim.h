@@ -1,37 +1,39 @@
 /**
  * @file sprite_anim.h
- * @brief XvCgAj[V`
+ * @brief スプライトアニメーション描画
  * @author Natsume Shidara
  * @date 2025/06/17
+ * @update 2026/10/18 - 再生プレイヤーを世代付きハンドルで参照（破棄済みのハンドルは停止扱い・描画なし）
  */
 
 #ifndef SPRITE_ANIM_H
 #define SPRITE_ANIM_H
 
 #include <DirectXMath.h>
+#include "slot_map.h"
 
 void SpriteAnim_Initialize();
 void SpriteAnim_Finalize(void);
 
 void SpriteAnim_Update(double elapsed_time);
-void SpriteAnim_Draw(int playid, float dx, float dy, float dw, float dh);
+void SpriteAnim_Draw(SlotHandle playId, float dx, float dy, float dw, float dh);
 
 
-void BillboardAnim_Draw(int playId, const DirectX::XMFLOAT3& position, const DirectX::XMFLOAT2& scale, const DirectX::XMFLOAT2& pivot = {0.0f,0.0f}); 
+void BillboardAnim_Draw(SlotHandle playId, const DirectX::XMFLOAT3& position, const DirectX::XMFLOAT2& scale, const DirectX::XMFLOAT2& pivot = {0.0f,0.0f}); 
 
 
 /**
  * 
- * @param textureId Ǘԍ
- * @param patternMax p^[̉摜
- * @param m_HPatternMax ij̃p^[ő吔
- * @param m_seconds_per_pattern ĐxAPt[鎞
- * @param patternSize p^[̃TCY
- * @param patternStartPosition ŏ̃p^[̍W
- * @param isLoop [v邩
+ * @param textureId 管理番号
+ * @param patternMax パターンの画像数
+ * @param m_HPatternMax 一列（横）のパターン最大数
+ * @param m_seconds_per_pattern 再生速度、１フレームかかる時間
+ * @param patternSize パターン一個のサイズ
+ * @param patternStartPosition 最初のパターンの左上座標
+ * @param isLoop ループするか
  * @return
  *
- * @pre KTexture_Load()̂
+ * @pre 必ずTexture_Load()のあと
  */
 int SpriteAnim_RegisterPattern(
     int textureId,
@@ -43,8 +45,9 @@ int SpriteAnim_RegisterPattern(
     bool isLoop = true
 );
 
-int SpriteAnim_CreatePlayer(int anim_pattern_id);
-bool SpriteAnim_IsStopped(int index);
-void SpriteAnim_DestroyPlayer(int index);
+// 上限に達している場合は無効なハンドルを返す
+SlotHandle SpriteAnim_CreatePlayer(int anim_pattern_id);
+bool SpriteAnim_IsStopped(SlotHandle playId);
+void SpriteAnim_DestroyPlayer(SlotHandle playId);
 
 #endif
@@ -1,8 +1,9 @@
 /**
 * @file sprite_anim.cpp
- * @brief XvCgAj[V`
+ * @brief スプライトアニメーション描画
  * @author Natsume Shidara
  * @date 2025/06/17
+ * @update 2026/10/18 - 再生プレイヤーを SlotMap で管理（空き探索・全スロット走査をなくす）
  */
 #include "sprite_anim.h"
 #include "sprite.h"
@@ -16,41 +17,38 @@ using namespace DirectX;
 
 struct AnimPatternData
 {
-    int m_TextureId{1}; ///> eNX`ID @retval -1 o^ĂȂ 
-    int m_PatternMax{0}; // p^[
-    int m_HPatternMax{0}; // ij̃p^[ő吔
-    XMUINT2 m_StartPosition{0, 0}; // Aj[ṼX^[gW
-    XMUINT2 m_PatternSize{0, 0}; // 1p^[TCY
+    int m_TextureId{1}; ///> テクスチャID @retval -1 登録されていない 
+    int m_PatternMax{0}; // パターン数
+    int m_HPatternMax{0}; // 一列（横）のパターン最大数
+    XMUINT2 m_StartPosition{0, 0}; // アニメーションのスタート座標
+    XMUINT2 m_PatternSize{0, 0}; // 1パターンサイズ
     double m_seconds_per_pattern = 0.1;
-    bool m_IsLooped{false}; // [v邩
+    bool m_IsLooped{false}; // ループするか
 };
 
 struct AnimPlayData
 {
-    int m_PatternId{-1}; // Aj[Vp^[ID
-    int m_PatternNum{0}; // ݍĐ̃p^[ԍ
-    double m_accumulated_time{0}; // ݐώ
+    int m_PatternId{-1}; // アニメーションパターンID
+    int m_PatternNum{0}; // 現在再生中のパターン番号
+    double m_accumulated_time{0}; // 累積時間
     bool m_IsStopped = false;
 };
 
 static constexpr int ANIM_PATTERN_MAX = 128;
 static AnimPatternData g_AnimPattern[ANIM_PATTERN_MAX];
 static constexpr int ANIM_PLAY_MAX = 256;
-static AnimPlayData g_AnimPlay[ANIM_PLAY_MAX];
+static SlotMap<AnimPlayData> g_AnimPlay;
 
 void SpriteAnim_Initialize()
 {
-    // Aj[Vp^[ǗiׂėpĂȂj󋵂ɂ
+    // アニメーションパターン管理情報を初期化（すべて利用していない）状況にする
     for (AnimPatternData& data : g_AnimPattern)
     {
         data.m_TextureId = -1;
     }
 
-    for (AnimPlayData& data : g_AnimPlay)
-    {
-        data.m_PatternId = -1;
-        data.m_IsStopped = false;
-    }
+    g_AnimPlay.Clear();
+    g_AnimPlay.Reserve(ANIM_PLAY_MAX);
 }
 
 void SpriteAnim_Finalize(void)
@@ -59,40 +57,41 @@ void SpriteAnim_Finalize(void)
 
 void SpriteAnim_Update(double elapsed_time)
 {
-    for (int i = 0; i < ANIM_PLAY_MAX; i++)
+    for (AnimPlayData& play : g_AnimPlay)
     {
-        if (g_AnimPlay[i].m_PatternId < 0) continue; // f[^ĂȂ
-
-        const int pattern_id = g_AnimPlay[i].m_PatternId;
+        const int pattern_id = play.m_PatternId;
         AnimPatternData* pPatternData = &g_AnimPattern[pattern_id];
 
-        if (g_AnimPlay[i].m_accumulated_time >= pPatternData->m_seconds_per_pattern)
+        if (play.m_accumulated_time >= pPatternData->m_seconds_per_pattern)
         {
-            g_AnimPlay[i].m_PatternNum++;
+            play.m_PatternNum++;
 
-            if (g_AnimPlay[i].m_PatternNum >= pPatternData->m_PatternMax)
+            if (play.m_PatternNum >= pPatternData->m_PatternMax)
             {
                 if (pPatternData->m_IsLooped)
                 {
-                    g_AnimPlay[i].m_PatternNum = 0;
+                    play.m_PatternNum = 0;
                 }
                 else
                 {
-                    g_AnimPlay[i].m_PatternNum = pPatternData->m_PatternMax - 1;
-                    g_AnimPlay[i].m_IsStopped = true;
+                    play.m_PatternNum = pPatternData->m_PatternMax - 1;
+                    play.m_IsStopped = true;
                 }
             }
 
-            g_AnimPlay[i].m_accumulated_time -= pPatternData->m_seconds_per_pattern;
+            play.m_accumulated_time -= pPatternData->m_seconds_per_pattern;
         }
-        g_AnimPlay[i].m_accumulated_time += elapsed_time;
+        play.m_accumulated_time += elapsed_time;
     }
 }
 
-void SpriteAnim_Draw(int playid, float dx, float dy, float dw, float dh)
+void SpriteAnim_Draw(SlotHandle playId, float dx, float dy, float dw, float dh)
 {
-    const int pattern_id = g_AnimPlay[playid].m_PatternId;
-    const int pattern_num = g_AnimPlay[playid].m_PatternNum;
+    const AnimPlayData* pPlay = g_AnimPlay.Get(playId);
+    if (!pPlay) return;
+
+    const int pattern_id = pPlay->m_PatternId;
+    const int pattern_num = pPlay->m_PatternNum;
     AnimPatternData* pPatternData = &g_AnimPattern[pattern_id];
 
     Sprite_Draw(
@@ -108,10 +107,13 @@ void SpriteAnim_Draw(int playid, float dx, float dy, float dw, float dh)
     );
 }
 
-void BillboardAnim_Draw(int playid, const DirectX::XMFLOAT3& position, const DirectX::XMFLOAT2& scale, const DirectX::XMFLOAT2& pivot)
+void BillboardAnim_Draw(SlotHandle playId, const DirectX::XMFLOAT3& position, const DirectX::XMFLOAT2& scale, const DirectX::XMFLOAT2& pivot)
 {
-    const int pattern_id = g_AnimPlay[playid].m_PatternId;
-    const int pattern_num = g_AnimPlay[playid].m_PatternNum;
+    const AnimPlayData* pPlay = g_AnimPlay.Get(playId);
+    if (!pPlay) return;
+
+    const int pattern_id = pPlay->m_PatternId;
+    const int pattern_num = pPlay->m_PatternNum;
     AnimPatternData* pPatternData = &g_AnimPattern[pattern_id];
 
     const XMFLOAT4 texCut = { static_cast<float>(pPatternData->m_StartPosition.x + pPatternData->m_PatternSize.x * (pattern_num % pPatternData->m_HPatternMax)), static_cast<float>(pPatternData->m_StartPosition.y + pPatternData->m_PatternSize.y * (pattern_num / pPatternData->m_HPatternMax)),
@@ -142,29 +144,26 @@ int SpriteAnim_RegisterPattern(int textureId, int patternMax, int m_HPatternMax,
     return -1;
 }
 
-int SpriteAnim_CreatePlayer(int anim_pattern_id)
+SlotHandle SpriteAnim_CreatePlayer(int anim_pattern_id)
 {
-    for (int i = 0; i < ANIM_PLAY_MAX; i++)
+    if (anim_pattern_id < 0 || g_AnimPlay.Size() >= ANIM_PLAY_MAX)
     {
-        if (g_AnimPlay[i].m_PatternId >= 0) continue;
-
-        g_AnimPlay[i].m_PatternId = anim_pattern_id;
-        g_AnimPlay[i].m_accumulated_time = 0;
-        g_AnimPlay[i].m_PatternNum = 0;
-
-        g_AnimPlay[i].m_IsStopped = false;
-
-        return i;
+        return {};
     }
-    return -1;
+
+    AnimPlayData play;
+    play.m_PatternId = anim_pattern_id;
+    return g_AnimPlay.Insert(play);
 }
 
-bool SpriteAnim_IsStopped(int index)
+bool SpriteAnim_IsStopped(SlotHandle playId)
 {
-    return g_AnimPlay[index].m_IsStopped;
+    // 破棄済み・作成失敗のプレイヤーは再生が終わったものとして扱う
+    const AnimPlayData* pPlay = g_AnimPlay.Get(playId);
+    return !pPlay || pPlay->m_IsStopped;
 }
 
-void SpriteAnim_DestroyPlayer(int index)
+void SpriteAnim_DestroyPlayer(SlotHandle playId)
 {
-    g_AnimPlay[index].m_PatternId = -1;
+    g_AnimPlay.Remove(playId);
 }
@@ -1,6 +1,6 @@
 /*==============================================================================
 
-   eNX`Ǘ[texture.cpp]
+   テクスチャ管理[texture.cpp]
                                                          Author : Natsume Shidara
                                                          Date   : 2025/06/13
 --------------------------------------------------------------------------------
@@ -16,7 +16,7 @@
 using namespace DirectX;
 
 
-static constexpr int TEXTURE_MAX = 8192; // eNX`Ǘő吔
+static constexpr int TEXTURE_MAX = 8192; // テクスチャ管理最大数
 
 struct Texture
 {
@@ -32,7 +32,7 @@ static Texture g_Textures[TEXTURE_MAX]{};
 static int g_SetTextureIndex = -1;
 
 
-// ӁIŊOݒ肳́BReleasesvB
+// 注意！初期化で外部から設定されるもの。Release不要。
 static ID3D11Device* g_pDevice = nullptr;
 static ID3D11DeviceContext* g_pContext = nullptr;
 
@@ -52,7 +52,7 @@ void Texture_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 void Texture_Finalize(void) { Texture_AllRelease(); }
 int Texture_Load(const wchar_t* pFilename)
 {
-    // łɓǂݍfile͓ǂݍ܂Ȃ
+    // すでに読み込んだfileは読み込まない
     for (int i = 0; i < TEXTURE_MAX; i++)
     {
         if (g_Textures[i].filename == pFilename)
@@ -61,21 +61,21 @@ int Texture_Load(const wchar_t* pFilename)
         }
     }
 
-    // 󂢂ĂǗ̈T
+    // 空いている管理領域を探す
     for (int i = 0; i < TEXTURE_MAX; i++)
     {
 
         if (g_Textures[i].pTexture)
-            continue; // gp
+            continue; // 使用中
 
-        // eNX`̓ǂݍ
+        // テクスチャの読み込み
         HRESULT hr;
 
         hr = CreateWICTextureFromFile(g_pDevice, g_pContext, pFilename, &g_Textures[i].pTexture, &g_Textures[i].pTextureView);
 
         if (FAILED(hr))
         {
-            std::wstring errorMsg = L"eNX`̓ǂݍ݂Ɏs܂\nw肳ꂽpX:";
+            std::wstring errorMsg = L"テクスチャの読み込みに失敗しました\n指定されたパス:";
             errorMsg += pFilename;
             MessageBoxW(nullptr, errorMsg.c_str(), pFilename, MB_OK | MB_ICONERROR);
 
@@ -113,7 +113,7 @@ void Texture_SetTexture(int texid, int slot)
 
     //g_SetTextureIndex = texid;
 
-    // eNX`ݒ
+    // テクスチャ設定
     g_pContext->PSSetShaderResources(slot, 1, &g_Textures[texid].pTextureView);
 }
 
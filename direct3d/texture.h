@@ -1,6 +1,6 @@
 /**
  * @file texture.h
- * @brief eNX`Ǘ
+ * @brief テクスチャ管理
  * @author Natsume Shidara
  * @date 2025/06/12
  */
@@ -15,18 +15,18 @@ void Texture_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
 void Texture_Finalize(void);
 
 /**
-* @brief eNX`摜̓ǂݍ
-* @param pFilename ǂݍ݂t@C
-* @pre Texture_Initialize()ŏ
-* @return Ǘԍ
-* @retval -1 ǂݍ߂Ȃꍇ
+* @brief テクスチャ画像の読み込み
+* @param pFilename 読み込みたいファイルの
+* @pre Texture_Initialize()で初期化後
+* @return 管理番号
+* @retval -1 読み込めなかった場合
 */
 int Texture_Load(const wchar_t* pFilename);
 
 void Texture_AllRelease();
 
 /**
-* @param texid Ǘԍ
+* @param texid 管理番号
 */
 void Texture_SetTexture(int texid, int slot = 0);
 
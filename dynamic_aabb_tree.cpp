@@ -0,0 +1,398 @@
+﻿/****************************************
+ * @file dynamic_aabb_tree.cpp
+ * @brief 動的AABBツリーの実装
+ * @detail 表面積ヒューリスティックによる挿入位置の選択とAVL風の回転で高さを抑える
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#include "dynamic_aabb_tree.h"
+#include <algorithm>
+#include <cassert>
+
+using namespace DirectX;
+
+namespace
+{
+    constexpr int INITIAL_NODE_CAPACITY = 64;
+
+    AABB CombineAABB(const AABB& a, const AABB& b)
+    {
+        AABB result;
+        result.min = { std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z) };
+        result.max = { std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z) };
+        return result;
+    }
+
+    float SurfaceArea(const AABB& aabb)
+    {
+        const float dx = aabb.max.x - aabb.min.x;
+        const float dy = aabb.max.y - aabb.min.y;
+        const float dz = aabb.max.z - aabb.min.z;
+        return 2.0f * (dx * dy + dy * dz + dz * dx);
+    }
+
+    bool ContainsAABB(const AABB& outer, const AABB& inner)
+    {
+        return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+               inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+    }
+
+    AABB FattenAABB(const AABB& aabb, float margin)
+    {
+        AABB result;
+        result.min = { aabb.min.x - margin, aabb.min.y - margin, aabb.min.z - margin };
+        result.max = { aabb.max.x + margin, aabb.max.y + margin, aabb.max.z + margin };
+        return result;
+    }
+}
+
+//======================================
+// コンストラクタ
+//======================================
+DynamicAABBTree::DynamicAABBTree()
+    : m_Nodes()
+    , m_Root(NULL_NODE)
+    , m_FreeList(NULL_NODE)
+    , m_ProxyCount(0)
+{
+    m_Nodes.reserve(INITIAL_NODE_CAPACITY);
+}
+
+//======================================
+// ノード管理
+//======================================
+int DynamicAABBTree::AllocateNode()
+{
+    if (m_FreeList == NULL_NODE)
+    {
+        Node node = {};
+        node.parent = NULL_NODE;
+        node.child1 = NULL_NODE;
+        node.child2 = NULL_NODE;
+        node.height = 0;
+        node.userData = nullptr;
+        m_Nodes.push_back(node);
+        return static_cast<int>(m_Nodes.size()) - 1;
+    }
+
+    int nodeId = m_FreeList;
+    Node& node = m_Nodes[nodeId];
+    m_FreeList = node.parent;
+    node.parent = NULL_NODE;
+    node.child1 = NULL_NODE;
+    node.child2 = NULL_NODE;
+    node.height = 0;
+    node.userData = nullptr;
+    return nodeId;
+}
+
+void DynamicAABBTree::FreeNode(int nodeId)
+{
+    Node& node = m_Nodes[nodeId];
+    node.parent = m_FreeList;
+    node.height = -1;
+    node.userData = nullptr;
+    m_FreeList = nodeId;
+}
+
+void DynamicAABBTree::Clear()
+{
+    m_Nodes.clear();
+    m_Root = NULL_NODE;
+    m_FreeList = NULL_NODE;
+    m_ProxyCount = 0;
+}
+
+//======================================
+// プロキシ操作
+//======================================
+int DynamicAABBTree::CreateProxy(const AABB& aabb, void* userData)
+{
+    int proxyId = AllocateNode();
+    m_Nodes[proxyId].aabb = FattenAABB(aabb, AABB_MARGIN);
+    m_Nodes[proxyId].userData = userData;
+    m_Nodes[proxyId].height = 0;
+
+    InsertLeaf(proxyId);
+    m_ProxyCount++;
+    return proxyId;
+}
+
+void DynamicAABBTree::DestroyProxy(int proxyId)
+{
+    assert(0 <= proxyId && proxyId < static_cast<int>(m_Nodes.size()));
+    assert(m_Nodes[proxyId].IsLeaf());
+
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    m_ProxyCount--;
+}
+
+bool DynamicAABBTree::MoveProxy(int proxyId, const AABB& aabb, const XMFLOAT3& displacement)
+{
+    assert(0 <= proxyId && proxyId < static_cast<int>(m_Nodes.size()));
+    assert(m_Nodes[proxyId].IsLeaf());
+
+    // 余裕の範囲内なら何もしない
+    if (ContainsAABB(m_Nodes[proxyId].aabb, aabb))
+    {
+        return false;
+    }
+
+    RemoveLeaf(proxyId);
+
+    // マージンに加え、移動方向へ先読みして広げる
+    AABB fat = FattenAABB(aabb, AABB_MARGIN);
+    const float dx = displacement.x * DISPLACEMENT_MULTIPLIER;
+    const float dy = displacement.y * DISPLACEMENT_MULTIPLIER;
+    const float dz = displacement.z * DISPLACEMENT_MULTIPLIER;
+    if (dx < 0.0f) fat.min.x += dx; else fat.max.x += dx;
+    if (dy < 0.0f) fat.min.y += dy; else fat.max.y += dy;
+    if (dz < 0.0f) fat.min.z += dz; else fat.max.z += dz;
+
+    m_Nodes[proxyId].aabb = fat;
+    InsertLeaf(proxyId);
+    return true;
+}
+
+//======================================
+// 挿入・削除
+//======================================
+void DynamicAABBTree::InsertLeaf(int leaf)
+{
+    if (m_Root == NULL_NODE)
+    {
+        m_Root = leaf;
+        m_Nodes[m_Root].parent = NULL_NODE;
+        return;
+    }
+
+    // 表面積コストが最小となる兄弟ノードを探索
+    const AABB leafAABB = m_Nodes[leaf].aabb;
+    int index = m_Root;
+    while (!m_Nodes[index].IsLeaf())
+    {
+        const Node& node = m_Nodes[index];
+        const int child1 = node.child1;
+        const int child2 = node.child2;
+
+        const float area = SurfaceArea(node.aabb);
+        const float combinedArea = SurfaceArea(CombineAABB(node.aabb, leafAABB));
+
+        // このノードの兄弟として新しい親を作るコスト
+        const float cost = 2.0f * combinedArea;
+        // 下位へ降りる場合に祖先が負担する増分
+        const float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto childCost = [&](int child)
+        {
+            const AABB combined = CombineAABB(leafAABB, m_Nodes[child].aabb);
+            if (m_Nodes[child].IsLeaf())
+            {
+                return SurfaceArea(combined) + inheritanceCost;
+            }
+            return SurfaceArea(combined) - SurfaceArea(m_Nodes[child].aabb) + inheritanceCost;
+        };
+
+        const float cost1 = childCost(child1);
+        const float cost2 = childCost(child2);
+
+        if (cost < cost1 && cost < cost2) break;
+
+        index = (cost1 < cost2) ? child1 : child2;
+    }
+
+    const int sibling = index;
+
+    // 新しい親ノードを作成
+    const int oldParent = m_Nodes[sibling].parent;
+    const int newParent = AllocateNode();
+    m_Nodes[newParent].parent = oldParent;
+    m_Nodes[newParent].userData = nullptr;
+    m_Nodes[newParent].aabb = CombineAABB(leafAABB, m_Nodes[sibling].aabb);
+    m_Nodes[newParent].height = m_Nodes[sibling].height + 1;
+
+    if (oldParent != NULL_NODE)
+    {
+        if (m_Nodes[oldParent].child1 == sibling) m_Nodes[oldParent].child1 = newParent;
+        else m_Nodes[oldParent].child2 = newParent;
+    }
+    else
+    {
+        m_Root = newParent;
+    }
+
+    m_Nodes[newParent].child1 = sibling;
+    m_Nodes[newParent].child2 = leaf;
+    m_Nodes[sibling].parent = newParent;
+    m_Nodes[leaf].parent = newParent;
+
+    // 祖先のAABBと高さを更新
+    index = m_Nodes[leaf].parent;
+    while (index != NULL_NODE)
+    {
+        index = Balance(index);
+
+        const int child1 = m_Nodes[index].child1;
+        const int child2 = m_Nodes[index].child2;
+        m_Nodes[index].height = 1 + std::max(m_Nodes[child1].height, m_Nodes[child2].height);
+        m_Nodes[index].aabb = CombineAABB(m_Nodes[child1].aabb, m_Nodes[child2].aabb);
+
+        index = m_Nodes[index].parent;
+    }
+}
+
+void DynamicAABBTree::RemoveLeaf(int leaf)
+{
+    if (leaf == m_Root)
+    {
+        m_Root = NULL_NODE;
+        return;
+    }
+
+    const int parent = m_Nodes[leaf].parent;
+    const int grandParent = m_Nodes[parent].parent;
+    const int sibling = (m_Nodes[parent].child1 == leaf) ? m_Nodes[parent].child2 : m_Nodes[parent].child1;
+
+    if (grandParent != NULL_NODE)
+    {
+        // 親を破棄し、兄弟を祖父に直接つなぐ
+        if (m_Nodes[grandParent].child1 == parent) m_Nodes[grandParent].child1 = sibling;
+        else m_Nodes[grandParent].child2 = sibling;
+        m_Nodes[sibling].parent = grandParent;
+        FreeNode(parent);
+
+        int index = grandParent;
+        while (index != NULL_NODE)
+        {
+            index = Balance(index);
+
+            const int child1 = m_Nodes[index].child1;
+            const int child2 = m_Nodes[index].child2;
+            m_Nodes[index].aabb = CombineAABB(m_Nodes[child1].aabb, m_Nodes[child2].aabb);
+            m_Nodes[index].height = 1 + std::max(m_Nodes[child1].height, m_Nodes[child2].height);
+
+            index = m_Nodes[index].parent;
+        }
+    }
+    else
+    {
+        m_Root = sibling;
+        m_Nodes[sibling].parent = NULL_NODE;
+        FreeNode(parent);
+    }
+}
+
+//======================================
+// バランス調整（高さ差が2以上なら回転）
+//======================================
+int DynamicAABBTree::Balance(int iA)
+{
+    Node& A = m_Nodes[iA];
+    if (A.IsLeaf() || A.height < 2)
+    {
+        return iA;
+    }
+
+    const int iB = A.child1;
+    const int iC = A.child2;
+    Node& B = m_Nodes[iB];
+    Node& C = m_Nodes[iC];
+
+    const int balance = C.height - B.height;
+
+    // Cを持ち上げる
+    if (balance > 1)
+    {
+        const int iF = C.child1;
+        const int iG = C.child2;
+        Node& F = m_Nodes[iF];
+        Node& G = m_Nodes[iG];
+
+        C.child1 = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+
+        if (C.parent != NULL_NODE)
+        {
+            if (m_Nodes[C.parent].child1 == iA) m_Nodes[C.parent].child1 = iC;
+            else m_Nodes[C.parent].child2 = iC;
+        }
+        else
+        {
+            m_Root = iC;
+        }
+
+        if (F.height > G.height)
+        {
+            C.child2 = iF;
+            A.child2 = iG;
+            G.parent = iA;
+            A.aabb = CombineAABB(B.aabb, G.aabb);
+            C.aabb = CombineAABB(A.aabb, F.aabb);
+            A.height = 1 + std::max(B.height, G.height);
+            C.height = 1 + std::max(A.height, F.height);
+        }
+        else
+        {
+            C.child2 = iG;
+            A.child2 = iF;
+            F.parent = iA;
+            A.aabb = CombineAABB(B.aabb, F.aabb);
+            C.aabb = CombineAABB(A.aabb, G.aabb);
+            A.height = 1 + std::max(B.height, F.height);
+            C.height = 1 + std::max(A.height, G.height);
+        }
+
+        return iC;
+    }
+
+    // Bを持ち上げる
+    if (balance < -1)
+    {
+        const int iD = B.child1;
+        const int iE = B.child2;
+        Node& D = m_Nodes[iD];
+        Node& E = m_Nodes[iE];
+
+        B.child1 = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+
+        if (B.parent != NULL_NODE)
+        {
+            if (m_Nodes[B.parent].child1 == iA) m_Nodes[B.parent].child1 = iB;
+            else m_Nodes[B.parent].child2 = iB;
+        }
+        else
+        {
+            m_Root = iB;
+        }
+
+        if (D.height > E.height)
+        {
+            B.child2 = iD;
+            A.child1 = iE;
+            E.parent = iA;
+            A.aabb = CombineAABB(C.aabb, E.aabb);
+            B.aabb = CombineAABB(A.aabb, D.aabb);
+            A.height = 1 + std::max(C.height, E.height);
+            B.height = 1 + std::max(A.height, D.height);
+        }
+        else
+        {
+            B.child2 = iE;
+            A.child1 = iD;
+            D.parent = iA;
+            A.aabb = CombineAABB(C.aabb, D.aabb);
+            B.aabb = CombineAABB(A.aabb, E.aabb);
+            A.height = 1 + std::max(C.height, D.height);
+            B.height = 1 + std::max(A.height, E.height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
@@ -0,0 +1,198 @@
+﻿/****************************************
+ * @file dynamic_aabb_tree.h
+ * @brief 動的AABBツリー（ブロードフェーズ用BVH）
+ * @detail 余裕（マージン）付きのAABBで葉を保持し、移動が小さい間は再挿入しない
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 探索スタックを固定長配列にして問い合わせごとの確保をなくす
+ ****************************************/
+
+#ifndef DYNAMIC_AABB_TREE_H
+#define DYNAMIC_AABB_TREE_H
+
+#include <DirectXMath.h>
+#include <vector>
+#include "collision.h"
+#include "ray.h"
+
+class DynamicAABBTree
+{
+public:
+    static constexpr int NULL_NODE = -1;
+
+    // 太らせたAABBのマージン
+    static constexpr float AABB_MARGIN = 0.1f;
+    // 移動量による先読み倍率
+    static constexpr float DISPLACEMENT_MULTIPLIER = 2.0f;
+    // 探索スタックの固定長（平衡木の高さに対して十分な大きさ）
+    static constexpr int QUERY_STACK_CAPACITY = 256;
+
+public:
+    DynamicAABBTree();
+    ~DynamicAABBTree() = default;
+
+    /**
+     * @brief プロキシ（葉）を生成
+     * @param aabb 実際のAABB（内部でマージンを付加）
+     * @param userData 呼び出し側の識別データ
+     * @return プロキシID
+     */
+    int CreateProxy(const AABB& aabb, void* userData);
+
+    /**
+     * @brief プロキシを削除
+     */
+    void DestroyProxy(int proxyId);
+
+    /**
+     * @brief プロキシを移動
+     * @param displacement 1ステップの予測移動量（太らせる方向の先読み）
+     * @return 太らせたAABBからはみ出して再挿入した場合true
+     */
+    bool MoveProxy(int proxyId, const AABB& aabb, const DirectX::XMFLOAT3& displacement);
+
+    /**
+     * @brief 全ノードを破棄
+     */
+    void Clear();
+
+    void* GetUserData(int proxyId) const { return m_Nodes[proxyId].userData; }
+    const AABB& GetFatAABB(int proxyId) const { return m_Nodes[proxyId].aabb; }
+    int GetProxyCount() const { return m_ProxyCount; }
+    int GetHeight() const { return (m_Root == NULL_NODE) ? 0 : m_Nodes[m_Root].height; }
+
+    /**
+     * @brief AABBと重なる葉を列挙
+     * @param callback bool(int proxyId) falseを返すと探索終了
+     */
+    template<typename Callback>
+    void Query(const AABB& aabb, Callback&& callback) const;
+
+    /**
+     * @brief レイと交差する葉を近い順とは限らない順で列挙
+     * @param callback float(int proxyId, float maxDistance) 新しい最大距離を返す（0以下で探索終了）
+     */
+    template<typename Callback>
+    void RayCast(const Ray& ray, float maxDistance, Callback&& callback) const;
+
+private:
+    struct Node
+    {
+        AABB aabb;
+        void* userData;
+        int parent;     // 空きリスト中は次の空きノード
+        int child1;
+        int child2;
+        int height;     // 葉=0、空き=-1
+
+        bool IsLeaf() const { return child1 == NULL_NODE; }
+    };
+
+    /**
+     * @brief 探索用のスタック
+     * @detail 呼び出し側の関数内に置く固定長配列に積み、溢れた分だけヒープへ逃がす。
+     *         入れ子の探索・並列探索でも共有せず、通常は確保も発生しない
+     */
+    class NodeStack
+    {
+    public:
+        bool IsEmpty() const { return m_Count == 0; }
+
+        void Push(int nodeId)
+        {
+            if (m_Count < QUERY_STACK_CAPACITY) m_Inline[m_Count] = nodeId;
+            else m_Overflow.push_back(nodeId);
+            ++m_Count;
+        }
+
+        int Pop()
+        {
+            --m_Count;
+            if (m_Count < QUERY_STACK_CAPACITY) return m_Inline[m_Count];
+
+            const int nodeId = m_Overflow.back();
+            m_Overflow.pop_back();
+            return nodeId;
+        }
+
+    private:
+        int m_Inline[QUERY_STACK_CAPACITY];
+        int m_Count = 0;
+        std::vector<int> m_Overflow;
+    };
+
+    int AllocateNode();
+    void FreeNode(int nodeId);
+    void InsertLeaf(int leaf);
+    void RemoveLeaf(int leaf);
+    int Balance(int nodeId);
+
+    std::vector<Node> m_Nodes;
+    int m_Root;
+    int m_FreeList;
+    int m_ProxyCount;
+};
+
+//======================================
+// テンプレート実装
+//======================================
+
+template<typename Callback>
+void DynamicAABBTree::Query(const AABB& aabb, Callback&& callback) const
+{
+    if (m_Root == NULL_NODE) return;
+
+    // 入れ子の探索・並列探索に備えてローカルスタックを使用
+    NodeStack stack;
+    stack.Push(m_Root);
+
+    while (!stack.IsEmpty())
+    {
+        const int nodeId = stack.Pop();
+
+        const Node& node = m_Nodes[nodeId];
+        if (!Collision_IsOverlapAABB(node.aabb, aabb)) continue;
+
+        if (node.IsLeaf())
+        {
+            if (!callback(nodeId)) return;
+        }
+        else
+        {
+            stack.Push(node.child1);
+            stack.Push(node.child2);
+        }
+    }
+}
+
+template<typename Callback>
+void DynamicAABBTree::RayCast(const Ray& ray, float maxDistance, Callback&& callback) const
+{
+    if (m_Root == NULL_NODE) return;
+
+    NodeStack stack;
+    stack.Push(m_Root);
+
+    while (!stack.IsEmpty())
+    {
+        const int nodeId = stack.Pop();
+
+        const Node& node = m_Nodes[nodeId];
+
+        float dist = 0.0f;
+        if (!Collision_IntersectRayAABB(ray, node.aabb, &dist) || dist > maxDistance) continue;
+
+        if (node.IsLeaf())
+        {
+            maxDistance = callback(nodeId, maxDistance);
+            if (maxDistance <= 0.0f) return;
+        }
+        else
+        {
+            stack.Push(node.child1);
+            stack.Push(node.child2);
+        }
+    }
+}
+
+#endif // DYNAMIC_AABB_TREE_H
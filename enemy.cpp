@@ -1,9 +1,13 @@
 /****************************************
  * @file enemy.cpp
- * @brief GLN^ǗVXe̎
+ * @brief 敵キャラクタ管理システムの実装
  * @author Natsume Shidara
  * @date 2025/11/26
- * @update 2026/01/13 - EnemyFlying
+ * @update 2026/01/13 - EnemyFlying統合
+ * @update 2026/10/18 - 敵の残骸を EnemyPiece レイヤーで登録
+ * @update 2026/10/18 - 切断対象の探索をシーン問い合わせへ移行
+ * @update 2026/10/18 - 切断候補を刃の掃いた四角形で探し、平面がまたぐものだけ切断
+ * @update 2026/10/18 - 残骸にはワーカーで当てはめたコライダーを渡す
  ****************************************/
 
 #include "enemy.h"
@@ -13,6 +17,9 @@
 #include "slicer.h"
 #include "slice_task_manager.h"
 #include "collision.h"
+#include "scene_query.h"
+#include "physics_model.h"
+#include "model.h"
 #include "score.h"
 #include "combo.h"
 #include "player.h"
@@ -25,27 +32,28 @@
 using namespace DirectX;
 
 //--------------------------------------
-// 萔
+// 定数
 //--------------------------------------
 namespace
 {
-    // ؒfݒ
+    // 切断設定
     constexpr float MIN_VOLUME = 0.0001f;
+    constexpr float SLICE_STRADDLE_MARGIN = 0.01f;  // 切断後の各片に残る最小の厚み（境界ボックス基準）
 
-    // Ń^C}[i0.25bҋ@ + 1bk = 1.25bj
+    // 消滅タイマー（0.25秒待機 + 1秒縮小 = 1.25秒）
     constexpr float DEBRIS_LIFETIME = 1.25f;
 
-    // XRAݒ
+    // スコア設定
     constexpr int SCORE_PER_SLICE = 100;
     constexpr int SCORE_KILL_BONUS = 500;
 }
 
 //--------------------------------------
-// Ǘpϐ
+// 管理用変数
 //--------------------------------------
 static std::vector<Enemy*> g_Enemies;
 
-// ؒf̓G
+// 切断処理中の敵情報
 struct PendingSliceInfo
 {
     Enemy* pEnemy;
@@ -55,12 +63,12 @@ struct PendingSliceInfo
 static std::unordered_map<int, PendingSliceInfo> g_PendingSliceEnemies;
 
 //======================================
-// wp[֐
+// ヘルパー関数
 //======================================
 namespace
 {
     /**
-     * @brief MeshDataAABBx[X̑̐ς𐄒
+     * @brief MeshDataからAABBベースの体積を推定
      */
     float EstimateVolumeFromMeshes(const std::vector<MeshData>& meshes)
     {
@@ -90,7 +98,7 @@ namespace
     }
 
     /**
-     * @brief ؒfjЂiGƂČp or c[j
+     * @brief 切断破片を処理（敵として継続 or 残骸化）
      */
     void ProcessSlicedPiece(
         const std::vector<MeshData>& meshes,
@@ -99,20 +107,21 @@ namespace
         const XMFLOAT3& planeNormal,
         float rootVolume,
         bool isFrontSide,
-        ENEMY_TYPE enemyType)
+        ENEMY_TYPE enemyType,
+        int collisionGroup)
     {
         if (meshes.empty()) return;
 
-        // ̐ς𐄒
+        // 体積を推定
         float pieceVolume = EstimateVolumeFromMeshes(meshes);
         float volumeRatio = (rootVolume > MIN_VOLUME) ? (pieceVolume / rootVolume) : 0.0f;
 
-        // p[^vZ
+        // 分離パラメータを計算
         XMVECTOR vPos = XMLoadFloat3(&result.originalPosition);
         XMVECTOR vVel = XMLoadFloat3(&result.originalVelocity);
         XMVECTOR vNormal = XMLoadFloat3(&planeNormal);
 
-        // G^Cvɉp[^
+        // 敵タイプに応じた分離パラメータ
         float separationSpeed = EnemyGroundConfig::SLICE_SEPARATION_SPEED;
         float offsetDistance = EnemyGroundConfig::SLICE_OFFSET_DISTANCE;
         float deathThreshold = EnemyGroundConfig::DEATH_VOLUME_THRESHOLD;
@@ -132,10 +141,10 @@ namespace
         XMStoreFloat3(&newPosition, vPos);
         XMStoreFloat3(&newVelocity, vVel);
 
-        // ̐ϔ䗦ŐU蕪i50%œGƂČpj
+        // 体積比率で振り分け（50%超で敵として継続）
         if (volumeRatio > deathThreshold)
         {
-            // 50%  GƂČp
+            // 50%超 → 敵として継続
             if (enemyType == ENEMY_TYPE_GROUND)
             {
                 SlicedEnemyParams params;
@@ -177,7 +186,7 @@ namespace
         }
         else
         {
-            // 50%ȉ  PropManagerցic[j
+            // 50%以下 → PropManagerへ（残骸化）
             SlicedPieceParams params;
             params.meshes = meshes;
             params.originalModel = originalModel;
@@ -187,12 +196,14 @@ namespace
             params.mass = result.originalMass * volumeRatio;
             params.rootVolume = rootVolume;
             params.lifeTime = DEBRIS_LIFETIME;
-            params.colliderType = result.colliderType;
+            params.collider = isFrontSide ? result.frontCollider : result.backCollider;
             params.isFrontSide = isFrontSide;
+            params.collisionLayer = CollisionLayer::EnemyPiece;
+            params.collisionGroup = collisionGroup;
 
             PropManager_AddSlicedPiece(params);
 
-            // j{[iXiR{{Kpj
+            // 撃破ボーナス（コンボ倍率適用）
             int comboCount = Combo_GetCount();
             float multiplier = 1.0f + comboCount * 0.1f;
             multiplier = std::min(multiplier, 5.0f);
@@ -203,11 +214,14 @@ namespace
 }
 
 //======================================
-// Enemy NX
+// Enemy クラス実装
 //======================================
 
 Enemy::~Enemy()
 {
+    SceneQuery_DestroyProxy(m_SceneProxy);
+    m_SceneProxy = -1;
+
     if (m_pState)
     {
         delete m_pState;
@@ -293,7 +307,7 @@ void Enemy::TakeDamage(float volumeLost)
 }
 
 //======================================
-// O[oǗ֐
+// グローバル管理関数
 //======================================
 
 void Enemy_Initialize()
@@ -325,13 +339,13 @@ void Enemy_Finalize()
 
 void Enemy_Update(float dt)
 {
-    // 1. \񂳂ꂽԑJڂm
+    // 1. 予約された状態遷移を確定
     for (Enemy* pEnemy : g_Enemies)
     {
         pEnemy->UpdateState();
     }
 
-    // 2. sXV & S
+    // 2. 行動更新 & 死亡判定
     for (int i = static_cast<int>(g_Enemies.size()) - 1; i >= 0; i--)
     {
         if (g_Enemies[i]->IsDestroy())
@@ -344,6 +358,23 @@ void Enemy_Update(float dt)
             g_Enemies[i]->Update(dt);
         }
     }
+
+    // 3. シーン問い合わせの境界を更新（切断待ちから戻った敵は登録し直す）
+    for (Enemy* pEnemy : g_Enemies)
+    {
+        const PhysicsModel* pPhysics = pEnemy->GetPhysicsModel();
+        if (!pPhysics || !pPhysics->GetModel()) continue;
+
+        const AABB aabb = Model_GetAABB(pPhysics->GetModel(), pPhysics->GetPosition());
+        if (pEnemy->GetSceneProxy() < 0)
+        {
+            pEnemy->SetSceneProxy(SceneQuery_CreateProxy(SceneObjectType::Enemy, pEnemy, aabb, CollisionLayer::EnemyPiece));
+        }
+        else
+        {
+            SceneQuery_MoveProxy(pEnemy->GetSceneProxy(), aabb);
+        }
+    }
 }
 
 void Enemy_Draw()
@@ -426,65 +457,36 @@ Enemy* Enemy_GetEnemy(int index)
 }
 
 //======================================
-// ؒf
+// 切断処理
 //======================================
 
-void Enemy_TrySlice(const Ray& ray, const XMFLOAT3& planeNormal)
+void Enemy_TrySlice(const SliceSweep& sweep)
 {
-    for (auto it = g_Enemies.begin(); it != g_Enemies.end();)
-    {
-        Enemy* pEnemy = *it;
-
-        // PhysicsModelƓG^Cv擾
-        PhysicsModel* pPhysics = nullptr;
-        ENEMY_TYPE enemyType = ENEMY_TYPE_GROUND;
-
-        EnemyGround* pGround = dynamic_cast<EnemyGround*>(pEnemy);
-        EnemyFlying* pFlying = dynamic_cast<EnemyFlying*>(pEnemy);
+    // 刃の掃いた四角形と重なる敵をシーン問い合わせで集める
+    static std::vector<SceneQueryHit> hits;
+    SceneQuery_OverlapQuad(sweep.corners, SceneQueryFilter(CollisionLayer::EnemyPiece, SceneObjectType::Enemy), hits);
 
-        if (pGround && pGround->GetPhysicsModel())
-        {
-            pPhysics = pGround->GetPhysicsModel();
-            enemyType = ENEMY_TYPE_GROUND;
-        }
-        else if (pFlying && pFlying->GetPhysicsModel())
-        {
-            pPhysics = pFlying->GetPhysicsModel();
-            enemyType = ENEMY_TYPE_FLYING;
-        }
+    const XMFLOAT3& planeNormal = sweep.planeNormal;
 
-        if (!pPhysics)
-        {
-            ++it;
-            continue;
-        }
+    for (const SceneQueryHit& hit : hits)
+    {
+        Enemy* pEnemy = static_cast<Enemy*>(hit.userData);
+        PhysicsModel* pPhysics = pEnemy->GetPhysicsModel();
+        if (!pPhysics) continue;
 
         MODEL* pModel = pPhysics->GetModel();
-        if (!pModel)
-        {
-            ++it;
-            continue;
-        }
+        if (!pModel) continue;
 
-        // AABBł̑e
-        XMFLOAT3 pos = pPhysics->GetPosition();
-        AABB worldAABB = Model_GetAABB(pModel, pos);
-
-        float hitDist = 0.0f;
-        if (!Collision_IntersectRayAABB(ray, worldAABB, &hitDist))
+        // 平面がメッシュの境界をまたがなければ切断しても2つに分かれない
+        if (!Collision_IsOBBStraddlingPlane(pPhysics->GetMeshBounds(), sweep.planePoint, planeNormal, SLICE_STRADDLE_MARGIN))
         {
-            ++it;
             continue;
         }
 
-        // qbgʒu
-        XMFLOAT3 rayOrigin = ray.GetOrigin();
-        XMFLOAT3 rayDir = ray.GetDirection();
-        XMVECTOR vHitPos = XMLoadFloat3(&rayOrigin) + XMLoadFloat3(&rayDir) * hitDist;
-        XMFLOAT3 hitPos;
-        XMStoreFloat3(&hitPos, vHitPos);
+        const ENEMY_TYPE enemyType = pEnemy->GetType();
+        const XMFLOAT3 hitPos = sweep.planePoint;
 
-        // ؒfNGXg𑗐M
+        // 切断リクエストを送信
         RigidBody* rb = pPhysics->GetRigidBody();
 
         SliceRequest request;
@@ -500,13 +502,17 @@ void Enemy_TrySlice(const Ray& ray, const XMFLOAT3& planeNormal)
 
         int requestId = SliceTaskManager::EnqueueSlice(request);
 
-        // ؒf҂XgɈړiG^Cvۑj
+        // 切断待ちリストに移動（敵タイプも保存）
         PendingSliceInfo info;
         info.pEnemy = pEnemy;
         info.planeNormal = planeNormal;
         info.enemyType = enemyType;
         g_PendingSliceEnemies[requestId] = info;
-        it = g_Enemies.erase(it);
+
+        // 切断待ちの間は問い合わせから外す（失敗して戻った場合は Enemy_Update で登録し直す）
+        SceneQuery_DestroyProxy(pEnemy->GetSceneProxy());
+        pEnemy->SetSceneProxy(-1);
+        g_Enemies.erase(std::find(g_Enemies.begin(), g_Enemies.end(), pEnemy));
     }
 }
 
@@ -517,11 +523,11 @@ bool Enemy_ProcessSliceResults()
 
     while (SliceTaskManager::TryGetCompletedResult(result))
     {
-        // G̐ؒfʂǂmF
+        // 敵の切断結果かどうか確認
         auto it = g_PendingSliceEnemies.find(result.requestId);
         if (it == g_PendingSliceEnemies.end())
         {
-            // Gł͂ȂiPropManageȑɔCj
+            // 敵ではない（PropManagerの処理に任せる）
             continue;
         }
 
@@ -534,38 +540,43 @@ bool Enemy_ProcessSliceResults()
 
         if (!result.success)
         {
-            // ؒfs - ɖ߂
+            // 切断失敗 - 元に戻す
             g_Enemies.push_back(pOriginalEnemy);
             ModelRelease(result.originalModel);
+            SliceTaskManager::NotifyFinalized(result);
             continue;
         }
 
-        // ؒf - ̐ςɉĐU蕪
+        // 切断成功 - 体積に応じて振り分け
         float rootVolume = result.rootVolume;
 
-        // R{ǉ
+        // コンボ追加
         Combo_Add(1);
 
-        // XRAZiR{{[iX݁j
+        // スコア加算（コンボボーナス込み）
         int bonusScore = Combo_GetBonusScore();
         Score_AddScore(bonusScore);
 
-        // AirDashɐؒfꍇAAirDash
+        // AirDash中に切断成功した場合、AirDashを回復
         PlayerState playerState = Player_GetState();
         if (playerState == PlayerState::AirDash || playerState == PlayerState::AirDashCharge)
         {
             Player_RecoverAirDash(1);
         }
 
-        // Front̏iG^Cvnj
-        ProcessSlicedPiece(result.frontMeshes, result.originalModel, result, planeNormal, rootVolume, true, enemyType);
+        // 両側の残骸は同じ切断グループにし、分離直後に押し合わないようにする
+        int collisionGroup = PropManager_AllocateCollisionGroup();
+
+        // Front側の処理（敵タイプを渡す）
+        ProcessSlicedPiece(result.frontMeshes, result.originalModel, result, planeNormal, rootVolume, true, enemyType, collisionGroup);
 
-        // Back̏iG^Cvnj
-        ProcessSlicedPiece(result.backMeshes, result.originalModel, result, planeNormal, rootVolume, false, enemyType);
+        // Back側の処理（敵タイプを渡す）
+        ProcessSlicedPiece(result.backMeshes, result.originalModel, result, planeNormal, rootVolume, false, enemyType, collisionGroup);
 
-        // ̓G͍폜
+        // 元の敵は削除
         delete pOriginalEnemy;
         ModelRelease(result.originalModel);
+        SliceTaskManager::NotifyFinalized(result);
     }
 
     return processed;
@@ -1,9 +1,11 @@
 /****************************************
  * @file enemy.h
- * @brief GLN^NXъǗVXe
+ * @brief 敵キャラクタ基底クラスおよび管理システム
  * @author Natsume Shidara
  * @date 2025/11/26
- * @update 2026/01/10 - n^GΉ
+ * @update 2026/01/10 - 地上型敵対応
+ * @update 2026/10/18 - シーン問い合わせへの登録と、種別・物理モデルの仮想アクセサ
+ * @update 2026/10/18 - 切断を刃の掃いた範囲で判定
  ****************************************/
 
 #ifndef ENEMY_H
@@ -12,33 +14,35 @@
 #include <DirectXMath.h>
 #include "ray.h"
 
+class PhysicsModel;
+
  //--------------------------------------
- // G^Cv񋓌^
+ // 敵タイプ列挙型
  //--------------------------------------
 enum ENEMY_TYPE
 {
-    ENEMY_TYPE_GROUND,  // n^iUj
-    ENEMY_TYPE_FLYING,  // s^iŎj
+    ENEMY_TYPE_GROUND,  // 地上型（遠距離攻撃）
+    ENEMY_TYPE_FLYING,  // 飛行型（後で実装）
     ENEMY_TYPE_MAX
 };
 
 //--------------------------------------
-// GNX
+// 敵基底クラス
 //--------------------------------------
 /****************************************
  * @class Enemy
- * @brief GLN^̊NX
- * @detail Statep^[pԊǗsAhNXŌŗL̋`B
+ * @brief 敵キャラクタの基底クラス
+ * @detail Stateパターンを用いた状態管理を行い、派生クラスで固有の挙動を定義する。
  ****************************************/
 class Enemy
 {
 public:
     //======================================
-    // StateNX`
+    // 内部Stateクラス定義
     //======================================
     /**
      * @class State
-     * @brief G̏ԂǗ钊ۊNX
+     * @brief 敵の状態を管理する抽象基底クラス
      */
     class State
     {
@@ -49,9 +53,9 @@ public:
         State(Enemy* pOwner) : m_pOwner(pOwner) {}
         virtual ~State() {}
 
-        virtual void Enter() {}  // ԊJn
+        virtual void Enter() {}  // 状態開始時
         virtual void Update(float dt) = 0;
-        virtual void Exit() {}   // ԏI
+        virtual void Exit() {}   // 状態終了時
         virtual void Draw() const = 0;
         virtual void DrawShadow() const {}
         virtual void DrawDebug() const {}
@@ -61,40 +65,46 @@ protected:
     State* m_pState = nullptr;
     State* m_pNextState = nullptr;
 
-    // ʃvpeB
+    // 共通プロパティ
     DirectX::XMFLOAT3 m_Position = { 0, 0, 0 };
     DirectX::XMFLOAT3 m_Front = { 0, 0, 1 };
-    float m_VolumeRatio = 1.0f;  // c̐ϔ䗦iؒfpj
+    float m_VolumeRatio = 1.0f;  // 残り体積比率（切断用）
     bool m_IsDestroyed = false;
+    int m_SceneProxy = -1;       // シーン問い合わせ登録ID（未登録=-1）
 
 public:
     //======================================
-    // RXgN^/fXgN^
+    // コンストラクタ/デストラクタ
     //======================================
     Enemy() = default;
     virtual ~Enemy();
 
     //======================================
-    // {֐
+    // 基本動作関数
     //======================================
     void Update(float dt);
     void Draw() const;
     void DrawShadow() const;
     void DrawDebug() const;
 
-    /** @brief t[ōsԑJڂ̊m菈 */
+    /** @brief フレーム頭で行う状態遷移の確定処理 */
     void UpdateState();
 
-    /** @brief ̏Ԃ\񂷂 */
+    /** @brief 次の状態を予約する */
     void ChangeState(State* pNext);
 
     //======================================
-    // z֐
+    // 純粋仮想関数
     //======================================
     virtual bool IsDestroy() const { return m_IsDestroyed; }
+    virtual ENEMY_TYPE GetType() const = 0;
+
+    /** @brief 物理と切断の本体（持たない敵は nullptr） */
+    virtual PhysicsModel* GetPhysicsModel() { return nullptr; }
+    virtual const PhysicsModel* GetPhysicsModel() const { return nullptr; }
 
     //======================================
-    // ʃANZT
+    // 共通アクセサ
     //======================================
     const DirectX::XMFLOAT3& GetPosition() const { return m_Position; }
     void SetPosition(const DirectX::XMFLOAT3& pos) { m_Position = pos; }
@@ -104,12 +114,15 @@ public:
 
     float GetVolumeRatio() const { return m_VolumeRatio; }
 
-    /** @brief ؒfɂ̐ϑi0.0`1.0j */
+    int GetSceneProxy() const { return m_SceneProxy; }
+    void SetSceneProxy(int proxyId) { m_SceneProxy = proxyId; }
+
+    /** @brief 切断による体積損失（0.0～1.0） */
     virtual void TakeDamage(float volumeLost);
 };
 
 //--------------------------------------
-// O[oǗ֐
+// グローバル管理関数
 //--------------------------------------
 void Enemy_Initialize();
 void Enemy_Finalize();
@@ -126,14 +139,15 @@ int Enemy_GetAliveCount();
 Enemy* Enemy_GetEnemy(int index);
 
 //--------------------------------------
-// ؒf
+// 切断処理
 //--------------------------------------
-class Ray;  // O錾
+class Ray;  // 前方宣言
+struct SliceSweep;
 
-/** @brief w背Cƕʖ@œG̐ؒf݂ */
-void Enemy_TrySlice(const Ray& ray, const DirectX::XMFLOAT3& planeNormal);
+/** @brief 刃の掃いた範囲にあり、平面が境界をまたぐ敵の切断を試みる */
+void Enemy_TrySlice(const SliceSweep& sweep);
 
-/** @brief 񓯊ؒf̊ʂit[Ăԁj */
+/** @brief 非同期切断の完了結果を処理する（毎フレーム呼ぶ） */
 bool Enemy_ProcessSliceResults();
 
 #endif // ENEMY_H
\ No newline at end of file
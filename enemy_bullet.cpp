@@ -1,29 +1,33 @@
 /****************************************
  * @file enemy_bullet.cpp
- * @brief G̒e̎
+ * @brief 敵の弾の実装
  * @author Natsume Shidara
  * @date 2026/01/10
+ * @update 2026/10/18 - 固定ステップ間の描画補間
+ * @update 2026/10/18 - 移動経路のスイープ判定ですり抜けを防止
+ * @update 2026/10/18 - 壁判定をシーン問い合わせへ移行
+ * @update 2026/10/18 - 弾を SlotMap に値で保持（個別の new と erase による詰め直しをやめる）
  ****************************************/
 
 #include "enemy_bullet.h"
 #include "player.h"
-#include "map.h"
+#include "scene_query.h"
 #include "model.h"
 #include "debug_renderer.h"
 #include "trail.h"
-
-#include <vector>
-#include <algorithm>
+#include "fixed_step.h"
+#include "slot_map.h"
 
 using namespace DirectX;
 
 //======================================
-// eNXipj
+// 弾クラス（内部用）
 //======================================
 class EnemyBulletInternal
 {
 private:
     XMFLOAT3 m_Position;
+    XMFLOAT3 m_PrevPosition;    // 直前ステップの位置（描画補間用）
     XMFLOAT3 m_Direction;
     float m_LifeTime;
     bool m_Active;
@@ -31,10 +35,11 @@ private:
 public:
     EnemyBulletInternal(const XMFLOAT3& position, const XMFLOAT3& direction)
         : m_Position(position)
+        , m_PrevPosition(position)
         , m_LifeTime(0.0f)
         , m_Active(true)
     {
-        // 𐳋K
+        // 方向を正規化
         XMStoreFloat3(&m_Direction, XMVector3Normalize(XMLoadFloat3(&direction)));
     }
 
@@ -42,16 +47,17 @@ public:
     {
         if (!m_Active) return;
 
-        // ړ
+        // 移動
+        m_PrevPosition = m_Position;
         XMVECTOR pos = XMLoadFloat3(&m_Position);
         XMVECTOR dir = XMLoadFloat3(&m_Direction);
         pos += dir * EnemyBulletConfig::SPEED * dt;
         XMStoreFloat3(&m_Position, pos);
 
-        // gCiIWFj
+        // トレイル生成（オレンジ色）
         Trail_Create(m_Position, { 1.0f, 0.4f, 0.1f, 0.3f }, 1.5f, 0.8f);
 
-        // `FbN
+        // 寿命チェック
         m_LifeTime += dt;
         if (m_LifeTime >= EnemyBulletConfig::MAX_LIFETIME)
         {
@@ -59,40 +65,57 @@ public:
             return;
         }
 
-        // vC[Ƃ̓蔻
+        // 今ステップの移動経路をスイープして判定（1ステップで壁やプレイヤーを飛び越えないように）
+        XMFLOAT3 displacement;
+        XMStoreFloat3(&displacement, pos - XMLoadFloat3(&m_PrevPosition));
+
+        // マップとの当たり判定（壁に当たったら消える）
+        // 従来どおり弾の中心点で判定し、シーン問い合わせで静的オブジェクトへのスイープを行う
+        const Sphere bulletPoint = { m_PrevPosition, 0.0f };
+        SceneQueryHit wallHit;
+        const bool isWallHit = SceneQuery_SweepSphere(bulletPoint, displacement,
+            SceneQueryFilter(CollisionLayer::Static, SceneObjectType::Static), &wallHit);
+        const float wallTime = isWallHit ? wallHit.distance : 1.0f;
+
+        // プレイヤーとの当たり判定
         XMFLOAT3 playerPos = Player_GetPosition();
-        playerPos.y += 1.0f;  // vC[̒S
+        playerPos.y += 1.0f;  // プレイヤーの中心
 
+        const Sphere bulletSphere = { m_PrevPosition, EnemyBulletConfig::RADIUS };
+        const Sphere playerSphere = { playerPos, EnemyBulletConfig::PLAYER_HIT_RADIUS };
+        SweepHit hitPlayer = Collision_SweepSphereSphere(bulletSphere, displacement, playerSphere, { 0.0f, 0.0f, 0.0f });
+
+        // 到達位置で重なっている場合も従来どおりヒット
         XMVECTOR toPlayer = XMLoadFloat3(&playerPos) - pos;
         float distance = XMVectorGetX(XMVector3Length(toPlayer));
-
         float hitRadius = EnemyBulletConfig::RADIUS + EnemyBulletConfig::PLAYER_HIT_RADIUS;
-        if (distance < hitRadius)
+        const bool isPlayerHit = hitPlayer.isHit || distance < hitRadius;
+        const float playerTime = hitPlayer.isHit ? hitPlayer.time : 1.0f;
+
+        // 壁の手前でプレイヤーに当たった場合のみダメージ
+        if (isPlayerHit && (!isWallHit || playerTime <= wallTime))
         {
-            // qbg
+            // ヒット
             Player_TakeDamage(EnemyBulletConfig::DAMAGE);
             m_Active = false;
             return;
         }
 
-        // }bvƂ̓蔻iǂɓj
-        int mapCount = Map_GetObjectCount();
-        for (int i = 0; i < mapCount; i++)
+        if (isWallHit)
         {
-            AABB aabb = Map_GetObject(i)->Aabb;
-
-            // ȈՔi_AABBj
-            if (m_Position.x >= aabb.min.x && m_Position.x <= aabb.max.x &&
-                m_Position.y >= aabb.min.y && m_Position.y <= aabb.max.y &&
-                m_Position.z >= aabb.min.z && m_Position.z <= aabb.max.z)
-            {
-                m_Active = false;
-                return;
-            }
+            m_Active = false;
+            return;
         }
     }
 
     const XMFLOAT3& GetPosition() const { return m_Position; }
+
+    XMFLOAT3 GetRenderPosition(float alpha) const
+    {
+        XMFLOAT3 result;
+        XMStoreFloat3(&result, XMVectorLerp(XMLoadFloat3(&m_PrevPosition), XMLoadFloat3(&m_Position), alpha));
+        return result;
+    }
     const XMFLOAT3& GetDirection() const { return m_Direction; }
     bool IsActive() const { return m_Active; }
 
@@ -107,31 +130,28 @@ public:
 };
 
 //======================================
-// Ǘpϐ
+// 管理用変数
 //======================================
-static std::vector<EnemyBulletInternal*> g_Bullets;
+static constexpr int ENEMY_BULLET_RESERVE = 256;
+static SlotMap<EnemyBulletInternal> g_Bullets;
 static MODEL* g_pBulletModel = nullptr;
 
 //======================================
-// O[oǗ֐
+// グローバル管理関数
 //======================================
 
 void EnemyBullet_Initialize()
 {
-    g_Bullets.clear();
-    g_Bullets.reserve(256);
+    g_Bullets.Clear();
+    g_Bullets.Reserve(ENEMY_BULLET_RESERVE);
 
-    // TODO: efǂݍ
+    // TODO: 弾モデル読み込み
     // g_pBulletModel = ModelLoad("assets/fbx/enemy_bullet.fbx", 1.0f);
 }
 
 void EnemyBullet_Finalize()
 {
-    for (auto* pBullet : g_Bullets)
-    {
-        delete pBullet;
-    }
-    g_Bullets.clear();
+    g_Bullets.Clear();
 
     if (g_pBulletModel)
     {
@@ -142,30 +162,24 @@ void EnemyBullet_Finalize()
 
 void EnemyBullet_Update(float dt)
 {
-    // SeXV
-    for (auto* pBullet : g_Bullets)
+    // 全弾を更新
+    for (EnemyBulletInternal& bullet : g_Bullets)
     {
-        pBullet->Update(dt);
+        bullet.Update(dt);
     }
 
-    // ANeBuȒe폜
-    for (int i = static_cast<int>(g_Bullets.size()) - 1; i >= 0; i--)
-    {
-        if (!g_Bullets[i]->IsActive())
-        {
-            delete g_Bullets[i];
-            g_Bullets.erase(g_Bullets.begin() + i);
-        }
-    }
+    // 非アクティブな弾を削除
+    g_Bullets.RemoveIf([](const EnemyBulletInternal& bullet) { return !bullet.IsActive(); });
 }
 
 void EnemyBullet_Draw()
 {
-    for (const auto* pBullet : g_Bullets)
+    const float alpha = FixedStep_GetAlpha();
+    for (const EnemyBulletInternal& bullet : g_Bullets)
     {
-        if (!pBullet->IsActive()) continue;
+        if (!bullet.IsActive()) continue;
 
-        XMFLOAT3 pos = pBullet->GetPosition();
+        XMFLOAT3 pos = bullet.GetRenderPosition(alpha);
         XMMATRIX world = XMMatrixTranslation(pos.x, pos.y, pos.z);
 
         if (g_pBulletModel)
@@ -174,7 +188,7 @@ void EnemyBullet_Draw()
         }
         else
         {
-            // fȂꍇ̓fobO`őp
+            // モデルがない場合はデバッグ描画で代用
             Sphere sphere;
             sphere.center = pos;
             sphere.radius = EnemyBulletConfig::RADIUS;
@@ -185,53 +199,49 @@ void EnemyBullet_Draw()
 
 void EnemyBullet_DrawDebug()
 {
-    for (const auto* pBullet : g_Bullets)
+    for (const EnemyBulletInternal& bullet : g_Bullets)
     {
-        if (!pBullet->IsActive()) continue;
+        if (!bullet.IsActive()) continue;
 
         Sphere sphere;
-        sphere.center = pBullet->GetPosition();
+        sphere.center = bullet.GetPosition();
         sphere.radius = EnemyBulletConfig::RADIUS;
         DebugRenderer::DrawSphere(sphere, { 1.0f, 0.3f, 0.0f, 1.0f });
 
-        // is
-        XMFLOAT3 start = pBullet->GetPosition();
+        // 進行方向
+        XMFLOAT3 start = bullet.GetPosition();
         XMFLOAT3 end;
-        XMStoreFloat3(&end, XMLoadFloat3(&start) + XMLoadFloat3(&pBullet->GetDirection()) * 1.0f);
+        XMStoreFloat3(&end, XMLoadFloat3(&start) + XMLoadFloat3(&bullet.GetDirection()) * 1.0f);
         DebugRenderer::DrawLine(start, end, { 1.0f, 1.0f, 0.0f, 1.0f });
     }
 }
 
 void EnemyBullet_Create(const XMFLOAT3& position, const XMFLOAT3& direction)
 {
-    g_Bullets.push_back(new EnemyBulletInternal(position, direction));
+    g_Bullets.Emplace(position, direction);
 }
 
 void EnemyBullet_Clear()
 {
-    for (auto* pBullet : g_Bullets)
-    {
-        delete pBullet;
-    }
-    g_Bullets.clear();
+    g_Bullets.Clear();
 }
 
 int EnemyBullet_GetCount()
 {
-    return static_cast<int>(g_Bullets.size());
+    return static_cast<int>(g_Bullets.Size());
 }
 
 const XMFLOAT3& EnemyBullet_GetPosition(int index)
 {
     static XMFLOAT3 zero = { 0, 0, 0 };
-    if (index < 0 || index >= static_cast<int>(g_Bullets.size()))
+    if (index < 0 || index >= EnemyBullet_GetCount())
         return zero;
-    return g_Bullets[index]->GetPosition();
+    return g_Bullets[index].GetPosition();
 }
 
 AABB EnemyBullet_GetAABB(int index)
 {
-    if (index < 0 || index >= static_cast<int>(g_Bullets.size()))
+    if (index < 0 || index >= EnemyBullet_GetCount())
         return AABB{};
-    return g_Bullets[index]->GetAABB();
+    return g_Bullets[index].GetAABB();
 }
\ No newline at end of file
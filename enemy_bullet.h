@@ -1,6 +1,6 @@
 /****************************************
  * @file enemy_bullet.h
- * @brief G̒e
+ * @brief 敵の弾
  * @author
  * @date 2026/01/10
  ****************************************/
@@ -12,19 +12,19 @@
 #include "collision.h"
 
  //======================================
- // p萔
+ // 調整用定数
  //======================================
 namespace EnemyBulletConfig
 {
-    constexpr float SPEED = 20.0f;           // eiĂ\j
-    constexpr float RADIUS = 0.3f;           // e̔a
-    constexpr float MAX_LIFETIME = 10.0f;    // ő吶ԁibj
-    constexpr int   DAMAGE = 1;              // _[W
-    constexpr float PLAYER_HIT_RADIUS = 1.0f; // vC[蔻蔼a
+    constexpr float SPEED = 20.0f;           // 弾速（見てから回避可能）
+    constexpr float RADIUS = 0.3f;           // 弾の半径
+    constexpr float MAX_LIFETIME = 10.0f;    // 最大生存時間（秒）
+    constexpr int   DAMAGE = 1;              // ダメージ量
+    constexpr float PLAYER_HIT_RADIUS = 1.0f; // プレイヤー当たり判定半径
 }
 
 //======================================
-// O[oǗ֐
+// グローバル管理関数
 //======================================
 void EnemyBullet_Initialize();
 void EnemyBullet_Finalize();
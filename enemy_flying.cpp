@@ -1,9 +1,11 @@
 /****************************************
  * @file enemy_flying.cpp
- * @brief s^G̎
+ * @brief 飛行型敵の実装
  * @author NatsemeShidara
  * @date 2026/01/13
- * @update 2026/01/13 - TEhΉEfobO
+ * @update 2026/01/13 - サウンド対応・デバッグ分離
+ * @update 2026/10/18 - 突進時のすり抜け防止に連続衝突判定を有効化
+ * @update 2026/10/18 - 敵の衝突レイヤーを設定
  ****************************************/
 
 #include "enemy_flying.h"
@@ -25,7 +27,7 @@
 using namespace DirectX;
 
 //======================================
-// 萔in`Փ˗pj
+// 定数（地形衝突用）
 //======================================
 namespace
 {
@@ -33,7 +35,7 @@ namespace
 }
 
 //======================================
-// L\[X
+// 共有リソース
 //======================================
 static MODEL* g_pEnemyFlyingModel = nullptr;
 
@@ -57,7 +59,7 @@ void EnemyFlying_FinalizeShared()
 }
 
 //======================================
-// wp[֐
+// ヘルパー関数
 //======================================
 namespace
 {
@@ -86,7 +88,7 @@ namespace
             MODEL* pModel = const_cast<PhysicsModel*>(pPhysics)->GetModel();
             if (pModel)
             {
-                XMFLOAT4X4 matWorld = pPhysics->GetRigidBody()->GetWorldMatrix(pPhysics->GetScale());
+                XMFLOAT4X4 matWorld = pPhysics->GetRigidBody()->GetRenderWorldMatrix(pPhysics->GetScale());
                 ModelDraw(pModel, XMLoadFloat4x4(&matWorld));
             }
         }
@@ -99,7 +101,7 @@ namespace
             MODEL* pModel = const_cast<PhysicsModel*>(pPhysics)->GetModel();
             if (pModel)
             {
-                XMFLOAT4X4 matWorld = pPhysics->GetRigidBody()->GetWorldMatrix(pPhysics->GetScale());
+                XMFLOAT4X4 matWorld = pPhysics->GetRigidBody()->GetRenderWorldMatrix(pPhysics->GetScale());
                 ModelDrawShadow(pModel, XMLoadFloat4x4(&matWorld));
             }
         }
@@ -155,7 +157,7 @@ namespace
 }
 
 //======================================
-// EnemyFlying 
+// EnemyFlying 実装
 //======================================
 
 EnemyFlying::EnemyFlying(const XMFLOAT3& position)
@@ -172,10 +174,12 @@ EnemyFlying::EnemyFlying(const XMFLOAT3& position)
             ColliderType::Sphere
         );
 
+        m_pPhysics->SetCollisionLayer(CollisionLayer::EnemyPiece, CollisionLayer::All);
         m_pPhysics->GetRigidBody()->SetGravityEnabled(false);
 
         RigidBody::Params params = m_pPhysics->GetRigidBody()->GetParams();
         params.linearDrag = DRAG;
+        params.useContinuousCollision = true;   // 突進速度では壁・プレイヤーをすり抜けうる
         m_pPhysics->GetRigidBody()->SetParams(params);
 
         const Collider& col = m_pPhysics->GetRigidBody()->GetWorldCollider();
@@ -273,7 +277,8 @@ void EnemyFlying::ClampToTerrain()
     if (pos.y < minHeight)
     {
         pos.y = minHeight;
-        SetPosition(pos);
+        m_pPhysics->CorrectPosition(pos);
+        m_Position = pos;
 
         XMFLOAT3 vel = GetVelocity();
         if (vel.y < 0.0f)
@@ -403,7 +408,7 @@ void EnemyFlying::ExecuteCharge(float dt)
 
     ClampToTerrain();
 
-    // OՃGtFNg
+    // 軌跡エフェクト
     XMFLOAT3 pos = GetPosition();
     Trail_Create(pos, { 1.0f, 0.3f, 0.1f, 0.8f }, 0.5f, 0.3);
 }
@@ -422,7 +427,7 @@ bool EnemyFlying::HasReachedChargeTarget() const
 }
 
 //======================================
-// StateHover 
+// StateHover 実装
 //======================================
 
 void EnemyFlying::StateHover::Enter()
@@ -477,7 +482,7 @@ void EnemyFlying::StateHover::DrawDebug() const
 }
 
 //======================================
-// StateWindup 
+// StateWindup 実装
 //======================================
 
 void EnemyFlying::StateWindup::Enter()
@@ -493,7 +498,7 @@ void EnemyFlying::StateWindup::Enter()
     XMStoreFloat3(&vel, vVel);
     pOwner->SetVelocity(vel);
 
-    // ˌSE
+    // 突撃準備SE
     SoundManager_PlaySE(SOUND_SE_FLYING_CHARGE_READY);
 }
 
@@ -545,14 +550,14 @@ void EnemyFlying::StateWindup::DrawDebug() const
 }
 
 //======================================
-// StateCharge 
+// StateCharge 実装
 //======================================
 
 void EnemyFlying::StateCharge::Enter()
 {
     m_StateTimer = 0.0f;
 
-    // ˌSE
+    // 突撃SE
     SoundManager_PlaySE(SOUND_SE_FLYING_CHARGE);
 }
 
@@ -569,7 +574,7 @@ void EnemyFlying::StateCharge::Update(float dt)
 
     pOwner->ExecuteCharge(dt);
 
-    // Ԋuŕ؂艹
+    // 一定間隔で風切り音
     static float whooshTimer = 0.0f;
     whooshTimer += dt;
     if (whooshTimer >= 0.3f)
@@ -606,7 +611,7 @@ void EnemyFlying::StateCharge::DrawDebug() const
 }
 
 //======================================
-// StateRetreat 
+// StateRetreat 実装
 //======================================
 
 void EnemyFlying::StateRetreat::Enter()
@@ -686,7 +691,7 @@ void EnemyFlying::StateRetreat::DrawDebug() const
 }
 
 //======================================
-// StateCooldown 
+// StateCooldown 実装
 //======================================
 
 void EnemyFlying::StateCooldown::Enter()
@@ -745,7 +750,7 @@ void EnemyFlying::StateCooldown::DrawDebug() const
 }
 
 //======================================
-// ؒfʂEnemyFlying𐶐
+// 切断結果からEnemyFlyingを生成
 //======================================
 EnemyFlying* EnemyFlying_CreateFromSlice(const SlicedFlyingEnemyParams& params)
 {
@@ -790,10 +795,12 @@ EnemyFlying* EnemyFlying_CreateFromSlice(const SlicedFlyingEnemyParams& params)
         params.colliderType
     );
 
+    pEnemy->m_pPhysics->SetCollisionLayer(CollisionLayer::EnemyPiece, CollisionLayer::All);
     pEnemy->m_pPhysics->GetRigidBody()->SetGravityEnabled(false);
 
     RigidBody::Params rbParams = pEnemy->m_pPhysics->GetRigidBody()->GetParams();
     rbParams.linearDrag = DRAG;
+    rbParams.useContinuousCollision = true;
     pEnemy->m_pPhysics->GetRigidBody()->SetParams(rbParams);
 
     pEnemy->m_pPhysics->SetRootVolume(params.rootVolume);
@@ -808,7 +815,7 @@ EnemyFlying* EnemyFlying_CreateFromSlice(const SlicedFlyingEnemyParams& params)
 
     ModelRelease(newModel);
 
-    // ؒfSEisGSEgpj
+    // 切断SE（飛行敵も同じSEを使用）
     SoundManager_PlaySE(SOUND_SE_ENEMY_SLICE);
 
     return pEnemy;
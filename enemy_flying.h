@@ -1,10 +1,10 @@
 /****************************************
  * @file enemy_flying.h
- * @brief s^GiˌEPތ^j
+ * @brief 飛行型敵（突撃・撤退型）
  * @detail
- *   - 󒆂zoOȂړ
- *   - vC[ɌēˌU
- *   - U͏֓PނăN[_E
+ *   - 空中をホバリングしながら移動
+ *   - プレイヤーに向かって突撃攻撃
+ *   - 攻撃後は上空へ撤退してクールダウン
  * @author NatsumeShidara
  * @date 2026/01/13
  ****************************************/
@@ -17,62 +17,62 @@
 #include <DirectXMath.h>
 
  //======================================
- // p萔
+ // 調整用定数
  //======================================
 namespace EnemyFlyingConfig
 {
-    // sp[^
-    constexpr float HOVER_HEIGHT_MIN = 8.0f;       // ŒzoOx
-    constexpr float HOVER_HEIGHT_MAX = 15.0f;      // ōzoOx
-    constexpr float HOVER_AMPLITUDE = 1.0f;        // zoO㉺
-    constexpr float HOVER_SPEED = 2.0f;            // zoO㉺x
-    constexpr float HOVER_MOVE_SPEED = 3.0f;       // zoO̐ړx
-
-    // ˌp[^
-    constexpr float CHARGE_SPEED = 24000.0f;          // ˌx
-    constexpr float CHARGE_ACCELERATION = 1000.0f;  // ˌx
-    constexpr float CHARGE_DISTANCE = 3.0f;        // ˌIivC[Ƃ̋j
-    constexpr float CHARGE_WINDUP_TIME = 0.25f;     // ˌO̗ߎ
-    constexpr float CHARGE_MAX_DURATION = 3.0f;    // ˌő厞ԁi^CAEgj
-
-    // Pރp[^
-    constexpr float RETREAT_SPEED = 12.0f;         // Pޑx
-    constexpr float RETREAT_HEIGHT = 12.0f;        // Pގ̖ڕWx
-    constexpr float RETREAT_DISTANCE = 15.0f;      // Pގ̃vC[̋
-    constexpr float RETREAT_DURATION = 1.5f;       // Pގ
-
-    // N[_E
-    constexpr float COOLDOWN_DURATION = 2.0f;      // ̓ˌ܂ł̑ҋ@
-
-    // p[^
-    constexpr float CIRCLE_SPEED = 2.0f;           // 񑬓x
-    constexpr float CIRCLE_RADIUS = 8.0f;          // 񔼌a
-
-    // 
-    constexpr float ATTACK_RANGE = 20.0f;          // UJn
-
-    // p[^
+    // 飛行パラメータ
+    constexpr float HOVER_HEIGHT_MIN = 8.0f;       // 最低ホバリング高度
+    constexpr float HOVER_HEIGHT_MAX = 15.0f;      // 最高ホバリング高度
+    constexpr float HOVER_AMPLITUDE = 1.0f;        // ホバリング上下幅
+    constexpr float HOVER_SPEED = 2.0f;            // ホバリング上下速度
+    constexpr float HOVER_MOVE_SPEED = 3.0f;       // ホバリング中の水平移動速度
+
+    // 突撃パラメータ
+    constexpr float CHARGE_SPEED = 24000.0f;          // 突撃速度
+    constexpr float CHARGE_ACCELERATION = 1000.0f;  // 突撃加速度
+    constexpr float CHARGE_DISTANCE = 3.0f;        // 突撃終了距離（プレイヤーとの距離）
+    constexpr float CHARGE_WINDUP_TIME = 0.25f;     // 突撃前の溜め時間
+    constexpr float CHARGE_MAX_DURATION = 3.0f;    // 突撃最大時間（タイムアウト）
+
+    // 撤退パラメータ
+    constexpr float RETREAT_SPEED = 12.0f;         // 撤退速度
+    constexpr float RETREAT_HEIGHT = 12.0f;        // 撤退時の目標高度
+    constexpr float RETREAT_DISTANCE = 15.0f;      // 撤退時のプレイヤーからの距離
+    constexpr float RETREAT_DURATION = 1.5f;       // 撤退時間
+
+    // クールダウン
+    constexpr float COOLDOWN_DURATION = 2.0f;      // 次の突撃までの待機時間
+
+    // 旋回パラメータ
+    constexpr float CIRCLE_SPEED = 2.0f;           // 旋回速度
+    constexpr float CIRCLE_RADIUS = 8.0f;          // 旋回半径
+
+    // 距離判定
+    constexpr float ATTACK_RANGE = 20.0f;          // 攻撃開始距離
+
+    // 物理パラメータ
     constexpr float MASS = 30.0f;
-    constexpr float DRAG = 5.0f;                   // CR
+    constexpr float DRAG = 5.0f;                   // 空気抵抗
 
-    // ؒfp[^
+    // 切断パラメータ
     constexpr float DEATH_VOLUME_THRESHOLD = 0.95f;
     constexpr float SLICE_SEPARATION_SPEED = 5.0f;
     constexpr float SLICE_OFFSET_DISTANCE = 0.15f;
     constexpr float SLICE_TORQUE_STRENGTH = 10.0f;
     constexpr float SLICE_IMMUNITY_TIME = 0.1f;
 
-    // fpXiFBOXgpj
+    // モデルパス（仮：BOXを使用）
     constexpr const char* MODEL_PATH = "assets/fbx/option_booster/option_booster2.fbx";
     constexpr const wchar_t* TEXTURE_PATH = L"assets/fbx/option_booster/drone_danmen.png";
     constexpr float MODEL_SCALE = 1.8f;
 }
 
-// O錾
+// 前方宣言
 struct SlicedFlyingEnemyParams;
 
 //======================================
-// s^GNX
+// 飛行型敵クラス
 //======================================
 class EnemyFlying : public Enemy
 {
@@ -80,50 +80,51 @@ class EnemyFlying : public Enemy
 
 public:
     //----------------------------------
-    // ԃNXiO錾j
+    // 状態クラス（前方宣言）
     //----------------------------------
-    class StateHover;      // zoOiҋ@Ej
-    class StateWindup;     // ˌO̗
-    class StateCharge;     // ˌ
-    class StateRetreat;    // P
-    class StateCooldown;   // N[_E
+    class StateHover;      // ホバリング（待機・旋回）
+    class StateWindup;     // 突撃前の溜め
+    class StateCharge;     // 突撃
+    class StateRetreat;    // 撤退
+    class StateCooldown;   // クールダウン
 
 private:
     //----------------------------------
-    // f
+    // 物理モデル
     //----------------------------------
     PhysicsModel* m_pPhysics = nullptr;
 
     //----------------------------------
-    // AIp
+    // AI用
     //----------------------------------
     float m_DistanceToPlayer = 0.0f;
-    float m_HoverTimer = 0.0f;           // zoOp^C}[
-    float m_CircleAngle = 0.0f;          // px
-    DirectX::XMFLOAT3 m_ChargeTarget;    // ˌڕWʒu
-    DirectX::XMFLOAT3 m_ChargeDirection; // ˌ
+    float m_HoverTimer = 0.0f;           // ホバリング用タイマー
+    float m_CircleAngle = 0.0f;          // 旋回角度
+    DirectX::XMFLOAT3 m_ChargeTarget;    // 突撃目標位置
+    DirectX::XMFLOAT3 m_ChargeDirection; // 突撃方向
 
 public:
     //----------------------------------
-    // RXgN^/fXgN^
+    // コンストラクタ/デストラクタ
     //----------------------------------
     EnemyFlying(const DirectX::XMFLOAT3& position);
     ~EnemyFlying();
 
-    // Rs[֎~
+    // コピー禁止
     EnemyFlying(const EnemyFlying&) = delete;
     EnemyFlying& operator=(const EnemyFlying&) = delete;
 
     //----------------------------------
-    // I[o[Ch
+    // オーバーライド
     //----------------------------------
     bool IsDestroy() const override;
+    ENEMY_TYPE GetType() const override { return ENEMY_TYPE_FLYING; }
 
     //----------------------------------
-    // PhysicsModelANZT
+    // PhysicsModelアクセサ
     //----------------------------------
-    PhysicsModel* GetPhysicsModel() { return m_pPhysics; }
-    const PhysicsModel* GetPhysicsModel() const { return m_pPhysics; }
+    PhysicsModel* GetPhysicsModel() override { return m_pPhysics; }
+    const PhysicsModel* GetPhysicsModel() const override { return m_pPhysics; }
 
     DirectX::XMFLOAT3 GetPosition() const;
     void SetPosition(const DirectX::XMFLOAT3& pos);
@@ -131,7 +132,7 @@ public:
     void SetVelocity(const DirectX::XMFLOAT3& vel);
 
     //----------------------------------
-    // AIpANZT
+    // AI用アクセサ
     //----------------------------------
     float GetDistanceToPlayer() const { return m_DistanceToPlayer; }
     float& GetHoverTimer() { return m_HoverTimer; }
@@ -140,7 +141,7 @@ public:
     DirectX::XMFLOAT3& GetChargeDirection() { return m_ChargeDirection; }
 
     //----------------------------------
-    // AI
+    // AI処理
     //----------------------------------
     void UpdateDistanceAndFacing();
     void ApplyHoverForce(float dt);
@@ -148,7 +149,7 @@ public:
     void CircleAroundPlayer(float dt);
 
     //----------------------------------
-    // ˌ֘A
+    // 突撃関連
     //----------------------------------
     void PrepareCharge();
     void ExecuteCharge(float dt);
@@ -158,7 +159,7 @@ public:
 };
 
 //======================================
-// ԃNX`
+// 状態クラス定義
 //======================================
 
 class EnemyFlying::StateHover : public Enemy::State
@@ -228,13 +229,13 @@ public:
 };
 
 //======================================
-// L\[XǗ
+// 共有リソース管理
 //======================================
 void EnemyFlying_InitializeShared();
 void EnemyFlying_FinalizeShared();
 
 //======================================
-// ؒfʂ̐
+// 切断結果からの生成
 //======================================
 struct SlicedFlyingEnemyParams
 {
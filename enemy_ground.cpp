@@ -1,15 +1,17 @@
 /****************************************
  * @file enemy_ground.cpp
- * @brief n^G̎iPhysicsModelR|WVŁj
+ * @brief 地上型敵の実装（PhysicsModelコンポジション版）
  * @author Natsume Shidara
  * @date 2026/01/10
- * @update 2026/01/13 - TEhΉ
+ * @update 2026/01/13 - サウンド対応
+ * @update 2026/10/18 - 敵の衝突レイヤーを設定
+ * @update 2026/10/18 - 壁判定をシーン問い合わせへ移行
  ****************************************/
 
 #include "enemy_ground.h"
 #include "enemy_bullet.h"
 #include "player.h"
-#include "map.h"
+#include "scene_query.h"
 #include "debug_renderer.h"
 #include "texture.h"
 #include "collider_generator.h"
@@ -17,11 +19,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cfloat>
 
 using namespace DirectX;
 
 //======================================
-// L\[X
+// 共有リソース
 //======================================
 static MODEL* g_pEnemyGroundModel = nullptr;
 
@@ -45,7 +48,7 @@ void EnemyGround_FinalizeShared()
 }
 
 //======================================
-// wp[֐
+// ヘルパー関数
 //======================================
 namespace
 {
@@ -72,7 +75,7 @@ namespace
             MODEL* pModel = const_cast<PhysicsModel*>(pPhysics)->GetModel();
             if (pModel)
             {
-                XMFLOAT4X4 matWorld = pPhysics->GetRigidBody()->GetWorldMatrix(pPhysics->GetScale());
+                XMFLOAT4X4 matWorld = pPhysics->GetRigidBody()->GetRenderWorldMatrix(pPhysics->GetScale());
                 ModelDraw(pModel, XMLoadFloat4x4(&matWorld));
             }
         }
@@ -128,7 +131,7 @@ namespace
 }
 
 //======================================
-// EnemyGround 
+// EnemyGround 実装
 //======================================
 
 EnemyGround::EnemyGround(const XMFLOAT3& position)
@@ -145,6 +148,8 @@ EnemyGround::EnemyGround(const XMFLOAT3& position)
             ColliderType::Box
         );
 
+        m_pPhysics->SetCollisionLayer(CollisionLayer::EnemyPiece, CollisionLayer::All);
+
         const Collider& col = m_pPhysics->GetRigidBody()->GetWorldCollider();
         float volume = CalculateColliderVolume(col);
         m_pPhysics->SetRootVolume(volume);
@@ -227,7 +232,7 @@ void EnemyGround::FireBullet()
 
     EnemyBullet_Create(firePos, fireDir);
 
-    // SE
+    // 発射SE
     SoundManager_PlaySE(SOUND_SE_ENEMY_FIRE);
 }
 
@@ -271,19 +276,15 @@ bool EnemyGround::CheckWall(const XMFLOAT3& direction, float distance)
     XMFLOAT3 check;
     XMStoreFloat3(&check, checkPos);
 
-    int count = Map_GetObjectCount();
-    for (int i = 0; i < count; i++)
-    {
-        AABB aabb = Map_GetObject(i)->Aabb;
+    // XZ平面での判定のため、高さ方向に無限の柱で近傍を問い合わせる
+    AABB column;
+    column.min = { check.x, -FLT_MAX, check.z };
+    column.max = { check.x, FLT_MAX, check.z };
 
-        if (check.x >= aabb.min.x && check.x <= aabb.max.x &&
-            check.z >= aabb.min.z && check.z <= aabb.max.z)
-        {
-            return true;
-        }
-    }
+    static std::vector<SceneQueryHit> nearbyObjects;
+    SceneQuery_OverlapAABB(column, SceneQueryFilter(CollisionLayer::Static, SceneObjectType::Static), nearbyObjects);
 
-    return false;
+    return !nearbyObjects.empty();
 }
 
 void EnemyGround::Move(const XMFLOAT3& direction, float speed)
@@ -335,7 +336,7 @@ void EnemyGround::CheckVolumeAndDeath()
         {
             if (!m_IsDestroyed)
             {
-                // jSEî݁j
+                // 撃破SE（初回のみ）
                 SoundManager_PlaySE(SOUND_SE_ENEMY_DEATH);
             }
             m_IsDestroyed = true;
@@ -344,7 +345,7 @@ void EnemyGround::CheckVolumeAndDeath()
 }
 
 //======================================
-// StateIdle 
+// StateIdle 実装
 //======================================
 
 void EnemyGround::StateIdle::Update(float dt)
@@ -391,7 +392,7 @@ void EnemyGround::StateIdle::DrawDebug() const
 }
 
 //======================================
-// StateApproach 
+// StateApproach 実装
 //======================================
 
 void EnemyGround::StateApproach::Update(float dt)
@@ -438,7 +439,7 @@ void EnemyGround::StateApproach::DrawDebug() const
 }
 
 //======================================
-// StateAttack 
+// StateAttack 実装
 //======================================
 
 void EnemyGround::StateAttack::Enter()
@@ -504,7 +505,7 @@ void EnemyGround::StateAttack::DrawDebug() const
 }
 
 //======================================
-// StateReload 
+// StateReload 実装
 //======================================
 
 void EnemyGround::StateReload::Update(float dt)
@@ -554,7 +555,7 @@ void EnemyGround::StateReload::DrawDebug() const
 }
 
 //======================================
-// StateRetreat 
+// StateRetreat 実装
 //======================================
 
 void EnemyGround::StateRetreat::Update(float dt)
@@ -596,7 +597,7 @@ void EnemyGround::StateRetreat::DrawDebug() const
 }
 
 //======================================
-// ؒfʂEnemyGround𐶐
+// 切断結果からEnemyGroundを生成
 //======================================
 EnemyGround* EnemyGround_CreateFromSlice(const SlicedEnemyParams& params)
 {
@@ -641,6 +642,7 @@ EnemyGround* EnemyGround_CreateFromSlice(const SlicedEnemyParams& params)
         params.colliderType
     );
 
+    pEnemy->m_pPhysics->SetCollisionLayer(CollisionLayer::EnemyPiece, CollisionLayer::All);
     pEnemy->m_pPhysics->SetRootVolume(params.rootVolume);
 
     pEnemy->m_pPhysics->SetIgnoreCollisionTimer(SLICE_IMMUNITY_TIME);
@@ -653,7 +655,7 @@ EnemyGround* EnemyGround_CreateFromSlice(const SlicedEnemyParams& params)
 
     ModelRelease(newModel);
 
-    // ؒfSE
+    // 切断SE
     SoundManager_PlaySE(SOUND_SE_ENEMY_SLICE);
 
     return pEnemy;
@@ -1,10 +1,10 @@
 /****************************************
  * @file enemy_ground.h
- * @brief n^GiUEǔ^j
+ * @brief 地上型敵（遠距離攻撃・追尾型）
  * @detail
- *   - PhysicsModelR|WVœi+ؒfj
- *   - œKێ悤Ƃ
- *   -   ڋ / œK  ˌ / ߂  
+ *   - PhysicsModelをコンポジションで内包（物理+切断）
+ *   - 最適距離を維持しようとする
+ *   - 遠い → 接近 / 最適距離 → 射撃 / 近い → 後退
  * @author Natsume Shidara
  * @date 2026/01/10
  ****************************************/
@@ -17,58 +17,58 @@
 #include <DirectXMath.h>
 
  //======================================
- // p萔iOJj
+ // 調整用定数（外部公開）
  //======================================
 namespace EnemyGroundConfig
 {
-    // ˌp[^
+    // 射撃パラメータ
     constexpr float ATTACK_DURATION = 5.0f;
     constexpr float RELOAD_DURATION = 0.5f;
     constexpr float FIRE_INTERVAL = 0.2f;
 
-    // 
+    // 距離判定
     constexpr float RANGE_NEAR = 5.0f;
     constexpr float RANGE_FAR = 15.0f;
 
-    // ړx
+    // 移動速度
     constexpr float APPROACH_SPEED = 8.0f;
     constexpr float RETREAT_SPEED = 4.0f;
 
-    // ǔ
+    // 壁判定
     constexpr float WALL_CHECK_DISTANCE = 2.0f;
 
-    // p[^
+    // 物理パラメータ
     constexpr float MASS = 50.0f;
 
-    // ؒfp[^
-    constexpr float DEATH_VOLUME_THRESHOLD = 0.8f;    // 50%ȉŎSi񓙕ŎSj
+    // 切断パラメータ
+    constexpr float DEATH_VOLUME_THRESHOLD = 0.8f;    // 50%以下で死亡（二等分で死亡）
 
-    // p[^i߂荞ݖh~j
-    constexpr float SLICE_SEPARATION_SPEED = 5.0f;    // x
-    constexpr float SLICE_OFFSET_DISTANCE = 0.15f;    // ʒuItZbg
-    constexpr float SLICE_TORQUE_STRENGTH = 8.0f;     // ]gN
-    constexpr float SLICE_IMMUNITY_TIME = 0.3f;       // Փ˖
+    // 分離パラメータ（めり込み防止）
+    constexpr float SLICE_SEPARATION_SPEED = 5.0f;    // 分離速度
+    constexpr float SLICE_OFFSET_DISTANCE = 0.15f;    // 位置オフセット
+    constexpr float SLICE_TORQUE_STRENGTH = 8.0f;     // 回転トルク
+    constexpr float SLICE_IMMUNITY_TIME = 0.3f;       // 衝突無視時間
 
-    // fpX
+    // モデルパス
     constexpr const char* MODEL_PATH = "assets/fbx/BBOXX.fbx";
     constexpr const wchar_t* TEXTURE_PATH = L"assets/fbx/enemy_sl.png";
     constexpr float MODEL_SCALE = 2.0f;
 }
 
-// O錾
+// 前方宣言
 struct SlicedEnemyParams;
 
 //======================================
-// n^GNX
+// 地上型敵クラス
 //======================================
 class EnemyGround : public Enemy
 {
-    // ؒfʂ̐֐privateoւ̃ANZX
+    // 切断結果からの生成関数にprivateメンバへのアクセスを許可
     friend EnemyGround* EnemyGround_CreateFromSlice(const SlicedEnemyParams& params);
 
 public:
     //----------------------------------
-    // ԃNXiO錾j
+    // 状態クラス（前方宣言）
     //----------------------------------
     class StateIdle;
     class StateApproach;
@@ -78,50 +78,51 @@ public:
 
 private:
     //----------------------------------
-    // fiR|WVj
+    // 物理モデル（コンポジション）
     //----------------------------------
     PhysicsModel* m_pPhysics = nullptr;
 
     //----------------------------------
-    // AIp
+    // AI用
     //----------------------------------
     float m_DistanceToPlayer = 0.0f;
     float m_FireTimer = 0.0f;
 
 public:
     //----------------------------------
-    // RXgN^/fXgN^
+    // コンストラクタ/デストラクタ
     //----------------------------------
     EnemyGround(const DirectX::XMFLOAT3& position);
     ~EnemyGround();
 
-    // Rs[֎~
+    // コピー禁止
     EnemyGround(const EnemyGround&) = delete;
     EnemyGround& operator=(const EnemyGround&) = delete;
 
     //----------------------------------
-    // I[o[Ch
+    // オーバーライド
     //----------------------------------
     bool IsDestroy() const override;
+    ENEMY_TYPE GetType() const override { return ENEMY_TYPE_GROUND; }
 
     //----------------------------------
-    // PhysicsModelANZT
+    // PhysicsModelアクセサ
     //----------------------------------
-    PhysicsModel* GetPhysicsModel() { return m_pPhysics; }
-    const PhysicsModel* GetPhysicsModel() const { return m_pPhysics; }
+    PhysicsModel* GetPhysicsModel() override { return m_pPhysics; }
+    const PhysicsModel* GetPhysicsModel() const override { return m_pPhysics; }
 
-    // ʒu̎擾EݒiPhysicsModeloRj
+    // 位置の取得・設定（PhysicsModel経由）
     DirectX::XMFLOAT3 GetPosition() const;
     void SetPosition(const DirectX::XMFLOAT3& pos);
 
     //----------------------------------
-    // AIpANZT
+    // AI用アクセサ
     //----------------------------------
     float GetDistanceToPlayer() const { return m_DistanceToPlayer; }
     float& GetFireTimer() { return m_FireTimer; }
 
     //----------------------------------
-    // AI
+    // AI処理
     //----------------------------------
     void UpdateDistanceAndFacing();
     void FireBullet();
@@ -129,19 +130,19 @@ public:
     bool CheckWall(const DirectX::XMFLOAT3& direction, float distance);
 
     //----------------------------------
-    // ړ
+    // 移動処理
     //----------------------------------
     void Move(const DirectX::XMFLOAT3& direction, float speed);
     void StopMovement();
 
     //----------------------------------
-    // ؒfp
+    // 切断判定用
     //----------------------------------
     void CheckVolumeAndDeath();
 };
 
 //======================================
-// ԃNX`
+// 状態クラス定義
 //======================================
 
 class EnemyGround::StateIdle : public Enemy::State
@@ -195,13 +196,13 @@ public:
 };
 
 //======================================
-// L\[XǗ
+// 共有リソース管理
 //======================================
 void EnemyGround_InitializeShared();
 void EnemyGround_FinalizeShared();
 
 //======================================
-// ؒfʂ̐ipj
+// 切断結果からの生成（内部用）
 //======================================
 struct SlicedEnemyParams
 {
@@ -217,8 +218,8 @@ struct SlicedEnemyParams
 };
 
 /**
- * @brief ؒfʂEnemyGround𐶐
- * @return ꂽEnemyGroundisnullptrj
+ * @brief 切断結果からEnemyGroundを生成
+ * @return 生成されたEnemyGround（失敗時はnullptr）
  */
 EnemyGround* EnemyGround_CreateFromSlice(const SlicedEnemyParams& params);
 
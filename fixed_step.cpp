@@ -0,0 +1,58 @@
+﻿/****************************************
+ * @file fixed_step.cpp
+ * @brief 固定タイムステップ管理の実装
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#include "fixed_step.h"
+#include <algorithm>
+#include <cmath>
+
+//======================================
+// 内部データ
+//======================================
+namespace
+{
+    double g_Accumulator = 0.0;     // 未消化のシミュレーション時間
+}
+
+//======================================
+// 公開関数
+//======================================
+void FixedStep_Reset()
+{
+    g_Accumulator = 0.0;
+}
+
+int FixedStep_Advance(double elapsed_time)
+{
+    using namespace FixedStepConfig;
+
+    g_Accumulator += std::max(elapsed_time, 0.0);
+
+    int steps = 0;
+    while (g_Accumulator >= STEP_TIME && steps < MAX_SUBSTEPS)
+    {
+        g_Accumulator -= STEP_TIME;
+        ++steps;
+    }
+
+    // 処理落ちで追いつけない分は捨て、次フレーム以降に持ち越さない
+    if (g_Accumulator >= STEP_TIME)
+    {
+        g_Accumulator = std::fmod(g_Accumulator, STEP_TIME);
+    }
+
+    return steps;
+}
+
+float FixedStep_GetDeltaTime()
+{
+    return static_cast<float>(FixedStepConfig::STEP_TIME);
+}
+
+float FixedStep_GetAlpha()
+{
+    return static_cast<float>(std::min(g_Accumulator / FixedStepConfig::STEP_TIME, 1.0));
+}
@@ -0,0 +1,44 @@
+﻿/****************************************
+ * @file fixed_step.h
+ * @brief 固定タイムステップ管理
+ * @detail 可変フレーム時間を蓄積し、シミュレーションを一定刻みで進める回数と描画用の補間率を求める
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#ifndef FIXED_STEP_H
+#define FIXED_STEP_H
+
+//======================================
+// 定数定義
+//======================================
+namespace FixedStepConfig
+{
+    constexpr int STEP_RATE = 120;                              // シミュレーション周波数（Hz）
+    constexpr double STEP_TIME = 1.0 / STEP_RATE;
+    constexpr int MAX_SUBSTEPS = 6;                             // 1フレームで進める最大ステップ数（これを超えた分は切り捨て）
+}
+
+/**
+ * @brief 蓄積時間をリセット
+ */
+void FixedStep_Reset();
+
+/**
+ * @brief フレーム時間を蓄積し、このフレームで進めるステップ数を返す
+ * @param elapsed_time 前フレームからの経過時間（秒）
+ * @return 0 ～ MAX_SUBSTEPS
+ */
+int FixedStep_Advance(double elapsed_time);
+
+/**
+ * @brief 1ステップの時間（秒）
+ */
+float FixedStep_GetDeltaTime();
+
+/**
+ * @brief 直前2ステップ間の補間率（0 = 1つ前のステップ、1 = 最新のステップ）
+ */
+float FixedStep_GetAlpha();
+
+#endif // FIXED_STEP_H
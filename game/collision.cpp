@@ -1,6 +1,13 @@
 /****************************************
  * @file    collision.cpp
- * @brief   RWSŁixΉŁj
+ * @brief   コリジョン判定実装完全版（警告対応版）
+ * @update  2026/10/18 - 連続衝突判定用のスイープ判定を追加
+ * @update  2026/10/18 - 解析関数のない組み合わせを GJK / EPA へ委譲
+ * @update  2026/10/18 - OBB 同士の面クリッピングによる複数点接触を追加
+ * @update  2026/10/18 - カプセルと AABB のスイープ判定を追加
+ * @update  2026/10/18 - 平面が OBB をまたぐかの判定と、変換済み AABB の OBB 化を追加
+ * @update  2026/10/18 - 球同士の重なりを半径の和で判定（B の中心が A に入るまで当たらなかった）
+ * @update  2026/10/18 - 球と AABB のスイープを辺・角の丸みまで厳密に（角付近で早く当たっていた）
  *
  ****************************************/
 
@@ -13,11 +20,12 @@
 #include <vector>
 
 #include "collider.h"
+#include "collision_gjk.h"
 
 using namespace DirectX;
 
 // =================================================================
-// 2D / ȈՔ
+// 2D / 簡易判定
 // =================================================================
 
 bool Collision_IsOverlapCircle(const Circle& a, const Circle& b)
@@ -60,24 +68,24 @@ bool Collision_IsOverlapSphere(const Sphere& a, const XMFLOAT3& point)
 }
 
 // =================================================================
-// AABB ڍה
+// AABB 詳細判定
 // =================================================================
 
 Hit Collision_IsHitAABB(const AABB& a, const AABB& b)
 {
     Hit hit{};
 
-    // 1. dȂ`FbN
+    // 1. 重なりチェック
     if (!Collision_IsOverlapAABB(a, b)) return hit;
 
     hit.isHit = true;
 
-    // 2. [xvZ
+    // 2. 深度計算
     float xDepth = std::min(a.max.x, b.max.x) - std::max(a.min.x, b.min.x);
     float yDepth = std::min(a.max.y, b.max.y) - std::max(a.min.y, b.min.y);
     float zDepth = std::min(a.max.z, b.max.z) - std::max(a.min.z, b.min.z);
 
-    // 3. ŏ[x̎I
+    // 3. 最小深度の軸を選択
     bool shallowX = (xDepth <= yDepth && xDepth <= zDepth);
     bool shallowY = (yDepth < xDepth && yDepth <= zDepth);
 
@@ -99,7 +107,7 @@ Hit Collision_IsHitAABB(const AABB& a, const AABB& b)
     }
     XMStoreFloat3(&hit.normal, normal);
 
-    // 4. ړ_vZ (Intersection Volume Center)
+    // 4. 接点計算 (Intersection Volume Center)
     XMVECTOR vMinA = XMLoadFloat3(&a.min);
     XMVECTOR vMaxA = XMLoadFloat3(&a.max);
     XMVECTOR vMinB = XMLoadFloat3(&b.min);
@@ -115,10 +123,10 @@ Hit Collision_IsHitAABB(const AABB& a, const AABB& b)
 }
 
 // =================================================================
-// Op`E ֘Awp[
+// 三角形・球 関連ヘルパー
 // =================================================================
 
-// _ p ƎOp` tri ̍ŋߐړ_߂
+// 点 p と三角形 tri の最近接点を求める
 XMFLOAT3 Collision_ClosestPointTriangle(const XMFLOAT3& point, const Triangle& tri)
 {
     XMVECTOR p = XMLoadFloat3(&point);
@@ -134,7 +142,7 @@ XMFLOAT3 Collision_ClosestPointTriangle(const XMFLOAT3& point, const Triangle& t
     float d2 = XMVectorGetX(XMVector3Dot(ac, ap));
 
     if (d1 <= 0.0f && d2 <= 0.0f) {
-        XMFLOAT3 ret; XMStoreFloat3(&ret, a); return ret; // A_
+        XMFLOAT3 ret; XMStoreFloat3(&ret, a); return ret; // A点
     }
 
     XMVECTOR bp = p - b;
@@ -142,13 +150,13 @@ XMFLOAT3 Collision_ClosestPointTriangle(const XMFLOAT3& point, const Triangle& t
     float d4 = XMVectorGetX(XMVector3Dot(ac, bp));
 
     if (d3 >= 0.0f && d4 <= d3) {
-        XMFLOAT3 ret; XMStoreFloat3(&ret, b); return ret; // B_
+        XMFLOAT3 ret; XMStoreFloat3(&ret, b); return ret; // B点
     }
 
     float vc = d1 * d4 - d3 * d2;
     if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
         float v = d1 / (d1 - d3);
-        XMFLOAT3 ret; XMStoreFloat3(&ret, a + v * ab); return ret; // AB
+        XMFLOAT3 ret; XMStoreFloat3(&ret, a + v * ab); return ret; // AB上
     }
 
     XMVECTOR cp = p - c;
@@ -156,28 +164,28 @@ XMFLOAT3 Collision_ClosestPointTriangle(const XMFLOAT3& point, const Triangle& t
     float d6 = XMVectorGetX(XMVector3Dot(ac, cp));
 
     if (d6 >= 0.0f && d5 <= d6) {
-        XMFLOAT3 ret; XMStoreFloat3(&ret, c); return ret; // C_
+        XMFLOAT3 ret; XMStoreFloat3(&ret, c); return ret; // C点
     }
 
     float vb = d5 * d2 - d1 * d6;
     if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
         float w = d2 / (d2 - d6);
-        XMFLOAT3 ret; XMStoreFloat3(&ret, a + w * ac); return ret; // AC
+        XMFLOAT3 ret; XMStoreFloat3(&ret, a + w * ac); return ret; // AC上
     }
 
     float va = d3 * d6 - d5 * d4;
     if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
         float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
-        XMFLOAT3 ret; XMStoreFloat3(&ret, b + w * (c - b)); return ret; // BC
+        XMFLOAT3 ret; XMStoreFloat3(&ret, b + w * (c - b)); return ret; // BC上
     }
 
     float denom = 1.0f / (va + vb + vc);
     float v = vb * denom;
     float w = vc * denom;
-    XMFLOAT3 ret; XMStoreFloat3(&ret, a + ab * v + ac * w); return ret; // ʓ
+    XMFLOAT3 ret; XMStoreFloat3(&ret, a + ab * v + ac * w); return ret; // 面内部
 }
 
-//  vs Op`
+// 球 vs 三角形
 Hit Collision_IsHitSphereTriangle(const Sphere& sphere, const Triangle& tri)
 {
     Hit hit = {};
@@ -210,10 +218,10 @@ Hit Collision_IsHitSphereTriangle(const Sphere& sphere, const Triangle& tri)
 }
 
 // =================================================================
-// SAT (OBB) wp[֐
+// SAT (OBB) ヘルパー関数
 // =================================================================
 
-//  axis ł OBB ̓eavZ
+// 軸 axis 上での OBB の投影半径を計算
 static float GetOBBProjectedRadius(const XMVECTOR& axis, const XMVECTOR& u0, const XMVECTOR& u1, const XMVECTOR& u2, const XMFLOAT3& extents)
 {
     return extents.x * std::abs(XMVectorGetX(XMVector3Dot(axis, u0))) +
@@ -274,7 +282,7 @@ Hit Collision_IsHitOBBTriangle(const OBB& obb, const Triangle& tri)
     hit.isHit = false;
     hit.depth = FLT_MAX;
 
-    // 1. f[^
+    // 1. データ準備
     XMVECTOR obbCenter = XMLoadFloat3(&obb.center);
     XMMATRIX obbRot = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.orientation));
     XMVECTOR u0 = obbRot.r[0];
@@ -286,7 +294,7 @@ Hit Collision_IsHitOBBTriangle(const OBB& obb, const Triangle& tri)
     XMVECTOR v2 = XMLoadFloat3(&tri.p2);
     XMVECTOR triNorm = XMLoadFloat3(&tri.normal);
 
-    // : OBB(3) + ʖ@(1) + GbWO(9) = 13{
+    // 軸: OBB軸(3) + 面法線(1) + エッジ外積(9) = 13本
     XMVECTOR e0 = v1 - v0;
     XMVECTOR e1 = v2 - v1;
     XMVECTOR e2 = v0 - v2;
@@ -300,7 +308,7 @@ Hit Collision_IsHitOBBTriangle(const OBB& obb, const Triangle& tri)
 
     int bestAxis = -1;
 
-    // 2. eXg
+    // 2. 分離軸テスト
     for (int i = 0; i < 13; i++)
     {
         XMVECTOR axis = axes[i];
@@ -315,10 +323,10 @@ Hit Collision_IsHitOBBTriangle(const OBB& obb, const Triangle& tri)
         float triMin, triMax;
         GetTriangleProjection(axis, v0, v1, v2, triMin, triMax);
 
-        // dȂȂ -> 
+        // 重なりなし -> 分離
         if (obbMax < triMin || triMax < obbMin) return hit;
 
-        // dȂ
+        // 重なり量
         float o1 = obbMax - triMin;
         float o2 = triMax - obbMin;
         float overlap;
@@ -341,7 +349,7 @@ Hit Collision_IsHitOBBTriangle(const OBB& obb, const Triangle& tri)
     hit.isHit = true;
     XMVECTOR vNormal = XMLoadFloat3(&hit.normal);
 
-    // 3. ڐG_
+    // 3. 接触点推定
     XMVECTOR contactVec = XMVectorZero();
 
     if (bestAxis == 3) { // Face: Triangle
@@ -391,7 +399,7 @@ Hit Collision_IsHitOBBTriangle(const OBB& obb, const Triangle& tri)
 }
 
 // =================================================================
-// C (Ray)
+// レイ判定 (Ray)
 // =================================================================
 
 bool Collision_IntersectRaySphere(const Ray& ray, const Sphere& sphere, float* outDist)
@@ -510,7 +518,7 @@ Hit Collision_IsHitSphereOBB(const Sphere& sphere, const OBB& obb)
 }
 
 // =================================================================
-// OBB vs OBB (SAT: 15)
+// OBB vs OBB (SAT: 15軸判定)
 // =================================================================
 Hit Collision_IsHitOBBOBB(const OBB& a, const OBB& b)
 {
@@ -529,11 +537,11 @@ Hit Collision_IsHitOBBOBB(const OBB& a, const OBB& b)
     XMVECTOR axes[15];
     int axisCount = 0;
 
-    // ʖ@ (6{)
+    // 面法線 (6本)
     for (int i = 0; i < 3; i++) axes[axisCount++] = uA[i];
     for (int i = 0; i < 3; i++) axes[axisCount++] = uB[i];
 
-    // GbWO (9{)
+    // エッジ外積 (9本)
     for (int i = 0; i < 3; i++) {
         for (int j = 0; j < 3; j++) {
             XMVECTOR cross = XMVector3Cross(uA[i], uB[j]);
@@ -586,30 +594,588 @@ Hit Collision_IsHitOBBOBB(const OBB& a, const OBB& b)
 // =================================================================
 Hit Collision_IsHitOBBAABB(const OBB& obb, const AABB& aabb)
 {
-    // AABB ][ OBB ɕϊ
+    // AABB を回転ゼロの OBB に変換する
     OBB aabbAsObb;
 
-    // SW
+    // 中心座標
     aabbAsObb.center = aabb.GetCenter();
 
-    // extents (n[tTCY)
+    // extents (ハーフサイズ)
     XMVECTOR vMin = XMLoadFloat3(&aabb.min);
     XMVECTOR vMax = XMLoadFloat3(&aabb.max);
     XMVECTOR vSize = vMax - vMin;
     XMStoreFloat3(&aabbAsObb.extents, vSize * 0.5f);
 
-    // ] (Identity Quaternion: ]Ȃ)
+    // 回転 (Identity Quaternion: 回転なし)
     aabbAsObb.orientation = XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f);
 
-    //  OBB vs OBB (SAT) ɓ
+    // 既存の OBB vs OBB (SAT) に投げる
     return Collision_IsHitOBBOBB(obb, aabbAsObb);
 }
 
 // =================================================================
-// JvZp[eBeB֐
+// OBB 接触面クリッピング（複数点マニフォールド）
 // =================================================================
 
-// ̍ŋߐړ_߂
+namespace
+{
+    // 面接触とみなす、面法線と接触法線の一致度（cos）
+    constexpr float CLIP_FACE_ALIGNMENT = 0.9f;
+    // 一致度の差がこれ以下なら A 側を参照面にする（フレーム間で参照面が入れ替わるのを防ぐ）
+    constexpr float CLIP_REFERENCE_TOLERANCE = 0.001f;
+    // 参照面より外側でもこの距離までは接触点として残す
+    constexpr float CLIP_SEPARATION_TOLERANCE = 0.005f;
+    // クリップ後の多角形の最大頂点数（四角形を4平面で切ると最大8）
+    constexpr int CLIP_MAX_POLYGON = 8;
+
+    struct ClipBox
+    {
+        XMVECTOR center;
+        XMVECTOR axes[3];
+        float extents[3];
+    };
+
+    ClipBox MakeClipBox(const OBB& obb)
+    {
+        ClipBox box;
+        XMMATRIX rot = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.orientation));
+        box.center = XMLoadFloat3(&obb.center);
+        box.axes[0] = rot.r[0];
+        box.axes[1] = rot.r[1];
+        box.axes[2] = rot.r[2];
+        box.extents[0] = obb.extents.x;
+        box.extents[1] = obb.extents.y;
+        box.extents[2] = obb.extents.z;
+        return box;
+    }
+
+    // 方向 dir と最も平行な面（軸番号と符号）を求め、一致度を返す
+    float FindAlignedFace(const ClipBox& box, FXMVECTOR dir, int& outAxis, float& outSign)
+    {
+        float best = -1.0f;
+        for (int i = 0; i < 3; ++i)
+        {
+            float d = XMVectorGetX(XMVector3Dot(box.axes[i], dir));
+            if (std::abs(d) > best)
+            {
+                best = std::abs(d);
+                outAxis = i;
+                outSign = (d >= 0.0f) ? 1.0f : -1.0f;
+            }
+        }
+        return best;
+    }
+
+    // 面の4頂点を周回順に取得
+    void GetFaceVertices(const ClipBox& box, int axis, float sign, XMVECTOR out[4])
+    {
+        int u = (axis + 1) % 3;
+        int v = (axis + 2) % 3;
+        XMVECTOR faceCenter = box.center + box.axes[axis] * (sign * box.extents[axis]);
+        XMVECTOR du = box.axes[u] * box.extents[u];
+        XMVECTOR dv = box.axes[v] * box.extents[v];
+
+        out[0] = faceCenter + du + dv;
+        out[1] = faceCenter - du + dv;
+        out[2] = faceCenter - du - dv;
+        out[3] = faceCenter + du - dv;
+    }
+
+    // dot(planeNormal, p) <= planeOffset 側を残す Sutherland-Hodgman クリップ
+    int ClipPolygon(const XMVECTOR* in, int inCount, FXMVECTOR planeNormal, float planeOffset, XMVECTOR* out)
+    {
+        int outCount = 0;
+        if (inCount == 0) return 0;
+
+        XMVECTOR prev = in[inCount - 1];
+        float prevDist = XMVectorGetX(XMVector3Dot(planeNormal, prev)) - planeOffset;
+
+        for (int i = 0; i < inCount; ++i)
+        {
+            XMVECTOR curr = in[i];
+            float currDist = XMVectorGetX(XMVector3Dot(planeNormal, curr)) - planeOffset;
+
+            if ((prevDist <= 0.0f) != (currDist <= 0.0f) && outCount < CLIP_MAX_POLYGON)
+            {
+                float t = prevDist / (prevDist - currDist);
+                out[outCount++] = XMVectorLerp(prev, curr, t);
+            }
+            if (currDist <= 0.0f && outCount < CLIP_MAX_POLYGON)
+            {
+                out[outCount++] = curr;
+            }
+
+            prev = curr;
+            prevDist = currDist;
+        }
+        return outCount;
+    }
+
+    // 接触点を最大4点へ間引く（最深点 → 最遠点 → 三角形最大 → 三角形の外側に最も離れた点）
+    int ReduceContactPoints(const XMVECTOR* points, const float* depths, int count, FXMVECTOR normal, int outIndices[ContactSet::MAX_POINTS])
+    {
+        if (count <= ContactSet::MAX_POINTS)
+        {
+            for (int i = 0; i < count; ++i) outIndices[i] = i;
+            return count;
+        }
+
+        int i0 = 0;
+        for (int i = 1; i < count; ++i)
+        {
+            if (depths[i] > depths[i0]) i0 = i;
+        }
+
+        int i1 = -1;
+        float best = -1.0f;
+        for (int i = 0; i < count; ++i)
+        {
+            if (i == i0) continue;
+            float d = XMVectorGetX(XMVector3LengthSq(points[i] - points[i0]));
+            if (d > best) { best = d; i1 = i; }
+        }
+
+        int i2 = -1;
+        best = -1.0f;
+        for (int i = 0; i < count; ++i)
+        {
+            if (i == i0 || i == i1) continue;
+            float area = std::abs(XMVectorGetX(XMVector3Dot(XMVector3Cross(points[i1] - points[i0], points[i] - points[i0]), normal)));
+            if (area > best) { best = area; i2 = i; }
+        }
+
+        // 三角形の向きを法線に揃え、各辺の外側への張り出しが最大の点を選ぶ
+        XMVECTOR triNormal = XMVector3Cross(points[i1] - points[i0], points[i2] - points[i0]);
+        const int tri[3] = { i0, i1, i2 };
+        int i3 = -1;
+        best = -FLT_MAX;
+        for (int i = 0; i < count; ++i)
+        {
+            if (i == i0 || i == i1 || i == i2) continue;
+            float outside = 0.0f;
+            for (int e = 0; e < 3; ++e)
+            {
+                XMVECTOR a = points[tri[e]];
+                XMVECTOR b = points[tri[(e + 1) % 3]];
+                float signedArea = XMVectorGetX(XMVector3Dot(XMVector3Cross(b - a, points[i] - a), triNormal));
+                outside = std::max(outside, -signedArea);
+            }
+            if (outside > best) { best = outside; i3 = i; }
+        }
+
+        outIndices[0] = i0;
+        outIndices[1] = i1;
+        outIndices[2] = i2;
+        outIndices[3] = i3;
+        return ContactSet::MAX_POINTS;
+    }
+
+    OBB MakeOBBFromAABB(const AABB& aabb)
+    {
+        OBB obb;
+        obb.center = aabb.GetCenter();
+        XMStoreFloat3(&obb.extents, (XMLoadFloat3(&aabb.max) - XMLoadFloat3(&aabb.min)) * 0.5f);
+        obb.orientation = XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f);
+        return obb;
+    }
+}
+
+ContactSet Collision_ClipOBBOBB(const OBB& a, const OBB& b)
+{
+    ContactSet result;
+
+    // 法線と深さは SAT で決める
+    Hit hit = Collision_IsHitOBBOBB(a, b);
+    if (!hit.isHit) return result;
+
+    // 辺同士の接触など面が決まらない場合に使う1点の結果
+    ContactSet single;
+    single.count = 1;
+    single.normal = hit.normal;
+    single.points[0] = hit.contactPoint;
+    single.depths[0] = hit.depth;
+
+    ClipBox boxA = MakeClipBox(a);
+    ClipBox boxB = MakeClipBox(b);
+    XMVECTOR n = XMLoadFloat3(&hit.normal);     // B→A
+
+    // 参照面の候補：A は B を向く面（-n）、B は A を向く面（+n）
+    int axisA = 0, axisB = 0;
+    float signA = 1.0f, signB = 1.0f;
+    float alignA = FindAlignedFace(boxA, -n, axisA, signA);
+    float alignB = FindAlignedFace(boxB, n, axisB, signB);
+
+    if (std::max(alignA, alignB) < CLIP_FACE_ALIGNMENT) return single;
+
+    const bool referenceIsA = (alignA + CLIP_REFERENCE_TOLERANCE >= alignB);
+    const ClipBox& refBox = referenceIsA ? boxA : boxB;
+    const ClipBox& incBox = referenceIsA ? boxB : boxA;
+    const int refAxis = referenceIsA ? axisA : axisB;
+    const float refSign = referenceIsA ? signA : signB;
+
+    XMVECTOR refNormal = refBox.axes[refAxis] * refSign;   // 参照面の外向き法線
+
+    // 入射面：相手の面のうち参照面法線と最も逆向きのもの
+    int incAxis = 0;
+    float incSign = 1.0f;
+    FindAlignedFace(incBox, -refNormal, incAxis, incSign);
+
+    XMVECTOR polygon[CLIP_MAX_POLYGON];
+    XMVECTOR clipped[CLIP_MAX_POLYGON];
+    GetFaceVertices(incBox, incAxis, incSign, polygon);
+    int count = 4;
+
+    // 参照面の側面4枚で入射面を切り取る
+    for (int k = 1; k <= 2 && count > 0; ++k)
+    {
+        int side = (refAxis + k) % 3;
+        XMVECTOR axis = refBox.axes[side];
+        float centerDist = XMVectorGetX(XMVector3Dot(axis, refBox.center));
+        float extent = refBox.extents[side];
+
+        count = ClipPolygon(polygon, count, axis, centerDist + extent, clipped);
+        count = ClipPolygon(clipped, count, -axis, -centerDist + extent, polygon);
+    }
+
+    // 参照面より内側の点を接触点とする（接触点は両面の中点）
+    float refOffset = XMVectorGetX(XMVector3Dot(refNormal, refBox.center)) + refBox.extents[refAxis];
+    XMVECTOR points[CLIP_MAX_POLYGON];
+    float depths[CLIP_MAX_POLYGON];
+    int pointCount = 0;
+
+    for (int i = 0; i < count; ++i)
+    {
+        float separation = XMVectorGetX(XMVector3Dot(refNormal, polygon[i])) - refOffset;
+        if (separation > CLIP_SEPARATION_TOLERANCE) continue;
+
+        points[pointCount] = polygon[i] - refNormal * (separation * 0.5f);
+        depths[pointCount] = -separation;
+        ++pointCount;
+    }
+
+    if (pointCount == 0) return single;
+
+    // 法線は参照面の法線を B→A に揃えて使う
+    XMVECTOR outNormal = referenceIsA ? -refNormal : refNormal;
+
+    int indices[ContactSet::MAX_POINTS];
+    result.count = ReduceContactPoints(points, depths, pointCount, outNormal, indices);
+    XMStoreFloat3(&result.normal, outNormal);
+    for (int i = 0; i < result.count; ++i)
+    {
+        XMStoreFloat3(&result.points[i], points[indices[i]]);
+        result.depths[i] = depths[indices[i]];
+    }
+
+    return result;
+}
+
+ContactSet Collision_ClipOBBAABB(const OBB& obb, const AABB& aabb)
+{
+    return Collision_ClipOBBOBB(obb, MakeOBBFromAABB(aabb));
+}
+
+// =================================================================
+// OBB を包む AABB
+// =================================================================
+AABB Collision_GetOBBBounds(const OBB& obb)
+{
+    // 各ワールド軸への投影半径 = |R| * extents
+    XMMATRIX rot = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.orientation));
+    XMVECTOR e = XMLoadFloat3(&obb.extents);
+
+    XMVECTOR half = XMVectorAbs(rot.r[0]) * XMVectorSplatX(e)
+                  + XMVectorAbs(rot.r[1]) * XMVectorSplatY(e)
+                  + XMVectorAbs(rot.r[2]) * XMVectorSplatZ(e);
+
+    XMVECTOR c = XMLoadFloat3(&obb.center);
+
+    AABB result;
+    XMStoreFloat3(&result.min, c - half);
+    XMStoreFloat3(&result.max, c + half);
+    return result;
+}
+
+OBB Collision_TransformAABB(const AABB& localAABB, const XMFLOAT4X4& world)
+{
+    XMMATRIX mtx = XMLoadFloat4x4(&world);
+
+    XMVECTOR localMin = XMLoadFloat3(&localAABB.min);
+    XMVECTOR localMax = XMLoadFloat3(&localAABB.max);
+    XMVECTOR localCenter = (localMin + localMax) * 0.5f;
+    XMVECTOR localHalf = (localMax - localMin) * 0.5f;
+
+    // 各行の長さが軸ごとの拡大率、正規化した行が回転
+    XMVECTOR scale = XMVectorSet(
+        XMVectorGetX(XMVector3Length(mtx.r[0])),
+        XMVectorGetX(XMVector3Length(mtx.r[1])),
+        XMVectorGetX(XMVector3Length(mtx.r[2])), 0.0f);
+
+    XMMATRIX rotMtx = XMMatrixIdentity();
+    for (int i = 0; i < 3; ++i)
+    {
+        if (XMVectorGetByIndex(scale, i) > 1e-6f)
+        {
+            rotMtx.r[i] = XMVector3Normalize(XMVectorSetW(mtx.r[i], 0.0f));
+        }
+    }
+    XMVECTOR rotation = XMQuaternionRotationMatrix(rotMtx);
+
+    OBB result;
+    XMStoreFloat3(&result.center, XMVector3TransformCoord(localCenter, mtx));
+    XMStoreFloat3(&result.extents, XMVectorAbs(localHalf * scale));
+    XMStoreFloat4(&result.orientation, XMQuaternionNormalize(rotation));
+    return result;
+}
+
+bool Collision_IsOBBStraddlingPlane(const OBB& obb, const XMFLOAT3& planePoint, const XMFLOAT3& planeNormal, float margin)
+{
+    XMMATRIX rot = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.orientation));
+    XMVECTOR n = XMVector3Normalize(XMLoadFloat3(&planeNormal));
+
+    // 平面法線への投影半径と、中心の符号付き距離
+    float radius = obb.extents.x * std::fabs(XMVectorGetX(XMVector3Dot(rot.r[0], n)))
+                 + obb.extents.y * std::fabs(XMVectorGetX(XMVector3Dot(rot.r[1], n)))
+                 + obb.extents.z * std::fabs(XMVectorGetX(XMVector3Dot(rot.r[2], n)));
+    float distance = XMVectorGetX(XMVector3Dot(XMLoadFloat3(&obb.center) - XMLoadFloat3(&planePoint), n));
+
+    // 両側に margin 以上はみ出していれば平面をまたぐ
+    return std::fabs(distance) < radius - margin;
+}
+
+// =================================================================
+// スイープ判定（連続衝突判定）
+// =================================================================
+
+namespace
+{
+    // 辺・角の丸みに対するニュートン法の反復上限（かすめる入力以外は数回で収束する）
+    constexpr int SWEEP_ROUNDED_ITERATIONS = 16;
+    // 最近点までの距離と半径の差がこれ以下なら接触とみなす
+    constexpr float SWEEP_ROUNDED_TOLERANCE = 1e-5f;
+}
+
+// 半径分膨らませた AABB に対するスラブ判定で進入時刻を求め、
+// 辺・角の近傍では箱の最近点までの距離が半径になる時刻をニュートン法で詰める（丸めた箱に対して厳密）
+SweepHit Collision_SweepSphereAABB(const Sphere& sphere, const XMFLOAT3& displacement, const AABB& aabb)
+{
+    SweepHit result;
+
+    const float origin[3] = { sphere.center.x, sphere.center.y, sphere.center.z };
+    const float dir[3] = { displacement.x, displacement.y, displacement.z };
+    const float aabbMin[3] = { aabb.min.x, aabb.min.y, aabb.min.z };
+    const float aabbMax[3] = { aabb.max.x, aabb.max.y, aabb.max.z };
+    const float radius = sphere.radius;
+
+    // 点から箱の最近点へのオフセット（箱の外なら長さが距離、内側なら 0）
+    auto offsetFromBox = [&](const float point[3], float out[3])
+    {
+        float lengthSq = 0.0f;
+        for (int i = 0; i < 3; ++i)
+        {
+            out[i] = point[i] - std::clamp(point[i], aabbMin[i], aabbMax[i]);
+            lengthSq += out[i] * out[i];
+        }
+        return lengthSq;
+    };
+
+    // 開始時点で既に接している場合は、接触面へ向かって動いているときだけ当たりとする
+    float offset[3];
+    const float startDistSq = offsetFromBox(origin, offset);
+    if (startDistSq < radius * radius)
+    {
+        float n[3] = { 0.0f, 0.0f, 0.0f };
+        if (startDistSq > 1e-12f)
+        {
+            const float invDist = 1.0f / std::sqrt(startDistSq);
+            for (int i = 0; i < 3; ++i) n[i] = offset[i] * invDist;
+        }
+        else
+        {
+            // 中心が箱の内側なら最も浅い面
+            int bestAxis = 0;
+            float bestSign = 1.0f;
+            float bestDepth = FLT_MAX;
+            for (int i = 0; i < 3; ++i)
+            {
+                const float toMin = origin[i] - aabbMin[i];
+                const float toMax = aabbMax[i] - origin[i];
+                if (toMin < bestDepth) { bestDepth = toMin; bestAxis = i; bestSign = -1.0f; }
+                if (toMax < bestDepth) { bestDepth = toMax; bestAxis = i; bestSign = 1.0f; }
+            }
+            n[bestAxis] = bestSign;
+        }
+        if (dir[0] * n[0] + dir[1] * n[1] + dir[2] * n[2] >= 0.0f) return result;
+
+        result.isHit = true;
+        result.time = 0.0f;
+        result.normal = { n[0], n[1], n[2] };
+        return result;
+    }
+
+    float tEnter = 0.0f;
+    float tExit = 1.0f;
+    int enterAxis = -1;
+    float enterSign = 0.0f;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const float boxMin = aabbMin[i] - radius;
+        const float boxMax = aabbMax[i] + radius;
+        if (std::abs(dir[i]) < 1e-6f)
+        {
+            if (origin[i] < boxMin || origin[i] > boxMax) return result;
+            continue;
+        }
+
+        const float inv = 1.0f / dir[i];
+        float t1 = (boxMin - origin[i]) * inv;
+        float t2 = (boxMax - origin[i]) * inv;
+        // 進入面の法線は移動方向と逆向き
+        float sign = -1.0f;
+        if (t1 > t2) { std::swap(t1, t2); sign = 1.0f; }
+
+        if (t1 > tEnter) { tEnter = t1; enterAxis = i; enterSign = sign; }
+        tExit = std::min(tExit, t2);
+        if (tEnter > tExit) return result;
+    }
+
+    // 進入点が元の箱の1軸だけ外側なら面に当たっている
+    float point[3];
+    int outsideCount = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        point[i] = origin[i] + dir[i] * tEnter;
+        if (point[i] < aabbMin[i] || point[i] > aabbMax[i]) ++outsideCount;
+    }
+    if (enterAxis >= 0 && outsideCount <= 1)
+    {
+        float n[3] = { 0.0f, 0.0f, 0.0f };
+        n[enterAxis] = enterSign;
+        result.isHit = true;
+        result.time = tEnter;
+        result.normal = { n[0], n[1], n[2] };
+        return result;
+    }
+
+    // 辺・角の領域：最近点までの距離 - 半径は t について凸なので、
+    // 進入側からのニュートン法は根を越えずに単調に近づく
+    float t = tEnter;
+    for (int iteration = 0; iteration < SWEEP_ROUNDED_ITERATIONS; ++iteration)
+    {
+        for (int i = 0; i < 3; ++i) point[i] = origin[i] + dir[i] * t;
+        const float dist = std::sqrt(offsetFromBox(point, offset));
+        const float gap = dist - radius;
+        if (dist <= 0.0f) return result;
+
+        const float invDist = 1.0f / dist;
+        if (gap <= SWEEP_ROUNDED_TOLERANCE)
+        {
+            result.isHit = true;
+            result.time = t;
+            result.normal = { offset[0] * invDist, offset[1] * invDist, offset[2] * invDist };
+            return result;
+        }
+
+        // 距離が縮まらなくなった＝最接近でも半径に届かない
+        const float slope = (dir[0] * offset[0] + dir[1] * offset[1] + dir[2] * offset[2]) * invDist;
+        if (slope >= -1e-8f) return result;
+
+        t -= gap / slope;
+        if (t > tExit) return result;
+    }
+    return result;
+}
+
+// OBB のローカル空間へ移して AABB 版に委ねる
+SweepHit Collision_SweepSphereOBB(const Sphere& sphere, const XMFLOAT3& displacement, const OBB& obb)
+{
+    XMVECTOR q = XMLoadFloat4(&obb.orientation);
+    XMVECTOR toCenter = XMLoadFloat3(&sphere.center) - XMLoadFloat3(&obb.center);
+
+    Sphere localSphere;
+    XMStoreFloat3(&localSphere.center, XMVector3InverseRotate(toCenter, q));
+    localSphere.radius = sphere.radius;
+
+    XMFLOAT3 localDisplacement;
+    XMStoreFloat3(&localDisplacement, XMVector3InverseRotate(XMLoadFloat3(&displacement), q));
+
+    AABB localBox;
+    localBox.min = { -obb.extents.x, -obb.extents.y, -obb.extents.z };
+    localBox.max = obb.extents;
+
+    SweepHit result = Collision_SweepSphereAABB(localSphere, localDisplacement, localBox);
+    if (result.isHit)
+    {
+        XMStoreFloat3(&result.normal, XMVector3Rotate(XMLoadFloat3(&result.normal), q));
+    }
+    return result;
+}
+
+// 相対運動で |s + v*t| = rA + rB を解く（法線は B→A）
+SweepHit Collision_SweepSphereSphere(const Sphere& a, const XMFLOAT3& displacementA,
+    const Sphere& b, const XMFLOAT3& displacementB)
+{
+    SweepHit result;
+
+    XMVECTOR s = XMLoadFloat3(&a.center) - XMLoadFloat3(&b.center);
+    XMVECTOR v = XMLoadFloat3(&displacementA) - XMLoadFloat3(&displacementB);
+    const float radius = a.radius + b.radius;
+
+    const float qa = XMVectorGetX(XMVector3Dot(v, v));
+    const float qb = XMVectorGetX(XMVector3Dot(s, v));
+    const float qc = XMVectorGetX(XMVector3Dot(s, s)) - radius * radius;
+
+    // 離れていく、または相対移動なし
+    if (qb >= 0.0f || qa < 1e-8f) return result;
+
+    if (qc <= 0.0f)
+    {
+        // 既に重なっていて近づいている
+        result.isHit = true;
+        result.time = 0.0f;
+        XMStoreFloat3(&result.normal, XMVector3Normalize(s));
+        return result;
+    }
+
+    const float discriminant = qb * qb - qa * qc;
+    if (discriminant < 0.0f) return result;
+
+    const float t = (-qb - std::sqrt(discriminant)) / qa;
+    if (t < 0.0f || t > 1.0f) return result;
+
+    result.isHit = true;
+    result.time = t;
+    XMStoreFloat3(&result.normal, XMVector3Normalize(s + v * t));
+    return result;
+}
+
+// 線分の広がりだけ AABB を膨らませ、中心の球のスイープに帰着させる
+// （軸に平行なカプセルでは厳密、傾いたカプセルでは保守的に早く当たる）
+SweepHit Collision_SweepCapsuleAABB(const Capsule& capsule, const XMFLOAT3& displacement, const AABB& aabb)
+{
+    const XMFLOAT3 halfSegment = {
+        std::abs(capsule.end.x - capsule.start.x) * 0.5f,
+        std::abs(capsule.end.y - capsule.start.y) * 0.5f,
+        std::abs(capsule.end.z - capsule.start.z) * 0.5f
+    };
+
+    Sphere sphere;
+    sphere.center = capsule.GetCenter();
+    sphere.radius = capsule.radius;
+
+    AABB expanded;
+    expanded.min = { aabb.min.x - halfSegment.x, aabb.min.y - halfSegment.y, aabb.min.z - halfSegment.z };
+    expanded.max = { aabb.max.x + halfSegment.x, aabb.max.y + halfSegment.y, aabb.max.z + halfSegment.z };
+
+    return Collision_SweepSphereAABB(sphere, displacement, expanded);
+}
+
+// =================================================================
+// カプセル用ユーティリティ関数
+// =================================================================
+
+// 線分上の最近接点を求める
 XMFLOAT3 Collision_ClosestPointOnSegment(const XMFLOAT3& point,
     const XMFLOAT3& segStart,
     const XMFLOAT3& segEnd)
@@ -627,7 +1193,7 @@ XMFLOAT3 Collision_ClosestPointOnSegment(const XMFLOAT3& point,
     return result;
 }
 
-// Ɛ̍ŒZvZiIvVŃp[^s,tԂj
+// 線分と線分の最短距離を計算（オプションでパラメータs,tを返す）
 float Collision_DistanceSegmentSegment(const XMFLOAT3& p1, const XMFLOAT3& q1,
     const XMFLOAT3& p2, const XMFLOAT3& q2,
     float* outS, float* outT)
@@ -647,7 +1213,7 @@ float Collision_DistanceSegmentSegment(const XMFLOAT3& p1, const XMFLOAT3& q1,
 
     float s = 0.0f, t = 0.0f;
 
-    // _̏ꍇ
+    // 両方が点の場合
     if (a <= 1e-6f && e <= 1e-6f) {
         s = t = 0.0f;
         XMFLOAT3 result;
@@ -657,18 +1223,18 @@ float Collision_DistanceSegmentSegment(const XMFLOAT3& p1, const XMFLOAT3& q1,
         return std::sqrt(result.x * result.x + result.y * result.y + result.z * result.z);
     }
 
-    // d1_̏ꍇ
+    // d1が点の場合
     if (a <= 1e-6f) {
         s = 0.0f;
         t = std::clamp(f / e, 0.0f, 1.0f);
     }
-    // d2_̏ꍇ
+    // d2が点の場合
     else if (e <= 1e-6f) {
         t = 0.0f;
         float c = XMVectorGetX(XMVector3Dot(d1, r));
         s = std::clamp(-c / a, 0.0f, 1.0f);
     }
-    // ʓIȃP[X
+    // 一般的なケース
     else {
         float c = XMVectorGetX(XMVector3Dot(d1, r));
         float b = XMVectorGetX(XMVector3Dot(d1, d2));
@@ -683,7 +1249,7 @@ float Collision_DistanceSegmentSegment(const XMFLOAT3& p1, const XMFLOAT3& q1,
 
         t = (b * s + f) / e;
 
-        // t͈͊Ȍꍇ͍ČvZ
+        // tが範囲外の場合は再計算
         if (t < 0.0f) {
             t = 0.0f;
             s = std::clamp(-c / a, 0.0f, 1.0f);
@@ -705,17 +1271,17 @@ float Collision_DistanceSegmentSegment(const XMFLOAT3& p1, const XMFLOAT3& q1,
 }
 
 // =================================================================
-// JvZ vs 
+// カプセル vs 球
 // =================================================================
 Hit Collision_IsHitCapsuleSphere(const Capsule& capsule, const Sphere& sphere)
 {
     Hit hit;
 
-    // JvZ̎̍ŋߐړ_߂
+    // カプセルの軸線分上の最近接点を求める
     XMFLOAT3 closestOnSegment = Collision_ClosestPointOnSegment(
         sphere.center, capsule.start, capsule.end);
 
-    // vZ
+    // 距離を計算
     XMVECTOR vClosest = XMLoadFloat3(&closestOnSegment);
     XMVECTOR vSphereCenter = XMLoadFloat3(&sphere.center);
     XMVECTOR vDiff = vSphereCenter - vClosest;
@@ -730,14 +1296,14 @@ Hit Collision_IsHitCapsuleSphere(const Capsule& capsule, const Sphere& sphere)
         float dist = std::sqrt(distSq);
         hit.depth = radiusSum - dist;
 
-        // ڐG_F̍ŋߐړ_JvZai񂾈ʒu
+        // 接触点：線分上の最近接点からカプセル半径分進んだ位置
         if (dist > 1e-6f) {
             XMVECTOR vNormal = vDiff / dist;
             XMStoreFloat3(&hit.normal, vNormal);
             XMStoreFloat3(&hit.contactPoint, vClosest + vNormal * capsule.radius);
         }
         else {
-            // SɏdȂĂꍇ
+            // 完全に重なっている場合
             XMStoreFloat3(&hit.normal, XMVectorSet(0, 1, 0, 0));
             hit.contactPoint = closestOnSegment;
         }
@@ -747,13 +1313,13 @@ Hit Collision_IsHitCapsuleSphere(const Capsule& capsule, const Sphere& sphere)
 }
 
 // =================================================================
-// JvZ vs JvZ
+// カプセル vs カプセル
 // =================================================================
 Hit Collision_IsHitCapsuleCapsule(const Capsule& a, const Capsule& b)
 {
     Hit hit;
 
-    // 2̐Ԃ̍ŒZƃp[^߂
+    // 2つの線分間の最短距離とパラメータを求める
     float s, t;
     float dist = Collision_DistanceSegmentSegment(
         a.start, a.end, b.start, b.end, &s, &t);
@@ -764,7 +1330,7 @@ Hit Collision_IsHitCapsuleCapsule(const Capsule& a, const Capsule& b)
         hit.isHit = true;
         hit.depth = radiusSum - dist;
 
-        // ŋߐړ_vZ
+        // 最近接点を計算
         XMVECTOR vAStart = XMLoadFloat3(&a.start);
         XMVECTOR vAEnd = XMLoadFloat3(&a.end);
         XMVECTOR vBStart = XMLoadFloat3(&b.start);
@@ -779,11 +1345,11 @@ Hit Collision_IsHitCapsuleCapsule(const Capsule& a, const Capsule& b)
             XMVECTOR vNormal = XMVector3Normalize(vDiff);
             XMStoreFloat3(&hit.normal, vNormal);
 
-            // ڐG_FA̕\
+            // 接触点：A側の表面
             XMStoreFloat3(&hit.contactPoint, pointOnA + vNormal * a.radius);
         }
         else {
-            // SɏdȂĂꍇ
+            // 完全に重なっている場合
             XMStoreFloat3(&hit.normal, XMVectorSet(0, 1, 0, 0));
             XMStoreFloat3(&hit.contactPoint, pointOnA);
         }
@@ -793,12 +1359,12 @@ Hit Collision_IsHitCapsuleCapsule(const Capsule& a, const Capsule& b)
 }
 
 // =================================================================
-// JvZ vs OBB
+// カプセル vs OBB
 // =================================================================
 Hit Collision_IsHitCapsuleOBB(const Capsule& capsule, const OBB& obb)
 {
-    // JvZ𑽐̋ŃTvOċߎ@
-    // 萳mȎɂGJKSATKvAł͊ȈՎ
+    // カプセルを多数の球でサンプリングして近似する方法
+    // より正確な実装にはGJKやSATが必要だが、ここでは簡易実装
 
     const int sampleCount = 5;
     Hit bestHit;
@@ -826,11 +1392,11 @@ Hit Collision_IsHitCapsuleOBB(const Capsule& capsule, const OBB& obb)
 }
 
 // =================================================================
-// JvZ vs AABB
+// カプセル vs AABB
 // =================================================================
 Hit Collision_IsHitCapsuleAABB(const Capsule& capsule, const AABB& aabb)
 {
-    // AABBOBBɕϊĔ
+    // AABBをOBBに変換して判定
     OBB obbFromAABB;
     obbFromAABB.center = aabb.GetCenter();
 
@@ -839,19 +1405,19 @@ Hit Collision_IsHitCapsuleAABB(const Capsule& capsule, const AABB& aabb)
     XMVECTOR vSize = vMax - vMin;
     XMStoreFloat3(&obbFromAABB.extents, vSize * 0.5f);
 
-    obbFromAABB.orientation = XMFLOAT4(0, 0, 0, 1); // ]Ȃ
+    obbFromAABB.orientation = XMFLOAT4(0, 0, 0, 1); // 回転なし
 
     return Collision_IsHitCapsuleOBB(capsule, obbFromAABB);
 }
 
 // =================================================================
-// JvZ vs Op`
+// カプセル vs 三角形
 // =================================================================
 Hit Collision_IsHitCapsuleTriangle(const Capsule& capsule, const Triangle& tri)
 {
     Hit hit;
 
-    // ̎n_ƏI_ꂼɂĎOp`Ƃ̋vZ
+    // 線分の始点と終点それぞれについて三角形との距離を計算
     XMFLOAT3 closestStart = Collision_ClosestPointTriangle(capsule.start, tri);
     XMFLOAT3 closestEnd = Collision_ClosestPointTriangle(capsule.end, tri);
 
@@ -863,7 +1429,7 @@ Hit Collision_IsHitCapsuleTriangle(const Capsule& capsule, const Triangle& tri)
     float distStart = XMVectorGetX(XMVector3Length(vStart - vClosestStart));
     float distEnd = XMVectorGetX(XMVector3Length(vEnd - vClosestEnd));
 
-    // ߂gp
+    // より近い方を使用
     float minDist = std::min(distStart, distEnd);
     XMVECTOR closestOnCapsule = (distStart < distEnd) ? vStart : vEnd;
     XMVECTOR closestOnTri = (distStart < distEnd) ? vClosestStart : vClosestEnd;
@@ -888,7 +1454,7 @@ Hit Collision_IsHitCapsuleTriangle(const Capsule& capsule, const Triangle& tri)
 }
 
 // =================================================================
-// C vs JvZ
+// レイ vs カプセル
 // =================================================================
 bool Collision_IntersectRayCapsule(const Ray& ray, const Capsule& capsule, float* outDist)
 {
@@ -904,7 +1470,7 @@ bool Collision_IntersectRayCapsule(const Ray& ray, const Capsule& capsule, float
     float axisLen = XMVectorGetX(XMVector3Length(vAxis));
 
     if (axisLen < 1e-6f) {
-        // JvZɑމĂꍇ
+        // カプセルが球に退化している場合
         Sphere sphere;
         sphere.center = capsule.start;
         sphere.radius = capsule.radius;
@@ -913,12 +1479,12 @@ bool Collision_IntersectRayCapsule(const Ray& ray, const Capsule& capsule, float
 
     vAxis = vAxis / axisLen;
 
-    // CƃJvZ̍ŋߐڋvZ
+    // レイとカプセル軸の最近接距離を計算
     XMVECTOR vDelta = vOrigin - vStart;
     float rayDot = XMVectorGetX(XMVector3Dot(vDir, vAxis));
     float deltaDot = XMVectorGetX(XMVector3Dot(vDelta, vAxis));
 
-    // ȈՎF[̋Ƃ̌
+    // 簡易実装：両端の球との交差判定
     Sphere sphereStart, sphereEnd;
     sphereStart.center = capsule.start;
     sphereStart.radius = capsule.radius;
@@ -948,25 +1514,33 @@ bool Collision_IntersectRayCapsule(const Ray& ray, const Capsule& capsule, float
 }
 
 /****************************************
- * @brief   ֐ Collision_Detect ̊g
- *          JvZAAABBAOp`ɑΉ
+ * @brief   統合判定関数 Collision_Detect の拡張版
+ *          カプセル、AABB、三角形に対応
  *
- * collision.cpp ̖ɒǉ܂͒u
+ * collision.cpp の末尾に追加または置き換え
  ****************************************/
 
 Hit Collision_Detect(const Collider& colA, const Collider& colB)
 {
     using CT = ColliderType;
 
+    // 凸包は専用の解析関数を持たないため GJK / EPA で判定
+    if (colA.type == CT::ConvexHull || colB.type == CT::ConvexHull)
+    {
+        return Collision_DetectGJK(colA, colB);
+    }
+
     // =================================================================
-    // Sphere n
+    // Sphere 系
     // =================================================================
     if (colA.type == CT::Sphere)
     {
         if (colB.type == CT::Sphere)
         {
             // Sphere vs Sphere
-            if (Collision_IsOverlapSphere(colA.sphere, colB.sphere.center)) {
+            Sphere combined = colA.sphere;
+            combined.radius += colB.sphere.radius;
+            if (Collision_IsOverlapSphere(combined, colB.sphere.center)) {
                 Hit hit;
                 hit.isHit = true;
 
@@ -995,7 +1569,7 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
         }
         else if (colB.type == CT::AABB)
         {
-            // Sphere vs AABBiOBBĔj
+            // Sphere vs AABB（OBB化して判定）
             OBB aabbAsOBB;
             aabbAsOBB.center = colB.aabb.GetCenter();
             XMFLOAT3 colB_AABB_Size = colB.aabb.GetSize();
@@ -1006,7 +1580,7 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
         }
         else if (colB.type == CT::Capsule)
         {
-            // Sphere vs CapsuleitŌĂŖ@𔽓]j
+            // Sphere vs Capsule（逆順で呼んで法線を反転）
             Hit hit = Collision_IsHitCapsuleSphere(colB.capsule, colA.sphere);
             if (hit.isHit) {
                 XMVECTOR n = XMLoadFloat3(&hit.normal);
@@ -1022,13 +1596,13 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
     }
 
     // =================================================================
-    // Box (OBB) n
+    // Box (OBB) 系
     // =================================================================
     else if (colA.type == CT::Box)
     {
         if (colB.type == CT::Sphere)
         {
-            // OBB vs SphereitŌĂŖ@𔽓]j
+            // OBB vs Sphere（逆順で呼んで法線を反転）
             Hit hit = Collision_IsHitSphereOBB(colB.sphere, colA.obb);
             if (hit.isHit) {
                 XMVECTOR n = XMLoadFloat3(&hit.normal);
@@ -1048,7 +1622,7 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
         }
         else if (colB.type == CT::Capsule)
         {
-            // OBB vs CapsuleitŌĂŖ@𔽓]j
+            // OBB vs Capsule（逆順で呼んで法線を反転）
             Hit hit = Collision_IsHitCapsuleOBB(colB.capsule, colA.obb);
             if (hit.isHit) {
                 XMVECTOR n = XMLoadFloat3(&hit.normal);
@@ -1064,13 +1638,13 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
     }
 
     // =================================================================
-    // AABB n
+    // AABB 系
     // =================================================================
     else if (colA.type == CT::AABB)
     {
         if (colB.type == CT::Sphere)
         {
-            // AABB vs SphereiOBBj
+            // AABB vs Sphere（OBB化）
             OBB aabbAsOBB;
             aabbAsOBB.center = colA.aabb.GetCenter();
             XMFLOAT3 colA_AABB_Size = colA.aabb.GetSize();
@@ -1087,7 +1661,7 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
         }
         else if (colB.type == CT::Box)
         {
-            // AABB vs OBBitj
+            // AABB vs OBB（逆順）
             Hit hit = Collision_IsHitOBBAABB(colB.obb, colA.aabb);
             if (hit.isHit) {
                 XMVECTOR n = XMLoadFloat3(&hit.normal);
@@ -1102,7 +1676,7 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
         }
         else if (colB.type == CT::Capsule)
         {
-            // AABB vs CapsuleitŌĂŖ@𔽓]j
+            // AABB vs Capsule（逆順で呼んで法線を反転）
             Hit hit = Collision_IsHitCapsuleAABB(colB.capsule, colA.aabb);
             if (hit.isHit) {
                 XMVECTOR n = XMLoadFloat3(&hit.normal);
@@ -1112,7 +1686,7 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
         }
         else if (colB.type == CT::Triangle)
         {
-            // AABB vs TriangleiOBBĂ画j
+            // AABB vs Triangle（OBB化してから判定）
             OBB aabbAsOBB;
             aabbAsOBB.center = colA.aabb.GetCenter();
             XMFLOAT3 colA_AABB_Size = colA.aabb.GetSize();
@@ -1124,7 +1698,7 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
     }
 
     // =================================================================
-    // Capsule n
+    // Capsule 系
     // =================================================================
     else if (colA.type == CT::Capsule)
     {
@@ -1156,13 +1730,13 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
     }
 
     // =================================================================
-    // Triangle n
+    // Triangle 系
     // =================================================================
     else if (colA.type == CT::Triangle)
     {
         if (colB.type == CT::Sphere)
         {
-            // Triangle vs Sphereitj
+            // Triangle vs Sphere（逆順）
             Hit hit = Collision_IsHitSphereTriangle(colB.sphere, colA.triangle);
             if (hit.isHit) {
                 XMVECTOR n = XMLoadFloat3(&hit.normal);
@@ -1172,7 +1746,7 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
         }
         else if (colB.type == CT::Box)
         {
-            // Triangle vs OBBitj
+            // Triangle vs OBB（逆順）
             Hit hit = Collision_IsHitOBBTriangle(colB.obb, colA.triangle);
             if (hit.isHit) {
                 XMVECTOR n = XMLoadFloat3(&hit.normal);
@@ -1182,7 +1756,7 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
         }
         else if (colB.type == CT::AABB)
         {
-            // Triangle vs AABBiOBBċtj
+            // Triangle vs AABB（OBB化して逆順）
             OBB aabbAsOBB;
             aabbAsOBB.center = colB.aabb.GetCenter();
             XMFLOAT3 cloB_AABB_Size = colB.aabb.GetSize();
@@ -1199,7 +1773,7 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
         }
         else if (colB.type == CT::Capsule)
         {
-            // Triangle vs Capsuleitj
+            // Triangle vs Capsule（逆順）
             Hit hit = Collision_IsHitCapsuleTriangle(colB.capsule, colA.triangle);
             if (hit.isHit) {
                 XMVECTOR n = XMLoadFloat3(&hit.normal);
@@ -1209,12 +1783,11 @@ Hit Collision_Detect(const Collider& colA, const Collider& colB)
         }
         else if (colB.type == CT::Triangle)
         {
-            // Triangle vs Triangle ͖
-            // Kvɉ SAT  GJK Ŏ
-            return Hit{};
+            // Triangle vs Triangle（解析関数なし）
+            return Collision_DetectGJK(colA, colB);
         }
     }
 
-    // Ή̑gݍ킹
-    return Hit{};
+    // 解析関数のない組み合わせは汎用判定へ
+    return Collision_DetectGJK(colA, colB);
 }
\ No newline at end of file
@@ -1,43 +1,49 @@
 /****************************************
  * @file    collision.h
- * @brief   RW胂W[iJvZΉŁj
+ * @brief   コリジョン判定モジュール（カプセル対応版）
  * @author  Natsume Shidara
  * @date    2025/01/02
+ * @update  2026/10/18 - 連続衝突判定用のスイープ判定を追加
+ * @update  2026/10/18 - 凸包形状を追加（判定は collision_gjk の GJK / EPA）
+ * @update  2026/10/18 - OBB の面クリッピングによる複数点接触を追加
+ * @update  2026/10/18 - カプセルと AABB のスイープ判定を追加
+ * @update  2026/10/18 - 平面が OBB をまたぐかの判定と、変換済み AABB の OBB 化を追加
+ * @update  2026/10/18 - 球と AABB / OBB のスイープが辺・角まで厳密であることを明記
  ****************************************/
 #ifndef COLLISION_H
 #define COLLISION_H
 
 #include <DirectXMath.h>
 
- // O錾
+ // 前方宣言
 class Ray;
 struct Collider;
 struct Capsule;
 
 //--------------------------------------
-// ``\̌Q
+// 形状定義構造体群
 //--------------------------------------
 
-/** @struct Circle @brief 2D ~` */
+/** @struct Circle @brief 2D 円形 */
 struct Circle {
     DirectX::XMFLOAT2 center;
     float radius;
 };
 
-/** @struct Sphere @brief 3D ` */
+/** @struct Sphere @brief 3D 球形 */
 struct Sphere {
     DirectX::XMFLOAT3 center;
     float radius;
 };
 
-/** @struct Box @brief 2D AABB (Sƃn[tTCY) */
+/** @struct Box @brief 2D AABB (中心とハーフサイズ) */
 struct Box {
     DirectX::XMFLOAT2 center;
     float half_width;
     float half_height;
 };
 
-/** @struct AABB @brief 3D AABB (ŏlEől) */
+/** @struct AABB @brief 3D AABB (最小値・最大値) */
 struct AABB {
     DirectX::XMFLOAT3 min;
     DirectX::XMFLOAT3 max;
@@ -50,7 +56,7 @@ struct AABB {
     }
 };
 
-/** @struct Triangle @brief 3D Op` */
+/** @struct Triangle @brief 3D 三角形面 */
 struct Triangle {
     DirectX::XMFLOAT3 p0;
     DirectX::XMFLOAT3 p1;
@@ -58,15 +64,23 @@ struct Triangle {
     DirectX::XMFLOAT3 normal;
 };
 
-/** @struct OBB @brief 3D LE{bNX */
+/** @struct OBB @brief 3D 有向境界ボックス */
 struct OBB {
     DirectX::XMFLOAT3 center;
     DirectX::XMFLOAT3 extents;
     DirectX::XMFLOAT4 orientation;
 };
 
+/** @struct ConvexHull @brief 3D 凸包（ローカル頂点列を中心・姿勢で配置。頂点配列は外部所有） */
+struct ConvexHull {
+    const DirectX::XMFLOAT3* points;
+    int pointCount;
+    DirectX::XMFLOAT3 center;
+    DirectX::XMFLOAT4 orientation;
+};
+
 //--------------------------------------
-// Փˌʃf[^\
+// 衝突結果データ構造体
 //--------------------------------------
 
 struct Hit {
@@ -76,17 +90,34 @@ struct Hit {
     DirectX::XMFLOAT3 contactPoint{ 0, 0, 0 };
 };
 
+/** @struct SweepHit @brief スイープ判定結果（time は移動量に対する割合 0～1） */
+struct SweepHit {
+    bool isHit = false;
+    float time = 1.0f;
+    DirectX::XMFLOAT3 normal{ 0, 0, 0 };   // 移動体を押し返す向き
+};
+
+/** @struct ContactSet @brief 複数点の接触結果（法線は B→A、接触点は両面の中点） */
+struct ContactSet {
+    static constexpr int MAX_POINTS = 4;
+
+    int count = 0;
+    DirectX::XMFLOAT3 normal{ 0, 0, 0 };
+    DirectX::XMFLOAT3 points[MAX_POINTS]{};
+    float depths[MAX_POINTS]{};
+};
+
 //--------------------------------------
-// ֐vg^Cv
+// 判定関数プロトタイプ
 //--------------------------------------
 
-// --- ȈՔ֐Q ---
+// --- 簡易判定関数群 ---
 bool Collision_IsOverlapCircle(const Circle& a, const Circle& b);
 bool Collision_IsOverlapBox(const Box& a, const Box& b);
 bool Collision_IsOverlapAABB(const AABB& a, const AABB& b);
 bool Collision_IsOverlapSphere(const Sphere& a, const DirectX::XMFLOAT3& point);
 
-// --- ڍה֐Q ---
+// --- 詳細判定関数群 ---
 Hit Collision_IsHitAABB(const AABB& a, const AABB& b);
 Hit Collision_IsHitSphereTriangle(const Sphere& sphere, const Triangle& tri);
 Hit Collision_IsHitOBBTriangle(const OBB& obb, const Triangle& tri);
@@ -94,19 +125,38 @@ Hit Collision_IsHitSphereOBB(const Sphere& sphere, const OBB& obb);
 Hit Collision_IsHitOBBOBB(const OBB& a, const OBB& b);
 Hit Collision_IsHitOBBAABB(const OBB& obb, const AABB& aabb);
 
-// --- JvZ֐QiVKǉj---
+// --- 複数点接触（参照面に入射面をクリップ。面が決まらない辺接触は1点）---
+ContactSet Collision_ClipOBBOBB(const OBB& a, const OBB& b);
+ContactSet Collision_ClipOBBAABB(const OBB& obb, const AABB& aabb);
+
+// --- カプセル判定関数群（新規追加）---
 Hit Collision_IsHitCapsuleSphere(const Capsule& capsule, const Sphere& sphere);
 Hit Collision_IsHitCapsuleCapsule(const Capsule& a, const Capsule& b);
 Hit Collision_IsHitCapsuleOBB(const Capsule& capsule, const OBB& obb);
 Hit Collision_IsHitCapsuleAABB(const Capsule& capsule, const AABB& aabb);
 Hit Collision_IsHitCapsuleTriangle(const Capsule& capsule, const Triangle& tri);
 
-// --- C֐Q ---
+// --- レイ判定関数群 ---
 bool Collision_IntersectRaySphere(const Ray& ray, const Sphere& sphere, float* outDist = nullptr);
 bool Collision_IntersectRayAABB(const Ray& ray, const AABB& aabb, float* outDist = nullptr);
 bool Collision_IntersectRayCapsule(const Ray& ray, const Capsule& capsule, float* outDist = nullptr);
 
-// --- [eBeB ---
+// --- スイープ判定関数群（連続衝突判定）---
+// 開始時点で既に重なっている場合は、移動が面へ向かうときのみ time = 0 で当たりを返す
+// 球と AABB / OBB は辺・角の丸みまで厳密。カプセルと AABB は傾いたカプセルで保守的（早めに当たる）
+SweepHit Collision_SweepSphereAABB(const Sphere& sphere, const DirectX::XMFLOAT3& displacement, const AABB& aabb);
+SweepHit Collision_SweepSphereOBB(const Sphere& sphere, const DirectX::XMFLOAT3& displacement, const OBB& obb);
+SweepHit Collision_SweepSphereSphere(const Sphere& a, const DirectX::XMFLOAT3& displacementA,
+    const Sphere& b, const DirectX::XMFLOAT3& displacementB);
+SweepHit Collision_SweepCapsuleAABB(const Capsule& capsule, const DirectX::XMFLOAT3& displacement, const AABB& aabb);
+
+// --- ユーティリティ ---
+AABB Collision_GetOBBBounds(const OBB& obb);
+/** @brief ローカル AABB をワールド行列で変換した OBB（行列の拡大率は extents へ反映） */
+OBB Collision_TransformAABB(const AABB& localAABB, const DirectX::XMFLOAT4X4& world);
+/** @brief 平面が OBB を両側に margin 以上の厚みで分けるか（切断で2つに分かれる必要条件） */
+bool Collision_IsOBBStraddlingPlane(const OBB& obb, const DirectX::XMFLOAT3& planePoint,
+    const DirectX::XMFLOAT3& planeNormal, float margin = 0.0f);
 DirectX::XMFLOAT3 Collision_ClosestPointTriangle(const DirectX::XMFLOAT3& point, const Triangle& tri);
 DirectX::XMFLOAT3 Collision_ClosestPointOnSegment(const DirectX::XMFLOAT3& point,
     const DirectX::XMFLOAT3& segStart,
@@ -115,7 +165,7 @@ float Collision_DistanceSegmentSegment(const DirectX::XMFLOAT3& p1, const Direct
     const DirectX::XMFLOAT3& p2, const DirectX::XMFLOAT3& q2,
     float* s = nullptr, float* t = nullptr);
 
-// ---  ---
+// --- 統合判定 ---
 Hit Collision_Detect(const Collider& colA, const Collider& colB);
 
 #endif // COLLISION_H
\ No newline at end of file
@@ -0,0 +1,270 @@
+﻿/****************************************
+ * @file    collision_batch.cpp
+ * @brief   形状の組み合わせごとにまとめた詳細判定（SoA）の実装
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "collision_batch.h"
+#include "collision_lanes.h"
+#include "collider.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+using namespace CollisionPacketConfig;
+using namespace CollisionLanes;
+
+//======================================
+// カーネル
+//======================================
+namespace
+{
+    // これ以下の距離は中心が重なっているとみなし、既定の法線を使う（スカラー版と同じ閾値）
+    constexpr float DEGENERATE_DISTANCE = 1e-6f;
+
+    /**
+     * @struct HitLanes
+     * @brief カーネルの出力（SoA、当たったレーンだけ Hit へ書き戻す）
+     */
+    struct alignas(32) HitLanes
+    {
+        float normalX[WIDTH];
+        float normalY[WIDTH];
+        float normalZ[WIDTH];
+        float depth[WIDTH];
+        float pointX[WIDTH];
+        float pointY[WIDTH];
+        float pointZ[WIDTH];
+    };
+
+    void ScatterHits(const HitLanes& lanes, uint32_t mask, Hit* outHits)
+    {
+        for (int lane = 0; lane < WIDTH; ++lane)
+        {
+            if (!((mask >> lane) & 1u)) continue;
+
+            Hit& hit = outHits[lane];
+            hit.isHit = true;
+            hit.normal = { lanes.normalX[lane], lanes.normalY[lane], lanes.normalZ[lane] };
+            hit.depth = lanes.depth[lane];
+            hit.contactPoint = { lanes.pointX[lane], lanes.pointY[lane], lanes.pointZ[lane] };
+        }
+    }
+
+    template<class L>
+    uint32_t SpherePairKernel(const SpherePairBatch& batch, HitLanes& out)
+    {
+        using V = typename L::V;
+
+        uint32_t mask = 0;
+        for (int lane = 0; lane < batch.count; lane += L::COUNT)
+        {
+            const V bx = L::Load(batch.centerBX + lane);
+            const V by = L::Load(batch.centerBY + lane);
+            const V bz = L::Load(batch.centerBZ + lane);
+            const V rb = L::Load(batch.radiusB + lane);
+
+            // B→A
+            const V dx = L::Sub(L::Load(batch.centerAX + lane), bx);
+            const V dy = L::Sub(L::Load(batch.centerAY + lane), by);
+            const V dz = L::Sub(L::Load(batch.centerAZ + lane), bz);
+            const V distSq = L::Add(L::Add(L::Mul(dx, dx), L::Mul(dy, dy)), L::Mul(dz, dz));
+            const V radiusSum = L::Add(L::Load(batch.radiusA + lane), rb);
+            mask |= L::Bits(L::Less(distSq, L::Mul(radiusSum, radiusSum))) << lane;
+
+            const V dist = L::Sqrt(distSq);
+            const typename L::M isSeparated = L::Greater(dist, L::Set(DEGENERATE_DISTANCE));
+            const V safeDist = L::Select(isSeparated, dist, L::Set(1.0f));
+
+            // 中心が重なっている場合は真上を法線、B の中心を接触点にする
+            const V nx = L::Select(isSeparated, L::Div(dx, safeDist), L::Set(0.0f));
+            const V ny = L::Select(isSeparated, L::Div(dy, safeDist), L::Set(1.0f));
+            const V nz = L::Select(isSeparated, L::Div(dz, safeDist), L::Set(0.0f));
+            const V surface = L::Select(isSeparated, rb, L::Set(0.0f));
+
+            L::Store(out.normalX + lane, nx);
+            L::Store(out.normalY + lane, ny);
+            L::Store(out.normalZ + lane, nz);
+            L::Store(out.depth + lane, L::Sub(radiusSum, dist));
+            L::Store(out.pointX + lane, L::Add(bx, L::Mul(nx, surface)));
+            L::Store(out.pointY + lane, L::Add(by, L::Mul(ny, surface)));
+            L::Store(out.pointZ + lane, L::Add(bz, L::Mul(nz, surface)));
+        }
+        return mask & LaneMask(batch.count);
+    }
+
+    template<class L>
+    uint32_t SphereOBBKernel(const SphereOBBPairBatch& batch, HitLanes& out)
+    {
+        using V = typename L::V;
+
+        uint32_t mask = 0;
+        for (int lane = 0; lane < batch.count; lane += L::COUNT)
+        {
+            const V sx = L::Load(batch.sphereX + lane);
+            const V sy = L::Load(batch.sphereY + lane);
+            const V sz = L::Load(batch.sphereZ + lane);
+            const V cx = L::Load(batch.centerX + lane);
+            const V cy = L::Load(batch.centerY + lane);
+            const V cz = L::Load(batch.centerZ + lane);
+            const V dx = L::Sub(sx, cx);
+            const V dy = L::Sub(sy, cy);
+            const V dz = L::Sub(sz, cz);
+
+            // ローカル座標で箱へクランプし、ワールドへ戻して最近点を得る
+            V closestX = cx;
+            V closestY = cy;
+            V closestZ = cz;
+            for (int k = 0; k < 3; ++k)
+            {
+                const V ax = L::Load(batch.axis[k][0] + lane);
+                const V ay = L::Load(batch.axis[k][1] + lane);
+                const V az = L::Load(batch.axis[k][2] + lane);
+                const V extent = L::Load(batch.extents[k] + lane);
+
+                V local = L::Add(L::Add(L::Mul(dx, ax), L::Mul(dy, ay)), L::Mul(dz, az));
+                local = L::Min(L::Max(local, L::Sub(L::Set(0.0f), extent)), extent);
+
+                closestX = L::Add(closestX, L::Mul(local, ax));
+                closestY = L::Add(closestY, L::Mul(local, ay));
+                closestZ = L::Add(closestZ, L::Mul(local, az));
+            }
+
+            const V diffX = L::Sub(sx, closestX);
+            const V diffY = L::Sub(sy, closestY);
+            const V diffZ = L::Sub(sz, closestZ);
+            const V distSq = L::Add(L::Add(L::Mul(diffX, diffX), L::Mul(diffY, diffY)), L::Mul(diffZ, diffZ));
+            const V radius = L::Load(batch.radius + lane);
+            mask |= L::Bits(L::Less(distSq, L::Mul(radius, radius))) << lane;
+
+            // 中心が箱の内側にある場合は箱の Y 軸を法線にする（スカラー版と同じ）
+            const V dist = L::Sqrt(distSq);
+            const typename L::M isSeparated = L::Greater(dist, L::Set(DEGENERATE_DISTANCE));
+            const V safeDist = L::Select(isSeparated, dist, L::Set(1.0f));
+
+            L::Store(out.normalX + lane, L::Select(isSeparated, L::Div(diffX, safeDist), L::Load(batch.axis[1][0] + lane)));
+            L::Store(out.normalY + lane, L::Select(isSeparated, L::Div(diffY, safeDist), L::Load(batch.axis[1][1] + lane)));
+            L::Store(out.normalZ + lane, L::Select(isSeparated, L::Div(diffZ, safeDist), L::Load(batch.axis[1][2] + lane)));
+            L::Store(out.depth + lane, L::Sub(radius, dist));
+            L::Store(out.pointX + lane, closestX);
+            L::Store(out.pointY + lane, closestY);
+            L::Store(out.pointZ + lane, closestZ);
+        }
+        return mask & LaneMask(batch.count);
+    }
+}
+
+//======================================
+// 組み合わせの分類
+//======================================
+CollisionPairKind Collision_ClassifyPair(const Collider& colA, const Collider& colB)
+{
+    const bool isSphereA = (colA.type == ColliderType::Sphere);
+    const bool isSphereB = (colB.type == ColliderType::Sphere);
+    const bool isBoxA = (colA.type == ColliderType::Box);
+    const bool isBoxB = (colB.type == ColliderType::Box);
+
+    if (isSphereA && isSphereB) return CollisionPairKind::SphereSphere;
+    if (isSphereA && isBoxB) return CollisionPairKind::SphereBox;
+    if (isBoxA && isSphereB) return CollisionPairKind::BoxSphere;
+    if (isBoxA && isBoxB) return CollisionPairKind::BoxBox;
+    return CollisionPairKind::Generic;
+}
+
+//======================================
+// バッチの組み立て
+//======================================
+void SpherePairBatch::Clear()
+{
+    // 未使用レーンも計算されるため、割り算で非数にならない値で埋める
+    for (int i = 0; i < WIDTH; ++i)
+    {
+        centerAX[i] = centerAY[i] = centerAZ[i] = 0.0f;
+        centerBX[i] = centerBY[i] = centerBZ[i] = 0.0f;
+        radiusA[i] = radiusB[i] = 0.0f;
+    }
+    count = 0;
+}
+
+bool SpherePairBatch::Push(const Sphere& a, const Sphere& b)
+{
+    if (IsFull()) return false;
+
+    const int lane = count++;
+    centerAX[lane] = a.center.x;
+    centerAY[lane] = a.center.y;
+    centerAZ[lane] = a.center.z;
+    radiusA[lane] = a.radius;
+    centerBX[lane] = b.center.x;
+    centerBY[lane] = b.center.y;
+    centerBZ[lane] = b.center.z;
+    radiusB[lane] = b.radius;
+    return true;
+}
+
+void SphereOBBPairBatch::Clear()
+{
+    for (int i = 0; i < WIDTH; ++i)
+    {
+        sphereX[i] = sphereY[i] = sphereZ[i] = radius[i] = 0.0f;
+        centerX[i] = centerY[i] = centerZ[i] = 0.0f;
+        for (int k = 0; k < 3; ++k)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                axis[k][c][i] = (k == c) ? 1.0f : 0.0f;
+            }
+            extents[k][i] = 0.0f;
+        }
+    }
+    count = 0;
+}
+
+bool SphereOBBPairBatch::Push(const Sphere& sphere, const OBB& obb)
+{
+    if (IsFull()) return false;
+
+    const int lane = count++;
+    sphereX[lane] = sphere.center.x;
+    sphereY[lane] = sphere.center.y;
+    sphereZ[lane] = sphere.center.z;
+    radius[lane] = sphere.radius;
+    centerX[lane] = obb.center.x;
+    centerY[lane] = obb.center.y;
+    centerZ[lane] = obb.center.z;
+
+    // スカラー版と同じ行列から軸を取り出す
+    const XMMATRIX rot = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.orientation));
+    for (int k = 0; k < 3; ++k)
+    {
+        XMFLOAT3 row;
+        XMStoreFloat3(&row, rot.r[k]);
+        axis[k][0][lane] = row.x;
+        axis[k][1][lane] = row.y;
+        axis[k][2][lane] = row.z;
+    }
+    extents[0][lane] = obb.extents.x;
+    extents[1][lane] = obb.extents.y;
+    extents[2][lane] = obb.extents.z;
+    return true;
+}
+
+//======================================
+// 判定
+//======================================
+uint32_t Collision_DetectSpherePairBatch(const SpherePairBatch& batch, Hit* outHits)
+{
+    HitLanes lanes;
+    const uint32_t mask = SpherePairKernel<NativeLanes>(batch, lanes);
+    ScatterHits(lanes, mask, outHits);
+    return mask;
+}
+
+uint32_t Collision_DetectSphereOBBPairBatch(const SphereOBBPairBatch& batch, Hit* outHits)
+{
+    HitLanes lanes;
+    const uint32_t mask = SphereOBBKernel<NativeLanes>(batch, lanes);
+    ScatterHits(lanes, mask, outHits);
+    return mask;
+}
@@ -0,0 +1,102 @@
+﻿/****************************************
+ * @file    collision_batch.h
+ * @brief   形状の組み合わせごとにまとめた詳細判定（SoA）
+ * @detail  ブロードフェーズ後のペアを形状の組み合わせで仕分け、同じ組み合わせを
+ *          WIDTH 組ずつ SoA に並べてレーン単位でまとめて判定する。
+ *          結果は Collision_Detect の同じ組み合わせと同じ規約
+ *          （法線は B→A、接触点は B の表面上）で、誤差は丸めの範囲に収まる
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+#ifndef COLLISION_BATCH_H
+#define COLLISION_BATCH_H
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include "collision.h"
+#include "collision_packet.h"
+
+struct Collider;
+
+//--------------------------------------
+// 組み合わせの分類
+//--------------------------------------
+enum class CollisionPairKind
+{
+    SphereSphere,   // 球 × 球
+    SphereBox,      // 球 × OBB（A が球）
+    BoxSphere,      // OBB × 球（A が OBB、法線を反転して返す）
+    BoxBox,         // OBB × OBB（面クリッピングを使う呼び出し側でまとめる）
+    Generic,        // その他（Collision_Detect で1組ずつ判定）
+    Count
+};
+
+/**
+ * @brief 2つのコライダーの組み合わせを分類
+ */
+CollisionPairKind Collision_ClassifyPair(const Collider& colA, const Collider& colB);
+
+//--------------------------------------
+// SoA 形式のバッチ
+//--------------------------------------
+/**
+ * @struct SpherePairBatch
+ * @brief  最大 WIDTH 組の球 × 球（count 以降のレーンは結果から除く）
+ */
+struct alignas(32) SpherePairBatch
+{
+    float centerAX[CollisionPacketConfig::WIDTH];
+    float centerAY[CollisionPacketConfig::WIDTH];
+    float centerAZ[CollisionPacketConfig::WIDTH];
+    float radiusA[CollisionPacketConfig::WIDTH];
+    float centerBX[CollisionPacketConfig::WIDTH];
+    float centerBY[CollisionPacketConfig::WIDTH];
+    float centerBZ[CollisionPacketConfig::WIDTH];
+    float radiusB[CollisionPacketConfig::WIDTH];
+    int count = 0;
+
+    SpherePairBatch() { Clear(); }
+    void Clear();
+    bool Push(const Sphere& a, const Sphere& b);
+    bool IsFull() const { return count >= CollisionPacketConfig::WIDTH; }
+};
+
+/**
+ * @struct SphereOBBPairBatch
+ * @brief  最大 WIDTH 組の球 × OBB（OBB の軸は回転行列の行として事前に展開）
+ */
+struct alignas(32) SphereOBBPairBatch
+{
+    float sphereX[CollisionPacketConfig::WIDTH];
+    float sphereY[CollisionPacketConfig::WIDTH];
+    float sphereZ[CollisionPacketConfig::WIDTH];
+    float radius[CollisionPacketConfig::WIDTH];
+    float centerX[CollisionPacketConfig::WIDTH];
+    float centerY[CollisionPacketConfig::WIDTH];
+    float centerZ[CollisionPacketConfig::WIDTH];
+    float axis[3][3][CollisionPacketConfig::WIDTH];    // [軸][成分][レーン]
+    float extents[3][CollisionPacketConfig::WIDTH];
+    int count = 0;
+
+    SphereOBBPairBatch() { Clear(); }
+    void Clear();
+    bool Push(const Sphere& sphere, const OBB& obb);
+    bool IsFull() const { return count >= CollisionPacketConfig::WIDTH; }
+};
+
+//--------------------------------------
+// 関数プロトタイプ
+//--------------------------------------
+/**
+ * @brief 球 × 球をまとめて判定（Collision_Detect(球A, 球B) と同じ結果）
+ * @param[out] outHits WIDTH 要素。当たったレーンのみ書き込む
+ * @return 当たったレーンのビットマスク
+ */
+uint32_t Collision_DetectSpherePairBatch(const SpherePairBatch& batch, Hit* outHits);
+
+/**
+ * @brief 球 × OBB をまとめて判定（Collision_IsHitSphereOBB と同じ結果、法線は OBB→球）
+ */
+uint32_t Collision_DetectSphereOBBPairBatch(const SphereOBBPairBatch& batch, Hit* outHits);
+
+#endif // COLLISION_BATCH_H
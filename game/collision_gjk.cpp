@@ -0,0 +1,807 @@
+﻿/****************************************
+ * @file    collision_gjk.cpp
+ * @brief   サポート写像による汎用凸形状判定（GJK / EPA）の実装
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "collision_gjk.h"
+#include "collider.h"
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+#include <vector>
+
+using namespace DirectX;
+
+//======================================
+// 内部データ
+//======================================
+namespace
+{
+    // ミンコフスキー差 A-B 上の点と、それを与えた各形状上の点
+    struct SupportVertex
+    {
+        XMVECTOR w;
+        XMVECTOR a;
+        XMVECTOR b;
+    };
+
+    // GJKの単体（最近点の重心座標つき）
+    struct Simplex
+    {
+        SupportVertex vertices[4];
+        float lambda[4];
+        int count = 0;
+    };
+
+    struct GjkResult
+    {
+        bool isOverlap = false;
+        float distance = 0.0f;
+        XMVECTOR pointA = XMVectorZero();
+        XMVECTOR pointB = XMVectorZero();
+        Simplex simplex;
+    };
+
+    struct EpaFace
+    {
+        int index[3];
+        XMVECTOR normal;
+        float distance;
+        bool isAlive;
+    };
+
+    struct EpaEdge
+    {
+        int from;
+        int to;
+    };
+
+    constexpr float EPSILON = 1e-6f;
+}
+
+//======================================
+// 内部ヘルパー関数
+//======================================
+namespace
+{
+    float Dot3(FXMVECTOR a, FXMVECTOR b)
+    {
+        return XMVectorGetX(XMVector3Dot(a, b));
+    }
+
+    SupportVertex SupportCore(const ConvexShape& a, const ConvexShape& b, FXMVECTOR dir)
+    {
+        SupportVertex v;
+        v.a = a.SupportCore(dir);
+        v.b = b.SupportCore(XMVectorNegate(dir));
+        v.w = XMVectorSubtract(v.a, v.b);
+        return v;
+    }
+
+    SupportVertex SupportFull(const ConvexShape& a, const ConvexShape& b, FXMVECTOR dir)
+    {
+        SupportVertex v;
+        v.a = a.Support(dir);
+        v.b = b.Support(XMVectorNegate(dir));
+        v.w = XMVectorSubtract(v.a, v.b);
+        return v;
+    }
+
+    void SetVertex(Simplex& s, int slot, const SupportVertex& v, float lambda)
+    {
+        s.vertices[slot] = v;
+        s.lambda[slot] = lambda;
+    }
+
+    /**
+     * @brief 線分上で原点に最も近い点を求め、単体を必要な頂点だけに縮める
+     */
+    XMVECTOR SolveSegment(Simplex& s, const SupportVertex& va, const SupportVertex& vb)
+    {
+        XMVECTOR ab = XMVectorSubtract(vb.w, va.w);
+        const float lengthSq = Dot3(ab, ab);
+        const float t = (lengthSq > EPSILON) ? -Dot3(va.w, ab) / lengthSq : 0.0f;
+
+        if (t <= 0.0f)
+        {
+            s.count = 1;
+            SetVertex(s, 0, va, 1.0f);
+            return va.w;
+        }
+        if (t >= 1.0f)
+        {
+            s.count = 1;
+            SetVertex(s, 0, vb, 1.0f);
+            return vb.w;
+        }
+
+        s.count = 2;
+        SetVertex(s, 0, va, 1.0f - t);
+        SetVertex(s, 1, vb, t);
+        return XMVectorAdd(va.w, XMVectorScale(ab, t));
+    }
+
+    /**
+     * @brief 三角形上で原点に最も近い点（Voronoi領域による場合分け）
+     */
+    XMVECTOR SolveTriangle(Simplex& s, const SupportVertex& va, const SupportVertex& vb, const SupportVertex& vc)
+    {
+        XMVECTOR a = va.w, b = vb.w, c = vc.w;
+        XMVECTOR ab = XMVectorSubtract(b, a);
+        XMVECTOR ac = XMVectorSubtract(c, a);
+
+        XMVECTOR ap = XMVectorNegate(a);
+        const float d1 = Dot3(ab, ap);
+        const float d2 = Dot3(ac, ap);
+        if (d1 <= 0.0f && d2 <= 0.0f)
+        {
+            s.count = 1;
+            SetVertex(s, 0, va, 1.0f);
+            return a;
+        }
+
+        XMVECTOR bp = XMVectorNegate(b);
+        const float d3 = Dot3(ab, bp);
+        const float d4 = Dot3(ac, bp);
+        if (d3 >= 0.0f && d4 <= d3)
+        {
+            s.count = 1;
+            SetVertex(s, 0, vb, 1.0f);
+            return b;
+        }
+
+        const float vc_ = d1 * d4 - d3 * d2;
+        if (vc_ <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+        {
+            const float t = d1 / (d1 - d3);
+            s.count = 2;
+            SetVertex(s, 0, va, 1.0f - t);
+            SetVertex(s, 1, vb, t);
+            return XMVectorAdd(a, XMVectorScale(ab, t));
+        }
+
+        XMVECTOR cp = XMVectorNegate(c);
+        const float d5 = Dot3(ab, cp);
+        const float d6 = Dot3(ac, cp);
+        if (d6 >= 0.0f && d5 <= d6)
+        {
+            s.count = 1;
+            SetVertex(s, 0, vc, 1.0f);
+            return c;
+        }
+
+        const float vb_ = d5 * d2 - d1 * d6;
+        if (vb_ <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+        {
+            const float t = d2 / (d2 - d6);
+            s.count = 2;
+            SetVertex(s, 0, va, 1.0f - t);
+            SetVertex(s, 1, vc, t);
+            return XMVectorAdd(a, XMVectorScale(ac, t));
+        }
+
+        const float va_ = d3 * d6 - d5 * d4;
+        if (va_ <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+        {
+            const float t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            s.count = 2;
+            SetVertex(s, 0, vb, 1.0f - t);
+            SetVertex(s, 1, vc, t);
+            return XMVectorAdd(b, XMVectorScale(XMVectorSubtract(c, b), t));
+        }
+
+        // 面の内側
+        const float denom = 1.0f / (va_ + vb_ + vc_);
+        const float v = vb_ * denom;
+        const float w = vc_ * denom;
+        s.count = 3;
+        SetVertex(s, 0, va, 1.0f - v - w);
+        SetVertex(s, 1, vb, v);
+        SetVertex(s, 2, vc, w);
+        return XMVectorAdd(a, XMVectorAdd(XMVectorScale(ab, v), XMVectorScale(ac, w)));
+    }
+
+    /**
+     * @brief 四面体上で原点に最も近い点。原点を内包する場合は count = 4 のまま零ベクトルを返す
+     */
+    XMVECTOR SolveTetrahedron(Simplex& s)
+    {
+        const SupportVertex v[4] = { s.vertices[0], s.vertices[1], s.vertices[2], s.vertices[3] };
+
+        // 各面と、その反対側の頂点
+        static constexpr int FACES[4][4] = {
+            { 0, 1, 2, 3 },
+            { 0, 2, 3, 1 },
+            { 0, 3, 1, 2 },
+            { 1, 3, 2, 0 },
+        };
+
+        bool isInside = true;
+        float bestDistSq = FLT_MAX;
+        XMVECTOR bestPoint = XMVectorZero();
+        Simplex best;
+
+        for (const auto& f : FACES)
+        {
+            XMVECTOR a = v[f[0]].w;
+            XMVECTOR n = XMVector3Cross(XMVectorSubtract(v[f[1]].w, a), XMVectorSubtract(v[f[2]].w, a));
+            const float signOrigin = Dot3(n, XMVectorNegate(a));
+            const float signOpposite = Dot3(n, XMVectorSubtract(v[f[3]].w, a));
+
+            // 原点が反対頂点と同じ側なら、この面の外にはいない（退化した四面体は全面を調べる）
+            const bool isDegenerate = std::abs(signOpposite) < EPSILON * EPSILON;
+            if (!isDegenerate && signOrigin * signOpposite > 0.0f) continue;
+
+            isInside = false;
+            Simplex candidate;
+            XMVECTOR point = SolveTriangle(candidate, v[f[0]], v[f[1]], v[f[2]]);
+            const float distSq = Dot3(point, point);
+            if (distSq < bestDistSq)
+            {
+                bestDistSq = distSq;
+                bestPoint = point;
+                best = candidate;
+            }
+        }
+
+        if (isInside)
+        {
+            for (int i = 0; i < 4; ++i) s.lambda[i] = 0.25f;
+            return XMVectorZero();
+        }
+
+        s = best;
+        return bestPoint;
+    }
+
+    /**
+     * @brief 四面体の体積が辺の長さに比べて無視できるほど小さいか
+     */
+    bool IsFlatTetrahedron(const Simplex& s)
+    {
+        const XMVECTOR e0 = XMVectorSubtract(s.vertices[1].w, s.vertices[0].w);
+        const XMVECTOR e1 = XMVectorSubtract(s.vertices[2].w, s.vertices[0].w);
+        const XMVECTOR e2 = XMVectorSubtract(s.vertices[3].w, s.vertices[0].w);
+        const float volume = std::abs(Dot3(e0, XMVector3Cross(e1, e2)));
+        const float scale = std::sqrt(Dot3(e0, e0) * Dot3(e1, e1) * Dot3(e2, e2));
+        return volume <= GjkConfig::FLAT_TETRAHEDRON_EPSILON * scale;
+    }
+
+    XMVECTOR SolveSimplex(Simplex& s)
+    {
+        switch (s.count)
+        {
+            case 1:
+                s.lambda[0] = 1.0f;
+                return s.vertices[0].w;
+            case 2:
+                return SolveSegment(s, s.vertices[0], s.vertices[1]);
+            case 3:
+                return SolveTriangle(s, s.vertices[0], s.vertices[1], s.vertices[2]);
+            default:
+                return SolveTetrahedron(s);
+        }
+    }
+
+    /**
+     * @brief 芯同士の GJK（距離と最近点、重なり時は原点を含む単体）
+     */
+    GjkResult RunGjk(const ConvexShape& a, const ConvexShape& b)
+    {
+        GjkResult result;
+        Simplex& s = result.simplex;
+
+        XMVECTOR dir = XMVectorSubtract(a.GetCenter(), b.GetCenter());
+        if (Dot3(dir, dir) < EPSILON)
+        {
+            dir = XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
+        }
+
+        s.count = 1;
+        SetVertex(s, 0, SupportCore(a, b, dir), 1.0f);
+        XMVECTOR v = s.vertices[0].w;
+
+        for (int iter = 0; iter < GjkConfig::MAX_GJK_ITERATIONS; ++iter)
+        {
+            const float vv = Dot3(v, v);
+            if (vv < GjkConfig::CORE_OVERLAP_DISTANCE * GjkConfig::CORE_OVERLAP_DISTANCE)
+            {
+                result.isOverlap = true;
+                break;
+            }
+
+            SupportVertex w = SupportCore(a, b, XMVectorNegate(v));
+
+            // これ以上原点に近づかない
+            if (vv - Dot3(v, w.w) <= GjkConfig::GJK_TOLERANCE * vv) break;
+
+            // 同じ頂点を再度得た場合も収束とみなす
+            bool isDuplicate = false;
+            for (int i = 0; i < s.count; ++i)
+            {
+                if (XMVector3NearEqual(s.vertices[i].w, w.w, XMVectorReplicate(EPSILON))) { isDuplicate = true; break; }
+            }
+            if (isDuplicate) break;
+
+            const Simplex previous = s;
+            s.vertices[s.count++] = w;
+            const XMVECTOR next = SolveSimplex(s);
+
+            if (s.count == 4)
+            {
+                // 新しい点が単体の面上に載っただけの潰れた四面体は、丸め誤差で原点を含むと判定されうる
+                if (IsFlatTetrahedron(s))
+                {
+                    s = previous;
+                    break;
+                }
+                result.isOverlap = true;
+                break;
+            }
+
+            // 丸め誤差で原点から遠ざかった場合は直前の単体で打ち切る（同じ単体を往復して収束しなくなるのを防ぐ）
+            if (Dot3(next, next) >= vv)
+            {
+                s = previous;
+                break;
+            }
+            v = next;
+        }
+
+        // 重心座標から各形状上の最近点を復元
+        result.pointA = XMVectorZero();
+        result.pointB = XMVectorZero();
+        for (int i = 0; i < s.count; ++i)
+        {
+            result.pointA = XMVectorAdd(result.pointA, XMVectorScale(s.vertices[i].a, s.lambda[i]));
+            result.pointB = XMVectorAdd(result.pointB, XMVectorScale(s.vertices[i].b, s.lambda[i]));
+        }
+        result.distance = result.isOverlap ? 0.0f : std::sqrt(Dot3(v, v));
+        return result;
+    }
+
+    /**
+     * @brief GJK 終了時の単体を、原点を囲む四面体まで膨らませる
+     * @return 体積のある四面体を作れなかった（接しているだけ）場合は false
+     */
+    bool BuildInitialTetrahedron(const ConvexShape& a, const ConvexShape& b, Simplex& s)
+    {
+        static const XMVECTOR AXES[3] = {
+            XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f),
+            XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f),
+            XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f),
+        };
+
+        // 芯の頂点を丸み込みの支持点に置き換える必要はない（内側の点でもEPAは外側へ広がる）
+        while (s.count < 4)
+        {
+            XMVECTOR candidates[6];
+            int candidateCount = 0;
+
+            if (s.count == 1)
+            {
+                for (const XMVECTOR& axis : AXES)
+                {
+                    candidates[candidateCount++] = axis;
+                    candidates[candidateCount++] = XMVectorNegate(axis);
+                }
+            }
+            else if (s.count == 2)
+            {
+                XMVECTOR d = XMVectorSubtract(s.vertices[1].w, s.vertices[0].w);
+                XMVECTOR absD = XMVectorAbs(d);
+                // 最も直交に近い座標軸を使って垂直方向を作る
+                int axisIndex = 0;
+                if (XMVectorGetY(absD) < XMVectorGetX(absD)) axisIndex = 1;
+                if (XMVectorGetZ(absD) < XMVectorGetByIndex(absD, axisIndex)) axisIndex = 2;
+                XMVECTOR perp1 = XMVector3Cross(d, AXES[axisIndex]);
+                XMVECTOR perp2 = XMVector3Cross(d, perp1);
+                candidates[candidateCount++] = perp1;
+                candidates[candidateCount++] = XMVectorNegate(perp1);
+                candidates[candidateCount++] = perp2;
+                candidates[candidateCount++] = XMVectorNegate(perp2);
+            }
+            else
+            {
+                XMVECTOR n = XMVector3Cross(XMVectorSubtract(s.vertices[1].w, s.vertices[0].w),
+                                            XMVectorSubtract(s.vertices[2].w, s.vertices[0].w));
+                candidates[candidateCount++] = n;
+                candidates[candidateCount++] = XMVectorNegate(n);
+            }
+
+            bool isAdded = false;
+            for (int i = 0; i < candidateCount && !isAdded; ++i)
+            {
+                SupportVertex w = SupportFull(a, b, candidates[i]);
+                XMVECTOR offset = XMVectorSubtract(w.w, s.vertices[0].w);
+
+                float spread = 0.0f;
+                if (s.count == 1)
+                {
+                    spread = Dot3(offset, offset);
+                }
+                else if (s.count == 2)
+                {
+                    XMVECTOR c = XMVector3Cross(XMVectorSubtract(s.vertices[1].w, s.vertices[0].w), offset);
+                    spread = Dot3(c, c);
+                }
+                else
+                {
+                    XMVECTOR n = XMVector3Cross(XMVectorSubtract(s.vertices[1].w, s.vertices[0].w),
+                                                XMVectorSubtract(s.vertices[2].w, s.vertices[0].w));
+                    spread = std::abs(Dot3(n, offset));
+                }
+
+                if (spread > EPSILON * EPSILON)
+                {
+                    s.vertices[s.count++] = w;
+                    isAdded = true;
+                }
+            }
+
+            if (!isAdded) return false;
+        }
+        return true;
+    }
+
+    bool MakeFace(const std::vector<SupportVertex>& vertices, int i0, int i1, int i2, EpaFace& outFace)
+    {
+        XMVECTOR a = vertices[i0].w;
+        XMVECTOR n = XMVector3Cross(XMVectorSubtract(vertices[i1].w, a), XMVectorSubtract(vertices[i2].w, a));
+        const float lengthSq = Dot3(n, n);
+        if (lengthSq < EPSILON * EPSILON) return false;
+
+        n = XMVectorScale(n, 1.0f / std::sqrt(lengthSq));
+        outFace.index[0] = i0;
+        outFace.index[1] = i1;
+        outFace.index[2] = i2;
+        outFace.normal = n;
+        outFace.distance = Dot3(n, a);
+        outFace.isAlive = true;
+        return true;
+    }
+
+    void AddHorizonEdge(std::vector<EpaEdge>& edges, int from, int to)
+    {
+        // 逆向きの辺が既にあれば両面から見える内部の辺なので取り除く
+        for (auto it = edges.begin(); it != edges.end(); ++it)
+        {
+            if (it->from == to && it->to == from)
+            {
+                edges.erase(it);
+                return;
+            }
+        }
+        edges.push_back({ from, to });
+    }
+
+    /**
+     * @brief EPA で最小めり込み方向を求める
+     * @param[out] outNormal   A-B 上で原点から最も近い面の法線（A を -normal 方向へ動かすと離れる）
+     */
+    bool RunEpa(const ConvexShape& a, const ConvexShape& b, const Simplex& simplex,
+        XMVECTOR& outNormal, float& outDepth, XMVECTOR& outPointA, XMVECTOR& outPointB)
+    {
+        thread_local std::vector<SupportVertex> vertices;
+        thread_local std::vector<EpaFace> faces;
+        thread_local std::vector<EpaEdge> horizon;
+        vertices.assign(simplex.vertices, simplex.vertices + 4);
+        faces.clear();
+
+        // 外向きの四面体
+        static constexpr int TETRA[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+        for (const auto& t : TETRA)
+        {
+            EpaFace face;
+            int i1 = t[1], i2 = t[2];
+            XMVECTOR n = XMVector3Cross(XMVectorSubtract(vertices[i1].w, vertices[t[0]].w),
+                                        XMVectorSubtract(vertices[i2].w, vertices[t[0]].w));
+            if (Dot3(n, XMVectorSubtract(vertices[t[3]].w, vertices[t[0]].w)) > 0.0f) std::swap(i1, i2);
+            if (!MakeFace(vertices, t[0], i1, i2, face)) return false;
+            faces.push_back(face);
+        }
+
+        EpaFace* closest = nullptr;
+        for (int iter = 0; iter < GjkConfig::MAX_EPA_ITERATIONS; ++iter)
+        {
+            closest = nullptr;
+            for (EpaFace& face : faces)
+            {
+                if (face.isAlive && (!closest || face.distance < closest->distance)) closest = &face;
+            }
+            if (!closest) return false;
+
+            SupportVertex w = SupportFull(a, b, closest->normal);
+            if (Dot3(w.w, closest->normal) - closest->distance < GjkConfig::EPA_TOLERANCE) break;
+            if (static_cast<int>(faces.size()) >= GjkConfig::MAX_EPA_FACES) break;
+
+            // 新しい点から見える面を取り除き、地平線の辺を集める
+            horizon.clear();
+            for (EpaFace& face : faces)
+            {
+                if (!face.isAlive) continue;
+                if (Dot3(face.normal, XMVectorSubtract(w.w, vertices[face.index[0]].w)) <= 0.0f) continue;
+
+                face.isAlive = false;
+                AddHorizonEdge(horizon, face.index[0], face.index[1]);
+                AddHorizonEdge(horizon, face.index[1], face.index[2]);
+                AddHorizonEdge(horizon, face.index[2], face.index[0]);
+            }
+
+            const int newIndex = static_cast<int>(vertices.size());
+            vertices.push_back(w);
+            for (const EpaEdge& edge : horizon)
+            {
+                EpaFace face;
+                if (MakeFace(vertices, edge.from, edge.to, newIndex, face))
+                {
+                    faces.push_back(face);
+                }
+            }
+            closest = nullptr;
+        }
+
+        if (!closest)
+        {
+            for (EpaFace& face : faces)
+            {
+                if (face.isAlive && (!closest || face.distance < closest->distance)) closest = &face;
+            }
+            if (!closest) return false;
+        }
+
+        // 原点の面への射影を重心座標で表し、各形状上の点を復元
+        const SupportVertex& v0 = vertices[closest->index[0]];
+        const SupportVertex& v1 = vertices[closest->index[1]];
+        const SupportVertex& v2 = vertices[closest->index[2]];
+        XMVECTOR p = XMVectorScale(closest->normal, closest->distance);
+        XMVECTOR e0 = XMVectorSubtract(v1.w, v0.w);
+        XMVECTOR e1 = XMVectorSubtract(v2.w, v0.w);
+        XMVECTOR ep = XMVectorSubtract(p, v0.w);
+        const float d00 = Dot3(e0, e0), d01 = Dot3(e0, e1), d11 = Dot3(e1, e1);
+        const float d20 = Dot3(ep, e0), d21 = Dot3(ep, e1);
+        const float denom = d00 * d11 - d01 * d01;
+        float u = 1.0f / 3.0f, v = 1.0f / 3.0f;
+        if (std::abs(denom) > EPSILON * EPSILON)
+        {
+            u = (d11 * d20 - d01 * d21) / denom;
+            v = (d00 * d21 - d01 * d20) / denom;
+        }
+        const float t = 1.0f - u - v;
+
+        outNormal = closest->normal;
+        outDepth = std::max(closest->distance, 0.0f);
+        outPointA = XMVectorAdd(XMVectorScale(v0.a, t), XMVectorAdd(XMVectorScale(v1.a, u), XMVectorScale(v2.a, v)));
+        outPointB = XMVectorAdd(XMVectorScale(v0.b, t), XMVectorAdd(XMVectorScale(v1.b, u), XMVectorScale(v2.b, v)));
+        return true;
+    }
+}
+
+//======================================
+// ConvexShape
+//======================================
+XMVECTOR ConvexShape::SupportCore(FXMVECTOR dir) const
+{
+    switch (core)
+    {
+        case Core::Point:
+            return XMLoadFloat3(&points[0]);
+
+        case Core::Segment:
+        {
+            XMVECTOR p0 = XMLoadFloat3(&points[0]);
+            XMVECTOR p1 = XMLoadFloat3(&points[1]);
+            return (Dot3(p0, dir) >= Dot3(p1, dir)) ? p0 : p1;
+        }
+
+        case Core::Box:
+        {
+            XMVECTOR result = XMLoadFloat3(&center);
+            const float e[3] = { extents.x, extents.y, extents.z };
+            for (int i = 0; i < 3; ++i)
+            {
+                XMVECTOR axis = XMLoadFloat3(&axes[i]);
+                const float sign = (Dot3(axis, dir) >= 0.0f) ? 1.0f : -1.0f;
+                result = XMVectorAdd(result, XMVectorScale(axis, e[i] * sign));
+            }
+            return result;
+        }
+
+        case Core::Polytope:
+        default:
+        {
+            if (hullPoints)
+            {
+                // 方向をローカルへ戻して頂点を探す
+                XMVECTOR q = XMLoadFloat4(&orientation);
+                XMVECTOR localDir = XMVector3InverseRotate(dir, q);
+                int bestIndex = 0;
+                float bestDot = -FLT_MAX;
+                for (int i = 0; i < hullPointCount; ++i)
+                {
+                    const float d = Dot3(XMLoadFloat3(&hullPoints[i]), localDir);
+                    if (d > bestDot) { bestDot = d; bestIndex = i; }
+                }
+                return XMVectorAdd(XMVector3Rotate(XMLoadFloat3(&hullPoints[bestIndex]), q), XMLoadFloat3(&center));
+            }
+
+            XMVECTOR best = XMLoadFloat3(&points[0]);
+            float bestDot = Dot3(best, dir);
+            for (int i = 1; i < pointCount; ++i)
+            {
+                XMVECTOR p = XMLoadFloat3(&points[i]);
+                const float d = Dot3(p, dir);
+                if (d > bestDot) { bestDot = d; best = p; }
+            }
+            return best;
+        }
+    }
+}
+
+XMVECTOR ConvexShape::Support(FXMVECTOR dir) const
+{
+    XMVECTOR p = SupportCore(dir);
+    if (radius > 0.0f)
+    {
+        const float lengthSq = Dot3(dir, dir);
+        if (lengthSq > EPSILON * EPSILON)
+        {
+            p = XMVectorAdd(p, XMVectorScale(dir, radius / std::sqrt(lengthSq)));
+        }
+    }
+    return p;
+}
+
+XMVECTOR ConvexShape::GetCenter() const
+{
+    switch (core)
+    {
+        case Core::Point:
+            return XMLoadFloat3(&points[0]);
+        case Core::Segment:
+            return XMVectorScale(XMVectorAdd(XMLoadFloat3(&points[0]), XMLoadFloat3(&points[1])), 0.5f);
+        case Core::Box:
+            return XMLoadFloat3(&center);
+        case Core::Polytope:
+        default:
+        {
+            if (hullPoints) return XMLoadFloat3(&center);
+
+            XMVECTOR sum = XMVectorZero();
+            for (int i = 0; i < pointCount; ++i) sum = XMVectorAdd(sum, XMLoadFloat3(&points[i]));
+            return XMVectorScale(sum, 1.0f / static_cast<float>(std::max(pointCount, 1)));
+        }
+    }
+}
+
+//======================================
+// 形状変換
+//======================================
+ConvexShape Collision_MakeConvexShape(const Collider& collider)
+{
+    ConvexShape shape;
+
+    switch (collider.type)
+    {
+        case ColliderType::Sphere:
+            shape.core = ConvexShape::Core::Point;
+            shape.points[0] = collider.sphere.center;
+            shape.radius = collider.sphere.radius;
+            break;
+
+        case ColliderType::Capsule:
+            shape.core = ConvexShape::Core::Segment;
+            shape.points[0] = collider.capsule.start;
+            shape.points[1] = collider.capsule.end;
+            shape.pointCount = 2;
+            shape.radius = collider.capsule.radius;
+            break;
+
+        case ColliderType::Box:
+        {
+            shape.core = ConvexShape::Core::Box;
+            shape.center = collider.obb.center;
+            shape.extents = collider.obb.extents;
+            XMMATRIX rot = XMMatrixRotationQuaternion(XMLoadFloat4(&collider.obb.orientation));
+            for (int i = 0; i < 3; ++i) XMStoreFloat3(&shape.axes[i], rot.r[i]);
+            break;
+        }
+
+        case ColliderType::AABB:
+            shape.core = ConvexShape::Core::Box;
+            shape.center = collider.aabb.GetCenter();
+            shape.extents = collider.aabb.GetSize();
+            shape.extents = { shape.extents.x * 0.5f, shape.extents.y * 0.5f, shape.extents.z * 0.5f };
+            shape.axes[0] = { 1.0f, 0.0f, 0.0f };
+            shape.axes[1] = { 0.0f, 1.0f, 0.0f };
+            shape.axes[2] = { 0.0f, 0.0f, 1.0f };
+            break;
+
+        case ColliderType::Triangle:
+            shape.core = ConvexShape::Core::Polytope;
+            shape.points[0] = collider.triangle.p0;
+            shape.points[1] = collider.triangle.p1;
+            shape.points[2] = collider.triangle.p2;
+            shape.pointCount = 3;
+            break;
+
+        case ColliderType::ConvexHull:
+            shape.core = ConvexShape::Core::Polytope;
+            shape.hullPoints = collider.hull.points;
+            shape.hullPointCount = collider.hull.pointCount;
+            shape.center = collider.hull.center;
+            shape.orientation = collider.hull.orientation;
+            break;
+    }
+
+    return shape;
+}
+
+//======================================
+// 判定
+//======================================
+Hit Collision_DetectGJK(const ConvexShape& a, const ConvexShape& b)
+{
+    Hit hit;
+    const float margin = a.radius + b.radius;
+
+    GjkResult gjk = RunGjk(a, b);
+
+    // 芯が離れている：丸みの分だけの浅い接触は最近点から直接求める
+    if (!gjk.isOverlap && gjk.distance > GjkConfig::CORE_OVERLAP_DISTANCE)
+    {
+        if (gjk.distance >= margin) return hit;
+
+        XMVECTOR n = XMVectorScale(XMVectorSubtract(gjk.pointA, gjk.pointB), 1.0f / gjk.distance);
+        XMVECTOR surfaceA = XMVectorSubtract(gjk.pointA, XMVectorScale(n, a.radius));
+        XMVECTOR surfaceB = XMVectorAdd(gjk.pointB, XMVectorScale(n, b.radius));
+
+        hit.isHit = true;
+        hit.depth = margin - gjk.distance;
+        XMStoreFloat3(&hit.normal, n);
+        XMStoreFloat3(&hit.contactPoint, XMVectorScale(XMVectorAdd(surfaceA, surfaceB), 0.5f));
+        return hit;
+    }
+
+    // 芯が重なっている：丸み込みの形状で EPA
+    Simplex simplex = gjk.simplex;
+    if (!BuildInitialTetrahedron(a, b, simplex)) return hit;
+
+    XMVECTOR normal, pointA, pointB;
+    float depth = 0.0f;
+    if (!RunEpa(a, b, simplex, normal, depth, pointA, pointB)) return hit;
+
+    hit.isHit = true;
+    hit.depth = depth;
+    XMStoreFloat3(&hit.normal, XMVectorNegate(normal));
+    XMStoreFloat3(&hit.contactPoint, XMVectorScale(XMVectorAdd(pointA, pointB), 0.5f));
+    return hit;
+}
+
+Hit Collision_DetectGJK(const Collider& colA, const Collider& colB)
+{
+    return Collision_DetectGJK(Collision_MakeConvexShape(colA), Collision_MakeConvexShape(colB));
+}
+
+float Collision_DistanceGJK(const ConvexShape& a, const ConvexShape& b, XMFLOAT3* outPointA, XMFLOAT3* outPointB)
+{
+    GjkResult gjk = RunGjk(a, b);
+    const float distance = gjk.isOverlap ? 0.0f : std::max(gjk.distance - a.radius - b.radius, 0.0f);
+
+    if (outPointA || outPointB)
+    {
+        XMVECTOR pointA = gjk.pointA;
+        XMVECTOR pointB = gjk.pointB;
+        if (!gjk.isOverlap && gjk.distance > GjkConfig::CORE_OVERLAP_DISTANCE)
+        {
+            XMVECTOR n = XMVectorScale(XMVectorSubtract(gjk.pointA, gjk.pointB), 1.0f / gjk.distance);
+            pointA = XMVectorSubtract(pointA, XMVectorScale(n, a.radius));
+            pointB = XMVectorAdd(pointB, XMVectorScale(n, b.radius));
+        }
+        if (outPointA) XMStoreFloat3(outPointA, pointA);
+        if (outPointB) XMStoreFloat3(outPointB, pointB);
+    }
+    return distance;
+}
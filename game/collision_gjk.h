@@ -0,0 +1,108 @@
+﻿/****************************************
+ * @file    collision_gjk.h
+ * @brief   サポート写像による汎用凸形状判定（GJK / EPA）
+ * @detail  球・カプセル・OBB・AABB・三角形・凸包をサポート写像で統一的に扱い、
+ *          GJKで距離／交差を、EPAでめり込み深さと法線を求める。
+ *          専用の解析関数がある組み合わせは Collision_Detect 側でそちらを優先する
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+#ifndef COLLISION_GJK_H
+#define COLLISION_GJK_H
+
+#include <DirectXMath.h>
+#include "collision.h"
+
+struct Collider;
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace GjkConfig
+{
+    constexpr int MAX_GJK_ITERATIONS = 32;
+    constexpr int MAX_EPA_ITERATIONS = 48;
+    constexpr int MAX_EPA_FACES = 128;
+
+    // 収束判定（距離の2乗に対する相対誤差）
+    constexpr float GJK_TOLERANCE = 1e-6f;
+    // EPAの収束判定（距離）
+    constexpr float EPA_TOLERANCE = 1e-4f;
+    // 芯同士がこれ以下の距離なら重なりとみなしEPAへ移る
+    constexpr float CORE_OVERLAP_DISTANCE = 1e-5f;
+    // 体積 / 3辺の長さの積 がこれ以下の四面体は潰れているとみなし、原点の内包判定に使わない
+    constexpr float FLAT_TETRAHEDRON_EPSILON = 1e-6f;
+}
+
+//--------------------------------------
+// サポート写像で表した凸形状
+//--------------------------------------
+/**
+ * @struct ConvexShape
+ * @brief  芯（点・線分・多面体）と丸み半径の組で表した凸形状
+ * @detail 球は点＋半径、カプセルは線分＋半径として扱い、丸みは最後に加算する
+ */
+struct ConvexShape
+{
+    enum class Core
+    {
+        Point,      // points[0]
+        Segment,    // points[0] - points[1]
+        Box,        // center / axes / extents
+        Polytope,   // 頂点列（三角形・凸包）
+    };
+
+    Core core = Core::Point;
+    float radius = 0.0f;
+
+    // Point / Segment / 三角形
+    DirectX::XMFLOAT3 points[3]{};
+    int pointCount = 1;
+
+    // Box（軸は行ベクトル）
+    DirectX::XMFLOAT3 center{ 0.0f, 0.0f, 0.0f };
+    DirectX::XMFLOAT3 axes[3]{};
+    DirectX::XMFLOAT3 extents{ 0.0f, 0.0f, 0.0f };
+
+    // 凸包（頂点はローカル座標・外部所有）
+    const DirectX::XMFLOAT3* hullPoints = nullptr;
+    int hullPointCount = 0;
+    DirectX::XMFLOAT4 orientation{ 0.0f, 0.0f, 0.0f, 1.0f };
+
+    /**
+     * @brief 方向 dir に最も遠い芯上の点（丸みを含まない）
+     */
+    DirectX::XMVECTOR SupportCore(DirectX::FXMVECTOR dir) const;
+
+    /**
+     * @brief 方向 dir に最も遠い形状上の点（丸みを含む）
+     */
+    DirectX::XMVECTOR Support(DirectX::FXMVECTOR dir) const;
+
+    DirectX::XMVECTOR GetCenter() const;
+};
+
+//--------------------------------------
+// 判定関数プロトタイプ
+//--------------------------------------
+
+/**
+ * @brief コライダーをサポート写像形式へ変換
+ */
+ConvexShape Collision_MakeConvexShape(const Collider& collider);
+
+/**
+ * @brief GJK / EPA による交差判定
+ * @detail 法線は B→A、接触点は両形状の最近点の中点（Collision_Detect と同じ規約）
+ */
+Hit Collision_DetectGJK(const ConvexShape& a, const ConvexShape& b);
+Hit Collision_DetectGJK(const Collider& colA, const Collider& colB);
+
+/**
+ * @brief 2形状間の最短距離（重なっている場合は 0）
+ * @param[out] outPointA, outPointB 最近点（省略可）
+ */
+float Collision_DistanceGJK(const ConvexShape& a, const ConvexShape& b,
+    DirectX::XMFLOAT3* outPointA = nullptr, DirectX::XMFLOAT3* outPointB = nullptr);
+
+#endif // COLLISION_GJK_H
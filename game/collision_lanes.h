@@ -0,0 +1,135 @@
+﻿/****************************************
+ * @file    collision_lanes.h
+ * @brief   SoA 判定カーネル用のレーン演算
+ * @detail  命令セットごとに同じ名前の演算を持つ型を用意し、カーネルはテンプレートで共有する。
+ *          V はレーンの値、M は比較結果のマスク。判定カーネルの実装ファイルからのみ読み込む
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+#ifndef COLLISION_LANES_H
+#define COLLISION_LANES_H
+
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include "collision_packet.h"
+
+#if defined(COLLISION_PACKET_AVX2) || defined(COLLISION_PACKET_SSE)
+#include <immintrin.h>
+#endif
+
+namespace CollisionLanes
+{
+    struct ScalarLanes
+    {
+        using V = float;
+        using M = bool;
+        static constexpr int COUNT = 1;
+
+        static V Load(const float* p) { return *p; }
+        static V Set(float x) { return x; }
+        static void Store(float* p, V v) { *p = v; }
+        static V Add(V a, V b) { return a + b; }
+        static V Sub(V a, V b) { return a - b; }
+        static V Mul(V a, V b) { return a * b; }
+        static V Div(V a, V b) { return a / b; }
+        static V Sqrt(V a) { return std::sqrt(a); }
+        static V Min(V a, V b) { return std::min(a, b); }
+        static V Max(V a, V b) { return std::max(a, b); }
+        static V SafeInv(V d)
+        {
+            using namespace CollisionPacketConfig;
+            return (std::abs(d) < PARALLEL_EPSILON) ? std::copysign(PARALLEL_INV_DIR, d) : 1.0f / d;
+        }
+        static M Less(V a, V b) { return a < b; }
+        static M Greater(V a, V b) { return a > b; }
+        static V Select(M mask, V ifTrue, V ifFalse) { return mask ? ifTrue : ifFalse; }
+        static uint32_t Bits(M mask) { return mask ? 1u : 0u; }
+        static uint32_t LessEqualMask(V a, V b) { return (a <= b) ? 1u : 0u; }
+    };
+
+#ifdef COLLISION_PACKET_SSE
+    struct SseLanes
+    {
+        using V = __m128;
+        using M = __m128;
+        static constexpr int COUNT = 4;
+
+        static V Load(const float* p) { return _mm_loadu_ps(p); }
+        static V Set(float x) { return _mm_set1_ps(x); }
+        static void Store(float* p, V v) { _mm_storeu_ps(p, v); }
+        static V Add(V a, V b) { return _mm_add_ps(a, b); }
+        static V Sub(V a, V b) { return _mm_sub_ps(a, b); }
+        static V Mul(V a, V b) { return _mm_mul_ps(a, b); }
+        static V Div(V a, V b) { return _mm_div_ps(a, b); }
+        static V Sqrt(V a) { return _mm_sqrt_ps(a); }
+        static V Min(V a, V b) { return _mm_min_ps(a, b); }
+        static V Max(V a, V b) { return _mm_max_ps(a, b); }
+        static V SafeInv(V d)
+        {
+            using namespace CollisionPacketConfig;
+
+            // 平行な軸は符号付きの大きな値へ差し替える（SSE2 のみで書くため and/andnot で選択）
+            const V signMask = _mm_set1_ps(-0.0f);
+            const V isParallel = _mm_cmplt_ps(_mm_andnot_ps(signMask, d), _mm_set1_ps(PARALLEL_EPSILON));
+            const V big = _mm_or_ps(_mm_and_ps(d, signMask), _mm_set1_ps(PARALLEL_INV_DIR));
+            const V inv = _mm_div_ps(_mm_set1_ps(1.0f), d);
+            return Select(isParallel, big, inv);
+        }
+        static M Less(V a, V b) { return _mm_cmplt_ps(a, b); }
+        static M Greater(V a, V b) { return _mm_cmpgt_ps(a, b); }
+        static V Select(M mask, V ifTrue, V ifFalse) { return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse)); }
+        static uint32_t Bits(M mask) { return static_cast<uint32_t>(_mm_movemask_ps(mask)); }
+        static uint32_t LessEqualMask(V a, V b) { return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(a, b))); }
+    };
+#endif
+
+#ifdef COLLISION_PACKET_AVX2
+    struct Avx2Lanes
+    {
+        using V = __m256;
+        using M = __m256;
+        static constexpr int COUNT = 8;
+
+        static V Load(const float* p) { return _mm256_loadu_ps(p); }
+        static V Set(float x) { return _mm256_set1_ps(x); }
+        static void Store(float* p, V v) { _mm256_storeu_ps(p, v); }
+        static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+        static V Sub(V a, V b) { return _mm256_sub_ps(a, b); }
+        static V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+        static V Div(V a, V b) { return _mm256_div_ps(a, b); }
+        static V Sqrt(V a) { return _mm256_sqrt_ps(a); }
+        static V Min(V a, V b) { return _mm256_min_ps(a, b); }
+        static V Max(V a, V b) { return _mm256_max_ps(a, b); }
+        static V SafeInv(V d)
+        {
+            using namespace CollisionPacketConfig;
+
+            const V signMask = _mm256_set1_ps(-0.0f);
+            const V isParallel = _mm256_cmp_ps(_mm256_andnot_ps(signMask, d), _mm256_set1_ps(PARALLEL_EPSILON), _CMP_LT_OQ);
+            const V big = _mm256_or_ps(_mm256_and_ps(d, signMask), _mm256_set1_ps(PARALLEL_INV_DIR));
+            return _mm256_blendv_ps(_mm256_div_ps(_mm256_set1_ps(1.0f), d), big, isParallel);
+        }
+        static M Less(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        static M Greater(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+        static V Select(M mask, V ifTrue, V ifFalse) { return _mm256_blendv_ps(ifFalse, ifTrue, mask); }
+        static uint32_t Bits(M mask) { return static_cast<uint32_t>(_mm256_movemask_ps(mask)); }
+        static uint32_t LessEqualMask(V a, V b) { return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LE_OQ))); }
+    };
+#endif
+
+#if defined(COLLISION_PACKET_AVX2)
+    using NativeLanes = Avx2Lanes;
+#elif defined(COLLISION_PACKET_SSE)
+    using NativeLanes = SseLanes;
+#else
+    using NativeLanes = ScalarLanes;
+#endif
+
+    inline uint32_t LaneMask(int count)
+    {
+        return (count >= 32) ? 0xFFFFFFFFu : ((1u << count) - 1u);
+    }
+}
+
+#endif // COLLISION_LANES_H
@@ -0,0 +1,359 @@
+﻿/****************************************
+ * @file    collision_packet.cpp
+ * @brief   レイパケットと AABB / OBB の一括交差判定（SoA）の実装
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ * @update  2026/10/18 - レーン演算を collision_lanes.h へ分離
+ ****************************************/
+
+#include "collision_packet.h"
+#include "collision_lanes.h"
+#include "ray.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace DirectX;
+using namespace CollisionPacketConfig;
+using namespace CollisionLanes;
+
+//======================================
+// カーネル共通処理
+//======================================
+namespace
+{
+    // 全レーン共通の値は複製、レーンごとの値は配列から読む
+    template<class L, bool BROADCAST>
+    typename L::V Fetch(const float* p, int lane)
+    {
+        if constexpr (BROADCAST) return L::Set(p[0]);
+        else return L::Load(p + lane);
+    }
+
+    template<class L>
+    void Slab(typename L::V origin, typename L::V invDir, typename L::V boxMin, typename L::V boxMax,
+              typename L::V& tNear, typename L::V& tFar)
+    {
+        const typename L::V t1 = L::Mul(L::Sub(boxMin, origin), invDir);
+        const typename L::V t2 = L::Mul(L::Sub(boxMax, origin), invDir);
+        tNear = L::Max(tNear, L::Min(t1, t2));
+        tFar = L::Min(tFar, L::Max(t1, t2));
+    }
+
+    //--------------------------------------
+    // レイ側の入力（SoA の各配列、複製時は先頭1要素）
+    //--------------------------------------
+    struct RayLanes
+    {
+        const float* originX;
+        const float* originY;
+        const float* originZ;
+        const float* dirX;
+        const float* dirY;
+        const float* dirZ;
+        const float* invDirX;
+        const float* invDirY;
+        const float* invDirZ;
+        const float* maxDistance;
+    };
+
+    struct AABBLanes
+    {
+        const float* minX;
+        const float* minY;
+        const float* minZ;
+        const float* maxX;
+        const float* maxY;
+        const float* maxZ;
+    };
+
+    struct OBBLanes
+    {
+        const float* centerX;
+        const float* centerY;
+        const float* centerZ;
+        const float* axis[3][3];
+        const float* extents[3];
+    };
+
+    //--------------------------------------
+    // スラブ法カーネル
+    //--------------------------------------
+    template<class L, bool RAY_BROADCAST, bool BOX_BROADCAST>
+    uint32_t RayAABBKernel(const RayLanes& ray, const AABBLanes& box, int count, float* outDist)
+    {
+        uint32_t mask = 0;
+        for (int lane = 0; lane < count; lane += L::COUNT)
+        {
+            typename L::V tNear = L::Set(0.0f);
+            typename L::V tFar = Fetch<L, RAY_BROADCAST>(ray.maxDistance, lane);
+
+            Slab<L>(Fetch<L, RAY_BROADCAST>(ray.originX, lane), Fetch<L, RAY_BROADCAST>(ray.invDirX, lane),
+                    Fetch<L, BOX_BROADCAST>(box.minX, lane), Fetch<L, BOX_BROADCAST>(box.maxX, lane), tNear, tFar);
+            Slab<L>(Fetch<L, RAY_BROADCAST>(ray.originY, lane), Fetch<L, RAY_BROADCAST>(ray.invDirY, lane),
+                    Fetch<L, BOX_BROADCAST>(box.minY, lane), Fetch<L, BOX_BROADCAST>(box.maxY, lane), tNear, tFar);
+            Slab<L>(Fetch<L, RAY_BROADCAST>(ray.originZ, lane), Fetch<L, RAY_BROADCAST>(ray.invDirZ, lane),
+                    Fetch<L, BOX_BROADCAST>(box.minZ, lane), Fetch<L, BOX_BROADCAST>(box.maxZ, lane), tNear, tFar);
+
+            mask |= L::LessEqualMask(tNear, tFar) << lane;
+            if (outDist) L::Store(outDist + lane, tNear);
+        }
+        return mask & LaneMask(count);
+    }
+
+    // 軸は正規直交なのでローカル空間でも距離の尺度は変わらない
+    template<class L, bool RAY_BROADCAST, bool BOX_BROADCAST>
+    uint32_t RayOBBKernel(const RayLanes& ray, const OBBLanes& box, int count, float* outDist)
+    {
+        using V = typename L::V;
+
+        uint32_t mask = 0;
+        for (int lane = 0; lane < count; lane += L::COUNT)
+        {
+            const V px = L::Sub(Fetch<L, RAY_BROADCAST>(ray.originX, lane), Fetch<L, BOX_BROADCAST>(box.centerX, lane));
+            const V py = L::Sub(Fetch<L, RAY_BROADCAST>(ray.originY, lane), Fetch<L, BOX_BROADCAST>(box.centerY, lane));
+            const V pz = L::Sub(Fetch<L, RAY_BROADCAST>(ray.originZ, lane), Fetch<L, BOX_BROADCAST>(box.centerZ, lane));
+            const V dx = Fetch<L, RAY_BROADCAST>(ray.dirX, lane);
+            const V dy = Fetch<L, RAY_BROADCAST>(ray.dirY, lane);
+            const V dz = Fetch<L, RAY_BROADCAST>(ray.dirZ, lane);
+
+            V tNear = L::Set(0.0f);
+            V tFar = Fetch<L, RAY_BROADCAST>(ray.maxDistance, lane);
+
+            for (int k = 0; k < 3; ++k)
+            {
+                const V ax = Fetch<L, BOX_BROADCAST>(box.axis[k][0], lane);
+                const V ay = Fetch<L, BOX_BROADCAST>(box.axis[k][1], lane);
+                const V az = Fetch<L, BOX_BROADCAST>(box.axis[k][2], lane);
+
+                const V localOrigin = L::Add(L::Add(L::Mul(px, ax), L::Mul(py, ay)), L::Mul(pz, az));
+                const V localDir = L::Add(L::Add(L::Mul(dx, ax), L::Mul(dy, ay)), L::Mul(dz, az));
+                const V extent = Fetch<L, BOX_BROADCAST>(box.extents[k], lane);
+
+                Slab<L>(localOrigin, L::SafeInv(localDir), L::Sub(L::Set(0.0f), extent), extent, tNear, tFar);
+            }
+
+            mask |= L::LessEqualMask(tNear, tFar) << lane;
+            if (outDist) L::Store(outDist + lane, tNear);
+        }
+        return mask & LaneMask(count);
+    }
+
+    //--------------------------------------
+    // 単体の形状を「複製用の1要素配列」に展開
+    //--------------------------------------
+    struct SingleRay
+    {
+        float values[10];
+
+        SingleRay(const Ray& ray, float maxDist)
+        {
+            const XMFLOAT3 origin = ray.GetOrigin();
+            const XMFLOAT3 dir = ray.GetDirection();
+            values[0] = origin.x;
+            values[1] = origin.y;
+            values[2] = origin.z;
+            values[3] = dir.x;
+            values[4] = dir.y;
+            values[5] = dir.z;
+            values[6] = ScalarLanes::SafeInv(dir.x);
+            values[7] = ScalarLanes::SafeInv(dir.y);
+            values[8] = ScalarLanes::SafeInv(dir.z);
+            values[9] = maxDist;
+        }
+
+        RayLanes Lanes() const
+        {
+            return { &values[0], &values[1], &values[2], &values[3], &values[4], &values[5],
+                     &values[6], &values[7], &values[8], &values[9] };
+        }
+    };
+
+    RayLanes PacketLanes(const RayPacket& rays)
+    {
+        return { rays.originX, rays.originY, rays.originZ, rays.dirX, rays.dirY, rays.dirZ,
+                 rays.invDirX, rays.invDirY, rays.invDirZ, rays.maxDistance };
+    }
+
+    AABBLanes SingleAABBLanes(const AABB& aabb)
+    {
+        return { &aabb.min.x, &aabb.min.y, &aabb.min.z, &aabb.max.x, &aabb.max.y, &aabb.max.z };
+    }
+
+    AABBLanes PacketLanes(const AABBPacket& boxes)
+    {
+        return { boxes.minX, boxes.minY, boxes.minZ, boxes.maxX, boxes.maxY, boxes.maxZ };
+    }
+
+    struct SingleOBB
+    {
+        float center[3];
+        float axis[3][3];
+        float extents[3];
+
+        explicit SingleOBB(const OBB& obb)
+        {
+            const XMMATRIX rotation = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.orientation));
+            XMFLOAT3X3 axes;
+            XMStoreFloat3x3(&axes, rotation);
+
+            center[0] = obb.center.x;
+            center[1] = obb.center.y;
+            center[2] = obb.center.z;
+            for (int k = 0; k < 3; ++k)
+            {
+                axis[k][0] = axes.m[k][0];
+                axis[k][1] = axes.m[k][1];
+                axis[k][2] = axes.m[k][2];
+            }
+            extents[0] = obb.extents.x;
+            extents[1] = obb.extents.y;
+            extents[2] = obb.extents.z;
+        }
+
+        OBBLanes Lanes() const
+        {
+            OBBLanes lanes{};
+            lanes.centerX = &center[0];
+            lanes.centerY = &center[1];
+            lanes.centerZ = &center[2];
+            for (int k = 0; k < 3; ++k)
+            {
+                for (int c = 0; c < 3; ++c) lanes.axis[k][c] = &axis[k][c];
+                lanes.extents[k] = &extents[k];
+            }
+            return lanes;
+        }
+    };
+
+    OBBLanes PacketLanes(const OBBPacket& boxes)
+    {
+        OBBLanes lanes{};
+        lanes.centerX = boxes.centerX;
+        lanes.centerY = boxes.centerY;
+        lanes.centerZ = boxes.centerZ;
+        for (int k = 0; k < 3; ++k)
+        {
+            for (int c = 0; c < 3; ++c) lanes.axis[k][c] = boxes.axis[k][c];
+            lanes.extents[k] = boxes.extents[k];
+        }
+        return lanes;
+    }
+}
+
+//======================================
+// パケットの構築
+//======================================
+void RayPacket::Clear()
+{
+    std::memset(this, 0, sizeof(RayPacket));
+}
+
+void RayPacket::Set(int lane, const Ray& ray, float maxDist)
+{
+    const XMFLOAT3 origin = ray.GetOrigin();
+    const XMFLOAT3 dir = ray.GetDirection();
+
+    originX[lane] = origin.x;
+    originY[lane] = origin.y;
+    originZ[lane] = origin.z;
+    dirX[lane] = dir.x;
+    dirY[lane] = dir.y;
+    dirZ[lane] = dir.z;
+    invDirX[lane] = ScalarLanes::SafeInv(dir.x);
+    invDirY[lane] = ScalarLanes::SafeInv(dir.y);
+    invDirZ[lane] = ScalarLanes::SafeInv(dir.z);
+    maxDistance[lane] = maxDist;
+}
+
+bool RayPacket::Push(const Ray& ray, float maxDist)
+{
+    if (count >= WIDTH) return false;
+    Set(count++, ray, maxDist);
+    return true;
+}
+
+void AABBPacket::Clear()
+{
+    std::memset(this, 0, sizeof(AABBPacket));
+}
+
+void AABBPacket::Set(int lane, const AABB& aabb)
+{
+    minX[lane] = aabb.min.x;
+    minY[lane] = aabb.min.y;
+    minZ[lane] = aabb.min.z;
+    maxX[lane] = aabb.max.x;
+    maxY[lane] = aabb.max.y;
+    maxZ[lane] = aabb.max.z;
+}
+
+bool AABBPacket::Push(const AABB& aabb)
+{
+    if (count >= WIDTH) return false;
+    Set(count++, aabb);
+    return true;
+}
+
+void OBBPacket::Clear()
+{
+    std::memset(this, 0, sizeof(OBBPacket));
+}
+
+void OBBPacket::Set(int lane, const OBB& obb)
+{
+    const SingleOBB single(obb);
+
+    centerX[lane] = single.center[0];
+    centerY[lane] = single.center[1];
+    centerZ[lane] = single.center[2];
+    for (int k = 0; k < 3; ++k)
+    {
+        for (int c = 0; c < 3; ++c) axis[k][c][lane] = single.axis[k][c];
+        extents[k][lane] = single.extents[k];
+    }
+}
+
+bool OBBPacket::Push(const OBB& obb)
+{
+    if (count >= WIDTH) return false;
+    Set(count++, obb);
+    return true;
+}
+
+//======================================
+// 一括交差判定
+//======================================
+uint32_t Collision_IntersectRayPacketAABB(const RayPacket& rays, const AABB& aabb, float* outDist)
+{
+    return RayAABBKernel<NativeLanes, false, true>(PacketLanes(rays), SingleAABBLanes(aabb), rays.count, outDist);
+}
+
+uint32_t Collision_IntersectRayPacketOBB(const RayPacket& rays, const OBB& obb, float* outDist)
+{
+    const SingleOBB single(obb);
+    return RayOBBKernel<NativeLanes, false, true>(PacketLanes(rays), single.Lanes(), rays.count, outDist);
+}
+
+uint32_t Collision_IntersectRayAABBPacket(const Ray& ray, const AABBPacket& boxes, float* outDist, float maxDist)
+{
+    const SingleRay single(ray, maxDist);
+    return RayAABBKernel<NativeLanes, true, false>(single.Lanes(), PacketLanes(boxes), boxes.count, outDist);
+}
+
+uint32_t Collision_IntersectRayOBBPacket(const Ray& ray, const OBBPacket& boxes, float* outDist, float maxDist)
+{
+    const SingleRay single(ray, maxDist);
+    return RayOBBKernel<NativeLanes, true, false>(single.Lanes(), PacketLanes(boxes), boxes.count, outDist);
+}
+
+const char* Collision_GetPacketInstructionSet()
+{
+#if defined(COLLISION_PACKET_AVX2)
+    return "AVX2";
+#elif defined(COLLISION_PACKET_SSE)
+    return "SSE";
+#else
+    return "Scalar";
+#endif
+}
@@ -0,0 +1,145 @@
+﻿/****************************************
+ * @file    collision_packet.h
+ * @brief   レイパケットと AABB / OBB の一括交差判定（SoA）
+ * @detail  複数本のレイと1つの箱、または1本のレイと複数の箱を SoA に並べ、
+ *          スラブ法をレーン単位でまとめて計算する。
+ *          AVX2 が有効なら8レーン、SSE なら4レーン×2、どちらもなければスカラーで処理する。
+ *          結果は Collision_IntersectRayAABB と同じ（始点が箱の中なら距離 0）
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+#ifndef COLLISION_PACKET_H
+#define COLLISION_PACKET_H
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <cfloat>
+#include "collision.h"
+
+class Ray;
+
+//--------------------------------------
+// 命令セットの選択
+//--------------------------------------
+#if defined(__AVX2__)
+#define COLLISION_PACKET_AVX2 1
+#endif
+#if defined(__AVX2__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define COLLISION_PACKET_SSE 1
+#endif
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace CollisionPacketConfig
+{
+    // 1パケットのレーン数
+    constexpr int WIDTH = 8;
+    // 方向成分がこれ未満の軸は平行として扱う（スカラー版と同じ閾値）
+    constexpr float PARALLEL_EPSILON = 1e-6f;
+    // 平行な軸の逆数の代わりに使う大きな値（始点がスラブ外なら必ず外れる）
+    constexpr float PARALLEL_INV_DIR = 1e30f;
+}
+
+//--------------------------------------
+// SoA 形式のパケット
+//--------------------------------------
+/**
+ * @struct RayPacket
+ * @brief  最大 WIDTH 本のレイ（方向はそのままと逆数の両方を保持）
+ * @detail 距離は Ray の方向ベクトルの長さを単位とする。count 以降のレーンは結果から除く
+ */
+struct alignas(32) RayPacket
+{
+    float originX[CollisionPacketConfig::WIDTH];
+    float originY[CollisionPacketConfig::WIDTH];
+    float originZ[CollisionPacketConfig::WIDTH];
+    float dirX[CollisionPacketConfig::WIDTH];
+    float dirY[CollisionPacketConfig::WIDTH];
+    float dirZ[CollisionPacketConfig::WIDTH];
+    float invDirX[CollisionPacketConfig::WIDTH];
+    float invDirY[CollisionPacketConfig::WIDTH];
+    float invDirZ[CollisionPacketConfig::WIDTH];
+    float maxDistance[CollisionPacketConfig::WIDTH];
+    int count = 0;
+
+    RayPacket() { Clear(); }
+    void Clear();
+
+    /**
+     * @brief レーンにレイを設定（maxDistance を超える交差は外れ扱い）
+     */
+    void Set(int lane, const Ray& ray, float maxDist = FLT_MAX);
+    bool Push(const Ray& ray, float maxDist = FLT_MAX);
+};
+
+/**
+ * @struct AABBPacket
+ * @brief  最大 WIDTH 個の AABB（count 以降のレーンは結果から除く）
+ */
+struct alignas(32) AABBPacket
+{
+    float minX[CollisionPacketConfig::WIDTH];
+    float minY[CollisionPacketConfig::WIDTH];
+    float minZ[CollisionPacketConfig::WIDTH];
+    float maxX[CollisionPacketConfig::WIDTH];
+    float maxY[CollisionPacketConfig::WIDTH];
+    float maxZ[CollisionPacketConfig::WIDTH];
+    int count = 0;
+
+    AABBPacket() { Clear(); }
+    void Clear();
+    void Set(int lane, const AABB& aabb);
+    bool Push(const AABB& aabb);
+};
+
+/**
+ * @struct OBBPacket
+ * @brief  最大 WIDTH 個の OBB（軸は回転行列の行、count 以降のレーンは結果から除く）
+ */
+struct alignas(32) OBBPacket
+{
+    float centerX[CollisionPacketConfig::WIDTH];
+    float centerY[CollisionPacketConfig::WIDTH];
+    float centerZ[CollisionPacketConfig::WIDTH];
+    float axis[3][3][CollisionPacketConfig::WIDTH];    // [軸][成分][レーン]
+    float extents[3][CollisionPacketConfig::WIDTH];
+    int count = 0;
+
+    OBBPacket() { Clear(); }
+    void Clear();
+    void Set(int lane, const OBB& obb);
+    bool Push(const OBB& obb);
+};
+
+//--------------------------------------
+// 関数プロトタイプ
+//--------------------------------------
+/**
+ * @brief 複数本のレイと1つの AABB
+ * @param[out] outDist WIDTH 要素。当たったレーンの距離（nullptr 可、外れたレーンは不定）
+ * @return 当たったレーンのビットマスク
+ */
+uint32_t Collision_IntersectRayPacketAABB(const RayPacket& rays, const AABB& aabb, float* outDist = nullptr);
+
+/**
+ * @brief 複数本のレイと1つの OBB（各レイを OBB のローカル空間へ移して判定）
+ */
+uint32_t Collision_IntersectRayPacketOBB(const RayPacket& rays, const OBB& obb, float* outDist = nullptr);
+
+/**
+ * @brief 1本のレイと複数の AABB
+ */
+uint32_t Collision_IntersectRayAABBPacket(const Ray& ray, const AABBPacket& boxes, float* outDist = nullptr, float maxDist = FLT_MAX);
+
+/**
+ * @brief 1本のレイと複数の OBB
+ */
+uint32_t Collision_IntersectRayOBBPacket(const Ray& ray, const OBBPacket& boxes, float* outDist = nullptr, float maxDist = FLT_MAX);
+
+/**
+ * @brief 使用中の命令セット名（"AVX2" / "SSE" / "Scalar"）
+ */
+const char* Collision_GetPacketInstructionSet();
+
+#endif // COLLISION_PACKET_H
@@ -2,6 +2,7 @@
 
 #include "audio.h"
 #include "DirectXMath.h"
+#include "slot_map.h"
 #include "sprite_anim.h"
 #include "texture.h"
 
@@ -10,12 +11,11 @@ using namespace DirectX;
 struct Effect
 {
     XMFLOAT2 position;
-    bool isEnable;
-    int sprite_anim_id;
+    SlotHandle sprite_anim_id;
 };
 
 static constexpr int EFFECT_MAX = 256;
-static Effect g_Effects[EFFECT_MAX];
+static SlotMap<Effect> g_Effects;
 
 static int g_AnimPatternId = -1;
 static int g_EffectTexId = -1;
@@ -24,10 +24,9 @@ static int g_EffectSoundId = -1;
 
 void Effect_Initialize()
 {
-    for (Effect& effect : g_Effects)
-    {
-        effect.isEnable = false;
-    }
+    g_Effects.Clear();
+    g_Effects.Reserve(EFFECT_MAX);
+
     g_EffectTexId = Texture_Load(L"assets/Explosion.png");
     g_AnimPatternId = SpriteAnim_RegisterPattern(g_EffectTexId,
                                                  16, 4, 0.01f,
@@ -38,45 +37,39 @@ void Effect_Initialize()
 
 void Effect_Finalize()
 {
+    for (const Effect& effect : g_Effects)
+    {
+        SpriteAnim_DestroyPlayer(effect.sprite_anim_id);
+    }
+    g_Effects.Clear();
+
     UnloadAudio(g_EffectSoundId);
 }
 
 void Effect_Update(double)
 {
-    for (Effect& effect : g_Effects)
+    g_Effects.RemoveIf([](const Effect& effect)
     {
-        if (!effect.isEnable) continue;
+        if (!SpriteAnim_IsStopped(effect.sprite_anim_id)) return false;
 
-        if (SpriteAnim_IsStopped(effect.sprite_anim_id))
-        {
-            SpriteAnim_DestroyPlayer(effect.sprite_anim_id);
-            effect.isEnable = false;
-        }
-    }
+        SpriteAnim_DestroyPlayer(effect.sprite_anim_id);
+        return true;
+    });
 }
 
 void Effect_Draw()
 {
-    for (Effect& effect : g_Effects)
+    for (const Effect& effect : g_Effects)
     {
-        if (!effect.isEnable) continue;
-
         SpriteAnim_Draw(effect.sprite_anim_id, effect.position.x, effect.position.y, 64.0f, 64.0f);
     }
 }
 
 void Effect_Create(const XMFLOAT2& position)
 {
-    for (Effect& effect : g_Effects)
-    {
-        if (effect.isEnable) continue;
+    if (g_Effects.Size() >= EFFECT_MAX) return;
 
-        effect.isEnable = true;
-        effect.position = position;
-        effect.sprite_anim_id = SpriteAnim_CreatePlayer(g_AnimPatternId);
+    g_Effects.Insert({ position, SpriteAnim_CreatePlayer(g_AnimPatternId) });
 
-        PlayAudio(g_EffectSoundId, false);
-
-        break;
-    }
+    PlayAudio(g_EffectSoundId, false);
 }
@@ -1,6 +1,6 @@
 /**
  * @file effect.cpp
- * @brief GtFNgƂ̕`
+ * @brief エフェクトとの描画
  * @author Natsume Shidara
  * @date 2025/07/04
  */
@@ -1,6 +1,6 @@
 /**
  * @file fade.cpp
- * @brief tF[hCEAEg
+ * @brief フェードイン・アウト制御
  * @author Natsume Shidara
  * @date 2025/07/10
  */
@@ -1,23 +1,29 @@
 /****************************************
  * @file game.cpp
- * @brief Q[ǗNXiSŁj
+ * @brief ゲーム管理クラス（完全統合版）
  * @detail
- * - StageɂA[ii{4̕ǁj
- * - _GX|[VXe
- * - VhE}bvƕ`
- * - Bladeil̎_j
- * - |XgvZXiu[ʁj
+ * - Stageによるアリーナ（床＋4方向の壁）
+ * - ランダム敵スポーンシステム
+ * - シャドウマップ生成と描画
+ * - Blade統合（一人称視点）
+ * - ポストプロセス（ブラー効果）
  * @author Natsume Shidara
- * @update 2026/01/13 - Xe[W_X|[ǉ
- * @update 2026/01/13 - TEhΉEfobO@\
- * @update 2026/02/04 - p[eBNVXeǉ
- * @update 2026/02/06 - t@N^Ois擾̈ꌳE璷̍팸j
+ * @update 2026/01/13 - ステージ＆ランダムスポーン追加
+ * @update 2026/01/13 - サウンド対応・デバッグ機能分離
+ * @update 2026/02/04 - パーティクルシステム追加
+ * @update 2026/02/06 - リファクタリング（行列取得の一元化・冗長分岐の削減）
+ * @update 2026/10/18 - 剛体の積分をフレーム先頭で一括実行
+ * @update 2026/10/18 - 物理・敵・弾を固定タイムステップで更新
+ * @update 2026/10/18 - 破片予算の判定にカメラ位置を渡す
+ * @update 2026/10/18 - シーン問い合わせの初期化と毎フレームの更新
+ * @update 2026/10/18 - スプライトアニメの再生IDを世代付きハンドルへ変更
+ * @update 2026/10/18 - 剛体ストア・固定ステップのヘッダをリリースビルドでも読み込む
  ****************************************/
 
 #include "game.h"
 
  //--------------------------------------
- // VXeEʃwb_
+ // システム・共通ヘッダ
  //--------------------------------------
 #include "direct3d.h"
 #include "camera.h"
@@ -34,10 +40,13 @@
 #include "light_camera.h"
 
 //--------------------------------------
-// IuWFNgE}l[W[wb_
+// オブジェクト・マネージャーヘッダ
 //--------------------------------------
 #include "stage.h"
 #include "prop_manager.h"
+#include "scene_query.h"
+#include "rigid_body_store.h"
+#include "fixed_step.h"
 #include "player.h"
 #include "enemy.h"
 #include "enemy_bullet.h"
@@ -62,6 +71,7 @@
 
 #ifdef _DEBUG
 #include "debug_renderer.h"
+#include "slice_task_manager.h"
 #endif
 
 #include <cstdlib>
@@ -71,7 +81,7 @@
 using namespace DirectX;
 
 //--------------------------------------
-// 萔
+// 定数
 //--------------------------------------
 namespace
 {
@@ -105,10 +115,10 @@ namespace
 }
 
 //--------------------------------------
-// O[oϐ
+// グローバル変数
 //--------------------------------------
 static int g_BillboardTexId = -1;
-static int g_BillboardAnimId = -1;
+static SlotHandle g_BillboardAnimId;
 static int g_BillboardPatternId = -1;
 
 static float g_EnemySpawnTimer = 0.0f;
@@ -125,10 +135,11 @@ static bool g_IsDebugDraw = false;
 #endif
 
 //--------------------------------------
-// ֐vg^Cv
+// 内部関数プロトタイプ
 //--------------------------------------
 static void UpdateSystems(float dt);
 static void UpdateObjects(float dt);
+static void UpdateEffects(float dt);
 static void UpdateEnemySpawn(float dt);
 static void UpdateLightCamera();
 static void UpdateCollisions();
@@ -145,8 +156,8 @@ static void DrawDebugOverlay(const XMFLOAT4X4& mtxView, const XMFLOAT4X4& mtxPro
 #endif
 
 //--------------------------------------
-// r[EvWFNVs̈ꌳ擾
-//  fobOJ / vC[J̕1ӏɏW
+// ビュー・プロジェクション行列の一元取得
+// ※ デバッグカメラ / プレイヤーカメラの分岐を1箇所に集約
 //--------------------------------------
 static void GetActiveMatrices(XMFLOAT4X4& outView, XMFLOAT4X4& outProj)
 {
@@ -162,8 +173,22 @@ static void GetActiveMatrices(XMFLOAT4X4& outView, XMFLOAT4X4& outProj)
     outProj = PLCamera_GetPerspectiveMatrix();
 }
 
+//--------------------------------------
+// 描画に使用中のカメラ位置
+//--------------------------------------
+static const XMFLOAT3& GetActiveCameraPosition()
+{
+#ifdef _DEBUG
+    if (g_IsDebugCamera)
+    {
+        return Camera_GetPosition();
+    }
+#endif
+    return PLCamera_GetPosition();
+}
+
 //======================================
-// Q[
+// ゲーム初期化
 //======================================
 void Game_Initialize()
 {
@@ -171,11 +196,13 @@ void Game_Initialize()
 
     InputManager_Initialize();
     SpriteAnim_Initialize();
+    SceneQuery_Initialize();
 
     Stage_Initialize();
     PropManager_Initialize();
+    FixedStep_Reset();
 
-    // Ji萔obt@쐬̂߁A[XłKvj
+    // カメラ初期化（定数バッファ作成のため、リリースでも必要）
     Camera_Initialize();
 
 #ifdef _DEBUG
@@ -223,7 +250,7 @@ void Game_Initialize()
     g_IsDebugDraw = false;
 #endif
 
-    // GX|[
+    // 初期敵スポーン
     const XMFLOAT3 playerPos = Player_GetPosition();
     for (int i = 0; i < INITIAL_ENEMY_COUNT; i++)
     {
@@ -233,13 +260,13 @@ void Game_Initialize()
     SoundManager_PlayBGM(SOUND_BGM_GAME);
     Fade_Start(1.0, false);
 
-    // p[eBNG~b^[
+    // パーティクルエミッター初期化
     const XMVECTOR emitterPos = XMVectorSet(0.0f, 2.0f, 5.0f, 0.0f);
     g_pTestEmitter = new NormalEmitter(60, emitterPos, 1000.0, true);
 }
 
 //======================================
-// Q[I
+// ゲーム終了
 //======================================
 void Game_Finalize()
 {
@@ -267,6 +294,7 @@ void Game_Finalize()
     EnemyBullet_Finalize();
     Enemy_Finalize();
     Player_Finalize();
+    SceneQuery_Finalize();
 
     Camera_Finalize();
     PLCamera_Finalize();
@@ -276,7 +304,7 @@ void Game_Finalize()
 }
 
 //======================================
-// Q[XV
+// ゲーム更新
 //======================================
 void Game_Update(double elapsed_time)
 {
@@ -304,11 +332,23 @@ void Game_Update(double elapsed_time)
 
     g_GameElapsedTime += dt;
 
+    // 前フレームの移動と追加・除去されたマップオブジェクトを問い合わせへ反映
+    SceneQuery_Update();
+
     UpdateSystems(dt);
-    UpdateObjects(dt);
-    UpdateEnemySpawn(dt);
+
+    // シミュレーション（物理・敵・弾）は固定ステップで進め、描画は直前2ステップを補間する
+    const int stepCount = FixedStep_Advance(elapsed_time);
+    const float stepTime = FixedStep_GetDeltaTime();
+    for (int step = 0; step < stepCount; ++step)
+    {
+        UpdateObjects(stepTime);
+        UpdateEnemySpawn(stepTime);
+        UpdateCollisions();
+    }
+
+    UpdateEffects(dt);
     UpdateLightCamera();
-    UpdateCollisions();
 
 #ifdef _DEBUG
     ProcessDebugInput();
@@ -323,7 +363,7 @@ void Game_Update(double elapsed_time)
 }
 
 //--------------------------------------
-// VXeXV
+// システム更新
 //--------------------------------------
 static void UpdateSystems(float dt)
 {
@@ -344,19 +384,33 @@ static void UpdateSystems(float dt)
 }
 
 //--------------------------------------
-// IuWFNgXV
+// オブジェクト更新（固定ステップ）
 //--------------------------------------
 static void UpdateObjects(float dt)
 {
+    // 描画補間用に前ステップの姿勢を残してから進める
+    RigidBodyStore::SaveInterpolationState();
+
+    // 全剛体（破片・敵）の積分をSoAでまとめて行い、その後に各所の衝突処理を走らせる
+    RigidBodyStore::Integrate(dt);
+
     Stage_Update(dt);
+    PropManager_SetViewPosition(GetActiveCameraPosition());
     PropManager_Update(dt);
 
     Enemy_ProcessSliceResults();
 
     Enemy_Update(dt);
     EnemyBullet_Update(dt);
-    Light_Update(dt);
     Bullet_Update(dt);
+}
+
+//--------------------------------------
+// 演出更新（フレーム毎）
+//--------------------------------------
+static void UpdateEffects(float dt)
+{
+    Light_Update(dt);
     BulletHItEffect_Update(dt);
     Trail_Update(dt);
 
@@ -367,7 +421,7 @@ static void UpdateObjects(float dt)
 }
 
 //--------------------------------------
-// ݂̃X|[Ԋu擾
+// 現在のスポーン間隔を取得
 //--------------------------------------
 static float GetCurrentSpawnInterval()
 {
@@ -376,7 +430,7 @@ static float GetCurrentSpawnInterval()
 }
 
 //--------------------------------------
-// _ȓG^Cv擾
+// ランダムな敵タイプを取得
 //--------------------------------------
 static ENEMY_TYPE GetRandomEnemyType()
 {
@@ -385,7 +439,7 @@ static ENEMY_TYPE GetRandomEnemyType()
 }
 
 //--------------------------------------
-// GX|[
+// 敵スポーン処理
 //--------------------------------------
 static void UpdateEnemySpawn(float dt)
 {
@@ -407,7 +461,7 @@ static void UpdateEnemySpawn(float dt)
 }
 
 //--------------------------------------
-// CgJXV
+// ライトカメラ更新
 //--------------------------------------
 static void UpdateLightCamera()
 {
@@ -423,7 +477,7 @@ static void UpdateLightCamera()
 }
 
 //--------------------------------------
-// Փ˔菈
+// 衝突判定処理
 //--------------------------------------
 static void UpdateCollisions()
 {
@@ -439,7 +493,7 @@ static void UpdateCollisions()
 }
 
 //--------------------------------------
-// Q[I
+// ゲーム終了判定
 //--------------------------------------
 static void CheckGameEnd()
 {
@@ -470,7 +524,7 @@ static void CheckGameEnd()
 
 #ifdef _DEBUG
 //--------------------------------------
-// fobO͏
+// デバッグ入力処理
 //--------------------------------------
 static void ProcessDebugInput()
 {
@@ -495,11 +549,18 @@ static void ProcessDebugInput()
     {
         Enemy_Create(ENEMY_TYPE_FLYING, Stage_GetFlyingSpawnPosition(playerPos));
     }
+
+    // スライス処理の計測結果を出力
+    if (KeyLogger_IsTrigger(KK_I))
+    {
+        SliceTaskManager::PrintStats();
+        SliceTaskManager::DumpStatsCsv("slice_stats.csv");
+    }
 }
 #endif
 
 //======================================
-// VhE}bv`
+// シャドウマップ描画
 //======================================
 void Game_DrawShadow()
 {
@@ -511,7 +572,7 @@ void Game_DrawShadow()
 }
 
 //======================================
-// Q[`
+// ゲーム描画
 //======================================
 void Game_Draw()
 {
@@ -537,7 +598,7 @@ void Game_Draw()
 }
 
 //--------------------------------------
-// V[`
+// シーン描画
 //--------------------------------------
 static void DrawScene()
 {
@@ -552,13 +613,13 @@ static void DrawScene()
     Light_SetDirectional_World(LIGHT_DIRECTION, LIGHT_COLOR);
     Light_SetAmbient(AMBIENT_COLOR);
 
-    // XJC{bNXi[xeXgsvj
+    // スカイボックス（深度テスト不要）
     Direct3D_DepthStencilStateDepthIsEnable(false);
     Skybox_SetPosition(Player_GetPosition());
     Skybox_Draw();
     Direct3D_DepthStencilStateDepthIsEnable(true);
 
-    // sIuWFNg
+    // 不透明オブジェクト
     Stage_Draw();
     PropManager_Draw();
     Enemy_Draw();
@@ -567,11 +628,11 @@ static void DrawScene()
 
     Blade_Draw();
 
-    // EGtFNg
+    // 半透明・エフェクト
     BulletHItEffect_Draw();
     Trail_Draw();
 
-    // p[eBN`iZE[xݖj
+    // パーティクル描画（加算合成・深度書き込み無効）
     if (g_pTestEmitter)
     {
         Direct3D_SetDepthWriteEnable(false);
@@ -586,7 +647,7 @@ static void DrawScene()
 
 #ifdef _DEBUG
 //--------------------------------------
-// fobOI[o[C`
+// デバッグオーバーレイ描画
 //--------------------------------------
 static void DrawDebugOverlay(const XMFLOAT4X4& mtxView, const XMFLOAT4X4& mtxProj)
 {
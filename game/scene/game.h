@@ -1,6 +1,6 @@
 /**
  * @file game.h
- * @brief Q[̏
+ * @brief ゲームの処理
  * @author Natsume Shidara
  * @date 2025/07/01
  */
@@ -1,22 +1,22 @@
 /**
  * @file scene.cpp
- * @brief ʑJڂѕ`pCvCiShadowMapΉŁj
+ * @brief 画面遷移および描画パイプライン制御（ShadowMap対応版）
  * @author Natsume Shidara
  * @date 2025/07/10
- * @update 2026/01/12 - Resultʒǉ
- * @update 2026/01/13 - V[؂ւTEhZbgΉ
- * @update 2026/01/13 - Settingsʒǉ
+ * @update 2026/01/12 - Result画面追加
+ * @update 2026/01/13 - シーン切り替え時サウンドリセット対応
+ * @update 2026/01/13 - Settings画面追加
  */
 
 #include "scene.h"
 
- // eV[
+ // 各シーン
 #include "game.h"
 #include "title.h"
 #include "result.h"
 #include "settings.h"
 
-// `EVXe֘A
+// 描画・システム関連
 #include "direct3d.h"
 #include "render_target.h"
 #include "sprite.h"
@@ -25,35 +25,35 @@
 #include "shader_shadow_map.h"  
 #include "shader3d.h"
 
-// TEh
+// サウンド
 #include "sound_manager.h"
 
 //=============================================================================
-// ϐE萔
+// 内部変数・定数
 //=============================================================================
 static auto g_Scene = Scene::TITLE;
 static Scene g_SceneNext = g_Scene;
 
-// ItXN[_OpiVhE}bvpj
+// オフスクリーンレンダリング用（シャドウマップ用）
 static RenderTarget g_ShadowMap;
 
 //=============================================================================
-// ֐vg^Cv錾
+// 内部関数プロトタイプ宣言
 //=============================================================================
-static void DrawOffscreen();  // pX1: VhE}bv
-static void DrawMainScene();  // pX2: C`
-static void DrawUI();         // pX3: UI`
+static void DrawOffscreen();  // パス1: シャドウマップ生成
+static void DrawMainScene();  // パス2: メイン描画
+static void DrawUI();         // パス3: UI描画
 
 //=============================================================================
-// v֐
+// 主要関数実装
 //=============================================================================
 
 void Scene_Initialize()
 {
-    // VhE}bvi2048x2048, Shadow[hj
+    // シャドウマップ初期化（2048x2048, Shadowモード）
     g_ShadowMap.Initialize(8192, 8192, RenderTargetType::Shadow);
 
-    // VF[_[
+    // シェーダー初期化
     ShaderShadowMap_Initialize(Direct3D_GetDevice(), Direct3D_GetContext());
 
     switch (g_Scene)
@@ -95,13 +95,13 @@ void Scene_Update(double elapsed_time)
 
 void Scene_Draw()
 {
-    // 1. VhE}bvpX
+    // 1. シャドウマップ生成パス
     DrawOffscreen();
 
-    // 2. C`pX
+    // 2. メイン描画パス
     DrawMainScene();
 
-    // 3. UI`pX
+    // 3. UI描画パス
     DrawUI();
 }
 
@@ -109,7 +109,7 @@ void Scene_Refresh()
 {
     if (g_Scene != g_SceneNext)
     {
-        // TEhS~iBGMESEZbgj
+        // ★サウンドを全停止（BGM・SEをリセット）
         SoundManager_StopAll();
 
         Scene_Finalize();
@@ -124,27 +124,27 @@ void Scene_Change(Scene scene)
 }
 
 //=============================================================================
-// ֐
+// 内部関数実装
 //=============================================================================
 
 /**
- * @brief pX1: VhE}bv
+ * @brief パス1: シャドウマップ生成
  */
 static void DrawOffscreen()
 {
-    // 1. _[^[Qbg؂ւ & [xNA
+    // 1. レンダーターゲット切り替え & 深度クリア
     g_ShadowMap.Activate();
 
-    // 2. VhEpX^CUݒiVhEANlh~j
+    // 2. シャドウ用ラスタライザ設定（シャドウアクネ防止）
     Direct3D_SetRasterizerState_Shadow();
 
-    // 3. [xeXgL
+    // 3. 深度テスト有効化
     Direct3D_DepthStencilStateDepthIsEnable(true);
 
-    // 4. VhE}bvpVF[_[Jn
+    // 4. シャドウマップ用シェーダー開始
     ShaderShadowMap_Begin();
 
-    // 5. Cgr[vWFNVšvZƐݒ
+    // 5. ライトビュープロジェクション行列の計算と設定
     DirectX::XMMATRIX lightView = DirectX::XMLoadFloat4x4(&LightCamera_GetViewMatrix());
     DirectX::XMMATRIX lightProj = DirectX::XMLoadFloat4x4(&LightCamera_GetProjectionMatrix());
     DirectX::XMMATRIX lightVP = lightView * lightProj;
@@ -152,10 +152,10 @@ static void DrawOffscreen()
     DirectX::XMFLOAT4X4 matLightVP;
     DirectX::XMStoreFloat4x4(&matLightVP, lightVP);
 
-    // VF[_[萔obt@ɃZbg
+    // シェーダー定数バッファにセット
     ShaderShadowMap_SetLightViewProjection(matLightVP);
 
-    // 6. SIuWFNg̕`ie𗎂Ƃ̑Sāj
+    // 6. 全オブジェクトの描画（影を落とすもの全て）
     switch (g_Scene)
     {
     case Scene::TITLE:    Title_DrawShadow();    break;
@@ -165,12 +165,12 @@ static void DrawOffscreen()
     default: break;
     }
 
-    // 7. ݒɖ߂
+    // 7. 設定を元に戻す
     Direct3D_SetRasterizerState_Default();
 }
 
 /**
- * @brief pX2: C`
+ * @brief パス2: メイン描画
  */
 static void DrawMainScene()
 {
@@ -178,14 +178,14 @@ static void DrawMainScene()
     Direct3D_Clear();
     Direct3D_DepthStencilStateDepthIsEnable(true);
 
-    // CVF[_[Jn
+    // メインシェーダー開始
     Shader3D_Begin();
 
-    // CVF[_[ɉen
-    // 1. VhE}bveNX` (slot 1)
+    // メインシェーダーに影情報を渡す
+    // 1. シャドウマップテクスチャ (slot 1)
     Shader3D_SetShadowMap(g_ShadowMap.GetSRV());
 
-    // 2. Cgr[vWFNVs
+    // 2. ライトビュープロジェクション行列
     DirectX::XMMATRIX lightView = DirectX::XMLoadFloat4x4(&LightCamera_GetViewMatrix());
     DirectX::XMMATRIX lightProj = DirectX::XMLoadFloat4x4(&LightCamera_GetProjectionMatrix());
     DirectX::XMFLOAT4X4 matLightVP;
@@ -202,13 +202,13 @@ static void DrawMainScene()
     default: break;
     }
 
-    // oChiǂݏh~j
+    // バインド解除（読み書き競合防止）
     ID3D11ShaderResourceView* nullSRV = nullptr;
     Shader3D_SetShadowMap(nullSRV);
 }
 
 /**
- * @brief pX3: UI`
+ * @brief パス3: UI描画
  */
 static void DrawUI()
 {
@@ -216,13 +216,13 @@ static void DrawUI()
     Direct3D_SetBlendState(BlendMode::Alpha);
     Sprite_Begin();
 
-    // fobO\FVhE}bv̒gmF
-    // ɏ\āAeĂ邩`FbN
+    // デバッグ表示：シャドウマップの中身を確認
+    // 左上に小さく表示して、正しく影が生成されているかチェック
     ID3D11ShaderResourceView* pShadowSRV = g_ShadowMap.GetSRV();
     if (pShadowSRV)
     {
-        // [xobt@(R32_FLOAT)͐ԐɒlĂ̂ŁA
-        // ̂܂ܕ\Ɛԍ摜ɂȂ܂AdlłB
+        // 深度バッファ(R32_FLOAT)は赤成分に値が入っているので、
+        // そのまま表示すると赤黒い画像になりますが、仕様です。
         //Sprite_Draw(pShadowSRV, Direct3D_GetBackBufferWidth() - 200.0f, 0.0f, 200.0f, 200.0f);
     }
 
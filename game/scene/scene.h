@@ -1,9 +1,9 @@
 /**
  * @file scene.h
- * @brief V[Ǘ
+ * @brief シーン管理
  * @author Natsume Shidara
  * @date 2025/07/10
- * @update 2026/01/13 - Settingsʒǉ
+ * @update 2026/01/13 - Settings画面追加
  */
 
 #ifndef SCENE_H
@@ -14,7 +14,7 @@ enum class Scene
     TITLE,
     GAME,
     RESULT,
-    SETTINGS,  // ݒ
+    SETTINGS,  // 設定画面
 };
 
 void Scene_Initialize();
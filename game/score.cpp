@@ -1,9 +1,9 @@
 /****************************************
  * @file score.cpp
- * @brief XRAǗ̎
+ * @brief スコア管理の実装
  * @author Natsume Shidara
  * @date 2025/07/09
- * @update 2026/01/12 - ̋@ANVQ[pɉ
+ * @update 2026/01/12 - 立体機動アクションゲーム用に改造
  ****************************************/
 
 #include "score.h"
@@ -17,64 +17,64 @@
 using namespace DirectX;
 
 //======================================
-// 萔
+// 定数
 //======================================
 namespace
 {
-    // eNX`pX
+    // テクスチャパス
     constexpr const wchar_t* SCORE_TEXTURE_PATH = L"assets/ui/numbers.png";
 
-    // tHgTCYieNX`j
+    // フォントサイズ（テクスチャ内）
     constexpr int FONT_SRC_WIDTH = 89;
     constexpr int FONT_SRC_HEIGHT = 123;
 
-    // `XP[i1/4TCYŕ\j
+    // 描画スケール（1/4サイズで表示）
     constexpr float DRAW_SCALE = 0.25f;
 
-    // JEgAbvx
+    // カウントアップ速度
     constexpr unsigned int COUNT_UP_SPEED = 10;
 }
 
 //======================================
-// ϐ
+// 内部変数
 //======================================
-static unsigned int g_Score = 0;           // ۂ̃XRA
-static unsigned int g_ViewScore = 0;       // \pXRAiJEgAbvoj
-static unsigned int g_FinalScore = 0;      // ŏIXRAiUgpj
-static int g_Digit = 7;                    // \
-static unsigned int g_CounterStop = 9999999;  // ől
+static unsigned int g_Score = 0;           // 実際のスコア
+static unsigned int g_ViewScore = 0;       // 表示用スコア（カウントアップ演出）
+static unsigned int g_FinalScore = 0;      // 最終スコア（リザルト用）
+static int g_Digit = 7;                    // 表示桁数
+static unsigned int g_CounterStop = 9999999;  // 最大値
 static float g_PosX = 0.0f;
 static float g_PosY = 0.0f;
 static int g_ScoreTexId = -1;
 
 //======================================
-// ֐
+// 内部関数
 //======================================
 static void DrawNumber(float x, float y, int num, float sizeX, float sizeY)
 {
     if (g_ScoreTexId < 0) return;
 
-    // `TCYi1/4XP[Kpj
+    // 描画サイズ（1/4スケール適用）
     float drawW = FONT_SRC_WIDTH * DRAW_SCALE * sizeX;
     float drawH = FONT_SRC_HEIGHT * DRAW_SCALE * sizeY;
 
-    // `itXybNŁj
-    // : texid, x, y, uvX, uvY, uvW, uvH, drawW, drawH, angle, color
+    // 描画（フルスペック版）
+    // 引数順序: texid, x, y, uvX, uvY, uvW, uvH, drawW, drawH, angle, color
     Sprite_Draw(
         g_ScoreTexId,
         x, y,
-        static_cast<float>(FONT_SRC_WIDTH * num), 0.0f,  // UV؂蔲ʒu
-        static_cast<float>(FONT_SRC_WIDTH),               // UV
-        static_cast<float>(FONT_SRC_HEIGHT),              // UV
-        drawW,                                            // `敝
-        drawH,                                            // `捂
-        0.0f,                                             // px
-        XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f)                 // F
+        static_cast<float>(FONT_SRC_WIDTH * num), 0.0f,  // UV切り抜き位置
+        static_cast<float>(FONT_SRC_WIDTH),               // UV幅
+        static_cast<float>(FONT_SRC_HEIGHT),              // UV高さ
+        drawW,                                            // 描画幅
+        drawH,                                            // 描画高さ
+        0.0f,                                             // 角度
+        XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f)                 // 色
     );
 }
 
 //======================================
-// 
+// 初期化
 //======================================
 void Score_Initialize(float x, float y, int digit)
 {
@@ -86,7 +86,7 @@ void Score_Initialize(float x, float y, int digit)
 
     g_ScoreTexId = Texture_Load(SCORE_TEXTURE_PATH);
 
-    // JE^[XgbvlvZ
+    // カウンターストップ値を計算
     g_CounterStop = 1;
     for (int i = 0; i < digit; i++)
     {
@@ -96,7 +96,7 @@ void Score_Initialize(float x, float y, int digit)
 }
 
 //======================================
-// I
+// 終了処理
 //======================================
 void Score_Finalize()
 {
@@ -104,13 +104,13 @@ void Score_Finalize()
 }
 
 //======================================
-// XV
+// 更新
 //======================================
 void Score_Update(double elapsed_time)
 {
     (void)elapsed_time;
 
-    // JEgAbvo
+    // カウントアップ演出
     if (g_ViewScore < g_Score)
     {
         unsigned int diff = g_Score - g_ViewScore;
@@ -121,7 +121,7 @@ void Score_Update(double elapsed_time)
 }
 
 //======================================
-// `iʒuETCYwj
+// 描画（位置・サイズ指定）
 //======================================
 void Score_Draw(float x, float y, float sizeX, float sizeY)
 {
@@ -131,14 +131,14 @@ void Score_Draw(float x, float y, float sizeX, float sizeY)
 
     unsigned int temp = std::fminf(g_ViewScore, g_CounterStop);
 
-    // 1̕`敝iDRAW_SCALEKpj
+    // 1文字の描画幅（DRAW_SCALE適用）
     float charWidth = FONT_SRC_WIDTH * DRAW_SCALE * sizeX;
 
     for (int i = 0; i < g_Digit; i++)
     {
         int n = temp % 10;
 
-        // E`iEl߁j
+        // 右から描画（右詰め）
         float drawX = x + (g_Digit - 1 - i) * charWidth;
 
         DrawNumber(drawX, y, n, sizeX, sizeY);
@@ -147,7 +147,7 @@ void Score_Draw(float x, float y, float sizeX, float sizeY)
 }
 
 //======================================
-// `iŒʒuj
+// 描画（固定位置）
 //======================================
 void Score_Draw()
 {
@@ -155,7 +155,7 @@ void Score_Draw()
 }
 
 //======================================
-// XRA擾
+// スコア取得
 //======================================
 unsigned int Score_GetScore()
 {
@@ -163,7 +163,7 @@ unsigned int Score_GetScore()
 }
 
 //======================================
-// XRAZ
+// スコア加算
 //======================================
 void Score_AddScore(int value)
 {
@@ -171,7 +171,7 @@ void Score_AddScore(int value)
 }
 
 //======================================
-// XRAZbg
+// スコアリセット
 //======================================
 void Score_ResetScore()
 {
@@ -180,7 +180,7 @@ void Score_ResetScore()
 }
 
 //======================================
-// ŏIXRAۑiQ[Ij
+// 最終スコア保存（ゲーム終了時）
 //======================================
 void Score_SaveFinal()
 {
@@ -188,7 +188,7 @@ void Score_SaveFinal()
 }
 
 //======================================
-// ŏIXRA擾
+// 最終スコア取得
 //======================================
 unsigned int Score_GetFinalScore()
 {
@@ -196,7 +196,7 @@ unsigned int Score_GetFinalScore()
 }
 
 //======================================
-// UgʗpiXRAZbgȂj
+// リザルト画面用初期化（スコアをリセットしない）
 //======================================
 void Score_InitializeForResult(float x, float y, int digit)
 {
@@ -204,14 +204,14 @@ void Score_InitializeForResult(float x, float y, int digit)
     g_PosX = x;
     g_PosY = y;
 
-    // ŏIXRA\pɃZbg
+    // 最終スコアを表示用にセット
     g_Score = g_FinalScore;
-    g_ViewScore = 0;  // 0JEgAbvo
+    g_ViewScore = 0;  // 0からカウントアップ演出
 
-    // eNX`ǂݍ
+    // テクスチャ読み込み
     g_ScoreTexId = Texture_Load(SCORE_TEXTURE_PATH);
 
-    // JE^[XgbvlvZ
+    // カウンターストップ値を計算
     g_CounterStop = 1;
     for (int i = 0; i < digit; i++)
     {
@@ -1,84 +1,84 @@
 /****************************************
  * @file score.h
- * @brief XRAǗ
+ * @brief スコア管理
  * @author Natsume Shidara
  * @date 2025/07/09
- * @update 2026/01/12 - ̋@ANVQ[pɉ
+ * @update 2026/01/12 - 立体機動アクションゲーム用に改造
  ****************************************/
 
 #ifndef SCORE_H
 #define SCORE_H
 
  /**
-  * @brief XRA
-  * @param x \XW
-  * @param y \YW
-  * @param digit \
+  * @brief スコア初期化
+  * @param x 表示X座標
+  * @param y 表示Y座標
+  * @param digit 表示桁数
   */
 void Score_Initialize(float x, float y, int digit);
 
 /**
- * @brief XRAI
+ * @brief スコア終了処理
  */
 void Score_Finalize();
 
 /**
- * @brief XRAXViJEgAbvAj[Vj
- * @param elapsed_time f^^C
+ * @brief スコア更新（カウントアップアニメーション）
+ * @param elapsed_time デルタタイム
  */
 void Score_Update(double elapsed_time);
 
 /**
- * @brief XRA`ïʒuj
+ * @brief スコア描画（初期化時の位置）
  */
 void Score_Draw();
 
 /**
- * @brief XRA`iʒuETCYwj
- * @param x \XW
- * @param y \YW
- * @param sizeX XXP[
- * @param sizeY YXP[
+ * @brief スコア描画（位置・サイズ指定）
+ * @param x 表示X座標
+ * @param y 表示Y座標
+ * @param sizeX X方向スケール
+ * @param sizeY Y方向スケール
  */
 void Score_Draw(float x, float y, float sizeX = 1.0f, float sizeY = 1.0f);
 
 /**
- * @brief ݂̃XRA擾
- * @return XRAl
+ * @brief 現在のスコアを取得
+ * @return スコア値
  */
 unsigned int Score_GetScore();
 
 /**
- * @brief XRAZ
- * @param value Zl
+ * @brief スコアを加算
+ * @param value 加算値
  */
 void Score_AddScore(int value);
 
 /**
- * @brief XRAZbg
+ * @brief スコアをリセット
  */
 void Score_ResetScore();
 
 //--------------------------------------
-// Ugʗp
+// リザルト画面用
 //--------------------------------------
 
 /**
- * @brief ŏIXRAۑiQ[IɌĂԁj
+ * @brief 最終スコアを保存（ゲーム終了時に呼ぶ）
  */
 void Score_SaveFinal();
 
 /**
- * @brief ŏIXRA擾
- * @return ۑꂽŏIXRA
+ * @brief 最終スコアを取得
+ * @return 保存された最終スコア
  */
 unsigned int Score_GetFinalScore();
 
 /**
- * @brief UgʗpiXRAZbgȂj
- * @param x \XW
- * @param y \YW
- * @param digit \
+ * @brief リザルト画面用初期化（スコアをリセットしない）
+ * @param x 表示X座標
+ * @param y 表示Y座標
+ * @param digit 表示桁数
  */
 void Score_InitializeForResult(float x, float y, int digit);
 
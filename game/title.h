@@ -1,6 +1,6 @@
 /****************************************
  * @file title.h
- * @brief ^Cgʁua -ZANKUU-v
+ * @brief タイトル画面「斬空 -ZANKUU-」
  * @author Natsume Shidara
  * @date 2026/01/12
  ****************************************/
@@ -9,28 +9,28 @@
 #define TITLE_H
 
  /**
-  * @brief ^Cgʏ
+  * @brief タイトル画面初期化
   */
 void Title_Initialize();
 
 /**
- * @brief ^CgʏI
+ * @brief タイトル画面終了処理
  */
 void Title_Finalize();
 
 /**
- * @brief ^CgʍXV
- * @param elapsed_time f^^C
+ * @brief タイトル画面更新
+ * @param elapsed_time デルタタイム
  */
 void Title_Update(double elapsed_time);
 
 /**
- * @brief ^Cgʕ`
+ * @brief タイトル画面描画
  */
 void Title_Draw();
 
 /**
- * @brief ^CgʃVhE`ij
+ * @brief タイトル画面シャドウ描画（空実装）
  */
 void Title_DrawShadow();
 
@@ -1,6 +1,6 @@
 /****************************************
  * @file game_settings.cpp
- * @brief Q[ݒ̊Ǘ
+ * @brief ゲーム設定の管理
  * @author Natsume Shidara
  * @date 2026/01/13
  ****************************************/
@@ -10,14 +10,14 @@
 #include <algorithm>
 
  //======================================
- // ϐ
+ // 内部変数
  //======================================
 static float g_Sensitivity = SettingsRange::SENSITIVITY_DEFAULT;
 static float g_BGMVolume = SettingsRange::BGM_VOLUME_DEFAULT;
 static float g_SEVolume = SettingsRange::SE_VOLUME_DEFAULT;
 
 //======================================
-// wp[֐
+// ヘルパー関数
 //======================================
 static float Clamp(float value, float min, float max)
 {
@@ -25,29 +25,29 @@ static float Clamp(float value, float min, float max)
 }
 
 //======================================
-// EI
+// 初期化・終了
 //======================================
 
 void GameSettings_Initialize()
 {
-    // ftHglŏ
+    // デフォルト値で初期化
     g_Sensitivity = SettingsRange::SENSITIVITY_DEFAULT;
     g_BGMVolume = SettingsRange::BGM_VOLUME_DEFAULT;
     g_SEVolume = SettingsRange::SE_VOLUME_DEFAULT;
 
-    // TEh}l[W[ɏlKp
+    // サウンドマネージャーに初期値を適用
     SoundManager_SetBGMVolume(g_BGMVolume);
     SoundManager_SetSEVolume(g_SEVolume);
 }
 
 void GameSettings_Finalize()
 {
-    // _ł͓ɉȂ
-    // Iɂ̓t@Cւ̕ۑȂǂs
+    // 現時点では特に何もしない
+    // 将来的にはファイルへの保存などを行う
 }
 
 //======================================
-// _x
+// 視点感度
 //======================================
 
 float GameSettings_GetSensitivity()
@@ -61,7 +61,7 @@ void GameSettings_SetSensitivity(float value)
 }
 
 //======================================
-// BGM
+// BGM音量
 //======================================
 
 float GameSettings_GetBGMVolume()
@@ -76,7 +76,7 @@ void GameSettings_SetBGMVolume(float value)
 }
 
 //======================================
-// SE
+// SE音量
 //======================================
 
 float GameSettings_GetSEVolume()
@@ -91,7 +91,7 @@ void GameSettings_SetSEVolume(float value)
 }
 
 //======================================
-// ݒ̃Zbg
+// 設定のリセット
 //======================================
 
 void GameSettings_ResetToDefault()
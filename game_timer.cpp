@@ -1,6 +1,6 @@
 /****************************************
  * @file game_timer.cpp
- * @brief Q[^C}[Ǘ̎
+ * @brief ゲームタイマー管理の実装
  * @author Natsume Shidara
  * @date 2026/01/12
  ****************************************/
@@ -18,33 +18,33 @@
 using namespace DirectX;
 
 //======================================
-// 萔
+// 定数
 //======================================
 namespace
 {
-    // eNX`pXiXRAƋʁj
+    // テクスチャパス（スコアと共通）
     constexpr const wchar_t* TIMER_TEXTURE_PATH = L"assets/ui/numbers.png";
 
-    // tHgTCYieNX`j
+    // フォントサイズ（テクスチャ内）
     constexpr int FONT_SRC_WIDTH = 89;
     constexpr int FONT_SRC_HEIGHT = 123;
 
-    // `XP[i1/4TCYŕ\j
+    // 描画スケール（1/4サイズで表示）
     constexpr float DRAW_SCALE = 0.25f;
 
-    // ǉ̕\{
+    // 追加の表示倍率
     constexpr float TIMER_SCALE = 1.5f;
 
-    // xԁic30bȉŐԂ_Łj
+    // 警告時間（残り30秒以下で赤く点滅）
     constexpr float WARNING_TIME = 30.0f;
     constexpr float BLINK_SPEED = 4.0f;
 
-    // \ʒuiʏ㕔j
+    // 表示位置（画面上部中央）
     constexpr float MARGIN_Y = 20.0f;
 }
 
 //======================================
-// ϐ
+// 内部変数
 //======================================
 static int g_TimerTexId = -1;
 static float g_TotalTime = 180.0f;
@@ -53,18 +53,18 @@ static bool g_IsPaused = false;
 static float g_BlinkTimer = 0.0f;
 
 //======================================
-// ֐
+// 内部関数
 //======================================
 static void DrawNumber(float x, float y, int num, float scale, const XMFLOAT4& color)
 {
     if (g_TimerTexId < 0) return;
 
-    // `TCYi1/4XP[Kpj
+    // 描画サイズ（1/4スケール適用）
     float drawW = FONT_SRC_WIDTH * DRAW_SCALE * scale;
     float drawH = FONT_SRC_HEIGHT * DRAW_SCALE * scale;
 
-    // `itXybNŁj
-    // : texid, x, y, uvX, uvY, uvW, uvH, drawW, drawH, angle, color
+    // 描画（フルスペック版）
+    // 引数順序: texid, x, y, uvX, uvY, uvW, uvH, drawW, drawH, angle, color
     Sprite_Draw(
         g_TimerTexId,
         x, y,
@@ -78,7 +78,7 @@ static void DrawNumber(float x, float y, int num, float scale, const XMFLOAT4& c
 }
 
 //======================================
-// 
+// 初期化
 //======================================
 void GameTimer_Initialize(float totalTime)
 {
@@ -90,7 +90,7 @@ void GameTimer_Initialize(float totalTime)
 }
 
 //======================================
-// I
+// 終了処理
 //======================================
 void GameTimer_Finalize()
 {
@@ -98,7 +98,7 @@ void GameTimer_Finalize()
 }
 
 //======================================
-// XV
+// 更新
 //======================================
 void GameTimer_Update(double elapsed_time)
 {
@@ -110,37 +110,37 @@ void GameTimer_Update(double elapsed_time)
         g_RemainingTime = std::fmaxf(0.0f, g_RemainingTime);
     }
 
-    // _Ń^C}[
+    // 点滅タイマー
     g_BlinkTimer += dt * BLINK_SPEED;
 }
 
 //======================================
-// `
+// 描画
 //======================================
 void GameTimer_Draw()
 {
     if (g_TimerTexId < 0) return;
 
-    // ʃTCY擾
+    // 画面サイズ取得
     float screenWidth = static_cast<float>(Direct3D_GetBackBufferWidth());
 
-    // cbvZ
+    // 残り秒数を計算
     int seconds = static_cast<int>(std::ceil(g_RemainingTime));
     seconds = std::fmaxf(0, std::fminf(999, seconds));
 
-    // iő3j
+    // 桁数を決定（最大3桁）
     int digit = 3;
     float charWidth = FONT_SRC_WIDTH * DRAW_SCALE * TIMER_SCALE;
     float totalWidth = charWidth * digit;
 
-    // zu
+    // 中央配置
     float startX = (screenWidth - totalWidth) * 0.5f;
     float posY = MARGIN_Y;
 
-    // F
+    // 色を決定
     XMFLOAT4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
 
-    // xԁic30bȉŐԂ_Łj
+    // 警告時間（残り30秒以下で赤く点滅）
     if (g_RemainingTime <= WARNING_TIME && g_RemainingTime > 0.0f)
     {
         float blink = (sinf(g_BlinkTimer) + 1.0f) * 0.5f;
@@ -149,7 +149,7 @@ void GameTimer_Draw()
         color.z = blink * 0.5f;
     }
 
-    // ^CAbv͐
+    // タイムアップ時は赤
     if (g_RemainingTime <= 0.0f)
     {
         color = { 1.0f, 0.2f, 0.2f, 1.0f };
@@ -157,7 +157,7 @@ void GameTimer_Draw()
 
     Sprite_Begin();
 
-    // e`ij
+    // 各桁を描画（左から）
     int temp = seconds;
     for (int i = digit - 1; i >= 0; i--)
     {
@@ -169,7 +169,7 @@ void GameTimer_Draw()
 }
 
 //======================================
-// c莞Ԏ擾
+// 残り時間取得
 //======================================
 float GameTimer_GetRemaining()
 {
@@ -177,7 +177,7 @@ float GameTimer_GetRemaining()
 }
 
 //======================================
-// ^CAbv
+// タイムアップ判定
 //======================================
 bool GameTimer_IsTimeUp()
 {
@@ -185,7 +185,7 @@ bool GameTimer_IsTimeUp()
 }
 
 //======================================
-// ꎞ~
+// 一時停止
 //======================================
 void GameTimer_Pause()
 {
@@ -193,7 +193,7 @@ void GameTimer_Pause()
 }
 
 //======================================
-// ĊJ
+// 再開
 //======================================
 void GameTimer_Resume()
 {
@@ -201,7 +201,7 @@ void GameTimer_Resume()
 }
 
 //======================================
-// Zbg
+// リセット
 //======================================
 void GameTimer_Reset(float totalTime)
 {
@@ -1,6 +1,6 @@
 /****************************************
  * @file game_timer.h
- * @brief Q[^C}[Ǘic莞ԕ\j
+ * @brief ゲームタイマー管理（残り時間表示）
  * @author Natsume Shidara
  * @date 2026/01/12
  ****************************************/
@@ -9,52 +9,52 @@
 #define GAME_TIMER_H
 
  /**
-  * @brief Q[^C}[
-  * @param totalTime ԁibj
+  * @brief ゲームタイマー初期化
+  * @param totalTime 制限時間（秒）
   */
 void GameTimer_Initialize(float totalTime);
 
 /**
- * @brief Q[^C}[I
+ * @brief ゲームタイマー終了処理
  */
 void GameTimer_Finalize();
 
 /**
- * @brief Q[^C}[XV
- * @param elapsed_time f^^C
+ * @brief ゲームタイマー更新
+ * @param elapsed_time デルタタイム
  */
 void GameTimer_Update(double elapsed_time);
 
 /**
- * @brief Q[^C}[`
+ * @brief ゲームタイマー描画
  */
 void GameTimer_Draw();
 
 /**
- * @brief c莞Ԃ擾
- * @return c莞ԁibj
+ * @brief 残り時間を取得
+ * @return 残り時間（秒）
  */
 float GameTimer_GetRemaining();
 
 /**
- * @brief ^CAbvǂ
- * @return ^CAbvȂtrue
+ * @brief タイムアップかどうか
+ * @return タイムアップならtrue
  */
 bool GameTimer_IsTimeUp();
 
 /**
- * @brief ^C}[ꎞ~
+ * @brief タイマーを一時停止
  */
 void GameTimer_Pause();
 
 /**
- * @brief ^C}[ĊJ
+ * @brief タイマーを再開
  */
 void GameTimer_Resume();
 
 /**
- * @brief ^C}[Zbg
- * @param totalTime ԁibj
+ * @brief タイマーをリセット
+ * @param totalTime 制限時間（秒）
  */
 void GameTimer_Reset(float totalTime);
 
@@ -6,18 +6,18 @@
 
 #include "system_timer.h"
 
-// EBhE
-static constexpr char WINDOW_CLASS[] = "GameWindow"; // CEChENX
-static constexpr char TITLE[] = "Game"; // 	^Cgo[̃eNXg
+// ウィンドウ情報
+static constexpr char WINDOW_CLASS[] = "GameWindow"; // メインウインドウクラス名
+static constexpr char TITLE[] = "Game"; // 	タイトルバーのテクスト
 const constexpr int SCREEN_WIDTH = 1600;
 const constexpr int SCREEN_HEIGHT = 900;
 
-// EChEvV[W@vg^Cv錾
+// ウインドウプロシージャ　プロトタイプ宣言
 LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
 
 HWND GameWindow_Create(_In_ HINSTANCE hInstance)
 {
-    // EChENX̓o^
+    // ウインドウクラスの登録
     WNDCLASSEX wcex{};
 
     wcex.cbSize = sizeof(WNDCLASSEX);
@@ -32,7 +32,7 @@ HWND GameWindow_Create(_In_ HINSTANCE hInstance)
 
     RegisterClassEx(&wcex);
 
-    // CEBhE̍쐬
+    // メインウィンドウの作成
 
     RECT window_rect{
         0, 0, SCREEN_WIDTH, SCREEN_HEIGHT
@@ -45,12 +45,12 @@ HWND GameWindow_Create(_In_ HINSTANCE hInstance)
     const int WINDOW_WIDTH = window_rect.right - window_rect.left;
     const int WINDOW_HEIGHT = window_rect.bottom - window_rect.top;
 
-    // fXNgbṽTCY擾
-    // Cuj^[̉ʉ𑜓x擾
+    // デスクトップのサイズを取得
+    // ライブラリモニターの画面解像度取得
     int desktop_width = GetSystemMetrics(SM_CXSCREEN);
     int desktop_height = GetSystemMetrics(SM_CYSCREEN);
 
-    // EChE̕\ʒufXNgbv̐^񒆂ɒ
+    // ウインドウの表示位置をデスクトップの真ん中に調整する
     // offset to center, use std::max to prevent window overflow
     const int WINDOW_X = std::max(0, (desktop_width - WINDOW_WIDTH) / 2);
     const int WINDOW_Y = std::max(0, (desktop_height - WINDOW_HEIGHT) / 2);
@@ -58,7 +58,7 @@ HWND GameWindow_Create(_In_ HINSTANCE hInstance)
     HWND hWnd = CreateWindow(
         WINDOW_CLASS,
         TITLE,
-        style, //@Window Style Flag
+        style, //　Window Style Flag
         WINDOW_X, // CW_USEDEFAULT
         WINDOW_Y,
         WINDOW_WIDTH,
@@ -72,7 +72,7 @@ HWND GameWindow_Create(_In_ HINSTANCE hInstance)
     return hWnd;
 }
 
-// EChEvV[W
+// ウインドウプロシージャ
 LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
     switch (message)
@@ -114,7 +114,7 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
         Mouse_ProcessMessage(message, wParam, lParam);
         break;
     case WM_CLOSE:
-        if (MessageBox(hWnd, "{ɏIĂ낵łH", "mF", MB_YESNO | MB_DEFBUTTON2) == IDYES)
+        if (MessageBox(hWnd, "本当に終了してよろしいですか？", "確認", MB_YESNO | MB_DEFBUTTON2) == IDYES)
         {
             DestroyWindow(hWnd);
         }
@@ -1,6 +1,6 @@
 /**
  * @file game_window.h
- * @brief EBhȄ֘A
+ * @brief ウィンドウの初期化関連
  * @author Natsume Shidara
  * @date 2025/06/06
  */
@@ -0,0 +1,458 @@
+﻿/****************************************
+ * @file heightfield.cpp
+ * @brief 高さマップによる地形コライダーの実装
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#include "heightfield.h"
+#include "collider.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+//======================================
+// 内部ヘルパー関数
+//======================================
+namespace
+{
+    // これ以下の距離の接触は同一点とみなして深い方だけ残す
+    constexpr float CONTACT_MERGE_DISTANCE = 0.01f;
+
+    /**
+     * @brief 接触を追加（近い既存点は深い方を残し、満杯なら最も浅い点と入れ替える）
+     */
+    void PushContact(Hit* outHits, int& count, int maxHits, const Hit& hit)
+    {
+        const float mergeSq = CONTACT_MERGE_DISTANCE * CONTACT_MERGE_DISTANCE;
+        XMVECTOR point = XMLoadFloat3(&hit.contactPoint);
+        int shallowest = -1;
+
+        for (int i = 0; i < count; ++i)
+        {
+            float distSq = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(XMLoadFloat3(&outHits[i].contactPoint), point)));
+            if (distSq < mergeSq)
+            {
+                if (hit.depth > outHits[i].depth) outHits[i] = hit;
+                return;
+            }
+            if (shallowest < 0 || outHits[i].depth < outHits[shallowest].depth)
+            {
+                shallowest = i;
+            }
+        }
+
+        if (count < maxHits)
+        {
+            outHits[count++] = hit;
+        }
+        else if (shallowest >= 0 && hit.depth > outHits[shallowest].depth)
+        {
+            outHits[shallowest] = hit;
+        }
+    }
+
+    float PlaneDistance(const Triangle& tri, FXMVECTOR point)
+    {
+        return XMVectorGetX(XMVector3Dot(XMLoadFloat3(&tri.normal), XMVectorSubtract(point, XMLoadFloat3(&tri.p0))));
+    }
+
+    OBB MakeOBBFromAABB(const AABB& aabb)
+    {
+        OBB obb;
+        obb.center = aabb.GetCenter();
+        XMStoreFloat3(&obb.extents, XMVectorScale(XMVectorSubtract(XMLoadFloat3(&aabb.max), XMLoadFloat3(&aabb.min)), 0.5f));
+        obb.orientation = { 0.0f, 0.0f, 0.0f, 1.0f };
+        return obb;
+    }
+}
+
+//======================================
+// 構築
+//======================================
+void HeightField::Build(const float* heights, int vertexCountX, int vertexCountZ, float cellSize, float originX, float originZ)
+{
+    Clear();
+    if (!heights || vertexCountX < 2 || vertexCountZ < 2 || cellSize <= 0.0f) return;
+
+    m_VertexCountX = vertexCountX;
+    m_VertexCountZ = vertexCountZ;
+    m_CellSize = cellSize;
+    m_OriginX = originX;
+    m_OriginZ = originZ;
+    m_Heights.assign(heights, heights + vertexCountX * vertexCountZ);
+
+    // 三角形ごとの法線を事前計算（描画メッシュと同じ分割）
+    const int cellCountX = vertexCountX - 1;
+    const int cellCountZ = vertexCountZ - 1;
+    m_Normals.resize(static_cast<size_t>(cellCountX) * cellCountZ * 2);
+
+    for (int x = 0; x < cellCountX; ++x)
+    {
+        for (int z = 0; z < cellCountZ; ++z)
+        {
+            for (int t = 0; t < 2; ++t)
+            {
+                Triangle tri = GetTriangle(x, z, t);
+                XMVECTOR p0 = XMLoadFloat3(&tri.p0);
+                XMVECTOR n = XMVector3Cross(XMVectorSubtract(XMLoadFloat3(&tri.p1), p0), XMVectorSubtract(XMLoadFloat3(&tri.p2), p0));
+                if (XMVectorGetY(n) < 0.0f) n = XMVectorNegate(n);
+                XMStoreFloat3(&m_Normals[(static_cast<size_t>(x) * cellCountZ + z) * 2 + t], XMVector3Normalize(n));
+            }
+        }
+    }
+}
+
+void HeightField::Clear()
+{
+    m_Heights.clear();
+    m_Normals.clear();
+    m_VertexCountX = 0;
+    m_VertexCountZ = 0;
+}
+
+//======================================
+// 高さ・法線の取得
+//======================================
+float HeightField::GetHeight(float x, float z) const
+{
+    int cellX, cellZ, triangle;
+    if (!FindTriangle(x, z, cellX, cellZ, triangle)) return 0.0f;
+
+    // 三角形の平面上の高さ
+    Triangle tri = GetTriangle(cellX, cellZ, triangle);
+    return tri.p0.y - (tri.normal.x * (x - tri.p0.x) + tri.normal.z * (z - tri.p0.z)) / tri.normal.y;
+}
+
+XMFLOAT3 HeightField::GetNormal(float x, float z) const
+{
+    int cellX, cellZ, triangle;
+    if (!FindTriangle(x, z, cellX, cellZ, triangle)) return { 0.0f, 1.0f, 0.0f };
+
+    return m_Normals[(static_cast<size_t>(cellX) * (m_VertexCountZ - 1) + cellZ) * 2 + triangle];
+}
+
+//======================================
+// 衝突判定
+//======================================
+int HeightField::Collide(const Collider& collider, Hit* outHits, int maxHits) const
+{
+    if (!IsBuilt() || !outHits || maxHits <= 0) return 0;
+
+    switch (collider.type)
+    {
+    case ColliderType::Sphere:
+        return CollideSphere(collider.sphere, outHits, maxHits);
+    case ColliderType::Capsule:
+        return CollideCapsule(collider.capsule, outHits, maxHits);
+    case ColliderType::Box:
+        return CollideOBB(collider.obb, outHits, maxHits);
+    default:
+        return CollideOBB(MakeOBBFromAABB(collider.GetBoundingBox()), outHits, maxHits);
+    }
+}
+
+int HeightField::CollideSphere(const Sphere& sphere, Hit* outHits, int maxHits) const
+{
+    AABB bounds;
+    bounds.min = { sphere.center.x - sphere.radius, sphere.center.y - sphere.radius, sphere.center.z - sphere.radius };
+    bounds.max = { sphere.center.x + sphere.radius, sphere.center.y + sphere.radius, sphere.center.z + sphere.radius };
+
+    int minX, minZ, maxX, maxZ;
+    if (!GetCellRange(bounds, minX, minZ, maxX, maxZ)) return 0;
+
+    XMVECTOR center = XMLoadFloat3(&sphere.center);
+    int count = 0;
+
+    for (int x = minX; x <= maxX; ++x)
+    {
+        for (int z = minZ; z <= maxZ; ++z)
+        {
+            for (int t = 0; t < 2; ++t)
+            {
+                Triangle tri = GetTriangle(x, z, t);
+
+                // 事前計算した法線で平面から離れている三角形を除外
+                float planeDist = PlaneDistance(tri, center);
+                if (planeDist >= sphere.radius) continue;
+
+                Hit hit;
+                if (IsInsideFootprint(tri, sphere.center.x, sphere.center.z))
+                {
+                    // 真下の三角形：中心が地表より下でも法線方向へ押し出す
+                    hit.isHit = true;
+                    hit.normal = tri.normal;
+                    hit.depth = sphere.radius - planeDist;
+                    XMStoreFloat3(&hit.contactPoint, XMVectorSubtract(center, XMVectorScale(XMLoadFloat3(&tri.normal), planeDist)));
+                }
+                else
+                {
+                    // 隣の三角形：辺・頂点との接触（下側からの接触は真下の三角形に任せる）
+                    XMFLOAT3 closest = Collision_ClosestPointTriangle(sphere.center, tri);
+                    XMVECTOR diff = XMVectorSubtract(center, XMLoadFloat3(&closest));
+                    float dist = XMVectorGetX(XMVector3Length(diff));
+                    if (dist >= sphere.radius || dist < 1e-5f) continue;
+                    if (XMVectorGetX(XMVector3Dot(diff, XMLoadFloat3(&tri.normal))) <= 0.0f) continue;
+
+                    hit.isHit = true;
+                    XMStoreFloat3(&hit.normal, XMVectorScale(diff, 1.0f / dist));
+                    hit.depth = sphere.radius - dist;
+                    hit.contactPoint = closest;
+                }
+
+                PushContact(outHits, count, maxHits, hit);
+            }
+        }
+    }
+    return count;
+}
+
+int HeightField::CollideCapsule(const Capsule& capsule, Hit* outHits, int maxHits) const
+{
+    XMVECTOR segStart = XMLoadFloat3(&capsule.start);
+    XMVECTOR segEnd = XMLoadFloat3(&capsule.end);
+    XMVECTOR radius = XMVectorReplicate(capsule.radius);
+
+    AABB bounds;
+    XMStoreFloat3(&bounds.min, XMVectorSubtract(XMVectorMin(segStart, segEnd), radius));
+    XMStoreFloat3(&bounds.max, XMVectorAdd(XMVectorMax(segStart, segEnd), radius));
+
+    int minX, minZ, maxX, maxZ;
+    if (!GetCellRange(bounds, minX, minZ, maxX, maxZ)) return 0;
+
+    int count = 0;
+    for (int x = minX; x <= maxX; ++x)
+    {
+        for (int z = minZ; z <= maxZ; ++z)
+        {
+            for (int t = 0; t < 2; ++t)
+            {
+                Triangle tri = GetTriangle(x, z, t);
+
+                // 線分上で三角形に最も近い点を候補から選び、球として判定
+                float distStart = PlaneDistance(tri, segStart);
+                float distEnd = PlaneDistance(tri, segEnd);
+                if (std::min(distStart, distEnd) >= capsule.radius) continue;
+
+                XMVECTOR centroid = XMVectorScale(XMVectorAdd(XMLoadFloat3(&tri.p0), XMVectorAdd(XMLoadFloat3(&tri.p1), XMLoadFloat3(&tri.p2))), 1.0f / 3.0f);
+                XMFLOAT3 fCentroid, closestToCentroid;
+                XMStoreFloat3(&fCentroid, centroid);
+                closestToCentroid = Collision_ClosestPointOnSegment(fCentroid, capsule.start, capsule.end);
+
+                XMVECTOR candidates[4] = { segStart, segEnd, XMLoadFloat3(&closestToCentroid), segStart };
+                int candidateCount = 3;
+                if ((distStart < 0.0f) != (distEnd < 0.0f))
+                {
+                    // 平面を貫く場合は交点も候補に加える
+                    candidates[candidateCount++] = XMVectorLerp(segStart, segEnd, distStart / (distStart - distEnd));
+                }
+
+                Hit deepest;
+                for (int c = 0; c < candidateCount; ++c)
+                {
+                    Sphere sphere;
+                    XMStoreFloat3(&sphere.center, candidates[c]);
+                    sphere.radius = capsule.radius;
+
+                    float planeDist = PlaneDistance(tri, candidates[c]);
+                    if (planeDist >= capsule.radius) continue;
+
+                    Hit hit;
+                    if (IsInsideFootprint(tri, sphere.center.x, sphere.center.z))
+                    {
+                        hit.isHit = true;
+                        hit.normal = tri.normal;
+                        hit.depth = capsule.radius - planeDist;
+                        XMStoreFloat3(&hit.contactPoint, XMVectorSubtract(candidates[c], XMVectorScale(XMLoadFloat3(&tri.normal), planeDist)));
+                    }
+                    else
+                    {
+                        XMFLOAT3 closest = Collision_ClosestPointTriangle(sphere.center, tri);
+                        XMVECTOR diff = XMVectorSubtract(candidates[c], XMLoadFloat3(&closest));
+                        float dist = XMVectorGetX(XMVector3Length(diff));
+                        if (dist >= capsule.radius || dist < 1e-5f) continue;
+                        if (XMVectorGetX(XMVector3Dot(diff, XMLoadFloat3(&tri.normal))) <= 0.0f) continue;
+
+                        hit.isHit = true;
+                        XMStoreFloat3(&hit.normal, XMVectorScale(diff, 1.0f / dist));
+                        hit.depth = capsule.radius - dist;
+                        hit.contactPoint = closest;
+                    }
+
+                    if (!deepest.isHit || hit.depth > deepest.depth)
+                    {
+                        deepest = hit;
+                    }
+                }
+
+                if (deepest.isHit)
+                {
+                    PushContact(outHits, count, maxHits, deepest);
+                }
+            }
+        }
+    }
+    return count;
+}
+
+int HeightField::CollideOBB(const OBB& obb, Hit* outHits, int maxHits) const
+{
+    int minX, minZ, maxX, maxZ;
+    if (!GetCellRange(Collision_GetOBBBounds(obb), minX, minZ, maxX, maxZ)) return 0;
+
+    XMVECTOR center = XMLoadFloat3(&obb.center);
+    XMMATRIX rot = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.orientation));
+    XMVECTOR axes[3] = {
+        XMVectorScale(rot.r[0], obb.extents.x),
+        XMVectorScale(rot.r[1], obb.extents.y),
+        XMVectorScale(rot.r[2], obb.extents.z),
+    };
+
+    // 8頂点
+    XMVECTOR corners[8];
+    XMFLOAT3 fCorners[8];
+    for (int i = 0; i < 8; ++i)
+    {
+        XMVECTOR p = center;
+        p = (i & 1) ? XMVectorAdd(p, axes[0]) : XMVectorSubtract(p, axes[0]);
+        p = (i & 2) ? XMVectorAdd(p, axes[1]) : XMVectorSubtract(p, axes[1]);
+        p = (i & 4) ? XMVectorAdd(p, axes[2]) : XMVectorSubtract(p, axes[2]);
+        corners[i] = p;
+        XMStoreFloat3(&fCorners[i], p);
+    }
+
+    int count = 0;
+    for (int x = minX; x <= maxX; ++x)
+    {
+        for (int z = minZ; z <= maxZ; ++z)
+        {
+            for (int t = 0; t < 2; ++t)
+            {
+                Triangle tri = GetTriangle(x, z, t);
+                XMVECTOR n = XMLoadFloat3(&tri.normal);
+
+                // 事前計算した法線方向の投影半径で平面から離れている三角形を除外
+                float projRadius = std::abs(XMVectorGetX(XMVector3Dot(n, axes[0])))
+                                 + std::abs(XMVectorGetX(XMVector3Dot(n, axes[1])))
+                                 + std::abs(XMVectorGetX(XMVector3Dot(n, axes[2])));
+                float centerDist = PlaneDistance(tri, center);
+                if (centerDist >= projRadius) continue;
+
+                // 真上にある頂点のうち地表より下のものを接触点にする
+                bool hasCornerContact = false;
+                for (int i = 0; i < 8; ++i)
+                {
+                    if (!IsInsideFootprint(tri, fCorners[i].x, fCorners[i].z)) continue;
+
+                    float dist = PlaneDistance(tri, corners[i]);
+                    if (dist >= 0.0f) continue;
+
+                    Hit hit;
+                    hit.isHit = true;
+                    hit.normal = tri.normal;
+                    hit.depth = -dist;
+                    XMStoreFloat3(&hit.contactPoint, XMVectorSubtract(corners[i], XMVectorScale(n, dist)));
+                    PushContact(outHits, count, maxHits, hit);
+                    hasCornerContact = true;
+                }
+                if (hasCornerContact) continue;
+
+                // 頂点が乗っていない三角形：地形の頂点・辺が箱の面に刺さっている場合
+                Hit sat = Collision_IsHitOBBTriangle(obb, tri);
+                if (!sat.isHit) continue;
+
+                Hit hit;
+                hit.isHit = true;
+                hit.normal = tri.normal;
+                hit.depth = std::min(sat.depth, projRadius - centerDist);
+                hit.contactPoint = sat.contactPoint;
+                PushContact(outHits, count, maxHits, hit);
+            }
+        }
+    }
+    return count;
+}
+
+//======================================
+// 格子・三角形の参照
+//======================================
+bool HeightField::GetCellRange(const AABB& bounds, int& outMinX, int& outMinZ, int& outMaxX, int& outMaxZ) const
+{
+    const int cellCountX = m_VertexCountX - 1;
+    const int cellCountZ = m_VertexCountZ - 1;
+
+    outMinX = static_cast<int>(std::floor((bounds.min.x - m_OriginX) / m_CellSize));
+    outMinZ = static_cast<int>(std::floor((bounds.min.z - m_OriginZ) / m_CellSize));
+    outMaxX = static_cast<int>(std::floor((bounds.max.x - m_OriginX) / m_CellSize));
+    outMaxZ = static_cast<int>(std::floor((bounds.max.z - m_OriginZ) / m_CellSize));
+
+    if (outMaxX < 0 || outMaxZ < 0 || outMinX >= cellCountX || outMinZ >= cellCountZ) return false;
+
+    outMinX = std::max(outMinX, 0);
+    outMinZ = std::max(outMinZ, 0);
+    outMaxX = std::min(outMaxX, cellCountX - 1);
+    outMaxZ = std::min(outMaxZ, cellCountZ - 1);
+    return true;
+}
+
+bool HeightField::FindTriangle(float x, float z, int& outCellX, int& outCellZ, int& outTriangle) const
+{
+    if (!IsBuilt()) return false;
+
+    float localX = (x - m_OriginX) / m_CellSize;
+    float localZ = (z - m_OriginZ) / m_CellSize;
+    outCellX = static_cast<int>(std::floor(localX));
+    outCellZ = static_cast<int>(std::floor(localZ));
+
+    if (outCellX < 0 || outCellX >= m_VertexCountX - 1 || outCellZ < 0 || outCellZ >= m_VertexCountZ - 1)
+    {
+        return false;
+    }
+
+    // 対角線 (x,z)-(x+1,z+1) の上側が三角形0、下側が三角形1
+    outTriangle = (localZ - outCellZ >= localX - outCellX) ? 0 : 1;
+    return true;
+}
+
+Triangle HeightField::GetTriangle(int cellX, int cellZ, int triangle) const
+{
+    Triangle tri;
+    if (triangle == 0)
+    {
+        tri.p0 = GetVertex(cellX, cellZ);
+        tri.p1 = GetVertex(cellX, cellZ + 1);
+        tri.p2 = GetVertex(cellX + 1, cellZ + 1);
+    }
+    else
+    {
+        tri.p0 = GetVertex(cellX + 1, cellZ + 1);
+        tri.p1 = GetVertex(cellX + 1, cellZ);
+        tri.p2 = GetVertex(cellX, cellZ);
+    }
+
+    const size_t normalIndex = (static_cast<size_t>(cellX) * (m_VertexCountZ - 1) + cellZ) * 2 + triangle;
+    tri.normal = (normalIndex < m_Normals.size()) ? m_Normals[normalIndex] : XMFLOAT3(0.0f, 1.0f, 0.0f);
+    return tri;
+}
+
+XMFLOAT3 HeightField::GetVertex(int x, int z) const
+{
+    return { m_OriginX + x * m_CellSize, m_Heights[static_cast<size_t>(x) * m_VertexCountZ + z], m_OriginZ + z * m_CellSize };
+}
+
+bool HeightField::IsInsideFootprint(const Triangle& tri, float x, float z) const
+{
+    // XZ平面上の重心座標で内外判定
+    float d1x = tri.p1.x - tri.p0.x, d1z = tri.p1.z - tri.p0.z;
+    float d2x = tri.p2.x - tri.p0.x, d2z = tri.p2.z - tri.p0.z;
+    float px = x - tri.p0.x, pz = z - tri.p0.z;
+
+    float denom = d1x * d2z - d2x * d1z;
+    if (std::abs(denom) < 1e-8f) return false;
+
+    float u = (px * d2z - d2x * pz) / denom;
+    float v = (d1x * pz - px * d1z) / denom;
+    const float eps = HeightFieldConfig::FOOTPRINT_EPSILON;
+    return u >= -eps && v >= -eps && (u + v) <= 1.0f + eps;
+}
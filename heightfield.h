@@ -0,0 +1,84 @@
+﻿/****************************************
+ * @file heightfield.h
+ * @brief 高さマップによる地形コライダー
+ * @detail 格子1マスを描画メッシュと同じ2枚の三角形に分け、三角形ごとの法線を事前計算する。
+ *         剛体のAABBが覆うマスの三角形だけを調べ、三角形単位の接触を返す
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#ifndef HEIGHTFIELD_H
+#define HEIGHTFIELD_H
+
+#include <DirectXMath.h>
+#include <vector>
+#include "collision.h"
+
+struct Collider;
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace HeightFieldConfig
+{
+    // 1回の判定で返す接触の最大数（超えた分は浅い順に捨てる）
+    constexpr int MAX_CONTACTS = 8;
+    // 三角形の内外判定の許容量（隣接三角形の境界で接触が抜けないようにする）
+    constexpr float FOOTPRINT_EPSILON = 1e-4f;
+}
+
+//--------------------------------------
+// 高さマップ地形
+//--------------------------------------
+class HeightField
+{
+public:
+    HeightField() = default;
+    ~HeightField() = default;
+
+    /**
+     * @brief 高さ配列から構築（heights[x * vertexCountZ + z]、origin は頂点(0,0)のXZ座標）
+     */
+    void Build(const float* heights, int vertexCountX, int vertexCountZ, float cellSize, float originX, float originZ);
+    void Clear();
+    bool IsBuilt() const { return !m_Heights.empty(); }
+
+    /**
+     * @brief 描画メッシュの三角形上の高さ（範囲外は 0）
+     */
+    float GetHeight(float x, float z) const;
+
+    /**
+     * @brief 指定座標を含む三角形の事前計算済み法線（範囲外は真上）
+     */
+    DirectX::XMFLOAT3 GetNormal(float x, float z) const;
+
+    /**
+     * @brief コライダーと地形の接触を三角形単位で求める
+     * @param[out] outHits 接触（法線は地形→コライダー、接触点は地形表面上）
+     * @return 接触数（maxHits 以下）
+     * @detail 球・カプセル・OBB に対応し、それ以外はワールドAABBを箱として扱う
+     */
+    int Collide(const Collider& collider, Hit* outHits, int maxHits) const;
+
+private:
+    bool GetCellRange(const AABB& bounds, int& outMinX, int& outMinZ, int& outMaxX, int& outMaxZ) const;
+    bool FindTriangle(float x, float z, int& outCellX, int& outCellZ, int& outTriangle) const;
+    Triangle GetTriangle(int cellX, int cellZ, int triangle) const;
+    DirectX::XMFLOAT3 GetVertex(int x, int z) const;
+    bool IsInsideFootprint(const Triangle& tri, float x, float z) const;
+
+    int CollideSphere(const Sphere& sphere, Hit* outHits, int maxHits) const;
+    int CollideCapsule(const Capsule& capsule, Hit* outHits, int maxHits) const;
+    int CollideOBB(const OBB& obb, Hit* outHits, int maxHits) const;
+
+    std::vector<float> m_Heights;               // [x * m_VertexCountZ + z]
+    std::vector<DirectX::XMFLOAT3> m_Normals;   // [(cellX * cellCountZ + cellZ) * 2 + triangle]
+    int m_VertexCountX = 0;
+    int m_VertexCountZ = 0;
+    float m_CellSize = 1.0f;
+    float m_OriginX = 0.0f;
+    float m_OriginZ = 0.0f;
+};
+
+#endif // HEIGHTFIELD_H
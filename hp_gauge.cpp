@@ -1,9 +1,9 @@
 /****************************************
  * @file hp_gauge.cpp
- * @brief HPQ[WǗ̎
+ * @brief HPゲージ管理の実装
  * @author Natsume Shidara
  * @date 2025/08/15
- * @update 2026/01/12 - ̋@ANVQ[pɉ
+ * @update 2026/01/12 - 立体機動アクションゲーム用に改造
  ****************************************/
 
 #include "hp_gauge.h"
@@ -19,50 +19,50 @@
 using namespace DirectX;
 
 //======================================
-// 萔
+// 定数
 //======================================
 namespace
 {
-    // eNX`pX
+    // テクスチャパス
     constexpr const wchar_t* HEART_TEXTURE_PATH = L"assets/ui/heart.png";
 
-    // n[geNX`UVݒi3ł: AAj
+    // ハートテクスチャのUV設定（横に3つ並んでいる: 空、半分、満）
     constexpr int HEART_SRC_WIDTH = 12;
     constexpr int HEART_SRC_HEIGHT = 12;
 
-    // `TCY
+    // 描画サイズ
     constexpr float HEART_DRAW_WIDTH = 48.0f;
     constexpr float HEART_DRAW_HEIGHT = 48.0f;
 
-    // \ʒuiʍj
+    // 表示位置（画面左下）
     constexpr float MARGIN_X = 20.0f;
     constexpr float MARGIN_Y = 20.0f;
 
-    // Aj[V
+    // アニメーション
     constexpr float DAMAGE_FLASH_DURATION = 0.5f;
     constexpr float LOW_HP_PULSE_SPEED = 4.0f;
     constexpr int LOW_HP_THRESHOLD = 3;
 }
 
 //======================================
-// ϐ
+// 内部変数
 //======================================
 static int g_HeartTexId = -1;
 static XMFLOAT2 g_HpGaugePos = { 0.0f, 0.0f };
 
-// Aj[Vp
+// アニメーション用
 static int g_PrevHP = 0;
 static float g_DamageFlashTimer = 0.0f;
 static float g_PulseTimer = 0.0f;
 
 //======================================
-// 
+// 初期化
 //======================================
 void HpGauge_Initialize()
 {
     g_HeartTexId = Texture_Load(HEART_TEXTURE_PATH);
 
-    // ʃTCYʒuvZij
+    // 画面サイズから位置を計算（左下）
     float screenHeight = static_cast<float>(Direct3D_GetBackBufferHeight());
     g_HpGaugePos.x = MARGIN_X;
     g_HpGaugePos.y = screenHeight - MARGIN_Y - HEART_DRAW_HEIGHT;
@@ -73,57 +73,57 @@ void HpGauge_Initialize()
 }
 
 //======================================
-// I
+// 終了処理
 //======================================
 void HpGauge_Finalize()
 {
-    // eNX`Texture_AllRelease()ŉ
+    // テクスチャはTexture_AllRelease()で解放
     g_HeartTexId = -1;
 }
 
 //======================================
-// XV
+// 更新
 //======================================
 void HpGauge_Update(double elapsed_time)
 {
     float dt = static_cast<float>(elapsed_time);
     int currentHP = Player_GetHP();
 
-    // _[Wo
+    // ダメージ検出
     if (currentHP < g_PrevHP)
     {
         g_DamageFlashTimer = DAMAGE_FLASH_DURATION;
     }
     g_PrevHP = currentHP;
 
-    // ^C}[XV
+    // タイマー更新
     if (g_DamageFlashTimer > 0.0f)
     {
         g_DamageFlashTimer -= dt;
     }
 
-    // ^C}[
+    // 脈動タイマー
     g_PulseTimer += dt * LOW_HP_PULSE_SPEED;
 }
 
 //======================================
-// `
+// 描画
 //======================================
 void HpGauge_Draw()
 {
     if (g_HeartTexId < 0) return;
 
-    // HPƍőHP擾
+    // 現在HPと最大HPを取得
     int currentHP = Player_GetHP();
     int maxHP = Player_GetMaxHP();
 
-    // n[g̐i1n[g = 2HPj
+    // ハートの数（1ハート = 2HP）
     int heartCount = (maxHP + 1) / 2;
 
-    // `F
+    // 描画色
     XMFLOAT4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
 
-    // _[WtbV
+    // ダメージフラッシュ
     if (g_DamageFlashTimer > 0.0f)
     {
         float flash = g_DamageFlashTimer / DAMAGE_FLASH_DURATION;
@@ -131,7 +131,7 @@ void HpGauge_Draw()
         color.z = 1.0f - flash * 0.5f;
     }
 
-    // HP̖
+    // 低HP時の脈動
     float scale = 1.0f;
     if (currentHP <= LOW_HP_THRESHOLD && currentHP > 0)
     {
@@ -142,53 +142,53 @@ void HpGauge_Draw()
 
     for (int i = 0; i < heartCount; i++)
     {
-        // ̃n[g\HP͈ [2*i, 2*i+2)
+        // このハートが表すHP範囲 [2*i, 2*i+2)
         int hpSegment = currentHP - (i * 2);
 
-        // UV؂蔲ʒu
+        // UV切り抜き位置を決定
         float srcX = 0.0f;
         if (hpSegment >= 2)
         {
-            // 2ȏcĂ  ^n[g
+            // 2以上残っている → 満タンハート
             srcX = static_cast<float>(HEART_SRC_WIDTH * 2);
         }
         else if (hpSegment == 1)
         {
-            // 傤1cĂ  n[g
+            // ちょうど1残っている → 半分ハート
             srcX = static_cast<float>(HEART_SRC_WIDTH);
         }
         else
         {
-            // 0ȉ  n[g
+            // 0以下 → 空ハート
             srcX = 0.0f;
         }
 
-        // `ʒu
+        // 描画位置
         float drawX = g_HpGaugePos.x + i * (HEART_DRAW_WIDTH + 4.0f);
         float drawY = g_HpGaugePos.y;
 
-        // HP̃XP[Kp
+        // 低HP時のスケール適用
         float drawW = HEART_DRAW_WIDTH * scale;
         float drawH = HEART_DRAW_HEIGHT * scale;
 
-        // XP[͒Sێ
+        // スケール時は中心を維持
         if (scale != 1.0f)
         {
             drawX -= (drawW - HEART_DRAW_WIDTH) * 0.5f;
             drawY -= (drawH - HEART_DRAW_HEIGHT) * 0.5f;
         }
 
-        // `itXybNŁj
-        // : texid, x, y, uvX, uvY, uvW, uvH, drawW, drawH, angle, color
+        // 描画（フルスペック版）
+        // 引数順序: texid, x, y, uvX, uvY, uvW, uvH, drawW, drawH, angle, color
         Sprite_Draw(
             g_HeartTexId,
             drawX, drawY,
-            srcX, 0.0f,                                    // UV؂蔲ʒu
-            static_cast<float>(HEART_SRC_WIDTH),           // UV
-            static_cast<float>(HEART_SRC_HEIGHT),          // UV
-            drawW, drawH,                                  // `TCY
-            0.0f,                                          // px
-            color                                          // F
+            srcX, 0.0f,                                    // UV切り抜き位置
+            static_cast<float>(HEART_SRC_WIDTH),           // UV幅
+            static_cast<float>(HEART_SRC_HEIGHT),          // UV高さ
+            drawW, drawH,                                  // 描画サイズ
+            0.0f,                                          // 角度
+            color                                          // 色
         );
     }
 }
\ No newline at end of file
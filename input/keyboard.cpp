@@ -1,11 +1,11 @@
 //--------------------------------------------------------------------------------------
 // File: Keyboard.cpp
 //
-// L[{[hW[
+// キーボードモジュール
 //
 //--------------------------------------------------------------------------------------
 // 2020/06/07
-//     DirectXTKAȂ񂿂CpɃVFCvAbv
+//     DirectXTKより、なんちゃってC言語用にシェイプアップ改変
 //
 // Licensed under the MIT License.
 //
@@ -17,7 +17,7 @@
 #include <assert.h>
 
 
-static_assert(sizeof(Keyboard_State) == 256 / 8, "L[{[hԍ\̂̃TCYsv");
+static_assert(sizeof(Keyboard_State) == 256 / 8, "キーボード状態構造体のサイズ不一致");
 
 
 static Keyboard_State gState = {};
@@ -85,7 +85,7 @@ bool Keyboard_IsKeyUp(Keyboard_Keys key)
 }
 
 
-// L[{[ȟ݂̏Ԃ擾
+// キーボードの現在の状態を取得する
 const Keyboard_State* Keyboard_GetState(void)
 {
     return &gState;
@@ -98,7 +98,7 @@ void Keyboard_Reset(void)
 }
 
 
-// L[{[ĥ߂̃EHǂbZ[WvV[WtbN֐
+// キーボード制御のためのウォンどうメッセージプロシージャフック関数
 void Keyboard_ProcessMessage(UINT message, WPARAM wParam, LPARAM lParam)
 {
     bool down = false;
@@ -129,7 +129,7 @@ void Keyboard_ProcessMessage(UINT message, WPARAM wParam, LPARAM lParam)
         vk = (int)MapVirtualKey(((unsigned int)lParam & 0x00ff0000) >> 16u, MAPVK_VSC_TO_VK_EX);
         if (!down)
         {
-            // VtgƉEVtg̗ɉꂽꍇɃNA悤ɂ邽߂̉
+            // 左シフトと右シフトの両方が同時に押された場合にクリアされるようにするための回避策
             keyUp(VK_LSHIFT);
             keyUp(VK_RSHIFT);
         }
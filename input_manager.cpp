@@ -1,6 +1,6 @@
 /****************************************
  * @file input_manager.cpp
- * @brief ͊Ǘi}EXԂ̈ꌳǗj
+ * @brief 入力管理（マウス状態の一元管理）
  * @author Natsume Shidara
  * @date 2026/01/07
  ****************************************/
@@ -8,12 +8,12 @@
 #include "input_manager.h"
 
  //======================================
- // ϐ
+ // 内部変数
  //======================================
 static Mouse_State g_MouseState = {};
 
 //======================================
-// 
+// 初期化
 //======================================
 void InputManager_Initialize()
 {
@@ -21,15 +21,15 @@ void InputManager_Initialize()
 }
 
 //======================================
-// I
+// 終了
 //======================================
 void InputManager_Finalize()
 {
-    // ɂȂ
+    // 特になし
 }
 
 //======================================
-// XVit[̍ŏ1񂾂Ăԁj
+// 更新（フレームの最初に1回だけ呼ぶ）
 //======================================
 void InputManager_Update()
 {
@@ -37,7 +37,7 @@ void InputManager_Update()
 }
 
 //======================================
-// }EXԎ擾
+// マウス状態取得
 //======================================
 const Mouse_State& InputManager_GetMouseState()
 {
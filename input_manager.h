@@ -1,6 +1,6 @@
 /****************************************
  * @file input_manager.h
- * @brief ͊Ǘi}EXԂ̈ꌳǗj
+ * @brief 入力管理（マウス状態の一元管理）
  * @author Natsume Shidara
  * @date 2026/01/07
  ****************************************/
@@ -11,18 +11,18 @@
 #include "mouse.h"
 
  //======================================
- // EI
+ // 初期化・終了
  //======================================
 void InputManager_Initialize();
 void InputManager_Finalize();
 
 //======================================
-// XVit[̍ŏ1񂾂Ăԁj
+// 更新（フレームの最初に1回だけ呼ぶ）
 //======================================
 void InputManager_Update();
 
 //======================================
-// }EXԎ擾ixĂłlԂj
+// マウス状態取得（何度呼んでも同じ値を返す）
 //======================================
 const Mouse_State& InputManager_GetMouseState();
 
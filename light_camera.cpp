@@ -2,15 +2,15 @@
 
 using namespace DirectX;
 
-static XMFLOAT3 g_Position{ 0.0f, 20.0f, 0.0f }; // ʒuKɓĂ
-static XMFLOAT3 g_Front{ 0.0f, -1.0f, 0.0f };    // lu^vɂă[h
-static XMFLOAT3 g_Up{ 0.0f, 0.0f, 1.0f };        // ^ƂUpYȊO(ZȂ)ɂ
+static XMFLOAT3 g_Position{ 0.0f, 20.0f, 0.0f }; // 初期位置も適当に入れておく
+static XMFLOAT3 g_Front{ 0.0f, -1.0f, 0.0f };    // 初期値を「真下」にしてゼロを防ぐ
+static XMFLOAT3 g_Up{ 0.0f, 0.0f, 1.0f };        // 真下を向くときのUpはY軸以外(Zなど)にする
 
-// r[sEvWFNVs̃LbV
+// ビュー行列・プロジェクション行列のキャッシュ
 static XMFLOAT4X4 g_ViewMatrix{};
 static XMFLOAT4X4 g_ProjectionMatrix{};
 
-// e𐶐͈
+// 影を生成する範囲
 static float g_Width = 40.0f;
 static float g_Height = 40.0f;
 static float g_Near = 1.0f;
@@ -25,7 +25,7 @@ void LightCamera_Initialize(const DirectX::XMFLOAT3& world_directional, const Di
         g_Front = { 0.0f, -1.0f, 0.0f };
     }
 
-    // vZ
+    // 初期計算
     LightCamera_Update();
 }
 
@@ -65,17 +65,17 @@ void LightCamera_Update()
     XMVECTOR dir = XMLoadFloat3(&g_Front);
     XMVECTOR up = XMLoadFloat3(&g_Up);
 
-    // LookToLH  dir [ƃNbVB
-    // dir̒ق0ȂvZȂA܂͐K鏈
+    // LookToLH は dir がゼロだとクラッシュ。
+    // dirの長さがほぼ0なら計算しない、または正規化する処理を入れる
     if (XMVector3Equal(dir, XMVectorZero())) {
-        dir = XMVectorSet(0, -1, 0, 0); // Jo
+        dir = XMVectorSet(0, -1, 0, 0); // 強制リカバリ
     }
     dir = XMVector3Normalize(dir);
 
-    // UpxNgDirsƌvZȂ̂ŁAUp𒲐
+    // UpベクトルとDirが平行だと計算がおかしくなるので、Upを調整
     XMVECTOR cross = XMVector3Cross(dir, up);
     if (XMVector3Equal(cross, XMVectorZero())) {
-        // sȏꍇAUpXȂǂɂ炷
+        // 平行な場合、UpをX軸などにずらす
         up = XMVectorSet(1, 0, 0, 0);
     }
 
@@ -3,14 +3,14 @@
 
 #include <DirectXMath.h>
 
-// icppɍ킹܂j
+// 初期化（引数をcppに合わせました）
 void LightCamera_Initialize(const DirectX::XMFLOAT3& world_directional, const DirectX::XMFLOAT3& world_Position);
 
-// I
+// 終了処理
 void LightCamera_Finalize();
 
-// ݒ֘A
-void LightCamera_SetPosition(const DirectX::XMFLOAT3& position); // ϐ̃^C|C(posiiton -> position)
+// 設定関連
+void LightCamera_SetPosition(const DirectX::XMFLOAT3& position); // 変数名のタイポ修正(posiiton -> position)
 void LightCamera_SetFront(const DirectX::XMFLOAT3& front);
 
 
@@ -19,7 +19,7 @@ void LightCamera_SetRange(float w, float h, float n, float f);
 
 void LightCamera_Update();
 
-// 擾֘A
+// 取得関連
 const DirectX::XMFLOAT4X4& LightCamera_GetViewMatrix();
 const DirectX::XMFLOAT4X4& LightCamera_GetProjectionMatrix();
 
@@ -9,8 +9,8 @@
 #include "debug_text.h"
 #include <sstream>
 
-#include "sound_manager.h"  //  audio.h ̑Ɏgp
-#include "game_settings.h"  // Q[ݒǗ
+#include "sound_manager.h"  // ← audio.h の代わりに使用
+#include "game_settings.h"  // ゲーム設定管理
 #include "fade.h"
 #include "system_timer.h"
 #include "key_logger.h"
@@ -31,7 +31,7 @@
 #include "shader3d_unlit.h"
 
 /*----------------------------------------------------------------------------------
-    C
+    メイン
 ----------------------------------------------------------------------------------*/
 int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE, _In_ LPSTR,
     _In_ int nCmdShow)
@@ -46,10 +46,10 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE, _In_ LPSTR,
     Mouse_Initialize(hWnd);
     PadLogger_Initialize();
 
-    // TEh}l[W[iInitAudio()̑j
+    // サウンドマネージャー初期化（InitAudio()の代わり）
     SoundManager_Initialize();
 
-    // Q[ݒ菉
+    // ゲーム設定初期化
     GameSettings_Initialize();
 
     Direct3D_Initialize(hWnd);
@@ -69,7 +69,7 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE, _In_ LPSTR,
     Cube_Initialize(Direct3D_GetDevice(), Direct3D_GetContext());
     Light_Initialize(Direct3D_GetDevice(), Direct3D_GetContext());
 
-    // fobOeLXg
+    // デバッグテキスト
     hal::DebugText debugText(Direct3D_GetDevice(), Direct3D_GetContext(),
         L"assets/consolab_ascii_512.png",
         Direct3D_GetBackBufferWidth(), Direct3D_GetBackBufferHeight(),
@@ -83,7 +83,7 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE, _In_ LPSTR,
     ShowWindow(hWnd, nCmdShow);
     UpdateWindow(hWnd);
 
-    // fpsEst[vp
+    // fps・実行フレーム計測用
     double exec_last_time = SystemTimer_GetTime();
     double fps_last_time = exec_last_time;
     double current_time = 0.0;
@@ -123,12 +123,12 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE, _In_ LPSTR,
                 Fade_Update(elapsed_time);
 
                 //----------------------------------------------------------
-                // `揈
+                // 描画処理
                 //----------------------------------------------------------
-                // Scene_Draw ŁuItXN[vuC`vuUIv̑SĂ
+                // Scene_Draw 内で「オフスクリーン」→「メイン描画」→「UI」の全てを完結させる
                 Scene_Draw();
 
-                // tF[hEfobO\iőOʁj
+                // フェード・デバッグ表示（最前面）
                 Direct3D_SetBlendState(BlendMode::Alpha);
                 Fade_Draw();
 
@@ -156,10 +156,10 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE, _In_ LPSTR,
 
     Scene_Finalize();
 
-    // Q[ݒI
+    // ゲーム設定終了
     GameSettings_Finalize();
 
-    // TEh}l[W[I
+    // サウンドマネージャー終了
     SoundManager_Finalize();
 
     Fade_Finalize();
@@ -1,16 +1,25 @@
 /****************************************
  * @file map.cpp
- * @brief }bvǗуIuWFNgzu
+ * @brief マップ管理およびオブジェクト配置
  * @author Natsume Shidara
  * @date 2025/12/19
  * @update 2025/12/19
+ * @update 2026/10/18 - 一様グリッドによる空間インデックス追加
+ * @update 2026/10/18 - レイヤーマスク付き問い合わせと焼き込み破片の追加・除去
+ * @update 2026/10/18 - 空間インデックスの版数
+ * @update 2026/10/18 - メッシュを持つオブジェクトのレイ判定を三角形で行う
+ * @update 2026/10/18 - グリッドを MapGrid へ分離
+ * @update 2026/10/18 - 追加・除去でグリッドを作り直さず差分で更新
  ****************************************/
 
 #include "map.h"
+#include "map_grid.h"
 #include "cube.h"
+#include "ray.h"
 #include <DirectXMath.h>
 #include <vector>
 #include <cmath>
+#include <algorithm>
 
 using namespace DirectX;
 
@@ -23,31 +32,38 @@ using namespace DirectX;
 #include "light.h"
 #include "player_camera.h"
 #include "model.h"
+#include "mesh_collider.h"
 
 //--------------------------------------
-// O[oϐQ
+// グローバル変数群
 //--------------------------------------
 static int g_CubeTexId = -1;
-static std::wstring TEXTURE_PATH = L"assets/box.png"; // ۂeNX`΍ւ
+static std::wstring TEXTURE_PATH = L"assets/box.png"; // 雪っぽいテクスチャがあれば差し替え推奨
 
 static MODEL* g_pRock01{ nullptr };
 
 //--------------------------------------
-// }bvzuf[^`
+// マップ配置データ定義
 //--------------------------------------
-// J}N\L[u̍ő吔ςi\j
+// カマクラを構成するキューブの最大数を見積もり（調整可能）
 static std::vector<MapObject> g_vMapObjects;
 
+//--------------------------------------
+// 空間インデックス（一様グリッド）
+//--------------------------------------
+static MapGrid g_Grid;
+static int g_Revision = 0;                 // オブジェクトの追加・除去のたびに加算
+
 //======================================
-// ⏕֐
+// 内部補助関数
 //======================================
 /**
- * @brief J}N`̃IuWFNgQ𐶐
- * @param centerOffset J}N̒SW
+ * @brief カマクラ形状のオブジェクト群を生成する
+ * @param centerOffset カマクラの中心座標
  */
 void CreateKamakura(XMFLOAT3 centerOffset)
 {
-    // nʁiKindId: 0j
+    // 地面（KindId: 0）
     g_vMapObjects.push_back({
         0,
         { 0.0f, 0.0f, 0.0f },
@@ -55,17 +71,17 @@ void CreateKamakura(XMFLOAT3 centerOffset)
         });
 
     const float PI = 3.14159265f;
-    const float radiusBase = 4.0f; // ʂ̔a
-    const int stages = 5;          // ςݏグi
-    const float cubeSize = 1.0f;   // L[u1
+    const float radiusBase = 4.0f; // 底面の半径
+    const int stages = 5;          // 積み上げる段数
+    const float cubeSize = 1.0f;   // キューブの1辺
 
     for (int s = 0; s < stages; ++s)
     {
         float y = s * cubeSize;
-        // ɍsقǔaih[ɂ邽߂̊ȈՌvZj
+        // 上に行くほど半径を小さくする（ドーム状にするための簡易計算）
         float currentRadius = radiusBase * cosf((static_cast<float>(s) / stages) * (PI / 2.0f));
 
-        // iƂ̉~ɔzu
+        // 段ごとの円周上に配置する個数
         int count = static_cast<int>(2.0f * PI * currentRadius / cubeSize);
         if (count < 1) count = 1;
 
@@ -73,8 +89,8 @@ void CreateKamakura(XMFLOAT3 centerOffset)
         {
             float angle = (2.0f * PI / count) * i;
 
-            // 邽߂ɁÅpxiOj̓XLbv
-            // px 1.2 ` 1.8 Ƃ
+            // 入口を作るために、特定の角度（手前側）はスキップする
+            // 角度 1.2π ～ 1.8π あたりを入り口とする例
             if (s < 3 && (angle > PI * 1.2f && angle < PI * 1.8f))
             {
                 continue;
@@ -82,33 +98,75 @@ void CreateKamakura(XMFLOAT3 centerOffset)
 
             XMFLOAT3 pos;
             pos.x = centerOffset.x + currentRadius * cosf(angle);
-            pos.y = centerOffset.y + y + (cubeSize / 2.0f); // ڒnʂl
+            pos.y = centerOffset.y + y + (cubeSize / 2.0f); // 接地面を考慮
             pos.z = centerOffset.z + currentRadius * sinf(angle);
 
             g_vMapObjects.push_back({ 1, pos });
         }
     }
 
-    // Vǂ߂̒SL[u
+    // 天井を塞ぐための中心キューブ
     g_vMapObjects.push_back({ 1, { centerOffset.x, centerOffset.y + (stages * cubeSize), centerOffset.z } });
 }
 
 //======================================
-// {֐Q
+// 空間インデックス補助関数
 //======================================
+/**
+ * @brief 静的オブジェクトのグリッドを構築する
+ */
+static void BuildSpatialIndex()
+{
+    std::vector<AABB> bounds;
+    bounds.reserve(g_vMapObjects.size());
+    for (const MapObject& o : g_vMapObjects)
+    {
+        bounds.push_back(o.Aabb);
+    }
+
+    g_Grid.Build(bounds);
+    ++g_Revision;
+}
 
 /**
- * @brief }bv̏
+ * @brief 末尾に追加したオブジェクトをグリッドへ差し込む
+ * @detail グリッドの範囲に収まらない物体があるか、差し込んだ分が構築時の量を超えた場合は作り直す
+ */
+static void InsertSpatialIndex(int first)
+{
+    for (int i = first; i < static_cast<int>(g_vMapObjects.size()); ++i)
+    {
+        if (!g_Grid.Insert(i, g_vMapObjects[i].Aabb))
+        {
+            BuildSpatialIndex();
+            return;
+        }
+    }
+
+    if (g_Grid.ShouldRebuild())
+    {
+        BuildSpatialIndex();
+        return;
+    }
+    ++g_Revision;
+}
+
+//======================================
+// 基本動作関数群
+//======================================
+
+/**
+ * @brief マップの初期化処理
  */
 void Map_Initialize()
 {
-    // eNX`ǂݍ
+    // テクスチャ読み込み
     g_CubeTexId = Texture_Load(TEXTURE_PATH.c_str());
 
-    // J}N̐iS_ɐݒj
+    // カマクラの生成（中心を原点に設定）
     CreateKamakura({ 0.0f, 0.0f, 0.0f });
 
-    // AABBi蔻p{bNXj̍XV
+    // AABB（当たり判定用ボックス）の更新
     for (MapObject& o : g_vMapObjects)
     {
         if (o.KindId == 1 || o.KindId == 2)
@@ -122,10 +180,13 @@ void Map_Initialize()
             }
         }
     }
+
+    // 当たり判定用の空間インデックスを構築
+    BuildSpatialIndex();
 }
 
 /**
- * @brief }bv̉
+ * @brief マップの解放処理
  */
 void Map_Finalize()
 {
@@ -134,10 +195,11 @@ void Map_Finalize()
         g_pRock01 = nullptr;
     }
     g_vMapObjects.clear();
+    BuildSpatialIndex();
 }
 
 /**
- * @brief }bv̍XV
+ * @brief マップの更新処理
  */
 void Map_Update(double elapsed_time)
 {
@@ -145,7 +207,7 @@ void Map_Update(double elapsed_time)
 }
 
 /**
- * @brief }bv̕`揈
+ * @brief マップの描画処理
  */
 void Map_Draw()
 {
@@ -180,7 +242,7 @@ void Map_Draw()
 }
 
 /**
- * @brief VhE}bvp`
+ * @brief シャドウマップ生成用描画
  */
 void Map_DrawShadow()
 {
@@ -210,7 +272,7 @@ void Map_DrawShadow()
 }
 
 /**
- * @brief w肵CfbNX̃IuWFNg擾
+ * @brief 指定したインデックスのオブジェクトを取得
  */
 const MapObject* Map_GetObject(int index)
 {
@@ -219,9 +281,131 @@ const MapObject* Map_GetObject(int index)
 }
 
 /**
- * @brief IuWFNg擾
+ * @brief オブジェクト総数を取得
  */
 int Map_GetObjectCount()
 {
     return static_cast<int>(g_vMapObjects.size());
-}
\ No newline at end of file
+}
+
+/**
+ * @brief オブジェクト構成の版数を取得
+ */
+int Map_GetRevision()
+{
+    return g_Revision;
+}
+
+/**
+ * @brief オブジェクトをまとめて追加
+ */
+void Map_AddObjects(const std::vector<MapObject>& objects)
+{
+    if (objects.empty()) return;
+
+    const int first = static_cast<int>(g_vMapObjects.size());
+    g_vMapObjects.insert(g_vMapObjects.end(), objects.begin(), objects.end());
+    InsertSpatialIndex(first);
+}
+
+/**
+ * @brief 指定種別のオブジェクトを除去
+ */
+void Map_RemoveObjectsByKind(int kindId)
+{
+    // 並び順を保って前へ詰め、グリッドには旧添字から新添字への対応だけを渡す
+    const int oldSize = static_cast<int>(g_vMapObjects.size());
+    std::vector<int> oldToNew(oldSize, -1);
+    int write = 0;
+    for (int read = 0; read < oldSize; ++read)
+    {
+        if (g_vMapObjects[read].KindId == kindId) continue;
+
+        oldToNew[read] = write;
+        if (write != read)
+        {
+            g_vMapObjects[write] = g_vMapObjects[read];
+        }
+        ++write;
+    }
+
+    if (write != oldSize)
+    {
+        g_vMapObjects.resize(write);
+        g_Grid.RemapIndices(oldToNew);
+        ++g_Revision;
+    }
+}
+
+//======================================
+// 空間インデックス問い合わせ
+//======================================
+
+/**
+ * @brief AABBと重なるオブジェクトを列挙
+ */
+void Map_QueryAABB(const AABB& aabb, std::vector<int>& outIndices, uint32_t layerMask)
+{
+    outIndices.clear();
+
+    g_Grid.VisitAABB(aabb, [&](int index)
+    {
+        if ((g_vMapObjects[index].Layer & layerMask) == 0) return;
+        if (Collision_IsOverlapAABB(aabb, g_vMapObjects[index].Aabb))
+        {
+            outIndices.push_back(index);
+        }
+    });
+
+    // 複数セルにまたがる物体の重複を除く
+    std::sort(outIndices.begin(), outIndices.end());
+    outIndices.erase(std::unique(outIndices.begin(), outIndices.end()), outIndices.end());
+}
+
+/**
+ * @brief 点を含むオブジェクトを列挙
+ */
+void Map_QueryPoint(const XMFLOAT3& point, std::vector<int>& outIndices, uint32_t layerMask)
+{
+    AABB pointAABB = { point, point };
+    Map_QueryAABB(pointAABB, outIndices, layerMask);
+}
+
+/**
+ * @brief レイと最初に交差するオブジェクトを取得
+ * @detail グリッド内は3D-DDAでセルを手前から辿り、確定した時点で打ち切る
+ */
+bool Map_Raycast(const Ray& ray, float maxDistance, float* outDist, int* outIndex, uint32_t layerMask)
+{
+    float bestDist = maxDistance;
+    int bestIndex = -1;
+
+    g_Grid.VisitRay(ray, maxDistance, [&](int index)
+    {
+        if ((g_vMapObjects[index].Layer & layerMask) == 0) return bestDist;
+
+        float dist = 0.0f;
+        if (!Collision_IntersectRayAABB(ray, g_vMapObjects[index].Aabb, &dist) || dist > bestDist) return bestDist;
+
+        // メッシュを持つオブジェクトはAABBの内側で三角形と判定し直す
+        const MeshCollider* mesh = g_vMapObjects[index].Mesh;
+        if (mesh && !mesh->Raycast(ray, bestDist, &dist)) return bestDist;
+
+        // 同距離ならインデックスの小さい方を優先（結果を一意にする）
+        if (dist < bestDist || bestIndex < 0 || index < bestIndex)
+        {
+            bestDist = dist;
+            bestIndex = index;
+        }
+        return bestDist;
+    });
+
+    if (bestIndex < 0)
+    {
+        return false;
+    }
+
+    if (outDist) *outDist = bestDist;
+    if (outIndex) *outIndex = bestIndex;
+    return true;
+}
@@ -1,13 +1,24 @@
 /**
  * @file map.h
- * @brief }bv̊Ǘ
+ * @brief マップの管理
  * @author Natsume Shidara
  * @date 2025/11/10
+ * @update 2026/10/18 - オブジェクトの衝突レイヤーと、焼き込み破片の追加・除去
+ * @update 2026/10/18 - シーン問い合わせ向けの版数
+ * @update 2026/10/18 - 三角形メッシュによる当たり判定
+ * @update 2026/10/18 - ステージの壁の種別
+ * @update 2026/10/18 - 追加・除去後の並び順の約束を明記
+ * @update 2026/10/18 - 追加・除去で空間インデックスを作り直さない
  */
 #ifndef MAP_H
 #define MAP_H
 #include <DirectXMath.h>
+#include <vector>
 #include "collision.h"
+#include "collider.h"
+
+class Ray;
+class MeshCollider;
 
 void Map_Initialize();
 void Map_Finalize();
@@ -20,11 +31,62 @@ struct MapObject
     int KindId;
     DirectX::XMFLOAT3 Posision;
     AABB Aabb;
+    uint32_t Layer = CollisionLayer::Static;    // 問い合わせのレイヤーマスクで選別する
+    const MeshCollider* Mesh = nullptr;         // 設定時は Aabb で候補を絞った後に三角形で判定（所有は追加した側）
 };
 
+// 静止した破片を焼き込んだ当たり判定（描画は StaticDebris が行う）
+constexpr int MAP_KIND_STATIC_DEBRIS = 4;
+// ステージの壁の当たり判定（描画は Stage が行う）
+constexpr int MAP_KIND_STAGE_WALL = 5;
+
 const MapObject* Map_GetObject(int index);
 
 int Map_GetObjectCount();
+
+/**
+ * @brief オブジェクトの追加・除去のたびに変わる版数（添字の振り直しを検知する）
+ */
+int Map_GetRevision();
 void Map_DrawShadow();
 
+/**
+ * @brief オブジェクトをまとめて末尾に追加し、空間インデックスへ差し込む
+ * @detail グリッドの範囲外の物体を含む場合、差し込んだ分が溜まった場合のみ作り直す。
+ *         問い合わせは物理ジョブから並列に行われるため、更新の合間にメインスレッドから呼ぶこと
+ */
+void Map_AddObjects(const std::vector<MapObject>& objects);
+
+/**
+ * @brief 指定種別のオブジェクトをすべて除去し、空間インデックスの添字を振り直す
+ * @detail 残りのオブジェクトは並び順を保ったまま詰める（シーン問い合わせはこれを前提に差分を取る）
+ */
+void Map_RemoveObjectsByKind(int kindId);
+
+//--------------------------------------
+// 空間インデックス（一様グリッド）問い合わせ
+// 結果はオブジェクトのインデックス（昇順・重複なし）
+// layerMask に Layer が含まれるオブジェクトのみ返す（既定は従来の静的オブジェクトのみ）
+//--------------------------------------
+
+/**
+ * @brief AABBと重なる可能性のあるオブジェクトを列挙
+ * @param outIndices 結果の格納先（呼び出し時にクリアされる）
+ */
+void Map_QueryAABB(const AABB& aabb, std::vector<int>& outIndices, uint32_t layerMask = CollisionLayer::Static);
+
+/**
+ * @brief 点を含むオブジェクトを列挙（AABBで厳密判定済み）
+ */
+void Map_QueryPoint(const DirectX::XMFLOAT3& point, std::vector<int>& outIndices, uint32_t layerMask = CollisionLayer::Static);
+
+/**
+ * @brief レイと最初に交差するオブジェクトを取得（Mesh を持つオブジェクトは三角形と判定）
+ * @param maxDistance 判定する最大距離
+ * @param outDist 交差距離（任意）
+ * @param outIndex 交差したオブジェクトのインデックス（任意）
+ */
+bool Map_Raycast(const Ray& ray, float maxDistance, float* outDist = nullptr, int* outIndex = nullptr,
+    uint32_t layerMask = CollisionLayer::Static);
+
 #endif
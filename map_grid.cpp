@@ -0,0 +1,215 @@
+﻿/****************************************
+ * @file map_grid.cpp
+ * @brief 静的オブジェクトの一様グリッドの実装
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 作り直さずに追加・除去できるようにする
+ ****************************************/
+
+#include "map_grid.h"
+#include <cmath>
+
+using namespace DirectX;
+
+namespace
+{
+    int CountSpannedCells(const AABB& aabb)
+    {
+        using namespace MapGridConfig;
+
+        XMFLOAT3 size = aabb.GetSize();
+        int nx = static_cast<int>(size.x / CELL_SIZE) + 1;
+        int ny = static_cast<int>(size.y / CELL_SIZE) + 1;
+        int nz = static_cast<int>(size.z / CELL_SIZE) + 1;
+        return nx * ny * nz;
+    }
+
+    bool ContainsAABB(const AABB& outer, const AABB& inner)
+    {
+        return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+               outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+    }
+}
+
+void MapGrid::Build(const std::vector<AABB>& bounds)
+{
+    using namespace MapGridConfig;
+
+    Clear();
+
+    if (bounds.empty())
+    {
+        return;
+    }
+
+    // 巨大な物体を分離しつつ、グリッド範囲を決定（壁に囲まれた内側へ後から差し込めるよう巨大な物体も含める）
+    XMVECTOR vMin = XMVectorReplicate(FLT_MAX);
+    XMVECTOR vMax = XMVectorReplicate(-FLT_MAX);
+    std::vector<int> gridObjects;
+    gridObjects.reserve(bounds.size());
+
+    for (int i = 0; i < static_cast<int>(bounds.size()); ++i)
+    {
+        vMin = XMVectorMin(vMin, XMLoadFloat3(&bounds[i].min));
+        vMax = XMVectorMax(vMax, XMLoadFloat3(&bounds[i].max));
+
+        if (CountSpannedCells(bounds[i]) > LARGE_OBJECT_CELL_LIMIT)
+        {
+            m_LargeObjects.push_back(i);
+            continue;
+        }
+        gridObjects.push_back(i);
+    }
+
+    XMStoreFloat3(&m_Origin, vMin);
+    XMFLOAT3 extent;
+    XMStoreFloat3(&extent, vMax - vMin);
+
+    // セル数が上限を超える軸はセルを拡大する
+    const float extents[3] = { extent.x, extent.y, extent.z };
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        m_CellSize[axis] = std::max(CELL_SIZE, extents[axis] / MAX_CELLS_PER_AXIS);
+        m_Dim[axis] = std::max(1, static_cast<int>(std::ceil(extents[axis] / m_CellSize[axis])));
+    }
+
+    const int cellCount = GetCellCount();
+    m_CellStart.assign(cellCount + 1, 0);
+    m_CellInserted.assign(cellCount, -1);
+
+    // 1パス目：セルごとの個数を数える
+    int cellMin[3], cellMax[3];
+    for (int index : gridObjects)
+    {
+        GetCellRange(bounds[index], cellMin, cellMax);
+        for (int z = cellMin[2]; z <= cellMax[2]; ++z)
+            for (int y = cellMin[1]; y <= cellMax[1]; ++y)
+                for (int x = cellMin[0]; x <= cellMax[0]; ++x)
+                    m_CellStart[CellIndex(x, y, z) + 1]++;
+    }
+
+    for (int i = 0; i < cellCount; ++i)
+    {
+        m_CellStart[i + 1] += m_CellStart[i];
+    }
+
+    // 2パス目：格納
+    m_CellItems.resize(m_CellStart[cellCount]);
+    std::vector<int> cursor(m_CellStart.begin(), m_CellStart.end() - 1);
+    for (int index : gridObjects)
+    {
+        GetCellRange(bounds[index], cellMin, cellMax);
+        for (int z = cellMin[2]; z <= cellMax[2]; ++z)
+            for (int y = cellMin[1]; y <= cellMax[1]; ++y)
+                for (int x = cellMin[0]; x <= cellMax[0]; ++x)
+                    m_CellItems[cursor[CellIndex(x, y, z)]++] = index;
+    }
+}
+
+bool MapGrid::Insert(int index, const AABB& aabb)
+{
+    if (CountSpannedCells(aabb) > MapGridConfig::LARGE_OBJECT_CELL_LIMIT)
+    {
+        m_LargeObjects.push_back(index);
+        return true;
+    }
+
+    // 範囲外の部分は問い合わせの対象にならないため、収まらない物体は作り直しで範囲を広げる
+    if (IsEmpty() || !ContainsAABB(GetGridBounds(), aabb))
+    {
+        return false;
+    }
+
+    int cellMin[3], cellMax[3];
+    GetCellRange(aabb, cellMin, cellMax);
+    for (int z = cellMin[2]; z <= cellMax[2]; ++z)
+        for (int y = cellMin[1]; y <= cellMax[1]; ++y)
+            for (int x = cellMin[0]; x <= cellMax[0]; ++x)
+            {
+                const int cell = CellIndex(x, y, z);
+                m_InsertedItems.push_back({ index, m_CellInserted[cell] });
+                m_CellInserted[cell] = static_cast<int>(m_InsertedItems.size()) - 1;
+            }
+    return true;
+}
+
+void MapGrid::RemapIndices(const std::vector<int>& oldToNew)
+{
+    // 連続配列はセル順に前へ詰める（書き込み位置は読み出し位置を追い越さない）
+    const int cellCount = IsEmpty() ? 0 : GetCellCount();
+    int write = 0;
+    for (int cell = 0; cell < cellCount; ++cell)
+    {
+        const int begin = m_CellStart[cell];
+        const int end = m_CellStart[cell + 1];
+        m_CellStart[cell] = write;
+        for (int i = begin; i < end; ++i)
+        {
+            const int newIndex = oldToNew[m_CellItems[i]];
+            if (newIndex >= 0) m_CellItems[write++] = newIndex;
+        }
+    }
+    if (cellCount > 0)
+    {
+        m_CellStart[cellCount] = write;
+    }
+    m_CellItems.resize(write);
+
+    // 差し込み分はリストを辿り直して除去した物体を外す
+    for (int cell = 0; cell < cellCount; ++cell)
+    {
+        int* link = &m_CellInserted[cell];
+        while (*link >= 0)
+        {
+            InsertedItem& item = m_InsertedItems[*link];
+            item.index = oldToNew[item.index];
+            if (item.index < 0) *link = item.next;
+            else link = &item.next;
+        }
+    }
+
+    for (int& index : m_LargeObjects)
+    {
+        index = oldToNew[index];
+    }
+    m_LargeObjects.erase(std::remove(m_LargeObjects.begin(), m_LargeObjects.end(), -1), m_LargeObjects.end());
+}
+
+void MapGrid::Clear()
+{
+    m_CellStart.clear();
+    m_CellItems.clear();
+    m_CellInserted.clear();
+    m_InsertedItems.clear();
+    m_LargeObjects.clear();
+    m_Dim[0] = m_Dim[1] = m_Dim[2] = 0;
+}
+
+AABB MapGrid::GetGridBounds() const
+{
+    AABB grid;
+    grid.min = m_Origin;
+    grid.max = {
+        m_Origin.x + m_CellSize[0] * m_Dim[0],
+        m_Origin.y + m_CellSize[1] * m_Dim[1],
+        m_Origin.z + m_CellSize[2] * m_Dim[2]
+    };
+    return grid;
+}
+
+void MapGrid::GetCellRange(const AABB& aabb, int outMin[3], int outMax[3]) const
+{
+    outMin[0] = ToCell(aabb.min.x, 0);
+    outMin[1] = ToCell(aabb.min.y, 1);
+    outMin[2] = ToCell(aabb.min.z, 2);
+    outMax[0] = ToCell(aabb.max.x, 0);
+    outMax[1] = ToCell(aabb.max.y, 1);
+    outMax[2] = ToCell(aabb.max.z, 2);
+}
+
+int MapGrid::ToCell(float value, int axis) const
+{
+    const float origin = (axis == 0) ? m_Origin.x : (axis == 1) ? m_Origin.y : m_Origin.z;
+    const int cell = static_cast<int>(std::floor((value - origin) / m_CellSize[axis]));
+    return std::clamp(cell, 0, m_Dim[axis] - 1);
+}
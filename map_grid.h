@@ -0,0 +1,230 @@
+﻿/****************************************
+ * @file map_grid.h
+ * @brief 静的オブジェクトの一様グリッド（空間インデックス）
+ * @detail 物体のAABBをセルごとの連続配列（CSR形式）にまとめ、
+ *         問い合わせは重なるセルとグリッド外で管理する巨大な物体の添字を列挙する。
+ *         構築後に追加した物体はセルごとの連結リストへ差し込み、除去は添字の振り直しで反映する。
+ *         添字は Build に渡した配列の並び順で、重なり・レイヤーの判定は呼び出し側が行う
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 作り直さずに追加・除去できるようにする
+ ****************************************/
+
+#ifndef MAP_GRID_H
+#define MAP_GRID_H
+
+#include <DirectXMath.h>
+#include <algorithm>
+#include <cfloat>
+#include <vector>
+#include "collision.h"
+#include "ray.h"
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace MapGridConfig
+{
+    constexpr float CELL_SIZE = 2.0f;              // 基準セルサイズ
+    constexpr int MAX_CELLS_PER_AXIS = 128;        // 1軸あたりの最大セル数
+    constexpr int LARGE_OBJECT_CELL_LIMIT = 64;    // これを超えるセルにまたがる物体はグリッド外で管理
+}
+
+//--------------------------------------
+// クラス宣言
+//--------------------------------------
+/****************************************
+ * @class MapGrid
+ * @brief 静的物体向けのグリッド（追加は差し込み、溜まったら呼び出し側で作り直す）
+ ****************************************/
+class MapGrid
+{
+public:
+    MapGrid() = default;
+
+    /**
+     * @brief 物体のAABBからグリッドを構築（以前の内容は破棄）
+     * @detail 計数ソートでセルごとの連続配列にまとめる。
+     *         範囲は巨大な物体も含めた全体を覆うため、壁の内側に後から置く物体は作り直さずに差し込める
+     */
+    void Build(const std::vector<AABB>& bounds);
+
+    /**
+     * @brief 構築後に追加した物体をセルへ差し込む
+     * @return グリッドの範囲に収まらず差し込めなかった場合 false（呼び出し側で Build し直す）
+     */
+    bool Insert(int index, const AABB& aabb);
+
+    /**
+     * @brief 物体の除去に合わせて添字を振り直す
+     * @param oldToNew 旧添字 -> 新添字（除去した物体は -1）
+     */
+    void RemapIndices(const std::vector<int>& oldToNew);
+
+    /**
+     * @brief 差し込んだ物体が構築時の量を超え、作り直した方が問い合わせが速くなるか
+     */
+    bool ShouldRebuild() const { return m_InsertedItems.size() > m_CellItems.size(); }
+
+    void Clear();
+    bool IsEmpty() const { return m_Dim[0] == 0 || m_Dim[1] == 0 || m_Dim[2] == 0; }
+
+    int GetLargeObjectCount() const { return static_cast<int>(m_LargeObjects.size()); }
+    int GetCellCount() const { return m_Dim[0] * m_Dim[1] * m_Dim[2]; }
+
+    /**
+     * @brief aabb と重なるセルの物体と巨大な物体の添字ごとに visit(index) を呼ぶ
+     * @detail 複数のセルにまたがる物体は重複して渡される
+     */
+    template<typename Visitor>
+    void VisitAABB(const AABB& aabb, Visitor&& visit) const;
+
+    /**
+     * @brief レイが通るセルを3D-DDAで手前から辿り、物体の添字ごとに visit(index) を呼ぶ
+     * @detail visit はその時点の最短交差距離（未交差なら maxDistance）を返す。
+     *         次のセル境界がそれより遠くなった時点で打ち切る。巨大な物体は最初にまとめて渡す
+     */
+    template<typename Visitor>
+    void VisitRay(const Ray& ray, float maxDistance, Visitor&& visit) const;
+
+private:
+    /**
+     * @struct InsertedItem
+     * @brief 構築後に差し込んだ物体（セルごとの単方向リスト）
+     */
+    struct InsertedItem
+    {
+        int index;
+        int next;   // 同じセルの次の要素（-1 で終端）
+    };
+
+    /**
+     * @brief セル1つ分の物体（連続配列と差し込み分）ごとに visit(index) を呼ぶ
+     */
+    template<typename Visitor>
+    void VisitCell(int cell, Visitor&& visit) const;
+
+    AABB GetGridBounds() const;
+    void GetCellRange(const AABB& aabb, int outMin[3], int outMax[3]) const;
+    int ToCell(float value, int axis) const;
+    int CellIndex(int x, int y, int z) const { return (z * m_Dim[1] + y) * m_Dim[0] + x; }
+
+    DirectX::XMFLOAT3 m_Origin{ 0.0f, 0.0f, 0.0f };
+    float m_CellSize[3] = { MapGridConfig::CELL_SIZE, MapGridConfig::CELL_SIZE, MapGridConfig::CELL_SIZE };
+    int m_Dim[3] = { 0, 0, 0 };
+    std::vector<int> m_CellStart;       // セルごとの開始位置（セル数+1）
+    std::vector<int> m_CellItems;       // セル順に並べた物体の添字
+    std::vector<int> m_CellInserted;    // セルごとの差し込み分の先頭（-1 で空）
+    std::vector<InsertedItem> m_InsertedItems;
+    std::vector<int> m_LargeObjects;    // 地面など巨大な物体（常に判定対象）
+};
+
+//======================================
+// テンプレート実装
+//======================================
+template<typename Visitor>
+void MapGrid::VisitCell(int cell, Visitor&& visit) const
+{
+    for (int i = m_CellStart[cell]; i < m_CellStart[cell + 1]; ++i)
+    {
+        visit(m_CellItems[i]);
+    }
+    for (int item = m_CellInserted[cell]; item >= 0; item = m_InsertedItems[item].next)
+    {
+        visit(m_InsertedItems[item].index);
+    }
+}
+
+template<typename Visitor>
+void MapGrid::VisitAABB(const AABB& aabb, Visitor&& visit) const
+{
+    if (!IsEmpty() && Collision_IsOverlapAABB(aabb, GetGridBounds()))
+    {
+        int cellMin[3], cellMax[3];
+        GetCellRange(aabb, cellMin, cellMax);
+
+        for (int z = cellMin[2]; z <= cellMax[2]; ++z)
+        {
+            for (int y = cellMin[1]; y <= cellMax[1]; ++y)
+            {
+                for (int x = cellMin[0]; x <= cellMax[0]; ++x)
+                {
+                    VisitCell(CellIndex(x, y, z), visit);
+                }
+            }
+        }
+    }
+
+    for (int index : m_LargeObjects)
+    {
+        visit(index);
+    }
+}
+
+template<typename Visitor>
+void MapGrid::VisitRay(const Ray& ray, float maxDistance, Visitor&& visit) const
+{
+    float bestDist = maxDistance;
+    for (int index : m_LargeObjects)
+    {
+        bestDist = visit(index);
+    }
+
+    if (IsEmpty()) return;
+
+    float tEnter = 0.0f;
+    if (!Collision_IntersectRayAABB(ray, GetGridBounds(), &tEnter) || tEnter > bestDist) return;
+
+    const DirectX::XMFLOAT3 origin = ray.GetOrigin();
+    const DirectX::XMFLOAT3 dir = ray.GetDirection();
+    const float o[3] = { origin.x, origin.y, origin.z };
+    const float d[3] = { dir.x, dir.y, dir.z };
+    const float gridOrigin[3] = { m_Origin.x, m_Origin.y, m_Origin.z };
+
+    // 進入点のセルとDDAの初期値
+    int cell[3], step[3];
+    float tMax[3], tDelta[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        cell[axis] = ToCell(o[axis] + d[axis] * tEnter, axis);
+
+        if (d[axis] > 1e-6f)
+        {
+            step[axis] = 1;
+            const float boundary = gridOrigin[axis] + (cell[axis] + 1) * m_CellSize[axis];
+            tMax[axis] = (boundary - o[axis]) / d[axis];
+            tDelta[axis] = m_CellSize[axis] / d[axis];
+        }
+        else if (d[axis] < -1e-6f)
+        {
+            step[axis] = -1;
+            const float boundary = gridOrigin[axis] + cell[axis] * m_CellSize[axis];
+            tMax[axis] = (boundary - o[axis]) / d[axis];
+            tDelta[axis] = -m_CellSize[axis] / d[axis];
+        }
+        else
+        {
+            step[axis] = 0;
+            tMax[axis] = FLT_MAX;
+            tDelta[axis] = FLT_MAX;
+        }
+    }
+
+    while (true)
+    {
+        VisitCell(CellIndex(cell[0], cell[1], cell[2]), [&](int index)
+        {
+            bestDist = visit(index);
+        });
+
+        // 次のセル境界より手前で交差が確定したら終了
+        const int axis = (tMax[0] < tMax[1]) ? ((tMax[0] < tMax[2]) ? 0 : 2) : ((tMax[1] < tMax[2]) ? 1 : 2);
+        if (tMax[axis] >= bestDist) break;
+
+        cell[axis] += step[axis];
+        if (step[axis] == 0 || cell[axis] < 0 || cell[axis] >= m_Dim[axis]) break;
+        tMax[axis] += tDelta[axis];
+    }
+}
+
+#endif // MAP_GRID_H
@@ -0,0 +1,597 @@
+﻿/****************************************
+ * @file mesh_collider.cpp
+ * @brief 三角形メッシュによる静的コライダーの実装
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#include "mesh_collider.h"
+#include "collider.h"
+#include "ray.h"
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+
+using namespace DirectX;
+
+//======================================
+// 内部ヘルパー関数
+//======================================
+namespace
+{
+    // これ以下の距離の接触は同一点とみなして深い方だけ残す
+    constexpr float CONTACT_MERGE_DISTANCE = 0.01f;
+    // これ未満の距離は線分が三角形に触れている（貫いている）とみなす
+    constexpr float TOUCH_EPSILON = 1e-5f;
+    // 最近接点の差が法線と平行（面の内側で接している）とみなす許容量
+    constexpr float FACE_EPSILON = 1e-4f;
+
+    /**
+     * @brief 接触を追加（近い既存点は深い方を残し、満杯なら最も浅い点と入れ替える）
+     */
+    void PushContact(Hit* outHits, int& count, int maxHits, const Hit& hit)
+    {
+        const float mergeSq = CONTACT_MERGE_DISTANCE * CONTACT_MERGE_DISTANCE;
+        XMVECTOR point = XMLoadFloat3(&hit.contactPoint);
+        int shallowest = -1;
+
+        for (int i = 0; i < count; ++i)
+        {
+            float distSq = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(XMLoadFloat3(&outHits[i].contactPoint), point)));
+            if (distSq < mergeSq)
+            {
+                if (hit.depth > outHits[i].depth) outHits[i] = hit;
+                return;
+            }
+            if (shallowest < 0 || outHits[i].depth < outHits[shallowest].depth)
+            {
+                shallowest = i;
+            }
+        }
+
+        if (count < maxHits)
+        {
+            outHits[count++] = hit;
+        }
+        else if (shallowest >= 0 && hit.depth > outHits[shallowest].depth)
+        {
+            outHits[shallowest] = hit;
+        }
+    }
+
+    float PlaneDistance(const Triangle& tri, FXMVECTOR point)
+    {
+        return XMVectorGetX(XMVector3Dot(XMLoadFloat3(&tri.normal), XMVectorSubtract(point, XMLoadFloat3(&tri.p0))));
+    }
+
+    OBB MakeOBBFromAABB(const AABB& aabb)
+    {
+        OBB obb;
+        obb.center = aabb.GetCenter();
+        XMStoreFloat3(&obb.extents, XMVectorScale(XMVectorSubtract(XMLoadFloat3(&aabb.max), XMLoadFloat3(&aabb.min)), 0.5f));
+        obb.orientation = { 0.0f, 0.0f, 0.0f, 1.0f };
+        return obb;
+    }
+
+    AABB GetTriangleBounds(const Triangle& tri)
+    {
+        XMVECTOR p0 = XMLoadFloat3(&tri.p0);
+        XMVECTOR p1 = XMLoadFloat3(&tri.p1);
+        XMVECTOR p2 = XMLoadFloat3(&tri.p2);
+
+        AABB bounds;
+        XMStoreFloat3(&bounds.min, XMVectorMin(p0, XMVectorMin(p1, p2)));
+        XMStoreFloat3(&bounds.max, XMVectorMax(p0, XMVectorMax(p1, p2)));
+        return bounds;
+    }
+
+    void MergeBounds(AABB& bounds, const AABB& other)
+    {
+        XMStoreFloat3(&bounds.min, XMVectorMin(XMLoadFloat3(&bounds.min), XMLoadFloat3(&other.min)));
+        XMStoreFloat3(&bounds.max, XMVectorMax(XMLoadFloat3(&bounds.max), XMLoadFloat3(&other.max)));
+    }
+
+    AABB GetSegmentBounds(FXMVECTOR start, FXMVECTOR end, float radius)
+    {
+        XMVECTOR r = XMVectorReplicate(radius);
+
+        AABB bounds;
+        XMStoreFloat3(&bounds.min, XMVectorSubtract(XMVectorMin(start, end), r));
+        XMStoreFloat3(&bounds.max, XMVectorAdd(XMVectorMax(start, end), r));
+        return bounds;
+    }
+
+    /**
+     * @brief 線分と三角形の最近接点
+     * @return 最短距離（線分が三角形を貫く場合は 0）
+     */
+    float ClosestSegmentTriangle(FXMVECTOR start, FXMVECTOR end, const Triangle& tri, XMVECTOR& outSegment, XMVECTOR& outTriangle)
+    {
+        // 平面を貫く交点が三角形の内側にあれば距離 0
+        const float distStart = PlaneDistance(tri, start);
+        const float distEnd = PlaneDistance(tri, end);
+        if ((distStart <= 0.0f) != (distEnd <= 0.0f))
+        {
+            XMVECTOR cross = XMVectorLerp(start, end, distStart / (distStart - distEnd));
+            XMFLOAT3 fCross;
+            XMStoreFloat3(&fCross, cross);
+            XMFLOAT3 onTri = Collision_ClosestPointTriangle(fCross, tri);
+            if (XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(XMLoadFloat3(&onTri), cross))) < TOUCH_EPSILON * TOUCH_EPSILON)
+            {
+                outSegment = cross;
+                outTriangle = cross;
+                return 0.0f;
+            }
+        }
+
+        // 貫かない場合の最近接点は、線分の端点と面の組か、線分と三角形の辺の組のどちらか
+        XMFLOAT3 fStart, fEnd;
+        XMStoreFloat3(&fStart, start);
+        XMStoreFloat3(&fEnd, end);
+
+        float best = FLT_MAX;
+        auto consider = [&](FXMVECTOR onSegment, FXMVECTOR onTriangle)
+        {
+            float dist = XMVectorGetX(XMVector3Length(XMVectorSubtract(onSegment, onTriangle)));
+            if (dist < best)
+            {
+                best = dist;
+                outSegment = onSegment;
+                outTriangle = onTriangle;
+            }
+        };
+
+        const XMFLOAT3 closestStart = Collision_ClosestPointTriangle(fStart, tri);
+        const XMFLOAT3 closestEnd = Collision_ClosestPointTriangle(fEnd, tri);
+        consider(start, XMLoadFloat3(&closestStart));
+        consider(end, XMLoadFloat3(&closestEnd));
+
+        const XMFLOAT3* edges[3][2] = { { &tri.p0, &tri.p1 }, { &tri.p1, &tri.p2 }, { &tri.p2, &tri.p0 } };
+        for (const auto& edge : edges)
+        {
+            float s = 0.0f, t = 0.0f;
+            Collision_DistanceSegmentSegment(fStart, fEnd, *edge[0], *edge[1], &s, &t);
+            consider(XMVectorLerp(start, end, s), XMVectorLerp(XMLoadFloat3(edge[0]), XMLoadFloat3(edge[1]), t));
+        }
+        return best;
+    }
+
+    /**
+     * @brief レイと三角形（両面、Moller-Trumbore）
+     */
+    bool IntersectRayTriangle(FXMVECTOR origin, FXMVECTOR dir, const Triangle& tri, float& outDist)
+    {
+        XMVECTOR p0 = XMLoadFloat3(&tri.p0);
+        XMVECTOR edge1 = XMVectorSubtract(XMLoadFloat3(&tri.p1), p0);
+        XMVECTOR edge2 = XMVectorSubtract(XMLoadFloat3(&tri.p2), p0);
+
+        XMVECTOR pvec = XMVector3Cross(dir, edge2);
+        float det = XMVectorGetX(XMVector3Dot(edge1, pvec));
+        if (std::abs(det) < 1e-8f) return false;
+
+        float invDet = 1.0f / det;
+        XMVECTOR tvec = XMVectorSubtract(origin, p0);
+        float u = XMVectorGetX(XMVector3Dot(tvec, pvec)) * invDet;
+        if (u < 0.0f || u > 1.0f) return false;
+
+        XMVECTOR qvec = XMVector3Cross(tvec, edge1);
+        float v = XMVectorGetX(XMVector3Dot(dir, qvec)) * invDet;
+        if (v < 0.0f || u + v > 1.0f) return false;
+
+        outDist = XMVectorGetX(XMVector3Dot(edge2, qvec)) * invDet;
+        return outDist >= 0.0f;
+    }
+}
+
+//======================================
+// 構築
+//======================================
+void MeshCollider::Build(const std::vector<Triangle>& triangles, int leafTriangles)
+{
+    Clear();
+
+    // 法線を事前計算し、面積のない三角形は捨てる
+    std::vector<Triangle> source;
+    source.reserve(triangles.size());
+    for (Triangle tri : triangles)
+    {
+        XMVECTOR p0 = XMLoadFloat3(&tri.p0);
+        XMVECTOR n = XMVector3Cross(XMVectorSubtract(XMLoadFloat3(&tri.p1), p0), XMVectorSubtract(XMLoadFloat3(&tri.p2), p0));
+        if (XMVectorGetX(XMVector3LengthSq(n)) <= MeshColliderConfig::DEGENERATE_EPSILON) continue;
+
+        XMStoreFloat3(&tri.normal, XMVector3Normalize(n));
+        source.push_back(tri);
+    }
+    if (source.empty()) return;
+
+    std::vector<XMFLOAT3> centroids(source.size());
+    std::vector<AABB> triangleBounds(source.size());
+    std::vector<int> order(source.size());
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        triangleBounds[i] = GetTriangleBounds(source[i]);
+        XMVECTOR sum = XMVectorAdd(XMLoadFloat3(&source[i].p0), XMVectorAdd(XMLoadFloat3(&source[i].p1), XMLoadFloat3(&source[i].p2)));
+        XMStoreFloat3(&centroids[i], XMVectorScale(sum, 1.0f / 3.0f));
+        order[i] = static_cast<int>(i);
+    }
+
+    // 節点数は葉の数の2倍未満
+    m_Nodes.reserve(source.size() * 2 / std::max(leafTriangles, 1) + 1);
+    BuildNode(order, 0, static_cast<int>(order.size()), std::max(leafTriangles, 1), centroids, triangleBounds);
+
+    // 葉ごとに三角形が連続するよう並べ替えて保持
+    m_Triangles.reserve(source.size());
+    for (int index : order)
+    {
+        m_Triangles.push_back(source[index]);
+    }
+}
+
+void MeshCollider::Clear()
+{
+    m_Nodes.clear();
+    m_Triangles.clear();
+}
+
+/**
+ * @brief [begin, end) の三角形を包む節点を作り、重心の広がりが最大の軸の中央値で分割する
+ * @return 作成した節点の添字
+ */
+int MeshCollider::BuildNode(std::vector<int>& order, int begin, int end, int leafTriangles,
+    const std::vector<XMFLOAT3>& centroids, const std::vector<AABB>& triangleBounds)
+{
+    const int nodeIndex = static_cast<int>(m_Nodes.size());
+    m_Nodes.emplace_back();
+
+    AABB bounds = triangleBounds[order[begin]];
+    XMVECTOR centroidMin = XMLoadFloat3(&centroids[order[begin]]);
+    XMVECTOR centroidMax = centroidMin;
+    for (int i = begin + 1; i < end; ++i)
+    {
+        MergeBounds(bounds, triangleBounds[order[i]]);
+        centroidMin = XMVectorMin(centroidMin, XMLoadFloat3(&centroids[order[i]]));
+        centroidMax = XMVectorMax(centroidMax, XMLoadFloat3(&centroids[order[i]]));
+    }
+    m_Nodes[nodeIndex].bounds = bounds;
+
+    XMFLOAT3 spread;
+    XMStoreFloat3(&spread, XMVectorSubtract(centroidMax, centroidMin));
+    const int axis = (spread.x >= spread.y && spread.x >= spread.z) ? 0 : (spread.y >= spread.z ? 1 : 2);
+    const float axisSpread = (axis == 0) ? spread.x : (axis == 1 ? spread.y : spread.z);
+
+    // 重心がすべて重なっている場合も分割しようがないので葉にする
+    const int count = end - begin;
+    if (count <= leafTriangles || axisSpread <= 0.0f)
+    {
+        m_Nodes[nodeIndex].first = begin;
+        m_Nodes[nodeIndex].count = count;
+        return nodeIndex;
+    }
+
+    const int mid = begin + count / 2;
+    std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end, [&centroids, axis](int a, int b)
+    {
+        return (&centroids[a].x)[axis] < (&centroids[b].x)[axis];
+    });
+
+    // 左の子は直後に作られる。emplace_back で参照が無効になるため右の子は添字で書き戻す
+    BuildNode(order, begin, mid, leafTriangles, centroids, triangleBounds);
+    const int right = BuildNode(order, mid, end, leafTriangles, centroids, triangleBounds);
+    m_Nodes[nodeIndex].first = right;
+    m_Nodes[nodeIndex].count = 0;
+    return nodeIndex;
+}
+
+//======================================
+// 走査
+//======================================
+template <typename Visitor>
+void MeshCollider::VisitTriangles(const AABB& bounds, Visitor&& visit) const
+{
+    if (!IsBuilt()) return;
+
+    int stack[MeshColliderConfig::MAX_DEPTH];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const int nodeIndex = stack[--top];
+        const Node& node = m_Nodes[nodeIndex];
+        if (!Collision_IsOverlapAABB(node.bounds, bounds)) continue;
+
+        if (node.count > 0)
+        {
+            for (int i = node.first; i < node.first + node.count; ++i)
+            {
+                visit(i);
+            }
+            continue;
+        }
+
+        // 左の子は直後の要素（中央値分割の深さならスタックは溢れない）
+        if (top + 2 > MeshColliderConfig::MAX_DEPTH) continue;
+        stack[top++] = node.first;
+        stack[top++] = nodeIndex + 1;
+    }
+}
+
+void MeshCollider::QueryTriangles(const AABB& bounds, std::vector<int>& outTriangles) const
+{
+    outTriangles.clear();
+    VisitTriangles(bounds, [&outTriangles](int index) { outTriangles.push_back(index); });
+}
+
+//======================================
+// 衝突判定
+//======================================
+int MeshCollider::Collide(const Collider& collider, Hit* outHits, int maxHits) const
+{
+    if (!IsBuilt() || !outHits || maxHits <= 0) return 0;
+
+    switch (collider.type)
+    {
+    case ColliderType::Sphere:
+        return CollideSegment(collider.sphere.center, collider.sphere.center, collider.sphere.radius, outHits, maxHits);
+    case ColliderType::Capsule:
+        return CollideSegment(collider.capsule.start, collider.capsule.end, collider.capsule.radius, outHits, maxHits);
+    case ColliderType::Box:
+        return CollideOBB(collider.obb, outHits, maxHits);
+    default:
+        return CollideOBB(MakeOBBFromAABB(collider.GetBoundingBox()), outHits, maxHits);
+    }
+}
+
+/**
+ * @brief 線分に半径を持たせた形状（球は長さ0の線分）とメッシュの接触
+ */
+int MeshCollider::CollideSegment(const XMFLOAT3& start, const XMFLOAT3& end, float radius, Hit* outHits, int maxHits) const
+{
+    const XMVECTOR segStart = XMLoadFloat3(&start);
+    const XMVECTOR segEnd = XMLoadFloat3(&end);
+    int count = 0;
+
+    VisitTriangles(GetSegmentBounds(segStart, segEnd, radius), [&](int index)
+    {
+        const Triangle& tri = m_Triangles[index];
+        const XMVECTOR n = XMLoadFloat3(&tri.normal);
+
+        // 平面から表側へ半径以上離れている、または全体が裏側へ半径以上入り込んでいる三角形を除外
+        const float distStart = PlaneDistance(tri, segStart);
+        const float distEnd = PlaneDistance(tri, segEnd);
+        if (std::min(distStart, distEnd) >= radius) return;
+        if (std::max(distStart, distEnd) <= -radius) return;
+
+        XMVECTOR onSegment, onTriangle;
+        const float dist = ClosestSegmentTriangle(segStart, segEnd, tri, onSegment, onTriangle);
+        if (dist >= radius) return;
+
+        Hit hit;
+        hit.isHit = true;
+        XMStoreFloat3(&hit.contactPoint, onTriangle);
+
+        const XMVECTOR diff = XMVectorSubtract(onSegment, onTriangle);
+        const float side = XMVectorGetX(XMVector3Dot(diff, n));
+        if (dist <= TOUCH_EPSILON)
+        {
+            // 貫通：裏側の端が面の内側にあればそこまで、なければ表面まで法線方向へ押し出す
+            const XMVECTOR behind = (distStart < distEnd) ? segStart : segEnd;
+            const float behindDist = std::min(distStart, distEnd);
+            XMFLOAT3 fBehind;
+            XMStoreFloat3(&fBehind, behind);
+            const XMFLOAT3 projected = Collision_ClosestPointTriangle(fBehind, tri);
+            const float toProjected = XMVectorGetX(XMVector3Length(XMVectorSubtract(behind, XMLoadFloat3(&projected))));
+
+            hit.normal = tri.normal;
+            hit.depth = (std::abs(toProjected + behindDist) <= FACE_EPSILON) ? radius - behindDist : radius;
+        }
+        else if (std::abs(std::abs(side) - dist) <= FACE_EPSILON)
+        {
+            // 面の内側との接触（裏側へ半径未満だけ入り込んだ場合も表へ押し出す）
+            hit.normal = tri.normal;
+            hit.depth = radius - side;
+        }
+        else if (side > 0.0f)
+        {
+            // 表側の辺・頂点との接触
+            XMStoreFloat3(&hit.normal, XMVectorScale(diff, 1.0f / dist));
+            hit.depth = radius - dist;
+        }
+        else
+        {
+            // 裏側の辺・頂点は片面扱いで無視
+            return;
+        }
+
+        PushContact(outHits, count, maxHits, hit);
+    });
+
+    return count;
+}
+
+int MeshCollider::CollideOBB(const OBB& obb, Hit* outHits, int maxHits) const
+{
+    const XMVECTOR center = XMLoadFloat3(&obb.center);
+    const XMMATRIX rot = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.orientation));
+    const XMVECTOR axes[3] = {
+        XMVectorScale(rot.r[0], obb.extents.x),
+        XMVectorScale(rot.r[1], obb.extents.y),
+        XMVectorScale(rot.r[2], obb.extents.z),
+    };
+    int count = 0;
+
+    VisitTriangles(Collision_GetOBBBounds(obb), [&](int index)
+    {
+        const Triangle& tri = m_Triangles[index];
+        const XMVECTOR n = XMLoadFloat3(&tri.normal);
+
+        // 法線方向の投影半径で平面から離れている三角形と、中心が裏側にある三角形（片面扱い）を除外
+        const float projRadius = std::abs(XMVectorGetX(XMVector3Dot(n, axes[0])))
+                               + std::abs(XMVectorGetX(XMVector3Dot(n, axes[1])))
+                               + std::abs(XMVectorGetX(XMVector3Dot(n, axes[2])));
+        const float centerDist = PlaneDistance(tri, center);
+        if (centerDist >= projRadius || centerDist < 0.0f) return;
+
+        Hit hit = Collision_IsHitOBBTriangle(obb, tri);
+        if (!hit.isHit) return;
+
+        // 分離軸の向きは判定関数によらず三角形から箱の中心へ揃える
+        const XMVECTOR centroid = XMVectorScale(XMVectorAdd(XMLoadFloat3(&tri.p0), XMVectorAdd(XMLoadFloat3(&tri.p1), XMLoadFloat3(&tri.p2))), 1.0f / 3.0f);
+        if (XMVectorGetX(XMVector3Dot(XMLoadFloat3(&hit.normal), XMVectorSubtract(center, centroid))) < 0.0f)
+        {
+            XMStoreFloat3(&hit.normal, XMVectorNegate(XMLoadFloat3(&hit.normal)));
+        }
+
+        PushContact(outHits, count, maxHits, hit);
+    });
+
+    return count;
+}
+
+//======================================
+// レイ
+//======================================
+bool MeshCollider::Raycast(const Ray& ray, float maxDistance, float* outDist, XMFLOAT3* outNormal) const
+{
+    if (!IsBuilt()) return false;
+
+    const XMFLOAT3 fOrigin = ray.GetOrigin();
+    const XMFLOAT3 fDir = ray.GetDirection();
+    const XMVECTOR origin = XMLoadFloat3(&fOrigin);
+    const XMVECTOR dir = XMLoadFloat3(&fDir);
+
+    float bestDist = maxDistance;
+    int bestIndex = -1;
+
+    int stack[MeshColliderConfig::MAX_DEPTH];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const int nodeIndex = stack[--top];
+        const Node& node = m_Nodes[nodeIndex];
+
+        // 既に見つかった交差より遠い節点は調べない
+        float enter = 0.0f;
+        if (!Collision_IntersectRayAABB(ray, node.bounds, &enter) || enter > bestDist) continue;
+
+        if (node.count > 0)
+        {
+            for (int i = node.first; i < node.first + node.count; ++i)
+            {
+                float dist = 0.0f;
+                if (IntersectRayTriangle(origin, dir, m_Triangles[i], dist) && dist <= bestDist)
+                {
+                    bestDist = dist;
+                    bestIndex = i;
+                }
+            }
+            continue;
+        }
+
+        if (top + 2 > MeshColliderConfig::MAX_DEPTH) continue;
+        stack[top++] = node.first;
+        stack[top++] = nodeIndex + 1;
+    }
+
+    if (bestIndex < 0) return false;
+
+    if (outDist) *outDist = bestDist;
+    if (outNormal) *outNormal = m_Triangles[bestIndex].normal;
+    return true;
+}
+
+//======================================
+// スイープ
+//======================================
+SweepHit MeshCollider::SweepCapsule(const Capsule& capsule, const XMFLOAT3& displacement) const
+{
+    using namespace MeshColliderConfig;
+
+    SweepHit result;
+    if (!IsBuilt()) return result;
+
+    const XMVECTOR move = XMLoadFloat3(&displacement);
+    const float length = XMVectorGetX(XMVector3Length(move));
+    if (length < 1e-6f) return result;
+
+    // 移動範囲全体と重なる三角形のうち、移動方向に表を向けているものだけを候補にする
+    const XMVECTOR segStart = XMLoadFloat3(&capsule.start);
+    const XMVECTOR segEnd = XMLoadFloat3(&capsule.end);
+    AABB bounds = GetSegmentBounds(segStart, segEnd, capsule.radius + SWEEP_TOLERANCE);
+    MergeBounds(bounds, GetSegmentBounds(XMVectorAdd(segStart, move), XMVectorAdd(segEnd, move), capsule.radius + SWEEP_TOLERANCE));
+
+    thread_local std::vector<int> candidates;
+    candidates.clear();
+    VisitTriangles(bounds, [&](int index)
+    {
+        if (XMVectorGetX(XMVector3Dot(XMLoadFloat3(&m_Triangles[index].normal), move)) < 0.0f)
+        {
+            candidates.push_back(index);
+        }
+    });
+    if (candidates.empty()) return result;
+
+    // 保守的前進法：平行移動では距離の縮む速さが移動量を超えないため、隙間の分だけ進めても貫通しない
+    float time = 0.0f;
+    for (int iteration = 0; iteration < MAX_SWEEP_ITERATIONS; ++iteration)
+    {
+        const XMVECTOR offset = XMVectorScale(move, time);
+        const XMVECTOR start = XMVectorAdd(segStart, offset);
+        const XMVECTOR end = XMVectorAdd(segEnd, offset);
+
+        float minGap = FLT_MAX;
+        XMVECTOR normal = XMVectorZero();
+
+        for (int index : candidates)
+        {
+            const Triangle& tri = m_Triangles[index];
+
+            // 全体が裏側にある三角形は片面扱いで無視
+            if (std::max(PlaneDistance(tri, start), PlaneDistance(tri, end)) < 0.0f) continue;
+
+            XMVECTOR onSegment, onTriangle;
+            const float dist = ClosestSegmentTriangle(start, end, tri, onSegment, onTriangle);
+            const float gap = dist - capsule.radius;
+            if (gap >= minGap) continue;
+
+            const XMVECTOR contactNormal = (dist > TOUCH_EPSILON)
+                ? XMVectorScale(XMVectorSubtract(onSegment, onTriangle), 1.0f / dist)
+                : XMLoadFloat3(&tri.normal);
+
+            // 接している面から離れる向きの移動は妨げない
+            if (gap <= SWEEP_TOLERANCE && XMVectorGetX(XMVector3Dot(contactNormal, move)) >= 0.0f) continue;
+
+            minGap = gap;
+            normal = contactNormal;
+        }
+
+        if (minGap == FLT_MAX) return result;
+
+        if (minGap <= SWEEP_TOLERANCE)
+        {
+            result.isHit = true;
+            result.time = time;
+            XMStoreFloat3(&result.normal, normal);
+            return result;
+        }
+
+        time += (minGap - SWEEP_TOLERANCE * 0.5f) / length;
+        if (time >= 1.0f) return result;
+    }
+
+    // 反復の上限に達した場合は進めた位置で当たったものとする（すり抜けより止まる方を選ぶ）
+    result.isHit = true;
+    result.time = time;
+    return result;
+}
+
+SweepHit MeshCollider::SweepSphere(const Sphere& sphere, const XMFLOAT3& displacement) const
+{
+    Capsule capsule;
+    capsule.start = sphere.center;
+    capsule.end = sphere.center;
+    capsule.radius = sphere.radius;
+    return SweepCapsule(capsule, displacement);
+}
@@ -0,0 +1,125 @@
+﻿/****************************************
+ * @file mesh_collider.h
+ * @brief 三角形メッシュによる静的コライダー（メッシュごとのBVH付き）
+ * @detail 読み込み時に三角形をワールド座標へ変換して法線を事前計算し、
+ *         重心の中央値で分割した二分木（BVH）を1本の配列に詰めて持つ。
+ *         問い合わせは形状の境界と重なる葉の三角形だけを調べる。
+ *         三角形は表側（法線側）からの接触のみを返す片面扱い
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#ifndef MESH_COLLIDER_H
+#define MESH_COLLIDER_H
+
+#include <DirectXMath.h>
+#include <vector>
+#include "collision.h"
+
+struct Collider;
+struct MODEL;
+class Ray;
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace MeshColliderConfig
+{
+    // 1回の判定で返す接触の最大数（超えた分は浅い順に捨てる）
+    constexpr int MAX_CONTACTS = 8;
+    // 葉に入れる三角形の最大数
+    constexpr int LEAF_TRIANGLES = 4;
+    // 走査スタックの深さ（中央値分割なので三角形数の対数程度に収まる）
+    constexpr int MAX_DEPTH = 64;
+    // 外積の長さの2乗がこれ以下の三角形は面積なしとして構築時に捨てる
+    constexpr float DEGENERATE_EPSILON = 1e-10f;
+    // スイープの反復回数の上限と、接触とみなす隙間
+    constexpr int MAX_SWEEP_ITERATIONS = 16;
+    constexpr float SWEEP_TOLERANCE = 1e-3f;
+}
+
+//--------------------------------------
+// 三角形メッシュコライダー
+//--------------------------------------
+class MeshCollider
+{
+public:
+    MeshCollider() = default;
+    ~MeshCollider() = default;
+
+    /**
+     * @brief ワールド座標の三角形から構築（normal は無視し、(p1-p0)×(p2-p0) の向きを表とする）
+     * @param leafTriangles 葉に入れる三角形の最大数（三角形数以上なら根だけの総当たりになる）
+     */
+    void Build(const std::vector<Triangle>& triangles, int leafTriangles = MeshColliderConfig::LEAF_TRIANGLES);
+
+    /**
+     * @brief モデルの全メッシュをワールド行列で変換して構築（mesh_collider_model.cpp）
+     * @detail 面の表裏は巻き順ではなく頂点法線の向きに合わせる
+     */
+    void BuildFromModel(const MODEL* model, const DirectX::XMFLOAT4X4& world);
+
+    void Clear();
+    bool IsBuilt() const { return !m_Nodes.empty(); }
+
+    const AABB& GetBounds() const { return m_Nodes.front().bounds; }
+    int GetTriangleCount() const { return static_cast<int>(m_Triangles.size()); }
+    int GetNodeCount() const { return static_cast<int>(m_Nodes.size()); }
+
+    /**
+     * @brief コライダーとメッシュの接触を三角形単位で求める
+     * @param[out] outHits 接触（法線はメッシュ→コライダー、接触点はメッシュ表面上）
+     * @return 接触数（maxHits 以下）
+     * @detail 球・カプセル・OBB に対応し、それ以外はワールドAABBを箱として扱う
+     */
+    int Collide(const Collider& collider, Hit* outHits, int maxHits) const;
+
+    /**
+     * @brief レイと最初に交差する三角形（裏面も含む）
+     * @param[out] outNormal 当たった三角形の法線（任意）
+     */
+    bool Raycast(const Ray& ray, float maxDistance, float* outDist = nullptr, DirectX::XMFLOAT3* outNormal = nullptr) const;
+
+    /**
+     * @brief カプセルを移動させたときに最初に接する時刻（保守的前進法）
+     * @detail 開始時点で接していて離れる向きに動く三角形は無視する
+     */
+    SweepHit SweepCapsule(const Capsule& capsule, const DirectX::XMFLOAT3& displacement) const;
+    SweepHit SweepSphere(const Sphere& sphere, const DirectX::XMFLOAT3& displacement) const;
+
+    /**
+     * @brief 境界と重なる葉の三角形の添字を列挙
+     * @param outTriangles 結果の格納先（呼び出し時にクリアされる）
+     */
+    void QueryTriangles(const AABB& bounds, std::vector<int>& outTriangles) const;
+
+    const Triangle& GetTriangle(int index) const { return m_Triangles[index]; }
+
+private:
+    /**
+     * @struct Node
+     * @brief BVHの節（count > 0 なら葉で first は三角形の先頭、0 なら内部節点で
+     *        左の子は直後の要素、右の子は first）
+     */
+    struct Node
+    {
+        AABB bounds;
+        int first = 0;
+        int count = 0;
+    };
+
+    int BuildNode(std::vector<int>& order, int begin, int end, int leafTriangles,
+        const std::vector<DirectX::XMFLOAT3>& centroids, const std::vector<AABB>& triangleBounds);
+
+    // 境界と重なる葉の三角形の添字ごとに visit を呼ぶ（実装ファイル内でのみ使用）
+    template <typename Visitor>
+    void VisitTriangles(const AABB& bounds, Visitor&& visit) const;
+
+    int CollideSegment(const DirectX::XMFLOAT3& start, const DirectX::XMFLOAT3& end, float radius, Hit* outHits, int maxHits) const;
+    int CollideOBB(const OBB& obb, Hit* outHits, int maxHits) const;
+
+    std::vector<Node> m_Nodes;          // [0] が根（深さ優先順）
+    std::vector<Triangle> m_Triangles;  // 葉ごとに連続するよう並べ替え済み
+};
+
+#endif // MESH_COLLIDER_H
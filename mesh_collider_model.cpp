@@ -0,0 +1,53 @@
+﻿/****************************************
+ * @file mesh_collider_model.cpp
+ * @brief 三角形メッシュコライダーをモデルから構築する処理
+ * @detail モデル（MODEL）は描画側の型に依存するため、判定の本体（mesh_collider.cpp）と分けている
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#include "mesh_collider.h"
+#include "model.h"
+#include <utility>
+
+using namespace DirectX;
+
+void MeshCollider::BuildFromModel(const MODEL* model, const XMFLOAT4X4& world)
+{
+    Clear();
+    if (!model) return;
+
+    const XMMATRIX matWorld = XMLoadFloat4x4(&world);
+    std::vector<Triangle> triangles;
+
+    for (const MeshData& mesh : model->Meshes)
+    {
+        for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+        {
+            const Vertex& v0 = mesh.vertices[mesh.indices[i]];
+            const Vertex& v1 = mesh.vertices[mesh.indices[i + 1]];
+            const Vertex& v2 = mesh.vertices[mesh.indices[i + 2]];
+
+            XMVECTOR p0 = XMVector3TransformCoord(XMLoadFloat3(&v0.position), matWorld);
+            XMVECTOR p1 = XMVector3TransformCoord(XMLoadFloat3(&v1.position), matWorld);
+            XMVECTOR p2 = XMVector3TransformCoord(XMLoadFloat3(&v2.position), matWorld);
+
+            // 頂点法線の平均と逆向きの巻き順なら入れ替えて表を揃える
+            XMVECTOR vertexNormal = XMVector3TransformNormal(
+                XMVectorAdd(XMLoadFloat3(&v0.normal), XMVectorAdd(XMLoadFloat3(&v1.normal), XMLoadFloat3(&v2.normal))), matWorld);
+            XMVECTOR faceNormal = XMVector3Cross(XMVectorSubtract(p1, p0), XMVectorSubtract(p2, p0));
+            if (XMVectorGetX(XMVector3Dot(faceNormal, vertexNormal)) < 0.0f)
+            {
+                std::swap(p1, p2);
+            }
+
+            Triangle tri;
+            XMStoreFloat3(&tri.p0, p0);
+            XMStoreFloat3(&tri.p1, p1);
+            XMStoreFloat3(&tri.p2, p2);
+            triangles.push_back(tri);
+        }
+    }
+
+    Build(triangles);
+}
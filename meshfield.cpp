@@ -4,9 +4,11 @@
  * @author Natsume Shidara
  * @date 2025/12/10
  * @update 2026/01/13 - 地形隆起機能追加
+ * @update 2026/10/18 - 高さマップから地形コライダーを構築
  ****************************************/
 
 #include "meshfield.h"
+#include "heightfield.h"
 #include <DirectXMath.h>
 #include <cmath>
 #include <algorithm>
@@ -67,6 +69,9 @@ static unsigned short g_MeshIndex[NUM_INDEX];
 // 高さマップ（GetHeight用にキャッシュ）
 static float g_HeightMap[MESH_H_VERTEX_COUNT][MESH_V_VERTEX_COUNT];
 
+// 地形コライダー（高さマップから構築）
+static HeightField g_HeightField;
+
 //======================================
 // ノイズ関数（簡易パーリンノイズ風）
 //======================================
@@ -223,6 +228,10 @@ static void CreateVertices()
         }
     }
 
+    // 衝突判定用に三角形ごとの法線を事前計算
+    g_HeightField.Build(&g_HeightMap[0][0], MESH_H_VERTEX_COUNT, MESH_V_VERTEX_COUNT, MESH_SIZE,
+        -MESH_HALF_EXTENT_X, -MESH_HALF_EXTENT_Z);
+
     // 頂点データを生成
     int index = 0;
     for (int z = 0; z < MESH_V_VERTEX_COUNT; z++)
@@ -325,6 +334,7 @@ void MeshField_Finalize()
         g_pIndexBuffer->Release();
         g_pIndexBuffer = nullptr;
     }
+    g_HeightField.Clear();
 }
 
 //======================================
@@ -417,19 +427,16 @@ float MeshField_GetHeight(float x, float z)
 //======================================
 XMFLOAT3 MeshField_GetNormal(float x, float z)
 {
-    // 近傍4点から法線を計算
-    float delta = MESH_SIZE;
-    float hL = MeshField_GetHeight(x - delta, z);
-    float hR = MeshField_GetHeight(x + delta, z);
-    float hD = MeshField_GetHeight(x, z - delta);
-    float hU = MeshField_GetHeight(x, z + delta);
-
-    XMVECTOR normal = XMVectorSet(hL - hR, 2.0f * delta, hD - hU, 0.0f);
-    normal = XMVector3Normalize(normal);
+    // 構築時に計算した三角形の法線を参照（高さの再サンプリングはしない）
+    return g_HeightField.GetNormal(x, z);
+}
 
-    XMFLOAT3 result;
-    XMStoreFloat3(&result, normal);
-    return result;
+//======================================
+// 地形コライダー取得
+//======================================
+const HeightField& MeshField_GetHeightField()
+{
+    return g_HeightField;
 }
 
 //======================================
@@ -1,9 +1,10 @@
 /****************************************
  * @file meshfield.h
- * @brief bVtB[hin`jE`
+ * @brief メッシュフィールド（地形）生成・描画
  * @author Natsume Shidara
  * @date 2025/12/10
- * @update 2026/01/13 - n`N@\ǉ
+ * @update 2026/01/13 - 地形隆起機能追加
+ * @update 2026/10/18 - 高さマップから地形コライダーを構築
  ****************************************/
 
 #ifndef MESHFIELD_H
@@ -12,80 +13,87 @@
 #include <d3d11.h>
 #include <DirectXMath.h>
 
+class HeightField;
+
  //======================================
- // n`ݒ
+ // 地形設定
  //======================================
 namespace TerrainConfig
 {
-    // bV
-    constexpr int MESH_H_COUNT = 100;  // X
-    constexpr int MESH_V_COUNT = 100;  // Z
+    // メッシュ分割数
+    constexpr int MESH_H_COUNT = 100;  // X軸方向
+    constexpr int MESH_V_COUNT = 100;  // Z軸方向
 
-    // bV1}X̃TCY
+    // メッシュ1マスのサイズ
     constexpr float MESH_SIZE = 2.5f;
 
-    // n`TCYivZj
+    // 地形サイズ（自動計算）
     constexpr float TERRAIN_WIDTH = MESH_H_COUNT * MESH_SIZE;
     constexpr float TERRAIN_DEPTH = MESH_V_COUNT * MESH_SIZE;
 
-    // ݒ
-    constexpr float MAX_HEIGHT = 1.5f;       // ő嗲N
-    constexpr float MIN_HEIGHT = -0.3f;      // Œፂiڂ݁j
-    constexpr float EDGE_FLATTEN_MARGIN = 5.0f;  // [𕽒Rɂ}[W
+    // 高さ設定
+    constexpr float MAX_HEIGHT = 1.5f;       // 最大隆起高さ
+    constexpr float MIN_HEIGHT = -0.3f;      // 最低高さ（くぼみ）
+    constexpr float EDGE_FLATTEN_MARGIN = 5.0f;  // 端を平坦にするマージン
 }
 
 //======================================
-// J֐
+// 公開関数
 //======================================
 
 /**
- * @brief bVtB[h
+ * @brief メッシュフィールド初期化
  */
 void MeshField_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
 
 /**
- * @brief bVtB[hI
+ * @brief メッシュフィールド終了処理
  */
 void MeshField_Finalize();
 
 /**
- * @brief bVtB[hXV
+ * @brief メッシュフィールド更新
  */
 void MeshField_Update(double elapsed_time);
 
 /**
- * @brief bVtB[h`
+ * @brief メッシュフィールド描画
  */
 void MeshField_Draw(const DirectX::XMMATRIX& mtxWorld);
 
 /**
- * @brief bVtB[hVhE`
+ * @brief メッシュフィールドシャドウ描画
  */
 void MeshField_DrawShadow(const DirectX::XMMATRIX& mtxWorld);
 
 /**
- * @brief wW̒n`擾
- * @param x XWi[hj
- * @param z ZWi[hj
- * @return n`̍iYWj
+ * @brief 指定座標の地形高さを取得
+ * @param x X座標（ワールド）
+ * @param z Z座標（ワールド）
+ * @return 地形の高さ（Y座標）
  */
 float MeshField_GetHeight(float x, float z);
 
 /**
- * @brief wW̒n`@擾
- * @param x XWi[hj
- * @param z ZWi[hj
- * @return @xNg
+ * @brief 指定座標の地形法線を取得
+ * @param x X座標（ワールド）
+ * @param z Z座標（ワールド）
+ * @return 指定座標を含む三角形の法線（事前計算済み）
  */
 DirectX::XMFLOAT3 MeshField_GetNormal(float x, float z);
 
 /**
- * @brief n`̕擾
+ * @brief 地形コライダーを取得（描画メッシュと同じ三角形分割）
+ */
+const HeightField& MeshField_GetHeightField();
+
+/**
+ * @brief 地形の幅を取得
  */
 float MeshField_GetWidth();
 
 /**
- * @brief n`̉s擾
+ * @brief 地形の奥行きを取得
  */
 float MeshField_GetDepth();
 
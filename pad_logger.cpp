@@ -1,7 +1,7 @@
 /****************************************
  * @file pad_logger.cpp
- * @brief Q[pbh͊Ǘ̎
- * @update 2026/01/13 - EXeBbNΉǉ
+ * @brief ゲームパッド入力管理の実装
+ * @update 2026/01/13 - 右スティック対応追加
  ****************************************/
 
 #pragma comment(lib, "xinput.lib")
@@ -12,7 +12,7 @@
 using namespace DirectX;
 
 //======================================
-// ϐ
+// 内部変数
 //======================================
 static WORD g_ButtonPrev[4];
 static WORD g_ButtonTrigger[4];
@@ -20,7 +20,7 @@ static WORD g_ButtonRelease[4];
 static XINPUT_STATE g_State[4];
 
 //======================================
-// 
+// 初期化
 //======================================
 void PadLogger_Initialize()
 {
@@ -34,7 +34,7 @@ void PadLogger_Initialize()
 }
 
 //======================================
-// XV
+// 更新
 //======================================
 void PadLogger_Update()
 {
@@ -50,7 +50,7 @@ void PadLogger_Update()
 }
 
 //======================================
-// {^
+// ボタン入力
 //======================================
 bool PadLogger_IsPressed(DWORD userIndex, WORD buttons)
 {
@@ -71,7 +71,7 @@ bool PadLogger_IsRelease(DWORD userIndex, WORD buttons)
 }
 
 //======================================
-// XeBbN
+// 左スティック
 //======================================
 XMFLOAT2 PadLogger_GetLeftThumbStick(DWORD userIndex)
 {
@@ -81,7 +81,7 @@ XMFLOAT2 PadLogger_GetLeftThumbStick(DWORD userIndex)
     SHORT lx = g_State[userIndex].Gamepad.sThumbLX;
     SHORT ly = g_State[userIndex].Gamepad.sThumbLY;
 
-    // X
+    // X軸
     if (lx < -XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE)
     {
         value.x = static_cast<float>(lx + XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE) /
@@ -93,7 +93,7 @@ XMFLOAT2 PadLogger_GetLeftThumbStick(DWORD userIndex)
             static_cast<float>(32767 - XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE);
     }
 
-    // Y
+    // Y軸
     if (ly < -XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE)
     {
         value.y = static_cast<float>(ly + XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE) /
@@ -105,7 +105,7 @@ XMFLOAT2 PadLogger_GetLeftThumbStick(DWORD userIndex)
             static_cast<float>(32767 - XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE);
     }
 
-    // Ki傫1𒴂Ȃ悤Ɂj
+    // 正規化（大きさが1を超えないように）
     float lengthSq = value.x * value.x + value.y * value.y;
     if (lengthSq > 1.0f)
     {
@@ -118,7 +118,7 @@ XMFLOAT2 PadLogger_GetLeftThumbStick(DWORD userIndex)
 }
 
 //======================================
-// EXeBbN
+// 右スティック
 //======================================
 XMFLOAT2 PadLogger_GetRightThumbStick(DWORD userIndex)
 {
@@ -128,7 +128,7 @@ XMFLOAT2 PadLogger_GetRightThumbStick(DWORD userIndex)
     SHORT rx = g_State[userIndex].Gamepad.sThumbRX;
     SHORT ry = g_State[userIndex].Gamepad.sThumbRY;
 
-    // X
+    // X軸
     if (rx < -XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE)
     {
         value.x = static_cast<float>(rx + XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE) /
@@ -140,7 +140,7 @@ XMFLOAT2 PadLogger_GetRightThumbStick(DWORD userIndex)
             static_cast<float>(32767 - XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE);
     }
 
-    // Y
+    // Y軸
     if (ry < -XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE)
     {
         value.y = static_cast<float>(ry + XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE) /
@@ -152,7 +152,7 @@ XMFLOAT2 PadLogger_GetRightThumbStick(DWORD userIndex)
             static_cast<float>(32767 - XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE);
     }
 
-    // Ki傫1𒴂Ȃ悤Ɂj
+    // 正規化（大きさが1を超えないように）
     float lengthSq = value.x * value.x + value.y * value.y;
     if (lengthSq > 1.0f)
     {
@@ -165,7 +165,7 @@ XMFLOAT2 PadLogger_GetRightThumbStick(DWORD userIndex)
 }
 
 //======================================
-// gK[
+// トリガー
 //======================================
 float PadLogger_GetLeftTrigger(DWORD userIndex)
 {
@@ -192,7 +192,7 @@ float PadLogger_GetRightTrigger(DWORD userIndex)
 }
 
 //======================================
-// oCu[V
+// バイブレーション
 //======================================
 void PadLogger_VibrationEnable(DWORD userIndex, bool enable, XMFLOAT2 vibrationPower)
 {
@@ -6,7 +6,7 @@ void Emitter::Update(double elapsedTime)
 
 	const double secPerParticle = 1.0 / m_particlesPerSecond;
 
-	//o
+	//噴出処理
 
 	while (m_accumulatedTime >= secPerParticle){
 		if (m_particleCount >= m_particleCapacity) break;
@@ -1,6 +1,6 @@
 /****************************************
  * @file particle.h
- * @brief p[eBNpNX錾wb_
+ * @brief パーティクル用クラス宣言ヘッダ
  *
  * @author
  *   Natsume Shidara
@@ -11,15 +11,15 @@
 #define PARTICLE_H
 #include <DirectXMath.h>
 
- //CX^VO
- //GPU_O(GPUp[eBN)
- //WIgVF[_
+ //インスタンシング
+ //GPUレンダリング(GPUパーティクル)
+ //ジオメトリシェーダ
 
 class Particle {
 private:
     DirectX::XMVECTOR m_position{};
     DirectX::XMVECTOR m_velocity{};
-    //float m_mass; U
+    //float m_mass; 一旦無視
     double m_lifeTime{};
     double m_accumulatedTime{};
 
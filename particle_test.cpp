@@ -1,13 +1,13 @@
 /****************************************
  * @file particle_test.cpp
- * @brief p[eBNeXgiCŁj
+ * @brief パーティクルテスト実装（修正版）
  *
  * @author
  *   Natsume Shidara
  * @date
  *   2026/02/04
  * @update
- *   2026/02/06 - [xݖA`P
+ *   2026/02/06 - 深度書き込み無効化、描画改善
  ****************************************/
 #include "particle_test.h"
 #include "billboard.h"
@@ -15,17 +15,17 @@ using namespace DirectX;
 
 void NormalParticle::Update(double elapsedTime)
 {
-    // xɎԂ|ĈړʂvZ
+    // 速度に時間を掛けて移動量を計算
     XMVECTOR deltaPos = XMVectorScale(GetVelocity(), static_cast<float>(elapsedTime));
     AddPosition(deltaPos);
 
-    // 3. Ct^CɉătF[hAEg
+    // 3. ライフタイムに応じてフェードアウト
     float lifeRatio = std::fminf(GetAccumulatedTime() / GetLifeTime(), 1.0f);
-    m_alpha = 1.0f - lifeRatio; // قǓ
+    m_alpha = 1.0f - lifeRatio; // 寿命が減るほど透明に
     //m_scale = 1.0f - lifeRatio;
     m_scale = 1.0f;
 
-    // NX̍XV(Ct^C)
+    // 基底クラスの更新(ライフタイム減少)
     Particle::Update(elapsedTime);
 }
 
@@ -49,9 +49,9 @@ Particle* NormalEmitter::CreateParticle()
     static constexpr float MAX_SPEED = 5.0f;
     static constexpr float MIN_LIFE_TIME = 0.5f;
     static constexpr float MAX_LIFE_TIME = 1.5f;
-    static constexpr float SPAWN_HEIGHT = 0.2f;      // ʒu̍
-    static constexpr float UPWARD_VELOCITY = 1.0f;   // ̑x
-    static constexpr float VERTICAL_SPREAD = 0.5f;   // ㉺̂΂
+    static constexpr float SPAWN_HEIGHT = 0.2f;      // 生成位置の高さ
+    static constexpr float UPWARD_VELOCITY = 1.0f;   // 上方向の速度
+    static constexpr float VERTICAL_SPREAD = 0.5f;   // 上下方向のばらつき
 
     std::uniform_real_distribution<float> m_dirDist{ MIN_DIRECTION, MAX_DIRECTION };
     std::uniform_real_distribution<float> m_radiusDist{ MIN_RADIUS, MAX_RADIUS };
@@ -59,11 +59,11 @@ Particle* NormalEmitter::CreateParticle()
     std::uniform_real_distribution<float> m_lifeTimeDist{ MIN_LIFE_TIME, MAX_LIFE_TIME };
     std::uniform_real_distribution<float> m_verticalDist{ -VERTICAL_SPREAD, VERTICAL_SPREAD };
 
-    // XZʏ̊px
+    // XZ平面上の角度
     float angle = m_dirDist(m_mt);
     float radius = m_radiusDist(m_mt);
 
-    // ˏ̏ʒuiG~b^[ʒu班ItZbgj
+    // 放射状の初期位置（エミッター位置から少しオフセット）
     XMVECTOR spawnOffset = XMVectorSet(
         cosf(angle) * radius,
         SPAWN_HEIGHT,
@@ -71,23 +71,23 @@ Particle* NormalEmitter::CreateParticle()
         0.0f
     );
 
-    // p[eBN̏ʒu
+    // パーティクルの初期位置
     XMVECTOR particlePos = GetPosition() + spawnOffset;
 
-    // xNgiO+j
+    // 方向ベクトル（外側+上向き）
     XMVECTOR direction = XMVectorSet(
-        cosf(angle),                          // XiOցj
-        UPWARD_VELOCITY + m_verticalDist(m_mt), // Yij
-        sinf(angle),                          // ZiOցj
+        cosf(angle),                          // X方向（外側へ）
+        UPWARD_VELOCITY + m_verticalDist(m_mt), // Y方向（上向き）
+        sinf(angle),                          // Z方向（外側へ）
         0.0f
     );
     direction = XMVector3Normalize(direction);
 
-    // xxNg
+    // 速度ベクトル
     float speed = m_speedDist(m_mt);
     XMVECTOR velocity = XMVectorScale(direction, speed);
 
-    // Ct^C
+    // ライフタイム
     float lifeTime = m_lifeTimeDist(m_mt);
 
     return new NormalParticle(m_texId, particlePos, velocity, lifeTime);
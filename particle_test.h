@@ -1,6 +1,6 @@
 /****************************************
  * @file particle_test.h
- * @brief p[eBNpNX錾wb_
+ * @brief パーティクル用クラス宣言ヘッダ
  *
  * @author
  *   Natsume Shidara
@@ -0,0 +1,158 @@
+﻿/****************************************
+ * @file physics_job_system.cpp
+ * @brief 物理演算の並列バッチ実行の実装
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#include "physics_job_system.h"
+#include <string>
+
+#if defined(DEBUG) || defined(_DEBUG)
+#include "debug_ostream.h"
+#endif
+
+//--------------------------------------
+// 静的メンバ変数の定義
+//--------------------------------------
+std::vector<std::thread> PhysicsJobSystem::s_WorkerThreads;
+std::mutex PhysicsJobSystem::s_JobMutex;
+std::condition_variable PhysicsJobSystem::s_JobCondition;
+std::condition_variable PhysicsJobSystem::s_DoneCondition;
+std::atomic<bool> PhysicsJobSystem::s_ShouldTerminate(false);
+
+const PhysicsJobSystem::BatchFunction* PhysicsJobSystem::s_pFunction = nullptr;
+int PhysicsJobSystem::s_Count = 0;
+int PhysicsJobSystem::s_BatchSize = 1;
+int PhysicsJobSystem::s_BatchCount = 0;
+unsigned int PhysicsJobSystem::s_JobGeneration = 0;
+std::atomic<int> PhysicsJobSystem::s_NextBatch(0);
+std::atomic<int> PhysicsJobSystem::s_CompletedBatches(0);
+int PhysicsJobSystem::s_BusyWorkers = 0;
+
+//======================================
+// 初期化・終了
+//======================================
+void PhysicsJobSystem::Initialize(int workerThreadCount)
+{
+    s_ShouldTerminate = false;
+
+    for (int i = 0; i < workerThreadCount; ++i)
+    {
+        s_WorkerThreads.emplace_back(WorkerThreadFunction, i + 1);
+    }
+
+#if defined(DEBUG) || defined(_DEBUG)
+    OutputDebugStringA("[PhysicsJobSystem] Initialized with ");
+    OutputDebugStringA(std::to_string(workerThreadCount).c_str());
+    OutputDebugStringA(" worker threads\n");
+#endif
+}
+
+void PhysicsJobSystem::Finalize()
+{
+    {
+        std::lock_guard<std::mutex> lock(s_JobMutex);
+        s_ShouldTerminate = true;
+    }
+    s_JobCondition.notify_all();
+
+    for (auto& thread : s_WorkerThreads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+    s_WorkerThreads.clear();
+}
+
+int PhysicsJobSystem::GetThreadCount()
+{
+    return static_cast<int>(s_WorkerThreads.size()) + 1;
+}
+
+//======================================
+// 並列実行
+//======================================
+void PhysicsJobSystem::ParallelFor(int count, int batchSize, const BatchFunction& function)
+{
+    if (count <= 0) return;
+    if (batchSize < 1) batchSize = 1;
+
+    const int batchCount = (count + batchSize - 1) / batchSize;
+
+    // ワーカーなし・1バッチのみなら呼び出しスレッドでそのまま実行
+    if (s_WorkerThreads.empty() || batchCount == 1)
+    {
+        function(0, count, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_JobMutex);
+        s_pFunction = &function;
+        s_Count = count;
+        s_BatchSize = batchSize;
+        s_BatchCount = batchCount;
+        s_NextBatch = 0;
+        s_CompletedBatches = 0;
+        ++s_JobGeneration;
+    }
+    s_JobCondition.notify_all();
+
+    RunBatches(0);
+
+    // 全バッチの完了と、ジョブを参照中のワーカーの離脱を待つ（次のジョブと混ざらないように）
+    std::unique_lock<std::mutex> lock(s_JobMutex);
+    s_DoneCondition.wait(lock, []() {
+        return s_CompletedBatches.load() == s_BatchCount && s_BusyWorkers == 0;
+    });
+    s_pFunction = nullptr;
+}
+
+void PhysicsJobSystem::RunBatches(int threadIndex)
+{
+    for (;;)
+    {
+        const int batch = s_NextBatch.fetch_add(1);
+        if (batch >= s_BatchCount) break;
+
+        const int begin = batch * s_BatchSize;
+        const int end = (begin + s_BatchSize < s_Count) ? begin + s_BatchSize : s_Count;
+        (*s_pFunction)(begin, end, threadIndex);
+
+        s_CompletedBatches.fetch_add(1);
+    }
+}
+
+//======================================
+// ワーカースレッド
+//======================================
+void PhysicsJobSystem::WorkerThreadFunction(int threadIndex)
+{
+    unsigned int seenGeneration = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(s_JobMutex);
+            s_JobCondition.wait(lock, [&]() {
+                return s_ShouldTerminate || (s_pFunction && s_JobGeneration != seenGeneration);
+            });
+
+            if (s_ShouldTerminate) break;
+
+            seenGeneration = s_JobGeneration;
+            ++s_BusyWorkers;
+        }
+
+        RunBatches(threadIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(s_JobMutex);
+            --s_BusyWorkers;
+        }
+        s_DoneCondition.notify_one();
+    }
+}
@@ -0,0 +1,67 @@
+﻿/****************************************
+ * @file physics_job_system.h
+ * @brief 物理演算の並列バッチ実行
+ * @detail 常駐ワーカースレッドで範囲をバッチ分割して処理する。呼び出しスレッドも処理に参加し、全バッチ完了まで戻らない
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#ifndef PHYSICS_JOB_SYSTEM_H
+#define PHYSICS_JOB_SYSTEM_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
+
+//--------------------------------------
+// 物理ジョブシステム
+//--------------------------------------
+class PhysicsJobSystem
+{
+public:
+    // バッチ処理関数（[begin, end) を処理。threadIndex は 0 = 呼び出しスレッド、1以降 = ワーカー）
+    using BatchFunction = std::function<void(int begin, int end, int threadIndex)>;
+
+    /**
+     * @brief ワーカースレッドを起動（0なら全て呼び出しスレッドで実行）
+     */
+    static void Initialize(int workerThreadCount);
+    static void Finalize();
+
+    /**
+     * @brief [0, count) を batchSize 単位に分割して並列実行
+     * @detail バッチの割り当て先スレッドは実行ごとに変わるため、結果は処理順に依存しない形で書き出すこと
+     */
+    static void ParallelFor(int count, int batchSize, const BatchFunction& function);
+
+    /**
+     * @brief 並列実行に参加するスレッド数（ワーカー数 + 呼び出しスレッド）
+     * @detail スレッド別バッファの確保数に使う
+     */
+    static int GetThreadCount();
+
+private:
+    static void WorkerThreadFunction(int threadIndex);
+    static void RunBatches(int threadIndex);
+
+    static std::vector<std::thread> s_WorkerThreads;
+    static std::mutex s_JobMutex;
+    static std::condition_variable s_JobCondition;   // ジョブ投入の通知
+    static std::condition_variable s_DoneCondition;  // ジョブ完了の通知
+    static std::atomic<bool> s_ShouldTerminate;
+
+    // 実行中のジョブ（s_JobMutex で保護して公開）
+    static const BatchFunction* s_pFunction;
+    static int s_Count;
+    static int s_BatchSize;
+    static int s_BatchCount;
+    static unsigned int s_JobGeneration;
+    static std::atomic<int> s_NextBatch;
+    static std::atomic<int> s_CompletedBatches;
+    static int s_BusyWorkers;                         // ジョブを参照中のワーカー数
+};
+
+#endif // PHYSICS_JOB_SYSTEM_H
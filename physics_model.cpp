@@ -2,6 +2,15 @@
  * @file physics_model.cpp
  * @brief 物理挙動を持つモデルの実装
  * @detail ID管理などをRigidBodyへ委譲、衝突応答のリファクタリング
+ * @update 2026/10/18 - 積分をRigidBodyStoreへ移動
+ * @update 2026/10/18 - マップ・プレイヤーとの連続衝突判定
+ * @update 2026/10/18 - 箱コライダーはマップと面クリッピングの複数点で接触
+ * @update 2026/10/18 - 地形との判定を中心1点の高さから三角形単位の接触へ変更
+ * @update 2026/10/18 - 衝突マスクでマップ・地形・プレイヤーとの判定を事前に除外
+ * @update 2026/10/18 - 見た目だけの破片への格下げ
+ * @update 2026/10/18 - 焼き込み済み破片（Debrisレイヤーのマップオブジェクト）とも判定
+ * @update 2026/10/18 - 三角形メッシュを持つマップオブジェクトとは三角形単位で判定
+ * @update 2026/10/18 - 当てはめ済みのコライダーからの生成
  ****************************************/
 
 #include "physics_model.h"
@@ -10,6 +19,8 @@
 #include "map.h"
 #include "player.h"
 #include "stage.h"
+#include "heightfield.h"
+#include "mesh_collider.h"
 #include <algorithm>
 #include <cmath>
 
@@ -19,13 +30,23 @@ using namespace DirectX;
 // コンストラクタ
 //======================================
 PhysicsModel::PhysicsModel(MODEL* model, const XMFLOAT3& pos, const XMFLOAT3& vel, float mass, ColliderType colliderType)
+    : PhysicsModel(model, ColliderGenerator::GenerateBestFit(model, colliderType), pos, vel, mass)
+{
+}
+
+PhysicsModel::PhysicsModel(MODEL* model, const Collider& collider, const XMFLOAT3& pos, const XMFLOAT3& vel, float mass)
     : m_pModel(model)
     , m_RigidBody()
     , m_Scale{ 1.0f, 1.0f, 1.0f }
     , m_rootVolume(0.0f)
     , m_lifeTimer(-1.0f)
     , m_isDead(false)
-    , m_colliderType(colliderType)
+    , m_Age(0.0f)
+    , m_SleepTime(0.0f)
+    , m_isVisualOnly(false)
+    , m_colliderType(collider.type)
+    , m_BroadphaseProxy(-1)
+    , m_SceneProxy(-1)
 {
     if (!m_pModel)
     {
@@ -34,8 +55,7 @@ PhysicsModel::PhysicsModel(MODEL* model, const XMFLOAT3& pos, const XMFLOAT3& ve
 
     ModelAddRef(m_pModel);
 
-    // 最適なコライダーを生成
-    Collider col = ColliderGenerator::GenerateBestFit(m_pModel, m_colliderType);
+    Collider col = collider;
 
     // 生成直後の密着・スタック防止のためコライダーを縮小
     if (col.type == ColliderType::Box)
@@ -72,6 +92,8 @@ PhysicsModel::~PhysicsModel()
 void PhysicsModel::Update(double elapsed_time)
 {
     float dt = static_cast<float>(elapsed_time);
+    m_Age += dt;
+    m_SleepTime = m_RigidBody.IsSleeping() ? (m_SleepTime + dt) : 0.0f;
 
     // ライフタイマー処理と縮小演出
     if (m_lifeTimer > 0.0f)
@@ -93,74 +115,107 @@ void PhysicsModel::Update(double elapsed_time)
         }
     }
 
-    // モデルが無効な場合は処理しない
-    if (!m_pModel)
+    // モデルが無効な場合・見た目だけの破片は衝突処理しない
+    if (!m_pModel || m_isVisualOnly)
     {
         return;
     }
 
-    // 物理演算（積分）
-    m_RigidBody.Integrate(dt);
+    // 積分は RigidBodyStore::Integrate で全剛体まとめて済んでいるため、ここでは地形との補正のみ
 
-    // 地形（MeshField）との衝突判定（重力が有効な場合のみ）
-    if (m_RigidBody.IsGravityEnabled())
+    // スリープ中は静止しているため地形・マップとの判定を省略（プレイヤーとの判定のみ行う）
+    const bool isSleeping = m_RigidBody.IsSleeping();
+
+    // 衝突マスクに含まれない相手は近傍検索から省く
+    const CollisionFilter& filter = m_RigidBody.GetCollisionFilter();
+    const bool touchesStatic = filter.CanTouch(CollisionLayer::Static);
+    const bool touchesMap = filter.CanTouch(CollisionLayer::Static | CollisionLayer::Debris);   // 焼き込み済み破片を含む
+    const bool touchesPlayer = filter.CanTouch(CollisionLayer::Player);
+
+    // 高速移動時はすり抜け防止のため、離散判定の前に移動経路をスイープ
+    if (!isSleeping)
     {
-        XMFLOAT3 currentPos = m_RigidBody.GetPosition();
-        float terrainHeight = Stage_GetTerrainHeight(currentPos.x, currentPos.z);
+        ApplyContinuousCollision();
+    }
 
-        // コライダーの底面を考慮（中心オフセット + 半径/半高さ）
-        float colliderBottomOffset = 0.0f;
-        const Collider& col = m_RigidBody.GetLocalCollider();
-        if (col.type == ColliderType::Box)
+    // 地形（MeshField）との衝突判定（重力が有効な場合のみ）
+    if (!isSleeping && touchesStatic && m_RigidBody.IsGravityEnabled())
+    {
+        // コライダーの下にある三角形ごとに接触を求める（中心1点の高さでは斜面で角が沈む）
+        Hit terrainHits[HeightFieldConfig::MAX_CONTACTS];
+        const int terrainHitCount = Stage_CollideTerrain(m_RigidBody.GetWorldCollider(), terrainHits, HeightFieldConfig::MAX_CONTACTS);
+        if (terrainHitCount > 0)
         {
-            // OBBの場合：中心のYオフセット - 半高さ = 底面のオフセット
-            colliderBottomOffset = col.obb.center.y - col.obb.extents.y;
+            ApplyTerrainContacts(terrainHits, terrainHitCount);
         }
-        else if (col.type == ColliderType::Sphere)
+    }
+
+    // 衝突判定の準備
+    AABB worldAABB = m_RigidBody.GetTransformedAABB();
+    const Collider worldCollider = m_RigidBody.GetWorldCollider();
+    const bool useFaceClipping = (worldCollider.type == ColliderType::Box);
+
+    // マップオブジェクト（壁など）との衝突判定（空間インデックスで近傍のみ）
+    thread_local std::vector<int> nearbyObjects;
+    nearbyObjects.clear();
+    if (!isSleeping && touchesMap)
+    {
+        Map_QueryAABB(worldAABB, nearbyObjects, filter.mask);
+    }
+
+    for (int index : nearbyObjects)
+    {
+        const MapObject* object = Map_GetObject(index);
+
+        // 三角形メッシュは地形と同じく三角形ごとの接触で解く（AABBのままだと見えない壁になる）
+        if (object->Mesh)
         {
-            // Sphereの場合：中心のYオフセット - 半径 = 底面のオフセット
-            colliderBottomOffset = col.sphere.center.y - col.sphere.radius;
+            Hit meshHits[MeshColliderConfig::MAX_CONTACTS];
+            const int meshHitCount = object->Mesh->Collide(worldCollider, meshHits, MeshColliderConfig::MAX_CONTACTS);
+            if (meshHitCount > 0)
+            {
+                ApplyTerrainContacts(meshHits, meshHitCount);
+            }
+            continue;
         }
 
-        // 実際の底面位置 = position.y + colliderBottomOffset
-        float actualBottom = currentPos.y + colliderBottomOffset;
+        const AABB& mapAABB = object->Aabb;
 
-        // 地形より下にいる場合、地形に押し出す
-        if (actualBottom < terrainHeight)
+        // 箱は面同士の接触を最大4点で解き、1点接触による揺れ・沈み込みを防ぐ
+        if (useFaceClipping)
         {
-            float correction = terrainHeight - actualBottom;
-            currentPos.y += correction;
-            m_RigidBody.SetPosition(currentPos);
-
-            // 下向きの速度をリセットして軽く反発
-            XMFLOAT3 vel = m_RigidBody.GetVelocity();
-            if (vel.y < 0.0f)
+            ContactSet contacts = Collision_ClipOBBAABB(worldCollider.obb, mapAABB);
+            if (contacts.count > 0)
             {
-                vel.y *= -m_RigidBody.GetParams().restitution * 0.3f;
-                // 小さな反発は無視
-                if (fabsf(vel.y) < 0.5f) vel.y = 0.0f;
-                m_RigidBody.SetVelocity(vel);
+                ApplyStaticContactSet(contacts);
+                if (contacts.normal.y > GROUND_NORMAL_Y)
+                {
+                    m_RigidBody.NotifyGroundContact();
+                }
             }
+            continue;
         }
-    }
 
-    // 衝突判定の準備
-    AABB worldAABB = m_RigidBody.GetTransformedAABB();
-
-    // マップオブジェクト（壁など）との衝突判定
-    const int objCount = Map_GetObjectCount();
-    for (int i = 0; i < objCount; ++i)
-    {
-        const AABB& mapAABB = Map_GetObject(i)->Aabb;
         Hit hit = Collision_IsHitAABB(worldAABB, mapAABB);
 
         if (hit.isHit)
         {
             ApplyStaticCollisionResponse(hit);
+
+            // 上向きの面に乗っていれば接地扱い
+            if (hit.normal.y > GROUND_NORMAL_Y)
+            {
+                m_RigidBody.NotifyGroundContact();
+            }
         }
     }
 
     // プレイヤーとの衝突判定（プレイヤーは質量無限大の壁として扱う）
+    if (!touchesPlayer)
+    {
+        return;
+    }
+
     OBB playerOBB = Player_GetWorldOBB(XMLoadFloat3(&Player_GetPosition()));
     Hit hitPlayer = Collision_IsHitOBBAABB(playerOBB, worldAABB);
 
@@ -175,10 +230,184 @@ void PhysicsModel::Update(double elapsed_time)
     }
 }
 
+//======================================
+// メッシュの境界
+//======================================
+OBB PhysicsModel::GetMeshBounds() const
+{
+    if (!m_pModel)
+    {
+        OBB empty{};
+        empty.center = m_RigidBody.GetPosition();
+        empty.orientation = { 0.0f, 0.0f, 0.0f, 1.0f };
+        return empty;
+    }
+    return Collision_TransformAABB(m_pModel->local_aabb, m_RigidBody.GetWorldMatrix({ 1.0f, 1.0f, 1.0f }));
+}
+
+//======================================
+// 見た目だけの破片へ格下げ
+//======================================
+void PhysicsModel::SetVisualOnly()
+{
+    // キネマティック化で積分対象から外し、どのレイヤーとも衝突しないようにする
+    RigidBody::Params params = m_RigidBody.GetParams();
+    params.isKinematic = true;
+    params.useContinuousCollision = false;
+    m_RigidBody.SetParams(params);
+    m_RigidBody.ResetVelocity();
+    m_RigidBody.SetCollisionLayer(CollisionLayer::None, CollisionLayer::None);
+
+    m_isVisualOnly = true;
+}
+
+//======================================
+// 静的オブジェクトとの連続衝突判定
+//======================================
+void PhysicsModel::ApplyContinuousCollision()
+{
+    Sphere start;
+    XMFLOAT3 displacement;
+    if (!m_RigidBody.GetContinuousSweep(start, displacement))
+    {
+        return;
+    }
+
+    // スイープ範囲を包むAABBで近傍のマップオブジェクトを取得
+    XMVECTOR vStart = XMLoadFloat3(&start.center);
+    XMVECTOR vEnd = XMVectorAdd(vStart, XMLoadFloat3(&displacement));
+    XMVECTOR vRadius = XMVectorReplicate(start.radius);
+    AABB sweptBounds;
+    XMStoreFloat3(&sweptBounds.min, XMVectorSubtract(XMVectorMin(vStart, vEnd), vRadius));
+    XMStoreFloat3(&sweptBounds.max, XMVectorAdd(XMVectorMax(vStart, vEnd), vRadius));
+
+    const CollisionFilter& filter = m_RigidBody.GetCollisionFilter();
+
+    thread_local std::vector<int> sweepCandidates;
+    sweepCandidates.clear();
+    if (filter.CanTouch(CollisionLayer::Static | CollisionLayer::Debris))
+    {
+        Map_QueryAABB(sweptBounds, sweepCandidates, filter.mask);
+    }
+
+    SweepHit earliest;
+    for (int index : sweepCandidates)
+    {
+        const MapObject* object = Map_GetObject(index);
+        SweepHit hit = object->Mesh
+            ? object->Mesh->SweepSphere(start, displacement)
+            : Collision_SweepSphereAABB(start, displacement, object->Aabb);
+        if (hit.isHit && (!earliest.isHit || hit.time < earliest.time))
+        {
+            earliest = hit;
+        }
+    }
+
+    // プレイヤー（質量無限大の壁として扱う）
+    if (filter.CanTouch(CollisionLayer::Player))
+    {
+        OBB playerOBB = Player_GetWorldOBB(XMLoadFloat3(&Player_GetPosition()));
+        SweepHit hitPlayer = Collision_SweepSphereOBB(start, displacement, playerOBB);
+        if (hitPlayer.isHit && (!earliest.isHit || hitPlayer.time < earliest.time))
+        {
+            earliest = hitPlayer;
+        }
+    }
+
+    // 地形はY方向の押し出しで常に解決されるためスイープ対象外
+
+    if (!earliest.isHit)
+    {
+        return;
+    }
+
+    // 衝突時刻の位置まで戻し、面へ向かう速度成分を反発係数で反転
+    // （回転・摩擦は続く離散判定の衝突応答に委ねる）
+    m_RigidBody.RewindToTime(earliest.time);
+
+    XMFLOAT3 fVel = m_RigidBody.GetVelocity();
+    XMVECTOR vVel = XMLoadFloat3(&fVel);
+    XMVECTOR n = XMLoadFloat3(&earliest.normal);
+    float velAlongNormal = XMVectorGetX(XMVector3Dot(vVel, n));
+    if (velAlongNormal < 0.0f)
+    {
+        const float restitution = m_RigidBody.GetParams().restitution;
+        vVel = XMVectorSubtract(vVel, XMVectorScale(n, (1.0f + restitution) * velAlongNormal));
+        XMStoreFloat3(&fVel, vVel);
+        m_RigidBody.SetVelocity(fVel);
+    }
+}
+
 //======================================
 // 静的オブジェクトとの衝突応答処理
 //======================================
 void PhysicsModel::ApplyStaticCollisionResponse(const Hit& hit)
+{
+    if (ApplyStaticContactImpulse(hit))
+    {
+        ApplyStaticPositionCorrection(hit.normal, hit.depth);
+    }
+}
+
+//======================================
+// 静的オブジェクトとの複数点衝突応答
+//======================================
+void PhysicsModel::ApplyStaticContactSet(const ContactSet& contacts)
+{
+    // インパルスは点ごとに逐次適用し、位置補正は最深点で1回だけ行う（点数倍に押し出さない）
+    bool isApproaching = false;
+    float maxDepth = 0.0f;
+
+    for (int i = 0; i < contacts.count; ++i)
+    {
+        Hit hit;
+        hit.isHit = true;
+        hit.normal = contacts.normal;
+        hit.depth = contacts.depths[i];
+        hit.contactPoint = contacts.points[i];
+
+        isApproaching |= ApplyStaticContactImpulse(hit);
+        maxDepth = std::max(maxDepth, contacts.depths[i]);
+    }
+
+    if (isApproaching)
+    {
+        ApplyStaticPositionCorrection(contacts.normal, maxDepth);
+    }
+}
+
+//======================================
+// 地形との複数点衝突応答
+//======================================
+void PhysicsModel::ApplyTerrainContacts(const Hit* hits, int hitCount)
+{
+    // インパルスは三角形ごとの接触へ逐次適用し、位置は最深の接触で地表まで押し戻す
+    int deepest = 0;
+    bool isGrounded = false;
+
+    for (int i = 0; i < hitCount; ++i)
+    {
+        ApplyStaticContactImpulse(hits[i]);
+
+        if (hits[i].depth > hits[deepest].depth) deepest = i;
+        if (hits[i].normal.y > GROUND_NORMAL_Y) isGrounded = true;
+    }
+
+    // 地形は貫通させられないため、マップと違い補正は割合をかけずに全量行う
+    XMFLOAT3 pos = m_RigidBody.GetPosition();
+    XMStoreFloat3(&pos, XMVectorAdd(XMLoadFloat3(&pos), XMVectorScale(XMLoadFloat3(&hits[deepest].normal), hits[deepest].depth)));
+    m_RigidBody.CorrectPosition(pos);
+
+    if (isGrounded)
+    {
+        m_RigidBody.NotifyGroundContact();
+    }
+}
+
+//======================================
+// 接触点への反発・摩擦インパルス
+//======================================
+bool PhysicsModel::ApplyStaticContactImpulse(const Hit& hit)
 {
     // 物理パラメータの取得
     const RigidBody::Params params = m_RigidBody.GetParams();
@@ -211,7 +440,7 @@ void PhysicsModel::ApplyStaticCollisionResponse(const Hit& hit)
     // 既に離れようとしている場合は処理不要
     if (velAlongNormal > 0.0f)
     {
-        return;
+        return false;
     }
 
     // ==========================================
@@ -273,20 +502,25 @@ void PhysicsModel::ApplyStaticCollisionResponse(const Hit& hit)
         m_RigidBody.ApplyImpulseAtPoint(fFriction, fContact);
     }
 
-    // ==========================================
-    // C. 位置補正（貫通防止）
-    // ==========================================
-    float correctionDepth = std::max(hit.depth - CORRECTION_SLOP, 0.0f);
+    return true;
+}
+
+//======================================
+// 位置補正（貫通防止）
+//======================================
+void PhysicsModel::ApplyStaticPositionCorrection(const XMFLOAT3& normal, float depth)
+{
+    float correctionDepth = std::max(depth - CORRECTION_SLOP, 0.0f);
 
     if (correctionDepth > 0.0f)
     {
-        XMVECTOR correction = XMVectorScale(n, correctionDepth * CORRECTION_PERCENT);
+        XMVECTOR correction = XMVectorScale(XMLoadFloat3(&normal), correctionDepth * CORRECTION_PERCENT);
         XMFLOAT3 fCurrentPos = m_RigidBody.GetPosition();
         XMVECTOR vCurrentPos = XMLoadFloat3(&fCurrentPos);
 
         XMFLOAT3 newPos;
         XMStoreFloat3(&newPos, XMVectorAdd(vCurrentPos, correction));
-        m_RigidBody.SetPosition(newPos);
+        m_RigidBody.CorrectPosition(newPos);
     }
 }
 
@@ -297,7 +531,7 @@ void PhysicsModel::Draw()
 {
     if (m_pModel)
     {
-        XMFLOAT4X4 matWorld = m_RigidBody.GetWorldMatrix(m_Scale);
+        XMFLOAT4X4 matWorld = m_RigidBody.GetRenderWorldMatrix(m_Scale);
         XMMATRIX world = XMLoadFloat4x4(&matWorld);
         ModelDraw(m_pModel, world);
     }
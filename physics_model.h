@@ -3,6 +3,15 @@
  * @brief 物理挙動を持つモデルのヘッダー
  * @detail RigidBodyへの委譲、自動消滅機能を含む
  * @author NatsumeShidara
+ * @update 2026/10/18 - 高速移動時は静的物体とのスイープ判定で貫通を防止
+ * @update 2026/10/18 - 箱コライダーの静的接触を複数点で応答
+ * @update 2026/10/18 - 地形と三角形単位の接触で応答
+ * @update 2026/10/18 - 衝突マスクに含まれない相手（マップ・地形・プレイヤー）の判定を省略
+ * @update 2026/10/18 - 経過時間と見た目のみ（当たり判定なし）への格下げ
+ * @update 2026/10/18 - 連続スリープ時間（静的メッシュへの焼き込み判定用）
+ * @update 2026/10/18 - シーン問い合わせ登録ID
+ * @update 2026/10/18 - メッシュを包む OBB の取得
+ * @update 2026/10/18 - 当てはめ済みのコライダーを受け取るコンストラクタ
  ****************************************/
 
 #ifndef PHYSICS_MODEL_H
@@ -18,6 +27,9 @@ public:
     // コンストラクタ・デストラクタ
     PhysicsModel(MODEL* model, const DirectX::XMFLOAT3& pos,
         const DirectX::XMFLOAT3& vel, float mass = 10.0f, ColliderType colliderType = ColliderType::Box);
+    // 呼び出し側で当てはめたモデル空間のコライダーを使う（形状は collider.type に従う）
+    PhysicsModel(MODEL* model, const Collider& collider, const DirectX::XMFLOAT3& pos,
+        const DirectX::XMFLOAT3& vel, float mass = 10.0f);
     ~PhysicsModel();
 
     // コピー・ムーブ禁止（リソース管理の安全性のため）
@@ -26,7 +38,7 @@ public:
     PhysicsModel(PhysicsModel&&) = delete;
     PhysicsModel& operator=(PhysicsModel&&) = delete;
 
-    // 更新・描画
+    // 更新・描画（破片のUpdateはワーカースレッドから並列に呼ばれるため、自身の剛体以外を書き換えないこと）
     void Update(double elapsed_time);
     void Draw();
 
@@ -37,6 +49,7 @@ public:
     // 基本プロパティ（RigidBodyへの委譲）
     DirectX::XMFLOAT3 GetPosition() const { return m_RigidBody.GetPosition(); }
     void SetPosition(const DirectX::XMFLOAT3& pos) { m_RigidBody.SetPosition(pos); }
+    void CorrectPosition(const DirectX::XMFLOAT3& pos) { m_RigidBody.CorrectPosition(pos); }
 
     DirectX::XMFLOAT3 GetVelocity() const { return m_RigidBody.GetVelocity(); }
     void SetVelocity(const DirectX::XMFLOAT3& vel) { m_RigidBody.SetVelocity(vel); }
@@ -44,13 +57,18 @@ public:
     // モデルアクセス
     MODEL* GetModel() const { return m_pModel; }
 
+    // メッシュ全体を包むワールド空間の OBB（切断と同じ拡大率なしの姿勢で変換）
+    OBB GetMeshBounds() const;
+
     // スケール管理
     DirectX::XMFLOAT3 GetScale() const { return m_Scale; }
     void SetScale(const DirectX::XMFLOAT3& scale) { m_Scale = scale; }
 
-    // 世代ID管理（RigidBodyへの委譲）
-    void SetSliceGroupId(int id) { m_RigidBody.SetGenerationId(id); }
-    int GetSliceGroupId() const { return m_RigidBody.GetGenerationId(); }
+    // 衝突フィルター（RigidBodyへの委譲）
+    void SetCollisionLayer(uint32_t layer, uint32_t mask) { m_RigidBody.SetCollisionLayer(layer, mask); }
+    const CollisionFilter& GetCollisionFilter() const { return m_RigidBody.GetCollisionFilter(); }
+    void SetSliceGroupId(int id) { m_RigidBody.SetCollisionGroup(id); }
+    int GetSliceGroupId() const { return m_RigidBody.GetCollisionGroup(); }
 
     // 衝突無視タイマー（RigidBodyへの委譲）
     void SetIgnoreCollisionTimer(float time) { m_RigidBody.SetIgnoreCollisionTimer(time); }
@@ -67,10 +85,36 @@ public:
     ColliderType GetColliderType() const { return m_colliderType; }
 
     bool IsDead() const { return m_isDead; }
+    void MarkDead() { m_isDead = true; }    // 次の寿命管理で削除させる
+
+    // 生成からの経過時間（破片予算の削除スコア用）
+    float GetAge() const { return m_Age; }
+    // 連続して眠っている時間（起きると 0 に戻る）
+    float GetSleepTime() const { return m_SleepTime; }
+
+    // 見た目だけの破片へ格下げ（積分・当たり判定を止め、寿命と描画のみ行う）
+    void SetVisualOnly();
+    bool IsVisualOnly() const { return m_isVisualOnly; }
+
+    // ブロードフェーズ登録ID（未登録=-1）
+    void SetBroadphaseProxy(int proxyId) { m_BroadphaseProxy = proxyId; }
+    int GetBroadphaseProxy() const { return m_BroadphaseProxy; }
+
+    // シーン問い合わせ登録ID（未登録=-1）
+    void SetSceneProxy(int proxyId) { m_SceneProxy = proxyId; }
+    int GetSceneProxy() const { return m_SceneProxy; }
 
 private:
     // 衝突応答処理（内部ヘルパー）
     void ApplyStaticCollisionResponse(const Hit& hit);
+    void ApplyStaticContactSet(const ContactSet& contacts);
+    // 離れようとしている接触では何もせず false を返す
+    bool ApplyStaticContactImpulse(const Hit& hit);
+    void ApplyStaticPositionCorrection(const DirectX::XMFLOAT3& normal, float depth);
+    // 地形の三角形ごとの接触へ応答
+    void ApplyTerrainContacts(const Hit* hits, int hitCount);
+    // 今ステップの移動をスイープし、最初に当たる静的物体の手前まで戻す
+    void ApplyContinuousCollision();
 
     // メンバ変数
     MODEL* m_pModel;                    // モデルへのポインタ
@@ -81,14 +125,20 @@ private:
     float m_rootVolume;                 // 祖先の体積（基準値）
     float m_lifeTimer;                  // 自動消滅までの残り時間（負=無効）
     bool m_isDead;                      // 消滅フラグ
+    float m_Age;                        // 生成からの経過時間
+    float m_SleepTime;                  // 連続スリープ時間
+    bool m_isVisualOnly;                // 当たり判定なし（描画のみ）
 
     ColliderType m_colliderType;
+    int m_BroadphaseProxy;              // ブロードフェーズ登録ID
+    int m_SceneProxy;                   // シーン問い合わせ登録ID
 
     // 定数
     static constexpr float SKIN_WIDTH = -0.01f;        // コライダーのスキン幅
     static constexpr float SHRINK_START_TIME = 1.0f;   // 縮小開始時間
     static constexpr float CORRECTION_PERCENT = 0.2f;  // 位置補正の割合
     static constexpr float CORRECTION_SLOP = 0.01f;    // 位置補正のスロップ
+    static constexpr float GROUND_NORMAL_Y = 0.7f;     // 接地とみなす法線のY成分
 };
 
 #endif // PHYSICS_MODEL_H
\ No newline at end of file
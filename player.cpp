@@ -1,10 +1,14 @@
 /****************************************
  * @file player.cpp
- * @brief vC[䃂W[iXe[g}VΉŁj
+ * @brief プレイヤー制御モジュール（ステートマシン対応版）
  * @author Natsume Shidara
  * @date 2025/10/31
- * @update 2026/01/10 - t@N^O
- * @update 2026/01/13 - TEhΉEfobO
+ * @update 2026/01/10 - リファクタリング
+ * @update 2026/01/13 - サウンド対応・デバッグ分離
+ * @update 2026/10/18 - カプセルによるスイープ式キャラクターコントローラーへ置き換え
+ * @update 2026/10/18 - シーン問い合わせへの登録
+ * @update 2026/10/18 - 三角形メッシュを持つマップオブジェクトとの判定
+ * @update 2026/10/18 - 地形をカプセルと三角形ごとの接触で判定
  ****************************************/
 
 #include "player.h"
@@ -21,6 +25,9 @@
 #include "post_process.h"
 #include "collider_generator.h"
 #include "collision.h"
+#include "scene_query.h"
+#include "mesh_collider.h"
+#include "heightfield.h"
 #include "sound_manager.h"
 
 #ifdef _DEBUG
@@ -34,7 +41,7 @@
 using namespace DirectX;
 
 //======================================
-// 萔
+// 定数
 //======================================
 namespace
 {
@@ -68,10 +75,18 @@ namespace
 
     constexpr float COLLISION_EPSILON = 0.001f;
     constexpr int MAX_HP = 10;
+
+    // キャラクターコントローラー
+    constexpr float CONTROLLER_SKIN = 0.01f;            // 面との間に残す隙間
+    constexpr int CONTROLLER_MAX_SLIDES = 4;            // 1回の移動で面に沿って滑らせる最大回数
+    constexpr float CONTROLLER_STEP_HEIGHT = 0.35f;     // 自動で乗り越える段差の高さ
+    constexpr float CONTROLLER_MAX_SLOPE_COS = 0.7f;    // 歩ける面の法線Yの下限（約45度）
+    constexpr float GROUND_CHECK_MARGIN = 0.3f;         // 地形の接地判定の余裕
+    constexpr int CONTROLLER_TERRAIN_ITERATIONS = 2;    // 地形からの押し出しの反復回数（谷で2面に触れる場合）
 }
 
 //======================================
-// vC[f[^
+// プレイヤーデータ
 //======================================
 struct PlayerData
 {
@@ -91,16 +106,18 @@ struct PlayerData
 
     XMFLOAT3 actionDir;
     bool grounded;
-    bool wasGrounded;  // Ot[̐ڒn
+    bool wasGrounded;  // 前フレームの接地状態
 
     MODEL* pModel;
     OBB localOBB;
+    Capsule localCapsule;   // 足元からの相対位置（向きに依存しないよう縦軸上に置く）
+    int sceneProxy = -1;    // シーン問い合わせ登録ID
 };
 
 static PlayerData g_Player{};
 
 //======================================
-// ֐vg^Cv
+// 内部関数プロトタイプ
 //======================================
 static void ChangeState(PlayerState newState);
 static bool CanChangeState(PlayerState newState);
@@ -129,7 +146,7 @@ static bool TryTransitionCommon();
 static bool TryTransitionAirborne();
 
 //======================================
-// EI
+// 初期化・終了
 //======================================
 void Player_Initialize(const XMFLOAT3& position, const XMFLOAT3& front)
 {
@@ -152,10 +169,22 @@ void Player_Initialize(const XMFLOAT3& position, const XMFLOAT3& front)
         Collider col = ColliderGenerator::GenerateBestFit(g_Player.pModel);
         g_Player.localOBB = col.obb;
     }
+
+    // 移動用のカプセルは OBB の高さと水平方向の短い辺から決める
+    const XMFLOAT3& extents = g_Player.localOBB.extents;
+    const float radius = std::max(std::min(extents.x, extents.z), COLLISION_EPSILON);
+    const float halfSegment = std::max(extents.y - radius, 0.0f);
+    g_Player.localCapsule = Capsule::CreateVertical({ 0.0f, g_Player.localOBB.center.y, 0.0f }, halfSegment * 2.0f, radius);
+
+    const AABB bounds = Collision_GetOBBBounds(Player_GetWorldOBB(XMLoadFloat3(&g_Player.position)));
+    g_Player.sceneProxy = SceneQuery_CreateProxy(SceneObjectType::Player, nullptr, bounds, CollisionLayer::Player);
 }
 
 void Player_Finalize()
 {
+    SceneQuery_DestroyProxy(g_Player.sceneProxy);
+    g_Player.sceneProxy = -1;
+
     if (g_Player.pModel)
     {
         ModelRelease(g_Player.pModel);
@@ -164,13 +193,13 @@ void Player_Finalize()
 }
 
 //======================================
-// XV
+// 更新
 //======================================
 void Player_Update(double elapsed_time)
 {
     float dt = static_cast<float>(elapsed_time);
 
-    // Ot[̐ڒnԂۑ
+    // 前フレームの接地状態を保存
     g_Player.wasGrounded = g_Player.grounded;
 
     g_Player.stateTimer += dt;
@@ -204,7 +233,7 @@ void Player_Update(double elapsed_time)
     UpdateCollision(dt);
     UpdateRotation();
 
-    // nSEi󒆂nɕςj
+    // 着地SE（空中から地上に変わった時）
     if (!g_Player.wasGrounded && g_Player.grounded)
     {
         SoundManager_PlaySE(SOUND_SE_LAND);
@@ -212,7 +241,7 @@ void Player_Update(double elapsed_time)
 }
 
 //======================================
-// ԑJ
+// 状態遷移
 //======================================
 static void ChangeState(PlayerState newState)
 {
@@ -228,14 +257,14 @@ static void ChangeState(PlayerState newState)
         {
             g_Player.velocity.y = JUMP_POWER;
             g_Player.jumpCount = MAX_JUMP_COUNT - 1;
-            // WvSE
+            // ジャンプSE
             SoundManager_PlaySE(SOUND_SE_JUMP);
         }
         else if (g_Player.jumpCount > 0)
         {
             g_Player.velocity.y = DOUBLE_JUMP_POWER;
             g_Player.jumpCount--;
-            // iWvSE
+            // 二段ジャンプSE
             SoundManager_PlaySE(SOUND_SE_DOUBLE_JUMP);
         }
         g_Player.grounded = false;
@@ -263,7 +292,7 @@ static void ChangeState(PlayerState newState)
             g_Player.velocity = { 0.0f, 0.0f, 0.0f };
             PLCamera_SetTargetFOV(FOV_CHARGE, FOV_SPEED_FAST);
 
-            // _bV`[WSE
+            // ダッシュチャージSE
             SoundManager_PlaySE(SOUND_SE_DASH_CHARGE);
         }
         break;
@@ -278,7 +307,7 @@ static void ChangeState(PlayerState newState)
         Blade_TriggerHorizontalSlash();
         PostProcess_StartRadialBlur(1.0f, AIR_DASH_DURATION * 2.5f, true);
 
-        // _bVSE
+        // ダッシュSE
         SoundManager_PlaySE(SOUND_SE_DASH);
         break;
 
@@ -302,7 +331,7 @@ static void ChangeState(PlayerState newState)
             PostProcess_StartDirectionalBlur({ screenX, screenY }, 1.0f, STEP_DURATION * 2.5f);
         }
 
-        // XebvSE
+        // ステップSE
         SoundManager_PlaySE(SOUND_SE_STEP);
         break;
 
@@ -344,7 +373,7 @@ static bool CanChangeState(PlayerState newState)
 }
 
 //======================================
-// 
+// 入力
 //======================================
 static XMVECTOR GetMoveInput()
 {
@@ -407,7 +436,7 @@ static bool IsAirDashInput()
 }
 
 //======================================
-// ʑJڃ`FbN
+// 共通遷移チェック
 //======================================
 static bool TryTransitionCommon()
 {
@@ -455,7 +484,7 @@ static bool TryTransitionAirborne()
 }
 
 //======================================
-// ԕʍXV
+// 状態別更新
 //======================================
 static void UpdateState_Ground(float dt, bool isWalking)
 {
@@ -596,7 +625,7 @@ static void UpdateState_AirDash(float dt)
 }
 
 //======================================
-// 
+// 物理処理
 //======================================
 static void ApplyGravity(float dt)
 {
@@ -621,92 +650,321 @@ static void ApplyFriction(bool grounded)
     g_Player.velocity.z *= f;
 }
 
-static void UpdateCollision(float dt)
+//======================================
+// キャラクターコントローラー
+//======================================
+static Capsule GetWorldCapsule(const XMFLOAT3& position)
 {
-    XMVECTOR pos = XMLoadFloat3(&g_Player.position);
-    XMVECTOR vel = XMLoadFloat3(&g_Player.velocity);
-    pos += vel * dt;
+    return Player_GetWorldCapsule(XMLoadFloat3(&position));
+}
 
-    XMFLOAT3 newPos;
-    XMStoreFloat3(&newPos, pos);
+/**
+ * @brief カプセルを移動させたときに最初に当たるマップオブジェクトを求める
+ * @detail 移動前後のカプセルを包む範囲だけを空間インデックスへ問い合わせるため、
+ *         コストはマップ全体の大きさではなく移動範囲の混み具合で決まる
+ */
+static SweepHit SweepMap(const Capsule& capsule, const XMFLOAT3& displacement)
+{
+    const float margin = capsule.radius + CONTROLLER_SKIN;
+    AABB bounds;
+    bounds.min = {
+        std::min(capsule.start.x, capsule.end.x) + std::min(displacement.x, 0.0f) - margin,
+        std::min(capsule.start.y, capsule.end.y) + std::min(displacement.y, 0.0f) - margin,
+        std::min(capsule.start.z, capsule.end.z) + std::min(displacement.z, 0.0f) - margin
+    };
+    bounds.max = {
+        std::max(capsule.start.x, capsule.end.x) + std::max(displacement.x, 0.0f) + margin,
+        std::max(capsule.start.y, capsule.end.y) + std::max(displacement.y, 0.0f) + margin,
+        std::max(capsule.start.z, capsule.end.z) + std::max(displacement.z, 0.0f) + margin
+    };
 
-    XMFLOAT3 velF;
-    XMStoreFloat3(&velF, vel);
+    static std::vector<int> nearbyObjects;
+    Map_QueryAABB(bounds, nearbyObjects);
 
-    float terrainHeight = Stage_GetTerrainHeight(newPos.x, newPos.z);
-    float playerFootY = newPos.y;
+    SweepHit best;
+    for (int index : nearbyObjects)
+    {
+        const MapObject* object = Map_GetObject(index);
+        const SweepHit hit = object->Mesh
+            ? object->Mesh->SweepCapsule(capsule, displacement)
+            : Collision_SweepCapsuleAABB(capsule, displacement, object->Aabb);
+        if (hit.isHit && (!best.isHit || hit.time < best.time))
+        {
+            best = hit;
+        }
+    }
+    return best;
+}
 
-    constexpr float GROUND_CHECK_MARGIN = 0.3f;
+/**
+ * @brief カプセルを移動させ、当たった場合は面の手前（スキン分）で止める
+ * @return 実際に進んだ割合（0～1）
+ */
+static float SweepAndMove(XMFLOAT3& position, const XMFLOAT3& displacement, SweepHit* outHit)
+{
+    const float length = XMVectorGetX(XMVector3Length(XMLoadFloat3(&displacement)));
+    if (length < 1e-6f)
+    {
+        if (outHit) *outHit = SweepHit();
+        return 1.0f;
+    }
 
-    bool isRising = velF.y > 0.5f;
-    bool isAirDashing = (g_Player.state == PlayerState::AirDash || g_Player.state == PlayerState::AirDashCharge);
+    const SweepHit hit = SweepMap(GetWorldCapsule(position), displacement);
+    if (outHit) *outHit = hit;
 
-    bool skipGroundCheck = isRising || (isAirDashing && velF.y > -0.5f);
+    const float fraction = hit.isHit ? std::max(hit.time * length - CONTROLLER_SKIN, 0.0f) / length : 1.0f;
+    position.x += displacement.x * fraction;
+    position.y += displacement.y * fraction;
+    position.z += displacement.z * fraction;
+    return fraction;
+}
 
-    if (!skipGroundCheck)
-    {
-        if (playerFootY <= terrainHeight + GROUND_CHECK_MARGIN)
-        {
-            if (playerFootY < terrainHeight)
-            {
-                newPos.y = terrainHeight;
-            }
+/**
+ * @brief 開始時点でマップオブジェクトにめり込んでいたら押し出す
+ */
+static void DepenetrateMap(XMFLOAT3& position)
+{
+    const Capsule boundsCapsule = GetWorldCapsule(position);
+    const float margin = boundsCapsule.radius + CONTROLLER_SKIN;
+    AABB bounds;
+    bounds.min = { boundsCapsule.start.x - margin, boundsCapsule.start.y - margin, boundsCapsule.start.z - margin };
+    bounds.max = { boundsCapsule.end.x + margin, boundsCapsule.end.y + margin, boundsCapsule.end.z + margin };
+
+    static std::vector<int> nearbyObjects;
+    Map_QueryAABB(bounds, nearbyObjects);
 
-            g_Player.grounded = true;
+    for (int index : nearbyObjects)
+    {
+        const MapObject* object = Map_GetObject(index);
+        const Capsule capsule = GetWorldCapsule(position);
 
-            if (velF.y < 0.0f)
+        Hit hit;
+        if (object->Mesh)
+        {
+            // 三角形ごとの接触のうち最も深いものだけで押し出す（AABBと同じく1物体1回）
+            Collider collider;
+            collider.type = ColliderType::Capsule;
+            collider.capsule = capsule;
+
+            Hit meshHits[MeshColliderConfig::MAX_CONTACTS];
+            const int meshHitCount = object->Mesh->Collide(collider, meshHits, MeshColliderConfig::MAX_CONTACTS);
+            for (int i = 0; i < meshHitCount; ++i)
             {
-                velF.y = 0.0f;
-                vel = XMLoadFloat3(&velF);
+                if (!hit.isHit || meshHits[i].depth > hit.depth) hit = meshHits[i];
             }
         }
         else
         {
-            g_Player.grounded = false;
+            hit = Collision_IsHitCapsuleAABB(capsule, object->Aabb);
         }
+        if (!hit.isHit) continue;
+
+        const float push = hit.depth + CONTROLLER_SKIN;
+        position.x += hit.normal.x * push;
+        position.y += hit.normal.y * push;
+        position.z += hit.normal.z * push;
     }
-    else
+}
+
+/**
+ * @brief カプセルと地形の三角形ごとの接触を求める
+ * @param[out] outHits 接触（法線は地形→カプセル、HeightFieldConfig::MAX_CONTACTS 個分）
+ */
+static int CollideTerrain(const XMFLOAT3& position, Hit* outHits)
+{
+    Collider collider;
+    collider.type = ColliderType::Capsule;
+    collider.capsule = GetWorldCapsule(position);
+    return Stage_CollideTerrain(collider, outHits, HeightFieldConfig::MAX_CONTACTS);
+}
+
+/**
+ * @brief 地形にめり込んだカプセルを最も深い接触の法線で押し出す
+ * @detail 歩ける面は法線方向の深さと同じだけ離れるよう真上へ持ち上げる（法線方向に押すと斜面を少しずつ滑り降りる）。
+ *         急斜面は法線方向へ押し戻して登る成分を速度から消し、重力で滑り落ちるようにする
+ */
+static void DepenetrateTerrain(XMFLOAT3& position, XMFLOAT3& velocity)
+{
+    for (int i = 0; i < CONTROLLER_TERRAIN_ITERATIONS; ++i)
     {
-        g_Player.grounded = false;
+        Hit hits[HeightFieldConfig::MAX_CONTACTS];
+        const int hitCount = CollideTerrain(position, hits);
 
-        if (playerFootY < terrainHeight)
+        const Hit* deepest = nullptr;
+        for (int h = 0; h < hitCount; ++h)
         {
-            newPos.y = terrainHeight;
+            if (!deepest || hits[h].depth > deepest->depth) deepest = &hits[h];
+        }
+        if (!deepest || deepest->depth <= 0.0f) break;
+
+        const XMFLOAT3 normal = deepest->normal;
+        if (normal.y >= CONTROLLER_MAX_SLOPE_COS)
+        {
+            position.y += deepest->depth / normal.y;
+            continue;
+        }
+
+        position.x += normal.x * deepest->depth;
+        position.y += normal.y * deepest->depth;
+        position.z += normal.z * deepest->depth;
+
+        XMVECTOR vNormal = XMLoadFloat3(&normal);
+        XMVECTOR vel = XMLoadFloat3(&velocity);
+        const float into = XMVectorGetX(XMVector3Dot(vel, vNormal));
+        if (into < 0.0f)
+        {
+            XMStoreFloat3(&velocity, vel - vNormal * into);
         }
     }
+}
 
-    pos = XMLoadFloat3(&newPos);
+/**
+ * @brief 足元を接地判定の余裕分だけ下げたカプセルが歩ける地形に触れるか
+ */
+static bool IsOnWalkableTerrain(const XMFLOAT3& position)
+{
+    XMFLOAT3 probe = position;
+    probe.y -= GROUND_CHECK_MARGIN;
 
-    int count = Map_GetObjectCount();
-    for (int i = 0; i < count; i++)
+    Hit hits[HeightFieldConfig::MAX_CONTACTS];
+    const int hitCount = CollideTerrain(probe, hits);
+    for (int h = 0; h < hitCount; ++h)
     {
-        OBB playerOBB = Player_GetWorldOBB(pos);
-        AABB objectAABB = Map_GetObject(i)->Aabb;
+        if (hits[h].normal.y >= CONTROLLER_MAX_SLOPE_COS) return true;
+    }
+    return false;
+}
 
-        Hit hit = Collision_IsHitOBBAABB(playerOBB, objectAABB);
-        if (hit.isHit)
-        {
-            XMVECTOR normal = XMLoadFloat3(&hit.normal);
-            pos += normal * (hit.depth + COLLISION_EPSILON);
+/**
+ * @brief 段差の乗り越えを試す（持ち上げ→水平移動→接地面まで下ろす）
+ * @detail 下ろした先が歩ける面でなければ元の位置のまま false を返す
+ */
+static bool TryStepUp(XMFLOAT3& position, const XMFLOAT3& horizontal)
+{
+    if (horizontal.x * horizontal.x + horizontal.z * horizontal.z < 1e-8f) return false;
+
+    XMFLOAT3 stepped = position;
+
+    // 持ち上げ（天井に当たった分だけ低くなる）
+    const float startY = stepped.y;
+    SweepAndMove(stepped, { 0.0f, CONTROLLER_STEP_HEIGHT, 0.0f }, nullptr);
+    const float raised = stepped.y - startY;
+    if (raised <= CONTROLLER_SKIN) return false;
+
+    // 水平移動（少しも進めなければ段差ではなく壁）
+    const float progress = SweepAndMove(stepped, horizontal, nullptr);
+    if (progress <= 0.0f) return false;
 
-            float dot = XMVectorGetX(XMVector3Dot(vel, normal));
-            if (dot < 0.0f) vel -= normal * dot;
+    // 持ち上げた分だけ下ろし、歩ける面に乗ったときだけ採用する
+    SweepHit ground;
+    SweepAndMove(stepped, { 0.0f, -(raised + CONTROLLER_SKIN), 0.0f }, &ground);
+    if (!ground.isHit || ground.normal.y < CONTROLLER_MAX_SLOPE_COS) return false;
 
-            if (hit.normal.y > 0.7f && !isRising)
+    position = stepped;
+    return true;
+}
+
+/**
+ * @brief 衝突面に沿って滑らせながら移動する（collide-and-slide）
+ * @param[in,out] velocity 当たった面へ向かう成分を取り除く
+ * @param allowStepUp 横から壁に当たったとき段差の乗り越えを試すか
+ * @return 歩ける面（上向きの面）に当たったか
+ */
+static bool MoveAndSlide(XMFLOAT3& position, XMFLOAT3 displacement, XMFLOAT3& velocity, bool allowStepUp)
+{
+    bool hitGround = false;
+
+    for (int i = 0; i < CONTROLLER_MAX_SLIDES; ++i)
+    {
+        SweepHit hit;
+        const float fraction = SweepAndMove(position, displacement, &hit);
+        if (!hit.isHit) break;
+
+        XMVECTOR normal = XMLoadFloat3(&hit.normal);
+        XMVECTOR remaining = XMLoadFloat3(&displacement) * (1.0f - fraction);
+
+        const bool isWalkable = hit.normal.y >= CONTROLLER_MAX_SLOPE_COS;
+        if (isWalkable) hitGround = true;
+
+        // 横向きの面は段差として乗り越えを試す（乗り越えたら残りの移動は消化済み）
+        if (allowStepUp && std::abs(hit.normal.y) < 0.1f)
+        {
+            XMFLOAT3 horizontal;
+            XMStoreFloat3(&horizontal, remaining);
+            horizontal.y = 0.0f;
+            if (TryStepUp(position, horizontal))
             {
-                g_Player.grounded = true;
-                vel = XMVectorSetY(vel, 0.0f);
+                hitGround = true;
+                break;
             }
         }
+
+        // 残りの移動量と速度から面へ向かう成分を取り除き、面に沿って滑らせる
+        remaining -= normal * XMVectorGetX(XMVector3Dot(remaining, normal));
+        XMStoreFloat3(&displacement, remaining);
+
+        XMVECTOR vel = XMLoadFloat3(&velocity);
+        const float into = XMVectorGetX(XMVector3Dot(vel, normal));
+        if (into < 0.0f)
+        {
+            XMStoreFloat3(&velocity, vel - normal * into);
+        }
+    }
+
+    return hitGround;
+}
+
+static void UpdateCollision(float dt)
+{
+    XMFLOAT3 position = g_Player.position;
+    XMFLOAT3 velocity = g_Player.velocity;
+
+    const bool isRising = velocity.y > 0.5f;
+    const bool isAirDashing = (g_Player.state == PlayerState::AirDash || g_Player.state == PlayerState::AirDashCharge);
+    const bool skipGroundCheck = isRising || (isAirDashing && velocity.y > -0.5f);
+
+    // マップオブジェクト：スイープで移動するためダッシュ速度でもすり抜けない
+    DepenetrateMap(position);
+
+    const XMFLOAT3 displacement = { velocity.x * dt, velocity.y * dt, velocity.z * dt };
+    const bool canStepUp = g_Player.wasGrounded && !isRising;
+    bool isGrounded = MoveAndSlide(position, displacement, velocity, canStepUp) && !isRising;
+
+    // 接地していたなら段差の高さまで下を探し、下り段差でも足元を面に吸着させる
+    if (!isGrounded && !skipGroundCheck)
+    {
+        const float probe = g_Player.wasGrounded ? CONTROLLER_STEP_HEIGHT : CONTROLLER_SKIN * 2.0f;
+        XMFLOAT3 probed = position;
+        SweepHit ground;
+        SweepAndMove(probed, { 0.0f, -probe, 0.0f }, &ground);
+        if (ground.isHit && ground.normal.y >= CONTROLLER_MAX_SLOPE_COS)
+        {
+            position = probed;
+            isGrounded = true;
+        }
     }
 
-    XMStoreFloat3(&newPos, pos);
-    XMFLOAT3 clampedPos = Stage_ClampToPlayArea(newPos);
-    clampedPos.y = newPos.y;
-    pos = XMLoadFloat3(&clampedPos);
+    // 地形：カプセル全体と三角形ごとの接触で押し出す（中心1点の高さでは半径分が斜面や尾根に沈む）
+    DepenetrateTerrain(position, velocity);
 
-    XMStoreFloat3(&g_Player.position, pos);
-    XMStoreFloat3(&g_Player.velocity, vel);
+    if (!skipGroundCheck && IsOnWalkableTerrain(position))
+    {
+        isGrounded = true;
+    }
+
+    if (isGrounded && velocity.y < 0.0f)
+    {
+        velocity.y = 0.0f;
+    }
+    g_Player.grounded = isGrounded;
+
+    XMFLOAT3 clampedPos = Stage_ClampToPlayArea(position);
+    clampedPos.y = position.y;
+
+    g_Player.position = clampedPos;
+    g_Player.velocity = velocity;
+
+    SceneQuery_MoveProxy(g_Player.sceneProxy, Collision_GetOBBBounds(Player_GetWorldOBB(XMLoadFloat3(&g_Player.position))));
 }
 
 static void UpdateRotation()
@@ -716,7 +974,7 @@ static void UpdateRotation()
 }
 
 //======================================
-// `
+// 描画
 //======================================
 void Player_Draw()
 {
@@ -743,6 +1001,11 @@ void Player_DrawDebug()
 #ifdef _DEBUG
     DebugRenderer::DrawOBB(Player_GetWorldOBB(XMLoadFloat3(&g_Player.position)), { 0, 0.5f, 0.5f, 1 });
 
+    // 移動用カプセル（両端の球）
+    const Capsule capsule = Player_GetWorldCapsule(XMLoadFloat3(&g_Player.position));
+    DebugRenderer::DrawSphere(Sphere{ capsule.start, capsule.radius }, { 1.0f, 0.5f, 0.0f, 1.0f });
+    DebugRenderer::DrawSphere(Sphere{ capsule.end, capsule.radius }, { 1.0f, 0.5f, 0.0f, 1.0f });
+
     static const XMFLOAT4 stateColors[] = {
         { 0.5f, 0.5f, 0.5f, 1.0f },
         { 0.0f, 1.0f, 0.0f, 1.0f },
@@ -771,7 +1034,7 @@ void Player_DrawDebug()
 }
 
 //======================================
-// Qb^[
+// ゲッター
 //======================================
 const XMFLOAT3& Player_GetPosition() { return g_Player.position; }
 const XMFLOAT3& Player_GetFront() { return g_Player.front; }
@@ -784,13 +1047,24 @@ int Player_GetJumpCount() { return g_Player.jumpCount; }
 int Player_GetAirDashCount() { return g_Player.airDashCount; }
 
 //======================================
-// Zb^[
+// セッター
 //======================================
 void Player_SetPosition(const XMFLOAT3& position)
 {
     g_Player.position = position;
 }
 
+Capsule Player_GetWorldCapsule(const XMVECTOR& position)
+{
+    XMFLOAT3 offset;
+    XMStoreFloat3(&offset, position);
+
+    Capsule capsule = g_Player.localCapsule;
+    capsule.start = { capsule.start.x + offset.x, capsule.start.y + offset.y, capsule.start.z + offset.z };
+    capsule.end = { capsule.end.x + offset.x, capsule.end.y + offset.y, capsule.end.z + offset.z };
+    return capsule;
+}
+
 OBB Player_GetWorldOBB(const XMVECTOR& position)
 {
     OBB obb = g_Player.localOBB;
@@ -808,7 +1082,7 @@ OBB Player_GetWorldOBB(const XMVECTOR& position)
 }
 
 //======================================
-// O
+// 外部操作
 //======================================
 void Player_TakeDamage(int damage)
 {
@@ -818,7 +1092,7 @@ void Player_TakeDamage(int damage)
     g_Player.invincibleTimer = 1.5f;
 
     PLCamera_Shake(1.0f);
-    // _[WSE
+    // ダメージSE
     SoundManager_PlaySE(SOUND_SE_PLAYER_DAMAGE);
 }
 
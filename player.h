@@ -1,9 +1,10 @@
 /****************************************
  * @file player.h
- * @brief vC[iXe[g}VΉŁj
+ * @brief プレイヤー制御（ステートマシン対応版）
  * @author Natsume Shidara
  * @date 2025/10/31
- * @update 2026/01/10 - t@N^O
+ * @update 2026/01/10 - リファクタリング
+ * @update 2026/10/18 - 移動用カプセルの取得を追加
  ****************************************/
 
 #ifndef PLAYER_H
@@ -13,28 +14,28 @@
 #include "collision.h"
 
  //--------------------------------------
- // vC[ԗ񋓌^
+ // プレイヤー状態列挙型
  //--------------------------------------
 enum class PlayerState
 {
-    // n
-    Idle,           // ҋ@
-    Walk,           // s
-    Attack,         // u[hUinj
-    Step,           // XebvinE󒆋ʁj
+    // 地上状態
+    Idle,           // 待機
+    Walk,           // 歩行
+    Attack,         // ブレード攻撃（地上）
+    Step,           // ステップ回避（地上・空中共通）
 
-    // 󒆏
-    Jump,           // Wv / iWv
-    Fall,           // 
-    AirDashCharge,  // 󒆃_bV
-    AirDash,        // 󒆃_bVU
+    // 空中状態
+    Jump,           // ジャンプ / 二段ジャンプ
+    Fall,           // 落下
+    AirDashCharge,  // 空中ダッシュ溜め
+    AirDash,        // 空中ダッシュ攻撃
 
-    // Ԑipj
+    // 状態数（内部用）
     Count
 };
 
 //--------------------------------------
-// {֐
+// 基本関数
 //--------------------------------------
 void Player_Initialize(const DirectX::XMFLOAT3& position, const DirectX::XMFLOAT3& front);
 void Player_Finalize();
@@ -44,7 +45,7 @@ void Player_DrawShadow();
 void Player_DrawDebug();
 
 //--------------------------------------
-// Qb^[
+// ゲッター
 //--------------------------------------
 const DirectX::XMFLOAT3& Player_GetPosition();
 const DirectX::XMFLOAT3& Player_GetFront();
@@ -56,14 +57,15 @@ bool Player_IsGrounded();
 int Player_GetJumpCount();
 int Player_GetAirDashCount();
 OBB Player_GetWorldOBB(const DirectX::XMVECTOR& position);
+Capsule Player_GetWorldCapsule(const DirectX::XMVECTOR& position);
 
 //--------------------------------------
-// Zb^[
+// セッター
 //--------------------------------------
 void Player_SetPosition(const DirectX::XMFLOAT3& position);
 
 //--------------------------------------
-// O
+// 外部操作
 //--------------------------------------
 void Player_TakeDamage(int damage);
 void Player_RecoverAirDash(int amount = 1);
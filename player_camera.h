@@ -1,11 +1,11 @@
 /**
  * @file player_camera.h
- * @brief vC[Jil̎_j
+ * @brief プレイヤーカメラ制御（一人称視点）
  *
  * @author Natsume Shidara
  * @date 2025/10/31
- * @update 2026/01/07 - l̎_ɕύX
- * @update 2026/01/28 - JVFCN@\ǉ
+ * @update 2026/01/07 - 一人称視点に変更
+ * @update 2026/01/28 - カメラシェイク機能追加
  */
 
 #ifndef PLAYER_CAMERA_H
@@ -14,18 +14,18 @@
 #include <DirectXMath.h>
 
  //======================================
- // EI
+ // 初期化・終了
  //======================================
 void PLCamera_Initialize(DirectX::XMFLOAT3 eyeOffset);
 void PLCamera_Finalize(void);
 
 //======================================
-// XV
+// 更新
 //======================================
 void PLCamera_Update(double elapsed_time);
 
 //======================================
-// Qb^[
+// ゲッター
 //======================================
 const DirectX::XMFLOAT3& PLCamera_GetPosition();
 const DirectX::XMFLOAT3& PLCamera_GetFront();
@@ -38,7 +38,7 @@ float PLCamera_GetYaw();
 float PLCamera_GetPitch();
 
 //======================================
-// FOV
+// FOV制御
 //======================================
 void PLCamera_SetTargetFOV(float fov, float speed);
 void PLCamera_SetFOV(float fov);
@@ -47,13 +47,13 @@ void PLCamera_ResetFOV(float speed);
 float PLCamera_GetDefaultFOV();
 
 //======================================
-// xݒ
+// 感度設定
 //======================================
 void PLCamera_SetMouseSensitivity(float sensitivity);
 float PLCamera_GetMouseSensitivity();
 
 //======================================
-// JVFCN
+// カメラシェイク
 //======================================
 void PLCamera_Shake(float shakePower);
 void PLCamera_StopShake();
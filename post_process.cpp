@@ -1,9 +1,9 @@
 /****************************************
  * @file post_process.cpp
- * @brief |XgvZXGtFNgǗ
- * @detail WAu[A[Vu[̉ʌ
+ * @brief ポストプロセスエフェクト管理
+ * @detail ラジアルブラー、モーションブラー等の画面効果
  * @date 2026/01/10
- * @update VF[_[.hlslt@CɕA.csoǂݍݕɕύX
+ * @update シェーダーを.hlslファイルに分離、.cso読み込み方式に変更
  ****************************************/
 
 #include "post_process.h"
@@ -16,26 +16,26 @@
 using namespace DirectX;
 
 //======================================
-// }N`
+// マクロ定義
 //======================================
 #ifndef SAFE_RELEASE
 #define SAFE_RELEASE(x) if(x){ x->Release(); x = nullptr; }
 #endif
 
 //======================================
-// 萔obt@\
+// 定数バッファ構造体
 //======================================
 struct PostProcessCB
 {
-    XMFLOAT2 center;        // u[SiUVWj
-    float intensity;        // u[x
-    float sampleCount;      // Tv
-    XMFLOAT2 direction;     // u[p
+    XMFLOAT2 center;        // ブラー中心（UV座標）
+    float intensity;        // ブラー強度
+    float sampleCount;      // サンプル数
+    XMFLOAT2 direction;     // 方向性ブラー用
     float padding[2];
 };
 
 //======================================
-// ϐ
+// 内部変数
 //======================================
 static ID3D11Texture2D* g_pSceneTexture = nullptr;
 static ID3D11RenderTargetView* g_pSceneRTV = nullptr;
@@ -49,7 +49,7 @@ static ID3D11PixelShader* g_pPassthroughPS = nullptr;
 static ID3D11Buffer* g_pConstantBuffer = nullptr;
 static ID3D11SamplerState* g_pSamplerState = nullptr;
 
-// GtFNg
+// エフェクト状態
 static PostProcessEffect g_CurrentEffect = PostProcessEffect::None;
 static float g_Intensity = 0.0f;
 static float g_Duration = 0.0f;
@@ -58,16 +58,16 @@ static bool g_FadeOut = true;
 static XMFLOAT2 g_BlurDirection = { 0.0f, 0.0f };
 static float g_InitialIntensity = 0.0f;
 
-// ̃_[^[Qbgۑp
+// 元のレンダーターゲット保存用
 static ID3D11RenderTargetView* g_pOriginalRTV = nullptr;
 static ID3D11DepthStencilView* g_pOriginalDSV = nullptr;
 
-// foCXQ
+// デバイス参照
 static ID3D11Device* g_pDevice = nullptr;
 static ID3D11DeviceContext* g_pContext = nullptr;
 
 //======================================
-// wp[֐Ft@Cǂݍ
+// ヘルパー関数：ファイル読み込み
 //======================================
 static std::vector<char> LoadFileToBlob(const std::string& path)
 {
@@ -103,7 +103,7 @@ static std::vector<char> LoadFileToBlob(const std::string& path)
 }
 
 //======================================
-// 
+// 初期化
 //======================================
 void PostProcess_Initialize()
 {
@@ -122,7 +122,7 @@ void PostProcess_Initialize()
     HRESULT hr = S_OK;
 
     //--------------------------------------
-    // V[eNX`쐬
+    // シーンテクスチャ作成
     //--------------------------------------
     D3D11_TEXTURE2D_DESC texDesc = {};
     texDesc.Width = width;
@@ -159,7 +159,7 @@ void PostProcess_Initialize()
     }
 
     //--------------------------------------
-    // _VF[_[ǂݍ
+    // 頂点シェーダー読み込み
     //--------------------------------------
     {
         const std::string vsPath = "assets/shader/shader_postprocess_vs.cso";
@@ -181,7 +181,7 @@ void PostProcess_Initialize()
     }
 
     //--------------------------------------
-    // WAu[ sNZVF[_[ǂݍ
+    // ラジアルブラー ピクセルシェーダー読み込み
     //--------------------------------------
     {
         const std::string psPath = "assets/shader/shader_postprocess_radial_ps.cso";
@@ -203,7 +203,7 @@ void PostProcess_Initialize()
     }
 
     //--------------------------------------
-    // u[ sNZVF[_[ǂݍ
+    // 方向性ブラー ピクセルシェーダー読み込み
     //--------------------------------------
     {
         const std::string psPath = "assets/shader/shader_postprocess_directional_ps.cso";
@@ -225,7 +225,7 @@ void PostProcess_Initialize()
     }
 
     //--------------------------------------
-    // pXX[ sNZVF[_[ǂݍ
+    // パススルー ピクセルシェーダー読み込み
     //--------------------------------------
     {
         const std::string psPath = "assets/shader/shader_postprocess_passthrough_ps.cso";
@@ -247,7 +247,7 @@ void PostProcess_Initialize()
     }
 
     //--------------------------------------
-    // 萔obt@쐬
+    // 定数バッファ作成
     //--------------------------------------
     {
         D3D11_BUFFER_DESC cbDesc = {};
@@ -266,7 +266,7 @@ void PostProcess_Initialize()
     }
 
     //--------------------------------------
-    // Tv[Xe[g쐬
+    // サンプラーステート作成
     //--------------------------------------
     {
         D3D11_SAMPLER_DESC sampDesc = {};
@@ -284,7 +284,7 @@ void PostProcess_Initialize()
         }
     }
 
-    // 
+    // 初期状態
     g_CurrentEffect = PostProcessEffect::None;
     g_Intensity = 0.0f;
     g_Timer = 0.0f;
@@ -293,7 +293,7 @@ void PostProcess_Initialize()
 }
 
 //======================================
-// I
+// 終了処理
 //======================================
 void PostProcess_Finalize()
 {
@@ -314,53 +314,53 @@ void PostProcess_Finalize()
 }
 
 //======================================
-// V[`Jn
+// シーン描画開始
 //======================================
 void PostProcess_BeginScene()
 {
     if (!g_pContext || !g_pSceneRTV) return;
 
-    // ݂̃_[^[Qbgۑ
+    // 現在のレンダーターゲットを保存
     g_pContext->OMGetRenderTargets(1, &g_pOriginalRTV, &g_pOriginalDSV);
 
-    // ItXN[eNX`Ƀ_O؂ւ
+    // オフスクリーンテクスチャにレンダリング先を切り替え
     g_pContext->OMSetRenderTargets(1, &g_pSceneRTV, g_pOriginalDSV);
 
-    // NA
+    // クリア
     float clearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
     g_pContext->ClearRenderTargetView(g_pSceneRTV, clearColor);
 }
 
 //======================================
-// V[`I & |XgvZXKp
+// シーン描画終了 & ポストプロセス適用
 //======================================
 void PostProcess_EndScene()
 {
     if (!g_pContext || !g_pOriginalRTV) return;
 
-    // ̃_[^[QbgiobNobt@jɖ߂
+    // 元のレンダーターゲット（バックバッファ）に戻す
     g_pContext->OMSetRenderTargets(1, &g_pOriginalRTV, nullptr);
 
-    // [xeXg
+    // 深度テスト無効化
     Direct3D_DepthStencilStateDepthIsEnable(false);
 
-    // VF[_[ݒ
+    // シェーダー設定
     g_pContext->VSSetShader(g_pFullscreenVS, nullptr, 0);
     g_pContext->IASetInputLayout(nullptr);
     g_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-    // eNX`ݒ
+    // テクスチャ設定
     g_pContext->PSSetShaderResources(0, 1, &g_pSceneSRV);
     g_pContext->PSSetSamplers(0, 1, &g_pSamplerState);
 
-    // GtFNgɉVF[_[I
+    // エフェクトに応じたシェーダーを選択
     ID3D11PixelShader* pPS = g_pPassthroughPS;
 
     if (g_CurrentEffect == PostProcessEffect::RadialBlur && g_Intensity > 0.001f)
     {
         pPS = g_pRadialBlurPS;
 
-        // 萔obt@XV
+        // 定数バッファ更新
         D3D11_MAPPED_SUBRESOURCE mapped;
         g_pContext->Map(g_pConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
         PostProcessCB* cb = (PostProcessCB*)mapped.pData;
@@ -390,23 +390,23 @@ void PostProcess_EndScene()
 
     g_pContext->PSSetShader(pPS, nullptr, 0);
 
-    // tXN[Op``i_obt@svj
+    // フルスクリーン三角形描画（頂点バッファ不要）
     g_pContext->Draw(3, 0);
 
-    // VF[_[\[XNAit[̃_Ô߁j
+    // シェーダーリソースをクリア（次フレームのレンダリングのため）
     ID3D11ShaderResourceView* nullSRV = nullptr;
     g_pContext->PSSetShaderResources(0, 1, &nullSRV);
 
-    // ۑĂ\[X
+    // 保存していたリソースを解放
     SAFE_RELEASE(g_pOriginalRTV);
     SAFE_RELEASE(g_pOriginalDSV);
 
-    // [xeXgL
+    // 深度テスト有効化
     Direct3D_DepthStencilStateDepthIsEnable(true);
 }
 
 //======================================
-// GtFNg
+// エフェクト制御
 //======================================
 void PostProcess_StartRadialBlur(float intensity, float duration, bool fadeOut)
 {
@@ -427,7 +427,7 @@ void PostProcess_StartDirectionalBlur(const XMFLOAT2& direction, float intensity
     g_Timer = 0.0f;
     g_FadeOut = true;
 
-    // 𐳋K
+    // 方向を正規化
     XMVECTOR vDir = XMLoadFloat2(&direction);
     vDir = XMVector2Normalize(vDir);
     XMStoreFloat2(&g_BlurDirection, vDir);
@@ -448,24 +448,24 @@ void PostProcess_Update(float dt)
 
     if (g_Timer >= g_Duration)
     {
-        // GtFNgI
+        // エフェクト終了
         g_CurrentEffect = PostProcessEffect::None;
         g_Intensity = 0.0f;
         return;
     }
 
-    // tF[hAEg
+    // フェードアウト処理
     if (g_FadeOut)
     {
         float t = g_Timer / g_Duration;
-        // C[WOiŏ͋AXɎキj
+        // イージング（最初は強く、徐々に弱く）
         float easedT = 1.0f - (1.0f - t) * (1.0f - t);
         g_Intensity = g_InitialIntensity * (1.0f - easedT);
     }
 }
 
 //======================================
-// Ԏ擾
+// 状態取得
 //======================================
 bool PostProcess_IsActive()
 {
@@ -0,0 +1,40 @@
+﻿/****************************************
+ * @file prop_budget.cpp
+ * @brief 破片予算の削除対象選択の実装
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#include "prop_budget.h"
+#include <algorithm>
+
+//======================================
+// 公開関数
+//======================================
+bool PropBudget_IsOver(const PropBudget& budget, const PropBudgetStats& stats)
+{
+    return stats.activeBodies > budget.maxActiveBodies
+        || stats.triangles > budget.maxTriangles
+        || stats.gpuBytes > budget.maxGpuBytes;
+}
+
+void PropBudget_Evict(std::vector<PropBudgetCandidate>& candidates, const PropBudget& budget, PropBudgetStats& stats)
+{
+    if (!PropBudget_IsOver(budget, stats)) return;
+
+    // 同点はリスト順で決まるよう安定ソート
+    std::stable_sort(candidates.begin(), candidates.end(),
+        [](const PropBudgetCandidate& a, const PropBudgetCandidate& b) { return a.score > b.score; });
+
+    for (PropBudgetCandidate& candidate : candidates)
+    {
+        if (!PropBudget_IsOver(budget, stats)) break;
+
+        candidate.isEvicted = true;
+        stats.triangles -= candidate.triangles;
+        stats.gpuBytes -= candidate.gpuBytes;
+        if (candidate.isVisual) --stats.visualBodies;
+        else --stats.activeBodies;
+        ++stats.evictedCount;
+    }
+}
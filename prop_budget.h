@@ -0,0 +1,71 @@
+﻿/****************************************
+ * @file prop_budget.h
+ * @brief 破片予算の上限と、超過時の削除対象の選択
+ * @detail 集計とスコア付けは prop_manager が行い、ここではモデルや描画に依存しない選択だけを扱う
+ *         （ヘッドレスのストレステストから直接呼べるようにするため）
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#ifndef PROP_BUDGET_H
+#define PROP_BUDGET_H
+
+#include <cstddef>
+#include <vector>
+
+class PhysicsModel;
+
+/**
+ * @struct PropBudget
+ * @brief 切断で生成された破片（動的生成モデルを持つもの）の上限
+ * @detail 超えた場合は距離・経過時間・小ささのスコアが高い破片から削除する
+ */
+struct PropBudget
+{
+    int maxActiveBodies = 192;                      // 当たり判定を持つ剛体数（見た目だけの破片は含まない）
+    int maxTriangles = 150000;                      // 破片メッシュの総三角形数
+    size_t maxGpuBytes = 24u * 1024u * 1024u;       // 破片の頂点・インデックスバッファ総量
+};
+
+/**
+ * @struct PropBudgetStats
+ * @brief 直近の予算適用後の集計（ストレステストでの上限確認用）
+ */
+struct PropBudgetStats
+{
+    int activeBodies = 0;       // 当たり判定を持つプロップ数
+    int visualBodies = 0;       // 見た目だけに格下げされた破片数
+    int triangles = 0;          // 破片の総三角形数（格下げ分を含む）
+    size_t gpuBytes = 0;        // 破片の総GPUバッファ量（格下げ分を含む）
+    int downgradedCount = 0;    // 累計格下げ数
+    int evictedCount = 0;       // 累計削除数
+};
+
+/**
+ * @struct PropBudgetCandidate
+ * @brief 削除候補の破片1つ分（予算の対象となる動的生成モデルのみ）
+ */
+struct PropBudgetCandidate
+{
+    PhysicsModel* obj = nullptr;
+    float score = 0.0f;         // 大きいほど先に削除
+    int triangles = 0;
+    size_t gpuBytes = 0;
+    bool isVisual = false;      // 見た目だけの破片（剛体数に含めない）
+    bool isEvicted = false;     // PropBudget_Evict で削除対象になった
+};
+
+/**
+ * @brief 集計が上限のいずれかを超えているか
+ */
+bool PropBudget_IsOver(const PropBudget& budget, const PropBudgetStats& stats);
+
+/**
+ * @brief 上限を超えていれば、スコアの高い候補から上限に収まるまで削除対象にする
+ * @param candidates 削除候補（スコアの降順に並べ替え、削除対象の isEvicted を立てる）
+ * @param stats 候補以外のプロップも含めた現在の集計。削除した分を差し引き、evictedCount に加える
+ * @detail 候補をすべて削除しても収まらない場合（予算対象外のプロップだけで剛体数を超えるなど）は超過のまま返す
+ */
+void PropBudget_Evict(std::vector<PropBudgetCandidate>& candidates, const PropBudget& budget, PropBudgetStats& stats);
+
+#endif // PROP_BUDGET_H
@@ -5,6 +5,24 @@
  * @author Natsume Shidara
  * @date 2026/01/05
  * @update 2026/01/12 - 外部破片追加機能
+ * @update 2026/10/18 - 動的AABBツリーによるブロードフェーズ導入
+ * @update 2026/10/18 - 接触アイランド単位のスリープ
+ * @update 2026/10/18 - 永続接触マニフォールドとウォームスタート付き逐次インパルス
+ * @update 2026/10/18 - オブジェクト更新と接触生成の並列化
+ * @update 2026/10/18 - 高速移動する破片同士の連続衝突判定
+ * @update 2026/10/18 - 箱同士の接触を面クリッピングの複数点で生成
+ * @update 2026/10/18 - 衝突フィルター（レイヤー・マスク・切断グループ）をブロードフェーズで判定
+ * @update 2026/10/18 - 破片予算による格下げ・削除
+ * @update 2026/10/18 - 静止した破片をセル単位の静的メッシュへ焼き込み
+ * @update 2026/10/18 - 切断レイと境界ボックスの判定を8個ずつまとめて実行
+ * @update 2026/10/18 - 切断対象の探索をシーン問い合わせへ移行
+ * @update 2026/10/18 - 切断候補を刃の掃いた四角形で探し、平面がまたぐものだけ切断
+ * @update 2026/10/18 - 接触生成を形状の組み合わせで仕分け、球同士・球と箱はSoAでまとめて判定
+ * @update 2026/10/18 - 破片は切断ワーカーで当てはめた体積最小のコライダーで生成
+ * @update 2026/10/18 - 見た目だけの破片を SlotMap で管理
+ * @update 2026/10/18 - 焼き込んだ破片の接触相手を起こし、焼き込みを1ステップ1回にまとめる
+ * @update 2026/10/18 - マニフォールド更新の作業用配列を使い回す
+ * @update 2026/10/18 - 予算超過時の削除対象の選択を prop_budget へ分離
  ****************************************/
 
 #include "prop_manager.h"
@@ -13,16 +31,25 @@
 #include "model.h"
 #include "slicer.h"
 #include "slice_task_manager.h"
+#include "physics_job_system.h"
+#include "broadphase.h"
+#include "contact_solver.h"
 #include "collision.h"
+#include "collision_batch.h"
+#include "scene_query.h"
 #include "direct3d.h"
 #include "debug_renderer.h"
 #include "map.h"
 #include "texture.h"
+#include "static_debris.h"
+#include "slot_map.h"
 
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <array>
 #include <unordered_map>
+#include <thread>
 
 using namespace DirectX;
 
@@ -48,6 +75,11 @@ namespace PropConfig
 
     // 物理演算設定
     constexpr int COLLISION_ITERATIONS = 4;
+    constexpr int SLICE_WORKER_THREADS = 2;
+    constexpr int PHYSICS_WORKER_THREAD_MAX = 3;    // 物理ジョブのワーカー上限（メインスレッドも参加）
+    constexpr int PROP_UPDATE_BATCH_SIZE = 16;      // 地形・マップ補正の1ジョブあたりオブジェクト数
+    constexpr int NARROWPHASE_BATCH_SIZE = 32;      // 接触生成の1ジョブあたりペア数
+    constexpr float CCD_CONTACT_DEPTH = 0.02f;      // 衝突時刻へ戻す際に残すめり込み（接触を生成させる）
     constexpr float AUTO_DESTROY_THRESHOLD_RATIO = 0.75f;
     constexpr float AUTO_DESTROY_DELAY = 3.0f;
 
@@ -56,10 +88,22 @@ namespace PropConfig
     constexpr float SLICE_SEPARATION_SPEED = 2.0f;
     constexpr float SLICE_TORQUE_STRENGTH = 5.0f;
     constexpr float SLICE_IMMUNITY_TIME = 0.5f;
-    constexpr float SLICE_PLANE_THRESHOLD = 0.001f;
+    constexpr float SLICE_STRADDLE_MARGIN = 0.01f;  // 切断後の各片に残る最小の厚み（境界ボックス基準）
     constexpr float MIN_OBJECT_MASS = 0.1f;
     constexpr float MIN_VOLUME = 0.0001f;
 
+    // 破片予算：削除スコア = 距離 / DISTANCE_SCALE + 経過時間 / AGE_SCALE + (1 - 半径 / SIZE_SCALE)
+    constexpr float EVICT_DISTANCE_SCALE = 30.0f;
+    constexpr float EVICT_AGE_SCALE = 10.0f;
+    constexpr float EVICT_SIZE_SCALE = 1.0f;
+    constexpr float EVICT_VISUAL_BONUS = 10.0f;     // 見た目だけの破片は当たり判定を持つものより先に消す
+
+    // 破片予算：小さく遠く、ほぼ静止した破片は当たり判定を外して見た目だけにする
+    constexpr float LOD_MAX_RADIUS = 0.25f;
+    constexpr float LOD_MIN_DISTANCE = 20.0f;
+    constexpr float LOD_MAX_SPEED = 0.5f;
+    constexpr float LOD_VISUAL_LIFETIME = 4.0f;     // 格下げ後、縮小しながら消えるまでの時間
+
     // モデル設定
     constexpr const char* MODEL_PATH = "assets/fbx/Pallone/Ball.fbx";
     constexpr const char* MODEL_PATH2 = "assets/fbx/BOX.fbx";
@@ -78,10 +122,47 @@ namespace PropConfig
 namespace
 {
     std::vector<PhysicsModel*> g_Props;             // アクティブなオブジェクト
-    int g_NextGenerationId = 1;                     // 衝突判定グループID
+    int g_NextCollisionGroup = 1;                   // 切断グループID（同じ切断の破片同士は一定時間衝突しない）
+    Broadphase g_Broadphase;                        // オブジェクト間の衝突候補ペア管理
+    std::vector<ContactManifold> g_Manifolds;       // 接触中ペアのマニフォールド（ペア順にソート済み）
+    std::vector<ContactManifold*> g_ActiveManifolds; // 今ステップで解くマニフォールド（作業用）
+    std::vector<ContactManifold> g_NextManifolds;   // 更新後のマニフォールド（作業用、g_Manifolds と入れ替えて容量を使い回す）
+    ContactSolver g_ContactSolver;
+
+    // 接触生成の作業用（スレッド別に書き出し、ペア順に併合）
+    struct NarrowphaseContact
+    {
+        int manifoldIndex;
+        bool isClipped;         // true: contacts で全点を置換 / false: hit を1点追加
+        Hit hit;
+        ContactSet contacts;
+    };
+    std::array<std::vector<int>, static_cast<size_t>(CollisionPairKind::Count)> g_NarrowphaseTargets; // 組み合わせ別の判定するマニフォールドの添字
+    std::vector<std::vector<NarrowphaseContact>> g_ThreadContacts;  // スレッド別の接触バッファ
+    std::vector<NarrowphaseContact> g_MergedContacts;
+
+    // 連続衝突判定の作業用（proxyIdで索引、移動量に対する衝突時刻）
+    std::vector<float> g_ContinuousTimes;
+
+    // 接触アイランド構築用（proxyIdで索引）
+    std::vector<int> g_IslandParent;
+    std::vector<char> g_IslandAwake;
+    std::vector<char> g_IslandCanSleep;
+    std::vector<char> g_IslandSupported;
+
+    // 焼き込み用：今ステップで静的メッシュへ結合した破片（作業用）
+    std::vector<PhysicsModel*> g_BakedProps;
 
     // 非同期処理用：スライス計算中の削除待ちオブジェクト
     std::unordered_map<int, PhysicsModel*> g_PendingDeleteObjects;
+
+    // 破片予算
+    SlotMap<PhysicsModel*> g_VisualProps;           // 当たり判定を外した見た目だけの破片（並び順に意味はない）
+    PropBudget g_Budget;
+    PropBudgetStats g_BudgetStats;
+    XMFLOAT3 g_ViewPosition = { 0.0f, 0.0f, 0.0f };
+
+    std::vector<PropBudgetCandidate> g_BudgetCandidates; // 作業用
 }
 
 //======================================
@@ -123,6 +204,89 @@ namespace
         model->SetRootVolume(volume);
     }
 
+    /**
+     * @brief オブジェクトを管理リスト・ブロードフェーズ・シーン問い合わせへ登録
+     */
+    void RegisterProp(PhysicsModel* obj)
+    {
+        obj->GetRigidBody()->SetIslandSleepEnabled(true);
+
+        const AABB aabb = obj->GetRigidBody()->GetTransformedAABB();
+        const CollisionFilter filter = obj->GetCollisionFilter();
+        int proxyId = g_Broadphase.CreateProxy(aabb, obj, filter);
+        obj->SetBroadphaseProxy(proxyId);
+        obj->SetSceneProxy(SceneQuery_CreateProxy(SceneObjectType::Prop, obj, aabb, filter.layer));
+        g_Props.push_back(obj);
+    }
+
+    /**
+     * @brief ブロードフェーズとシーン問い合わせから登録解除（管理リストからの除外は呼び出し側）
+     * @detail 接触相手は支えが変わるため起こす
+     */
+    void UnregisterProp(PhysicsModel* obj)
+    {
+        SceneQuery_DestroyProxy(obj->GetSceneProxy());
+        obj->SetSceneProxy(-1);
+
+        const int proxyId = obj->GetBroadphaseProxy();
+        if (proxyId < 0) return;
+
+        // 支えを失う接触相手を起こしてから接触ペアを除去
+        g_Manifolds.erase(std::remove_if(g_Manifolds.begin(), g_Manifolds.end(), [proxyId](const ContactManifold& manifold)
+        {
+            if (manifold.proxyA != proxyId && manifold.proxyB != proxyId) return false;
+
+            RigidBody* other = (manifold.proxyA == proxyId) ? manifold.bodyB : manifold.bodyA;
+            other->WakeUp();
+            return true;
+        }), g_Manifolds.end());
+
+        g_Broadphase.DestroyProxy(proxyId);
+        obj->SetBroadphaseProxy(-1);
+    }
+
+    /**
+     * @brief 移動したオブジェクトのAABBと衝突フィルターの変化をブロードフェーズへ反映
+     */
+    void UpdateBroadphaseProxies(float dt)
+    {
+        for (PhysicsModel* obj : g_Props)
+        {
+            RigidBody* rb = obj->GetRigidBody();
+
+            // 衝突無視時間が過ぎた破片はグループを外し、兄弟破片とのペアを作り直させる
+            if (rb->GetCollisionGroup() != 0 && rb->GetIgnoreCollisionTimer() <= 0.0f)
+            {
+                rb->SetCollisionGroup(0);
+                g_Broadphase.SetProxyFilter(obj->GetBroadphaseProxy(), rb->GetCollisionFilter());
+            }
+
+            if (rb->IsSleeping()) continue;
+
+            const XMFLOAT3& vel = rb->GetVelocity();
+            XMFLOAT3 displacement = { vel.x * dt, vel.y * dt, vel.z * dt };
+            AABB aabb = rb->GetTransformedAABB();
+
+            // 連続衝突判定の対象は今ステップの移動範囲全体を登録（すり抜けた相手もペアに入れる）
+            Sphere sweepStart;
+            XMFLOAT3 sweepDisplacement;
+            if (rb->GetContinuousSweep(sweepStart, sweepDisplacement))
+            {
+                aabb.min.x = std::min(aabb.min.x, aabb.min.x - sweepDisplacement.x);
+                aabb.min.y = std::min(aabb.min.y, aabb.min.y - sweepDisplacement.y);
+                aabb.min.z = std::min(aabb.min.z, aabb.min.z - sweepDisplacement.z);
+                aabb.max.x = std::max(aabb.max.x, aabb.max.x - sweepDisplacement.x);
+                aabb.max.y = std::max(aabb.max.y, aabb.max.y - sweepDisplacement.y);
+                aabb.max.z = std::max(aabb.max.z, aabb.max.z - sweepDisplacement.z);
+            }
+
+            g_Broadphase.MoveProxy(obj->GetBroadphaseProxy(), aabb, displacement);
+            SceneQuery_MoveProxy(obj->GetSceneProxy(), rb->GetTransformedAABB());
+        }
+
+        g_Broadphase.UpdatePairs();
+    }
+
     /**
      * @brief 指定モデルをグリッド状に整列して生成
      */
@@ -147,7 +311,7 @@ namespace
 
                     auto* actor = new PhysicsModel(rawModel, position, XMFLOAT3(0.0f, 0.0f, 0.0f), TEST_OBJECT_MASS, ColliderType::Sphere);
                     InitializeRootVolume(actor);
-                    g_Props.push_back(actor);
+                    RegisterProp(actor);
                 }
             }
         }
@@ -168,50 +332,387 @@ namespace
         }
 
         InitializeRootVolume(actor);
-        g_Props.push_back(actor);
+        RegisterProp(actor);
+    }
+
+    RigidBody* GetProxyBody(int proxyId)
+    {
+        return static_cast<PhysicsModel*>(g_Broadphase.GetUserData(proxyId))->GetRigidBody();
     }
 
     /**
-     * @brief オブジェクト間の衝突を多重反復で解決
+     * @brief 高速移動体を含む候補ペアをスイープし、最初の衝突時刻まで両者を戻す
+     * @detail 内接球同士の衝突時刻をペアごとに求め、剛体ごとに最小の時刻を採用する。
+     *         わずかにめり込ませた位置に戻すため、続く接触生成で通常の接触として解決される
+     *         ペア順に逐次処理するため結果は決定的
      */
-    void ResolveCollisions()
+    void ApplyContinuousCollisions()
     {
-        for (int iter = 0; iter < PropConfig::COLLISION_ITERATIONS; ++iter)
+        int maxProxyId = -1;
+        for (PhysicsModel* obj : g_Props)
         {
-            for (size_t i = 0; i < g_Props.size(); ++i)
+            maxProxyId = std::max(maxProxyId, obj->GetBroadphaseProxy());
+        }
+        g_ContinuousTimes.assign(maxProxyId + 1, 1.0f);
+
+        bool isRewindNeeded = false;
+        for (const BroadphasePair& pair : g_Broadphase.GetPairs())
+        {
+            RigidBody* rbA = GetProxyBody(pair.proxyA);
+            RigidBody* rbB = GetProxyBody(pair.proxyB);
+
+            Sphere sphereA, sphereB;
+            XMFLOAT3 displacementA, displacementB;
+            const bool isFastA = rbA->GetContinuousSweep(sphereA, displacementA);
+            const bool isFastB = rbB->GetContinuousSweep(sphereB, displacementB);
+            if (!isFastA && !isFastB) continue;
+            if (!RigidBody::CanCollide(rbA, rbB)) continue;
+
+            // 低速側も同じ時刻の位置で判定する
+            if (!isFastA && !rbA->GetSweepSphere(sphereA, displacementA)) continue;
+            if (!isFastB && !rbB->GetSweepSphere(sphereB, displacementB)) continue;
+
+            SweepHit hit = Collision_SweepSphereSphere(sphereA, displacementA, sphereB, displacementB);
+            if (!hit.isHit || hit.time <= 0.0f) continue;
+
+            // 接触を生成できるよう相対移動方向へ少し進めた時刻を採用
+            XMVECTOR relative = XMLoadFloat3(&displacementA) - XMLoadFloat3(&displacementB);
+            const float relativeDistance = XMVectorGetX(XMVector3Length(relative));
+            const float time = std::min(hit.time + PropConfig::CCD_CONTACT_DEPTH / relativeDistance, 1.0f);
+            if (time >= 1.0f) continue;
+
+            g_ContinuousTimes[pair.proxyA] = std::min(g_ContinuousTimes[pair.proxyA], time);
+            g_ContinuousTimes[pair.proxyB] = std::min(g_ContinuousTimes[pair.proxyB], time);
+            isRewindNeeded = true;
+        }
+
+        if (!isRewindNeeded) return;
+
+        for (PhysicsModel* obj : g_Props)
+        {
+            const float time = g_ContinuousTimes[obj->GetBroadphaseProxy()];
+            if (time < 1.0f)
+            {
+                obj->GetRigidBody()->RewindToTime(time);
+            }
+        }
+    }
+
+    /**
+     * @brief 同じ組み合わせのペアをまとめて接触判定し、結果をバッファへ追加
+     * @param indices マニフォールドの添字（すべて kind の組み合わせ）
+     * @detail 球同士・球と箱は WIDTH 組ずつ SoA のバッチで判定し、
+     *         箱同士は面クリッピング、その他は Collision_Detect で1組ずつ判定する
+     */
+    void DetectContacts(CollisionPairKind kind, std::vector<ContactManifold>& manifolds,
+        const int* indices, int count, std::vector<NarrowphaseContact>& buffer)
+    {
+        SpherePairBatch sphereBatch;
+        SphereOBBPairBatch obbBatch;
+        int lanes[CollisionPacketConfig::WIDTH];
+        Hit laneHits[CollisionPacketConfig::WIDTH];
+        const bool isBatched = (kind == CollisionPairKind::SphereSphere ||
+                                kind == CollisionPairKind::SphereBox ||
+                                kind == CollisionPairKind::BoxSphere);
+
+        // 溜まったバッチを判定して、当たったレーンを添字順のまま書き出す
+        auto flush = [&]() {
+            const int laneCount = (kind == CollisionPairKind::SphereSphere) ? sphereBatch.count : obbBatch.count;
+            if (laneCount == 0) return;
+
+            const uint32_t mask = (kind == CollisionPairKind::SphereSphere)
+                ? Collision_DetectSpherePairBatch(sphereBatch, laneHits)
+                : Collision_DetectSphereOBBPairBatch(obbBatch, laneHits);
+
+            for (int lane = 0; lane < laneCount; ++lane)
+            {
+                if ((mask & (1u << lane)) == 0) continue;
+
+                Hit& hit = laneHits[lane];
+                if (kind == CollisionPairKind::BoxSphere)
+                {
+                    // 球を A として判定しているので、法線を B→A に戻す
+                    hit.normal = { -hit.normal.x, -hit.normal.y, -hit.normal.z };
+                }
+                buffer.push_back({ lanes[lane], false, hit, {} });
+            }
+            sphereBatch.Clear();
+            obbBatch.Clear();
+        };
+
+        for (int i = 0; i < count; ++i)
+        {
+            const int index = indices[i];
+            ContactManifold& manifold = manifolds[index];
+            manifold.Refresh();
+
+            const RigidBody* rbA = manifold.bodyA;
+            const RigidBody* rbB = manifold.bodyB;
+            if (!Collision_IsOverlapAABB(rbA->GetTransformedAABB(), rbB->GetTransformedAABB())) continue;
+
+            const Collider colA = rbA->GetWorldCollider();
+            const Collider colB = rbB->GetWorldCollider();
+
+            if (isBatched)
+            {
+                const int lane = (kind == CollisionPairKind::SphereSphere) ? sphereBatch.count : obbBatch.count;
+                lanes[lane] = index;
+                switch (kind)
+                {
+                case CollisionPairKind::SphereSphere: sphereBatch.Push(colA.sphere, colB.sphere); break;
+                case CollisionPairKind::SphereBox:    obbBatch.Push(colA.sphere, colB.obb); break;
+                default:                              obbBatch.Push(colB.sphere, colA.obb); break;
+                }
+                if (sphereBatch.IsFull() || obbBatch.IsFull())
+                {
+                    flush();
+                }
+                continue;
+            }
+
+            // 箱同士は面クリッピングで1ステップに最大4点を得る（辺接触の1点は従来どおり蓄積）
+            Hit hit;
+            if (kind == CollisionPairKind::BoxBox)
             {
-                for (size_t j = i + 1; j < g_Props.size(); ++j)
+                ContactSet contacts = Collision_ClipOBBOBB(colA.obb, colB.obb);
+                if (contacts.count > 1)
+                {
+                    buffer.push_back({ index, true, {}, contacts });
+                    continue;
+                }
+                if (contacts.count == 1)
                 {
-                    RigidBody::SolveCollision(
-                        g_Props[i]->GetRigidBody(),
-                        g_Props[j]->GetRigidBody()
-                    );
+                    hit.isHit = true;
+                    hit.normal = contacts.normal;
+                    hit.depth = contacts.depths[0];
+                    hit.contactPoint = contacts.points[0];
                 }
             }
+            else
+            {
+                hit = Collision_Detect(colA, colB);
+            }
+
+            if (hit.isHit)
+            {
+                buffer.push_back({ index, false, hit, {} });
+            }
+        }
+
+        if (isBatched)
+        {
+            flush();
         }
     }
 
     /**
-     * @brief 2つのレイから切断平面の法線を算出
+     * @brief 候補ペアの接触判定を行い、マニフォールドを更新
+     * @detail 前回のマニフォールド（蓄積インパルス含む）を引き継ぐ。双方スリープ中のペアは判定しない
+     *         判定は並列に行い、スレッド別バッファの結果をペア順に併合するためスレッド数に依存しない
      */
-    bool CalculateSlicePlaneNormal(const Ray& startRay, const Ray& endRay, XMFLOAT3& outNormal)
+    void UpdateContactManifolds()
     {
-        using namespace PropConfig;
+        std::vector<ContactManifold>& manifolds = g_NextManifolds;
+        manifolds.clear();
+        manifolds.reserve(g_Manifolds.size());
+        for (auto& targets : g_NarrowphaseTargets)
+        {
+            targets.clear();
+        }
+
+        // ペアリストとマニフォールドは同じ順でソート済みなので並走して照合
+        auto cached = g_Manifolds.begin();
+
+        for (const BroadphasePair& pair : g_Broadphase.GetPairs())
+        {
+            while (cached != g_Manifolds.end() &&
+                   (cached->proxyA < pair.proxyA || (cached->proxyA == pair.proxyA && cached->proxyB < pair.proxyB)))
+            {
+                ++cached;
+            }
+            const bool hasCache = (cached != g_Manifolds.end() && cached->proxyA == pair.proxyA && cached->proxyB == pair.proxyB);
+
+            RigidBody* rbA = GetProxyBody(pair.proxyA);
+            RigidBody* rbB = GetProxyBody(pair.proxyB);
+
+            if (!RigidBody::CanCollide(rbA, rbB)) continue;
+
+            if (rbA->IsSleeping() && rbB->IsSleeping())
+            {
+                if (hasCache)
+                {
+                    manifolds.push_back(*cached);
+                }
+                continue;
+            }
 
-        XMFLOAT3 startDir = startRay.GetDirection();
-        XMFLOAT3 endDir = endRay.GetDirection();
+            ContactManifold manifold = hasCache ? *cached : ContactManifold();
+            manifold.proxyA = pair.proxyA;
+            manifold.proxyB = pair.proxyB;
+            manifold.bodyA = rbA;
+            manifold.bodyB = rbB;
 
-        XMVECTOR vStartDir = XMLoadFloat3(&startDir);
-        XMVECTOR vEndDir = XMLoadFloat3(&endDir);
-        XMVECTOR vPlaneNormal = XMVector3Normalize(XMVector3Cross(vStartDir, vEndDir));
+            const CollisionPairKind kind = Collision_ClassifyPair(rbA->GetLocalCollider(), rbB->GetLocalCollider());
+            g_NarrowphaseTargets[static_cast<size_t>(kind)].push_back(static_cast<int>(manifolds.size()));
+            manifolds.push_back(manifold);
+        }
 
-        if (XMVectorGetX(XMVector3LengthSq(vPlaneNormal)) <= SLICE_PLANE_THRESHOLD)
+        // 並列判定：各マニフォールドは1つのバッチからしか触られない
+        g_ThreadContacts.resize(PhysicsJobSystem::GetThreadCount());
+        for (auto& buffer : g_ThreadContacts)
         {
-            return false;
+            buffer.clear();
         }
 
-        XMStoreFloat3(&outNormal, vPlaneNormal);
-        return true;
+        // 組み合わせごとに分けて判定（同じ組み合わせが連続するので分岐とキャッシュが安定する）
+        for (size_t kind = 0; kind < g_NarrowphaseTargets.size(); ++kind)
+        {
+            const std::vector<int>& targets = g_NarrowphaseTargets[kind];
+            if (targets.empty()) continue;
+
+            PhysicsJobSystem::ParallelFor(static_cast<int>(targets.size()), PropConfig::NARROWPHASE_BATCH_SIZE,
+                [&manifolds, &targets, kind](int begin, int end, int threadIndex) {
+                    DetectContacts(static_cast<CollisionPairKind>(kind), manifolds, targets.data() + begin, end - begin,
+                        g_ThreadContacts[threadIndex]);
+                });
+        }
+
+        // 併合：同一ペアの接触は1スレッド内で連続しているため、安定ソートで生成順も保たれる
+        //       （組み合わせ別に判定しても、ペア順に並べ直すので結果はスレッド数にも仕分けにも依存しない）
+        g_MergedContacts.clear();
+        for (const auto& buffer : g_ThreadContacts)
+        {
+            g_MergedContacts.insert(g_MergedContacts.end(), buffer.begin(), buffer.end());
+        }
+        std::stable_sort(g_MergedContacts.begin(), g_MergedContacts.end(),
+            [](const NarrowphaseContact& a, const NarrowphaseContact& b) { return a.manifoldIndex < b.manifoldIndex; });
+
+        for (const NarrowphaseContact& contact : g_MergedContacts)
+        {
+            if (contact.isClipped)
+            {
+                manifolds[contact.manifoldIndex].SetContacts(contact.contacts);
+            }
+            else
+            {
+                manifolds[contact.manifoldIndex].AddContact(contact.hit);
+            }
+        }
+
+        // 接触点の無くなったペアを除外（ペア順は維持）
+        manifolds.erase(std::remove_if(manifolds.begin(), manifolds.end(),
+            [](const ContactManifold& manifold) { return manifold.pointCount == 0; }), manifolds.end());
+
+        g_Manifolds.swap(manifolds);
+    }
+
+    int FindIslandRoot(int proxyId)
+    {
+        while (g_IslandParent[proxyId] != proxyId)
+        {
+            g_IslandParent[proxyId] = g_IslandParent[g_IslandParent[proxyId]];
+            proxyId = g_IslandParent[proxyId];
+        }
+        return proxyId;
+    }
+
+    /**
+     * @brief 接触グラフからアイランドを構築し、アイランド単位でスリープ・起床を判定
+     * @detail 全員が静止していればアイランドごと眠らせ、一人でも動いていれば全員を起こす
+     */
+    void UpdateIslands()
+    {
+        int maxProxyId = -1;
+        for (PhysicsModel* obj : g_Props)
+        {
+            maxProxyId = std::max(maxProxyId, obj->GetBroadphaseProxy());
+        }
+        if (maxProxyId < 0) return;
+
+        const size_t size = static_cast<size_t>(maxProxyId) + 1;
+        g_IslandParent.resize(size);
+        g_IslandAwake.assign(size, 0);
+        g_IslandCanSleep.assign(size, 1);
+        g_IslandSupported.assign(size, 0);
+
+        for (PhysicsModel* obj : g_Props)
+        {
+            int proxyId = obj->GetBroadphaseProxy();
+            g_IslandParent[proxyId] = proxyId;
+        }
+
+        // 接触ペアで連結（Union-Find）
+        for (const ContactManifold& manifold : g_Manifolds)
+        {
+            if (manifold.bodyA->GetParams().isKinematic || manifold.bodyB->GetParams().isKinematic) continue;
+
+            int rootA = FindIslandRoot(manifold.proxyA);
+            int rootB = FindIslandRoot(manifold.proxyB);
+            if (rootA != rootB)
+            {
+                // 小さいIDを根にして結果を一意にする
+                if (rootA < rootB) g_IslandParent[rootB] = rootA;
+                else g_IslandParent[rootA] = rootB;
+            }
+        }
+
+        // アイランドごとの状態を集計
+        for (PhysicsModel* obj : g_Props)
+        {
+            const RigidBody* rb = obj->GetRigidBody();
+            int root = FindIslandRoot(obj->GetBroadphaseProxy());
+
+            if (!rb->IsSleeping()) g_IslandAwake[root] = 1;
+            if (!rb->IsSleeping() && !rb->IsReadyToSleep()) g_IslandCanSleep[root] = 0;
+            if (rb->IsSleeping() || rb->HasGroundContact()) g_IslandSupported[root] = 1;
+        }
+
+        // アイランド単位でスリープ・起床
+        for (PhysicsModel* obj : g_Props)
+        {
+            RigidBody* rb = obj->GetRigidBody();
+            int root = FindIslandRoot(obj->GetBroadphaseProxy());
+
+            if (!g_IslandAwake[root]) continue;
+
+            if (g_IslandCanSleep[root] && g_IslandSupported[root])
+            {
+                if (!rb->IsSleeping()) rb->Sleep();
+            }
+            else if (rb->IsSleeping())
+            {
+                rb->WakeUp();
+            }
+        }
+    }
+
+    /**
+     * @brief オブジェクト間の衝突を逐次インパルスで解決
+     * @detail 接触中かつ起きているアイランドのマニフォールドのみ解決する
+     */
+    void ResolveCollisions(float dt)
+    {
+        ApplyContinuousCollisions();
+        UpdateContactManifolds();
+        UpdateIslands();
+
+        g_ActiveManifolds.clear();
+        for (ContactManifold& manifold : g_Manifolds)
+        {
+            // 眠っているアイランド内のペアは解決しない
+            if (manifold.bodyA->IsSleeping() && manifold.bodyB->IsSleeping()) continue;
+            g_ActiveManifolds.push_back(&manifold);
+        }
+        if (g_ActiveManifolds.empty()) return;
+
+        g_ContactSolver.Begin(g_ActiveManifolds, dt);
+        for (int iter = 0; iter < PropConfig::COLLISION_ITERATIONS; ++iter)
+        {
+            g_ContactSolver.SolveVelocities();
+        }
+        g_ContactSolver.StoreVelocities();
+        g_ContactSolver.SolvePositions();
+        g_ContactSolver.End();
     }
 
     struct SeparationParams
@@ -252,14 +753,15 @@ namespace
         const std::vector<MeshData>& meshes,
         MODEL* originalModel,
         const SeparationParams& params,
-        const ColliderType& colliderType,
+        const Collider& collider,
         const XMFLOAT3& planeNormal,
         float originalMass,
         float oldVolume,
         float rootVolume,
-        int generationId,
+        int collisionGroup,
         bool isFrontSide,
-        float lifeTime = -1.0f)
+        float lifeTime = -1.0f,
+        uint32_t collisionLayer = CollisionLayer::Debris)
     {
         using namespace PropConfig;
 
@@ -267,7 +769,7 @@ namespace
         MODEL* newModel = ModelCreateFromData(meshes, originalModel);
         if (!newModel) return nullptr;
 
-        auto* newObject = new PhysicsModel(newModel, params.position, params.velocity, originalMass, colliderType);
+        auto* newObject = new PhysicsModel(newModel, collider, params.position, params.velocity, originalMass);
         RigidBody* rb = newObject->GetRigidBody();
 
         // 基底体積の継承
@@ -279,6 +781,7 @@ namespace
 
         RigidBody::Params params_rb = rb->GetParams();
         params_rb.mass = newMass;
+        params_rb.useContinuousCollision = true;    // 斬撃で弾かれた破片は高速になりうる
         rb->SetParams(params_rb);
 
         // 寿命設定
@@ -297,8 +800,9 @@ namespace
             }
         }
 
-        // 親子・破片間の衝突無視設定
-        rb->SetGenerationId(generationId);
+        // 衝突レイヤーと、兄弟破片との一定時間の衝突無視（タイマー切れで UpdateBroadphaseProxies が解除）
+        rb->SetCollisionLayer(collisionLayer, CollisionLayer::All);
+        rb->SetCollisionGroup(collisionGroup);
         rb->SetIgnoreCollisionTimer(SLICE_IMMUNITY_TIME);
 
         // 切断方向への回転トルクを付与
@@ -349,7 +853,7 @@ namespace
 
         // 元の体積を計算（質量分布の基準）
         float oldVolume = std::max(MIN_VOLUME, MIN_VOLUME);
-        int generationId = g_NextGenerationId++;
+        int collisionGroup = PropManager_AllocateCollisionGroup();
 
         // 切断平面法線（リクエスト時のものを使用）
         XMFLOAT3 planeNormal = result.planeNormal;
@@ -361,12 +865,12 @@ namespace
             result.frontMeshes,
             result.originalModel,
             frontParams,
-            result.colliderType,
+            result.frontCollider,
             planeNormal,
             result.originalMass,
             oldVolume,
             result.rootVolume,
-            generationId,
+            collisionGroup,
             true
         );
 
@@ -377,17 +881,17 @@ namespace
             result.backMeshes,
             result.originalModel,
             backParams,
-            result.colliderType,
+            result.backCollider,
             planeNormal,
             result.originalMass,
             oldVolume,
             result.rootVolume,
-            generationId,
+            collisionGroup,
             false
         );
 
-        if (frontObj) g_Props.push_back(frontObj);
-        if (backObj) g_Props.push_back(backObj);
+        if (frontObj) RegisterProp(frontObj);
+        if (backObj) RegisterProp(backObj);
 
         ModelRelease(result.originalModel);
 
@@ -399,6 +903,165 @@ namespace
             g_PendingDeleteObjects.erase(it);
         }
     }
+
+    /**
+     * @brief 予算の対象となる破片か（ファイル由来の共有モデルは対象外）
+     */
+    bool IsBudgetedModel(const MODEL* model)
+    {
+        return model && model->resourceKey.empty();
+    }
+
+    /**
+     * @brief モデルの三角形数とGPUバッファ量（CPU側メッシュから算出）
+     */
+    void GetModelCost(const MODEL* model, int& outTriangles, size_t& outGpuBytes)
+    {
+        outTriangles = 0;
+        outGpuBytes = 0;
+        for (const MeshData& mesh : model->Meshes)
+        {
+            outTriangles += static_cast<int>(mesh.indices.size() / 3);
+            outGpuBytes += mesh.vertices.size() * sizeof(Vertex) + mesh.indices.size() * sizeof(unsigned int);
+        }
+    }
+
+    float GetBoundingRadius(const RigidBody* rb)
+    {
+        const AABB aabb = rb->GetTransformedAABB();
+        const XMFLOAT3 size = aabb.GetSize();
+        return 0.5f * std::sqrt(size.x * size.x + size.y * size.y + size.z * size.z);
+    }
+
+    float GetViewDistance(const RigidBody* rb)
+    {
+        const XMFLOAT3 pos = rb->GetPosition();
+        return XMVectorGetX(XMVector3Length(XMVectorSubtract(XMLoadFloat3(&pos), XMLoadFloat3(&g_ViewPosition))));
+    }
+
+    /**
+     * @brief 小さく遠い静止気味の破片を見た目だけへ格下げ（ブロードフェーズから外し、縮小して消える）
+     * @return 格下げした場合 true（呼び出し側で g_Props から外す）
+     */
+    bool TryDowngradeToVisual(PhysicsModel* obj)
+    {
+        using namespace PropConfig;
+
+        if (!IsBudgetedModel(obj->GetModel())) return false;
+
+        const RigidBody* rb = obj->GetRigidBody();
+        if (GetBoundingRadius(rb) > LOD_MAX_RADIUS) return false;
+        if (GetViewDistance(rb) < LOD_MIN_DISTANCE) return false;
+
+        const XMFLOAT3 vel = rb->GetVelocity();
+        if (XMVectorGetX(XMVector3LengthSq(XMLoadFloat3(&vel))) > LOD_MAX_SPEED * LOD_MAX_SPEED) return false;
+
+        UnregisterProp(obj);
+        obj->SetVisualOnly();
+
+        const float lifeTimer = obj->GetAutoDestroyTimer();
+        if (lifeTimer <= 0.0f || lifeTimer > LOD_VISUAL_LIFETIME)
+        {
+            obj->SetAutoDestroyTimer(LOD_VISUAL_LIFETIME);
+        }
+
+        g_VisualProps.Insert(obj);
+        ++g_BudgetStats.downgradedCount;
+        return true;
+    }
+
+    /**
+     * @brief 一定時間眠り続けた破片を静的メッシュへ焼き込み、剛体とモデルを解放
+     * @detail 寿命付き（縮小して消える）破片とファイル由来の共有モデルは対象外。
+     *         先に焼き込む破片をすべて選んでから登録解除するため、起こされた隣の破片も同じステップで焼き込める
+     */
+    void BakeSettledDebris()
+    {
+        g_BakedProps.clear();
+        g_Props.erase(std::remove_if(g_Props.begin(), g_Props.end(), [](PhysicsModel* obj)
+        {
+            if (obj->IsDead() || obj->GetAutoDestroyTimer() > 0.0f) return false;
+            if (!IsBudgetedModel(obj->GetModel())) return false;
+            if (obj->GetSleepTime() < StaticDebrisConfig::SETTLE_TIME) return false;
+            if (!StaticDebris_Bake(*obj)) return false;
+
+            g_BakedProps.push_back(obj);
+            return true;
+        }), g_Props.end());
+
+        if (g_BakedProps.empty()) return;
+
+        // 接触相手は焼き込んだ当たり判定の上で接触を作り直すまで起こしておく
+        for (PhysicsModel* obj : g_BakedProps)
+        {
+            UnregisterProp(obj);
+            delete obj;
+        }
+        g_BakedProps.clear();
+
+        // チャンクのGPUバッファ更新とマップ登録をまとめて1回（次ステップの判定から静的物体として扱われる）
+        StaticDebris_Update();
+    }
+
+    /**
+     * @brief 破片予算を適用
+     * @detail 1. 小さく遠い破片を見た目だけへ格下げ
+     *         2. 剛体数・三角形数・GPUバッファ量のいずれかが上限を超えていれば、スコアの高い破片から削除対象にする
+     *         削除対象は MarkDead し、直後の寿命管理でまとめて解放する
+     */
+    void EnforceDebrisBudget()
+    {
+        using namespace PropConfig;
+
+        g_Props.erase(std::remove_if(g_Props.begin(), g_Props.end(), [](PhysicsModel* obj)
+        {
+            return !obj->IsDead() && TryDowngradeToVisual(obj);
+        }), g_Props.end());
+
+        // 集計と削除スコアの算出
+        int activeBodies = 0;
+        int visualBodies = 0;
+        int triangles = 0;
+        size_t gpuBytes = 0;
+        g_BudgetCandidates.clear();
+
+        auto addCandidate = [&](PhysicsModel* obj, bool isVisual)
+        {
+            if (obj->IsDead()) return;
+            if (isVisual) ++visualBodies;
+            else ++activeBodies;
+            if (!IsBudgetedModel(obj->GetModel())) return;
+
+            PropBudgetCandidate candidate;
+            candidate.obj = obj;
+            candidate.isVisual = isVisual;
+            GetModelCost(obj->GetModel(), candidate.triangles, candidate.gpuBytes);
+
+            const RigidBody* rb = obj->GetRigidBody();
+            candidate.score = GetViewDistance(rb) / EVICT_DISTANCE_SCALE
+                + obj->GetAge() / EVICT_AGE_SCALE
+                + (1.0f - std::min(GetBoundingRadius(rb) / EVICT_SIZE_SCALE, 1.0f))
+                + (isVisual ? EVICT_VISUAL_BONUS : 0.0f);
+
+            triangles += candidate.triangles;
+            gpuBytes += candidate.gpuBytes;
+            g_BudgetCandidates.push_back(candidate);
+        };
+
+        for (PhysicsModel* obj : g_Props) addCandidate(obj, false);
+        for (PhysicsModel* obj : g_VisualProps) addCandidate(obj, true);
+
+        g_BudgetStats.activeBodies = activeBodies;
+        g_BudgetStats.visualBodies = visualBodies;
+        g_BudgetStats.triangles = triangles;
+        g_BudgetStats.gpuBytes = gpuBytes;
+
+        PropBudget_Evict(g_BudgetCandidates, g_Budget, g_BudgetStats);
+        for (const PropBudgetCandidate& candidate : g_BudgetCandidates)
+        {
+            if (candidate.isEvicted) candidate.obj->MarkDead();
+        }
+    }
 }
 
 //======================================
@@ -410,7 +1073,12 @@ void PropManager_Initialize()
     using namespace PropConfig;
 
     // 非同期タスクマネージャの起動
-    SliceTaskManager::Initialize(2);
+    SliceTaskManager::Initialize(SLICE_WORKER_THREADS);
+    StaticDebris_Initialize();
+
+    // 物理ジョブの起動（メインスレッドとスライスワーカーの分を論理コア数から差し引く）
+    const int hardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+    PhysicsJobSystem::Initialize(std::clamp(hardwareThreads - 1 - SLICE_WORKER_THREADS, 0, PHYSICS_WORKER_THREAD_MAX));
 
     // ダミーモデルロード（削除不可）
     // ※このModelLoad呼び出しを削除すると、敵の切断処理やコンボ表示に
@@ -432,12 +1100,26 @@ void PropManager_Initialize()
 void PropManager_Finalize()
 {
     SliceTaskManager::Finalize();
+    PhysicsJobSystem::Finalize();
 
     for (auto obj : g_Props)
     {
         delete obj;
     }
     g_Props.clear();
+    for (auto obj : g_VisualProps)
+    {
+        delete obj;
+    }
+    g_VisualProps.Clear();
+    g_BudgetCandidates.clear();
+    g_BudgetStats = PropBudgetStats();
+    StaticDebris_Finalize();
+    g_Broadphase.Clear();
+    g_Manifolds.clear();
+    g_NextManifolds.clear();
+    g_ActiveManifolds.clear();
+    g_ThreadContacts.clear();
 
     for (auto& pair : g_PendingDeleteObjects)
     {
@@ -453,16 +1135,35 @@ void PropManager_Update(double elapsed_time)
     while (SliceTaskManager::TryGetCompletedResult(result))
     {
         ProcessCompletedSlice(result);
+        SliceTaskManager::NotifyFinalized(result);
     }
 
-    // オブジェクトの更新と寿命管理
+    // オブジェクトの更新（寿命・地形・マップ補正は自身の剛体しか触らないため並列に行う）
+    PhysicsJobSystem::ParallelFor(static_cast<int>(g_Props.size()), PropConfig::PROP_UPDATE_BATCH_SIZE,
+        [elapsed_time](int begin, int end, int) {
+            for (int i = begin; i < end; ++i)
+            {
+                g_Props[i]->Update(elapsed_time);
+            }
+        });
+
+    // 見た目だけの破片は寿命と縮小演出のみ
+    for (PhysicsModel* obj : g_VisualProps)
+    {
+        obj->Update(elapsed_time);
+    }
+
+    // 予算超過分の格下げ・削除対象の決定
+    EnforceDebrisBudget();
+
+    // 寿命管理
     for (auto it = g_Props.begin(); it != g_Props.end();)
     {
         PhysicsModel* obj = *it;
-        obj->Update(elapsed_time);
 
         if (obj->IsDead())
         {
+            UnregisterProp(obj);
             delete obj;
             it = g_Props.erase(it);
         }
@@ -472,8 +1173,19 @@ void PropManager_Update(double elapsed_time)
         }
     }
 
+    g_VisualProps.RemoveIf([](PhysicsModel* obj)
+    {
+        if (!obj->IsDead()) return false;
+        delete obj;
+        return true;
+    });
+
+    // 静止した破片は静的メッシュへまとめ、個別の剛体・描画をなくす
+    BakeSettledDebris();
+
     // 物理衝突解決
-    ResolveCollisions();
+    UpdateBroadphaseProxies(static_cast<float>(elapsed_time));
+    ResolveCollisions(static_cast<float>(elapsed_time));
 }
 
 void PropManager_Draw()
@@ -482,15 +1194,26 @@ void PropManager_Draw()
     {
         obj->Draw();
     }
+    for (auto obj : g_VisualProps)
+    {
+        obj->Draw();
+    }
+    StaticDebris_Draw();
 }
 
 void PropManager_DrawShadow()
 {
     for (auto obj : g_Props)
     {
-        XMFLOAT4X4 matWorld = obj->GetRigidBody()->GetWorldMatrix(XMFLOAT3(1.0f, 1.0f, 1.0f));
+        XMFLOAT4X4 matWorld = obj->GetRigidBody()->GetRenderWorldMatrix(XMFLOAT3(1.0f, 1.0f, 1.0f));
+        ModelDrawShadow(obj->GetModel(), XMLoadFloat4x4(&matWorld));
+    }
+    for (auto obj : g_VisualProps)
+    {
+        XMFLOAT4X4 matWorld = obj->GetRigidBody()->GetRenderWorldMatrix(obj->GetScale());
         ModelDrawShadow(obj->GetModel(), XMLoadFloat4x4(&matWorld));
     }
+    StaticDebris_DrawShadow();
 }
 
 void PropManager_DrawDebug()
@@ -520,50 +1243,51 @@ void PropManager_DrawDebug()
     }
 }
 
-void PropManager_TrySlice(const Ray& startRay, const Ray& endRay)
+void PropManager_TrySlice(const SliceSweep& sweep)
 {
-    XMFLOAT3 planeNormal;
-    if (!CalculateSlicePlaneNormal(startRay, endRay, planeNormal))
-    {
-        return;
-    }
+    using namespace PropConfig;
 
-    for (auto it = g_Props.begin(); it != g_Props.end();)
-    {
-        PhysicsModel* obj = *it;
+    // 刃の掃いた四角形と重なる破片をシーン問い合わせで集める
+    static std::vector<SceneQueryHit> hits;
+    SceneQuery_OverlapQuad(sweep.corners,
+        SceneQueryFilter(CollisionLayer::Debris | CollisionLayer::EnemyPiece, SceneObjectType::Prop), hits);
 
-        if (!obj->GetModel())
-        {
-            ++it;
-            continue;
-        }
+    if (hits.empty()) return;
 
-        // 境界ボリュームによる早期棄却
-        RigidBody* rb = obj->GetRigidBody();
-        XMFLOAT3 pos = rb->GetPosition();
-        AABB worldAABB = Model_GetAABB(obj->GetModel(), pos);
+    static std::vector<PhysicsModel*> slicedProps;
+    slicedProps.clear();
+
+    for (const SceneQueryHit& hit : hits)
+    {
+        PhysicsModel* obj = static_cast<PhysicsModel*>(hit.userData);
+        if (!obj->GetModel()) continue;
 
-        float hitDist = 0.0f;
-        if (!Collision_IntersectRayAABB(endRay, worldAABB, &hitDist))
+        // 平面がメッシュの境界をまたがなければ切断しても2つに分かれない
+        if (!Collision_IsOBBStraddlingPlane(obj->GetMeshBounds(), sweep.planePoint, sweep.planeNormal, SLICE_STRADDLE_MARGIN))
         {
-            ++it;
             continue;
         }
 
-        // ヒット位置を特定
-        XMFLOAT3 rayOrigin = endRay.GetOrigin();
-        XMFLOAT3 rayDir = endRay.GetDirection();
-        XMVECTOR vHitPos = XMLoadFloat3(&rayOrigin) + XMLoadFloat3(&rayDir) * hitDist;
-        XMFLOAT3 hitPos;
-        XMStoreFloat3(&hitPos, vHitPos);
-
         // スライス計算を別スレッドへ委譲
-        int requestId = SubmitSliceRequest(obj, hitPos, planeNormal);
+        int requestId = SubmitSliceRequest(obj, sweep.planePoint, sweep.planeNormal);
 
         // メインの更新・描画リストから外し、計算完了まで待機リストで保持
+        UnregisterProp(obj);
         g_PendingDeleteObjects[requestId] = obj;
-        it = g_Props.erase(it);
+        slicedProps.push_back(obj);
     }
+
+    if (slicedProps.empty()) return;
+
+    g_Props.erase(std::remove_if(g_Props.begin(), g_Props.end(), [](PhysicsModel* obj)
+    {
+        return std::find(slicedProps.begin(), slicedProps.end(), obj) != slicedProps.end();
+    }), g_Props.end());
+}
+
+int PropManager_AllocateCollisionGroup()
+{
+    return g_NextCollisionGroup++;
 }
 
 void PropManager_AddSlicedPiece(const SlicedPieceParams& params)
@@ -580,24 +1304,45 @@ void PropManager_AddSlicedPiece(const SlicedPieceParams& params)
     sepParams.position = params.position;
     sepParams.velocity = params.velocity;
 
-    int generationId = g_NextGenerationId++;
+    int collisionGroup = (params.collisionGroup != 0) ? params.collisionGroup : PropManager_AllocateCollisionGroup();
 
     PhysicsModel* newObj = CreateSlicedObjectFromMeshes(
         params.meshes,
         params.originalModel,
         sepParams,
-        params.colliderType,
+        params.collider,
         params.planeNormal,
         params.mass,
         std::max(params.rootVolume, MIN_VOLUME),
         params.rootVolume,
-        generationId,
+        collisionGroup,
         params.isFrontSide,
-        params.lifeTime
+        params.lifeTime,
+        params.collisionLayer
     );
 
     if (newObj)
     {
-        g_Props.push_back(newObj);
+        RegisterProp(newObj);
     }
-}
\ No newline at end of file
+}
+
+void PropManager_SetBudget(const PropBudget& budget)
+{
+    g_Budget = budget;
+}
+
+const PropBudget& PropManager_GetBudget()
+{
+    return g_Budget;
+}
+
+const PropBudgetStats& PropManager_GetBudgetStats()
+{
+    return g_BudgetStats;
+}
+
+void PropManager_SetViewPosition(const XMFLOAT3& position)
+{
+    g_ViewPosition = position;
+}
@@ -1,9 +1,13 @@
 /****************************************
  * @file prop_manager.h
- * @brief IIuWFNg(vbv)̊ǗNX
+ * @brief 動的オブジェクト(プロップ)の管理クラス
  * @author NatsumeShidara
  * @update 2025/12/16
- * @update 2026/01/12 - O̔jВǉ@\
+ * @update 2026/01/12 - 外部からの破片追加機能
+ * @update 2026/10/18 - 破片の衝突レイヤー指定
+ * @update 2026/10/18 - 破片予算（剛体数・三角形数・GPUメモリ）と格下げ・削除
+ * @update 2026/10/18 - 破片は当てはめ済みのコライダーを受け取る
+ * @update 2026/10/18 - 予算の構造体を prop_budget.h へ移動
  ****************************************/
 
 #ifndef PROP_MANAGER_H
@@ -12,11 +16,13 @@
 #include "ray.h"
 #include "model.h"
 #include "collider.h"
+#include "slicer.h"
+#include "prop_budget.h"
 #include <DirectXMath.h>
 #include <vector>
 
  //======================================
- // jВǉpp[^
+ // 破片追加用パラメータ
  //======================================
 struct SlicedPieceParams
 {
@@ -27,13 +33,15 @@ struct SlicedPieceParams
     DirectX::XMFLOAT3 planeNormal;
     float mass;
     float rootVolume;
-    float lifeTime;          // ł܂ł̎ԁi-1Ŗj
-    ColliderType colliderType;
+    float lifeTime;          // 消滅までの時間（-1で無限）
+    Collider collider;       // 当てはめ済みのコライダー（モデル空間）
     bool isFrontSide;
+    uint32_t collisionLayer = CollisionLayer::Debris;   // 敵の残骸は EnemyPiece
+    int collisionGroup = 0;  // 同じ切断の破片で共有する衝突グループ（0なら破片ごとに新規割り当て）
 };
 
 //======================================
-// vbvǗ֐Q
+// プロップ管理関数群
 //======================================
 
 void PropManager_Initialize();
@@ -44,15 +52,34 @@ void PropManager_DrawShadow();
 void PropManager_DrawDebug();
 
 /**
- * @brief IuWFNg̐ؒf݂
+ * @brief 刃の掃いた範囲にある破片の切断を試みる
+ * @detail 四角形と重なり、かつ平面がメッシュの境界をまたぐ破片のみ切断ジョブへ回す
  */
-void PropManager_TrySlice(const Ray& startRay, const Ray& endRay);
+void PropManager_TrySlice(const SliceSweep& sweep);
 
 /**
- * @brief OؒfjЂǉ
- * @param params jЂ̃p[^
- * @detail G̐ؒfȂǂɌĂяoāAc[PropƂēo^
+ * @brief 外部から切断破片を追加する
+ * @param params 破片のパラメータ
+ * @detail 敵の切断後などに呼び出して、残骸をPropとして登録する
  */
 void PropManager_AddSlicedPiece(const SlicedPieceParams& params);
 
+/**
+ * @brief 切断グループIDを新規に割り当てる
+ * @detail 1回の切断で出る破片すべてに同じIDを渡すと、分離直後の破片同士が衝突しない
+ */
+int PropManager_AllocateCollisionGroup();
+
+/**
+ * @brief 破片予算の設定・取得
+ */
+void PropManager_SetBudget(const PropBudget& budget);
+const PropBudget& PropManager_GetBudget();
+const PropBudgetStats& PropManager_GetBudgetStats();
+
+/**
+ * @brief 削除スコア・格下げ判定に使う視点位置（カメラ位置）を設定
+ */
+void PropManager_SetViewPosition(const DirectX::XMFLOAT3& position);
+
 #endif // PROP_MANAGER_H
\ No newline at end of file
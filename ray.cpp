@@ -1,81 +1,68 @@
 /****************************************
  * @file ray.cpp
- * @brief Cij̎
+ * @brief レイ（光線）の実装
  * @author Natsume Shidara
  * @date 2025/12/05
  * @update 2025/12/05
  ****************************************/
 
 #include "ray.h"
-#include "direct3d.h" // Direct3D_ScreenToWorldgp邽
+#include "direct3d.h" // Direct3D_ScreenToWorldを使用するため
 #include <cmath>
 
 using namespace DirectX;
 
 //======================================
-// RXgN^
-//======================================
-Ray::Ray()
-    : m_origin(0.0f, 0.0f, 0.0f), m_direction(0.0f, 0.0f, 1.0f)
-{
-}
-
-Ray::Ray(const XMFLOAT3& origin, const XMFLOAT3& direction)
-    : m_origin(origin), m_direction(direction)
-{
-}
-
-//======================================
-// t@Ng\bh
+// ファクトリメソッド
 //======================================
 Ray Ray::CreateFromScreen(float screenX, float screenY, const XMFLOAT4X4& view, const XMFLOAT4X4& proj)
 {
-    // XN[WNear(0.0f)Far(1.0f)̃[hWZo
+    // スクリーン座標からNear平面(0.0f)とFar平面(1.0f)のワールド座標を算出
     XMFLOAT3 nearPos = Direct3D_ScreenToWorld(static_cast <int>(screenX), static_cast <int>(screenY), 0.0f, view, proj);
     XMFLOAT3 farPos = Direct3D_ScreenToWorld(static_cast <int>(screenX), static_cast <int>(screenY), 1.0f, view, proj);
 
-    // xNgZo (Far - Near)
+    // 方向ベクトル算出 (Far - Near)
     XMVECTOR vNear = XMLoadFloat3(&nearPos);
     XMVECTOR vFar = XMLoadFloat3(&farPos);
     XMVECTOR vDir = vFar - vNear;
 
-    // K
+    // 正規化
     vDir = XMVector3Normalize(vDir);
 
     XMFLOAT3 dir;
     XMStoreFloat3(&dir, vDir);
 
-    // n_Nearʂ̈ʒuƂ
+    // 始点はNear平面の位置とする
     return Ray(nearPos, dir);
 }
 
 //======================================
-// EvZ֐
+// 判定・計算関数
 //======================================
 bool Ray::IntersectsFloor(XMFLOAT3* outHitPos, float floorY) const
 {
-    // C̕xNgY
+    // レイの方向ベクトルのY成分
     float dirY = m_direction.y;
 
-    // 덷΍FCقڐ̏ꍇ͌ȂƂ݂Ȃ
+    // 誤差対策：レイがほぼ水平の場合は交差なしとみなす
     if (std::abs(dirY) < 0.0001f)
     {
         return false;
     }
 
-    // ̍
+    // 高さの差分
     float heightDiff = floorY - m_origin.y;
 
-    // 䗦itjvZ: t = (TargetY - OriginY) / DirY
+    // 距離比率（t）を計算: t = (TargetY - OriginY) / DirY
     float t = heightDiff / dirY;
 
-    // t < 0 ̏ꍇ̓C̐is̋tiwjɂ邽ߌȂƂ݂Ȃ
+    // t < 0 の場合はレイの進行方向の逆（背後）にあるため交差しないとみなす
     if (t < 0.0f)
     {
         return false;
     }
 
-    // _ = Origin + Dir * t
+    // 交差点 = Origin + Dir * t
     XMVECTOR vOrigin = XMLoadFloat3(&m_origin);
     XMVECTOR vDir = XMLoadFloat3(&m_direction);
     XMVECTOR vHit = vOrigin + vDir * t;
@@ -1,9 +1,10 @@
 /****************************************
  * @file ray.h
- * @brief Cij̒`ƏՓ˔
+ * @brief レイ（光線）の定義と衝突判定
  * @author Natsume Shidara
  * @date 2025/12/05
  * @update 2025/12/05
+ * @update 2026/10/18 - コンストラクタをヘッダーへ移動（direct3d に依存せず使えるように）
  ****************************************/
 
 #ifndef RAY_H
@@ -12,58 +13,59 @@
 #include <DirectXMath.h>
 
  //--------------------------------------
- // NX錾
+ // クラス宣言
  //--------------------------------------
  /****************************************
   * @class Ray
-  * @brief 3ԏ̔iCjǗNX
+  * @brief 3次元空間上の半直線（レイ）を管理するクラス
   *
-  * n_ƕxNgAXN[W̃C
-  * ʁinʁjƂ̌s@\񋟂B
+  * 始点と方向ベクトルを持ち、スクリーン座標からのレイ生成や
+  * 平面（地面）との交差判定を行う機能を提供する。
   ****************************************/
 class Ray {
 private:
     //--------------------------------------
-    // oϐQ
+    // メンバ変数群
     //--------------------------------------
-    DirectX::XMFLOAT3 m_origin;    // n_
-    DirectX::XMFLOAT3 m_direction; // iKςݒPʃxNgj
+    DirectX::XMFLOAT3 m_origin;    // 始点
+    DirectX::XMFLOAT3 m_direction; // 方向（正規化済み単位ベクトル）
 
 public:
     //======================================
-    // RXgN^
+    // コンストラクタ
     //======================================
-    Ray();
-    Ray(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction);
+    // 判定関数だけを使うコード（物理のテストなど）が描画側に依存しないようヘッダーで定義
+    Ray() : m_origin(0.0f, 0.0f, 0.0f), m_direction(0.0f, 0.0f, 1.0f) {}
+    Ray(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction) : m_origin(origin), m_direction(direction) {}
 
     //======================================
-    // t@Ng\bhi⏕j
+    // ファクトリメソッド（生成補助）
     //======================================
     /**
-     * @brief XN[W烏[hԂւ̃C쐬
-     * @param screenX }EX̃XN[XW
-     * @param screenY }EX̃XN[YW
-     * @param view r[s
-     * @param proj vWFNVs
-     * @return ꂽRayIuWFNg
+     * @brief スクリーン座標からワールド空間へのレイを作成する
+     * @param screenX マウス等のスクリーンX座標
+     * @param screenY マウス等のスクリーンY座標
+     * @param view ビュー行列
+     * @param proj プロジェクション行列
+     * @return 生成されたRayオブジェクト
      */
     static Ray CreateFromScreen(float screenX, float screenY, const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& proj);
 
     //======================================
-    // EvZ֐
+    // 判定・計算関数
     //======================================
     /**
-     * @brief ̍iYʁjƂ̌_vZ
-     * @param[out] outHitPos ʒui[ϐ̃|C^
-     * @param floorY ʂ̍iftHg0.0fj
-     * @return ꍇtrueAsȂǂŌȂꍇfalse
+     * @brief 特定の高さ（Y平面）との交差点を計算する
+     * @param[out] outHitPos 交差位置を格納する変数のポインタ
+     * @param floorY 平面の高さ（デフォルトは0.0f）
+     * @return 交差した場合はtrue、平行などで交差しない場合はfalse
      * @detail
-     * Cw肵YW̕ʂƌʒuvZB
-     * Cɋ߂ꍇAʂC̔wɂꍇfalseԂB
+     * レイが指定したY座標の平面と交わる位置を計算する。
+     * レイが水平に近い場合や、平面がレイの背後にある場合はfalseを返す。
      */
     bool IntersectsFloor(DirectX::XMFLOAT3* outHitPos, float floorY = 0.0f) const;
 
-    // Qb^[
+    // ゲッター
     DirectX::XMFLOAT3 GetOrigin() const { return m_origin; }
     DirectX::XMFLOAT3 GetDirection() const { return m_direction; }
 };
@@ -1,37 +1,37 @@
 /****************************************
  * @file result.h
- * @brief Ug
+ * @brief リザルト画面
  * @author Natsume Shidara
  * @date 2025/08/19
- * @update 2026/01/12 - ̋@ANVQ[pɉ
+ * @update 2026/01/12 - 立体機動アクションゲーム用に改造
  ****************************************/
 
 #ifndef RESULT_H
 #define RESULT_H
 
  /**
-  * @brief Ugʏ
+  * @brief リザルト画面初期化
   */
 void Result_Initialize();
 
 /**
- * @brief UgʏI
+ * @brief リザルト画面終了処理
  */
 void Result_Finalize();
 
 /**
- * @brief UgʍXV
- * @param elapsed_time f^^C
+ * @brief リザルト画面更新
+ * @param elapsed_time デルタタイム
  */
 void Result_Update(double elapsed_time);
 
 /**
- * @brief Ugʕ`
+ * @brief リザルト画面描画
  */
 void Result_Draw();
 
 /**
- * @brief Ugʂ̃VhE`ij
+ * @brief リザルト画面のシャドウ描画（空実装）
  */
 void Result_DrawShadow();
 
@@ -3,13 +3,21 @@
  * @brief 物理挙動コンポーネント
  * @author Natsume Shidara
  * @update 2026/01/06 - リファクタリング
+ * @update 2026/10/18 - 状態をRigidBodyStoreへ移行（積分はストア側で一括）
+ * @update 2026/10/18 - 描画補間
+ * @update 2026/10/18 - 連続衝突判定用のスイープ取得
+ * @update 2026/10/18 - 凸包コライダー対応
+ * @update 2026/10/18 - 衝突可否を衝突フィルターで判定
+ * @update 2026/10/18 - ContactSolver へ移行済みの旧インパルス解決を削除
  ****************************************/
 
 #include "rigid_body.h"
 #include "collision.h"
+#include "fixed_step.h"
 #include <cmath>
 #include <algorithm>
 #include <cfloat>
+#include <utility>
 
 using namespace DirectX;
 
@@ -28,40 +36,64 @@ namespace {
     {
         return (value > RigidBody::MIN_MASS) ? 1.0f / value : 0.0f;
     }
+
+    bool IsFrozen(RigidbodyConstraints constraints, RigidbodyConstraints axis)
+    {
+        return (constraints & axis) != RigidbodyConstraints::None;
+    }
 }
 
 //======================================
-// コンストラクタ
+// コンストラクタ・デストラクタ
 //======================================
 RigidBody::RigidBody()
-    : m_Params()
-    , m_Position{ 0.0f, 0.0f, 0.0f }
-    , m_Rotation()
-    , m_Velocity{ 0.0f, 0.0f, 0.0f }
-    , m_AngularVelocity{ 0.0f, 0.0f, 0.0f }
-    , m_ForceAccum{ 0.0f, 0.0f, 0.0f }
-    , m_TorqueAccum{ 0.0f, 0.0f, 0.0f }
+    : m_Handle(RigidBodyStore::Create())
+    , m_Params()
     , m_LocalCollider()
     , m_LocalAABB()
-    , m_WorldMatrix()
-    , m_InvInertiaTensorLocal()
-    , m_InvInertiaTensorWorld()
     , m_Constraints(RigidbodyConstraints::None)
-    , m_IsSleeping(false)
-    , m_SleepTimer(0.0f)
-    , m_HasGroundContact(false)
-    , m_GenerationId(0)
-    , m_IgnoreCollisionTimer(0.0f)
+    , m_Filter()
 {
-    XMStoreFloat4(&m_Rotation, XMQuaternionIdentity());
-    XMStoreFloat4x4(&m_WorldMatrix, XMMatrixIdentity());
-    XMStoreFloat3x3(&m_InvInertiaTensorLocal, XMMatrixIdentity());
-    XMStoreFloat3x3(&m_InvInertiaTensorWorld, XMMatrixIdentity());
-
     m_LocalCollider.type = ColliderType::Sphere;
     m_LocalCollider.sphere.center = { 0.0f, 0.0f, 0.0f };
     m_LocalCollider.sphere.radius = 0.5f;
     m_LocalAABB = { { -0.5f, -0.5f, -0.5f }, { 0.5f, 0.5f, 0.5f } };
+
+    SyncParamsToStore();
+}
+
+RigidBody::~RigidBody()
+{
+    if (m_Handle >= 0)
+    {
+        RigidBodyStore::Destroy(m_Handle);
+    }
+}
+
+RigidBody::RigidBody(RigidBody&& other) noexcept
+    : m_Handle(other.m_Handle)
+    , m_Params(other.m_Params)
+    , m_LocalCollider(other.m_LocalCollider)
+    , m_LocalAABB(other.m_LocalAABB)
+    , m_Constraints(other.m_Constraints)
+    , m_Filter(other.m_Filter)
+{
+    other.m_Handle = -1;
+}
+
+RigidBody& RigidBody::operator=(RigidBody&& other) noexcept
+{
+    if (this != &other)
+    {
+        // 自分のスロットは相手のデストラクタで解放される
+        std::swap(m_Handle, other.m_Handle);
+        m_Params = other.m_Params;
+        m_LocalCollider = other.m_LocalCollider;
+        m_LocalAABB = other.m_LocalAABB;
+        m_Constraints = other.m_Constraints;
+        m_Filter = other.m_Filter;
+    }
+    return *this;
 }
 
 //======================================
@@ -69,19 +101,26 @@ RigidBody::RigidBody()
 //======================================
 void RigidBody::Initialize(const XMFLOAT3& pos, const Collider& collider, float mass)
 {
-    m_Position = pos;
+    RigidBodySoA& s = RigidBodyStore::GetData();
+
+    s.SetPosition(m_Handle, pos);
     m_LocalCollider = collider;
     m_Params.mass = std::max(mass, MIN_MASS);
 
     // OBBの場合：向きを初期回転に、ローカルは回転なしに
     if (collider.type == ColliderType::Box)
     {
-        m_Rotation = collider.obb.orientation;
+        s.SetRotation(m_Handle, collider.obb.orientation);
         XMStoreFloat4(&m_LocalCollider.obb.orientation, XMQuaternionIdentity());
     }
+    else if (collider.type == ColliderType::ConvexHull)
+    {
+        s.SetRotation(m_Handle, collider.hull.orientation);
+        XMStoreFloat4(&m_LocalCollider.hull.orientation, XMQuaternionIdentity());
+    }
     else
     {
-        XMStoreFloat4(&m_Rotation, XMQuaternionIdentity());
+        s.SetRotation(m_Handle, { 0.0f, 0.0f, 0.0f, 1.0f });
     }
 
     ResetVelocity();
@@ -118,406 +157,72 @@ void RigidBody::Initialize(const XMFLOAT3& pos, const Collider& collider, float
         XMStoreFloat3(&m_LocalAABB.min, vMin);
         XMStoreFloat3(&m_LocalAABB.max, vMax);
     }
-
-    // 慣性テンソルの計算
-    float Ixx = 0.0f, Iyy = 0.0f, Izz = 0.0f;
-    XMFLOAT3 offset = { 0.0f, 0.0f, 0.0f };
-
-    if (collider.type == ColliderType::Sphere)
-    {
-        offset = collider.sphere.center;
-        const float r = std::max(collider.sphere.radius, 0.01f);
-        const float I = (2.0f / 5.0f) * m_Params.mass * r * r;
-        Ixx = Iyy = Izz = I;
-    }
-    else if (collider.type == ColliderType::Box)
+    else if (collider.type == ColliderType::ConvexHull)
     {
-        offset = collider.obb.center;
-        const float w = std::max(collider.obb.extents.x * 2.0f, 0.01f);
-        const float h = std::max(collider.obb.extents.y * 2.0f, 0.01f);
-        const float d = std::max(collider.obb.extents.z * 2.0f, 0.01f);
-        const float coef = m_Params.mass / 12.0f;
-        Ixx = coef * (h * h + d * d);
-        Iyy = coef * (w * w + d * d);
-        Izz = coef * (w * w + h * h);
+        m_LocalAABB = m_LocalCollider.GetBoundingBox();
     }
 
-    // 平行軸の定理
-    const float offsetLenSq = offset.x * offset.x + offset.y * offset.y + offset.z * offset.z;
-    if (offsetLenSq > 1e-6f)
-    {
-        Ixx += m_Params.mass * (offset.y * offset.y + offset.z * offset.z);
-        Iyy += m_Params.mass * (offset.x * offset.x + offset.z * offset.z);
-        Izz += m_Params.mass * (offset.x * offset.x + offset.y * offset.y);
-    }
-
-    const float minInertia = MIN_INERTIA_FACTOR * m_Params.mass;
-    Ixx = std::max(Ixx, minInertia);
-    Iyy = std::max(Iyy, minInertia);
-    Izz = std::max(Izz, minInertia);
-
-    XMMATRIX invInertia = XMMatrixIdentity();
-    invInertia.r[0] = XMVectorSet(1.0f / Ixx, 0.0f, 0.0f, 0.0f);
-    invInertia.r[1] = XMVectorSet(0.0f, 1.0f / Iyy, 0.0f, 0.0f);
-    invInertia.r[2] = XMVectorSet(0.0f, 0.0f, 1.0f / Izz, 0.0f);
-    XMStoreFloat3x3(&m_InvInertiaTensorLocal, invInertia);
-
-    UpdateWorldMatrix();
+    SyncParamsToStore();
     UpdateInertiaTensor();
-}
-
-//======================================
-// 物理更新
-//======================================
-void RigidBody::Integrate(float dt)
-{
-    if (dt <= 0.0f) return;
-    dt = std::min(dt, MAX_DELTA_TIME);
 
-    if (m_IgnoreCollisionTimer > 0.0f)
-    {
-        m_IgnoreCollisionTimer = std::max(m_IgnoreCollisionTimer - dt, 0.0f);
-    }
-
-    if (m_Params.isKinematic || m_IsSleeping)
-    {
-        m_ForceAccum = { 0.0f, 0.0f, 0.0f };
-        m_TorqueAccum = { 0.0f, 0.0f, 0.0f };
-        m_HasGroundContact = false;
-        return;
-    }
-
-    ApplyConstraintsToForces();
-
-    // 重力適用
-    if (m_Params.useGravity)
-    {
-        XMVECTOR vGravity = XMLoadFloat3(&m_Params.gravity);
-        XMVECTOR vForce = XMVectorScale(vGravity, m_Params.mass);
-        XMVECTOR vAccum = XMLoadFloat3(&m_ForceAccum);
-        XMStoreFloat3(&m_ForceAccum, XMVectorAdd(vAccum, vForce));
-    }
-
-    XMVECTOR vPos = XMLoadFloat3(&m_Position);
-    XMVECTOR qRot = XMLoadFloat4(&m_Rotation);
-    XMVECTOR vVel = XMLoadFloat3(&m_Velocity);
-    XMVECTOR vAngVel = XMLoadFloat3(&m_AngularVelocity);
-    XMVECTOR vForce = XMLoadFloat3(&m_ForceAccum);
-    XMVECTOR vTorque = XMLoadFloat3(&m_TorqueAccum);
-
-    // 加速度計算
-    const float invMass = SafeInverse(m_Params.mass);
-    XMVECTOR vAcc = XMVectorScale(vForce, invMass);
-
-    XMMATRIX R = XMMatrixRotationQuaternion(qRot);
-    XMMATRIX invILocal = XMLoadFloat3x3(&m_InvInertiaTensorLocal);
-    XMMATRIX invInertiaWorld = XMMatrixMultiply(XMMatrixMultiply(R, invILocal), XMMatrixTranspose(R));
-    XMVECTOR vAngAcc = XMVector3TransformNormal(vTorque, invInertiaWorld);
-
-    // 速度更新
-    vVel = XMVectorAdd(vVel, XMVectorScale(vAcc, dt));
-    vAngVel = XMVectorAdd(vAngVel, XMVectorScale(vAngAcc, dt));
-
-    // 減衰
-    const float linearDamp = std::exp(-m_Params.linearDrag * dt);
-    const float angularDamp = std::exp(-m_Params.angularDrag * dt);
-    vVel = XMVectorScale(vVel, linearDamp);
-    vAngVel = XMVectorScale(vAngVel, angularDamp);
-
-    // 微小速度カット（接地時のみ線形速度をカット）
-    float velLenSq = XMVectorGetX(XMVector3LengthSq(vVel));
-    float angVelLenSq = XMVectorGetX(XMVector3LengthSq(vAngVel));
-
-    if (m_HasGroundContact && velLenSq < VELOCITY_CUTOFF)
-    {
-        vVel = XMVectorZero();
-    }
-    if (angVelLenSq < VELOCITY_CUTOFF)
-    {
-        vAngVel = XMVectorZero();
-    }
-
-    // 速度制限
-    vVel = ClampMagnitude(vVel, m_Params.maxLinearVelocity);
-    vAngVel = ClampMagnitude(vAngVel, m_Params.maxAngularVelocity);
-
-    ApplyConstraintsToVelocities(vVel, vAngVel);
-
-    // 位置・回転更新
-    vPos = XMVectorAdd(vPos, XMVectorScale(vVel, dt));
-    qRot = UpdateRotation(qRot, vAngVel, dt);
-
-    XMStoreFloat3(&m_Position, vPos);
-    XMStoreFloat4(&m_Rotation, qRot);
-    XMStoreFloat3(&m_Velocity, vVel);
-    XMStoreFloat3(&m_AngularVelocity, vAngVel);
-
-    UpdateWorldMatrix();
-    UpdateInertiaTensor();
-    CheckSleepState(dt);
-
-    m_ForceAccum = { 0.0f, 0.0f, 0.0f };
-    m_TorqueAccum = { 0.0f, 0.0f, 0.0f };
-    m_HasGroundContact = false;  // 毎フレームリセット
-}
-
-//======================================
-// 回転更新
-//======================================
-XMVECTOR RigidBody::UpdateRotation(XMVECTOR qRot, XMVECTOR vAngVel, float dt) const
-{
-    float angVelLenSq = XMVectorGetX(XMVector3LengthSq(vAngVel));
-    if (angVelLenSq > 1e-8f)
-    {
-        float angVelLen = std::sqrt(angVelLenSq);
-        float theta = std::min(angVelLen * dt, MAX_ROTATION_PER_FRAME);
-        XMVECTOR vAxis = XMVectorScale(vAngVel, 1.0f / angVelLen);
-        XMVECTOR qDelta = XMQuaternionRotationAxis(vAxis, theta);
-        qRot = XMQuaternionNormalize(XMQuaternionMultiply(qDelta, qRot));
-    }
-    return qRot;
-}
-
-//======================================
-// 拘束条件
-//======================================
-void RigidBody::ApplyConstraintsToForces()
-{
-    if ((m_Constraints & RigidbodyConstraints::FreezePositionX) != RigidbodyConstraints::None)
-        m_ForceAccum.x = 0.0f;
-    if ((m_Constraints & RigidbodyConstraints::FreezePositionY) != RigidbodyConstraints::None)
-        m_ForceAccum.y = 0.0f;
-    if ((m_Constraints & RigidbodyConstraints::FreezePositionZ) != RigidbodyConstraints::None)
-        m_ForceAccum.z = 0.0f;
-    if ((m_Constraints & RigidbodyConstraints::FreezeRotationX) != RigidbodyConstraints::None)
-        m_TorqueAccum.x = 0.0f;
-    if ((m_Constraints & RigidbodyConstraints::FreezeRotationY) != RigidbodyConstraints::None)
-        m_TorqueAccum.y = 0.0f;
-    if ((m_Constraints & RigidbodyConstraints::FreezeRotationZ) != RigidbodyConstraints::None)
-        m_TorqueAccum.z = 0.0f;
-}
-
-void RigidBody::ApplyConstraintsToVelocities(XMVECTOR& vVel, XMVECTOR& vAngVel)
-{
-    XMFLOAT3 fVel, fAngVel;
-    XMStoreFloat3(&fVel, vVel);
-    XMStoreFloat3(&fAngVel, vAngVel);
-
-    if ((m_Constraints & RigidbodyConstraints::FreezePositionX) != RigidbodyConstraints::None) fVel.x = 0.0f;
-    if ((m_Constraints & RigidbodyConstraints::FreezePositionY) != RigidbodyConstraints::None) fVel.y = 0.0f;
-    if ((m_Constraints & RigidbodyConstraints::FreezePositionZ) != RigidbodyConstraints::None) fVel.z = 0.0f;
-    if ((m_Constraints & RigidbodyConstraints::FreezeRotationX) != RigidbodyConstraints::None) fAngVel.x = 0.0f;
-    if ((m_Constraints & RigidbodyConstraints::FreezeRotationY) != RigidbodyConstraints::None) fAngVel.y = 0.0f;
-    if ((m_Constraints & RigidbodyConstraints::FreezeRotationZ) != RigidbodyConstraints::None) fAngVel.z = 0.0f;
-
-    vVel = XMLoadFloat3(&fVel);
-    vAngVel = XMLoadFloat3(&fAngVel);
+    // 生成位置から補間しないよう直前姿勢も揃える
+    s.ResetInterpolation(m_Handle);
 }
 
 //======================================
-// 衝突解決
+// 衝突可否
 //======================================
-bool RigidBody::SolveCollision(RigidBody* rbA, RigidBody* rbB)
+bool RigidBody::CanCollide(const RigidBody* rbA, const RigidBody* rbB)
 {
     if (!rbA || !rbB) return false;
     if (rbA->m_Params.isKinematic && rbB->m_Params.isKinematic) return false;
 
-    if (rbA->m_GenerationId != 0 && rbA->m_GenerationId == rbB->m_GenerationId)
-    {
-        if (rbA->m_IgnoreCollisionTimer > 0.0f || rbB->m_IgnoreCollisionTimer > 0.0f)
-            return false;
-    }
-
-    const Collider colA = rbA->GetWorldCollider();
-    const Collider colB = rbB->GetWorldCollider();
-    Hit hit = Collision_Detect(colA, colB);
-
-    if (!hit.isHit) return false;
-
-    if (hit.depth > 0.5f)
-    {
-        ApplyPositionalCorrection(rbA, rbB, hit, SafeInverse(rbA->m_Params.mass) + SafeInverse(rbB->m_Params.mass));
-        return true;
-    }
-
-    return ApplyCollisionImpulse(rbA, rbB, hit);
+    // レイヤー・マスクと切断グループ（グループは衝突無視タイマー切れで所有側が解除する）
+    return CollisionFilter::ShouldCollide(rbA->m_Filter, rbB->m_Filter);
 }
 
-bool RigidBody::ApplyCollisionImpulse(RigidBody* rbA, RigidBody* rbB, const Hit& hit)
+//======================================
+// スリープ管理（遷移判定は RigidBodyStore::Integrate 内）
+//======================================
+void RigidBody::WakeUp()
 {
-    XMVECTOR n = XMVectorNegate(XMLoadFloat3(&hit.normal));
-    XMVECTOR contact = XMLoadFloat3(&hit.contactPoint);
-
-    const Params& pA = rbA->m_Params;
-    const Params& pB = rbB->m_Params;
-
-    float invMassA = (pA.isKinematic || pA.mass <= 0.0f) ? 0.0f : 1.0f / pA.mass;
-    float invMassB = (pB.isKinematic || pB.mass <= 0.0f) ? 0.0f : 1.0f / pB.mass;
-    float totalInvMass = invMassA + invMassB;
-    if (totalInvMass <= 0.0f) return true;
-
-    XMMATRIX invInertiaA = pA.isKinematic ? XMMatrixSet(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0) : XMLoadFloat3x3(&rbA->m_InvInertiaTensorWorld);
-    XMMATRIX invInertiaB = pB.isKinematic ? XMMatrixSet(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0) : XMLoadFloat3x3(&rbB->m_InvInertiaTensorWorld);
-
-    XMVECTOR posA = XMLoadFloat3(&rbA->m_Position);
-    XMVECTOR posB = XMLoadFloat3(&rbB->m_Position);
-    XMVECTOR rA = XMVectorSubtract(contact, posA);
-    XMVECTOR rB = XMVectorSubtract(contact, posB);
-
-    float rA_len = XMVectorGetX(XMVector3Length(rA));
-    float rB_len = XMVectorGetX(XMVector3Length(rB));
-    if (rA_len > MAX_ARM_LENGTH) rA = XMVectorScale(XMVector3Normalize(rA), MAX_ARM_LENGTH);
-    if (rB_len > MAX_ARM_LENGTH) rB = XMVectorScale(XMVector3Normalize(rB), MAX_ARM_LENGTH);
-
-    XMVECTOR vA = XMLoadFloat3(&rbA->m_Velocity);
-    XMVECTOR wA = XMLoadFloat3(&rbA->m_AngularVelocity);
-    XMVECTOR vB = XMLoadFloat3(&rbB->m_Velocity);
-    XMVECTOR wB = XMLoadFloat3(&rbB->m_AngularVelocity);
-
-    XMVECTOR vPointA = XMVectorAdd(vA, XMVector3Cross(wA, rA));
-    XMVECTOR vPointB = XMVectorAdd(vB, XMVector3Cross(wB, rB));
-    XMVECTOR vRel = XMVectorSubtract(vPointB, vPointA);
-
-    float velAlongNormal = XMVectorGetX(XMVector3Dot(vRel, n));
-    if (velAlongNormal > 0.0f) return true;
-
-    float e = std::min(pA.restitution, pB.restitution);
-    if (std::abs(velAlongNormal) < 1.0f) e *= 0.5f;
-
-    float j = -(1.0f + e) * velAlongNormal;
-
-    XMVECTOR rA_cross_n = XMVector3Cross(rA, n);
-    XMVECTOR rB_cross_n = XMVector3Cross(rB, n);
-    XMVECTOR termA = XMVector3TransformNormal(rA_cross_n, invInertiaA);
-    XMVECTOR termB = XMVector3TransformNormal(rB_cross_n, invInertiaB);
-    float rotTermA = XMVectorGetX(XMVector3Dot(termA, rA_cross_n));
-    float rotTermB = XMVectorGetX(XMVector3Dot(termB, rB_cross_n));
-
-    j /= (totalInvMass + rotTermA + rotTermB);
-    j = std::min(j, MAX_IMPULSE);
-
-    XMVECTOR impulse = XMVectorScale(n, j);
-    XMFLOAT3 fImpulse, fNegImpulse, fContact;
-    XMStoreFloat3(&fImpulse, impulse);
-    XMStoreFloat3(&fNegImpulse, XMVectorNegate(impulse));
-    XMStoreFloat3(&fContact, contact);
-
-    rbA->ApplyImpulseAtPoint(fNegImpulse, fContact);
-    rbB->ApplyImpulseAtPoint(fImpulse, fContact);
-
-    // 摩擦
-    vPointA = XMVectorAdd(XMLoadFloat3(&rbA->m_Velocity), XMVector3Cross(XMLoadFloat3(&rbA->m_AngularVelocity), rA));
-    vPointB = XMVectorAdd(XMLoadFloat3(&rbB->m_Velocity), XMVector3Cross(XMLoadFloat3(&rbB->m_AngularVelocity), rB));
-    vRel = XMVectorSubtract(vPointB, vPointA);
-
-    XMVECTOR tangent = XMVectorSubtract(vRel, XMVectorScale(n, XMVectorGetX(XMVector3Dot(vRel, n))));
-    float tangentLenSq = XMVectorGetX(XMVector3LengthSq(tangent));
-
-    if (tangentLenSq > 1e-6f)
+    // 起きている物体の静止時間は速度で判定するため、スリープ中のみリセット
+    RigidBodySoA& s = RigidBodyStore::GetData();
+    if (s.HasFlag(m_Handle, RigidBodySoA::FLAG_SLEEPING))
     {
-        tangent = XMVector3Normalize(tangent);
-        float jt = -XMVectorGetX(XMVector3Dot(vRel, tangent));
-
-        XMVECTOR rA_cross_t = XMVector3Cross(rA, tangent);
-        XMVECTOR rB_cross_t = XMVector3Cross(rB, tangent);
-        XMVECTOR termAt = XMVector3TransformNormal(rA_cross_t, invInertiaA);
-        XMVECTOR termBt = XMVector3TransformNormal(rB_cross_t, invInertiaB);
-        float rotTermAt = XMVectorGetX(XMVector3Dot(termAt, rA_cross_t));
-        float rotTermBt = XMVectorGetX(XMVector3Dot(termBt, rB_cross_t));
-
-        jt /= (totalInvMass + rotTermAt + rotTermBt);
-
-        float mu = std::sqrt(pA.friction * pB.friction);
-        if (std::abs(jt) > j * mu)
-            jt = (jt > 0.0f ? 1.0f : -1.0f) * j * mu;
-
-        XMVECTOR fricImpulse = XMVectorScale(tangent, jt);
-        XMFLOAT3 fFric, fNegFric;
-        XMStoreFloat3(&fFric, fricImpulse);
-        XMStoreFloat3(&fNegFric, XMVectorNegate(fricImpulse));
-
-        rbA->ApplyImpulseAtPoint(fNegFric, fContact);
-        rbB->ApplyImpulseAtPoint(fFric, fContact);
+        s.SetFlag(m_Handle, RigidBodySoA::FLAG_SLEEPING, false);
+        s.sleepTimer[m_Handle] = 0.0f;
     }
-
-    ApplyPositionalCorrection(rbA, rbB, hit, totalInvMass);
-    return true;
 }
 
-void RigidBody::ApplyPositionalCorrection(RigidBody* rbA, RigidBody* rbB, const Hit& hit, float totalInvMass)
+void RigidBody::Sleep()
 {
-    float correctionDepth = std::max(hit.depth - CORRECTION_SLOP, 0.0f);
-    if (correctionDepth <= 0.0f) return;
-
-    XMVECTOR n = XMVectorNegate(XMLoadFloat3(&hit.normal));
-    XMVECTOR posA = XMLoadFloat3(&rbA->m_Position);
-    XMVECTOR posB = XMLoadFloat3(&rbB->m_Position);
-
-    float invMassA = (rbA->m_Params.isKinematic || rbA->m_Params.mass <= 0.0f) ? 0.0f : 1.0f / rbA->m_Params.mass;
-    float invMassB = (rbB->m_Params.isKinematic || rbB->m_Params.mass <= 0.0f) ? 0.0f : 1.0f / rbB->m_Params.mass;
-
-    XMVECTOR correction = XMVectorScale(n, correctionDepth / totalInvMass * CORRECTION_PERCENT);
-    XMVECTOR posA_new = XMVectorSubtract(posA, XMVectorScale(correction, invMassA));
-    XMVECTOR posB_new = XMVectorAdd(posB, XMVectorScale(correction, invMassB));
-
-    XMFLOAT3 fPosA, fPosB;
-    XMStoreFloat3(&fPosA, posA_new);
-    XMStoreFloat3(&fPosB, posB_new);
-
-    if (!rbA->m_Params.isKinematic) rbA->SetPosition(fPosA);
-    if (!rbB->m_Params.isKinematic) rbB->SetPosition(fPosB);
+    RigidBodyStore::GetData().SetFlag(m_Handle, RigidBodySoA::FLAG_SLEEPING, true);
+    ResetVelocity();
 }
 
-//======================================
-// スリープ管理
-//======================================
-void RigidBody::CheckSleepState(float dt)
+void RigidBody::NotifyGroundContact()
 {
-    // 接地していない場合はスリープしない
-    if (!m_HasGroundContact)
-    {
-        m_SleepTimer = 0.0f;
-        m_IsSleeping = false;
-        return;
-    }
-
-    float velSq = XMVectorGetX(XMVector3LengthSq(XMLoadFloat3(&m_Velocity)));
-    float angVelSq = XMVectorGetX(XMVector3LengthSq(XMLoadFloat3(&m_AngularVelocity)));
-    float energy = velSq + angVelSq;
-
-    if (energy < m_Params.sleepThreshold * SLEEP_ENERGY_BIAS)
-    {
-        m_SleepTimer += dt;
-        if (m_SleepTimer > SLEEP_TIME_THRESHOLD)
-        {
-            m_IsSleeping = true;
-            ResetVelocity();
-        }
-    }
-    else
-    {
-        m_SleepTimer = 0.0f;
-        m_IsSleeping = false;
-    }
+    RigidBodyStore::GetData().SetFlag(m_Handle, RigidBodySoA::FLAG_GROUND_CONTACT, true);
 }
 
-void RigidBody::WakeUp()
+void RigidBody::ResetVelocity()
 {
-    m_IsSleeping = false;
-    m_SleepTimer = 0.0f;
+    RigidBodySoA& s = RigidBodyStore::GetData();
+    s.SetVelocity(m_Handle, { 0.0f, 0.0f, 0.0f });
+    s.SetAngularVelocity(m_Handle, { 0.0f, 0.0f, 0.0f });
+    s.SetForce(m_Handle, { 0.0f, 0.0f, 0.0f });
+    s.SetTorque(m_Handle, { 0.0f, 0.0f, 0.0f });
 }
 
-void RigidBody::NotifyGroundContact()
+void RigidBody::SetIslandSleepEnabled(bool enabled)
 {
-    m_HasGroundContact = true;
+    RigidBodyStore::GetData().SetFlag(m_Handle, RigidBodySoA::FLAG_ISLAND_SLEEP, enabled);
 }
 
-void RigidBody::ResetVelocity()
+bool RigidBody::IsIslandSleepEnabled() const
 {
-    m_Velocity = { 0.0f, 0.0f, 0.0f };
-    m_AngularVelocity = { 0.0f, 0.0f, 0.0f };
-    m_ForceAccum = { 0.0f, 0.0f, 0.0f };
-    m_TorqueAccum = { 0.0f, 0.0f, 0.0f };
+    return RigidBodyStore::GetData().HasFlag(m_Handle, RigidBodySoA::FLAG_ISLAND_SLEEP);
 }
 
 //======================================
@@ -527,24 +232,23 @@ void RigidBody::AddForce(const XMFLOAT3& force)
 {
     if (m_Params.isKinematic) return;
     WakeUp();
-    XMVECTOR vForce = XMLoadFloat3(&force);
-    XMVECTOR vAccum = XMLoadFloat3(&m_ForceAccum);
-    XMStoreFloat3(&m_ForceAccum, XMVectorAdd(vAccum, vForce));
+
+    RigidBodySoA& s = RigidBodyStore::GetData();
+    s.forceX[m_Handle] += force.x;
+    s.forceY[m_Handle] += force.y;
+    s.forceZ[m_Handle] += force.z;
 }
 
 void RigidBody::AddForceAtPoint(const XMFLOAT3& force, const XMFLOAT3& point)
 {
     if (m_Params.isKinematic) return;
-    WakeUp();
 
-    XMVECTOR vForce = XMLoadFloat3(&force);
-    XMVECTOR vPoint = XMLoadFloat3(&point);
-    XMVECTOR vPos = XMLoadFloat3(&m_Position);
-    XMVECTOR r = XMVectorSubtract(vPoint, vPos);
-    XMVECTOR vTorque = XMVector3Cross(r, vForce);
-    XMVECTOR vTorqueAccum = XMLoadFloat3(&m_TorqueAccum);
-    XMStoreFloat3(&m_TorqueAccum, XMVectorAdd(vTorqueAccum, vTorque));
+    const XMFLOAT3 pos = GetPosition();
+    XMVECTOR r = XMVectorSubtract(XMLoadFloat3(&point), XMLoadFloat3(&pos));
+    XMFLOAT3 torque;
+    XMStoreFloat3(&torque, XMVector3Cross(r, XMLoadFloat3(&force)));
 
+    AddTorque(torque);
     AddForce(force);
 }
 
@@ -552,20 +256,26 @@ void RigidBody::AddTorque(const XMFLOAT3& torque)
 {
     if (m_Params.isKinematic) return;
     WakeUp();
-    XMVECTOR vTorque = XMLoadFloat3(&torque);
-    XMVECTOR vAccum = XMLoadFloat3(&m_TorqueAccum);
-    XMStoreFloat3(&m_TorqueAccum, XMVectorAdd(vAccum, vTorque));
+
+    RigidBodySoA& s = RigidBodyStore::GetData();
+    s.torqueX[m_Handle] += torque.x;
+    s.torqueY[m_Handle] += torque.y;
+    s.torqueZ[m_Handle] += torque.z;
 }
 
 void RigidBody::ApplyImpulse(const XMFLOAT3& impulse)
 {
     if (m_Params.isKinematic) return;
     WakeUp();
-    XMVECTOR vImpulse = XMLoadFloat3(&impulse);
-    XMVECTOR vVel = XMLoadFloat3(&m_Velocity);
-    vVel = XMVectorAdd(vVel, XMVectorScale(vImpulse, SafeInverse(m_Params.mass)));
+
+    RigidBodySoA& s = RigidBodyStore::GetData();
+    const XMFLOAT3 vel = s.GetVelocity(m_Handle);
+    XMVECTOR vVel = XMVectorAdd(XMLoadFloat3(&vel), XMVectorScale(XMLoadFloat3(&impulse), s.invMass[m_Handle]));
     vVel = ClampMagnitude(vVel, m_Params.maxLinearVelocity);
-    XMStoreFloat3(&m_Velocity, vVel);
+
+    XMFLOAT3 result;
+    XMStoreFloat3(&result, vVel);
+    s.SetVelocity(m_Handle, result);
 }
 
 void RigidBody::ApplyImpulseAtPoint(const XMFLOAT3& impulse, const XMFLOAT3& point)
@@ -573,19 +283,21 @@ void RigidBody::ApplyImpulseAtPoint(const XMFLOAT3& impulse, const XMFLOAT3& poi
     if (m_Params.isKinematic) return;
     ApplyImpulse(impulse);
 
-    XMVECTOR vImpulse = XMLoadFloat3(&impulse);
-    XMVECTOR vPoint = XMLoadFloat3(&point);
-    XMVECTOR vPos = XMLoadFloat3(&m_Position);
-    XMVECTOR vAngVel = XMLoadFloat3(&m_AngularVelocity);
+    RigidBodySoA& s = RigidBodyStore::GetData();
+    const XMFLOAT3 pos = s.GetPosition(m_Handle);
+    const XMFLOAT3 angVel = s.GetAngularVelocity(m_Handle);
+    const XMFLOAT3X3 invInertia = GetInvInertiaTensorWorld();
 
-    XMVECTOR r = XMVectorSubtract(vPoint, vPos);
-    XMVECTOR impulsiveTorque = XMVector3Cross(r, vImpulse);
-    XMMATRIX invInertiaWorld = XMLoadFloat3x3(&m_InvInertiaTensorWorld);
-    XMVECTOR deltaAngVel = XMVector3TransformNormal(impulsiveTorque, invInertiaWorld);
+    XMVECTOR r = XMVectorSubtract(XMLoadFloat3(&point), XMLoadFloat3(&pos));
+    XMVECTOR impulsiveTorque = XMVector3Cross(r, XMLoadFloat3(&impulse));
+    XMVECTOR deltaAngVel = XMVector3TransformNormal(impulsiveTorque, XMLoadFloat3x3(&invInertia));
 
-    vAngVel = XMVectorAdd(vAngVel, deltaAngVel);
+    XMVECTOR vAngVel = XMVectorAdd(XMLoadFloat3(&angVel), deltaAngVel);
     vAngVel = ClampMagnitude(vAngVel, m_Params.maxAngularVelocity);
-    XMStoreFloat3(&m_AngularVelocity, vAngVel);
+
+    XMFLOAT3 result;
+    XMStoreFloat3(&result, vAngVel);
+    s.SetAngularVelocity(m_Handle, result);
 }
 
 //======================================
@@ -593,14 +305,14 @@ void RigidBody::ApplyImpulseAtPoint(const XMFLOAT3& impulse, const XMFLOAT3& poi
 //======================================
 void RigidBody::SetVelocity(const XMFLOAT3& vel)
 {
-    m_Velocity = vel;
+    RigidBodyStore::GetData().SetVelocity(m_Handle, vel);
     if (std::abs(vel.x) > 0.0f || std::abs(vel.y) > 0.0f || std::abs(vel.z) > 0.0f)
         WakeUp();
 }
 
 void RigidBody::SetAngularVelocity(const XMFLOAT3& angVel)
 {
-    m_AngularVelocity = angVel;
+    RigidBodyStore::GetData().SetAngularVelocity(m_Handle, angVel);
     if (std::abs(angVel.x) > 0.0f || std::abs(angVel.y) > 0.0f || std::abs(angVel.z) > 0.0f)
         WakeUp();
 }
@@ -609,54 +321,228 @@ void RigidBody::SetParams(const Params& param)
 {
     bool massChanged = std::abs(m_Params.mass - param.mass) > 1e-6f;
     m_Params = param;
+    SyncParamsToStore();
     if (massChanged) UpdateInertiaTensor();
     WakeUp();
 }
 
 void RigidBody::SetPosition(const XMFLOAT3& pos)
 {
-    m_Position = pos;
-    UpdateWorldMatrix();
+    RigidBodySoA& s = RigidBodyStore::GetData();
+    s.SetPosition(m_Handle, pos);
+    s.ResetPositionInterpolation(m_Handle);
+    WakeUp();
+}
+
+void RigidBody::CorrectPosition(const XMFLOAT3& pos)
+{
+    RigidBodyStore::GetData().SetPosition(m_Handle, pos);
     WakeUp();
 }
 
 void RigidBody::SetRotation(const XMFLOAT4& rot)
 {
-    m_Rotation = rot;
-    UpdateWorldMatrix();
-    UpdateInertiaTensor();
+    RigidBodyStore::GetData().SetRotation(m_Handle, rot);
     WakeUp();
 }
 
+void RigidBody::SetConstraints(RigidbodyConstraints constraints)
+{
+    m_Constraints = constraints;
+
+    // 拘束軸は積分時に係数0として扱う
+    RigidBodySoA& s = RigidBodyStore::GetData();
+    s.SetLinearFactor(m_Handle, {
+        IsFrozen(constraints, RigidbodyConstraints::FreezePositionX) ? 0.0f : 1.0f,
+        IsFrozen(constraints, RigidbodyConstraints::FreezePositionY) ? 0.0f : 1.0f,
+        IsFrozen(constraints, RigidbodyConstraints::FreezePositionZ) ? 0.0f : 1.0f });
+    s.SetAngularFactor(m_Handle, {
+        IsFrozen(constraints, RigidbodyConstraints::FreezeRotationX) ? 0.0f : 1.0f,
+        IsFrozen(constraints, RigidbodyConstraints::FreezeRotationY) ? 0.0f : 1.0f,
+        IsFrozen(constraints, RigidbodyConstraints::FreezeRotationZ) ? 0.0f : 1.0f });
+}
+
+void RigidBody::SetGravityEnabled(bool enabled)
+{
+    m_Params.useGravity = enabled;
+    SyncParamsToStore();
+}
+
+void RigidBody::SetIgnoreCollisionTimer(float time)
+{
+    RigidBodyStore::GetData().ignoreCollisionTimer[m_Handle] = time;
+}
+
 //======================================
 // 内部更新
 //======================================
+void RigidBody::SyncParamsToStore()
+{
+    RigidBodySoA& s = RigidBodyStore::GetData();
+    const float invMass = SafeInverse(m_Params.mass);
+
+    s.invMass[m_Handle] = invMass;
+    s.linearDrag[m_Handle] = m_Params.linearDrag;
+    s.angularDrag[m_Handle] = m_Params.angularDrag;
+    s.maxLinearVelocity[m_Handle] = m_Params.maxLinearVelocity;
+    s.maxAngularVelocity[m_Handle] = m_Params.maxAngularVelocity;
+    s.sleepThreshold[m_Handle] = m_Params.sleepThreshold;
+
+    // 重力は加速度として保持（質量を掛けて割る往復を省く）
+    if (m_Params.useGravity && invMass > 0.0f)
+        s.SetGravity(m_Handle, m_Params.gravity);
+    else
+        s.SetGravity(m_Handle, { 0.0f, 0.0f, 0.0f });
+
+    s.SetFlag(m_Handle, RigidBodySoA::FLAG_KINEMATIC, m_Params.isKinematic);
+}
+
 void RigidBody::UpdateInertiaTensor()
 {
-    XMMATRIX R = XMMatrixRotationQuaternion(XMLoadFloat4(&m_Rotation));
-    XMMATRIX invILocal = XMLoadFloat3x3(&m_InvInertiaTensorLocal);
-    XMMATRIX invIWorld = XMMatrixMultiply(XMMatrixMultiply(R, invILocal), XMMatrixTranspose(R));
-    XMStoreFloat3x3(&m_InvInertiaTensorWorld, invIWorld);
+    // ローカル慣性テンソル（対角）をコライダー形状と質量から計算
+    float Ixx = 0.0f, Iyy = 0.0f, Izz = 0.0f;
+    XMFLOAT3 offset = { 0.0f, 0.0f, 0.0f };
+
+    if (m_LocalCollider.type == ColliderType::Sphere)
+    {
+        offset = m_LocalCollider.sphere.center;
+        const float r = std::max(m_LocalCollider.sphere.radius, 0.01f);
+        const float I = (2.0f / 5.0f) * m_Params.mass * r * r;
+        Ixx = Iyy = Izz = I;
+    }
+    else if (m_LocalCollider.type == ColliderType::Box)
+    {
+        offset = m_LocalCollider.obb.center;
+        const float w = std::max(m_LocalCollider.obb.extents.x * 2.0f, 0.01f);
+        const float h = std::max(m_LocalCollider.obb.extents.y * 2.0f, 0.01f);
+        const float d = std::max(m_LocalCollider.obb.extents.z * 2.0f, 0.01f);
+        const float coef = m_Params.mass / 12.0f;
+        Ixx = coef * (h * h + d * d);
+        Iyy = coef * (w * w + d * d);
+        Izz = coef * (w * w + h * h);
+    }
+    else if (m_LocalCollider.type == ColliderType::ConvexHull)
+    {
+        // 凸包は包むボックスで近似
+        offset = m_LocalAABB.GetCenter();
+        const XMFLOAT3 size = m_LocalAABB.GetSize();
+        const float w = std::max(size.x, 0.01f);
+        const float h = std::max(size.y, 0.01f);
+        const float d = std::max(size.z, 0.01f);
+        const float coef = m_Params.mass / 12.0f;
+        Ixx = coef * (h * h + d * d);
+        Iyy = coef * (w * w + d * d);
+        Izz = coef * (w * w + h * h);
+    }
+
+    // 平行軸の定理
+    const float offsetLenSq = offset.x * offset.x + offset.y * offset.y + offset.z * offset.z;
+    if (offsetLenSq > 1e-6f)
+    {
+        Ixx += m_Params.mass * (offset.y * offset.y + offset.z * offset.z);
+        Iyy += m_Params.mass * (offset.x * offset.x + offset.z * offset.z);
+        Izz += m_Params.mass * (offset.x * offset.x + offset.y * offset.y);
+    }
+
+    const float minInertia = MIN_INERTIA_FACTOR * m_Params.mass;
+    Ixx = std::max(Ixx, minInertia);
+    Iyy = std::max(Iyy, minInertia);
+    Izz = std::max(Izz, minInertia);
+
+    RigidBodyStore::GetData().SetInvInertia(m_Handle, { 1.0f / Ixx, 1.0f / Iyy, 1.0f / Izz });
 }
 
-void RigidBody::UpdateWorldMatrix()
+XMMATRIX RigidBody::GetRotationTranslationMatrix() const
 {
-    XMVECTOR vPos = XMLoadFloat3(&m_Position);
-    XMVECTOR qRot = XMLoadFloat4(&m_Rotation);
-    XMMATRIX mRot = XMMatrixRotationQuaternion(qRot);
-    XMMATRIX mTrans = XMMatrixTranslationFromVector(vPos);
-    XMStoreFloat4x4(&m_WorldMatrix, XMMatrixMultiply(mRot, mTrans));
+    const XMFLOAT3 pos = GetPosition();
+    const XMFLOAT4 rot = GetRotation();
+    XMMATRIX mRot = XMMatrixRotationQuaternion(XMLoadFloat4(&rot));
+    XMMATRIX mTrans = XMMatrixTranslationFromVector(XMLoadFloat3(&pos));
+    return XMMatrixMultiply(mRot, mTrans);
 }
 
 //======================================
 // Getters
 //======================================
+XMFLOAT3 RigidBody::GetPosition() const
+{
+    return RigidBodyStore::GetData().GetPosition(m_Handle);
+}
+
+XMFLOAT4 RigidBody::GetRotation() const
+{
+    return RigidBodyStore::GetData().GetRotation(m_Handle);
+}
+
+XMFLOAT3 RigidBody::GetVelocity() const
+{
+    return RigidBodyStore::GetData().GetVelocity(m_Handle);
+}
+
+XMFLOAT3 RigidBody::GetAngularVelocity() const
+{
+    return RigidBodyStore::GetData().GetAngularVelocity(m_Handle);
+}
+
+XMFLOAT3X3 RigidBody::GetInvInertiaTensorWorld() const
+{
+    // 行ベクトル規約：ワールド→ローカル(R^T)→対角逆慣性→ワールド(R)
+    const RigidBodySoA& s = RigidBodyStore::GetData();
+    const XMFLOAT4 rot = s.GetRotation(m_Handle);
+    const XMFLOAT3 invI = s.GetInvInertia(m_Handle);
+
+    XMMATRIX R = XMMatrixRotationQuaternion(XMLoadFloat4(&rot));
+    XMMATRIX invILocal = XMMatrixScaling(invI.x, invI.y, invI.z);
+    XMFLOAT3X3 result;
+    XMStoreFloat3x3(&result, XMMatrixMultiply(XMMatrixMultiply(XMMatrixTranspose(R), invILocal), R));
+    return result;
+}
+
+bool RigidBody::IsSleeping() const
+{
+    return RigidBodyStore::GetData().HasFlag(m_Handle, RigidBodySoA::FLAG_SLEEPING);
+}
+
+bool RigidBody::IsReadyToSleep() const
+{
+    return RigidBodyStore::GetData().sleepTimer[m_Handle] > SLEEP_TIME_THRESHOLD;
+}
+
+bool RigidBody::HasGroundContact() const
+{
+    return RigidBodyStore::GetData().HasFlag(m_Handle, RigidBodySoA::FLAG_GROUND_CONTACT);
+}
+
+float RigidBody::GetIgnoreCollisionTimer() const
+{
+    return RigidBodyStore::GetData().ignoreCollisionTimer[m_Handle];
+}
+
 XMFLOAT4X4 RigidBody::GetWorldMatrix(const XMFLOAT3& scale) const
 {
-    XMMATRIX mWorld = XMLoadFloat4x4(&m_WorldMatrix);
     XMMATRIX mScale = XMMatrixScaling(scale.x, scale.y, scale.z);
     XMFLOAT4X4 result;
-    XMStoreFloat4x4(&result, XMMatrixMultiply(mScale, mWorld));
+    XMStoreFloat4x4(&result, XMMatrixMultiply(mScale, GetRotationTranslationMatrix()));
+    return result;
+}
+
+XMFLOAT4X4 RigidBody::GetRenderWorldMatrix(const XMFLOAT3& scale) const
+{
+    const RigidBodySoA& s = RigidBodyStore::GetData();
+    const XMFLOAT3 prevPos = s.GetPrevPosition(m_Handle);
+    const XMFLOAT4 prevRot = s.GetPrevRotation(m_Handle);
+    const XMFLOAT3 pos = s.GetPosition(m_Handle);
+    const XMFLOAT4 rot = s.GetRotation(m_Handle);
+    const float alpha = FixedStep_GetAlpha();
+
+    XMVECTOR vPos = XMVectorLerp(XMLoadFloat3(&prevPos), XMLoadFloat3(&pos), alpha);
+    XMVECTOR qRot = XMQuaternionSlerp(XMLoadFloat4(&prevRot), XMLoadFloat4(&rot), alpha);
+
+    XMMATRIX mScale = XMMatrixScaling(scale.x, scale.y, scale.z);
+    XMMATRIX mRot = XMMatrixRotationQuaternion(qRot);
+    XMMATRIX mTrans = XMMatrixTranslationFromVector(vPos);
+    XMFLOAT4X4 result;
+    XMStoreFloat4x4(&result, mScale * mRot * mTrans);
     return result;
 }
 
@@ -673,7 +559,7 @@ AABB RigidBody::GetTransformedAABB() const
         XMVectorSet(m_LocalAABB.max.x, m_LocalAABB.max.y, m_LocalAABB.max.z, 0.0f)
     };
 
-    XMMATRIX worldMat = XMLoadFloat4x4(&m_WorldMatrix);
+    XMMATRIX worldMat = GetRotationTranslationMatrix();
     XMVECTOR vMin = XMVectorSet(FLT_MAX, FLT_MAX, FLT_MAX, 0.0f);
     XMVECTOR vMax = XMVectorSet(-FLT_MAX, -FLT_MAX, -FLT_MAX, 0.0f);
 
@@ -690,11 +576,74 @@ AABB RigidBody::GetTransformedAABB() const
     return result;
 }
 
+bool RigidBody::GetSweepSphere(Sphere& outStart, XMFLOAT3& outDisplacement) const
+{
+    // 内接球（中心はコライダーのローカルオフセット）
+    XMFLOAT3 localCenter;
+    float radius;
+    if (m_LocalCollider.type == ColliderType::Sphere)
+    {
+        localCenter = m_LocalCollider.sphere.center;
+        radius = m_LocalCollider.sphere.radius;
+    }
+    else if (m_LocalCollider.type == ColliderType::Box)
+    {
+        const XMFLOAT3& e = m_LocalCollider.obb.extents;
+        localCenter = m_LocalCollider.obb.center;
+        radius = std::min({ e.x, e.y, e.z });
+    }
+    else if (m_LocalCollider.type == ColliderType::ConvexHull)
+    {
+        const XMFLOAT3 size = m_LocalAABB.GetSize();
+        localCenter = m_LocalAABB.GetCenter();
+        radius = std::min({ size.x, size.y, size.z }) * 0.5f;
+    }
+    else
+    {
+        return false;
+    }
+    if (radius <= 0.0f) return false;
+
+    const RigidBodySoA& s = RigidBodyStore::GetData();
+    const XMFLOAT3 prevPos = s.GetPrevPosition(m_Handle);
+    const XMFLOAT3 pos = s.GetPosition(m_Handle);
+
+    // 回転中の中心移動は無視し、現在の姿勢のオフセットを開始位置にも使う
+    const XMFLOAT4 rot = s.GetRotation(m_Handle);
+    XMVECTOR offset = XMVector3Rotate(XMLoadFloat3(&localCenter), XMLoadFloat4(&rot));
+    XMStoreFloat3(&outStart.center, XMLoadFloat3(&prevPos) + offset);
+    outStart.radius = radius;
+    XMStoreFloat3(&outDisplacement, XMLoadFloat3(&pos) - XMLoadFloat3(&prevPos));
+    return true;
+}
+
+bool RigidBody::GetContinuousSweep(Sphere& outStart, XMFLOAT3& outDisplacement) const
+{
+    if (!m_Params.useContinuousCollision || m_Params.isKinematic || IsSleeping()) return false;
+    if (!GetSweepSphere(outStart, outDisplacement)) return false;
+
+    const float distance = XMVectorGetX(XMVector3Length(XMLoadFloat3(&outDisplacement)));
+    return distance > outStart.radius * CCD_MOTION_RATIO && distance <= CCD_TELEPORT_DISTANCE;
+}
+
+void RigidBody::RewindToTime(float time)
+{
+    RigidBodySoA& s = RigidBodyStore::GetData();
+    const XMFLOAT3 prevPos = s.GetPrevPosition(m_Handle);
+    const XMFLOAT3 pos = s.GetPosition(m_Handle);
+
+    XMFLOAT3 rewound;
+    XMStoreFloat3(&rewound, XMVectorLerp(XMLoadFloat3(&prevPos), XMLoadFloat3(&pos), std::clamp(time, 0.0f, 1.0f)));
+    s.SetPosition(m_Handle, rewound);
+}
+
 Collider RigidBody::GetWorldCollider() const
 {
     Collider worldCol = m_LocalCollider;
-    XMVECTOR vPos = XMLoadFloat3(&m_Position);
-    XMVECTOR qRot = XMLoadFloat4(&m_Rotation);
+    const XMFLOAT3 pos = GetPosition();
+    const XMFLOAT4 rot = GetRotation();
+    XMVECTOR vPos = XMLoadFloat3(&pos);
+    XMVECTOR qRot = XMLoadFloat4(&rot);
 
     if (worldCol.type == ColliderType::Sphere)
     {
@@ -712,6 +661,15 @@ Collider RigidBody::GetWorldCollider() const
         XMVECTOR qWorldRot = XMQuaternionMultiply(qLocalRot, qRot);
         XMStoreFloat4(&worldCol.obb.orientation, qWorldRot);
     }
+    else if (worldCol.type == ColliderType::ConvexHull)
+    {
+        XMVECTOR vLocalCenter = XMLoadFloat3(&m_LocalCollider.hull.center);
+        XMVECTOR vWorldCenter = XMVectorAdd(XMVector3Rotate(vLocalCenter, qRot), vPos);
+        XMStoreFloat3(&worldCol.hull.center, vWorldCenter);
+
+        XMVECTOR qLocalRot = XMLoadFloat4(&m_LocalCollider.hull.orientation);
+        XMStoreFloat4(&worldCol.hull.orientation, XMQuaternionMultiply(qLocalRot, qRot));
+    }
 
     return worldCol;
-}
\ No newline at end of file
+}
@@ -4,6 +4,12 @@
  * @detail 剛体の物理シミュレーション、衝突応答機能を提供
  * @author Natsume Shidara
  * @update 2026/01/06 - リファクタリング
+ * @update 2026/10/18 - 接触アイランド単位のスリープに対応
+ * @update 2026/10/18 - 状態をRigidBodyStore（SoA）へ移し、本クラスはハンドルと付随情報のみ保持
+ * @update 2026/10/18 - 固定ステップ間を補間した描画用ワールド行列
+ * @update 2026/10/18 - 高速移動体の連続衝突判定（スイープ球）
+ * @update 2026/10/18 - 世代IDを衝突フィルター（レイヤー・マスク・グループ）へ置き換え
+ * @update 2026/10/18 - ContactSolver へ移行済みの旧インパルス解決を削除
  ****************************************/
 
 #ifndef RIGID_BODY_H
@@ -11,6 +17,7 @@
 
 #include <DirectXMath.h>
 #include "collider.h"
+#include "rigid_body_store.h"
 
  // 軸の拘束フラグ
 enum class RigidbodyConstraints
@@ -57,23 +64,24 @@ public:
         float friction = 0.6f;  // 修正: 3.8 → 0.6
 
         bool useGravity = true;
+        bool useContinuousCollision = false;    // 高速移動時にスイープ判定で貫通を防ぐ
     };
 
 public:
     RigidBody();
-    ~RigidBody() = default;
+    ~RigidBody();
 
-    RigidBody(const RigidBody&) = default;
-    RigidBody& operator=(const RigidBody&) = default;
-    RigidBody(RigidBody&&) = default;
-    RigidBody& operator=(RigidBody&&) = default;
+    // ストアのスロットを所有するためコピー禁止
+    RigidBody(const RigidBody&) = delete;
+    RigidBody& operator=(const RigidBody&) = delete;
+    RigidBody(RigidBody&& other) noexcept;
+    RigidBody& operator=(RigidBody&& other) noexcept;
 
-    // 初期化・更新
+    // 初期化（積分は RigidBodyStore::Integrate で全剛体をまとめて行う）
     void Initialize(const DirectX::XMFLOAT3& pos, const Collider& collider, float mass);
-    void Integrate(float dt);
 
-    // 衝突解決
-    static bool SolveCollision(RigidBody* rbA, RigidBody* rbB);
+    // 衝突可否（接触の解決は ContactSolver が行う）
+    static bool CanCollide(const RigidBody* rbA, const RigidBody* rbB);
 
     // 力・インパルスの適用
     void AddForce(const DirectX::XMFLOAT3& force);
@@ -85,84 +93,99 @@ public:
     // 状態制御
     void ResetVelocity();
     void WakeUp();
+    void Sleep();
     void NotifyGroundContact();  // 接地通知（スリープ判定用）
 
+    // アイランド管理下ではスリープ判定を外部（接触アイランド）に委ねる
+    void SetIslandSleepEnabled(bool enabled);
+    bool IsIslandSleepEnabled() const;
+
     // Setters
-    void SetPosition(const DirectX::XMFLOAT3& pos);
+    void SetPosition(const DirectX::XMFLOAT3& pos);      // 瞬間移動（直前ステップの位置も揃え、移動元から補間しない）
+    void CorrectPosition(const DirectX::XMFLOAT3& pos);  // めり込み解消などの押し出し（直前ステップの位置は保持）
     void SetRotation(const DirectX::XMFLOAT4& rot);
     void SetVelocity(const DirectX::XMFLOAT3& vel);
     void SetAngularVelocity(const DirectX::XMFLOAT3& angVel);
-    void SetConstraints(RigidbodyConstraints constraints) { m_Constraints = constraints; }
+    void SetConstraints(RigidbodyConstraints constraints);
     void SetParams(const Params& param);
-    void SetGenerationId(int id) { m_GenerationId = id; }
-    void SetIgnoreCollisionTimer(float time) { m_IgnoreCollisionTimer = time; }
-
-    // Getters
-    const DirectX::XMFLOAT3& GetPosition() const { return m_Position; }
-    const DirectX::XMFLOAT4& GetRotation() const { return m_Rotation; }
-    const DirectX::XMFLOAT3& GetVelocity() const { return m_Velocity; }
-    const DirectX::XMFLOAT3& GetAngularVelocity() const { return m_AngularVelocity; }
-    const DirectX::XMFLOAT3X3& GetInvInertiaTensorWorld() const { return m_InvInertiaTensorWorld; }
+    void SetCollisionFilter(const CollisionFilter& filter) { m_Filter = filter; }
+    void SetCollisionLayer(uint32_t layer, uint32_t mask) { m_Filter.layer = layer; m_Filter.mask = mask; }
+    // 同じグループ同士は衝突しない（衝突無視タイマーと併せて設定し、切れたら所有側が 0 に戻す）
+    void SetCollisionGroup(int groupId) { m_Filter.groupId = groupId; }
+    void SetIgnoreCollisionTimer(float time);
+
+    // Getters（状態はストアから値で返す）
+    DirectX::XMFLOAT3 GetPosition() const;
+    DirectX::XMFLOAT4 GetRotation() const;
+    DirectX::XMFLOAT3 GetVelocity() const;
+    DirectX::XMFLOAT3 GetAngularVelocity() const;
+    DirectX::XMFLOAT3X3 GetInvInertiaTensorWorld() const;
     const Params& GetParams() const { return m_Params; }
     RigidbodyConstraints GetConstraints() const { return m_Constraints; }
-    bool IsSleeping() const { return m_IsSleeping; }
-    int GetGenerationId() const { return m_GenerationId; }
-    float GetIgnoreCollisionTimer() const { return m_IgnoreCollisionTimer; }
+    bool IsSleeping() const;
+    bool IsReadyToSleep() const;
+    bool HasGroundContact() const;
+    const CollisionFilter& GetCollisionFilter() const { return m_Filter; }
+    int GetCollisionGroup() const { return m_Filter.groupId; }
+    float GetIgnoreCollisionTimer() const;
     const Collider& GetLocalCollider() const { return m_LocalCollider; }
     bool IsGravityEnabled() const { return m_Params.useGravity; }
-    void SetGravityEnabled(bool enabled) { m_Params.useGravity = enabled; }
+    void SetGravityEnabled(bool enabled);
+    int GetHandle() const { return m_Handle; }
 
     DirectX::XMFLOAT4X4 GetWorldMatrix(const DirectX::XMFLOAT3& scale) const;
+    // 直前ステップと最新ステップを FixedStep_GetAlpha() で補間した描画用行列
+    DirectX::XMFLOAT4X4 GetRenderWorldMatrix(const DirectX::XMFLOAT3& scale) const;
     Collider GetWorldCollider() const;
     AABB GetTransformedAABB() const;
 
+    /**
+     * @brief 今ステップの移動（直前ステップの位置→現在位置）をスイープ球として取得
+     * @detail 球はコライダーに内接する（OBBは最小半辺長）ため、スイープ結果は保守的な近似となる
+     * @param[out] outStart        移動開始時点の内接球（ワールド座標）
+     * @param[out] outDisplacement 今ステップの移動量
+     * @return 球・OBB以外のコライダーでは false
+     */
+    bool GetSweepSphere(Sphere& outStart, DirectX::XMFLOAT3& outDisplacement) const;
+
+    /**
+     * @brief 連続衝突判定が必要な場合のみスイープ球を取得
+     * @detail useContinuousCollision が有効で、移動量が内接球半径の一定割合を超えたときのみ true
+     */
+    bool GetContinuousSweep(Sphere& outStart, DirectX::XMFLOAT3& outDisplacement) const;
+
+    /**
+     * @brief 直前ステップの位置から移動量の time 割合だけ進んだ位置へ戻す
+     */
+    void RewindToTime(float time);
+
     // 定数
     static constexpr float MIN_MASS = 0.001f;
     static constexpr float MIN_INERTIA_FACTOR = 0.1f;
     static constexpr float MAX_DELTA_TIME = 0.02f;
     static constexpr float MAX_ROTATION_PER_FRAME = 0.5f;
-    static constexpr float MAX_ARM_LENGTH = 2.0f;
     static constexpr float MAX_IMPULSE = 50.0f;
     static constexpr float SLEEP_TIME_THRESHOLD = 0.5f;
     static constexpr float SLEEP_ENERGY_BIAS = 0.5f;
     static constexpr float CORRECTION_PERCENT = 0.4f;
     static constexpr float CORRECTION_SLOP = 0.01f;
     static constexpr float VELOCITY_CUTOFF = 0.001f;
+    static constexpr float CCD_MOTION_RATIO = 0.5f;         // 内接球半径に対してこの割合以上動いたらスイープ
+    static constexpr float CCD_TELEPORT_DISTANCE = 2.0f;    // これ以上の移動はワープとみなしスイープしない
 
 private:
     void UpdateInertiaTensor();
-    void UpdateWorldMatrix();
-    void CheckSleepState(float dt);
-    DirectX::XMVECTOR UpdateRotation(DirectX::XMVECTOR qRot, DirectX::XMVECTOR vAngVel, float dt) const;
-    void ApplyConstraintsToForces();
-    void ApplyConstraintsToVelocities(DirectX::XMVECTOR& vVel, DirectX::XMVECTOR& vAngVel);
+    void SyncParamsToStore();
+    DirectX::XMMATRIX GetRotationTranslationMatrix() const;
 
-    static bool ApplyCollisionImpulse(RigidBody* rbA, RigidBody* rbB, const Hit& hit);
-    static void ApplyPositionalCorrection(RigidBody* rbA, RigidBody* rbB, const Hit& hit, float totalInvMass);
+    int m_Handle;               // RigidBodyStore のスロット（位置・速度・姿勢・質量特性など）
 
+    // 積分に使わない付随情報
     Params m_Params;
-
-    DirectX::XMFLOAT3 m_Position;
-    DirectX::XMFLOAT4 m_Rotation;
-    DirectX::XMFLOAT3 m_Velocity;
-    DirectX::XMFLOAT3 m_AngularVelocity;
-
-    DirectX::XMFLOAT3 m_ForceAccum;
-    DirectX::XMFLOAT3 m_TorqueAccum;
-
     Collider m_LocalCollider;
     AABB m_LocalAABB;
-    DirectX::XMFLOAT4X4 m_WorldMatrix;
-    DirectX::XMFLOAT3X3 m_InvInertiaTensorLocal;
-    DirectX::XMFLOAT3X3 m_InvInertiaTensorWorld;
-
     RigidbodyConstraints m_Constraints;
-    bool m_IsSleeping;
-    float m_SleepTimer;
-    bool m_HasGroundContact;  // 接地フラグ
-
-    int m_GenerationId;
-    float m_IgnoreCollisionTimer;
+    CollisionFilter m_Filter;   // 衝突レイヤー・マスク・切断グループ
 };
 
 #endif // RIGID_BODY_H
\ No newline at end of file
@@ -0,0 +1,402 @@
+﻿/****************************************
+ * @file rigid_body_store.cpp
+ * @brief 剛体状態の一元管理（SoA配置）の実装
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - バッチ単位の並列積分
+ * @update 2026/10/18 - 描画補間用の姿勢保存
+ ****************************************/
+
+#include "rigid_body_store.h"
+#include "rigid_body.h"
+#include "physics_job_system.h"
+#include <algorithm>
+
+using namespace DirectX;
+
+//======================================
+// 内部データ
+//======================================
+namespace
+{
+    RigidBodySoA g_Bodies;
+    std::vector<int> g_FreeHandles;     // 空きスロット（末尾から再利用）
+    int g_ActiveCount = 0;
+
+    // 1ジョブあたりのSIMDバッチ数（4体 × 16 = 64体）
+    constexpr int INTEGRATE_BATCHES_PER_JOB = 16;
+}
+
+//======================================
+// 内部ヘルパー関数
+//======================================
+namespace
+{
+    XMVECTOR Load4(const std::vector<float>& array, int base)
+    {
+        return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&array[base]));
+    }
+
+    void Store4(std::vector<float>& array, int base, FXMVECTOR value)
+    {
+        XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&array[base]), value);
+    }
+
+    /**
+     * @brief 4体分のベクトルをクォータニオンで回転（v' = v + w*t + q×t, t = 2(q×v)）
+     */
+    void RotateSoA(FXMVECTOR qx, FXMVECTOR qy, FXMVECTOR qz, GXMVECTOR qw,
+                   XMVECTOR& vx, XMVECTOR& vy, XMVECTOR& vz)
+    {
+        XMVECTOR tx = XMVectorScale(XMVectorSubtract(XMVectorMultiply(qy, vz), XMVectorMultiply(qz, vy)), 2.0f);
+        XMVECTOR ty = XMVectorScale(XMVectorSubtract(XMVectorMultiply(qz, vx), XMVectorMultiply(qx, vz)), 2.0f);
+        XMVECTOR tz = XMVectorScale(XMVectorSubtract(XMVectorMultiply(qx, vy), XMVectorMultiply(qy, vx)), 2.0f);
+
+        XMVECTOR rx = XMVectorAdd(vx, XMVectorAdd(XMVectorMultiply(qw, tx), XMVectorSubtract(XMVectorMultiply(qy, tz), XMVectorMultiply(qz, ty))));
+        XMVECTOR ry = XMVectorAdd(vy, XMVectorAdd(XMVectorMultiply(qw, ty), XMVectorSubtract(XMVectorMultiply(qz, tx), XMVectorMultiply(qx, tz))));
+        XMVECTOR rz = XMVectorAdd(vz, XMVectorAdd(XMVectorMultiply(qw, tz), XMVectorSubtract(XMVectorMultiply(qx, ty), XMVectorMultiply(qy, tx))));
+
+        vx = rx;
+        vy = ry;
+        vz = rz;
+    }
+
+    XMVECTOR LengthSqSoA(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z)
+    {
+        return XMVectorAdd(XMVectorMultiply(x, x), XMVectorAdd(XMVectorMultiply(y, y), XMVectorMultiply(z, z)));
+    }
+
+    /**
+     * @brief 長さが上限を超えるレーンのみ縮める
+     */
+    void ClampMagnitudeSoA(XMVECTOR& x, XMVECTOR& y, XMVECTOR& z, FXMVECTOR maxLength)
+    {
+        XMVECTOR length = XMVectorSqrt(LengthSqSoA(x, y, z));
+        XMVECTOR over = XMVectorGreater(length, maxLength);
+        XMVECTOR scale = XMVectorSelect(XMVectorSplatOne(), XMVectorDivide(maxLength, length), over);
+        x = XMVectorMultiply(x, scale);
+        y = XMVectorMultiply(y, scale);
+        z = XMVectorMultiply(z, scale);
+    }
+}
+
+//======================================
+// RigidBodySoA
+//======================================
+void RigidBodySoA::Resize(size_t size)
+{
+    for (std::vector<float>* array : {
+        &posX, &posY, &posZ, &rotX, &rotY, &rotZ, &rotW,
+        &prevPosX, &prevPosY, &prevPosZ, &prevRotX, &prevRotY, &prevRotZ, &prevRotW,
+        &velX, &velY, &velZ, &angVelX, &angVelY, &angVelZ,
+        &forceX, &forceY, &forceZ, &torqueX, &torqueY, &torqueZ,
+        &invMass, &invInertiaX, &invInertiaY, &invInertiaZ,
+        &gravityX, &gravityY, &gravityZ, &linearDrag, &angularDrag,
+        &maxLinearVelocity, &maxAngularVelocity,
+        &linearFactorX, &linearFactorY, &linearFactorZ,
+        &angularFactorX, &angularFactorY, &angularFactorZ,
+        &sleepThreshold, &sleepTimer, &ignoreCollisionTimer })
+    {
+        array->resize(size, 0.0f);
+    }
+    flags.resize(size, 0);
+}
+
+//======================================
+// スロット管理
+//======================================
+int RigidBodyStore::Create()
+{
+    if (g_FreeHandles.empty())
+    {
+        // SIMD幅単位で拡張し、若い番号から使われるよう逆順に積む
+        const int oldSize = static_cast<int>(g_Bodies.flags.size());
+        g_Bodies.Resize(static_cast<size_t>(oldSize + SIMD_WIDTH));
+        for (int i = oldSize + SIMD_WIDTH - 1; i >= oldSize; --i)
+        {
+            g_FreeHandles.push_back(i);
+        }
+    }
+
+    const int handle = g_FreeHandles.back();
+    g_FreeHandles.pop_back();
+
+    g_Bodies.SetPosition(handle, { 0.0f, 0.0f, 0.0f });
+    g_Bodies.SetRotation(handle, { 0.0f, 0.0f, 0.0f, 1.0f });
+    g_Bodies.ResetInterpolation(handle);
+    g_Bodies.SetVelocity(handle, { 0.0f, 0.0f, 0.0f });
+    g_Bodies.SetAngularVelocity(handle, { 0.0f, 0.0f, 0.0f });
+    g_Bodies.SetForce(handle, { 0.0f, 0.0f, 0.0f });
+    g_Bodies.SetTorque(handle, { 0.0f, 0.0f, 0.0f });
+    g_Bodies.invMass[handle] = 1.0f;
+    g_Bodies.SetInvInertia(handle, { 1.0f, 1.0f, 1.0f });
+    g_Bodies.SetGravity(handle, { 0.0f, 0.0f, 0.0f });
+    g_Bodies.linearDrag[handle] = 0.0f;
+    g_Bodies.angularDrag[handle] = 0.0f;
+    g_Bodies.maxLinearVelocity[handle] = 0.0f;
+    g_Bodies.maxAngularVelocity[handle] = 0.0f;
+    g_Bodies.SetLinearFactor(handle, { 1.0f, 1.0f, 1.0f });
+    g_Bodies.SetAngularFactor(handle, { 1.0f, 1.0f, 1.0f });
+    g_Bodies.sleepThreshold[handle] = 0.0f;
+    g_Bodies.sleepTimer[handle] = 0.0f;
+    g_Bodies.ignoreCollisionTimer[handle] = 0.0f;
+    g_Bodies.flags[handle] = RigidBodySoA::FLAG_ALIVE;
+
+    ++g_ActiveCount;
+    return handle;
+}
+
+void RigidBodyStore::Destroy(int handle)
+{
+    if (handle < 0 || handle >= static_cast<int>(g_Bodies.flags.size())) return;
+    if (!g_Bodies.HasFlag(handle, RigidBodySoA::FLAG_ALIVE)) return;
+
+    // 空きレーンはバッチ内でマスクされるが、念のため速度も消しておく
+    g_Bodies.flags[handle] = 0;
+    g_Bodies.SetVelocity(handle, { 0.0f, 0.0f, 0.0f });
+    g_Bodies.SetAngularVelocity(handle, { 0.0f, 0.0f, 0.0f });
+
+    g_FreeHandles.push_back(handle);
+    --g_ActiveCount;
+}
+
+RigidBodySoA& RigidBodyStore::GetData()
+{
+    return g_Bodies;
+}
+
+int RigidBodyStore::GetActiveCount()
+{
+    return g_ActiveCount;
+}
+
+//======================================
+// 描画補間
+//======================================
+void RigidBodyStore::SaveInterpolationState()
+{
+    // 配列長は同じなので再確保は起きない
+    g_Bodies.prevPosX = g_Bodies.posX;
+    g_Bodies.prevPosY = g_Bodies.posY;
+    g_Bodies.prevPosZ = g_Bodies.posZ;
+    g_Bodies.prevRotX = g_Bodies.rotX;
+    g_Bodies.prevRotY = g_Bodies.rotY;
+    g_Bodies.prevRotZ = g_Bodies.rotZ;
+    g_Bodies.prevRotW = g_Bodies.rotW;
+}
+
+//======================================
+// 積分
+//======================================
+void RigidBodyStore::Integrate(float dt)
+{
+    if (dt <= 0.0f) return;
+    dt = std::min(dt, RigidBody::MAX_DELTA_TIME);
+
+    // バッチ同士は別レーンしか触らないため、スレッド数に関わらず結果は同じ
+    const int batchCount = static_cast<int>(g_Bodies.flags.size()) / SIMD_WIDTH;
+    PhysicsJobSystem::ParallelFor(batchCount, INTEGRATE_BATCHES_PER_JOB, [dt](int begin, int end, int) {
+        for (int batch = begin; batch < end; ++batch)
+        {
+            IntegrateBatch(batch * SIMD_WIDTH, dt);
+        }
+    });
+}
+
+void RigidBodyStore::IntegrateBatch(int base, float dt)
+{
+    RigidBodySoA& s = g_Bodies;
+
+    // 衝突無視タイマーは全レーンで減算
+    const XMVECTOR vDt = XMVectorReplicate(dt);
+    Store4(s.ignoreCollisionTimer, base, XMVectorMax(XMVectorSubtract(Load4(s.ignoreCollisionTimer, base), vDt), XMVectorZero()));
+
+    // レーンマスク（使用中かつ動的かつ起きている剛体のみ積分）
+    uint32_t activeBits[SIMD_WIDTH];
+    uint32_t groundBits[SIMD_WIDTH];
+    bool anyActive = false;
+    for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+    {
+        const uint8_t f = s.flags[base + lane];
+        const bool active = (f & RigidBodySoA::FLAG_ALIVE) && !(f & (RigidBodySoA::FLAG_KINEMATIC | RigidBodySoA::FLAG_SLEEPING));
+        activeBits[lane] = active ? 0xFFFFFFFFu : 0u;
+        groundBits[lane] = (f & RigidBodySoA::FLAG_GROUND_CONTACT) ? 0xFFFFFFFFu : 0u;
+        anyActive |= active;
+    }
+
+    float energy[SIMD_WIDTH] = {};
+
+    if (anyActive)
+    {
+        const XMVECTOR activeMask = XMVectorSetInt(activeBits[0], activeBits[1], activeBits[2], activeBits[3]);
+        const XMVECTOR groundMask = XMVectorSetInt(groundBits[0], groundBits[1], groundBits[2], groundBits[3]);
+        const XMVECTOR zero = XMVectorZero();
+
+        XMVECTOR px = Load4(s.posX, base), py = Load4(s.posY, base), pz = Load4(s.posZ, base);
+        XMVECTOR qx = Load4(s.rotX, base), qy = Load4(s.rotY, base), qz = Load4(s.rotZ, base), qw = Load4(s.rotW, base);
+        XMVECTOR vx = Load4(s.velX, base), vy = Load4(s.velY, base), vz = Load4(s.velZ, base);
+        XMVECTOR wx = Load4(s.angVelX, base), wy = Load4(s.angVelY, base), wz = Load4(s.angVelZ, base);
+
+        const XMVECTOR lfx = Load4(s.linearFactorX, base), lfy = Load4(s.linearFactorY, base), lfz = Load4(s.linearFactorZ, base);
+        const XMVECTOR afx = Load4(s.angularFactorX, base), afy = Load4(s.angularFactorY, base), afz = Load4(s.angularFactorZ, base);
+        const XMVECTOR invMass = Load4(s.invMass, base);
+
+        // 加速度（拘束軸の外力を除外してから重力を加算）
+        XMVECTOR ax = XMVectorAdd(XMVectorMultiply(XMVectorMultiply(Load4(s.forceX, base), lfx), invMass), Load4(s.gravityX, base));
+        XMVECTOR ay = XMVectorAdd(XMVectorMultiply(XMVectorMultiply(Load4(s.forceY, base), lfy), invMass), Load4(s.gravityY, base));
+        XMVECTOR az = XMVectorAdd(XMVectorMultiply(XMVectorMultiply(Load4(s.forceZ, base), lfz), invMass), Load4(s.gravityZ, base));
+
+        // 角加速度：ローカルへ戻して対角逆慣性を掛け、ワールドへ回転
+        XMVECTOR tx = XMVectorMultiply(Load4(s.torqueX, base), afx);
+        XMVECTOR ty = XMVectorMultiply(Load4(s.torqueY, base), afy);
+        XMVECTOR tz = XMVectorMultiply(Load4(s.torqueZ, base), afz);
+        RotateSoA(XMVectorNegate(qx), XMVectorNegate(qy), XMVectorNegate(qz), qw, tx, ty, tz);
+        tx = XMVectorMultiply(tx, Load4(s.invInertiaX, base));
+        ty = XMVectorMultiply(ty, Load4(s.invInertiaY, base));
+        tz = XMVectorMultiply(tz, Load4(s.invInertiaZ, base));
+        RotateSoA(qx, qy, qz, qw, tx, ty, tz);
+
+        // 速度更新
+        vx = XMVectorAdd(vx, XMVectorMultiply(ax, vDt));
+        vy = XMVectorAdd(vy, XMVectorMultiply(ay, vDt));
+        vz = XMVectorAdd(vz, XMVectorMultiply(az, vDt));
+        wx = XMVectorAdd(wx, XMVectorMultiply(tx, vDt));
+        wy = XMVectorAdd(wy, XMVectorMultiply(ty, vDt));
+        wz = XMVectorAdd(wz, XMVectorMultiply(tz, vDt));
+
+        // 減衰
+        const XMVECTOR linearDamp = XMVectorExpE(XMVectorMultiply(Load4(s.linearDrag, base), XMVectorNegate(vDt)));
+        const XMVECTOR angularDamp = XMVectorExpE(XMVectorMultiply(Load4(s.angularDrag, base), XMVectorNegate(vDt)));
+        vx = XMVectorMultiply(vx, linearDamp);
+        vy = XMVectorMultiply(vy, linearDamp);
+        vz = XMVectorMultiply(vz, linearDamp);
+        wx = XMVectorMultiply(wx, angularDamp);
+        wy = XMVectorMultiply(wy, angularDamp);
+        wz = XMVectorMultiply(wz, angularDamp);
+
+        // 微小速度カット（接地時のみ線形速度をカット）
+        const XMVECTOR cutoff = XMVectorReplicate(RigidBody::VELOCITY_CUTOFF);
+        const XMVECTOR cutLinear = XMVectorAndInt(groundMask, XMVectorLess(LengthSqSoA(vx, vy, vz), cutoff));
+        const XMVECTOR cutAngular = XMVectorLess(LengthSqSoA(wx, wy, wz), cutoff);
+        vx = XMVectorSelect(vx, zero, cutLinear);
+        vy = XMVectorSelect(vy, zero, cutLinear);
+        vz = XMVectorSelect(vz, zero, cutLinear);
+        wx = XMVectorSelect(wx, zero, cutAngular);
+        wy = XMVectorSelect(wy, zero, cutAngular);
+        wz = XMVectorSelect(wz, zero, cutAngular);
+
+        // 速度制限と軸拘束
+        ClampMagnitudeSoA(vx, vy, vz, Load4(s.maxLinearVelocity, base));
+        ClampMagnitudeSoA(wx, wy, wz, Load4(s.maxAngularVelocity, base));
+        vx = XMVectorMultiply(vx, lfx);
+        vy = XMVectorMultiply(vy, lfy);
+        vz = XMVectorMultiply(vz, lfz);
+        wx = XMVectorMultiply(wx, afx);
+        wy = XMVectorMultiply(wy, afy);
+        wz = XMVectorMultiply(wz, afz);
+
+        // 位置更新
+        px = XMVectorAdd(px, XMVectorMultiply(vx, vDt));
+        py = XMVectorAdd(py, XMVectorMultiply(vy, vDt));
+        pz = XMVectorAdd(pz, XMVectorMultiply(vz, vDt));
+
+        // 回転更新（1フレームの回転角を制限）
+        const XMVECTOR angSpeedSq = LengthSqSoA(wx, wy, wz);
+        const XMVECTOR rotateMask = XMVectorGreater(angSpeedSq, XMVectorReplicate(1e-8f));
+        const XMVECTOR angSpeed = XMVectorSqrt(angSpeedSq);
+        const XMVECTOR invAngSpeed = XMVectorSelect(zero, XMVectorReciprocal(angSpeed), rotateMask);
+        const XMVECTOR theta = XMVectorMin(XMVectorMultiply(angSpeed, vDt), XMVectorReplicate(RigidBody::MAX_ROTATION_PER_FRAME));
+
+        XMVECTOR sinHalf, cosHalf;
+        XMVectorSinCos(&sinHalf, &cosHalf, XMVectorScale(theta, 0.5f));
+        const XMVECTOR axisScale = XMVectorMultiply(invAngSpeed, sinHalf);
+        const XMVECTOR dx = XMVectorMultiply(wx, axisScale);
+        const XMVECTOR dy = XMVectorMultiply(wy, axisScale);
+        const XMVECTOR dz = XMVectorMultiply(wz, axisScale);
+        const XMVECTOR dw = cosHalf;
+
+        // XMQuaternionMultiply(qDelta, qRot) と同じ合成順
+        XMVECTOR nx = XMVectorAdd(XMVectorAdd(XMVectorMultiply(qw, dx), XMVectorMultiply(qx, dw)), XMVectorSubtract(XMVectorMultiply(qy, dz), XMVectorMultiply(qz, dy)));
+        XMVECTOR ny = XMVectorAdd(XMVectorAdd(XMVectorMultiply(qw, dy), XMVectorMultiply(qy, dw)), XMVectorSubtract(XMVectorMultiply(qz, dx), XMVectorMultiply(qx, dz)));
+        XMVECTOR nz = XMVectorAdd(XMVectorAdd(XMVectorMultiply(qw, dz), XMVectorMultiply(qz, dw)), XMVectorSubtract(XMVectorMultiply(qx, dy), XMVectorMultiply(qy, dx)));
+        XMVECTOR nw = XMVectorSubtract(XMVectorMultiply(qw, dw), XMVectorAdd(XMVectorMultiply(qx, dx), XMVectorAdd(XMVectorMultiply(qy, dy), XMVectorMultiply(qz, dz))));
+
+        const XMVECTOR invNorm = XMVectorReciprocalSqrt(XMVectorAdd(LengthSqSoA(nx, ny, nz), XMVectorMultiply(nw, nw)));
+        qx = XMVectorSelect(qx, XMVectorMultiply(nx, invNorm), rotateMask);
+        qy = XMVectorSelect(qy, XMVectorMultiply(ny, invNorm), rotateMask);
+        qz = XMVectorSelect(qz, XMVectorMultiply(nz, invNorm), rotateMask);
+        qw = XMVectorSelect(qw, XMVectorMultiply(nw, invNorm), rotateMask);
+
+        // 積分したレーンのみ書き戻す
+        Store4(s.posX, base, XMVectorSelect(Load4(s.posX, base), px, activeMask));
+        Store4(s.posY, base, XMVectorSelect(Load4(s.posY, base), py, activeMask));
+        Store4(s.posZ, base, XMVectorSelect(Load4(s.posZ, base), pz, activeMask));
+        Store4(s.rotX, base, XMVectorSelect(Load4(s.rotX, base), qx, activeMask));
+        Store4(s.rotY, base, XMVectorSelect(Load4(s.rotY, base), qy, activeMask));
+        Store4(s.rotZ, base, XMVectorSelect(Load4(s.rotZ, base), qz, activeMask));
+        Store4(s.rotW, base, XMVectorSelect(Load4(s.rotW, base), qw, activeMask));
+        Store4(s.velX, base, XMVectorSelect(Load4(s.velX, base), vx, activeMask));
+        Store4(s.velY, base, XMVectorSelect(Load4(s.velY, base), vy, activeMask));
+        Store4(s.velZ, base, XMVectorSelect(Load4(s.velZ, base), vz, activeMask));
+        Store4(s.angVelX, base, XMVectorSelect(Load4(s.angVelX, base), wx, activeMask));
+        Store4(s.angVelY, base, XMVectorSelect(Load4(s.angVelY, base), wy, activeMask));
+        Store4(s.angVelZ, base, XMVectorSelect(Load4(s.angVelZ, base), wz, activeMask));
+
+        XMFLOAT4 energy4;
+        XMStoreFloat4(&energy4, XMVectorAdd(LengthSqSoA(vx, vy, vz), LengthSqSoA(wx, wy, wz)));
+        energy[0] = energy4.x;
+        energy[1] = energy4.y;
+        energy[2] = energy4.z;
+        energy[3] = energy4.w;
+    }
+
+    // 外力の蓄積・接地フラグは毎フレームリセット（スリープ遷移は分岐が多いためレーンごと）
+    const XMVECTOR zero = XMVectorZero();
+    Store4(s.forceX, base, zero);
+    Store4(s.forceY, base, zero);
+    Store4(s.forceZ, base, zero);
+    Store4(s.torqueX, base, zero);
+    Store4(s.torqueY, base, zero);
+    Store4(s.torqueZ, base, zero);
+
+    for (int lane = 0; lane < SIMD_WIDTH; ++lane)
+    {
+        const int index = base + lane;
+        if (activeBits[lane])
+        {
+            UpdateSleepState(index, energy[lane], dt);
+        }
+        s.SetFlag(index, RigidBodySoA::FLAG_GROUND_CONTACT, false);
+    }
+}
+
+//======================================
+// スリープ判定
+//======================================
+void RigidBodyStore::UpdateSleepState(int index, float energy, float dt)
+{
+    RigidBodySoA& s = g_Bodies;
+    const bool isResting = energy < s.sleepThreshold[index] * RigidBody::SLEEP_ENERGY_BIAS;
+
+    // アイランド管理下：静止時間の計測のみ行い、スリープ遷移はアイランド単位で判定
+    if (s.HasFlag(index, RigidBodySoA::FLAG_ISLAND_SLEEP))
+    {
+        s.sleepTimer[index] = isResting ? s.sleepTimer[index] + dt : 0.0f;
+        return;
+    }
+
+    // 接地していない場合はスリープしない
+    if (!s.HasFlag(index, RigidBodySoA::FLAG_GROUND_CONTACT) || !isResting)
+    {
+        s.sleepTimer[index] = 0.0f;
+        return;
+    }
+
+    s.sleepTimer[index] += dt;
+    if (s.sleepTimer[index] > RigidBody::SLEEP_TIME_THRESHOLD)
+    {
+        s.SetFlag(index, RigidBodySoA::FLAG_SLEEPING, true);
+        s.SetVelocity(index, { 0.0f, 0.0f, 0.0f });
+        s.SetAngularVelocity(index, { 0.0f, 0.0f, 0.0f });
+    }
+}
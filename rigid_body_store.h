@@ -0,0 +1,139 @@
+﻿/****************************************
+ * @file rigid_body_store.h
+ * @brief 剛体状態の一元管理（SoA配置）
+ * @detail 位置・速度・姿勢・逆質量などを成分ごとの配列で保持し、積分を4体ずつSIMDでまとめて行う
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 描画補間用に直前ステップの姿勢を保持
+ ****************************************/
+
+#ifndef RIGID_BODY_STORE_H
+#define RIGID_BODY_STORE_H
+
+#include <DirectXMath.h>
+#include <vector>
+#include <cstdint>
+
+//--------------------------------------
+// 剛体状態の成分別配列（添字 = ハンドル）
+//--------------------------------------
+struct RigidBodySoA
+{
+    // 状態フラグ
+    static constexpr uint8_t FLAG_ALIVE = 1 << 0;           // 使用中スロット
+    static constexpr uint8_t FLAG_KINEMATIC = 1 << 1;       // 積分しない
+    static constexpr uint8_t FLAG_SLEEPING = 1 << 2;
+    static constexpr uint8_t FLAG_GROUND_CONTACT = 1 << 3;  // 今フレームの接地通知
+    static constexpr uint8_t FLAG_ISLAND_SLEEP = 1 << 4;    // スリープ遷移を接触アイランドに委ねる
+
+    // 姿勢
+    std::vector<float> posX, posY, posZ;
+    std::vector<float> rotX, rotY, rotZ, rotW;
+
+    // 直前ステップの姿勢（描画補間用）
+    std::vector<float> prevPosX, prevPosY, prevPosZ;
+    std::vector<float> prevRotX, prevRotY, prevRotZ, prevRotW;
+
+    // 速度・外力
+    std::vector<float> velX, velY, velZ;
+    std::vector<float> angVelX, angVelY, angVelZ;
+    std::vector<float> forceX, forceY, forceZ;
+    std::vector<float> torqueX, torqueY, torqueZ;
+
+    // 質量特性（ローカル逆慣性テンソルは対角成分のみ）
+    std::vector<float> invMass;
+    std::vector<float> invInertiaX, invInertiaY, invInertiaZ;
+
+    // 積分パラメータ
+    std::vector<float> gravityX, gravityY, gravityZ;        // 重力加速度（無効時は0）
+    std::vector<float> linearDrag, angularDrag;
+    std::vector<float> maxLinearVelocity, maxAngularVelocity;
+    std::vector<float> linearFactorX, linearFactorY, linearFactorZ;     // 軸拘束（0=固定）
+    std::vector<float> angularFactorX, angularFactorY, angularFactorZ;
+
+    // スリープ・衝突制御
+    std::vector<float> sleepThreshold;
+    std::vector<float> sleepTimer;
+    std::vector<float> ignoreCollisionTimer;
+    std::vector<uint8_t> flags;
+
+    bool HasFlag(int index, uint8_t flag) const { return (flags[index] & flag) != 0; }
+    void SetFlag(int index, uint8_t flag, bool enabled)
+    {
+        if (enabled) flags[index] |= flag;
+        else flags[index] &= static_cast<uint8_t>(~flag);
+    }
+
+    DirectX::XMFLOAT3 GetPosition(int i) const { return { posX[i], posY[i], posZ[i] }; }
+    DirectX::XMFLOAT4 GetRotation(int i) const { return { rotX[i], rotY[i], rotZ[i], rotW[i] }; }
+    DirectX::XMFLOAT3 GetVelocity(int i) const { return { velX[i], velY[i], velZ[i] }; }
+    DirectX::XMFLOAT3 GetAngularVelocity(int i) const { return { angVelX[i], angVelY[i], angVelZ[i] }; }
+    DirectX::XMFLOAT3 GetForce(int i) const { return { forceX[i], forceY[i], forceZ[i] }; }
+    DirectX::XMFLOAT3 GetTorque(int i) const { return { torqueX[i], torqueY[i], torqueZ[i] }; }
+    DirectX::XMFLOAT3 GetInvInertia(int i) const { return { invInertiaX[i], invInertiaY[i], invInertiaZ[i] }; }
+    DirectX::XMFLOAT3 GetPrevPosition(int i) const { return { prevPosX[i], prevPosY[i], prevPosZ[i] }; }
+    DirectX::XMFLOAT4 GetPrevRotation(int i) const { return { prevRotX[i], prevRotY[i], prevRotZ[i], prevRotW[i] }; }
+
+    void SetPosition(int i, const DirectX::XMFLOAT3& v) { posX[i] = v.x; posY[i] = v.y; posZ[i] = v.z; }
+    void SetRotation(int i, const DirectX::XMFLOAT4& q) { rotX[i] = q.x; rotY[i] = q.y; rotZ[i] = q.z; rotW[i] = q.w; }
+    void SetVelocity(int i, const DirectX::XMFLOAT3& v) { velX[i] = v.x; velY[i] = v.y; velZ[i] = v.z; }
+    void SetAngularVelocity(int i, const DirectX::XMFLOAT3& v) { angVelX[i] = v.x; angVelY[i] = v.y; angVelZ[i] = v.z; }
+    void SetForce(int i, const DirectX::XMFLOAT3& v) { forceX[i] = v.x; forceY[i] = v.y; forceZ[i] = v.z; }
+    void SetTorque(int i, const DirectX::XMFLOAT3& v) { torqueX[i] = v.x; torqueY[i] = v.y; torqueZ[i] = v.z; }
+    void SetInvInertia(int i, const DirectX::XMFLOAT3& v) { invInertiaX[i] = v.x; invInertiaY[i] = v.y; invInertiaZ[i] = v.z; }
+    void SetGravity(int i, const DirectX::XMFLOAT3& v) { gravityX[i] = v.x; gravityY[i] = v.y; gravityZ[i] = v.z; }
+    void SetLinearFactor(int i, const DirectX::XMFLOAT3& v) { linearFactorX[i] = v.x; linearFactorY[i] = v.y; linearFactorZ[i] = v.z; }
+    void SetAngularFactor(int i, const DirectX::XMFLOAT3& v) { angularFactorX[i] = v.x; angularFactorY[i] = v.y; angularFactorZ[i] = v.z; }
+
+    // 現在の姿勢を直前ステップの姿勢として記録（瞬間移動時に補間させない）
+    void ResetInterpolation(int i)
+    {
+        prevPosX[i] = posX[i]; prevPosY[i] = posY[i]; prevPosZ[i] = posZ[i];
+        prevRotX[i] = rotX[i]; prevRotY[i] = rotY[i]; prevRotZ[i] = rotZ[i]; prevRotW[i] = rotW[i];
+    }
+    void ResetPositionInterpolation(int i) { prevPosX[i] = posX[i]; prevPosY[i] = posY[i]; prevPosZ[i] = posZ[i]; }
+
+    void Resize(size_t size);
+};
+
+//--------------------------------------
+// 剛体ストア
+//--------------------------------------
+class RigidBodyStore
+{
+public:
+    // SIMDのレーン数（配列長は常にこの倍数）
+    static constexpr int SIMD_WIDTH = 4;
+
+    /**
+     * @brief スロットを確保し既定値で初期化
+     * @return ハンドル（配列添字）
+     */
+    static int Create();
+
+    /**
+     * @brief スロットを解放（ハンドルは再利用される）
+     */
+    static void Destroy(int handle);
+
+    /**
+     * @brief 全剛体を積分（外力・重力・減衰・速度制限・姿勢更新・スリープ判定）
+     * @detail キネマティック・スリープ中・未使用のレーンはマスクして値を保持する
+     */
+    static void Integrate(float dt);
+
+    /**
+     * @brief 全剛体の現在の姿勢を直前ステップの姿勢として保存
+     * @detail 固定ステップの先頭で呼び、描画時に前後2ステップを補間する
+     */
+    static void SaveInterpolationState();
+
+    static RigidBodySoA& GetData();
+    static int GetActiveCount();
+
+private:
+    static void IntegrateBatch(int base, float dt);
+    static void UpdateSleepState(int index, float energy, float dt);
+};
+
+#endif // RIGID_BODY_STORE_H
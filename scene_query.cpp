@@ -0,0 +1,576 @@
+﻿/****************************************
+ * @file scene_query.cpp
+ * @brief シーン全体への空間問い合わせの実装
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 四角形との重なり問い合わせ
+ * @update 2026/10/18 - 静的オブジェクトの登録をマップの変更分だけ更新
+ ****************************************/
+
+#include "scene_query.h"
+#include "dynamic_aabb_tree.h"
+#include "collision_packet.h"
+#include "map.h"
+#include "ray.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+//======================================
+// 内部データ
+//======================================
+namespace
+{
+    /**
+     * @struct SceneProxy
+     * @brief 登録1件分の情報（添字はツリーのプロキシIDと一致）
+     * @detail aabb は問い合わせに使う反映済みの境界、pendingAABB は次の更新で反映する境界
+     */
+    struct SceneProxy
+    {
+        uint32_t type = SceneObjectType::None;
+        uint32_t layer = CollisionLayer::None;
+        void* userData = nullptr;
+        int mapIndex = -1;
+        AABB aabb{};
+        AABB pendingAABB{};
+        bool isDirty = false;
+        bool isAlive = false;
+    };
+
+    /**
+     * @struct StaticEntry
+     * @brief マップのオブジェクト1件に対応する静的プロキシ（マップの並び順で保持）
+     * @detail マップの変更後に同じオブジェクトかを見分けるため、登録時の内容を控えておく
+     */
+    struct StaticEntry
+    {
+        int proxyId = -1;
+        int kindId = 0;
+        uint32_t layer = CollisionLayer::None;
+        AABB aabb{};
+        const MeshCollider* mesh = nullptr;
+    };
+
+    DynamicAABBTree g_Tree;
+    std::vector<SceneProxy> g_Proxies;
+    std::vector<int> g_DirtyProxies;
+    std::vector<StaticEntry> g_StaticEntries;
+    std::vector<StaticEntry> g_NextStaticEntries;   // 作業用
+    int g_MapRevision = -1;
+
+    XMFLOAT3 GetCenter(const AABB& aabb)
+    {
+        return {
+            (aabb.min.x + aabb.max.x) * 0.5f,
+            (aabb.min.y + aabb.max.y) * 0.5f,
+            (aabb.min.z + aabb.max.z) * 0.5f
+        };
+    }
+
+    AABB MergeAABB(const AABB& a, const AABB& b)
+    {
+        AABB result;
+        result.min = { std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z) };
+        result.max = { std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z) };
+        return result;
+    }
+
+    AABB OffsetAABB(const AABB& aabb, const XMFLOAT3& offset)
+    {
+        AABB result = aabb;
+        result.min.x += offset.x; result.min.y += offset.y; result.min.z += offset.z;
+        result.max.x += offset.x; result.max.y += offset.y; result.max.z += offset.z;
+        return result;
+    }
+
+    AABB SphereBounds(const XMFLOAT3& center, float radius)
+    {
+        AABB result;
+        result.min = { center.x - radius, center.y - radius, center.z - radius };
+        result.max = { center.x + radius, center.y + radius, center.z + radius };
+        return result;
+    }
+
+    /**
+     * @brief 交差点から当たった面の法線を推定（始点が箱の中ならレイの逆向き）
+     */
+    XMFLOAT3 GetFaceNormal(const AABB& aabb, const XMFLOAT3& point, const XMFLOAT3& direction, float distance)
+    {
+        if (distance <= 0.0f)
+        {
+            XMFLOAT3 normal;
+            XMStoreFloat3(&normal, XMVector3Normalize(XMVectorNegate(XMLoadFloat3(&direction))));
+            return normal;
+        }
+
+        const float faceDist[6] = {
+            std::fabs(point.x - aabb.min.x), std::fabs(point.x - aabb.max.x),
+            std::fabs(point.y - aabb.min.y), std::fabs(point.y - aabb.max.y),
+            std::fabs(point.z - aabb.min.z), std::fabs(point.z - aabb.max.z)
+        };
+        static const XMFLOAT3 FACE_NORMALS[6] = {
+            { -1, 0, 0 }, { 1, 0, 0 }, { 0, -1, 0 }, { 0, 1, 0 }, { 0, 0, -1 }, { 0, 0, 1 }
+        };
+
+        int best = 0;
+        for (int i = 1; i < 6; ++i)
+        {
+            if (faceDist[i] < faceDist[best]) best = i;
+        }
+        return FACE_NORMALS[best];
+    }
+
+    void FillHit(SceneQueryHit& hit, const SceneProxy& proxy)
+    {
+        hit.type = proxy.type;
+        hit.layer = proxy.layer;
+        hit.userData = proxy.userData;
+        hit.mapIndex = proxy.mapIndex;
+    }
+
+    void FillRayHit(SceneQueryHit& hit, const SceneProxy& proxy, const Ray& ray, float distance)
+    {
+        FillHit(hit, proxy);
+
+        const XMFLOAT3 origin = ray.GetOrigin();
+        const XMFLOAT3 direction = ray.GetDirection();
+        hit.distance = distance;
+        hit.point = { origin.x + direction.x * distance, origin.y + direction.y * distance, origin.z + direction.z * distance };
+        hit.normal = GetFaceNormal(proxy.aabb, hit.point, direction, distance);
+    }
+
+    bool IsSameObject(const StaticEntry& entry, const MapObject& object)
+    {
+        return entry.kindId == object.KindId && entry.layer == object.Layer && entry.mesh == object.Mesh &&
+            entry.aabb.min.x == object.Aabb.min.x && entry.aabb.min.y == object.Aabb.min.y && entry.aabb.min.z == object.Aabb.min.z &&
+            entry.aabb.max.x == object.Aabb.max.x && entry.aabb.max.y == object.Aabb.max.y && entry.aabb.max.z == object.Aabb.max.z;
+    }
+
+    /**
+     * @brief マップの構成が変わっていれば、変わった分だけ静的オブジェクトの登録を更新する
+     * @detail マップの除去は残りの並び順を保ち、追加は末尾に行う。そのため前回の並びと先頭から突き合わせ、
+     *         一致しなかった登録は除去されたもの、突き合わせ後に残ったオブジェクトは追加されたものとして扱う。
+     *         変わらなかったオブジェクトはツリーに触れず、振り直された添字だけを書き換える
+     */
+    void SyncStaticObjects()
+    {
+        const int revision = Map_GetRevision();
+        if (revision == g_MapRevision) return;
+        g_MapRevision = revision;
+
+        const int count = Map_GetObjectCount();
+        g_NextStaticEntries.clear();
+        g_NextStaticEntries.reserve(count);
+
+        size_t oldIndex = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            const MapObject* object = Map_GetObject(i);
+            if (!object) continue;
+
+            while (oldIndex < g_StaticEntries.size() && !IsSameObject(g_StaticEntries[oldIndex], *object))
+            {
+                SceneQuery_DestroyProxy(g_StaticEntries[oldIndex].proxyId);
+                ++oldIndex;
+            }
+
+            StaticEntry entry;
+            if (oldIndex < g_StaticEntries.size())
+            {
+                entry = g_StaticEntries[oldIndex++];
+            }
+            else
+            {
+                entry.proxyId = SceneQuery_CreateProxy(SceneObjectType::Static, nullptr, object->Aabb, object->Layer);
+                entry.kindId = object->KindId;
+                entry.layer = object->Layer;
+                entry.aabb = object->Aabb;
+                entry.mesh = object->Mesh;
+            }
+            g_Proxies[entry.proxyId].mapIndex = i;
+            g_NextStaticEntries.push_back(entry);
+        }
+
+        for (; oldIndex < g_StaticEntries.size(); ++oldIndex)
+        {
+            SceneQuery_DestroyProxy(g_StaticEntries[oldIndex].proxyId);
+        }
+        g_StaticEntries.swap(g_NextStaticEntries);
+    }
+
+    /**
+     * @brief 重なり問い合わせの共通部分（ツリーで候補を絞り、test で厳密判定）
+     */
+    template<typename Test>
+    void OverlapQuery(const AABB& bounds, const SceneQueryFilter& filter, std::vector<SceneQueryHit>& outHits, Test&& test)
+    {
+        outHits.clear();
+
+        g_Tree.Query(bounds, [&](int proxyId)
+        {
+            const SceneProxy& proxy = g_Proxies[proxyId];
+            if (filter.Accepts(proxy.layer, proxy.type) && test(proxy.aabb))
+            {
+                SceneQueryHit& hit = outHits.emplace_back();
+                FillHit(hit, proxy);
+                hit.point = GetCenter(proxy.aabb);
+            }
+            return true;
+        });
+    }
+
+    /**
+     * @brief スイープの共通部分（移動範囲の境界で候補を絞り、sweep で最初の当たりを探す）
+     */
+    template<typename Sweep>
+    bool SweepQuery(const AABB& startBounds, const XMFLOAT3& displacement, const SceneQueryFilter& filter,
+        SceneQueryHit* outHit, Sweep&& sweep)
+    {
+        const AABB bounds = MergeAABB(startBounds, OffsetAABB(startBounds, displacement));
+
+        int bestProxy = -1;
+        SweepHit best;
+
+        g_Tree.Query(bounds, [&](int proxyId)
+        {
+            const SceneProxy& proxy = g_Proxies[proxyId];
+            if (!filter.Accepts(proxy.layer, proxy.type)) return true;
+
+            const SweepHit hit = sweep(proxy.aabb);
+            if (hit.isHit && hit.time < best.time)
+            {
+                best = hit;
+                bestProxy = proxyId;
+            }
+            return true;
+        });
+
+        if (bestProxy < 0) return false;
+
+        if (outHit)
+        {
+            *outHit = SceneQueryHit{};
+            FillHit(*outHit, g_Proxies[bestProxy]);
+            outHit->distance = best.time;
+            outHit->normal = best.normal;
+        }
+        return true;
+    }
+}
+
+//======================================
+// 初期化・終了
+//======================================
+void SceneQuery_Initialize()
+{
+    g_Tree.Clear();
+    g_Proxies.clear();
+    g_DirtyProxies.clear();
+    g_StaticEntries.clear();
+    g_NextStaticEntries.clear();
+    g_MapRevision = -1;
+}
+
+void SceneQuery_Finalize()
+{
+    SceneQuery_Initialize();
+}
+
+//======================================
+// 更新
+//======================================
+void SceneQuery_Update()
+{
+    SyncStaticObjects();
+
+    for (int proxyId : g_DirtyProxies)
+    {
+        SceneProxy& proxy = g_Proxies[proxyId];
+        if (!proxy.isAlive || !proxy.isDirty) continue;
+
+        // 中心の移動量を先読み方向として渡す
+        const XMFLOAT3 oldCenter = GetCenter(proxy.aabb);
+        const XMFLOAT3 newCenter = GetCenter(proxy.pendingAABB);
+        const XMFLOAT3 displacement{ newCenter.x - oldCenter.x, newCenter.y - oldCenter.y, newCenter.z - oldCenter.z };
+
+        g_Tree.MoveProxy(proxyId, proxy.pendingAABB, displacement);
+        proxy.aabb = proxy.pendingAABB;
+        proxy.isDirty = false;
+    }
+    g_DirtyProxies.clear();
+}
+
+//======================================
+// 登録
+//======================================
+int SceneQuery_CreateProxy(uint32_t type, void* userData, const AABB& aabb, uint32_t layer)
+{
+    const int proxyId = g_Tree.CreateProxy(aabb, userData);
+    if (proxyId >= static_cast<int>(g_Proxies.size()))
+    {
+        g_Proxies.resize(proxyId + 1);
+    }
+
+    SceneProxy& proxy = g_Proxies[proxyId];
+    proxy = SceneProxy{};
+    proxy.type = type;
+    proxy.layer = layer;
+    proxy.userData = userData;
+    proxy.aabb = aabb;
+    proxy.pendingAABB = aabb;
+    proxy.isAlive = true;
+    return proxyId;
+}
+
+void SceneQuery_DestroyProxy(int proxyId)
+{
+    if (proxyId < 0 || proxyId >= static_cast<int>(g_Proxies.size())) return;
+    if (!g_Proxies[proxyId].isAlive) return;
+
+    g_Tree.DestroyProxy(proxyId);
+    g_Proxies[proxyId] = SceneProxy{};
+}
+
+void SceneQuery_MoveProxy(int proxyId, const AABB& aabb)
+{
+    if (proxyId < 0 || proxyId >= static_cast<int>(g_Proxies.size())) return;
+
+    SceneProxy& proxy = g_Proxies[proxyId];
+    if (!proxy.isAlive) return;
+
+    proxy.pendingAABB = aabb;
+    if (!proxy.isDirty)
+    {
+        proxy.isDirty = true;
+        g_DirtyProxies.push_back(proxyId);
+    }
+}
+
+void SceneQuery_SetProxyLayer(int proxyId, uint32_t layer)
+{
+    if (proxyId < 0 || proxyId >= static_cast<int>(g_Proxies.size())) return;
+    if (!g_Proxies[proxyId].isAlive) return;
+
+    g_Proxies[proxyId].layer = layer;
+}
+
+//======================================
+// レイ
+//======================================
+bool SceneQuery_Raycast(const Ray& ray, float maxDistance, const SceneQueryFilter& filter, SceneQueryHit* outHit)
+{
+    int bestProxy = -1;
+    float bestDist = maxDistance;
+
+    // 見つかるたびに最大距離を縮め、遠いノードを枝刈りする
+    g_Tree.RayCast(ray, maxDistance, [&](int proxyId, float currentMax)
+    {
+        const SceneProxy& proxy = g_Proxies[proxyId];
+        if (!filter.Accepts(proxy.layer, proxy.type)) return currentMax;
+
+        float dist = 0.0f;
+        if (Collision_IntersectRayAABB(ray, proxy.aabb, &dist) && dist <= bestDist)
+        {
+            bestDist = dist;
+            bestProxy = proxyId;
+            // 始点が箱の中なら探索終了（0 を返すと打ち切られる）
+            return dist;
+        }
+        return currentMax;
+    });
+
+    if (bestProxy < 0) return false;
+
+    if (outHit)
+    {
+        *outHit = SceneQueryHit{};
+        FillRayHit(*outHit, g_Proxies[bestProxy], ray, bestDist);
+    }
+    return true;
+}
+
+void SceneQuery_RaycastAll(const Ray& ray, float maxDistance, const SceneQueryFilter& filter, std::vector<SceneQueryHit>& outHits)
+{
+    outHits.clear();
+
+    // 太らせたAABBで候補を絞り、厳密な判定はパケットが埋まるたびにまとめて行う
+    AABBPacket packet;
+    int laneProxy[CollisionPacketConfig::WIDTH];
+    alignas(32) float dist[CollisionPacketConfig::WIDTH];
+
+    auto flush = [&]()
+    {
+        if (packet.count == 0) return;
+
+        const uint32_t mask = Collision_IntersectRayAABBPacket(ray, packet, dist, maxDistance);
+        for (int lane = 0; lane < packet.count; ++lane)
+        {
+            if (mask & (1u << lane))
+            {
+                FillRayHit(outHits.emplace_back(), g_Proxies[laneProxy[lane]], ray, dist[lane]);
+            }
+        }
+        packet.Clear();
+    };
+
+    g_Tree.RayCast(ray, maxDistance, [&](int proxyId, float currentMax)
+    {
+        const SceneProxy& proxy = g_Proxies[proxyId];
+        if (filter.Accepts(proxy.layer, proxy.type))
+        {
+            laneProxy[packet.count] = proxyId;
+            packet.Push(proxy.aabb);
+            if (packet.count == CollisionPacketConfig::WIDTH) flush();
+        }
+        return currentMax;
+    });
+    flush();
+
+    std::sort(outHits.begin(), outHits.end(), [](const SceneQueryHit& a, const SceneQueryHit& b)
+    {
+        return a.distance < b.distance;
+    });
+}
+
+//======================================
+// 重なり
+//======================================
+void SceneQuery_OverlapAABB(const AABB& aabb, const SceneQueryFilter& filter, std::vector<SceneQueryHit>& outHits)
+{
+    OverlapQuery(aabb, filter, outHits, [&](const AABB& target)
+    {
+        return Collision_IsOverlapAABB(aabb, target);
+    });
+}
+
+void SceneQuery_OverlapSphere(const Sphere& sphere, const SceneQueryFilter& filter, std::vector<SceneQueryHit>& outHits)
+{
+    const float radiusSq = sphere.radius * sphere.radius;
+
+    OverlapQuery(SphereBounds(sphere.center, sphere.radius), filter, outHits, [&](const AABB& target)
+    {
+        // 箱の最近接点までの距離で判定
+        const float dx = sphere.center.x - std::clamp(sphere.center.x, target.min.x, target.max.x);
+        const float dy = sphere.center.y - std::clamp(sphere.center.y, target.min.y, target.max.y);
+        const float dz = sphere.center.z - std::clamp(sphere.center.z, target.min.z, target.max.z);
+        return dx * dx + dy * dy + dz * dz <= radiusSq;
+    });
+}
+
+void SceneQuery_OverlapOBB(const OBB& obb, const SceneQueryFilter& filter, std::vector<SceneQueryHit>& outHits)
+{
+    OverlapQuery(Collision_GetOBBBounds(obb), filter, outHits, [&](const AABB& target)
+    {
+        return Collision_IsHitOBBAABB(obb, target).isHit;
+    });
+}
+
+void SceneQuery_OverlapQuad(const XMFLOAT3 (&corners)[4], const SceneQueryFilter& filter, std::vector<SceneQueryHit>& outHits)
+{
+    AABB bounds{ corners[0], corners[0] };
+    for (const XMFLOAT3& corner : corners)
+    {
+        bounds = MergeAABB(bounds, AABB{ corner, corner });
+    }
+
+    // 面積のない三角形（刃が止まっている場合など）は判定から外す
+    Triangle tris[2];
+    int triCount = 0;
+    const int triIndices[2][3] = { { 0, 1, 2 }, { 0, 2, 3 } };
+    for (const auto& indices : triIndices)
+    {
+        Triangle& tri = tris[triCount];
+        tri.p0 = corners[indices[0]];
+        tri.p1 = corners[indices[1]];
+        tri.p2 = corners[indices[2]];
+
+        XMVECTOR normal = XMVector3Cross(XMLoadFloat3(&tri.p1) - XMLoadFloat3(&tri.p0), XMLoadFloat3(&tri.p2) - XMLoadFloat3(&tri.p0));
+        if (XMVectorGetX(XMVector3LengthSq(normal)) <= SceneQueryConfig::DEGENERATE_EPSILON) continue;
+
+        XMStoreFloat3(&tri.normal, XMVector3Normalize(normal));
+        ++triCount;
+    }
+
+    if (triCount == 0)
+    {
+        outHits.clear();
+        return;
+    }
+
+    OverlapQuery(bounds, filter, outHits, [&](const AABB& target)
+    {
+        // AABB は回転なしの OBB として三角形と分離軸判定
+        OBB box;
+        box.center = GetCenter(target);
+        box.extents = { (target.max.x - target.min.x) * 0.5f, (target.max.y - target.min.y) * 0.5f, (target.max.z - target.min.z) * 0.5f };
+        box.orientation = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+        for (int i = 0; i < triCount; ++i)
+        {
+            if (Collision_IsHitOBBTriangle(box, tris[i]).isHit) return true;
+        }
+        return false;
+    });
+}
+
+//======================================
+// スイープ
+//======================================
+bool SceneQuery_SweepSphere(const Sphere& sphere, const XMFLOAT3& displacement,
+    const SceneQueryFilter& filter, SceneQueryHit* outHit)
+{
+    const bool isHit = SweepQuery(SphereBounds(sphere.center, sphere.radius), displacement, filter, outHit, [&](const AABB& target)
+    {
+        return Collision_SweepSphereAABB(sphere, displacement, target);
+    });
+
+    // 当たり位置は接触時の球の中心から法線の逆向きへ半径分
+    if (isHit && outHit)
+    {
+        const float t = outHit->distance;
+        outHit->point = {
+            sphere.center.x + displacement.x * t - outHit->normal.x * sphere.radius,
+            sphere.center.y + displacement.y * t - outHit->normal.y * sphere.radius,
+            sphere.center.z + displacement.z * t - outHit->normal.z * sphere.radius
+        };
+    }
+    return isHit;
+}
+
+bool SceneQuery_SweepCapsule(const Capsule& capsule, const XMFLOAT3& displacement,
+    const SceneQueryFilter& filter, SceneQueryHit* outHit)
+{
+    const AABB startBounds = MergeAABB(SphereBounds(capsule.start, capsule.radius), SphereBounds(capsule.end, capsule.radius));
+
+    const bool isHit = SweepQuery(startBounds, displacement, filter, outHit, [&](const AABB& target)
+    {
+        return Collision_SweepCapsuleAABB(capsule, displacement, target);
+    });
+
+    // 当たり位置は接触時のカプセル中心から法線の逆向きへ半径分（線分上の位置は近似）
+    if (isHit && outHit)
+    {
+        const float t = outHit->distance;
+        const XMFLOAT3 center{
+            (capsule.start.x + capsule.end.x) * 0.5f,
+            (capsule.start.y + capsule.end.y) * 0.5f,
+            (capsule.start.z + capsule.end.z) * 0.5f
+        };
+        outHit->point = {
+            center.x + displacement.x * t - outHit->normal.x * capsule.radius,
+            center.y + displacement.y * t - outHit->normal.y * capsule.radius,
+            center.z + displacement.z * t - outHit->normal.z * capsule.radius
+        };
+    }
+    return isHit;
+}
+
+//======================================
+// 集計
+//======================================
+int SceneQuery_GetProxyCount()
+{
+    return g_Tree.GetProxyCount();
+}
@@ -0,0 +1,134 @@
+﻿/****************************************
+ * @file scene_query.h
+ * @brief シーン全体への空間問い合わせ（レイ・重なり・スイープ）
+ * @detail 破片・敵・プレイヤー・マップの静的オブジェクトを1本の動的AABBツリーへ登録し、
+ *         レイヤーと種別のマスクで絞り込んで問い合わせる。
+ *         所有者は移動のたびに MoveProxy で境界を渡し、ツリーへの反映は
+ *         フレームに1回の SceneQuery_Update でまとめて行う（問い合わせはその時点の姿）。
+ *         物理のブロードフェーズ（接触ペア管理）とは別に持つ
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 四角形との重なり問い合わせ
+ ****************************************/
+
+#ifndef SCENE_QUERY_H
+#define SCENE_QUERY_H
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <cfloat>
+#include <vector>
+#include "collision.h"
+#include "collider.h"
+
+class Ray;
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace SceneQueryConfig
+{
+    // 外積の長さの2乗がこれ以下の三角形は面積なしとして扱う
+    constexpr float DEGENERATE_EPSILON = 1e-10f;
+}
+
+//--------------------------------------
+// 登録種別（ビットで指定して絞り込む）
+//--------------------------------------
+namespace SceneObjectType
+{
+    constexpr uint32_t None = 0;
+    constexpr uint32_t Static = 1u << 0;    // マップオブジェクト（焼き込み破片を含む）
+    constexpr uint32_t Prop = 1u << 1;      // 破片・小道具（userData は PhysicsModel*）
+    constexpr uint32_t Enemy = 1u << 2;     // 敵（userData は Enemy*）
+    constexpr uint32_t Player = 1u << 3;    // プレイヤー
+    constexpr uint32_t All = 0xFFFFFFFFu;
+}
+
+//--------------------------------------
+// 問い合わせの絞り込み
+//--------------------------------------
+struct SceneQueryFilter
+{
+    uint32_t layerMask = CollisionLayer::All;
+    uint32_t typeMask = SceneObjectType::All;
+
+    SceneQueryFilter() = default;
+    SceneQueryFilter(uint32_t layers, uint32_t types) : layerMask(layers), typeMask(types) {}
+
+    bool Accepts(uint32_t layer, uint32_t type) const
+    {
+        return (layer & layerMask) != 0 && (type & typeMask) != 0;
+    }
+};
+
+//--------------------------------------
+// 問い合わせ結果
+//--------------------------------------
+struct SceneQueryHit
+{
+    uint32_t type = SceneObjectType::None;
+    uint32_t layer = CollisionLayer::None;
+    void* userData = nullptr;           // Prop / Enemy の所有オブジェクト
+    int mapIndex = -1;                  // Static のみ Map_GetObject の添字
+    float distance = 0.0f;              // レイ：始点からの距離 / スイープ：移動量に対する割合（0～1）
+    DirectX::XMFLOAT3 point{ 0, 0, 0 }; // レイ・スイープの当たり位置
+    DirectX::XMFLOAT3 normal{ 0, 0, 0 };// 当たった面の法線（相手→問い合わせ側）
+};
+
+//--------------------------------------
+// 関数プロトタイプ
+//--------------------------------------
+void SceneQuery_Initialize();
+void SceneQuery_Finalize();
+
+/**
+ * @brief 登録待ちの移動をツリーへ反映し、マップの変更を取り込む（フレームに1回）
+ * @detail 問い合わせは更新の合間なら並列に呼べる（ツリーは読み取りのみ）
+ */
+void SceneQuery_Update();
+
+// --- 登録 ---
+int SceneQuery_CreateProxy(uint32_t type, void* userData, const AABB& aabb, uint32_t layer);
+void SceneQuery_DestroyProxy(int proxyId);
+
+/**
+ * @brief 境界を更新（ツリーと問い合わせへの反映は次の SceneQuery_Update）
+ */
+void SceneQuery_MoveProxy(int proxyId, const AABB& aabb);
+void SceneQuery_SetProxyLayer(int proxyId, uint32_t layer);
+
+// --- 問い合わせ（判定は各登録の AABB に対して行う）---
+
+/**
+ * @brief レイと最初に交差する登録を取得
+ */
+bool SceneQuery_Raycast(const Ray& ray, float maxDistance, const SceneQueryFilter& filter, SceneQueryHit* outHit = nullptr);
+
+/**
+ * @brief レイと交差する登録をすべて取得（近い順）
+ * @param outHits 結果の格納先（呼び出し時にクリアされる）
+ */
+void SceneQuery_RaycastAll(const Ray& ray, float maxDistance, const SceneQueryFilter& filter, std::vector<SceneQueryHit>& outHits);
+
+void SceneQuery_OverlapAABB(const AABB& aabb, const SceneQueryFilter& filter, std::vector<SceneQueryHit>& outHits);
+void SceneQuery_OverlapSphere(const Sphere& sphere, const SceneQueryFilter& filter, std::vector<SceneQueryHit>& outHits);
+void SceneQuery_OverlapOBB(const OBB& obb, const SceneQueryFilter& filter, std::vector<SceneQueryHit>& outHits);
+
+/**
+ * @brief 四角形（周回順の4頂点、ねじれていてもよい）と重なる登録を取得
+ * @detail 2枚の三角形に分けて判定する
+ */
+void SceneQuery_OverlapQuad(const DirectX::XMFLOAT3 (&corners)[4], const SceneQueryFilter& filter, std::vector<SceneQueryHit>& outHits);
+
+/**
+ * @brief 形状を移動させたときに最初に当たる登録を取得（distance は割合）
+ */
+bool SceneQuery_SweepSphere(const Sphere& sphere, const DirectX::XMFLOAT3& displacement,
+    const SceneQueryFilter& filter, SceneQueryHit* outHit = nullptr);
+bool SceneQuery_SweepCapsule(const Capsule& capsule, const DirectX::XMFLOAT3& displacement,
+    const SceneQueryFilter& filter, SceneQueryHit* outHit = nullptr);
+
+int SceneQuery_GetProxyCount();
+
+#endif // SCENE_QUERY_H
@@ -1,13 +1,13 @@
 /****************************************
  * @file settings.cpp
- * @brief ݒʂ̎
+ * @brief 設定画面の実装
  * @author Natsume Shidara
  * @date 2026/01/13
  *
- * ݒ荀:
- * - _x
- * - BGM
- * - SE
+ * 設定項目:
+ * - 視点感度
+ * - BGM音量
+ * - SE音量
  ****************************************/
 
 #include "settings.h"
@@ -32,19 +32,19 @@
 using namespace DirectX;
 
 //======================================
-// 萔
+// 定数
 //======================================
 namespace
 {
-    // eNX`pX
+    // テクスチャパス
     constexpr const wchar_t* TEX_BG = L"assets/ui/settings_bg.png";
     constexpr const wchar_t* TEX_WHITE = L"assets/white.png";
     constexpr const wchar_t* TEX_TITLE = L"assets/ui/settings_title.png";
 
-    // tHgeNX`pX
+    // フォントテクスチャパス
     constexpr const wchar_t* FONT_TEXTURE_PATH = L"assets/consolab_ascii_512.png";
 
-    // j[
+    // メニュー項目
     enum MenuItem
     {
         MENU_SENSITIVITY,
@@ -55,7 +55,7 @@ namespace
         MENU_COUNT
     };
 
-    // j[ږ
+    // メニュー項目名
     const char* MENU_LABELS[MENU_COUNT] = {
         "Mouse Sensitivity",
         "BGM Volume",
@@ -64,7 +64,7 @@ namespace
         "Back to Title"
     };
 
-    // CAEg
+    // レイアウト
     constexpr float TITLE_Y = 50.0f;
     constexpr float MENU_START_Y = 180.0f;
     constexpr float MENU_SPACING = 70.0f;
@@ -78,16 +78,16 @@ namespace
     constexpr float BUTTON_HEIGHT = 40.0f;
     constexpr float CURSOR_HEIGHT = 50.0f;
 
-    // x
+    // 調整速度
     constexpr float ADJUST_SPEED = 0.015f;
 
-    // Aj[V
+    // アニメーション
     constexpr float BLINK_SPEED = 5.0f;
     constexpr float CURSOR_ANIM_SPEED = 3.0f;
 }
 
 //======================================
-// ϐ
+// 内部変数
 //======================================
 static int g_TexBg = -1;
 static int g_TexWhite = -1;
@@ -100,17 +100,17 @@ static int g_SelectedItem = 0;
 static float g_AnimTimer = 0.0f;
 static bool g_IsTransitioning = false;
 
-// ̓s[gp
+// 入力リピート用
 static float g_InputRepeatTimer = 0.0f;
 static constexpr float INPUT_REPEAT_DELAY = 0.25f;
 static constexpr float INPUT_REPEAT_INTERVAL = 0.03f;
 static bool g_FirstInput = true;
 
-// fobOeLXg
+// デバッグテキスト
 static hal::DebugText* g_pDebugText = nullptr;
 
 //======================================
-// ֐vg^Cv
+// 内部関数プロトタイプ
 //======================================
 static void DrawSlider(float x, float y, float value, float minVal, float maxVal, bool selected);
 static void DrawButton(float x, float y, const char* text, bool selected);
@@ -119,19 +119,19 @@ static void SetCurrentValue(int item, float value);
 static void AdjustValue(int item, float delta);
 
 //======================================
-// 
+// 初期化
 //======================================
 void Settings_Initialize()
 {
     g_ScreenWidth = static_cast<float>(Direct3D_GetBackBufferWidth());
     g_ScreenHeight = static_cast<float>(Direct3D_GetBackBufferHeight());
 
-    // eNX`ǂݍ
+    // テクスチャ読み込み
     g_TexBg = Texture_Load(TEX_BG);
     g_TexWhite = Texture_Load(TEX_WHITE);
     g_TexTitle = Texture_Load(TEX_TITLE);
 
-    // fobOeLXg
+    // デバッグテキスト初期化
     g_pDebugText = new hal::DebugText(
         Direct3D_GetDevice(),
         Direct3D_GetContext(),
@@ -147,7 +147,7 @@ void Settings_Initialize()
     g_InputRepeatTimer = 0.0f;
     g_FirstInput = true;
 
-    // tF[hC
+    // フェードイン
     if (Fade_GetState() == FADE_STATE::FINISHED_OUT)
     {
         Fade_Start(0.5, false);
@@ -155,7 +155,7 @@ void Settings_Initialize()
 }
 
 //======================================
-// I
+// 終了処理
 //======================================
 void Settings_Finalize()
 {
@@ -171,22 +171,22 @@ void Settings_Finalize()
 }
 
 //======================================
-// XC_[`
+// スライダー描画
 //======================================
 static void DrawSlider(float x, float y, float value, float minVal, float maxVal, bool selected)
 {
     if (g_TexWhite < 0) return;
 
-    // Kꂽl
+    // 正規化された値
     float normalizedValue = (value - minVal) / (maxVal - minVal);
     normalizedValue = std::clamp(normalizedValue, 0.0f, 1.0f);
 
-    // XC_[wi
+    // スライダー背景
     XMFLOAT4 bgColor = { 0.2f, 0.2f, 0.25f, 0.9f };
     Sprite_Draw(g_TexWhite, x, y, 0.0f, 0.0f, 1.0f, 1.0f,
         SLIDER_WIDTH, SLIDER_HEIGHT, 0.0f, bgColor);
 
-    // lo[ihԂj
+    // 値バー（塗りつぶし部分）
     float barWidth = SLIDER_WIDTH * normalizedValue;
     if (barWidth > 0)
     {
@@ -196,7 +196,7 @@ static void DrawSlider(float x, float y, float value, float minVal, float maxVal
             barWidth, SLIDER_HEIGHT, 0.0f, barColor);
     }
 
-    // ܂݁imuj
+    // つまみ（ノブ）
     float knobX = x + barWidth - KNOB_WIDTH * 0.5f;
     float knobY = y - (KNOB_HEIGHT - SLIDER_HEIGHT) * 0.5f;
 
@@ -209,7 +209,7 @@ static void DrawSlider(float x, float y, float value, float minVal, float maxVal
 }
 
 //======================================
-// {^`
+// ボタン描画
 //======================================
 static void DrawButton(float x, float y, const char* text, bool selected)
 {
@@ -230,7 +230,7 @@ static void DrawButton(float x, float y, const char* text, bool selected)
 }
 
 //======================================
-// ݒl擾
+// 設定値取得
 //======================================
 static float GetCurrentValue(int item)
 {
@@ -248,7 +248,7 @@ static float GetCurrentValue(int item)
 }
 
 //======================================
-// ݒlݒ
+// 設定値設定
 //======================================
 static void SetCurrentValue(int item, float value)
 {
@@ -267,7 +267,7 @@ static void SetCurrentValue(int item, float value)
 }
 
 //======================================
-// l
+// 値調整
 //======================================
 static void AdjustValue(int item, float delta)
 {
@@ -289,7 +289,7 @@ static void AdjustValue(int item, float delta)
 }
 
 //======================================
-// XV
+// 更新
 //======================================
 void Settings_Update(double elapsed_time)
 {
@@ -306,13 +306,13 @@ void Settings_Update(double elapsed_time)
         return;
     }
 
-    // ㉺ړ
+    // 上下移動
     bool upInput = KeyLogger_IsTrigger(KK_W) || KeyLogger_IsTrigger(KK_UP) ||
         PadLogger_IsTrigger(0, XINPUT_GAMEPAD_DPAD_UP);
     bool downInput = KeyLogger_IsTrigger(KK_S) || KeyLogger_IsTrigger(KK_DOWN) ||
         PadLogger_IsTrigger(0, XINPUT_GAMEPAD_DPAD_DOWN);
 
-    // pbhXeBbNi㉺j
+    // パッドスティック（上下）
     XMFLOAT2 stick = PadLogger_GetLeftThumbStick(0);
     static bool stickUpPrev = false;
     static bool stickDownPrev = false;
@@ -337,7 +337,7 @@ void Settings_Update(double elapsed_time)
         SoundManager_PlaySE(SOUND_SE_SELECT);
     }
 
-    // EŃXC_[is[gΉj
+    // 左右でスライダー調整（リピート対応）
     bool leftHeld = KeyLogger_IsPressed(KK_A) || KeyLogger_IsPressed(KK_LEFT) ||
         PadLogger_IsPressed(0, XINPUT_GAMEPAD_DPAD_LEFT) ||
         (stick.x < -0.3f);
@@ -382,7 +382,7 @@ void Settings_Update(double elapsed_time)
         g_FirstInput = true;
     }
 
-    // {^
+    // 決定ボタン
     bool confirmInput = KeyLogger_IsTrigger(KK_ENTER) || KeyLogger_IsTrigger(KK_SPACE) ||
         PadLogger_IsTrigger(0, XINPUT_GAMEPAD_A);
 
@@ -410,7 +410,7 @@ void Settings_Update(double elapsed_time)
         }
     }
 
-    // LZ
+    // キャンセル
     bool cancelInput = KeyLogger_IsTrigger(KK_ESCAPE) ||
         PadLogger_IsTrigger(0, XINPUT_GAMEPAD_B);
 
@@ -423,7 +423,7 @@ void Settings_Update(double elapsed_time)
 }
 
 //======================================
-// `
+// 描画
 //======================================
 void Settings_Draw()
 {
@@ -432,7 +432,7 @@ void Settings_Draw()
 
     Sprite_Begin();
 
-    // wi
+    // 背景
     if (g_TexBg >= 0)
     {
         Sprite_Draw(g_TexBg, 0.0f, 0.0f, g_ScreenWidth, g_ScreenHeight);
@@ -444,7 +444,7 @@ void Settings_Draw()
             g_ScreenWidth, g_ScreenHeight, 0.0f, bgColor);
     }
 
-    // ^Cg
+    // タイトル
     if (g_TexTitle >= 0)
     {
         float titleWidth = 400.0f;
@@ -453,13 +453,13 @@ void Settings_Draw()
         Sprite_Draw(g_TexTitle, titleX, TITLE_Y, titleWidth, titleHeight);
     }
 
-    // ej[ڂ`
+    // 各メニュー項目を描画
     for (int i = 0; i < MENU_COUNT; i++)
     {
         float y = MENU_START_Y + i * MENU_SPACING;
         bool selected = (i == g_SelectedItem);
 
-        // IJ[\
+        // 選択カーソル
         if (selected && g_TexWhite >= 0)
         {
             float cursorAlpha = 0.3f + 0.15f * sinf(g_AnimTimer * CURSOR_ANIM_SPEED);
@@ -469,7 +469,7 @@ void Settings_Draw()
                 g_ScreenWidth - LABEL_X - 50.0f, CURSOR_HEIGHT, 0.0f, cursorColor);
         }
 
-        // XC_[܂̓{^
+        // スライダーまたはボタン
         switch (i)
         {
         case MENU_SENSITIVITY:
@@ -490,12 +490,12 @@ void Settings_Draw()
         }
     }
 
-    // eLXg`iDebugTextgpj
+    // テキスト描画（DebugText使用）
     if (g_pDebugText)
     {
         std::stringstream ss;
 
-        // ^Cgi摜Ȃꍇj
+        // タイトル（画像がない場合）
         if (g_TexTitle < 0)
         {
             ss << "\n";
@@ -507,7 +507,7 @@ void Settings_Draw()
             ss << "\n\n\n\n\n";
         }
 
-        // e
+        // 各項目
         for (int i = 0; i < MENU_COUNT; i++)
         {
             bool selected = (i == g_SelectedItem);
@@ -515,7 +515,7 @@ void Settings_Draw()
 
             ss << marker << MENU_LABELS[i];
 
-            // l\
+            // 値表示
             if (i <= MENU_SE_VOLUME)
             {
                 float value = GetCurrentValue(i);
@@ -523,7 +523,7 @@ void Settings_Draw()
                 float maxVal = (i == MENU_SENSITIVITY) ? SettingsRange::SENSITIVITY_MAX : SettingsRange::VOLUME_MAX;
                 int percent = static_cast<int>((value - minVal) / (maxVal - minVal) * 100.0f + 0.5f);
 
-                // pfBO
+                // パディング
                 int labelLen = static_cast<int>(strlen(MENU_LABELS[i]));
                 for (int p = labelLen; p < 25; p++) ss << " ";
 
@@ -545,9 +545,9 @@ void Settings_Draw()
 }
 
 //======================================
-// VhE`
+// シャドウ描画
 //======================================
 void Settings_DrawShadow()
 {
-    // ݒʂł̓VhEsv
+    // 設定画面ではシャドウ不要
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 /****************************************
  * @file settings.h
- * @brief ݒʂ̎
+ * @brief 設定画面の実装
  * @author Natsume Shidara
  * @date 2026/01/13
  ****************************************/
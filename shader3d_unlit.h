@@ -1,6 +1,6 @@
 /**
  * @file shader3d_unlit.h
- * @brief 3DpAbgVF[_[
+ * @brief 3D用アンリットシェーダー
  * @author Natsume Shidara
  * @date 2025/11/21
  */
@@ -1,13 +1,13 @@
 /**
  * @file shader_billboard.cpp
- * @brief VF[_[(sNZVF[_[ɍ킹C)
+ * @brief シェーダー(ピクセルシェーダーに合わせた修正版)
  * @author Natsume Shidara
  * @date 2025/11/14
  */
 
 #include <DirectXMath.h>
 #include <d3d11.h>
-#include <windows.h> // MessageBox 
+#include <windows.h> // MessageBox 等
 
 #include <fstream>
 #include <iomanip>
@@ -31,23 +31,23 @@ using namespace DirectX;
     }
 #endif
 
-// O[o\[X
+// グローバルリソース
 static ID3D11VertexShader* g_pVertexShader = nullptr;
 static ID3D11InputLayout* g_pInputLayout = nullptr;
 static ID3D11PixelShader* g_pPixelShader = nullptr;
 
-// 萔obt@[iVSp3: Projection, World, View / PSp1: Colorj
+// 定数バッファー（VS用3個: Projection, World, View / PS用1個: Color）
 static ID3D11Buffer* g_pVSConstantBuffer0 = nullptr; // Projection Matrix
-static ID3D11Buffer* g_pVSConstantBuffer3 = nullptr; // USJbgp
+static ID3D11Buffer* g_pVSConstantBuffer3 = nullptr; // USカット用
 static ID3D11Buffer* g_pPSConstantBuffer0 = nullptr; // Material Color (XMFLOAT4)
 
-// foCX & ReLXgiOݒAReleasesvj
+// デバイス & コンテキスト（外部設定、Release不要）
 static ID3D11Device* g_pDevice = nullptr;
 static ID3D11DeviceContext* g_pContext = nullptr;
 
 
 
-// wp: hr Oɏoi16ij
+// ヘルパ: hr をログに出す（16進）
 static void LogHR(const char* place, HRESULT hr)
 {
     std::ostringstream ss;
@@ -55,7 +55,7 @@ static void LogHR(const char* place, HRESULT hr)
     hal::dout << ss.str() << std::endl;
 }
 
-// wp: t@Cǂݍ blob Ԃis͋j
+// ヘルパ: ファイルを読み込んで blob を返す（失敗時は空）
 static std::vector<char> LoadFileToBlob(const std::string& path)
 {
     std::vector<char> blob;
@@ -89,7 +89,7 @@ static std::vector<char> LoadFileToBlob(const std::string& path)
     return blob;
 }
 
-// wp: RX^gobt@쐬iByteWidth  16 oCgEł邱Ɓj
+// ヘルパ: コンスタントバッファ作成（ByteWidth は 16 バイト境界であること）
 static bool CreateConstantBuffer(ID3D11Device* device, UINT byteWidth, ID3D11Buffer** outBuffer)
 {
     if (!device || !outBuffer)
@@ -131,13 +131,13 @@ bool Shader_Billboard_Initialize()
     HRESULT hr = S_OK;
 
     // -----------------------------
-    // _VF[_[ǂݍ & 쐬
+    // 頂点シェーダー読み込み & 作成
     // -----------------------------
     const std::string vsPath = "assets/shader/shader_vertex_billboard.cso";
     std::vector<char> vsBlob = LoadFileToBlob(vsPath);
     if (vsBlob.empty())
     {
-        MessageBox(nullptr, "_VF[_[̓ǂݍ݂Ɏs܂\n\nshader_vertex_billboard.cso", "G[", MB_OK);
+        MessageBox(nullptr, "頂点シェーダーの読み込みに失敗しました\n\nshader_vertex_billboard.cso", "エラー", MB_OK);
         return false;
     }
 
@@ -145,13 +145,13 @@ bool Shader_Billboard_Initialize()
     if (FAILED(hr))
     {
         LogHR("CreateVertexShader", hr);
-        MessageBox(nullptr, "_VF[_[̍쐬Ɏs܂iCreateVertexShaderj", "G[", MB_OK);
+        MessageBox(nullptr, "頂点シェーダーの作成に失敗しました（CreateVertexShader）", "エラー", MB_OK);
         return false;
     }
 
     // -----------------------------
-    // ̓CAEg쐬
-    //  _VF[_[̓: POSITION(float3), COLOR(float4), TEXCOORD(float2)
+    // 入力レイアウト作成
+    // ※ 頂点シェーダーの入力: POSITION(float3), COLOR(float4), TEXCOORD(float2)
     // -----------------------------
     D3D11_INPUT_ELEMENT_DESC layout[] = {
         { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
@@ -163,17 +163,17 @@ bool Shader_Billboard_Initialize()
     if (FAILED(hr))
     {
         LogHR("CreateInputLayout", hr);
-        MessageBox(nullptr, "_CAEg̍쐬Ɏs܂iCreateInputLayoutjB_VF[_̓͂C++̃CAEgmFĂB", "G[", MB_OK);
+        MessageBox(nullptr, "頂点レイアウトの作成に失敗しました（CreateInputLayout）。頂点シェーダの入力とC++側のレイアウトを確認してください。", "エラー", MB_OK);
         SAFE_RELEASE(g_pVertexShader);
         return false;
     }
 
     // -----------------------------
-    // 萔obt@쐬iVSF4x4 s ~3 / PSFfloat4 ~1j
+    // 定数バッファ作成（VS：4x4 行列 ×3 / PS：float4 ×1）
     // -----------------------------
     if (!CreateConstantBuffer(g_pDevice, sizeof(XMFLOAT4X4), &g_pVSConstantBuffer0))
     {
-        MessageBox(nullptr, "萔obt@0(Projection)̍쐬Ɏs", "G[", MB_OK);
+        MessageBox(nullptr, "定数バッファ0(Projection)の作成に失敗", "エラー", MB_OK);
         SAFE_RELEASE(g_pInputLayout);
         SAFE_RELEASE(g_pVertexShader);
         return false;
@@ -181,7 +181,7 @@ bool Shader_Billboard_Initialize()
     
     if (!CreateConstantBuffer(g_pDevice, sizeof(XMFLOAT4X4), &g_pVSConstantBuffer3))
     {
-        MessageBox(nullptr, "萔obt@2(View)̍쐬Ɏs", "G[", MB_OK);
+        MessageBox(nullptr, "定数バッファ2(View)の作成に失敗", "エラー", MB_OK);
         SAFE_RELEASE(g_pVSConstantBuffer0);
         SAFE_RELEASE(g_pInputLayout);
         SAFE_RELEASE(g_pVertexShader);
@@ -190,7 +190,7 @@ bool Shader_Billboard_Initialize()
 
     if (!CreateConstantBuffer(g_pDevice, sizeof(UVParameter), &g_pPSConstantBuffer0))
     {
-        MessageBox(nullptr, "萔obt@(PS Color)̍쐬Ɏs", "G[", MB_OK);
+        MessageBox(nullptr, "定数バッファ(PS Color)の作成に失敗", "エラー", MB_OK);
         SAFE_RELEASE(g_pVSConstantBuffer0);
         SAFE_RELEASE(g_pInputLayout);
         SAFE_RELEASE(g_pVertexShader);
@@ -198,13 +198,13 @@ bool Shader_Billboard_Initialize()
     }
 
     // -----------------------------
-    // sNZVF[_[ǂݍ & 쐬
+    // ピクセルシェーダー読み込み & 作成
     // -----------------------------
     const std::string psPath = "assets/shader/shader_pixel_billboard.cso";
     std::vector<char> psBlob = LoadFileToBlob(psPath);
     if (psBlob.empty())
     {
-        MessageBox(nullptr, "sNZVF[_[̓ǂݍ݂Ɏs܂\n\nshader_pixel_billboard.cso", "G[", MB_OK);
+        MessageBox(nullptr, "ピクセルシェーダーの読み込みに失敗しました\n\nshader_pixel_billboard.cso", "エラー", MB_OK);
         SAFE_RELEASE(g_pPSConstantBuffer0);
         SAFE_RELEASE(g_pVSConstantBuffer0);
         SAFE_RELEASE(g_pInputLayout);
@@ -216,7 +216,7 @@ bool Shader_Billboard_Initialize()
     if (FAILED(hr))
     {
         LogHR("CreatePixelShader", hr);
-        MessageBox(nullptr, "sNZVF[_[̍쐬Ɏs܂iCreatePixelShaderj", "G[", MB_OK);
+        MessageBox(nullptr, "ピクセルシェーダーの作成に失敗しました（CreatePixelShader）", "エラー", MB_OK);
         SAFE_RELEASE(g_pPSConstantBuffer0);
         SAFE_RELEASE(g_pVSConstantBuffer0);
         SAFE_RELEASE(g_pInputLayout);
@@ -224,7 +224,7 @@ bool Shader_Billboard_Initialize()
         return false;
     }
 
-    // Sampler ͊O Sampler_SetFilterPoint S
+    // Sampler は外部の Sampler_SetFilterPoint が担当
     Sampler_SetFilterPoint();
 
     hal::dout << "Shader_Billboard_Initialize: success" << std::endl;
@@ -240,7 +240,7 @@ void Shader_Billboard_Finalize()
     SAFE_RELEASE(g_pInputLayout);
     SAFE_RELEASE(g_pVertexShader);
 
-    // foCX/ReLXg̎QƂ͊OLȂ̂ŉȂŜ߃|C^NULLɂ
+    // デバイス/コンテキストの参照は外部所有なので解放しないが安全のためポインタをNULLにする
     g_pDevice = nullptr;
     g_pContext = nullptr;
 }
@@ -258,7 +258,7 @@ void Shader_Billboard_SetColor(const XMFLOAT4& color)
     if (!g_pContext || !g_pPSConstantBuffer0)
         return;
 
-    // }eAJ[萔obt@ɐݒ
+    // マテリアルカラーを定数バッファに設定
     g_pContext->UpdateSubresource(g_pPSConstantBuffer0, 0, nullptr, &color, 0, 0);
 }
 
@@ -271,20 +271,20 @@ void Shader_Billboard_Begin()
     if (!g_pContext)
         return;
 
-    // VF[_[Zbg
+    // シェーダーをセット
     g_pContext->VSSetShader(g_pVertexShader, nullptr, 0);
     g_pContext->PSSetShader(g_pPixelShader, nullptr, 0);
 
-    // ̓CAEgZbg
+    // 入力レイアウトをセット
     g_pContext->IASetInputLayout(g_pInputLayout);
 
-    // 萔obt@oChiVSpj
+    // 定数バッファをバインド（VS用）
     g_pContext->VSSetConstantBuffers(0, 1, &g_pVSConstantBuffer0);
     g_pContext->VSSetConstantBuffers(3, 1, &g_pVSConstantBuffer3);
 
-    // 萔obt@oChiPSpj
+    // 定数バッファをバインド（PS用）
     g_pContext->PSSetConstantBuffers(0, 1, &g_pPSConstantBuffer0);
 
-    // Tvݒ
+    // サンプラ設定
     Sampler_SetFilterLinear();
 }
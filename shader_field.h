@@ -1,6 +1,6 @@
 /**
  * @file shader_field.h
- * @brief tB[hpVF[_[
+ * @brief フィールド用シェーダー
  * @author Natsume Shidara
  * @date 2025/09/26
  */
@@ -1,53 +1,53 @@
 /****************************************
  * @file shader_pixel_3d_unlit.hlsl
- * @brief 3DpsNZAbgVF[_[
+ * @brief 3D用ピクセルアンリットシェーダー
  * @author Natsume Shidara
  * @date 2025/11/21
  * @update 2025/11/21
  ****************************************/
 
 //--------------------------------------
-// 萔obt@`
+// 定数バッファ定義
 //--------------------------------------
-// }eAJ[
+// マテリアルカラー
 cbuffer ColorBuffer : register(b0)
 {
     float4 MaterialColor;
 }
 
 //--------------------------------------
-// \̒`
+// 構造体定義
 //--------------------------------------
-// sNZVF[_[͍\
-// VS_OUTPUTƈv
+// ピクセルシェーダー入力構造体
+// ※VS_OUTPUTと一致させる
 struct PS_INPUT
 {
-    float4 posH : SV_POSITION; // XN[W
-    float4 color : COLOR0; // _J[
-    float2 uv : TEXCOORD0; // eNX`W
+    float4 posH : SV_POSITION; // スクリーン座標
+    float4 color : COLOR0; // 頂点カラー
+    float2 uv : TEXCOORD0; // テクスチャ座標
 };
 
 //--------------------------------------
-// eNX`ETv[`
+// テクスチャ・サンプラー定義
 //--------------------------------------
-Texture2D Tex : register(t0); // x[XeNX`
-SamplerState Samp : register(s0); // Tv[
+Texture2D Tex : register(t0); // ベーステクスチャ
+SamplerState Samp : register(s0); // サンプラー
 
 //======================================
-// C֐
+// メイン関数
 //======================================
 /**
- * @brief sNZVF[_[Gg[|Cg
- * @param ps_in X^CYς݃f[^
- * @return ŏIo̓J[
- * @detail CeBOvZs킸AeNX`ƃJ[̏ZʂԂ܂B
+ * @brief ピクセルシェーダーエントリーポイント
+ * @param ps_in ラスタライズ済みデータ
+ * @return 最終出力カラー
+ * @detail ライティング計算を行わず、テクスチャとカラーの乗算結果を返します。
  */
 float4 main(PS_INPUT ps_in) : SV_TARGET
 {
-    // eNX`J[o
+    // テクスチャカラー抽出
     float4 texColor = Tex.Sample(Samp, ps_in.uv);
 
-    // ŏIJ[
+    // 最終カラー合成
     // Texture * Material * VertexColor
     return texColor;
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 /****************************************
  * @file shader_shadow_map.h
- * @brief VhE}bvpVF[_[Ǘ
+ * @brief シャドウマップ生成用シェーダー管理
  * @author Natsume Shidara
  * @date 2025/12/10
  ****************************************/
@@ -11,15 +11,15 @@
 #include <d3d11.h>
 #include <DirectXMath.h>
 
- // EI
+ // 初期化・終了
 bool ShaderShadowMap_Initialize(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
 void ShaderShadowMap_Finalize();
 
-// `Jn
+// 描画開始
 void ShaderShadowMap_Begin();
 
-// 萔obt@XV
-//  HLSLcbuffer`ɍ킹āALightViewProjWorldZbg
+// 定数バッファ更新
+// ※ HLSLのcbuffer定義に合わせて、LightViewProjとWorldをセットする
 void ShaderShadowMap_SetLightViewProjection(const DirectX::XMFLOAT4X4& matrix);
 void ShaderShadowMap_SetWorldMatrix(const DirectX::XMMATRIX& matrix);
 
@@ -1,6 +1,6 @@
 /**
  * @file shader_vertex_billboard.hlsl
- * @brief r{[hp_VF[_[
+ * @brief ビルボード用頂点シェーダー
  * @author Natsume Shidara
  * @date 2025/11/14
  */
@@ -25,28 +25,28 @@ cbuffer UVOffsetBuffer : register(b3)
     float2 translation;
 };
 
-// _VF[_[͍\
+// 頂点シェーダー入力構造体
 struct VS_INPUT
 {
-    float3 posL : POSITION0; // [JW (float3ɕύX)
-    float4 color : COLOR0; // _J[
-    float2 uv : TEXCOORD0; // eNX`W
+    float3 posL : POSITION0; // ローカル座標 (float3に変更)
+    float4 color : COLOR0; // 頂点カラー
+    float2 uv : TEXCOORD0; // テクスチャ座標
 };
 
-// _VF[_[o͍\
+// 頂点シェーダー出力構造体
 struct VS_OUTPUT
 {
-    float4 posH : SV_POSITION; // ϊςݍW
-    float4 color : COLOR0; // J[
-    float2 uv : TEXCOORD0; // eNX`W
+    float4 posH : SV_POSITION; // 変換済み座標
+    float4 color : COLOR0; // カラー
+    float2 uv : TEXCOORD0; // テクスチャ座標
 };
 
-// _VF[_[
+// 頂点シェーダー
 VS_OUTPUT main(VS_INPUT vs_in)
 {
     VS_OUTPUT vs_out;
     
-    // Wϊ (float3 -> float4Ɋg)
+    // 座標変換 (float3 -> float4に拡張)
     float4 posL = float4(vs_in.posL, 1.0f);
     float4 posW = mul(posL, world);
     float4 posV = mul(posW, view);
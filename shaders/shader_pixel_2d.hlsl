@@ -1,6 +1,6 @@
 /**
  * @file shader_pixel_2d.hlsl
- * @brief 2D`psNZVF[_[
+ * @brief 2D描画用ピクセルシェーダー
  * @author Natsume Shidara
  * @date 2025/06/10
  */
@@ -12,8 +12,8 @@ struct PS_INPUT
     float2 uv : TEXCOORD0;
 };
 
-Texture2D tex; // eNX`
-SamplerState samp; // eNX`v
+Texture2D tex; // テクスチャ
+SamplerState samp; // テクスチャさんプラ
 
 float4 main(PS_INPUT ps_in) : SV_TARGET
 {
@@ -1,14 +1,14 @@
 /**
  * @file shader_pixel_3d.hlsl
- * @brief 3D`psNZVF[_[iShadowMapΉEPCF\tgVhEEPhongŁj
+ * @brief 3D描画用ピクセルシェーダー（ShadowMap対応・PCFソフトシャドウ・物理整合Phong版）
  * @author Natsume
  * @date 2025/12/10
- * @update 2025/12/19 - [vA[xΉ
- * @update 2026/02/03 - CeBOi邳Pj
+ * @update 2025/12/19 - ループアンロール警告対応
+ * @update 2026/02/03 - ライティング調整（明るさ改善）
  */
 
 //=============================================================================
-// 萔obt@ݒ
+// 定数バッファ設定
 //=============================================================================
 cbuffer PS_DIFFUSE_BUFFER : register(b0)
 {
@@ -48,14 +48,14 @@ cbuffer PS_POINTLIGHT_BUFFER : register(b4)
 };
 
 //=============================================================================
-// eNX`ETv
+// テクスチャ・サンプラ
 //=============================================================================
 Texture2D tex : register(t0);
 Texture2D g_ShadowMap : register(t1);
 SamplerState samp : register(s0);
 
 //=============================================================================
-// ͍\
+// 入力構造体
 //=============================================================================
 struct PS_INPUT
 {
@@ -68,7 +68,7 @@ struct PS_INPUT
 };
 
 //=============================================================================
-// CeBOp[^
+// ライティング調整パラメータ
 //=============================================================================
 #define SHADOW_MIN          0.6f
 #define SHADOW_BIAS         0.002f
@@ -78,7 +78,7 @@ struct PS_INPUT
 #define POINT_SPECULAR      0.5f
 
 //=============================================================================
-// \tgVhEvZ֐ (PCF 3x3)
+// ソフトシャドウ計算関数 (PCF 3x3)
 //=============================================================================
 float CalcShadowFactor(float4 wPosLight)
 {
@@ -114,54 +114,54 @@ float CalcShadowFactor(float4 wPosLight)
 }
 
 //=============================================================================
-// CVF[_[
+// メインシェーダー
 //=============================================================================
 float4 main(PS_INPUT ps_in) : SV_TARGET
 {
     //--------------------------------------
-    // {F
+    // 基本色生成
     //--------------------------------------
     float4 texColor = tex.Sample(samp, ps_in.uv);
     float3 baseColor = texColor.rgb * ps_in.color.rgb * diffuse_color.rgb;
     float alpha = texColor.a * ps_in.color.a * diffuse_color.a;
 
     //--------------------------------------
-    // eW̎擾
+    // 影係数の取得
     //--------------------------------------
     float shadowFactor = CalcShadowFactor(ps_in.wPosLight);
 
     //--------------------------------------
-    // CeBOvZ
+    // ライティング計算準備
     //--------------------------------------
     float3 N = normalize(ps_in.normalW.xyz);
     float3 L = normalize(-directonal_world_vector.xyz);
     float3 toEye = normalize(eye_posW - ps_in.posW.xyz);
 
     //--------------------------------------
-    // gU (Lambert)
+    // 拡散反射 (Lambert)
     //--------------------------------------
     float diffFactor = max(dot(N, L), 0.0f);
     float3 diffuse = baseColor * directonal_color.rgb * diffFactor * shadowFactor * DIFFUSE_INTENSITY;
 
     //--------------------------------------
-    // ʔ (Phong)
+    // 鏡面反射 (Phong)
     //--------------------------------------
     float3 R = reflect(-L, N);
     float specFactor = pow(max(dot(R, toEye), 0.0f), specular_power);
     float3 specular = specular_color.rgb * specFactor * directonal_color.rgb * SPECULAR_INTENSITY * shadowFactor;
 
     //--------------------------------------
-    //  (Ambient)
+    // 環境光 (Ambient)
     //--------------------------------------
     float3 ambient = baseColor * ambient_color.rgb;
 
     //--------------------------------------
-    //  (Directional Light)
+    // 合成 (Directional Light)
     //--------------------------------------
     float3 color = ambient + diffuse + specular;
 
     //--------------------------------------
-    // _ (Point Lights)
+    // 点光源処理 (Point Lights)
     //--------------------------------------
     [unroll(4)]
     for (int i = 0; i < pointLightCount; i++)
@@ -1,11 +1,11 @@
 /**
  * @file shader_vertex_2d.hlsl
- * @brief 2D`p_VF[_[
+ * @brief 2D描画用頂点シェーダー
  * @author Natsume Shidara
  * @date 2025/06/10
  */
 
-// 萔obt@
+// 定数バッファ
 cbuffer VS_CONSTANT_BUFFER: register(b0)
 {
     float4x4 proj;
@@ -18,24 +18,24 @@ cbuffer VS_CONSTANT_BUFFER: register(b1)
 
 struct VS_INPUT
 {
-    float4 posL : POSITION0; // [JW 
+    float4 posL : POSITION0; // ローカル座標 
     float4 color : COLOR0; // Color
     float2 uv : TEXCOORD0;
 };
 struct VS_OUTPUT
 {
-    float4 posH : SV_POSITION; // ϊςݍW 
+    float4 posH : SV_POSITION; // 変換済み座標 
     float4 color : COLOR0; // Color
     float2 uv : TEXCOORD0;
 };
 
-// _VF[_
+// 頂点シェーダ
 VS_OUTPUT main(VS_INPUT vs_in)
 {
     VS_OUTPUT vs_out;
 
-    // Wϊ
-    // float4x4 mtx = mul(world, proj); // ӖŁAs
+    // 座標変換
+    // float4x4 mtx = mul(world, proj); // 同じ意味で、合成行列
     // vs_out.posH = mul(vs_in.posL, mtx);
     vs_in.posL = mul(vs_in.posL, world);
     vs_out.posH = mul(vs_in.posL, proj);
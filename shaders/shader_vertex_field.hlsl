@@ -1,6 +1,6 @@
 /**
  * @file shader_veretx_field.hlsl
- * @brief bVtB[h`p_VF[_[
+ * @brief メッシュフィールド描画用頂点シェーダー
  * @author Natsume Shidara
  * @date 2025/10/20
  */
@@ -21,26 +21,26 @@ cbuffer VS_CONSTANT_BUFFER : register(b2)
 
 struct VS_INPUT
 {
-    float4 posL : POSITION0; // [JW 
-    float4 normalL : NORMAL0; // @
+    float4 posL : POSITION0; // ローカル座標 
+    float4 normalL : NORMAL0; // 法線
     float4 blend : COLOR0; // Color
     float2 uv : TEXCOORD0;
 };
 struct VS_OUTPUT
 {
-    float4 posH : SV_POSITION; // ϊςݍW 
+    float4 posH : SV_POSITION; // 変換済み座標 
     float4 posW : POSITION0;
     float4 normalW : NORMAL0;
     float4 blend : COLOR0; // Color
     float2 uv : TEXCOORD0;
 };
 
-// _VF[_
+// 頂点シェーダ
 VS_OUTPUT main(VS_INPUT vs_in)
 {
     VS_OUTPUT vs_out;
 
-    // Wϊ
+    // 座標変換
     //float4x4 mtxWV = mul(world, view);
     float4x4 mtxWV = mul(view, world);
     float4x4 mtxWVP = mul(mtxWV, proj);
@@ -50,8 +50,8 @@ VS_OUTPUT main(VS_INPUT vs_in)
 
     vs_out.posW = mul(vs_in.posL, world);
     
-    // FvZ
-    vs_out.blend = vs_in.blend; //nʂ̃eNX`̃uhl͂̂܂܃pXX[
+    // 色計算
+    vs_out.blend = vs_in.blend; //地面のテクスチャのブレンド値はそのままパススルー
     vs_out.uv = vs_in.uv;
     
     return vs_out;
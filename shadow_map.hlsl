@@ -1,50 +1,50 @@
 //=============================================================================
-// VhE}bvpVF[_[
+// シャドウマップ生成用シェーダー
 //=============================================================================
 
-// 萔obt@FCg_̍s
+// 定数バッファ：ライト視点の行列
 cbuffer ConstantBuffer : register(b0)
 {
-    matrix World; // [hs
-    matrix LightViewProj; // Cg̃r[ * vWFNVs
+    matrix World; // ワールド行列
+    matrix LightViewProj; // ライトのビュー * プロジェクション行列
 }
 
-// _VF[_[
+// 頂点シェーダー入力
 struct VS_IN
 {
     float3 pos : POSITION;
-    float3 normal : NORMAL; // gȂ̓CAEg킹̂ߒ`
-    float2 uv : TEXCOORD; // gȂ̓CAEg킹̂ߒ`
+    float3 normal : NORMAL; // 使わないが入力レイアウト合わせのため定義
+    float2 uv : TEXCOORD; // 使わないが入力レイアウト合わせのため定義
 };
 
-// _VF[_[o
+// 頂点シェーダー出力
 struct VS_OUT
 {
-    float4 pos : SV_POSITION; // `ʒu
+    float4 pos : SV_POSITION; // 描画位置
 };
 
 //-----------------------------------------------------------------------------
-// _VF[_[
+// 頂点シェーダー
 //-----------------------------------------------------------------------------
 VS_OUT VS_Main(VS_IN input)
 {
     VS_OUT output;
 
-    // [JW -> [hW
+    // ローカル座標 -> ワールド座標
     float4 wPos = mul(float4(input.pos, 1.0f), World);
     
-    // [hW -> Cg̃NbvԍW
+    // ワールド座標 -> ライトのクリップ空間座標
     output.pos = mul(wPos, LightViewProj);
 
     return output;
 }
 
 //-----------------------------------------------------------------------------
-// sNZVF[_[
+// ピクセルシェーダー
 //-----------------------------------------------------------------------------
 void PS_Main(VS_OUT input)
 {
-    // ȂB
-    // [xobt@ւ݂̏DirectX̋@\ŎIɍs邽߁A
-    // ŐFo͂Kv͂ȂB
+    // 何もしない。
+    // 深度バッファへの書き込みはDirectXの機能で自動的に行われるため、
+    // ここで色を出力する必要はない。
 }
\ No newline at end of file
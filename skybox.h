@@ -1,6 +1,6 @@
 /**
  * @file Skybox.h
- * @brief XJC{bNX\
+ * @brief スカイボックス表示
  * @author Natsume Shidara
  * @date 2025/11/21
  */
@@ -1,19 +1,24 @@
 /****************************************
  * @file slice_task_manager.cpp
- * @brief 񓯊XCX̎
+ * @brief 非同期スライス処理の実装
  * @author Natsume Shidara
  * @date 2025/01/05
- * @update 2026/01/13 - planeNormalSliceResultɈp
+ * @update 2026/01/13 - planeNormalをSliceResultに引き継ぎ
+ * @update 2026/10/18 - ステージ別レイテンシ計測・統計API追加
+ * @update 2026/10/18 - 破片のコライダー当てはめをワーカーで実行
  ****************************************/
 
 #include "slice_task_manager.h"
+#include "collider_generator.h"
 #include "debug_ostream.h"
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
 
 using namespace DirectX;
 
 //--------------------------------------
-// ÓIoϐ̒`
+// 静的メンバ変数の定義
 //--------------------------------------
 std::vector<std::thread> SliceTaskManager::s_WorkerThreads;
 std::queue<SliceRequest> SliceTaskManager::s_RequestQueue;
@@ -25,8 +30,38 @@ std::atomic<bool> SliceTaskManager::s_ShouldTerminate(false);
 std::atomic<int> SliceTaskManager::s_NextRequestId(1);
 std::atomic<int> SliceTaskManager::s_PendingTaskCount(0);
 
+std::mutex SliceTaskManager::s_StatsMutex;
+std::vector<SliceTaskManager::TimingRecord> SliceTaskManager::s_TimingRecords;
+size_t SliceTaskManager::s_TimingRecordHead = 0;
+double SliceTaskManager::s_StatsStartTime = 0.0;
+double SliceTaskManager::s_WorkerBusySeconds = 0.0;
+int SliceTaskManager::s_CompletedCount = 0;
+int SliceTaskManager::s_FailedCount = 0;
+
+//--------------------------------------
+// 計測設定
+//--------------------------------------
+namespace
+{
+    constexpr size_t STATS_WINDOW_SIZE = 256; // 統計に使う直近リクエスト数
+    constexpr double SECONDS_TO_MS = 1000.0;
+
+    // ソート済み配列からパーセンタイル値を取得（最近傍順位法）
+    float Percentile(const std::vector<double>& sorted, double ratio)
+    {
+        if (sorted.empty())
+        {
+            return 0.0f;
+        }
+
+        size_t index = static_cast<size_t>(ratio * static_cast<double>(sorted.size() - 1) + 0.5);
+        index = std::min(index, sorted.size() - 1);
+        return static_cast<float>(sorted[index] * SECONDS_TO_MS);
+    }
+}
+
 //======================================
-// EI
+// 初期化・終了
 //======================================
 
 void SliceTaskManager::Initialize(int workerThreadCount)
@@ -35,7 +70,9 @@ void SliceTaskManager::Initialize(int workerThreadCount)
     s_NextRequestId = 1;
     s_PendingTaskCount = 0;
 
-    // [J[XbhN
+    ResetStats();
+
+    // ワーカースレッドを起動
     for (int i = 0; i < workerThreadCount; ++i)
     {
         s_WorkerThreads.emplace_back(WorkerThreadFunction);
@@ -48,11 +85,11 @@ void SliceTaskManager::Initialize(int workerThreadCount)
 
 void SliceTaskManager::Finalize()
 {
-    // ItO𗧂Ă
+    // 終了フラグを立てる
     s_ShouldTerminate = true;
     s_RequestCondition.notify_all();
 
-    // SXbh̏Iҋ@
+    // 全スレッドの終了を待機
     for (auto& thread : s_WorkerThreads)
     {
         if (thread.joinable())
@@ -62,7 +99,7 @@ void SliceTaskManager::Finalize()
     }
     s_WorkerThreads.clear();
 
-    // NGXg̃N[Abv
+    // 未処理リクエストのクリーンアップ
     {
         std::lock_guard<std::mutex> lock(s_RequestMutex);
         while (!s_RequestQueue.empty())
@@ -73,7 +110,7 @@ void SliceTaskManager::Finalize()
         }
     }
 
-    // 擾̌ʂ̃N[Abv
+    // 未取得の結果のクリーンアップ
     {
         std::lock_guard<std::mutex> lock(s_ResultMutex);
         while (!s_ResultQueue.empty())
@@ -88,7 +125,7 @@ void SliceTaskManager::Finalize()
 }
 
 //======================================
-// NGXgM
+// リクエスト送信
 //======================================
 
 int SliceTaskManager::EnqueueSlice(const SliceRequest& request)
@@ -97,8 +134,10 @@ int SliceTaskManager::EnqueueSlice(const SliceRequest& request)
 
     SliceRequest req = request;
     req.requestId = requestId;
+    req.timestamps = SliceTimestamps();
+    req.timestamps.enqueueTime = GetTimestamp();
 
-    // f̎QƃJEg𑝉i[J[Xbhgp邽߁j
+    // モデルの参照カウントを増加（ワーカースレッドが使用するため）
     ModelAddRef(req.targetModel);
 
     {
@@ -113,7 +152,7 @@ int SliceTaskManager::EnqueueSlice(const SliceRequest& request)
 }
 
 //======================================
-// ʎ擾
+// 結果取得
 //======================================
 
 bool SliceTaskManager::TryGetCompletedResult(SliceResult& outResult)
@@ -129,11 +168,13 @@ bool SliceTaskManager::TryGetCompletedResult(SliceResult& outResult)
     s_ResultQueue.pop();
     s_PendingTaskCount--;
 
+    outResult.timestamps.dequeueTime = GetTimestamp();
+
     return true;
 }
 
 //======================================
-// Ԏ擾
+// 状態取得
 //======================================
 
 int SliceTaskManager::GetPendingTaskCount()
@@ -142,7 +183,7 @@ int SliceTaskManager::GetPendingTaskCount()
 }
 
 //======================================
-// [J[Xbh
+// ワーカースレッド処理
 //======================================
 
 void SliceTaskManager::WorkerThreadFunction()
@@ -151,11 +192,11 @@ void SliceTaskManager::WorkerThreadFunction()
     {
         SliceRequest request;
 
-        // NGXgL[擾
+        // リクエストキューから取得
         {
             std::unique_lock<std::mutex> lock(s_RequestMutex);
 
-            // NGXg܂őҋ@
+            // リクエストが来るまで待機
             s_RequestCondition.wait(lock, []() {
                 return !s_RequestQueue.empty() || s_ShouldTerminate;
                                     });
@@ -174,7 +215,9 @@ void SliceTaskManager::WorkerThreadFunction()
             s_RequestQueue.pop();
         }
 
-        // XCXsiCPÛ݁AGPU\[XȂj
+        request.timestamps.workerStartTime = GetTimestamp();
+
+        // スライス処理実行（CPUのみ、GPUリソース生成なし）
         SliceResult result;
         result.requestId = request.requestId;
         result.originalModel = request.targetModel;
@@ -183,9 +226,9 @@ void SliceTaskManager::WorkerThreadFunction()
         result.originalMass = request.originalMass;
         result.rootVolume = request.rootVolume;
         result.colliderType = request.colliderType;
-        result.planeNormal = request.planeNormal;  // ؒfʖ@p
+        result.planeNormal = request.planeNormal;  // 切断平面法線を引き継ぎ
 
-        // Slicer::SliceCPUf[^̂ݎ擾łŌĂяo
+        // Slicer::SliceをCPUデータのみ取得する版で呼び出す
         result.success = Slicer::SliceCPUOnly(
             request.targetModel,
             request.worldMatrix,
@@ -195,10 +238,232 @@ void SliceTaskManager::WorkerThreadFunction()
             result.backMeshes
         );
 
-        // ʂL[ɒǉ
+        // コライダーの当てはめは頂点数に比例して重いため、メインスレッドではなくここで行う
+        if (result.success)
+        {
+            result.frontCollider = ColliderGenerator::GenerateTightestFit(result.frontMeshes);
+            result.backCollider = ColliderGenerator::GenerateTightestFit(result.backMeshes);
+        }
+
+        result.timestamps = request.timestamps;
+        result.timestamps.workerEndTime = GetTimestamp();
+
+        // ワーカー稼働時間の加算
+        {
+            std::lock_guard<std::mutex> lock(s_StatsMutex);
+            s_WorkerBusySeconds += result.timestamps.workerEndTime - result.timestamps.workerStartTime;
+        }
+
+        // 結果をキューに追加
         {
             std::lock_guard<std::mutex> lock(s_ResultMutex);
             s_ResultQueue.push(std::move(result));
         }
     }
+}
+
+//======================================
+// 計測・統計
+//======================================
+
+double SliceTaskManager::GetTimestamp()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+void SliceTaskManager::NotifyFinalized(const SliceResult& result)
+{
+    TimingRecord record;
+    record.requestId = result.requestId;
+    record.success = result.success;
+    record.timestamps = result.timestamps;
+    record.finalizeTime = GetTimestamp();
+
+    std::lock_guard<std::mutex> lock(s_StatsMutex);
+
+    // 固定長リングバッファに記録
+    if (s_TimingRecords.size() < STATS_WINDOW_SIZE)
+    {
+        s_TimingRecords.push_back(record);
+    }
+    else
+    {
+        s_TimingRecords[s_TimingRecordHead] = record;
+    }
+    s_TimingRecordHead = (s_TimingRecordHead + 1) % STATS_WINDOW_SIZE;
+
+    s_CompletedCount++;
+    if (!result.success)
+    {
+        s_FailedCount++;
+    }
+}
+
+SliceStats SliceTaskManager::GetStats()
+{
+    SliceStats stats;
+    stats.pendingTaskCount = s_PendingTaskCount.load();
+    stats.workerCount = static_cast<int>(s_WorkerThreads.size());
+
+    std::vector<TimingRecord> records;
+    double busySeconds = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(s_StatsMutex);
+        records = s_TimingRecords;
+        busySeconds = s_WorkerBusySeconds;
+        stats.completedCount = s_CompletedCount;
+        stats.failedCount = s_FailedCount;
+        stats.elapsedSeconds = static_cast<float>(GetTimestamp() - s_StatsStartTime);
+    }
+
+    stats.sampleCount = static_cast<int>(records.size());
+
+    if (stats.elapsedSeconds > 0.0f)
+    {
+        stats.throughputPerSec = static_cast<float>(stats.completedCount) / stats.elapsedSeconds;
+
+        if (stats.workerCount > 0)
+        {
+            stats.workerUtilization = static_cast<float>(busySeconds / (static_cast<double>(stats.elapsedSeconds) * stats.workerCount));
+            stats.workerUtilization = std::min(stats.workerUtilization, 1.0f);
+        }
+    }
+
+    if (records.empty())
+    {
+        return stats;
+    }
+
+    // ステージごとの所要時間を集計
+    std::vector<double> durations;
+    durations.reserve(records.size());
+
+    for (int stageIndex = 0; stageIndex < static_cast<int>(SliceStage::Count); ++stageIndex)
+    {
+        durations.clear();
+
+        for (const auto& record : records)
+        {
+            const SliceTimestamps& ts = record.timestamps;
+            double duration = 0.0;
+
+            switch (static_cast<SliceStage>(stageIndex))
+            {
+                case SliceStage::QueueWait:  duration = ts.workerStartTime - ts.enqueueTime; break;
+                case SliceStage::Compute:    duration = ts.workerEndTime - ts.workerStartTime; break;
+                case SliceStage::ResultWait: duration = ts.dequeueTime - ts.workerEndTime; break;
+                case SliceStage::Finalize:   duration = record.finalizeTime - ts.dequeueTime; break;
+                case SliceStage::Total:      duration = record.finalizeTime - ts.enqueueTime; break;
+                default: break;
+            }
+
+            durations.push_back(std::max(duration, 0.0));
+        }
+
+        std::sort(durations.begin(), durations.end());
+
+        double sum = 0.0;
+        for (double d : durations)
+        {
+            sum += d;
+        }
+
+        SliceStageStats& stage = stats.stages[stageIndex];
+        stage.p50Ms = Percentile(durations, 0.50);
+        stage.p95Ms = Percentile(durations, 0.95);
+        stage.p99Ms = Percentile(durations, 0.99);
+        stage.maxMs = static_cast<float>(durations.back() * SECONDS_TO_MS);
+        stage.meanMs = static_cast<float>(sum / static_cast<double>(durations.size()) * SECONDS_TO_MS);
+    }
+
+    return stats;
+}
+
+void SliceTaskManager::ResetStats()
+{
+    std::lock_guard<std::mutex> lock(s_StatsMutex);
+
+    s_TimingRecords.clear();
+    s_TimingRecords.reserve(STATS_WINDOW_SIZE);
+    s_TimingRecordHead = 0;
+    s_StatsStartTime = GetTimestamp();
+    s_WorkerBusySeconds = 0.0;
+    s_CompletedCount = 0;
+    s_FailedCount = 0;
+}
+
+void SliceTaskManager::PrintStats()
+{
+    SliceStats stats = GetStats();
+
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer),
+             "[SliceTaskManager] samples=%d completed=%d failed=%d pending=%d throughput=%.2f/s utilization=%.1f%% (%d workers)\n",
+             stats.sampleCount, stats.completedCount, stats.failedCount, stats.pendingTaskCount,
+             stats.throughputPerSec, stats.workerUtilization * 100.0f, stats.workerCount);
+    OutputDebugStringA(buffer);
+
+    for (int i = 0; i < static_cast<int>(SliceStage::Count); ++i)
+    {
+        const SliceStageStats& stage = stats.stages[i];
+        snprintf(buffer, sizeof(buffer),
+                 "  %-10s p50=%7.3fms p95=%7.3fms p99=%7.3fms max=%7.3fms mean=%7.3fms\n",
+                 GetStageName(static_cast<SliceStage>(i)),
+                 stage.p50Ms, stage.p95Ms, stage.p99Ms, stage.maxMs, stage.meanMs);
+        OutputDebugStringA(buffer);
+    }
+}
+
+bool SliceTaskManager::DumpStatsCsv(const char* filePath)
+{
+    std::vector<TimingRecord> records;
+    size_t head = 0;
+    {
+        std::lock_guard<std::mutex> lock(s_StatsMutex);
+        records = s_TimingRecords;
+        head = s_TimingRecordHead;
+    }
+
+    FILE* fp = nullptr;
+    if (fopen_s(&fp, filePath, "w") != 0 || fp == nullptr)
+    {
+        OutputDebugStringA("[SliceTaskManager] Failed to open CSV file\n");
+        return false;
+    }
+
+    fprintf(fp, "request_id,success,queue_wait_ms,compute_ms,result_wait_ms,finalize_ms,total_ms\n");
+
+    // リングバッファを古い順に出力
+    size_t start = (records.size() < STATS_WINDOW_SIZE) ? 0 : head;
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const TimingRecord& record = records[(start + i) % records.size()];
+        const SliceTimestamps& ts = record.timestamps;
+
+        fprintf(fp, "%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f\n",
+                record.requestId,
+                record.success ? 1 : 0,
+                (ts.workerStartTime - ts.enqueueTime) * SECONDS_TO_MS,
+                (ts.workerEndTime - ts.workerStartTime) * SECONDS_TO_MS,
+                (ts.dequeueTime - ts.workerEndTime) * SECONDS_TO_MS,
+                (record.finalizeTime - ts.dequeueTime) * SECONDS_TO_MS,
+                (record.finalizeTime - ts.enqueueTime) * SECONDS_TO_MS);
+    }
+
+    fclose(fp);
+    return true;
+}
+
+const char* SliceTaskManager::GetStageName(SliceStage stage)
+{
+    switch (stage)
+    {
+        case SliceStage::QueueWait:  return "QueueWait";
+        case SliceStage::Compute:    return "Compute";
+        case SliceStage::ResultWait: return "ResultWait";
+        case SliceStage::Finalize:   return "Finalize";
+        case SliceStage::Total:      return "Total";
+        default:                     return "Unknown";
+    }
 }
\ No newline at end of file
@@ -1,9 +1,11 @@
 /****************************************
  * @file slice_task_manager.h
- * @brief 񓯊XCX^XNǗ
+ * @brief 非同期スライス処理タスク管理
  * @author Natsume Shidara
  * @date 2025/01/05
- * @update 2026/01/13 - SliceResultplaneNormalǉ
+ * @update 2026/01/13 - SliceResultにplaneNormal追加
+ * @update 2026/10/18 - ステージ別レイテンシ計測・統計API追加
+ * @update 2026/10/18 - 破片のコライダーをワーカーで当てはめてSliceResultに格納
  ****************************************/
 #pragma once
 #include "model.h"
@@ -17,54 +19,116 @@
 #include <atomic>
 #include <condition_variable>
 
+//--------------------------------------
+// スライス処理の各ステージ時刻（秒、steady_clock基準）
+//--------------------------------------
+struct SliceTimestamps
+{
+    double enqueueTime = 0.0;     // EnqueueSlice呼び出し時刻（メインスレッド）
+    double workerStartTime = 0.0; // ワーカーが取り出した時刻
+    double workerEndTime = 0.0;   // ワーカーが結果を積んだ時刻
+    double dequeueTime = 0.0;     // メインスレッドが結果を取得した時刻
+};
+
  //--------------------------------------
- // XCXNGXg\
+ // スライスリクエスト構造体
  //--------------------------------------
 struct SliceRequest
 {
-    MODEL* targetModel;              // ؒfΏۃfiQƃJEgς݁j
-    DirectX::XMFLOAT4X4 worldMatrix; // [hϊs
-    DirectX::XMFLOAT3 planePoint;    // ʏ̓_
-    DirectX::XMFLOAT3 planeNormal;   // ʖ@
+    MODEL* targetModel;              // 切断対象モデル（参照カウント済み）
+    DirectX::XMFLOAT4X4 worldMatrix; // ワールド変換行列
+    DirectX::XMFLOAT3 planePoint;    // 平面上の点
+    DirectX::XMFLOAT3 planeNormal;   // 平面法線
 
-    // IuWFNg̕
+    // 元オブジェクトの物理情報
     DirectX::XMFLOAT3 originalPosition;
     DirectX::XMFLOAT3 originalVelocity;
     float originalMass;
     float rootVolume;
     ColliderType colliderType;
 
-    int requestId; // NGXgʗpID
+    int requestId; // リクエスト識別用ID
+
+    SliceTimestamps timestamps; // 計測用（EnqueueSliceで設定）
 };
 
 //--------------------------------------
-// XCXʍ\́iCPUf[^̂݁j
+// スライス結果構造体（CPUデータのみ）
 //--------------------------------------
 struct SliceResult
 {
     int requestId;
     bool success;
 
-    // CPŨbVf[^iGPUobt@쐬j
+    // CPU側のメッシュデータ（GPUバッファ未作成）
     std::vector<MeshData> frontMeshes;
     std::vector<MeshData> backMeshes;
 
-    // f̎QƁi}eAppj
+    // 各メッシュ群に当てはめたコライダー（モデル空間、体積が最小の形状）
+    Collider frontCollider;
+    Collider backCollider;
+
+    // 元モデルの参照（マテリアル情報継承用）
     MODEL* originalModel;
 
-    // ̈p
+    // 物理情報の引き継ぎ
     DirectX::XMFLOAT3 originalPosition;
     DirectX::XMFLOAT3 originalVelocity;
     float originalMass;
     float rootVolume;
     ColliderType colliderType;
 
-    // ؒfʖ@ivZpj
+    // 切断平面法線（分離方向計算用）
     DirectX::XMFLOAT3 planeNormal;
+
+    // 計測用タイムスタンプ（NotifyFinalizedに渡す）
+    SliceTimestamps timestamps;
 };
 
 //--------------------------------------
-// 񓯊XCX^XN}l[W[
+// 計測ステージ
+//--------------------------------------
+enum class SliceStage
+{
+    QueueWait,  // Enqueue → ワーカー開始
+    Compute,    // ワーカー開始 → ワーカー終了
+    ResultWait, // ワーカー終了 → 結果取得
+    Finalize,   // 結果取得 → メインスレッドでの破片生成完了
+    Total,      // Enqueue → 破片生成完了
+
+    Count
+};
+
+//--------------------------------------
+// ステージ別統計（ミリ秒）
+//--------------------------------------
+struct SliceStageStats
+{
+    float p50Ms = 0.0f;
+    float p95Ms = 0.0f;
+    float p99Ms = 0.0f;
+    float maxMs = 0.0f;
+    float meanMs = 0.0f;
+};
+
+//--------------------------------------
+// スライスパイプライン統計
+//--------------------------------------
+struct SliceStats
+{
+    int sampleCount = 0;          // 直近ウィンドウ内のサンプル数
+    int completedCount = 0;       // リセット以降の完了数
+    int failedCount = 0;          // リセット以降の切断失敗数
+    int pendingTaskCount = 0;     // 処理中のタスク数
+    int workerCount = 0;          // ワーカースレッド数
+    float elapsedSeconds = 0.0f;  // リセットからの経過時間
+    float throughputPerSec = 0.0f;  // 完了数 / 経過時間
+    float workerUtilization = 0.0f; // ワーカー稼働時間 / (経過時間 × スレッド数)
+    SliceStageStats stages[static_cast<int>(SliceStage::Count)];
+};
+
+//--------------------------------------
+// 非同期スライスタスクマネージャー
 //--------------------------------------
 class SliceTaskManager
 {
@@ -72,20 +136,53 @@ public:
     static void Initialize(int workerThreadCount = 4);
     static void Finalize();
 
-    // XCXNGXgL[ɒǉiCXbhj
+    // スライスリクエストをキューに追加（メインスレッド）
     static int EnqueueSlice(const SliceRequest& request);
 
-    // ʂ擾iCXbhj
+    // 完了した結果を取得（メインスレッド）
     static bool TryGetCompletedResult(SliceResult& outResult);
 
-    // ̃^XN擾
+    // 処理中のタスク数を取得
     static int GetPendingTaskCount();
 
+    //----------------------------------
+    // 計測・統計
+    //----------------------------------
+
+    // 結果の反映（破片生成）完了を通知（メインスレッド）
+    static void NotifyFinalized(const SliceResult& result);
+
+    // 直近ウィンドウの統計を取得
+    static SliceStats GetStats();
+
+    // 統計をリセット
+    static void ResetStats();
+
+    // 統計をデバッグ出力に表示
+    static void PrintStats();
+
+    // 直近ウィンドウの全リクエスト記録をCSVに書き出し
+    static bool DumpStatsCsv(const char* filePath);
+
+    // ステージ名の取得
+    static const char* GetStageName(SliceStage stage);
+
 private:
-    // [J[Xbh̃Gg[|Cg
+    // 1リクエスト分の計測記録
+    struct TimingRecord
+    {
+        int requestId;
+        bool success;
+        SliceTimestamps timestamps;
+        double finalizeTime;
+    };
+
+    // 計測時刻の取得（秒）
+    static double GetTimestamp();
+    // ワーカースレッドのエントリーポイント
     static void WorkerThreadFunction();
 
-    // f[^
+    // 内部データ
     static std::vector<std::thread> s_WorkerThreads;
     static std::queue<SliceRequest> s_RequestQueue;
     static std::queue<SliceResult> s_ResultQueue;
@@ -95,4 +192,13 @@ private:
     static std::atomic<bool> s_ShouldTerminate;
     static std::atomic<int> s_NextRequestId;
     static std::atomic<int> s_PendingTaskCount;
+
+    // 計測データ
+    static std::mutex s_StatsMutex;
+    static std::vector<TimingRecord> s_TimingRecords; // リングバッファ
+    static size_t s_TimingRecordHead;
+    static double s_StatsStartTime;
+    static double s_WorkerBusySeconds;
+    static int s_CompletedCount;
+    static int s_FailedCount;
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
 /****************************************
  * @file slicer.cpp
- * @brief bVؒfiEar ClippingΉEAABBJOœKŁj
+ * @brief メッシュ切断実装（Ear Clipping対応・AABBカリング最適化版）
  * @author Natsume Shidara
  * @date 2025/12/08
  * @update 2025/12/17 (Optimization applied)
@@ -12,12 +12,12 @@
 #include <list>
 #include <map>
 #include <vector>
-#include <float.h> // FLT_MAXp
+#include <float.h> // FLT_MAX用
 
 using namespace DirectX;
 
 //--------------------------------------
-// p\́E萔
+// 内部用構造体・定数
 //--------------------------------------
 
 const float EPSILON = 1e-4f;
@@ -28,13 +28,13 @@ struct RawEdge
     XMFLOAT3 end;
 };
 
-// 2DvZp
+// 2D計算用
 struct Vector2
 {
     float x, y;
 };
 
-// AABB茋
+// AABB判定結果
 enum class PlaneSide
 {
     Front,
@@ -43,23 +43,23 @@ enum class PlaneSide
 };
 
 //--------------------------------------
-// wp[֐i2D􉽌vZEAABBj
+// ヘルパー関数（2D幾何計算・AABB）
 //--------------------------------------
 
-// NXρi2Dj
+// クロス積（2D）
 static float Cross(const Vector2& a, const Vector2& b) { return a.x * b.y - a.y * b.x; }
 
-// _Op`̓ɂ邩
+// 点が三角形の内部にあるか判定
 static bool IsPointInTriangle(const Vector2& p, const Vector2& a, const Vector2& b, const Vector2& c)
 {
     float cp1 = Cross({ b.x - a.x, b.y - a.y }, { p.x - a.x, p.y - a.y });
     float cp2 = Cross({ c.x - b.x, c.y - b.y }, { p.x - b.x, p.y - b.y });
     float cp3 = Cross({ a.x - c.x, a.y - c.y }, { p.x - c.x, p.y - c.y });
-    // SēȂiӏ܂ށj
+    // 全て同じ符号なら内部（辺上含む）
     return (cp1 >= -EPSILON && cp2 >= -EPSILON && cp3 >= -EPSILON) || (cp1 <= EPSILON && cp2 <= EPSILON && cp3 <= EPSILON);
 }
 
-// UVvZi]̕ʓeE^COpj
+// UV計算（従来の平面投影・タイリング用）
 static XMFLOAT2 CalculatePlanarUV(const XMFLOAT3& pos, const XMVECTOR& planeNormal, const XMVECTOR& planeTangent, const XMVECTOR& planeBinormal)
 {
     (void)planeNormal;
@@ -70,7 +70,7 @@ static XMFLOAT2 CalculatePlanarUV(const XMFLOAT3& pos, const XMVECTOR& planeNorm
     return XMFLOAT2(u * 0.5f + 0.5f, v * 0.5f + 0.5f);
 }
 
-// _̃EFfBOiWj
+// 頂点のウェルディング（座標統合）
 static int GetWeldedVertexIndex(std::vector<XMFLOAT3>& vertices, const XMFLOAT3& pos)
 {
     for (int i = 0; i < (int)vertices.size(); ++i)
@@ -85,10 +85,10 @@ static int GetWeldedVertexIndex(std::vector<XMFLOAT3>& vertices, const XMFLOAT3&
     return (int)vertices.size() - 1;
 }
 
-// AABBƕʂ̔
+// AABBと平面の判定
 static PlaneSide CheckAABBPlane(const AABB& aabb, const XMVECTOR& planeEq)
 {
-    // AABB8_쐬
+    // AABBの8頂点を作成
     XMFLOAT3 corners[8] = {
         { aabb.min.x, aabb.min.y, aabb.min.z },
         { aabb.min.x, aabb.min.y, aabb.max.z },
@@ -109,17 +109,17 @@ static PlaneSide CheckAABBPlane(const AABB& aabb, const XMVECTOR& planeEq)
         if (dist > EPSILON) frontCount++;
         else if (dist < -EPSILON) backCount++;
         else {
-            // ʏie͈͓j̏ꍇ͗ɃJEg܂͖
-            // ł͌̂ߖAɂȂ₷
+            // 平面上（許容範囲内）の場合は両方にカウントまたは無視
+            // ここでは厳密判定のため無視し、交差扱いになりやすくする
         }
     }
 
-    if (backCount == 0) return PlaneSide::Front; // Sĕ\
-    if (frontCount == 0) return PlaneSide::Back; // Sė
-    return PlaneSide::Intersect;                 // 
+    if (backCount == 0) return PlaneSide::Front; // 全て表
+    if (frontCount == 0) return PlaneSide::Back; // 全て裏
+    return PlaneSide::Intersect;                 // 交差
 }
 
-// bVf[^AABBvZ
+// メッシュデータからAABBを計算する
 static AABB CalculateMeshAABB(const MeshData& mesh)
 {
     AABB aabb;
@@ -142,11 +142,11 @@ static AABB CalculateMeshAABB(const MeshData& mesh)
 }
 
 //--------------------------------------
-// [vo & p`iEar Clippingj
+// ループ抽出 & 多角形分割（Ear Clipping）
 //--------------------------------------
 
 /**
- * @brief GbWX[v[v𒊏o
+ * @brief エッジスープから閉じたループを抽出する
  */
 static void ExtractLoops(const std::vector<RawEdge>& rawEdges, std::vector<std::vector<XMFLOAT3>>& outLoops)
 {
@@ -156,7 +156,7 @@ static void ExtractLoops(const std::vector<RawEdge>& rawEdges, std::vector<std::
     std::vector<XMFLOAT3> uniqueVertices;
     std::map<int, std::vector<int>> adjacency;
 
-    // 1. EFfBOƃOt\z
+    // 1. ウェルディングとグラフ構築
     for (const auto& e : rawEdges)
     {
         int s = GetWeldedVertexIndex(uniqueVertices, e.start);
@@ -167,7 +167,7 @@ static void ExtractLoops(const std::vector<RawEdge>& rawEdges, std::vector<std::
         }
     }
 
-    // 2. [vǐ
+    // 2. ループ追跡
     while (!adjacency.empty())
     {
         std::vector<XMFLOAT3> currentLoop;
@@ -182,7 +182,7 @@ static void ExtractLoops(const std::vector<RawEdge>& rawEdges, std::vector<std::
 
             auto it = adjacency.find(currentNode);
             if (it == adjacency.end() || it->second.empty())
-                break; // oHr؂
+                break; // 経路途切れ
 
             int nextNode = it->second.back();
             it->second.pop_back();
@@ -205,7 +205,7 @@ static void ExtractLoops(const std::vector<RawEdge>& rawEdges, std::vector<std::
 }
 
 /**
- * @brief @ɂOp`
+ * @brief 耳刈り取り法による三角形分割
  */
 static void TriangulateEarClipping(const std::vector<XMFLOAT3>& loop3D, const XMVECTOR& planeNormal, std::vector<unsigned int>& outIndices, int baseIndexOffset)
 {
@@ -213,15 +213,15 @@ static void TriangulateEarClipping(const std::vector<XMFLOAT3>& loop3D, const XM
     if (count < 3)
         return;
 
-    // 1. 2Dʂ֓e邽߂̊xNg
+    // 1. 2D平面へ投影するための基底ベクトル
     XMVECTOR vUp = (std::abs(XMVectorGetY(planeNormal)) > 0.9f) ? XMVectorSet(0, 0, 1, 0) : XMVectorSet(0, 1, 0, 0);
     XMVECTOR vTangent = XMVector3Normalize(XMVector3Cross(planeNormal, vUp));
     XMVECTOR vBinormal = XMVector3Normalize(XMVector3Cross(planeNormal, vTangent));
 
     std::vector<Vector2> poly(count);
-    std::vector<int> indices(count); // _̃CfbNXXgiĂj
+    std::vector<int> indices(count); // 頂点のインデックスリスト（これを削っていく）
 
-    // 2De
+    // 2D投影
     for (int i = 0; i < count; ++i)
     {
         XMVECTOR pos = XMLoadFloat3(&loop3D[i]);
@@ -230,7 +230,7 @@ static void TriangulateEarClipping(const std::vector<XMFLOAT3>& loop3D, const XM
         indices[i] = i;
     }
 
-    // 2. ̊mFitʐρj
+    // 2. 巻き順の確認（符号付き面積）
     float area = 0;
     for (int i = 0; i < count; ++i)
     {
@@ -239,16 +239,16 @@ static void TriangulateEarClipping(const std::vector<XMFLOAT3>& loop3D, const XM
         area += (p1.x * p2.y - p2.x * p1.y);
     }
 
-    // Ear ClippingCCWivjł邱ƂOƂ
-    // ʐςȂ玞vȂ̂ŁACfbNX𔽓]
+    // Ear ClippingはCCW（反時計回り）であることを前提とする
+    // 面積が負なら時計回りなので、インデックス順序を反転
     if (area < 0)
     {
         std::reverse(indices.begin(), indices.end());
     }
 
-    // 3. 胋[v
-    // Xg璸_菜ȂOp`
-    int safetyCount = count * count; // [vh~
+    // 3. 耳刈り取りループ
+    // リストから頂点を取り除きながら三角形を作る
+    int safetyCount = count * count; // 無限ループ防止
 
     while (indices.size() > 2 && safetyCount > 0)
     {
@@ -266,13 +266,13 @@ static void TriangulateEarClipping(const std::vector<XMFLOAT3>& loop3D, const XM
             const Vector2& b = poly[currIdx];
             const Vector2& c = poly[nextIdx];
 
-            // ʐiCrossςȂʁAȂ牚j
-            // CCWȂ獶܂
+            // 凸性判定（Cross積が正なら凸、負なら凹）
+            // CCWなら左折が正
             float cp = Cross({ b.x - a.x, b.y - a.y }, { c.x - b.x, c.y - b.y });
             if (cp <= EPSILON)
-                continue; // _܂͈꒼
+                continue; // 凹頂点または一直線
 
-            // ̒_̎Op`Ɋ܂܂ĂȂmF
+            // 他の頂点がこの三角形に含まれていないか確認
             bool isEar = true;
             for (int j = 0; j < n; ++j)
             {
@@ -289,12 +289,12 @@ static void TriangulateEarClipping(const std::vector<XMFLOAT3>& loop3D, const XM
 
             if (isEar)
             {
-                // Op`ĩbVł̃CfbNXۑj
+                // 三角形生成（元のメッシュでのインデックスを保存）
                 outIndices.push_back(baseIndexOffset + prevIdx);
                 outIndices.push_back(baseIndexOffset + currIdx);
                 outIndices.push_back(baseIndexOffset + nextIdx);
 
-                // i݂̒_jXg폜
+                // 耳（現在の頂点）をリストから削除
                 indices.erase(indices.begin() + i);
                 earFound = true;
                 break;
@@ -303,7 +303,7 @@ static void TriangulateEarClipping(const std::vector<XMFLOAT3>& loop3D, const XM
 
         if (!earFound)
         {
-            // ꎨȂꍇiȌȂǁjAIɍŏ3Ői߂
+            // 万が一耳が見つからない場合（自己交差など）、強制的に最初の3つを結んで進める
             outIndices.push_back(baseIndexOffset + indices[0]);
             outIndices.push_back(baseIndexOffset + indices[1]);
             outIndices.push_back(baseIndexOffset + indices[2]);
@@ -313,34 +313,34 @@ static void TriangulateEarClipping(const std::vector<XMFLOAT3>& loop3D, const XM
 }
 
 /**
- * @brief fʃbViEar ClippingŁj
- * @detail eNX`IDw肳ĂꍇAfʑŜ̃oEfBO{bNXɍ킹UV0-1Ƀ}bsO܂
+ * @brief 断面メッシュ生成（Ear Clipping版）
+ * @detail テクスチャIDが指定されている場合、断面全体のバウンディングボックスに合わせてUVを0-1にマッピングします
  */
 static void CreateCapMesh(int texId, MeshData& mesh, const std::vector<RawEdge>& rawEdges, const XMVECTOR& planeNormal)
 {
     std::vector<std::vector<XMFLOAT3>> loops;
-    ExtractLoops(rawEdges, loops); // [vo
+    ExtractLoops(rawEdges, loops); // ループ抽出
 
     if (loops.empty())
         return;
 
-    // xNgvZiepj
+    // 基底ベクトル計算（投影用）
     XMVECTOR vUp = (std::abs(XMVectorGetY(planeNormal)) > 0.9f) ? XMVectorSet(0, 0, 1, 0) : XMVectorSet(0, 1, 0, 0);
     XMVECTOR vTangent = XMVector3Normalize(XMVector3Cross(planeNormal, vUp));
     XMVECTOR vBinormal = XMVector3Normalize(XMVector3Cross(planeNormal, vTangent));
 
     for (const auto& loop : loops)
     {
-        // _o^Jnʒu
+        // 頂点登録開始位置
         int baseIndex = (int)mesh.vertices.size();
 
         // ----------------------------------------------------
-        // UVvẐ߂̑OF[vŜ̃oEfBO{bNXvZ
+        // UV計算のための前処理：ループ全体のバウンディングボックスを計算
         // ----------------------------------------------------
         float minU = FLT_MAX, maxU = -FLT_MAX;
         float minV = FLT_MAX, maxV = -FLT_MAX;
 
-        // eNX`w肪΁AoEfBO{bNXvZ
+        // もしテクスチャ指定があれば、バウンディングボックスを計算する
         if (texId != -1)
         {
             for (const auto& pos : loop)
@@ -355,13 +355,13 @@ static void CreateCapMesh(int texId, MeshData& mesh, const std::vector<RawEdge>&
                 if (v > maxV) maxV = v;
             }
 
-            // TCYꍇ̃[Z΍
+            // サイズが小さすぎる場合のゼロ除算対策
             if (std::abs(maxU - minU) < EPSILON) maxU = minU + 1.0f;
             if (std::abs(maxV - minV) < EPSILON) maxV = minV + 1.0f;
         }
 
         // ----------------------------------------------------
-        // _
+        // 頂点生成
         // ----------------------------------------------------
         for (const auto& pos : loop)
         {
@@ -372,8 +372,8 @@ static void CreateCapMesh(int texId, MeshData& mesh, const std::vector<RawEdge>&
 
             if (texId != -1)
             {
-                // oEfBO{bNXɍ킹UV𐳋K (0.0 ` 1.0)
-                // ɂAfʂ̌`󂢂ςɃeNX`tBbg܂
+                // バウンディングボックスに合わせてUVを正規化 (0.0 ～ 1.0)
+                // これにより、断面の形状いっぱいにテクスチャがフィットします
                 XMVECTOR vPos = XMLoadFloat3(&pos);
                 float rawU = XMVectorGetX(XMVector3Dot(vPos, vTangent));
                 float rawV = XMVectorGetX(XMVector3Dot(vPos, vBinormal));
@@ -383,19 +383,19 @@ static void CreateCapMesh(int texId, MeshData& mesh, const std::vector<RawEdge>&
             }
             else
             {
-                // eNX`Ȃi܂̓ftHgj̏ꍇ͏]̕ʓe
+                // テクスチャなし（またはデフォルト）の場合は従来の平面投影
                 v.uv = CalculatePlanarUV(pos, planeNormal, vTangent, vBinormal);
             }
             mesh.vertices.push_back(v);
         }
 
-        // Ear ClippingŃCfbNX
+        // Ear Clippingでインデックス生成
         TriangulateEarClipping(loop, planeNormal, mesh.indices, baseIndex);
     }
 }
 
 //======================================
-// NX
+// クラス実装部
 //======================================
 
 bool Slicer::Slice(MODEL* targetModel, const XMFLOAT4X4& worldMatrix, const XMFLOAT3& planePoint, const XMFLOAT3& planeNormal, MODEL** outFront, MODEL** outBack)
@@ -403,7 +403,7 @@ bool Slicer::Slice(MODEL* targetModel, const XMFLOAT4X4& worldMatrix, const XMFL
     if (!targetModel)
         return false;
 
-    // 1. Wϊ
+    // 1. 座標変換
     XMMATRIX mWorld = XMLoadFloat4x4(&worldMatrix);
     XMMATRIX mInvWorld = XMMatrixInverse(nullptr, mWorld);
     XMVECTOR vLocalPoint = XMVector3TransformCoord(XMLoadFloat3(&planePoint), mInvWorld);
@@ -412,45 +412,45 @@ bool Slicer::Slice(MODEL* targetModel, const XMFLOAT4X4& worldMatrix, const XMFL
     XMVECTOR planeEq = XMVectorSetW(vLocalNormal, distanceD);
 
     // ---------------------------------------------------------
-    // yœKzfŜAABB`FbN
+    // 【最適化】モデル全体のAABBチェック
     // ---------------------------------------------------------
-    // f̃[JAABBƐؒfʂr
+    // モデルのローカルAABBと切断平面を比較する
     PlaneSide modelSide = CheckAABBPlane(targetModel->local_aabb, planeEq);
 
     if (modelSide == PlaneSide::Front)
     {
-        // Sɕ\ -> ؒfȂiFront̂݁ABackȂj
-        // ĂяoŁufalsevƂĈƂŁAʂȃmۂƃRs[h
+        // 完全に表側 -> 切断なし（Frontのみ、Backなし）
+        // 呼び出し元で「false」として扱うことで、無駄なメモリ確保とコピーを防ぐ
         *outFront = nullptr;
         *outBack = nullptr;
         return false;
     }
     else if (modelSide == PlaneSide::Back)
     {
-        // Sɗ -> ؒfȂiBack̂݁AFrontȂj
+        // 完全に裏側 -> 切断なし（Backのみ、Frontなし）
         *outFront = nullptr;
         *outBack = nullptr;
         return false;
     }
 
     // ---------------------------------------------------------
-    // ۂ̐ؒfiĂꍇ̂ݓBj
+    // ここから実際の切断処理（交差している場合のみ到達）
     // ---------------------------------------------------------
 
     int capMaterialIndex = 0;
     if (targetModel->pSliceTextureSRV != nullptr)
     {
-        // fʗpeNX`ꍇAXǵuvɒǉ͂Ȃ̂ŁÃCfbNXw
+        // 断面用テクスチャがある場合、既存リストの「次」に追加されるはずなので、そのインデックスを指定
         capMaterialIndex = (int)targetModel->materials.size();
     }
     else
     {
-        // eNX`Ȃꍇ́Ãf̑fށi0ԂȂǁjg
+        // テクスチャがない場合は、元のモデルの素材（0番など）を使い回す
         if (!targetModel->Meshes.empty())
             capMaterialIndex = targetModel->Meshes[0].materialIndex;
     }
 
-    // 2. bV & GbWW
+    // 2. メッシュ分割 & エッジ収集
     std::vector<MeshData> frontMeshes, backMeshes;
     std::vector<RawEdge> allFrontCapEdges, allBackCapEdges;
 
@@ -461,27 +461,27 @@ bool Slicer::Slice(MODEL* targetModel, const XMFLOAT4X4& worldMatrix, const XMFL
     for (const auto& srcMesh : targetModel->Meshes)
     {
         // ---------------------------------------------------------
-        // yœKzbVPʂAABB`FbN
+        // 【最適化】メッシュ単位のAABBチェック
         // ---------------------------------------------------------
-        // ʂ̃bVʂɑ΂ĂǂzuĂ邩mF
-        // AABBsxvZRXg(O(V))͂邪ASlicing(O(V) + )͗yɌy
+        // 個別のメッシュが平面に対してどう配置されているか確認
+        // AABBを都度計算するコスト(O(V))はあるが、Slicing(O(V) + α)よりは遥かに軽い
         AABB meshAABB = CalculateMeshAABB(srcMesh);
         PlaneSide meshSide = CheckAABBPlane(meshAABB, planeEq);
 
         if (meshSide == PlaneSide::Front)
         {
-            // ۂFrontփRs[
+            // 丸ごとFrontへコピー
             frontMeshes.push_back(srcMesh);
-            continue; // ̃bV
+            continue; // 次のメッシュへ
         }
         else if (meshSide == PlaneSide::Back)
         {
-            // ۂBackփRs[
+            // 丸ごとBackへコピー
             backMeshes.push_back(srcMesh);
-            continue; // ̃bV
+            continue; // 次のメッシュへ
         }
 
-        // Ăꍇ̂݁AOp`Ƃ̏ڍ׃`FbNs
+        // 交差している場合のみ、三角形ごとの詳細チェックを行う
         MeshData frontMesh, backMesh;
         frontMesh.materialIndex = srcMesh.materialIndex;
         backMesh.materialIndex = srcMesh.materialIndex;
@@ -535,13 +535,13 @@ bool Slicer::Slice(MODEL* targetModel, const XMFLOAT4X4& worldMatrix, const XMFL
 
             if (bFront[isoIdx])
             {
-                // FrontǗ -> fʂ split0 -> split1
+                // Front側が孤立 -> 断面は split0 -> split1
                 allFrontCapEdges.push_back({ split0.position, split1.position });
                 allBackCapEdges.push_back({ split1.position, split0.position });
             }
             else
             {
-                // BackǗ -> fʂ split0 -> split1
+                // Back側が孤立 -> 断面は split0 -> split1
                 allBackCapEdges.push_back({ split0.position, split1.position });
                 allFrontCapEdges.push_back({ split1.position, split0.position });
             }
@@ -576,13 +576,13 @@ bool Slicer::Slice(MODEL* targetModel, const XMFLOAT4X4& worldMatrix, const XMFL
             backMeshes.push_back(backMesh);
     }
 
-    // 3. fʐiEar ClippingKpj
+    // 3. 断面生成（Ear Clipping適用）
     if (!allFrontCapEdges.empty())
     {
         MeshData capMesh;
         capMesh.materialIndex = capMaterialIndex;
-        // ʓr}eApӂȂAtexIdɑΉ}eAIDݒ肷
-        CreateCapMesh(targetModel->GetSlicedTexturId(), capMesh, allFrontCapEdges, -vLocalNormal); // Front͋t@
+        // もし別途マテリアルを用意するなら、ここでtexIdに対応するマテリアルIDを設定する
+        CreateCapMesh(targetModel->GetSlicedTexturId(), capMesh, allFrontCapEdges, -vLocalNormal); // Frontは逆法線
         if (!capMesh.vertices.empty())
             frontMeshes.push_back(capMesh);
     }
@@ -596,7 +596,7 @@ bool Slicer::Slice(MODEL* targetModel, const XMFLOAT4X4& worldMatrix, const XMFL
             backMeshes.push_back(capMesh);
     }
 
-    // ̃bV݂ꍇ̂݁uؒfvƂ
+    // 両方のメッシュが存在する場合のみ「切断成功」とする
     if (frontMeshes.empty() || backMeshes.empty())
     {
         *outFront = nullptr;
@@ -611,7 +611,7 @@ bool Slicer::Slice(MODEL* targetModel, const XMFLOAT4X4& worldMatrix, const XMFL
 }
 
 /*
-*@brief CPUpXCXiGPUobt@쐬Ȃj
+*@brief CPU専用スライス処理（GPUバッファ作成なし）
 */
 bool Slicer::SliceCPUOnly(
     MODEL * targetModel,
@@ -624,7 +624,7 @@ bool Slicer::SliceCPUOnly(
     if (!targetModel)
         return false;
 
-    // Wϊ
+    // 座標変換
     XMMATRIX mWorld = XMLoadFloat4x4(&worldMatrix);
     XMMATRIX mInvWorld = XMMatrixInverse(nullptr, mWorld);
     XMVECTOR vLocalPoint = XMVector3TransformCoord(XMLoadFloat3(&planePoint), mInvWorld);
@@ -632,14 +632,14 @@ bool Slicer::SliceCPUOnly(
     float distanceD = -XMVectorGetX(XMVector3Dot(vLocalNormal, vLocalPoint));
     XMVECTOR planeEq = XMVectorSetW(vLocalNormal, distanceD);
 
-    // fŜAABB`FbNiœKj
+    // モデル全体のAABBチェック（最適化）
     PlaneSide modelSide = CheckAABBPlane(targetModel->local_aabb, planeEq);
     if (modelSide == PlaneSide::Front || modelSide == PlaneSide::Back)
     {
         return false;
     }
 
-    // fʗp}eACfbNX
+    // 断面用マテリアルインデックス
     int capMaterialIndex = 0;
     if (targetModel->pSliceTextureSRV != nullptr)
     {
@@ -651,7 +651,7 @@ bool Slicer::SliceCPUOnly(
             capMaterialIndex = targetModel->Meshes[0].materialIndex;
     }
 
-    // bV
+    // メッシュ分割処理
     std::vector<RawEdge> allFrontCapEdges, allBackCapEdges;
 
     for (const auto& srcMesh : targetModel->Meshes)
@@ -670,7 +670,7 @@ bool Slicer::SliceCPUOnly(
             continue;
         }
 
-        // bV̏iR[hƓWbNj
+        // 交差メッシュの処理（既存コードと同じロジック）
         MeshData frontMesh, backMesh;
         frontMesh.materialIndex = srcMesh.materialIndex;
         backMesh.materialIndex = srcMesh.materialIndex;
@@ -705,7 +705,7 @@ bool Slicer::SliceCPUOnly(
                 continue;
             }
 
-            // Op`iWbNƓj
+            // 三角形分割処理（既存ロジックと同じ）
             int isoIdx = -1;
             if (bFront[0] == bFront[2])
                 isoIdx = 1;
@@ -764,7 +764,7 @@ bool Slicer::SliceCPUOnly(
             outBackMeshes.push_back(backMesh);
     }
 
-    // fʐ
+    // 断面生成
     if (!allFrontCapEdges.empty())
     {
         MeshData capMesh;
@@ -1,8 +1,9 @@
 /****************************************
  * @file slicer.h
- * @brief bVؒfW[
+ * @brief メッシュ切断モジュール
  * @author Natsume Shidara
  * @date 2025/12/06
+ * @update 2026/10/18 - 刃の掃いた四角形と切断平面の組
  ****************************************/
 
 #ifndef SLICER_H
@@ -12,21 +13,37 @@
 #include <DirectXMath.h>
 #include <vector>
 
+//======================================
+// 刃の掃引範囲
+//======================================
+/**
+ * @struct SliceSweep
+ * @brief 前フレームから今フレームまでに刃が掃いた四角形と、切断に使う平面
+ * @detail corners は周回順（前フレームの根元・先端、今フレームの先端・根元）。
+ *         候補はこの四角形と重なるもの、切断は平面が境界をまたぐものに限る
+ */
+struct SliceSweep
+{
+    DirectX::XMFLOAT3 corners[4];
+    DirectX::XMFLOAT3 planePoint;
+    DirectX::XMFLOAT3 planeNormal;  // 単位ベクトル
+};
+
  //======================================
- // bVؒfNX
+ // メッシュ切断クラス
  //======================================
 class Slicer
 {
 public:
     /**
-     * @brief bV𕽖ʂŐؒfi]ŁEj
-     * @param targetModel ؒfΏۃf
-     * @param worldMatrix [hϊs
-     * @param planePoint ʏ̓_
-     * @param planeNormal ʖ@
-     * @param outFront \̐VKfiĂяoŉj
-     * @param outBack ̐VKfiĂяoŉj
-     * @return ؒftrue
+     * @brief メッシュを平面で切断（従来版・同期処理）
+     * @param targetModel 切断対象モデル
+     * @param worldMatrix ワールド変換行列
+     * @param planePoint 平面上の点
+     * @param planeNormal 平面法線
+     * @param outFront 表側の新規モデル（呼び出し側で解放）
+     * @param outBack 裏側の新規モデル（呼び出し側で解放）
+     * @return 切断成功時true
      */
     static bool Slice(
         MODEL* targetModel,
@@ -38,15 +55,15 @@ public:
     );
 
     /**
-     * @brief CPUf[^̂ݐi񓯊pj
-     * @detail GPUobt@쐬AbVf[^̂ݕԂ
-     * @param targetModel ؒfΏۃf
-     * @param worldMatrix [hϊs
-     * @param planePoint ʏ̓_
-     * @param planeNormal ʖ@
-     * @param outFrontMeshes \̃bVf[^z
-     * @param outBackMeshes ̃bVf[^z
-     * @return ؒftrue
+     * @brief CPUデータのみ生成（非同期処理用）
+     * @detail GPUバッファを作成せず、メッシュデータのみ返す
+     * @param targetModel 切断対象モデル
+     * @param worldMatrix ワールド変換行列
+     * @param planePoint 平面上の点
+     * @param planeNormal 平面法線
+     * @param outFrontMeshes 表側のメッシュデータ配列
+     * @param outBackMeshes 裏側のメッシュデータ配列
+     * @return 切断成功時true
      */
     static bool SliceCPUOnly(
         MODEL* targetModel,
@@ -58,10 +75,10 @@ public:
     );
 
 private:
-    // _
+    // 頂点補間
     static Vertex Interpolate(const Vertex& v1, const Vertex& v2, float t);
 
-    // ʂƂ̋vZ
+    // 平面との距離計算
     static float GetDistanceToPlane(const DirectX::XMFLOAT3& vertex, const DirectX::XMVECTOR& planeVector);
 };
 
@@ -0,0 +1,244 @@
+﻿/****************************************
+ * @file slot_map.h
+ * @brief 世代付きハンドルで参照する密な要素プール（スロットマップ）
+ * @detail 要素は std::vector に隙間なく並べ、削除は末尾との入れ替えで O(1)。
+ *         ハンドルはスロット番号と世代の組で、削除のたびに世代を進めるため
+ *         削除済み・再利用済みの要素を指すハンドルは Get が nullptr を返す。
+ *         要素の並び順は削除で入れ替わるので、順序に依存する処理には使わないこと
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ ****************************************/
+
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//--------------------------------------
+// ハンドル
+//--------------------------------------
+/**
+ * @struct SlotHandle
+ * @brief SlotMap の要素を指すハンドル（既定値は無効）
+ */
+struct SlotHandle
+{
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    uint32_t index = INVALID_INDEX;     // スロット番号
+    uint32_t generation = 0;            // 発行時の世代（スロットの世代は1から始まるので0は常に無効）
+
+    bool IsValid() const { return index != INVALID_INDEX; }
+    bool operator==(const SlotHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+};
+
+//--------------------------------------
+// クラス宣言
+//--------------------------------------
+/****************************************
+ * @class SlotMap
+ * @brief 生存中の要素だけを連続した配列で走査できるプール
+ * @tparam T 要素型（既定コンストラクタ不要、ムーブ可能であること）
+ ****************************************/
+template<typename T>
+class SlotMap
+{
+public:
+    SlotMap() = default;
+
+    /**
+     * @brief 要素・スロットの領域を事前確保（上限が決まっている用途で再確保を避ける）
+     */
+    void Reserve(size_t capacity);
+
+    /**
+     * @brief 要素を構築して追加
+     * @return 追加した要素のハンドル
+     */
+    template<typename... Args>
+    SlotHandle Emplace(Args&&... args);
+
+    SlotHandle Insert(const T& value) { return Emplace(value); }
+    SlotHandle Insert(T&& value) { return Emplace(std::move(value)); }
+
+    /**
+     * @brief ハンドルの要素を削除
+     * @return 生存中の要素を削除した場合true（古いハンドルなら何もしない）
+     */
+    bool Remove(SlotHandle handle);
+
+    /**
+     * @brief 密な配列の index 番目を削除（末尾の要素がこの位置へ移る）
+     */
+    void RemoveAt(size_t index);
+
+    /**
+     * @brief 条件を満たす要素をすべて削除
+     * @param predicate bool(T&) trueで削除。後ろから走査するため、削除で移ってきた要素は判定済み
+     * @return 削除した数
+     */
+    template<typename Predicate>
+    size_t RemoveIf(Predicate&& predicate);
+
+    /**
+     * @brief 全要素を削除（発行済みのハンドルはすべて無効になる）
+     */
+    void Clear();
+
+    // ハンドルから要素を取得（削除済み・無効なら nullptr）
+    T* Get(SlotHandle handle);
+    const T* Get(SlotHandle handle) const;
+    bool Contains(SlotHandle handle) const { return Get(handle) != nullptr; }
+
+    // 密な配列としてのアクセス（生存中の要素のみ）
+    T& operator[](size_t index) { return m_Items[index]; }
+    const T& operator[](size_t index) const { return m_Items[index]; }
+    SlotHandle GetHandle(size_t index) const;
+
+    T* begin() { return m_Items.data(); }
+    T* end() { return m_Items.data() + m_Items.size(); }
+    const T* begin() const { return m_Items.data(); }
+    const T* end() const { return m_Items.data() + m_Items.size(); }
+
+    size_t Size() const { return m_Items.size(); }
+    bool Empty() const { return m_Items.empty(); }
+
+private:
+    struct Slot
+    {
+        uint32_t denseIndex;    // 生存中は m_Items 上の位置、空きリスト中は次の空きスロット
+        uint32_t generation;    // 生存中は奇数、空きは偶数（削除・再利用のたびに1進める）
+    };
+
+    bool IsAlive(const Slot& slot) const { return (slot.generation & 1u) != 0; }
+
+    std::vector<T> m_Items;                 // 生存中の要素（隙間なし）
+    std::vector<uint32_t> m_ItemToSlot;     // m_Items[i] を指すスロット番号
+    std::vector<Slot> m_Slots;
+    uint32_t m_FreeHead = SlotHandle::INVALID_INDEX;
+};
+
+//======================================
+// テンプレート実装
+//======================================
+template<typename T>
+void SlotMap<T>::Reserve(size_t capacity)
+{
+    m_Items.reserve(capacity);
+    m_ItemToSlot.reserve(capacity);
+    m_Slots.reserve(capacity);
+}
+
+template<typename T>
+template<typename... Args>
+SlotHandle SlotMap<T>::Emplace(Args&&... args)
+{
+    uint32_t slotIndex;
+    if (m_FreeHead != SlotHandle::INVALID_INDEX)
+    {
+        slotIndex = m_FreeHead;
+        m_FreeHead = m_Slots[slotIndex].denseIndex;
+        m_Slots[slotIndex].generation++;
+    }
+    else
+    {
+        slotIndex = static_cast<uint32_t>(m_Slots.size());
+        m_Slots.push_back({ 0, 1 });
+    }
+
+    Slot& slot = m_Slots[slotIndex];
+    slot.denseIndex = static_cast<uint32_t>(m_Items.size());
+    m_Items.emplace_back(std::forward<Args>(args)...);
+    m_ItemToSlot.push_back(slotIndex);
+
+    return { slotIndex, slot.generation };
+}
+
+template<typename T>
+bool SlotMap<T>::Remove(SlotHandle handle)
+{
+    if (!Get(handle)) return false;
+
+    RemoveAt(m_Slots[handle.index].denseIndex);
+    return true;
+}
+
+template<typename T>
+void SlotMap<T>::RemoveAt(size_t index)
+{
+    assert(index < m_Items.size());
+
+    const uint32_t slotIndex = m_ItemToSlot[index];
+    const size_t last = m_Items.size() - 1;
+
+    // 末尾の要素を空いた位置へ移し、そのスロットの参照先を付け替える
+    if (index != last)
+    {
+        m_Items[index] = std::move(m_Items[last]);
+        m_ItemToSlot[index] = m_ItemToSlot[last];
+        m_Slots[m_ItemToSlot[index]].denseIndex = static_cast<uint32_t>(index);
+    }
+    m_Items.pop_back();
+    m_ItemToSlot.pop_back();
+
+    Slot& slot = m_Slots[slotIndex];
+    slot.generation++;
+    slot.denseIndex = m_FreeHead;
+    m_FreeHead = slotIndex;
+}
+
+template<typename T>
+template<typename Predicate>
+size_t SlotMap<T>::RemoveIf(Predicate&& predicate)
+{
+    size_t removed = 0;
+    for (size_t i = m_Items.size(); i-- > 0;)
+    {
+        if (predicate(m_Items[i]))
+        {
+            RemoveAt(i);
+            removed++;
+        }
+    }
+    return removed;
+}
+
+template<typename T>
+void SlotMap<T>::Clear()
+{
+    while (!m_Items.empty())
+    {
+        RemoveAt(m_Items.size() - 1);
+    }
+}
+
+template<typename T>
+T* SlotMap<T>::Get(SlotHandle handle)
+{
+    return const_cast<T*>(static_cast<const SlotMap<T>*>(this)->Get(handle));
+}
+
+template<typename T>
+const T* SlotMap<T>::Get(SlotHandle handle) const
+{
+    if (handle.index >= m_Slots.size()) return nullptr;
+
+    const Slot& slot = m_Slots[handle.index];
+    if (!IsAlive(slot) || slot.generation != handle.generation) return nullptr;
+
+    return &m_Items[slot.denseIndex];
+}
+
+template<typename T>
+SlotHandle SlotMap<T>::GetHandle(size_t index) const
+{
+    const uint32_t slotIndex = m_ItemToSlot[index];
+    return { slotIndex, m_Slots[slotIndex].generation };
+}
+
+#endif // SLOT_MAP_H
@@ -1,11 +1,11 @@
 /****************************************
  * @file sound_manager.cpp
- * @brief Q[Ŝ̃TEhǗ
+ * @brief ゲーム全体のサウンド管理
  * @author Natsume Shidara
  * @date 2026/01/13
  *
- * @note t@Cǉꍇ SOUND_FILES z
- *       pXύXĂ
+ * @note 音源ファイルを追加する場合は SOUND_FILES 配列の
+ *       パスを変更してください
  ****************************************/
 
 #include "sound_manager.h"
@@ -13,8 +13,8 @@
 #include <cmath>
 
  //======================================
- // t@CpXݒ
- // ύXΉւ\
+ // 音源ファイルパス設定
+ // ※ここを変更すれば音源を差し替え可能
  //======================================
 namespace
 {
@@ -31,7 +31,7 @@ namespace
         { "assets/sound/bgm/game.mp3",          true  },  // SOUND_BGM_GAME
         { "assets/sound/bgm/result.mp3",        true  },  // SOUND_BGM_RESULT
 
-        // SE - vC[
+        // SE - プレイヤー
         { "assets/sound/se/slash.mp3",          false },  // SOUND_SE_SLASH
         { "assets/sound/se/slash_heavy.mp3",    false },  // SOUND_SE_SLASH_HEAVY
         { "assets/sound/se/slash_hit.mp3",      false },  // SOUND_SE_SLASH_HIT
@@ -43,18 +43,18 @@ namespace
         { "assets/sound/se/step.mp3",           false },  // SOUND_SE_STEP
         { "assets/sound/se/land.mp3",           false },  // SOUND_SE_LAND
 
-        // SE - R{
+        // SE - コンボ
         { "assets/sound/se/combo_1.mp3",        false },  // SOUND_SE_COMBO_1
         { "assets/sound/se/combo_2.mp3",        false },  // SOUND_SE_COMBO_2
         { "assets/sound/se/combo_3.mp3",        false },  // SOUND_SE_COMBO_3
         { "assets/sound/se/combo_4.mp3",        false },  // SOUND_SE_COMBO_4
 
-        // SE - Gin^j
+        // SE - 敵（地上型）
         { "assets/sound/se/enemy_fire.mp3",     false },  // SOUND_SE_ENEMY_FIRE
         { "assets/sound/se/enemy_death.mp3",    false },  // SOUND_SE_ENEMY_DEATH
         { "assets/sound/se/enemy_slice.mp3",    false },  // SOUND_SE_ENEMY_SLICE
 
-        // SE - Gis^j
+        // SE - 敵（飛行型）
         { "assets/sound/se/flying_charge_ready.mp3", false },  // SOUND_SE_FLYING_CHARGE_READY
         { "assets/sound/se/flying_charge.mp3",       false },  // SOUND_SE_FLYING_CHARGE
         { "assets/sound/se/flying_whoosh.mp3",       false },  // SOUND_SE_FLYING_WHOOSH
@@ -65,17 +65,17 @@ namespace
         { "assets/sound/se/cancel.mp3",         false },  // SOUND_SE_CANCEL
         { "assets/sound/se/pause.mp3",          false },  // SOUND_SE_PAUSE
 
-        // SE - ^Cg
+        // SE - タイトル
         { "assets/sound/se/title_slash.mp3",    false },  // SOUND_SE_TITLE_SLASH
 
-        // SE - Ug
+        // SE - リザルト
         { "assets/sound/se/score_count.mp3",    false },  // SOUND_SE_SCORE_COUNT
         { "assets/sound/se/score_finish.mp3",   false },  // SOUND_SE_SCORE_FINISH
     };
 }
 
 //======================================
-// ϐ
+// 内部変数
 //======================================
 static int g_AudioHandles[SOUND_MAX];
 static SoundID g_CurrentBGM = SOUND_MAX;
@@ -83,7 +83,7 @@ static float g_BGMVolume = 1.0f;
 static float g_SEVolume = 1.0f;
 
 //======================================
-// 
+// 初期化
 //======================================
 void SoundManager_Initialize()
 {
@@ -107,7 +107,7 @@ void SoundManager_Initialize()
 }
 
 //======================================
-// I
+// 終了処理
 //======================================
 void SoundManager_Finalize()
 {
@@ -124,7 +124,7 @@ void SoundManager_Finalize()
 }
 
 //======================================
-// BGMĐ
+// BGM再生
 //======================================
 void SoundManager_PlayBGM(SoundID id)
 {
@@ -135,14 +135,14 @@ void SoundManager_PlayBGM(SoundID id)
 
     SoundManager_StopBGM();
 
-    // {[ݒ肵ĂĐ
+    // ボリュームを設定してから再生
     SetAudioVolume(g_AudioHandles[id], g_BGMVolume);
     PlayAudio(g_AudioHandles[id], true);
     g_CurrentBGM = id;
 }
 
 //======================================
-// BGM~
+// BGM停止
 //======================================
 void SoundManager_StopBGM()
 {
@@ -154,13 +154,13 @@ void SoundManager_StopBGM()
 }
 
 //======================================
-// BGMʐݒ
+// BGM音量設定
 //======================================
 void SoundManager_SetBGMVolume(float volume)
 {
     g_BGMVolume = fmaxf(0.0f, fminf(1.0f, volume));
 
-    // ݍĐBGMɑɓKp
+    // 現在再生中のBGMに即座に適用
     if (g_CurrentBGM != SOUND_MAX && g_AudioHandles[g_CurrentBGM] >= 0)
     {
         SetAudioVolume(g_AudioHandles[g_CurrentBGM], g_BGMVolume);
@@ -168,20 +168,20 @@ void SoundManager_SetBGMVolume(float volume)
 }
 
 //======================================
-// SEĐ
+// SE再生
 //======================================
 void SoundManager_PlaySE(SoundID id)
 {
     if (id < 0 || id >= SOUND_MAX) return;
     if (g_AudioHandles[id] < 0) return;
 
-    // {[ݒ肵ĂĐ
+    // ボリュームを設定してから再生
     SetAudioVolume(g_AudioHandles[id], g_SEVolume);
     PlayAudio(g_AudioHandles[id], false);
 }
 
 //======================================
-// SEʐݒ
+// SE音量設定
 //======================================
 void SoundManager_SetSEVolume(float volume)
 {
@@ -189,7 +189,7 @@ void SoundManager_SetSEVolume(float volume)
 }
 
 //======================================
-// R{ɉSEĐ
+// コンボ数に応じたSE再生
 //======================================
 void SoundManager_PlayComboSE(int comboCount)
 {
@@ -216,13 +216,13 @@ void SoundManager_PlayComboSE(int comboCount)
 }
 
 //======================================
-// S~
+// 全停止
 //======================================
 void SoundManager_StopAll()
 {
-    // SI[fBI~
+    // 全オーディオを停止
     StopAllAudio();
 
-    // BGMԂZbg
+    // BGM状態をリセット
     g_CurrentBGM = SOUND_MAX;
 }
\ No newline at end of file
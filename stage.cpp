@@ -1,12 +1,19 @@
 /****************************************
  * @file stage.cpp
- * @brief Xe[WǗ̎iMeshFieldŁj
+ * @brief ステージ管理の実装（MeshField統合版）
  * @author Natsume Shidara
  * @date 2026/01/13
+ * @update 2026/10/18 - 地形コライダーとの接触取得を追加
+ * @update 2026/10/18 - 地形法線の取得を追加
+ * @update 2026/10/18 - 壁をマップの当たり判定へ登録
+ * @update 2026/10/18 - 壁の当たり判定を三角形メッシュで行う
  ****************************************/
 
 #include "stage.h"
+#include "map.h"
+#include "mesh_collider.h"
 #include "meshfield.h"
+#include "heightfield.h"
 #include "direct3d.h"
 #include "texture.h"
 #include "model.h"
@@ -15,42 +22,44 @@
 #include <cstdlib>
 #include <cmath>
 #include <algorithm>
+#include <vector>
 
 using namespace DirectX;
 
 //======================================
-// 萔
+// 定数
 //======================================
 namespace
 {
-    // fpX
+    // モデルパス
     constexpr const char* BOX_MODEL_PATH = "assets/fbx/BOX.fbx";
 
-    // eNX`pX
+    // テクスチャパス
     constexpr const wchar_t* WALL_TEXTURE_PATH = L"assets/wall.png";
 
-    // ǂ̐
-    constexpr int WALL_COUNT = 4;
+    // 壁の数
+    constexpr int WALL_COUNT = static_cast<int>(std::size(StageConfig::WALL_LAYOUTS));
 }
 
 //======================================
-// Ǎ\
+// 壁構造体
 //======================================
 struct Wall
 {
     MODEL* pModel = nullptr;
     XMFLOAT3 position = { 0, 0, 0 };
     XMFLOAT3 scale = { 1, 1, 1 };
+    MeshCollider collider;      // 描画と同じワールド行列で焼き込んだ当たり判定（マップから参照される）
 };
 
 //======================================
-// ϐ
+// 内部変数
 //======================================
 static Wall g_Walls[WALL_COUNT];
 static int g_WallTexId = -1;
 
 //======================================
-// ֐
+// 内部関数
 //======================================
 static float RandomFloat(float min, float max)
 {
@@ -58,76 +67,82 @@ static float RandomFloat(float min, float max)
     return min + r * (max - min);
 }
 
-static void DrawWall(const Wall& wall)
+static XMMATRIX GetWallWorldMatrix(const Wall& wall)
 {
-    if (!wall.pModel) return;
-
     XMMATRIX mtxScale = XMMatrixScaling(wall.scale.x, wall.scale.y, wall.scale.z);
     XMMATRIX mtxTrans = XMMatrixTranslation(wall.position.x, wall.position.y, wall.position.z);
-    XMMATRIX mtxWorld = mtxScale * mtxTrans;
+    return mtxScale * mtxTrans;
+}
+
+static void DrawWall(const Wall& wall)
+{
+    if (!wall.pModel) return;
 
-    ModelDraw(wall.pModel, mtxWorld);
+    ModelDraw(wall.pModel, GetWallWorldMatrix(wall));
 }
 
 static void DrawWallShadow(const Wall& wall)
 {
     if (!wall.pModel) return;
 
-    XMMATRIX mtxScale = XMMatrixScaling(wall.scale.x, wall.scale.y, wall.scale.z);
-    XMMATRIX mtxTrans = XMMatrixTranslation(wall.position.x, wall.position.y, wall.position.z);
-    XMMATRIX mtxWorld = mtxScale * mtxTrans;
-
-    ModelDrawShadow(wall.pModel, mtxWorld);
+    ModelDrawShadow(wall.pModel, GetWallWorldMatrix(wall));
 }
 
 //======================================
-// 
+// 初期化
 //======================================
 void Stage_Initialize()
 {
     using namespace StageConfig;
 
-    // MeshField
+    // MeshField初期化
     MeshField_Initialize(Direct3D_GetDevice(), Direct3D_GetContext());
 
-    // eNX`ǂݍ
+    // テクスチャ読み込み
     g_WallTexId = Texture_Load(WALL_TEXTURE_PATH);
 
-    // ǃfikEEEj
-    float wallBaseY = WALL_HEIGHT * 0.5f;
-
-    // kǁi+Zj
-    g_Walls[0].pModel = ModelLoad(BOX_MODEL_PATH, 1.0f, false, WALL_TEXTURE_PATH);
-    g_Walls[0].position = { 0.0f, wallBaseY, STAGE_DEPTH * 0.5f };
-    g_Walls[0].scale = { STAGE_WIDTH + WALL_THICKNESS * 2, WALL_HEIGHT, WALL_THICKNESS };
-
-    // ǁi-Zj
-    g_Walls[1].pModel = ModelLoad(BOX_MODEL_PATH, 1.0f, false, WALL_TEXTURE_PATH);
-    g_Walls[1].position = { 0.0f, wallBaseY, -STAGE_DEPTH * 0.5f };
-    g_Walls[1].scale = { STAGE_WIDTH + WALL_THICKNESS * 2, WALL_HEIGHT, WALL_THICKNESS };
-
-    // ǁi+Xj
-    g_Walls[2].pModel = ModelLoad(BOX_MODEL_PATH, 1.0f, false, WALL_TEXTURE_PATH);
-    g_Walls[2].position = { STAGE_WIDTH * 0.5f, wallBaseY, 0.0f };
-    g_Walls[2].scale = { WALL_THICKNESS, WALL_HEIGHT, STAGE_DEPTH };
-
-    // ǁi-Xj
-    g_Walls[3].pModel = ModelLoad(BOX_MODEL_PATH, 1.0f, false, WALL_TEXTURE_PATH);
-    g_Walls[3].position = { -STAGE_WIDTH * 0.5f, wallBaseY, 0.0f };
-    g_Walls[3].scale = { WALL_THICKNESS, WALL_HEIGHT, STAGE_DEPTH };
+    // 壁モデル生成（北・南・東・西）と、マップの当たり判定への登録
+    std::vector<MapObject> wallObjects;
+    for (int i = 0; i < WALL_COUNT; i++)
+    {
+        const WallLayout& layout = WALL_LAYOUTS[i];
+        g_Walls[i].pModel = ModelLoad(BOX_MODEL_PATH, 1.0f, false, WALL_TEXTURE_PATH);
+        g_Walls[i].position = layout.center;
+        g_Walls[i].scale = layout.size;
+
+        MapObject object{ MAP_KIND_STAGE_WALL, layout.center };
+        object.Aabb.min = { layout.center.x - layout.size.x * 0.5f, layout.center.y - layout.size.y * 0.5f, layout.center.z - layout.size.z * 0.5f };
+        object.Aabb.max = { layout.center.x + layout.size.x * 0.5f, layout.center.y + layout.size.y * 0.5f, layout.center.z + layout.size.z * 0.5f };
+
+        // モデルの三角形で判定する（読み込みに失敗した場合は AABB のまま）
+        XMFLOAT4X4 world;
+        XMStoreFloat4x4(&world, GetWallWorldMatrix(g_Walls[i]));
+        g_Walls[i].collider.BuildFromModel(g_Walls[i].pModel, world);
+        if (g_Walls[i].collider.IsBuilt())
+        {
+            object.Aabb = g_Walls[i].collider.GetBounds();
+            object.Mesh = &g_Walls[i].collider;
+        }
+        wallObjects.push_back(object);
+    }
+    Map_AddObjects(wallObjects);
 }
 
 //======================================
-// I
+// 終了処理
 //======================================
 void Stage_Finalize()
 {
-    // MeshFieldI
+    // MeshField終了
     MeshField_Finalize();
 
-    // ǃf
+    // 壁の当たり判定をマップから除去
+    Map_RemoveObjectsByKind(MAP_KIND_STAGE_WALL);
+
+    // 壁モデル解放
     for (int i = 0; i < WALL_COUNT; i++)
     {
+        g_Walls[i].collider.Clear();
         if (g_Walls[i].pModel)
         {
             ModelRelease(g_Walls[i].pModel);
@@ -137,7 +152,7 @@ void Stage_Finalize()
 }
 
 //======================================
-// XV
+// 更新
 //======================================
 void Stage_Update(float dt)
 {
@@ -145,15 +160,15 @@ void Stage_Update(float dt)
 }
 
 //======================================
-// `
+// 描画
 //======================================
 void Stage_Draw()
 {
-    // n`iMeshFieldj`
+    // 地形（MeshField）描画
     XMMATRIX mtxWorld = XMMatrixIdentity();
     MeshField_Draw(mtxWorld);
 
-    // Ǖ`
+    // 壁描画
     for (int i = 0; i < WALL_COUNT; i++)
     {
         DrawWall(g_Walls[i]);
@@ -161,15 +176,15 @@ void Stage_Draw()
 }
 
 //======================================
-// VhE`
+// シャドウ描画
 //======================================
 void Stage_DrawShadow()
 {
-    // n`VhE
+    // 地形シャドウ
     XMMATRIX mtxWorld = XMMatrixIdentity();
     //MeshField_DrawShadow(mtxWorld);
 
-    // ǃVhE
+    // 壁シャドウ
     for (int i = 0; i < WALL_COUNT; i++)
     {
         DrawWallShadow(g_Walls[i]);
@@ -177,16 +192,16 @@ void Stage_DrawShadow()
 }
 
 //======================================
-// fobO`
+// デバッグ描画
 //======================================
 void Stage_DrawDebug()
 {
     using namespace StageConfig;
 
-    // vCGA̋E\
+    // プレイエリアの境界を表示
     XMFLOAT4 color = { 0.0f, 1.0f, 0.0f, 1.0f };
 
-    // ̎lin`ɍ킹j
+    // 床の四隅（高さを地形に合わせる）
     float h00 = MeshField_GetHeight(PLAY_AREA_MIN_X, PLAY_AREA_MIN_Z) + 0.2f;
     float h10 = MeshField_GetHeight(PLAY_AREA_MAX_X, PLAY_AREA_MIN_Z) + 0.2f;
     float h11 = MeshField_GetHeight(PLAY_AREA_MAX_X, PLAY_AREA_MAX_Z) + 0.2f;
@@ -205,7 +220,7 @@ void Stage_DrawDebug()
         DebugRenderer::DrawLine(corners[i], corners[next], color);
     }
 
-    // X|[֎~GA\
+    // スポーン禁止エリア表示
     XMFLOAT4 safeColor = { 1.0f, 0.5f, 0.0f, 1.0f };
     constexpr int segments = 16;
     for (int i = 0; i < segments; i++)
@@ -221,7 +236,7 @@ void Stage_DrawDebug()
 }
 
 //======================================
-// n^GX|[ʒu擾
+// 地上型敵スポーン位置取得
 //======================================
 XMFLOAT3 Stage_GetGroundSpawnPosition(const XMFLOAT3& playerPos)
 {
@@ -232,15 +247,15 @@ XMFLOAT3 Stage_GetGroundSpawnPosition(const XMFLOAT3& playerPos)
 
     for (int i = 0; i < maxAttempts; i++)
     {
-        // _ʒu𐶐
+        // ランダム位置を生成
         spawnPos.x = RandomFloat(PLAY_AREA_MIN_X + SPAWN_MARGIN, PLAY_AREA_MAX_X - SPAWN_MARGIN);
         spawnPos.z = RandomFloat(PLAY_AREA_MIN_Z + SPAWN_MARGIN, PLAY_AREA_MAX_Z - SPAWN_MARGIN);
 
-        // n`̍擾
+        // 地形の高さを取得
         float terrainHeight = MeshField_GetHeight(spawnPos.x, spawnPos.z);
         spawnPos.y = terrainHeight + SPAWN_HEIGHT_GROUND;
 
-        // vC[̋`FbN
+        // プレイヤーからの距離をチェック
         float dx = spawnPos.x - playerPos.x;
         float dz = spawnPos.z - playerPos.z;
         float distSq = dx * dx + dz * dz;
@@ -251,12 +266,12 @@ XMFLOAT3 Stage_GetGroundSpawnPosition(const XMFLOAT3& playerPos)
         }
     }
 
-    // ő厎s񐔂𒴂AvC[痣ꂽʒuIɑI
+    // 最大試行回数を超えたら、プレイヤーから離れた位置を強制的に選択
     float angle = RandomFloat(0.0f, 6.28318f);
     spawnPos.x = playerPos.x + cosf(angle) * (PLAYER_SAFE_RADIUS + 5.0f);
     spawnPos.z = playerPos.z + sinf(angle) * (PLAYER_SAFE_RADIUS + 5.0f);
 
-    // vCGAɃNv
+    // プレイエリア内にクランプ
     spawnPos = Stage_ClampToPlayArea(spawnPos);
     spawnPos.y = MeshField_GetHeight(spawnPos.x, spawnPos.z) + SPAWN_HEIGHT_GROUND;
 
@@ -264,7 +279,7 @@ XMFLOAT3 Stage_GetGroundSpawnPosition(const XMFLOAT3& playerPos)
 }
 
 //======================================
-// s^GX|[ʒu擾
+// 飛行型敵スポーン位置取得
 //======================================
 XMFLOAT3 Stage_GetFlyingSpawnPosition(const XMFLOAT3& playerPos)
 {
@@ -275,12 +290,12 @@ XMFLOAT3 Stage_GetFlyingSpawnPosition(const XMFLOAT3& playerPos)
 
     for (int i = 0; i < maxAttempts; i++)
     {
-        // _ʒu𐶐iʒuj
+        // ランダム位置を生成（高い位置）
         spawnPos.x = RandomFloat(PLAY_AREA_MIN_X + SPAWN_MARGIN, PLAY_AREA_MAX_X - SPAWN_MARGIN);
         spawnPos.y = RandomFloat(SPAWN_HEIGHT_FLYING, SPAWN_HEIGHT_FLYING + 5.0f);
         spawnPos.z = RandomFloat(PLAY_AREA_MIN_Z + SPAWN_MARGIN, PLAY_AREA_MAX_Z - SPAWN_MARGIN);
 
-        // vC[̐`FbN
+        // プレイヤーからの水平距離をチェック
         float dx = spawnPos.x - playerPos.x;
         float dz = spawnPos.z - playerPos.z;
         float distSq = dx * dx + dz * dz;
@@ -291,20 +306,20 @@ XMFLOAT3 Stage_GetFlyingSpawnPosition(const XMFLOAT3& playerPos)
         }
     }
 
-    // ő厎s񐔂𒴂狭zu
+    // 最大試行回数を超えたら強制配置
     float angle = RandomFloat(0.0f, 6.28318f);
     spawnPos.x = playerPos.x + cosf(angle) * (PLAYER_SAFE_RADIUS + 5.0f);
     spawnPos.y = SPAWN_HEIGHT_FLYING;
     spawnPos.z = playerPos.z + sinf(angle) * (PLAYER_SAFE_RADIUS + 5.0f);
 
     spawnPos = Stage_ClampToPlayArea(spawnPos);
-    spawnPos.y = SPAWN_HEIGHT_FLYING;  // x͈ێ
+    spawnPos.y = SPAWN_HEIGHT_FLYING;  // 高度は維持
 
     return spawnPos;
 }
 
 //======================================
-// vCGA
+// プレイエリア内判定
 //======================================
 bool Stage_IsInsidePlayArea(const XMFLOAT3& pos)
 {
@@ -315,7 +330,7 @@ bool Stage_IsInsidePlayArea(const XMFLOAT3& pos)
 }
 
 //======================================
-// vCGAɃNv
+// プレイエリア内にクランプ
 //======================================
 XMFLOAT3 Stage_ClampToPlayArea(const XMFLOAT3& pos)
 {
@@ -329,9 +344,25 @@ XMFLOAT3 Stage_ClampToPlayArea(const XMFLOAT3& pos)
 }
 
 //======================================
-// n`擾
+// 地形高さ取得
 //======================================
 float Stage_GetTerrainHeight(float x, float z)
 {
     return MeshField_GetHeight(x, z);
+}
+
+//======================================
+// 地形との接触取得
+//======================================
+int Stage_CollideTerrain(const Collider& collider, Hit* outHits, int maxHits)
+{
+    return MeshField_GetHeightField().Collide(collider, outHits, maxHits);
+}
+
+//======================================
+// 地形法線取得
+//======================================
+XMFLOAT3 Stage_GetTerrainNormal(float x, float z)
+{
+    return MeshField_GetNormal(x, z);
 }
\ No newline at end of file
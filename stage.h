@@ -1,101 +1,132 @@
 /****************************************
  * @file stage.h
- * @brief Xe[WǗin`EǁEX|[|Cgj
+ * @brief ステージ管理（地形・壁・スポーンポイント）
  * @author Natsume Shidara
  * @date 2026/01/13
- * @update 2026/01/13 - MeshField
+ * @update 2026/01/13 - MeshField統合
+ * @update 2026/10/18 - 地形コライダーとの接触取得を追加
+ * @update 2026/10/18 - 地形法線の取得を追加
+ * @update 2026/10/18 - 壁の配置表と、壁をマップの当たり判定へ登録
  ****************************************/
 
 #ifndef STAGE_H
 #define STAGE_H
 
 #include <DirectXMath.h>
+#include "collision.h"
+
+struct Collider;
 
  //======================================
- // Xe[Wݒ萔
+ // ステージ設定定数
  //======================================
 namespace StageConfig
 {
-    // Xe[WTCYiMeshFieldɍ킹j
-    constexpr float STAGE_WIDTH = 150.0f;       // X̕
-    constexpr float STAGE_DEPTH = 150.0f;       // Z̉s
-    constexpr float WALL_HEIGHT = 12.0f;       // ǂ̍
-    constexpr float WALL_THICKNESS = 1.5f;     // ǂ̌
-
-    // vCGAiǂ̓j
+    // ステージサイズ（MeshFieldに合わせる）
+    constexpr float STAGE_WIDTH = 150.0f;       // X方向の幅
+    constexpr float STAGE_DEPTH = 150.0f;       // Z方向の奥行き
+    constexpr float WALL_HEIGHT = 12.0f;       // 壁の高さ
+    constexpr float WALL_THICKNESS = 1.5f;     // 壁の厚さ
+
+    // 壁の配置（中心と大きさ。BOXモデルの拡大率と、マップに登録する当たり判定の両方に使う）
+    struct WallLayout
+    {
+        DirectX::XMFLOAT3 center;
+        DirectX::XMFLOAT3 size;
+    };
+    constexpr WallLayout WALL_LAYOUTS[] = {
+        { { 0.0f, WALL_HEIGHT * 0.5f,  STAGE_DEPTH * 0.5f }, { STAGE_WIDTH + WALL_THICKNESS * 2, WALL_HEIGHT, WALL_THICKNESS } },   // 北壁（+Z方向）
+        { { 0.0f, WALL_HEIGHT * 0.5f, -STAGE_DEPTH * 0.5f }, { STAGE_WIDTH + WALL_THICKNESS * 2, WALL_HEIGHT, WALL_THICKNESS } },   // 南壁（-Z方向）
+        { {  STAGE_WIDTH * 0.5f, WALL_HEIGHT * 0.5f, 0.0f }, { WALL_THICKNESS, WALL_HEIGHT, STAGE_DEPTH } },                       // 東壁（+X方向）
+        { { -STAGE_WIDTH * 0.5f, WALL_HEIGHT * 0.5f, 0.0f }, { WALL_THICKNESS, WALL_HEIGHT, STAGE_DEPTH } },                       // 西壁（-X方向）
+    };
+
+    // プレイエリア（壁の内側）
     constexpr float PLAY_AREA_MIN_X = -STAGE_WIDTH * 0.5f + WALL_THICKNESS + 1.0f;
     constexpr float PLAY_AREA_MAX_X = STAGE_WIDTH * 0.5f - WALL_THICKNESS - 1.0f;
     constexpr float PLAY_AREA_MIN_Z = -STAGE_DEPTH * 0.5f + WALL_THICKNESS + 1.0f;
     constexpr float PLAY_AREA_MAX_Z = STAGE_DEPTH * 0.5f - WALL_THICKNESS - 1.0f;
 
-    // X|[ݒ
-    constexpr float SPAWN_HEIGHT_GROUND = 2.0f;   // n^G̃X|[xin`j
-    constexpr float SPAWN_HEIGHT_FLYING = 10.0f;  // s^G̃X|[x
-    constexpr float SPAWN_MARGIN = 5.0f;          // ǂ̃}[W
-    constexpr float PLAYER_SAFE_RADIUS = 10.0f;   // vC[ӂ̃X|[֎~a
+    // スポーン設定
+    constexpr float SPAWN_HEIGHT_GROUND = 2.0f;   // 地上型敵のスポーン高度（地形より上）
+    constexpr float SPAWN_HEIGHT_FLYING = 10.0f;  // 飛行型敵のスポーン高度
+    constexpr float SPAWN_MARGIN = 5.0f;          // 壁からのマージン
+    constexpr float PLAYER_SAFE_RADIUS = 10.0f;   // プレイヤー周辺のスポーン禁止半径
 }
 
 //======================================
-// J֐
+// 公開関数
 //======================================
 
 /**
- * @brief Xe[W
+ * @brief ステージ初期化
  */
 void Stage_Initialize();
 
 /**
- * @brief Xe[WI
+ * @brief ステージ終了処理
  */
 void Stage_Finalize();
 
 /**
- * @brief Xe[WXV
+ * @brief ステージ更新
  */
 void Stage_Update(float dt);
 
 /**
- * @brief Xe[W`
+ * @brief ステージ描画
  */
 void Stage_Draw();
 
 /**
- * @brief Xe[WVhE`
+ * @brief ステージシャドウ描画
  */
 void Stage_DrawShadow();
 
 /**
- * @brief Xe[WfobO`
+ * @brief ステージデバッグ描画
  */
 void Stage_DrawDebug();
 
 /**
- * @brief n^G̃X|[ʒu擾i_j
- * @param playerPos vC[݈̌ʒui߂ɂ̓X|[Ȃj
- * @return X|[ʒu
+ * @brief 地上型敵のスポーン位置を取得（ランダム）
+ * @param playerPos プレイヤーの現在位置（近くにはスポーンしない）
+ * @return スポーン位置
  */
 DirectX::XMFLOAT3 Stage_GetGroundSpawnPosition(const DirectX::XMFLOAT3& playerPos);
 
 /**
- * @brief s^G̃X|[ʒu擾i_j
- * @param playerPos vC[݈̌ʒu
- * @return X|[ʒu
+ * @brief 飛行型敵のスポーン位置を取得（ランダム）
+ * @param playerPos プレイヤーの現在位置
+ * @return スポーン位置
  */
 DirectX::XMFLOAT3 Stage_GetFlyingSpawnPosition(const DirectX::XMFLOAT3& playerPos);
 
 /**
- * @brief ʒuvCGA`FbN
+ * @brief 位置がプレイエリア内かチェック
  */
 bool Stage_IsInsidePlayArea(const DirectX::XMFLOAT3& pos);
 
 /**
- * @brief ʒuvCGAɃNv
+ * @brief 位置をプレイエリア内にクランプ
  */
 DirectX::XMFLOAT3 Stage_ClampToPlayArea(const DirectX::XMFLOAT3& pos);
 
 /**
- * @brief wW̒n`擾
+ * @brief 指定座標の地形高さを取得
  */
 float Stage_GetTerrainHeight(float x, float z);
 
+/**
+ * @brief コライダーと地形の接触を三角形単位で取得
+ * @param[out] outHits 接触（法線は地形→コライダー）
+ * @return 接触数
+ */
+int Stage_CollideTerrain(const Collider& collider, Hit* outHits, int maxHits);
+
+/**
+ * @brief 指定座標の地形法線を取得（指定座標を含む三角形の法線）
+ */
+DirectX::XMFLOAT3 Stage_GetTerrainNormal(float x, float z);
+
 #endif // STAGE_H
\ No newline at end of file
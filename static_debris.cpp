@@ -0,0 +1,283 @@
+﻿/****************************************
+ * @file static_debris.cpp
+ * @brief 静止した破片の静的メッシュへの焼き込みの実装
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 当たり判定をAABBから破片の三角形メッシュへ変更
+ ****************************************/
+
+#include "static_debris.h"
+#include "physics_model.h"
+#include "model.h"
+#include "map.h"
+#include "mesh_collider.h"
+#include <d3d11.h>
+#include <DirectXMath.h>
+#include <deque>
+#include <vector>
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+
+using namespace DirectX;
+
+//======================================
+// 内部データ
+//======================================
+namespace
+{
+    /**
+     * @struct DebrisChunk
+     * @brief 空間セル1つ分の結合メッシュ（頂点はワールド座標）
+     * @detail meshes[i] は materials[i] のテクスチャで描く。
+     *         CPU側の結合データは追記中のみ保持し、GPUバッファ作成後はモデル側の1組だけを残す
+     */
+    struct DebrisChunk
+    {
+        int cellX = 0;
+        int cellY = 0;
+        int cellZ = 0;
+        std::vector<ID3D11ShaderResourceView*> materials;   // 参照を保持（AddRef済み）
+        std::vector<MeshData> meshes;                       // 追記中の結合データ
+        MODEL* model = nullptr;
+        int triangleCount = 0;
+        bool isDirty = false;
+    };
+
+    std::vector<DebrisChunk> g_Chunks;
+    std::deque<MeshCollider> g_Colliders;           // 焼き込んだ破片の当たり判定（マップから参照されるため要素を動かさない）
+    std::vector<MapObject> g_PendingMapObjects;     // 次の StaticDebris_Update でマップへ追加
+    int g_BakedPieceCount = 0;
+    int g_TotalTriangles = 0;
+
+    int ToCell(float value)
+    {
+        return static_cast<int>(std::floor(value / StaticDebrisConfig::CELL_SIZE));
+    }
+
+    /**
+     * @brief 同じセルで三角形数に余裕のあるチャンクを探し、なければ作る
+     */
+    DebrisChunk& FindChunk(int cellX, int cellY, int cellZ, int triangles)
+    {
+        for (DebrisChunk& chunk : g_Chunks)
+        {
+            if (chunk.cellX == cellX && chunk.cellY == cellY && chunk.cellZ == cellZ &&
+                chunk.triangleCount + triangles <= StaticDebrisConfig::MAX_CHUNK_TRIANGLES)
+            {
+                return chunk;
+            }
+        }
+
+        DebrisChunk& chunk = g_Chunks.emplace_back();
+        chunk.cellX = cellX;
+        chunk.cellY = cellY;
+        chunk.cellZ = cellZ;
+        return chunk;
+    }
+
+    /**
+     * @brief テクスチャに対応する結合メッシュの添字（初出なら追加）
+     */
+    int FindOrAddMaterial(DebrisChunk& chunk, ID3D11ShaderResourceView* srv)
+    {
+        for (int i = 0; i < static_cast<int>(chunk.materials.size()); ++i)
+        {
+            if (chunk.materials[i] == srv) return i;
+        }
+
+        if (srv) srv->AddRef();
+        chunk.materials.push_back(srv);
+
+        MeshData& mesh = chunk.meshes.emplace_back();
+        mesh.materialIndex = static_cast<unsigned int>(chunk.materials.size() - 1);
+        return static_cast<int>(chunk.materials.size() - 1);
+    }
+
+    void RebuildChunkModel(DebrisChunk& chunk)
+    {
+        ModelRelease(chunk.model);
+
+        // ModelCreateFromData は元モデルのマテリアルを引き継ぐため、チャンクのテクスチャ一覧だけを持つ雛形を渡す
+        MODEL prototype;
+        prototype.materials = chunk.materials;
+        chunk.model = ModelCreateFromData(chunk.meshes, &prototype);
+
+        chunk.meshes.clear();
+        chunk.meshes.shrink_to_fit();
+        chunk.isDirty = false;
+    }
+
+    void ReleaseChunk(DebrisChunk& chunk)
+    {
+        ModelRelease(chunk.model);
+        chunk.model = nullptr;
+
+        for (ID3D11ShaderResourceView* srv : chunk.materials)
+        {
+            if (srv) srv->Release();
+        }
+        chunk.materials.clear();
+        chunk.meshes.clear();
+    }
+}
+
+//======================================
+// 初期化・終了
+//======================================
+void StaticDebris_Initialize()
+{
+    g_Chunks.clear();
+    g_Colliders.clear();
+    g_PendingMapObjects.clear();
+    g_BakedPieceCount = 0;
+    g_TotalTriangles = 0;
+}
+
+void StaticDebris_Finalize()
+{
+    // マップが当たり判定を参照しなくなってから解放する
+    Map_RemoveObjectsByKind(MAP_KIND_STATIC_DEBRIS);
+
+    for (DebrisChunk& chunk : g_Chunks)
+    {
+        ReleaseChunk(chunk);
+    }
+    g_Chunks.clear();
+    g_Colliders.clear();
+    g_PendingMapObjects.clear();
+    g_BakedPieceCount = 0;
+    g_TotalTriangles = 0;
+}
+
+//======================================
+// 焼き込み
+//======================================
+bool StaticDebris_Bake(const PhysicsModel& piece)
+{
+    using namespace StaticDebrisConfig;
+
+    const MODEL* model = piece.GetModel();
+    if (!model) return false;
+
+    int triangles = 0;
+    for (const MeshData& mesh : model->Meshes)
+    {
+        triangles += static_cast<int>(mesh.indices.size() / 3);
+    }
+    if (triangles == 0 || triangles > MAX_CHUNK_TRIANGLES) return false;
+    if (g_TotalTriangles + triangles > MAX_TOTAL_TRIANGLES) return false;
+
+    const RigidBody* rb = piece.GetRigidBody();
+    const XMFLOAT3 position = rb->GetPosition();
+    DebrisChunk& chunk = FindChunk(ToCell(position.x), ToCell(position.y), ToCell(position.z), triangles);
+
+    // GPUバッファ作成済みのチャンクへ追記する場合は、モデル側のデータを作業用に戻す
+    if (!chunk.isDirty && chunk.model)
+    {
+        chunk.meshes = chunk.model->Meshes;
+    }
+
+    // 眠っている破片は補間前後の姿勢が一致するため、現在の姿勢で描画と同じ位置になる
+    const XMFLOAT4X4 matWorld = rb->GetWorldMatrix(piece.GetScale());
+    const XMMATRIX world = XMLoadFloat4x4(&matWorld);
+
+    for (const MeshData& mesh : model->Meshes)
+    {
+        if (mesh.vertices.empty()) continue;
+
+        ID3D11ShaderResourceView* srv = (mesh.materialIndex < model->materials.size()) ? model->materials[mesh.materialIndex] : nullptr;
+        MeshData& merged = chunk.meshes[FindOrAddMaterial(chunk, srv)];
+
+        const unsigned int baseVertex = static_cast<unsigned int>(merged.vertices.size());
+        merged.vertices.reserve(merged.vertices.size() + mesh.vertices.size());
+        merged.indices.reserve(merged.indices.size() + mesh.indices.size());
+
+        for (Vertex vertex : mesh.vertices)
+        {
+            XMStoreFloat3(&vertex.position, XMVector3TransformCoord(XMLoadFloat3(&vertex.position), world));
+            XMStoreFloat3(&vertex.normal, XMVector3Normalize(XMVector3TransformNormal(XMLoadFloat3(&vertex.normal), world)));
+            merged.vertices.push_back(vertex);
+        }
+        for (unsigned int index : mesh.indices)
+        {
+            merged.indices.push_back(baseVertex + index);
+        }
+    }
+
+    chunk.triangleCount += triangles;
+    chunk.isDirty = true;
+    g_TotalTriangles += triangles;
+    ++g_BakedPieceCount;
+
+    // 当たり判定は描画と同じ姿勢の三角形（凸な破片なら凸包そのもの）。Debrisレイヤー：破片の物理からのみ見える
+    MeshCollider& collider = g_Colliders.emplace_back();
+    collider.BuildFromModel(model, matWorld);
+
+    MapObject object;
+    object.KindId = MAP_KIND_STATIC_DEBRIS;
+    object.Posision = position;
+    object.Aabb = collider.IsBuilt() ? collider.GetBounds() : rb->GetTransformedAABB();
+    object.Layer = CollisionLayer::Debris;
+    object.Mesh = collider.IsBuilt() ? &collider : nullptr;
+    g_PendingMapObjects.push_back(object);
+
+    return true;
+}
+
+//======================================
+// 更新
+//======================================
+void StaticDebris_Update()
+{
+    for (DebrisChunk& chunk : g_Chunks)
+    {
+        if (chunk.isDirty)
+        {
+            RebuildChunkModel(chunk);
+        }
+    }
+
+    if (!g_PendingMapObjects.empty())
+    {
+        Map_AddObjects(g_PendingMapObjects);
+        g_PendingMapObjects.clear();
+    }
+}
+
+//======================================
+// 描画（頂点はワールド座標なので単位行列）
+//======================================
+void StaticDebris_Draw()
+{
+    for (DebrisChunk& chunk : g_Chunks)
+    {
+        ModelDraw(chunk.model, XMMatrixIdentity());
+    }
+}
+
+void StaticDebris_DrawShadow()
+{
+    for (DebrisChunk& chunk : g_Chunks)
+    {
+        ModelDrawShadow(chunk.model, XMMatrixIdentity());
+    }
+}
+
+//======================================
+// 集計
+//======================================
+int StaticDebris_GetChunkCount()
+{
+    return static_cast<int>(g_Chunks.size());
+}
+
+int StaticDebris_GetBakedPieceCount()
+{
+    return g_BakedPieceCount;
+}
+
+int StaticDebris_GetTriangleCount()
+{
+    return g_TotalTriangles;
+}
@@ -0,0 +1,59 @@
+﻿/****************************************
+ * @file static_debris.h
+ * @brief 静止した破片の静的メッシュへの焼き込み
+ * @detail 一定時間眠り続けた破片をワールド座標へ変換し、空間セルごと・テクスチャごとに
+ *         1組の頂点／インデックスへ結合する。当たり判定は破片の三角形をワールド座標のメッシュとして
+ *         マップの空間インデックスへ登録し、元の剛体とモデルは解放する
+ * @author Natsume Shidara
+ * @date 2026/10/18
+ * @update 2026/10/18 - 当たり判定をAABBから破片の三角形メッシュへ変更
+ ****************************************/
+
+#ifndef STATIC_DEBRIS_H
+#define STATIC_DEBRIS_H
+
+class PhysicsModel;
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace StaticDebrisConfig
+{
+    // 結合単位の空間セル（1辺）
+    constexpr float CELL_SIZE = 4.0f;
+    // 連続してこの時間眠っていた破片を焼き込む
+    constexpr float SETTLE_TIME = 2.0f;
+    // 1チャンクの三角形上限（超える場合は同じセルに別チャンクを作る）
+    constexpr int MAX_CHUNK_TRIANGLES = 65536;
+    // 焼き込み済み三角形の総上限（超えた破片は焼き込まず、破片予算の削除に任せる）
+    constexpr int MAX_TOTAL_TRIANGLES = 300000;
+}
+
+//--------------------------------------
+// 関数プロトタイプ
+//--------------------------------------
+void StaticDebris_Initialize();
+void StaticDebris_Finalize();
+
+/**
+ * @brief 破片のメッシュをチャンクへ結合し、当たり判定をマップ登録待ちにする
+ * @detail GPUバッファの再構築とマップへの登録は StaticDebris_Update でまとめて行う
+ * @return 焼き込んだ場合 true（呼び出し側で破片を解放すること）
+ */
+bool StaticDebris_Bake(const PhysicsModel& piece);
+
+/**
+ * @brief 変更のあったチャンクのGPUバッファを作り直し、登録待ちの当たり判定をマップへ追加
+ * @detail 1ステップ分の焼き込みをまとめて反映する。マップの空間インデックスを更新するため、
+ *         物理ジョブの外（メインスレッド）で呼ぶこと
+ */
+void StaticDebris_Update();
+
+void StaticDebris_Draw();
+void StaticDebris_DrawShadow();
+
+int StaticDebris_GetChunkCount();
+int StaticDebris_GetBakedPieceCount();
+int StaticDebris_GetTriangleCount();
+
+#endif // STATIC_DEBRIS_H
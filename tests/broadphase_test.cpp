@@ -0,0 +1,209 @@
+﻿/****************************************
+ * @file    broadphase_test.cpp
+ * @brief   ブロードフェーズの永続ペアリストと総当たりの照合、処理時間の比較
+ * @detail  100 / 500 / 2000 個の箱を固定シードで同じ密度になるよう散らし、等速で動かしながら
+ *          毎ステップ MoveProxy と UpdatePairs を行う。ペアリストを太らせたAABBの総当たりと比べ、
+ *          実際のAABBが重なる組がすべて含まれることを確かめる。
+ *          処理時間は実際のAABBの総当たり（従来の全組み合わせ判定の候補列挙）と並べて表示する。
+ *          1件でも食い違えば終了コード 1 を返す
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "broadphase.h"
+#include "collider.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace BroadphaseTestConfig
+{
+    constexpr int BODY_COUNTS[] = { 100, 500, 2000 };
+    constexpr float VOLUME_PER_BODY = 4.0f;     // 1個あたりの空間の広さ（個数によらず密度を揃える）
+    constexpr float MIN_HALF_SIZE = 0.2f;       // 破片の大きさの範囲
+    constexpr float MAX_HALF_SIZE = 0.6f;
+    constexpr float MAX_SPEED = 3.0f;
+    constexpr float TIME_STEP = 1.0f / 60.0f;
+    constexpr int STEP_COUNT = 120;
+    constexpr int GROUP_INTERVAL = 5;           // この間隔で切断グループ付きの破片を混ぜる
+    constexpr int GROUP_COUNT = 3;
+    constexpr unsigned int SEED = 12345u;
+}
+
+using namespace DirectX;
+using namespace BroadphaseTestConfig;
+
+namespace
+{
+    struct Body
+    {
+        XMFLOAT3 position;
+        XMFLOAT3 velocity;
+        XMFLOAT3 halfSize;
+        CollisionFilter filter;
+        int proxyId = -1;
+    };
+
+    struct RunResult
+    {
+        double broadphaseMs = 0.0;
+        double bruteForceMs = 0.0;
+        long long pairTotal = 0;
+        long long touchingTotal = 0;
+        int mismatchSteps = 0;      // 太らせたAABBの総当たりとペアリストが一致しなかったステップ数
+        int missingPairs = 0;       // 実際に重なるのにペアリストにない組
+    };
+
+    AABB GetBounds(const Body& body)
+    {
+        AABB aabb;
+        aabb.min = { body.position.x - body.halfSize.x, body.position.y - body.halfSize.y, body.position.z - body.halfSize.z };
+        aabb.max = { body.position.x + body.halfSize.x, body.position.y + body.halfSize.y, body.position.z + body.halfSize.z };
+        return aabb;
+    }
+
+    BroadphasePair MakePair(int proxyA, int proxyB)
+    {
+        return { std::min(proxyA, proxyB), std::max(proxyA, proxyB) };
+    }
+
+    /**
+     * @brief 箱の中を等速で動かし、壁で跳ね返す
+     */
+    void StepBodies(std::vector<Body>& bodies, float extent)
+    {
+        for (Body& body : bodies)
+        {
+            float* position = &body.position.x;
+            float* velocity = &body.velocity.x;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                position[axis] += velocity[axis] * TIME_STEP;
+                if (position[axis] < 0.0f || position[axis] > extent)
+                {
+                    position[axis] = std::clamp(position[axis], 0.0f, extent);
+                    velocity[axis] = -velocity[axis];
+                }
+            }
+        }
+    }
+
+    RunResult Run(int bodyCount)
+    {
+        std::mt19937 rng(SEED);
+        const float extent = std::cbrt(bodyCount * VOLUME_PER_BODY);
+        std::uniform_real_distribution<float> place(0.0f, extent);
+        std::uniform_real_distribution<float> halfSize(MIN_HALF_SIZE, MAX_HALF_SIZE);
+        std::uniform_real_distribution<float> speed(-MAX_SPEED, MAX_SPEED);
+
+        Broadphase broadphase;
+        std::vector<Body> bodies(bodyCount);
+        for (int i = 0; i < bodyCount; ++i)
+        {
+            Body& body = bodies[i];
+            body.position = { place(rng), place(rng), place(rng) };
+            body.velocity = { speed(rng), speed(rng), speed(rng) };
+            body.halfSize = { halfSize(rng), halfSize(rng), halfSize(rng) };
+            if (i % GROUP_INTERVAL == 0)
+            {
+                body.filter.groupId = 1 + (i / GROUP_INTERVAL) % GROUP_COUNT;
+            }
+            body.proxyId = broadphase.CreateProxy(GetBounds(body), &body, body.filter);
+        }
+        broadphase.UpdatePairs();
+
+        RunResult result;
+        std::vector<BroadphasePair> expected;
+        std::vector<BroadphasePair> touching;
+        for (int step = 0; step < STEP_COUNT; ++step)
+        {
+            StepBodies(bodies, extent);
+
+            // ブロードフェーズの更新
+            auto start = std::chrono::high_resolution_clock::now();
+            for (const Body& body : bodies)
+            {
+                const XMFLOAT3 displacement = { body.velocity.x * TIME_STEP, body.velocity.y * TIME_STEP, body.velocity.z * TIME_STEP };
+                broadphase.MoveProxy(body.proxyId, GetBounds(body), displacement);
+            }
+            broadphase.UpdatePairs();
+            result.broadphaseMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+            // 実際のAABBの総当たり（ブロードフェーズ導入前の候補列挙に相当）
+            start = std::chrono::high_resolution_clock::now();
+            touching.clear();
+            for (int a = 0; a < bodyCount; ++a)
+            {
+                const AABB boundsA = GetBounds(bodies[a]);
+                for (int b = a + 1; b < bodyCount; ++b)
+                {
+                    if (!CollisionFilter::ShouldCollide(bodies[a].filter, bodies[b].filter)) continue;
+                    if (Collision_IsOverlapAABB(boundsA, GetBounds(bodies[b])))
+                    {
+                        touching.push_back(MakePair(bodies[a].proxyId, bodies[b].proxyId));
+                    }
+                }
+            }
+            result.bruteForceMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+            // 太らせたAABBの総当たりとの照合
+            expected.clear();
+            for (int a = 0; a < bodyCount; ++a)
+            {
+                const AABB& fatA = broadphase.GetFatAABB(bodies[a].proxyId);
+                for (int b = a + 1; b < bodyCount; ++b)
+                {
+                    if (!CollisionFilter::ShouldCollide(bodies[a].filter, bodies[b].filter)) continue;
+                    if (Collision_IsOverlapAABB(fatA, broadphase.GetFatAABB(bodies[b].proxyId)))
+                    {
+                        expected.push_back(MakePair(bodies[a].proxyId, bodies[b].proxyId));
+                    }
+                }
+            }
+            std::sort(expected.begin(), expected.end());
+
+            const std::vector<BroadphasePair>& pairs = broadphase.GetPairs();
+            if (pairs != expected) ++result.mismatchSteps;
+            for (const BroadphasePair& pair : touching)
+            {
+                if (!std::binary_search(pairs.begin(), pairs.end(), pair)) ++result.missingPairs;
+            }
+
+            result.pairTotal += static_cast<long long>(pairs.size());
+            result.touchingTotal += static_cast<long long>(touching.size());
+        }
+        return result;
+    }
+}
+
+int main()
+{
+    printf("[Broadphase] dynamic AABB tree + persistent pairs (%d steps)\n", STEP_COUNT);
+
+    bool isPassed = true;
+    for (int bodyCount : BODY_COUNTS)
+    {
+        const RunResult result = Run(bodyCount);
+        const bool isOk = result.mismatchSteps == 0 && result.missingPairs == 0;
+        isPassed = isPassed && isOk;
+
+        printf("  bodies=%5d pairs/step=%7.1f touching/step=%7.1f broadphase=%8.4fms/step brute=%8.4fms/step mismatch=%d missing=%d %s\n",
+               bodyCount,
+               static_cast<double>(result.pairTotal) / STEP_COUNT,
+               static_cast<double>(result.touchingTotal) / STEP_COUNT,
+               result.broadphaseMs / STEP_COUNT,
+               result.bruteForceMs / STEP_COUNT,
+               result.mismatchSteps, result.missingPairs, isOk ? "ok" : "FAIL");
+    }
+
+    printf("[Broadphase] %s\n", isPassed ? "PASSED" : "FAILED");
+    return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,1007 @@
+﻿/****************************************
+ * @file    collision_kernel_test.cpp
+ * @brief   判定関数の速度計測と倍精度の参照実装による精度検証
+ * @detail  collision.cpp の形状ペア関数ごとに、固定シードの乱数入力で
+ *          1回あたりの時間を計り、double で書き直した参照実装と結果を突き合わせる。
+ *          判定の境界すれすれ（参照値の余裕が小さい入力）は丸めで結果が分かれうるため除外する。
+ *          近似実装の関数（カプセル × OBB など）は差を報告するだけで不合格にはしない。
+ *          参照実装は速度を考えず、できるだけ別の道筋（凸関数の最小化、候補の総当たりなど）で
+ *          同じ量を double で求める。判定関数と同じ書き方をなぞると同じ誤りも写してしまうため。
+ *          厳密な実装が1つでも許容範囲を外れれば終了コード 1 を返す
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "collision.h"
+#include "collider.h"
+#include "ray.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace CollisionKernelTestConfig
+{
+    // 関数ごとの入力数と乱数シード（同じシードなら毎回同じ入力）
+    constexpr int SAMPLE_COUNT = 16384;
+    constexpr unsigned int SEED = 20261018u;
+
+    // 入力の位置の範囲（±）と形状の大きさ
+    constexpr float SPREAD = 3.0f;
+    constexpr float MIN_SIZE = 0.25f;
+    constexpr float MAX_SIZE = 2.0f;
+
+    // 参照値との差（距離・深さ・座標・法線の成分）の許容値
+    constexpr double TOLERANCE = 1e-3;
+    // 参照値で当たり・外れの境界までの余裕がこれ以下の入力は一致判定から除く
+    constexpr double BOUNDARY_MARGIN = 1e-3;
+    // 最近点間の距離がこれ以下のときは法線の向きが丸め誤差で決まるため比べない
+    constexpr double NOISY_DISTANCE = 1e-3;
+}
+
+using namespace DirectX;
+using namespace CollisionKernelTestConfig;
+
+//======================================
+// 倍精度の参照実装
+//======================================
+namespace
+{
+    // 判定関数が外積の軸を捨てる閾値（長さの2乗）。参照実装も同じ軸を使う
+    constexpr double CROSS_AXIS_EPSILON = 1e-6;
+    // 判定関数がレイの成分を平行とみなす閾値
+    constexpr double PARALLEL_EPSILON = 1e-6;
+    // 凸関数の最小化・根の二分探索の反復回数
+    constexpr int SEARCH_ITERATIONS = 128;
+
+    constexpr double INFINITE_DISTANCE = std::numeric_limits<double>::max();
+
+    struct Vec3d
+    {
+        double x, y, z;
+    };
+
+    Vec3d operator+(const Vec3d& a, const Vec3d& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+    Vec3d operator-(const Vec3d& a, const Vec3d& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+    Vec3d operator*(const Vec3d& a, double s) { return { a.x * s, a.y * s, a.z * s }; }
+    double Dot(const Vec3d& a, const Vec3d& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+    Vec3d Cross(const Vec3d& a, const Vec3d& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+    double Length(const Vec3d& a) { return std::sqrt(Dot(a, a)); }
+    Vec3d ToVec3d(const XMFLOAT3& v) { return { v.x, v.y, v.z }; }
+
+    /**
+     * @struct OBBd
+     * @brief 軸を展開した OBB（axis[k] は XMMatrixRotationQuaternion の k 行目と同じ向き）
+     */
+    struct OBBd
+    {
+        Vec3d center;
+        Vec3d axis[3];
+        double extents[3];
+    };
+
+    OBBd ToOBBd(const OBB& obb)
+    {
+        double x = obb.orientation.x, y = obb.orientation.y, z = obb.orientation.z, w = obb.orientation.w;
+        const double invLength = 1.0 / std::sqrt(x * x + y * y + z * z + w * w);
+        x *= invLength; y *= invLength; z *= invLength; w *= invLength;
+
+        OBBd result;
+        result.center = ToVec3d(obb.center);
+        result.axis[0] = { 1.0 - 2.0 * (y * y + z * z), 2.0 * (x * y + z * w), 2.0 * (x * z - y * w) };
+        result.axis[1] = { 2.0 * (x * y - z * w), 1.0 - 2.0 * (x * x + z * z), 2.0 * (y * z + x * w) };
+        result.axis[2] = { 2.0 * (x * z + y * w), 2.0 * (y * z - x * w), 1.0 - 2.0 * (x * x + y * y) };
+        result.extents[0] = obb.extents.x;
+        result.extents[1] = obb.extents.y;
+        result.extents[2] = obb.extents.z;
+        return result;
+    }
+
+    Vec3d RefClosestPointSegment(const Vec3d& p, const Vec3d& a, const Vec3d& b)
+    {
+        const Vec3d ab = b - a;
+        const double lengthSq = Dot(ab, ab);
+        if (lengthSq <= 0.0) return a;
+        const double t = std::clamp(Dot(p - a, ab) / lengthSq, 0.0, 1.0);
+        return a + ab * t;
+    }
+
+    /**
+     * @brief 平面への射影が内側ならそれ、外側なら3辺の最近点のうち最も近いもの
+     */
+    Vec3d RefClosestPointTriangle(const Vec3d& p, const Vec3d& a, const Vec3d& b, const Vec3d& c)
+    {
+        const Vec3d n = Cross(b - a, c - a);
+        const double nn = Dot(n, n);
+        if (nn > 0.0)
+        {
+            const Vec3d q = p - n * (Dot(p - a, n) / nn);
+            if (Dot(Cross(b - a, q - a), n) >= 0.0 &&
+                Dot(Cross(c - b, q - b), n) >= 0.0 &&
+                Dot(Cross(a - c, q - c), n) >= 0.0)
+            {
+                return q;
+            }
+        }
+
+        const Vec3d candidates[3] = {
+            RefClosestPointSegment(p, a, b),
+            RefClosestPointSegment(p, b, c),
+            RefClosestPointSegment(p, c, a),
+        };
+        Vec3d best = candidates[0];
+        for (const Vec3d& candidate : candidates)
+        {
+            if (Length(p - candidate) < Length(p - best)) best = candidate;
+        }
+        return best;
+    }
+
+    /**
+     * @brief 両線分の内部の停留点と、4つの端点から相手の線分への距離のうち最小
+     */
+    double RefDistanceSegmentSegment(const Vec3d& p1, const Vec3d& q1, const Vec3d& p2, const Vec3d& q2)
+    {
+        double best = std::min({
+            Length(p1 - RefClosestPointSegment(p1, p2, q2)),
+            Length(q1 - RefClosestPointSegment(q1, p2, q2)),
+            Length(p2 - RefClosestPointSegment(p2, p1, q1)),
+            Length(q2 - RefClosestPointSegment(q2, p1, q1)),
+        });
+
+        const Vec3d d1 = q1 - p1;
+        const Vec3d d2 = q2 - p2;
+        const Vec3d r = p1 - p2;
+        const double a = Dot(d1, d1);
+        const double e = Dot(d2, d2);
+        const double b = Dot(d1, d2);
+        const double denom = a * e - b * b;
+        if (denom > 1e-12 * a * e)
+        {
+            const double c = Dot(d1, r);
+            const double f = Dot(d2, r);
+            const double s = (b * f - c * e) / denom;
+            const double t = (a * f - b * c) / denom;
+            if (s >= 0.0 && s <= 1.0 && t >= 0.0 && t <= 1.0)
+            {
+                best = std::min(best, Length((p1 + d1 * s) - (p2 + d2 * t)));
+            }
+        }
+        return best;
+    }
+
+    Vec3d RefClosestPointOBB(const Vec3d& p, const OBBd& obb)
+    {
+        const Vec3d delta = p - obb.center;
+        Vec3d closest = obb.center;
+        for (int k = 0; k < 3; ++k)
+        {
+            const double local = std::clamp(Dot(delta, obb.axis[k]), -obb.extents[k], obb.extents[k]);
+            closest = closest + obb.axis[k] * local;
+        }
+        return closest;
+    }
+
+    /**
+     * @brief 凸関数の [lo, hi] での最小値（黄金分割探索）
+     */
+    template<class Func>
+    double RefMinimizeConvex(Func func, double lo, double hi, double* outX = nullptr)
+    {
+        const double ratio = (std::sqrt(5.0) - 1.0) * 0.5;
+        double x1 = hi - ratio * (hi - lo);
+        double x2 = lo + ratio * (hi - lo);
+        double f1 = func(x1);
+        double f2 = func(x2);
+        for (int i = 0; i < SEARCH_ITERATIONS; ++i)
+        {
+            if (f1 < f2) { hi = x2; x2 = x1; f2 = f1; x1 = hi - ratio * (hi - lo); f1 = func(x1); }
+            else         { lo = x1; x1 = x2; f1 = f2; x2 = lo + ratio * (hi - lo); f2 = func(x2); }
+        }
+
+        // 端点が最小の場合も拾う
+        double bestX = (f1 < f2) ? x1 : x2;
+        double best = std::min(f1, f2);
+        const double fLo = func(lo), fHi = func(hi);
+        if (fLo < best) { best = fLo; bestX = lo; }
+        if (fHi < best) { best = fHi; bestX = hi; }
+        if (outX) *outX = bestX;
+        return best;
+    }
+
+    /**
+     * @brief 凸関数 gap(t) が [0, tMax] で初めて 0 以下になる t（無ければ負）
+     * @param[out] outMargin 当たり・外れが入れ替わるまでの余裕（最小値の絶対値と開始時点の値）
+     */
+    template<class Func>
+    double RefFirstContact(Func gap, double tMax, double* outMargin)
+    {
+        const double gapStart = gap(0.0);
+        if (gapStart <= 0.0)
+        {
+            *outMargin = std::abs(gapStart);
+            return 0.0;
+        }
+
+        double tClosest = 0.0;
+        const double gapMin = RefMinimizeConvex(gap, 0.0, tMax, &tClosest);
+        *outMargin = std::min(std::abs(gapMin), gapStart);
+        if (gapMin > 0.0) return -1.0;
+
+        // 開始から最接近までは単調に減るので二分探索
+        double lo = 0.0, hi = tClosest;
+        for (int i = 0; i < SEARCH_ITERATIONS; ++i)
+        {
+            const double mid = (lo + hi) * 0.5;
+            if (gap(mid) > 0.0) lo = mid; else hi = mid;
+        }
+        return hi;
+    }
+
+    double RefOBBProjectedRadius(const Vec3d& axis, const OBBd& obb)
+    {
+        return obb.extents[0] * std::abs(Dot(axis, obb.axis[0])) +
+               obb.extents[1] * std::abs(Dot(axis, obb.axis[1])) +
+               obb.extents[2] * std::abs(Dot(axis, obb.axis[2]));
+    }
+
+    /**
+     * @brief 外積の軸を正規化（判定関数が捨てる長さなら false）
+     * @param[in,out] axisMargin 捨てる閾値までの余裕の最小値
+     */
+    bool RefNormalizeCrossAxis(Vec3d& axis, double& axisMargin)
+    {
+        const double lengthSq = Dot(axis, axis);
+        axisMargin = std::min(axisMargin, std::abs(lengthSq - CROSS_AXIS_EPSILON));
+        if (lengthSq <= CROSS_AXIS_EPSILON) return false;
+        axis = axis * (1.0 / std::sqrt(lengthSq));
+        return true;
+    }
+
+    /**
+     * @brief 分離軸ごとの重なりの最小値（負なら分離）
+     * @param[out] outAxisMargin 外積の軸の長さの2乗が閾値からどれだけ離れているか
+     */
+    double RefPenetrationOBBOBB(const OBBd& a, const OBBd& b, double* outAxisMargin)
+    {
+        std::vector<Vec3d> axes = { a.axis[0], a.axis[1], a.axis[2], b.axis[0], b.axis[1], b.axis[2] };
+        *outAxisMargin = INFINITE_DISTANCE;
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                Vec3d axis = Cross(a.axis[i], b.axis[j]);
+                if (RefNormalizeCrossAxis(axis, *outAxisMargin)) axes.push_back(axis);
+            }
+        }
+
+        const Vec3d translation = b.center - a.center;
+        double penetration = INFINITE_DISTANCE;
+        for (const Vec3d& axis : axes)
+        {
+            const double overlap = RefOBBProjectedRadius(axis, a) + RefOBBProjectedRadius(axis, b) - std::abs(Dot(translation, axis));
+            penetration = std::min(penetration, overlap);
+        }
+        return penetration;
+    }
+
+    double RefPenetrationOBBTriangle(const OBBd& obb, const Triangle& tri, double* outAxisMargin)
+    {
+        const Vec3d v[3] = { ToVec3d(tri.p0), ToVec3d(tri.p1), ToVec3d(tri.p2) };
+        const Vec3d edges[3] = { v[1] - v[0], v[2] - v[1], v[0] - v[2] };
+
+        std::vector<Vec3d> candidates = { obb.axis[0], obb.axis[1], obb.axis[2], ToVec3d(tri.normal) };
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                candidates.push_back(Cross(obb.axis[i], edges[j]));
+            }
+        }
+
+        *outAxisMargin = INFINITE_DISTANCE;
+        double penetration = INFINITE_DISTANCE;
+        for (Vec3d axis : candidates)
+        {
+            if (!RefNormalizeCrossAxis(axis, *outAxisMargin)) continue;
+
+            const double center = Dot(axis, obb.center);
+            const double radius = RefOBBProjectedRadius(axis, obb);
+            const double triMin = std::min({ Dot(axis, v[0]), Dot(axis, v[1]), Dot(axis, v[2]) });
+            const double triMax = std::max({ Dot(axis, v[0]), Dot(axis, v[1]), Dot(axis, v[2]) });
+            penetration = std::min({ penetration, (center + radius) - triMin, triMax - (center - radius) });
+        }
+        return penetration;
+    }
+
+    double RefDistanceSegmentOBB(const Vec3d& a, const Vec3d& b, const OBBd& obb)
+    {
+        return RefMinimizeConvex([&](double t) {
+            const Vec3d p = a + (b - a) * t;
+            return Length(p - RefClosestPointOBB(p, obb));
+        }, 0.0, 1.0);
+    }
+
+    double RefDistanceSegmentTriangle(const Vec3d& a, const Vec3d& b, const Triangle& tri)
+    {
+        const Vec3d p0 = ToVec3d(tri.p0), p1 = ToVec3d(tri.p1), p2 = ToVec3d(tri.p2);
+        return RefMinimizeConvex([&](double t) {
+            const Vec3d p = a + (b - a) * t;
+            return Length(p - RefClosestPointTriangle(p, p0, p1, p2));
+        }, 0.0, 1.0);
+    }
+
+    /**
+     * @brief レイと球（始点が内側なら距離 0）
+     * @param[out] outMargin 接する・外れるまでの余裕
+     */
+    bool RefRaySphere(const Vec3d& origin, const Vec3d& dir, const Vec3d& center, double radius, double* outDist, double* outMargin)
+    {
+        const Vec3d m = origin - center;
+        const double b = Dot(m, dir);
+        const double c = Dot(m, m) - radius * radius;
+        const double perpendicular = Length(m - dir * b);
+        *outMargin = std::min({ std::abs(perpendicular - radius), std::abs(b), std::abs(Length(m) - radius) });
+
+        if (c > 0.0 && b > 0.0) return false;
+        const double disc = b * b - c;
+        if (disc < 0.0) return false;
+        *outDist = std::max(-b - std::sqrt(disc), 0.0);
+        return true;
+    }
+
+    bool RefRayAABB(const Vec3d& origin, const Vec3d& dir, const AABB& aabb, double* outDist, double* outMargin)
+    {
+        const double o[3] = { origin.x, origin.y, origin.z };
+        const double d[3] = { dir.x, dir.y, dir.z };
+        const double boxMin[3] = { aabb.min.x, aabb.min.y, aabb.min.z };
+        const double boxMax[3] = { aabb.max.x, aabb.max.y, aabb.max.z };
+
+        double tMin = 0.0;
+        double tMax = INFINITE_DISTANCE;
+        double margin = INFINITE_DISTANCE;
+        bool isInsideSlabs = true;
+        for (int i = 0; i < 3; ++i)
+        {
+            margin = std::min(margin, std::abs(std::abs(d[i]) - PARALLEL_EPSILON));
+            if (std::abs(d[i]) < PARALLEL_EPSILON)
+            {
+                const double gap = std::min(o[i] - boxMin[i], boxMax[i] - o[i]);
+                margin = std::min(margin, std::abs(gap));
+                if (gap < 0.0) isInsideSlabs = false;
+                continue;
+            }
+            double t1 = (boxMin[i] - o[i]) / d[i];
+            double t2 = (boxMax[i] - o[i]) / d[i];
+            if (t1 > t2) std::swap(t1, t2);
+            tMin = std::max(tMin, t1);
+            tMax = std::min(tMax, t2);
+        }
+        margin = std::min(margin, std::abs(tMax - tMin));
+        *outMargin = margin;
+
+        if (!isInsideSlabs || tMin > tMax) return false;
+        *outDist = tMin;
+        return true;
+    }
+}
+
+//======================================
+// 入力生成と集計
+//======================================
+namespace
+{
+    /**
+     * @class SampleGenerator
+     * @brief 固定シードの乱数で各形状を作る
+     */
+    class SampleGenerator
+    {
+    public:
+        explicit SampleGenerator(unsigned int seed)
+            : m_Rng(seed), m_Position(-SPREAD, SPREAD), m_Size(MIN_SIZE, MAX_SIZE), m_Angle(-XM_PI, XM_PI)
+        {
+        }
+
+        float Size() { return m_Size(m_Rng); }
+        XMFLOAT3 Point() { return { m_Position(m_Rng), m_Position(m_Rng), m_Position(m_Rng) }; }
+
+        XMFLOAT3 Direction()
+        {
+            XMFLOAT3 direction;
+            XMStoreFloat3(&direction, XMVector3Normalize(XMVectorSet(m_Position(m_Rng), m_Position(m_Rng), m_Position(m_Rng), 0.0f)));
+            return direction;
+        }
+
+        XMFLOAT3 Offset(const XMFLOAT3& from)
+        {
+            const XMFLOAT3 direction = Direction();
+            const float length = Size();
+            return { from.x + direction.x * length, from.y + direction.y * length, from.z + direction.z * length };
+        }
+
+        Sphere MakeSphere() { return { Point(), Size() * 0.5f }; }
+
+        OBB MakeOBB()
+        {
+            OBB obb;
+            obb.center = Point();
+            obb.extents = { Size() * 0.5f, Size() * 0.5f, Size() * 0.5f };
+            XMStoreFloat4(&obb.orientation, XMQuaternionRotationRollPitchYaw(m_Angle(m_Rng), m_Angle(m_Rng), m_Angle(m_Rng)));
+            return obb;
+        }
+
+        AABB MakeAABB()
+        {
+            const XMFLOAT3 center = Point();
+            const XMFLOAT3 half = { Size() * 0.5f, Size() * 0.5f, Size() * 0.5f };
+            return { { center.x - half.x, center.y - half.y, center.z - half.z },
+                     { center.x + half.x, center.y + half.y, center.z + half.z } };
+        }
+
+        Capsule MakeCapsule()
+        {
+            const XMFLOAT3 start = Point();
+            return Capsule(start, Offset(start), Size() * 0.5f);
+        }
+
+        Triangle MakeTriangle()
+        {
+            for (;;)
+            {
+                Triangle tri;
+                tri.p0 = Point();
+                tri.p1 = Offset(tri.p0);
+                tri.p2 = Offset(tri.p0);
+
+                const XMVECTOR cross = XMVector3Cross(XMLoadFloat3(&tri.p1) - XMLoadFloat3(&tri.p0),
+                                                      XMLoadFloat3(&tri.p2) - XMLoadFloat3(&tri.p0));
+                if (XMVectorGetX(XMVector3LengthSq(cross)) < 1e-4f) continue;
+                XMStoreFloat3(&tri.normal, XMVector3Normalize(cross));
+                return tri;
+            }
+        }
+
+    private:
+        std::mt19937 m_Rng;
+        std::uniform_real_distribution<float> m_Position;
+        std::uniform_real_distribution<float> m_Size;
+        std::uniform_real_distribution<float> m_Angle;
+    };
+
+    /**
+     * @struct KernelReport
+     * @brief 関数1つ分の計測・照合結果
+     */
+    struct KernelReport
+    {
+        const char* name = "";
+        bool isExact = true;        // false: 近似実装（差は報告のみ）
+        double nsPerCall = 0.0;
+        int hitCount = 0;
+        int mismatchCount = 0;      // 当たり・外れが参照と食い違った数
+        int skippedCount = 0;       // 境界すれすれで照合から除いた数
+        double maxError = 0.0;
+
+        void AddError(double error) { maxError = std::max(maxError, std::abs(error)); }
+
+        void AddErrors(const XMFLOAT3& value, const Vec3d& reference)
+        {
+            AddError(value.x - reference.x);
+            AddError(value.y - reference.y);
+            AddError(value.z - reference.z);
+        }
+
+        /**
+         * @brief 当たり・外れを照合し、当たりの中身まで比べるなら true
+         */
+        bool CompareHit(bool isHit, bool isReferenceHit, double margin)
+        {
+            if (margin < BOUNDARY_MARGIN) { ++skippedCount; return false; }
+            if (isHit != isReferenceHit) { ++mismatchCount; return false; }
+            if (isHit) ++hitCount;
+            return isHit;
+        }
+
+        bool IsPassed() const { return !isExact || (mismatchCount == 0 && maxError <= TOLERANCE); }
+    };
+
+    template<class Func>
+    double MeasureNsPerCall(Func func)
+    {
+        using namespace std::chrono;
+        const auto start = high_resolution_clock::now();
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            func(i);
+        }
+        return duration<double, std::nano>(high_resolution_clock::now() - start).count() / SAMPLE_COUNT;
+    }
+
+    void PrintReport(const KernelReport& report)
+    {
+        const char* status = !report.isExact ? "approx" : (report.IsPassed() ? "ok" : "FAIL");
+        printf("  %-22s %8.2fns/call hits=%6d mismatch=%5d skipped=%4d maxError=%.6f %s\n",
+                 report.name, report.nsPerCall, report.hitCount, report.mismatchCount, report.skippedCount, report.maxError, status);
+    }
+
+    /**
+     * @brief 当たりの中身（深さ・接触点・法線）を参照値と比べる
+     * @param distance 参照の最近点間の距離（法線の向きが定まるかの判断に使う）
+     */
+    void CompareContact(KernelReport& report, const Hit& hit, double referenceDepth,
+        const Vec3d& referencePoint, const Vec3d& referenceNormal, double distance)
+    {
+        report.AddError(hit.depth - referenceDepth);
+        if (distance <= NOISY_DISTANCE) return;
+        report.AddErrors(hit.contactPoint, referencePoint);
+        report.AddErrors(hit.normal, referenceNormal);
+    }
+}
+
+//======================================
+// 計測と照合
+//======================================
+int main()
+{
+    SampleGenerator gen(SEED);
+    std::vector<KernelReport> reports;
+    std::vector<Hit> hits(SAMPLE_COUNT);
+
+    //--------------------------------------
+    // 最近点・距離
+    //--------------------------------------
+    {
+        KernelReport report{ "ClosestPointOnSegment" };
+        std::vector<XMFLOAT3> points(SAMPLE_COUNT), starts(SAMPLE_COUNT), ends(SAMPLE_COUNT), results(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            points[i] = gen.Point();
+            starts[i] = gen.Point();
+            ends[i] = gen.Offset(starts[i]);
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { results[i] = Collision_ClosestPointOnSegment(points[i], starts[i], ends[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            report.AddErrors(results[i], RefClosestPointSegment(ToVec3d(points[i]), ToVec3d(starts[i]), ToVec3d(ends[i])));
+        }
+        reports.push_back(report);
+    }
+    {
+        KernelReport report{ "ClosestPointTriangle" };
+        std::vector<XMFLOAT3> points(SAMPLE_COUNT), results(SAMPLE_COUNT);
+        std::vector<Triangle> triangles(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            points[i] = gen.Point();
+            triangles[i] = gen.MakeTriangle();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { results[i] = Collision_ClosestPointTriangle(points[i], triangles[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            const Triangle& tri = triangles[i];
+            report.AddErrors(results[i], RefClosestPointTriangle(ToVec3d(points[i]), ToVec3d(tri.p0), ToVec3d(tri.p1), ToVec3d(tri.p2)));
+        }
+        reports.push_back(report);
+    }
+    {
+        KernelReport report{ "DistanceSegmentSegment" };
+        std::vector<Capsule> a(SAMPLE_COUNT), b(SAMPLE_COUNT);
+        std::vector<float> results(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            a[i] = gen.MakeCapsule();
+            b[i] = gen.MakeCapsule();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { results[i] = Collision_DistanceSegmentSegment(a[i].start, a[i].end, b[i].start, b[i].end); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            report.AddError(results[i] - RefDistanceSegmentSegment(ToVec3d(a[i].start), ToVec3d(a[i].end), ToVec3d(b[i].start), ToVec3d(b[i].end)));
+        }
+        reports.push_back(report);
+    }
+
+    //--------------------------------------
+    // 重なり判定
+    //--------------------------------------
+    {
+        KernelReport report{ "IsHitAABB" };
+        std::vector<AABB> a(SAMPLE_COUNT), b(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            a[i] = gen.MakeAABB();
+            b[i] = gen.MakeAABB();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { hits[i] = Collision_IsHitAABB(a[i], b[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            const double overlap = std::min({
+                static_cast<double>(std::min(a[i].max.x, b[i].max.x)) - std::max(a[i].min.x, b[i].min.x),
+                static_cast<double>(std::min(a[i].max.y, b[i].max.y)) - std::max(a[i].min.y, b[i].min.y),
+                static_cast<double>(std::min(a[i].max.z, b[i].max.z)) - std::max(a[i].min.z, b[i].min.z),
+            });
+            if (report.CompareHit(hits[i].isHit, overlap >= 0.0, std::abs(overlap)))
+            {
+                report.AddError(hits[i].depth - overlap);
+            }
+        }
+        reports.push_back(report);
+    }
+    {
+        KernelReport report{ "IsHitSphereOBB" };
+        std::vector<Sphere> spheres(SAMPLE_COUNT);
+        std::vector<OBB> boxes(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            spheres[i] = gen.MakeSphere();
+            boxes[i] = gen.MakeOBB();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { hits[i] = Collision_IsHitSphereOBB(spheres[i], boxes[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            const Vec3d center = ToVec3d(spheres[i].center);
+            const Vec3d closest = RefClosestPointOBB(center, ToOBBd(boxes[i]));
+            const double dist = Length(center - closest);
+            const double radius = spheres[i].radius;
+            if (report.CompareHit(hits[i].isHit, dist < radius, std::abs(dist - radius)))
+            {
+                CompareContact(report, hits[i], radius - dist, closest, (center - closest) * (1.0 / dist), dist);
+            }
+        }
+        reports.push_back(report);
+    }
+    {
+        KernelReport report{ "IsHitOBBOBB" };
+        std::vector<OBB> a(SAMPLE_COUNT), b(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            a[i] = gen.MakeOBB();
+            b[i] = gen.MakeOBB();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { hits[i] = Collision_IsHitOBBOBB(a[i], b[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            double axisMargin = 0.0;
+            const double penetration = RefPenetrationOBBOBB(ToOBBd(a[i]), ToOBBd(b[i]), &axisMargin);
+            // 外積の軸の採否が丸めで変わる入力も境界として除く
+            const double margin = (axisMargin < CROSS_AXIS_EPSILON * 0.1) ? 0.0 : std::abs(penetration);
+            if (report.CompareHit(hits[i].isHit, penetration >= 0.0, margin))
+            {
+                report.AddError(hits[i].depth - penetration);
+            }
+        }
+        reports.push_back(report);
+    }
+    {
+        KernelReport report{ "IsHitOBBTriangle" };
+        std::vector<OBB> boxes(SAMPLE_COUNT);
+        std::vector<Triangle> triangles(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            boxes[i] = gen.MakeOBB();
+            triangles[i] = gen.MakeTriangle();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { hits[i] = Collision_IsHitOBBTriangle(boxes[i], triangles[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            double axisMargin = 0.0;
+            const double penetration = RefPenetrationOBBTriangle(ToOBBd(boxes[i]), triangles[i], &axisMargin);
+            const double margin = (axisMargin < CROSS_AXIS_EPSILON * 0.1) ? 0.0 : std::abs(penetration);
+            if (report.CompareHit(hits[i].isHit, penetration >= 0.0, margin))
+            {
+                report.AddError(hits[i].depth - penetration);
+            }
+        }
+        reports.push_back(report);
+    }
+    {
+        KernelReport report{ "IsHitSphereTriangle" };
+        std::vector<Sphere> spheres(SAMPLE_COUNT);
+        std::vector<Triangle> triangles(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            spheres[i] = gen.MakeSphere();
+            triangles[i] = gen.MakeTriangle();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { hits[i] = Collision_IsHitSphereTriangle(spheres[i], triangles[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            const Triangle& tri = triangles[i];
+            const Vec3d center = ToVec3d(spheres[i].center);
+            const Vec3d closest = RefClosestPointTriangle(center, ToVec3d(tri.p0), ToVec3d(tri.p1), ToVec3d(tri.p2));
+            const double dist = Length(center - closest);
+            const double radius = spheres[i].radius;
+            if (report.CompareHit(hits[i].isHit, dist < radius, std::abs(dist - radius)))
+            {
+                CompareContact(report, hits[i], radius - dist, closest, (center - closest) * (1.0 / dist), dist);
+            }
+        }
+        reports.push_back(report);
+    }
+    {
+        KernelReport report{ "IsHitCapsuleSphere" };
+        std::vector<Capsule> capsules(SAMPLE_COUNT);
+        std::vector<Sphere> spheres(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            capsules[i] = gen.MakeCapsule();
+            spheres[i] = gen.MakeSphere();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { hits[i] = Collision_IsHitCapsuleSphere(capsules[i], spheres[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            const Vec3d center = ToVec3d(spheres[i].center);
+            const Vec3d closest = RefClosestPointSegment(center, ToVec3d(capsules[i].start), ToVec3d(capsules[i].end));
+            const double dist = Length(center - closest);
+            const double radiusSum = static_cast<double>(capsules[i].radius) + spheres[i].radius;
+            if (report.CompareHit(hits[i].isHit, dist < radiusSum, std::abs(dist - radiusSum)))
+            {
+                const Vec3d normal = (center - closest) * (1.0 / dist);
+                CompareContact(report, hits[i], radiusSum - dist, closest + normal * capsules[i].radius, normal, dist);
+            }
+        }
+        reports.push_back(report);
+    }
+    {
+        // 線分が平行に近いと最近点が一意に決まらないため、深さだけ比べる
+        KernelReport report{ "IsHitCapsuleCapsule" };
+        std::vector<Capsule> a(SAMPLE_COUNT), b(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            a[i] = gen.MakeCapsule();
+            b[i] = gen.MakeCapsule();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { hits[i] = Collision_IsHitCapsuleCapsule(a[i], b[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            const double dist = RefDistanceSegmentSegment(ToVec3d(a[i].start), ToVec3d(a[i].end), ToVec3d(b[i].start), ToVec3d(b[i].end));
+            const double radiusSum = static_cast<double>(a[i].radius) + b[i].radius;
+            if (report.CompareHit(hits[i].isHit, dist < radiusSum, std::abs(dist - radiusSum)))
+            {
+                report.AddError(hits[i].depth - (radiusSum - dist));
+            }
+        }
+        reports.push_back(report);
+    }
+
+    //--------------------------------------
+    // レイ・スイープ
+    //--------------------------------------
+    {
+        KernelReport report{ "IntersectRaySphere" };
+        std::vector<Ray> rays(SAMPLE_COUNT);
+        std::vector<Sphere> spheres(SAMPLE_COUNT);
+        std::vector<float> distances(SAMPLE_COUNT);
+        std::vector<char> results(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            rays[i] = Ray(gen.Point(), gen.Direction());
+            spheres[i] = gen.MakeSphere();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { results[i] = Collision_IntersectRaySphere(rays[i], spheres[i], &distances[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            double dist = 0.0, margin = 0.0;
+            const bool isHit = RefRaySphere(ToVec3d(rays[i].GetOrigin()), ToVec3d(rays[i].GetDirection()),
+                ToVec3d(spheres[i].center), spheres[i].radius, &dist, &margin);
+            if (report.CompareHit(results[i] != 0, isHit, margin))
+            {
+                report.AddError(distances[i] - dist);
+            }
+        }
+        reports.push_back(report);
+    }
+    {
+        KernelReport report{ "IntersectRayAABB" };
+        std::vector<Ray> rays(SAMPLE_COUNT);
+        std::vector<AABB> boxes(SAMPLE_COUNT);
+        std::vector<float> distances(SAMPLE_COUNT);
+        std::vector<char> results(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            rays[i] = Ray(gen.Point(), gen.Direction());
+            boxes[i] = gen.MakeAABB();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { results[i] = Collision_IntersectRayAABB(rays[i], boxes[i], &distances[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            double dist = 0.0, margin = 0.0;
+            const bool isHit = RefRayAABB(ToVec3d(rays[i].GetOrigin()), ToVec3d(rays[i].GetDirection()), boxes[i], &dist, &margin);
+            if (report.CompareHit(results[i] != 0, isHit, margin))
+            {
+                report.AddError(distances[i] - dist);
+            }
+        }
+        reports.push_back(report);
+    }
+    {
+        KernelReport report{ "SweepSphereSphere" };
+        std::vector<Sphere> a(SAMPLE_COUNT), b(SAMPLE_COUNT);
+        std::vector<XMFLOAT3> moveA(SAMPLE_COUNT), moveB(SAMPLE_COUNT);
+        std::vector<SweepHit> sweeps(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            a[i] = gen.MakeSphere();
+            b[i] = gen.MakeSphere();
+            moveA[i] = gen.Offset({ 0.0f, 0.0f, 0.0f });
+            moveB[i] = gen.Offset({ 0.0f, 0.0f, 0.0f });
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { sweeps[i] = Collision_SweepSphereSphere(a[i], moveA[i], b[i], moveB[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            // 相対運動 s + v t と半径の和の距離で、近づく向きのときだけ当たり
+            const Vec3d s = ToVec3d(a[i].center) - ToVec3d(b[i].center);
+            const Vec3d v = ToVec3d(moveA[i]) - ToVec3d(moveB[i]);
+            const double radiusSum = static_cast<double>(a[i].radius) + b[i].radius;
+            const double approach = Dot(s, v) / Length(v);
+
+            double margin = 0.0;
+            const double time = RefFirstContact([&](double t) { return Length(s + v * t) - radiusSum; }, 1.0, &margin);
+            margin = std::min(margin, std::abs(approach));
+            if (report.CompareHit(sweeps[i].isHit, time >= 0.0 && approach < 0.0, margin))
+            {
+                report.AddError((sweeps[i].time - time) * Length(v));
+                const Vec3d offset = s + v * time;
+                report.AddErrors(sweeps[i].normal, offset * (1.0 / Length(offset)));
+            }
+        }
+        reports.push_back(report);
+    }
+
+    {
+        KernelReport report{ "SweepSphereOBB" };
+        std::vector<Sphere> spheres(SAMPLE_COUNT);
+        std::vector<OBB> boxes(SAMPLE_COUNT);
+        std::vector<XMFLOAT3> moves(SAMPLE_COUNT);
+        std::vector<SweepHit> sweeps(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            spheres[i] = gen.MakeSphere();
+            boxes[i] = gen.MakeOBB();
+            moves[i] = gen.Offset({ 0.0f, 0.0f, 0.0f });
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { sweeps[i] = Collision_SweepSphereOBB(spheres[i], moves[i], boxes[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            const OBBd obb = ToOBBd(boxes[i]);
+            const Vec3d center = ToVec3d(spheres[i].center);
+            const Vec3d move = ToVec3d(moves[i]);
+            const double radius = spheres[i].radius;
+            const Vec3d startOffset = center - RefClosestPointOBB(center, obb);
+
+            double margin = 0.0;
+            const double time = RefFirstContact([&](double t) {
+                const Vec3d p = center + move * t;
+                return Length(p - RefClosestPointOBB(p, obb)) - radius;
+            }, 1.0, &margin);
+
+            if (time == 0.0)
+            {
+                // 開始時点で重なっていれば、最近点から離れる向きでない限り time = 0 の当たり
+                // 中心が箱の内側（最近点が定まらない）入力は面の選び方が別仕様のため除く
+                const double startDistance = Length(startOffset);
+                if (startDistance <= NOISY_DISTANCE) { ++report.skippedCount; continue; }
+                const double approach = Dot(startOffset, move) / (startDistance * Length(move));
+                if (report.CompareHit(sweeps[i].isHit, approach < 0.0, std::min(margin, std::abs(approach))))
+                {
+                    report.AddError(sweeps[i].time);
+                    report.AddErrors(sweeps[i].normal, startOffset * (1.0 / startDistance));
+                }
+                continue;
+            }
+
+            if (report.CompareHit(sweeps[i].isHit, time > 0.0, margin))
+            {
+                report.AddError((sweeps[i].time - time) * Length(move));
+                const Vec3d p = center + move * time;
+                const Vec3d offset = p - RefClosestPointOBB(p, obb);
+                if (Length(offset) > NOISY_DISTANCE)
+                {
+                    report.AddErrors(sweeps[i].normal, offset * (1.0 / Length(offset)));
+                }
+            }
+        }
+        reports.push_back(report);
+    }
+
+    //--------------------------------------
+    // 近似実装（差の報告のみ）
+    //--------------------------------------
+    {
+        KernelReport report{ "IsHitCapsuleOBB", false };
+        std::vector<Capsule> capsules(SAMPLE_COUNT);
+        std::vector<OBB> boxes(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            capsules[i] = gen.MakeCapsule();
+            boxes[i] = gen.MakeOBB();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { hits[i] = Collision_IsHitCapsuleOBB(capsules[i], boxes[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            const double dist = RefDistanceSegmentOBB(ToVec3d(capsules[i].start), ToVec3d(capsules[i].end), ToOBBd(boxes[i]));
+            const double radius = capsules[i].radius;
+            if (report.CompareHit(hits[i].isHit, dist < radius, std::abs(dist - radius)))
+            {
+                report.AddError(hits[i].depth - (radius - dist));
+            }
+        }
+        reports.push_back(report);
+    }
+    {
+        KernelReport report{ "IsHitCapsuleTriangle", false };
+        std::vector<Capsule> capsules(SAMPLE_COUNT);
+        std::vector<Triangle> triangles(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            capsules[i] = gen.MakeCapsule();
+            triangles[i] = gen.MakeTriangle();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { hits[i] = Collision_IsHitCapsuleTriangle(capsules[i], triangles[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            const double dist = RefDistanceSegmentTriangle(ToVec3d(capsules[i].start), ToVec3d(capsules[i].end), triangles[i]);
+            const double radius = capsules[i].radius;
+            if (report.CompareHit(hits[i].isHit, dist < radius, std::abs(dist - radius)))
+            {
+                report.AddError(hits[i].depth - (radius - dist));
+            }
+        }
+        reports.push_back(report);
+    }
+    {
+        KernelReport report{ "IntersectRayCapsule", false };
+        std::vector<Ray> rays(SAMPLE_COUNT);
+        std::vector<Capsule> capsules(SAMPLE_COUNT);
+        std::vector<float> distances(SAMPLE_COUNT);
+        std::vector<char> results(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            rays[i] = Ray(gen.Point(), gen.Direction());
+            capsules[i] = gen.MakeCapsule();
+        }
+        report.nsPerCall = MeasureNsPerCall([&](int i) { results[i] = Collision_IntersectRayCapsule(rays[i], capsules[i], &distances[i]); });
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            const Vec3d origin = ToVec3d(rays[i].GetOrigin());
+            const Vec3d dir = ToVec3d(rays[i].GetDirection());
+            const Vec3d start = ToVec3d(capsules[i].start);
+            const Vec3d end = ToVec3d(capsules[i].end);
+            const double radius = capsules[i].radius;
+            const double reach = Length(origin - start) + Length(end - start) + radius;
+
+            double margin = 0.0;
+            const double dist = RefFirstContact([&](double t) {
+                const Vec3d p = origin + dir * t;
+                return Length(p - RefClosestPointSegment(p, start, end)) - radius;
+            }, reach, &margin);
+            if (report.CompareHit(results[i] != 0, dist >= 0.0, margin))
+            {
+                report.AddError(distances[i] - dist);
+            }
+        }
+        reports.push_back(report);
+    }
+    //--------------------------------------
+    // 出力
+    //--------------------------------------
+    printf("[Collision] kernel benchmark (%d samples, seed %u, tolerance %.0e)\n", SAMPLE_COUNT, SEED, TOLERANCE);
+
+    int failedCount = 0;
+    for (const KernelReport& report : reports)
+    {
+        PrintReport(report);
+        if (!report.IsPassed()) ++failedCount;
+    }
+
+    printf("[Collision] kernel benchmark %s (%d failed)\n", failedCount == 0 ? "PASSED" : "FAILED", failedCount);
+    return failedCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
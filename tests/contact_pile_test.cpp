@@ -0,0 +1,249 @@
+﻿/****************************************
+ * @file    contact_pile_test.cpp
+ * @brief   球を積み上げた山での直列ソルバーと色分け並列ソルバーの照合
+ * @detail  格子状に並べた 1000 個の球を地面の上で一定ステップ進め、
+ *          色分け並列の結果が実行ごとに一致することと、最終状態のめり込み量が
+ *          許容範囲に収まることを確認する。山は崩れる途中で解く順序の差が拡大するため、
+ *          直列との位置の差は報告するだけで判定には使わない。
+ *          どれかが外れれば終了コード 1 を返す
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "contact_solver.h"
+#include "rigid_body.h"
+#include "physics_job_system.h"
+#include "collider.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace ContactPileTestConfig
+{
+    constexpr int PILE_SIZE_X = 10;                 // 山の格子（10 x 10 x 10 = 1000個）
+    constexpr int PILE_SIZE_Y = 10;
+    constexpr int PILE_SIZE_Z = 10;
+    constexpr float PILE_RADIUS = 0.25f;
+    constexpr float PILE_SPACING = 0.48f;           // 半径の2倍より狭くし、初期状態から接触させる
+    constexpr float PILE_JITTER = 0.02f;
+    constexpr int PILE_STEP_COUNT = 120;
+    constexpr float PILE_DT = 1.0f / 120.0f;
+    constexpr int PILE_VELOCITY_ITERATIONS = 4;
+    constexpr unsigned int SEED = 12345u;
+    constexpr int WORKER_THREAD_MAX = 7;
+
+    // 最終状態で許容する最大めり込み量（初期状態の重なりは 0.02）
+    constexpr float MAX_PENETRATION = 0.05f;
+}
+
+using namespace DirectX;
+using namespace ContactPileTestConfig;
+
+namespace
+{
+    struct PileResult
+    {
+        double solveMs = 0.0;
+        int maxColorCount = 0;
+        std::vector<XMFLOAT3> positions;
+    };
+
+    /**
+     * @brief 山を初期状態から PILE_STEP_COUNT ステップ進め、求解時間と最終位置を返す
+     * @detail 積分はこの山の剛体だけを手動で行う（重力以外の減衰や速度上限を含めず、ソルバーだけの挙動を見る）
+     */
+    PileResult SimulatePile(bool isParallel, const std::vector<XMFLOAT3>& initialPositions)
+    {
+        using namespace std::chrono;
+
+        const int bodyCount = static_cast<int>(initialPositions.size());
+
+        RigidBody ground;
+        ground.Initialize({ 0.0f, -0.5f, 0.0f }, Collider::CreateOBB({ 0.0f, 0.0f, 0.0f }, { 20.0f, 0.5f, 20.0f }), 0.0f);
+        RigidBody::Params groundParams = ground.GetParams();
+        groundParams.isKinematic = true;
+        groundParams.useGravity = false;
+        ground.SetParams(groundParams);
+
+        std::vector<RigidBody> bodies(bodyCount);
+        for (int i = 0; i < bodyCount; ++i)
+        {
+            bodies[i].Initialize(initialPositions[i], Collider::CreateSphere({ 0.0f, 0.0f, 0.0f }, PILE_RADIUS), 1.0f);
+        }
+
+        // マニフォールドはペア（地面は -1）ごとに保持し、ウォームスタートを引き継ぐ
+        std::map<std::pair<int, int>, ContactManifold> manifolds;
+        auto findManifold = [&](int a, int b) -> ContactManifold& {
+            ContactManifold& manifold = manifolds[{ a, b }];
+            manifold.bodyA = (a < 0) ? &ground : &bodies[a];
+            manifold.bodyB = &bodies[b];
+            return manifold;
+        };
+
+        ContactSolver solver;
+        solver.SetParallelEnabled(isParallel);
+        std::vector<ContactManifold*> active;
+        std::vector<int> sortedByX(bodyCount);
+
+        PileResult result;
+        const XMVECTOR gravityStep = XMVectorSet(0.0f, -9.81f * PILE_DT, 0.0f, 0.0f);
+
+        for (int step = 0; step < PILE_STEP_COUNT; ++step)
+        {
+            for (RigidBody& body : bodies)
+            {
+                XMFLOAT3 vel = body.GetVelocity();
+                XMFLOAT3 pos = body.GetPosition();
+                XMStoreFloat3(&vel, XMVectorAdd(XMLoadFloat3(&vel), gravityStep));
+                XMStoreFloat3(&pos, XMVectorAdd(XMLoadFloat3(&pos), XMVectorScale(XMLoadFloat3(&vel), PILE_DT)));
+                body.SetVelocity(vel);
+                body.SetPosition(pos);
+            }
+
+            // 候補ペア：x 軸のソートで距離が直径以内の組と、地面に届く球
+            for (int i = 0; i < bodyCount; ++i) sortedByX[i] = i;
+            std::sort(sortedByX.begin(), sortedByX.end(), [&](int a, int b) { return bodies[a].GetPosition().x < bodies[b].GetPosition().x; });
+            for (int i = 0; i < bodyCount; ++i)
+            {
+                const int a = sortedByX[i];
+                const XMFLOAT3 posA = bodies[a].GetPosition();
+                if (posA.y < PILE_RADIUS + ContactConfig::CONTACT_BREAKING_THRESHOLD) findManifold(-1, a);
+                for (int j = i + 1; j < bodyCount; ++j)
+                {
+                    const int b = sortedByX[j];
+                    const XMFLOAT3 posB = bodies[b].GetPosition();
+                    if (posB.x - posA.x > PILE_RADIUS * 2.0f) break;
+                    if (std::abs(posB.y - posA.y) > PILE_RADIUS * 2.0f || std::abs(posB.z - posA.z) > PILE_RADIUS * 2.0f) continue;
+                    findManifold(std::min(a, b), std::max(a, b));
+                }
+            }
+
+            active.clear();
+            for (auto& [pair, manifold] : manifolds)
+            {
+                manifold.Refresh();
+                Hit hit = Collision_Detect(manifold.bodyA->GetWorldCollider(), manifold.bodyB->GetWorldCollider());
+                if (hit.isHit)
+                {
+                    manifold.AddContact(hit);
+                }
+                if (manifold.pointCount > 0)
+                {
+                    active.push_back(&manifold);
+                }
+            }
+            if (active.empty()) continue;
+
+            auto start = high_resolution_clock::now();
+            solver.Begin(active, PILE_DT);
+            for (int iter = 0; iter < PILE_VELOCITY_ITERATIONS; ++iter)
+            {
+                solver.SolveVelocities();
+            }
+            solver.StoreVelocities();
+            solver.SolvePositions();
+            result.maxColorCount = std::max(result.maxColorCount, solver.GetColorCount());
+            solver.End();
+            result.solveMs += duration<double, std::milli>(high_resolution_clock::now() - start).count();
+        }
+
+        result.positions.resize(bodyCount);
+        for (int i = 0; i < bodyCount; ++i)
+        {
+            result.positions[i] = bodies[i].GetPosition();
+        }
+        return result;
+    }
+
+    void ComputeDrift(const PileResult& a, const PileResult& b, float& outMax, float& outMean)
+    {
+        outMax = 0.0f;
+        double sum = 0.0;
+        for (size_t i = 0; i < a.positions.size(); ++i)
+        {
+            float d = XMVectorGetX(XMVector3Length(XMVectorSubtract(XMLoadFloat3(&a.positions[i]), XMLoadFloat3(&b.positions[i]))));
+            outMax = std::max(outMax, d);
+            sum += d;
+        }
+        outMean = a.positions.empty() ? 0.0f : static_cast<float>(sum / a.positions.size());
+    }
+
+    /**
+     * @brief 最終位置での球同士・球と地面（y = 0）のめり込みの最大
+     */
+    float ComputeMaxPenetration(const PileResult& result)
+    {
+        float maxPenetration = 0.0f;
+        for (size_t i = 0; i < result.positions.size(); ++i)
+        {
+            const XMVECTOR pi = XMLoadFloat3(&result.positions[i]);
+            maxPenetration = std::max(maxPenetration, PILE_RADIUS - result.positions[i].y);
+            for (size_t j = i + 1; j < result.positions.size(); ++j)
+            {
+                const float d = XMVectorGetX(XMVector3Length(XMVectorSubtract(pi, XMLoadFloat3(&result.positions[j]))));
+                maxPenetration = std::max(maxPenetration, PILE_RADIUS * 2.0f - d);
+            }
+        }
+        return maxPenetration;
+    }
+}
+
+int main()
+{
+    const int hardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+    PhysicsJobSystem::Initialize(std::clamp(hardwareThreads - 1, 1, WORKER_THREAD_MAX));
+
+    std::mt19937 rng(SEED);
+    std::uniform_real_distribution<float> jitter(-PILE_JITTER, PILE_JITTER);
+
+    std::vector<XMFLOAT3> initialPositions;
+    initialPositions.reserve(PILE_SIZE_X * PILE_SIZE_Y * PILE_SIZE_Z);
+    for (int x = 0; x < PILE_SIZE_X; ++x)
+    for (int y = 0; y < PILE_SIZE_Y; ++y)
+    for (int z = 0; z < PILE_SIZE_Z; ++z)
+    {
+        initialPositions.push_back({
+            (x - PILE_SIZE_X * 0.5f) * PILE_SPACING + jitter(rng),
+            PILE_RADIUS + y * PILE_SPACING,
+            (z - PILE_SIZE_Z * 0.5f) * PILE_SPACING + jitter(rng) });
+    }
+
+    PileResult serial = SimulatePile(false, initialPositions);
+    PileResult parallel = SimulatePile(true, initialPositions);
+    PileResult parallelRepeat = SimulatePile(true, initialPositions);
+
+    float driftMax, driftMean, repeatMax, repeatMean;
+    ComputeDrift(serial, parallel, driftMax, driftMean);
+    ComputeDrift(parallel, parallelRepeat, repeatMax, repeatMean);
+    const float serialPenetration = ComputeMaxPenetration(serial);
+    const float parallelPenetration = ComputeMaxPenetration(parallel);
+
+    printf("[ContactSolver] pile=%d steps=%d threads=%d colors=%d\n"
+           "  serial=%.2fms parallel=%.2fms\n"
+           "  drift serial-parallel max=%.4f mean=%.4f / parallel repeat max=%.6f mean=%.6f\n"
+           "  max penetration serial=%.4f parallel=%.4f\n",
+           static_cast<int>(initialPositions.size()), PILE_STEP_COUNT, PhysicsJobSystem::GetThreadCount(), parallel.maxColorCount,
+           serial.solveMs, parallel.solveMs, driftMax, driftMean, repeatMax, repeatMean,
+           serialPenetration, parallelPenetration);
+
+    PhysicsJobSystem::Finalize();
+
+    // 同じ色の中では剛体を共有しないため、並列でも実行ごとに結果は一致する
+    const bool isDeterministic = repeatMax == 0.0f;
+    const bool isPassed = isDeterministic
+        && serialPenetration <= MAX_PENETRATION
+        && parallelPenetration <= MAX_PENETRATION;
+
+    printf("[ContactSolver] pile %s\n", isPassed ? "PASSED" : "FAILED");
+    return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,158 @@
+﻿/****************************************
+ * @file    gjk_test.cpp
+ * @brief   形状ペアごとの解析関数と GJK / EPA の照合と処理時間の比較
+ * @detail  固定シードの乱数配置で両方の判定を行い、当たり・外れの食い違いと深さの差を集計する。
+ *          解析関数が近似の組み合わせ（カプセル × OBB）は差を報告するだけで不合格にはしない。
+ *          球の中心が OBB の内側にある入力は、解析関数が深さを半径で打ち切るため深さを比べない。
+ *          厳密な組み合わせが1つでも許容範囲を外れれば終了コード 1 を返す
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "collision_gjk.h"
+#include "collider.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace GJKTestConfig
+{
+    constexpr int SAMPLE_COUNT = 20000;
+    constexpr unsigned int SEED = 12345u;
+    constexpr float SPREAD = 1.5f;              // 形状中心を配置する範囲（半分程度が重なる）
+
+    // 当たり・外れの食い違いの許容数（境界すれすれの入力は丸めで分かれうる）
+    constexpr int MAX_MISMATCH = 10;
+    // 深さの差の許容値
+    constexpr float DEPTH_TOLERANCE = 1e-3f;
+}
+
+using namespace DirectX;
+using namespace GJKTestConfig;
+
+namespace
+{
+    Collider MakeRandomCollider(ColliderType type, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> pos(-SPREAD, SPREAD);
+        std::uniform_real_distribution<float> size(0.3f, 1.0f);
+        std::uniform_real_distribution<float> angle(-XM_PI, XM_PI);
+
+        XMFLOAT3 center = { pos(rng), pos(rng), pos(rng) };
+        XMFLOAT4 rotation;
+        XMStoreFloat4(&rotation, XMQuaternionRotationRollPitchYaw(angle(rng), angle(rng), angle(rng)));
+
+        switch (type)
+        {
+            case ColliderType::Box:
+                return Collider::CreateOBB(center, { size(rng), size(rng), size(rng) }, rotation);
+
+            case ColliderType::Capsule:
+            {
+                XMFLOAT3 halfAxis;
+                XMStoreFloat3(&halfAxis, XMVector3Rotate(XMVectorSet(0.0f, size(rng), 0.0f, 0.0f), XMLoadFloat4(&rotation)));
+                return Collider::CreateCapsule(
+                    { center.x - halfAxis.x, center.y - halfAxis.y, center.z - halfAxis.z },
+                    { center.x + halfAxis.x, center.y + halfAxis.y, center.z + halfAxis.z },
+                    size(rng) * 0.5f);
+            }
+
+            case ColliderType::Sphere:
+            default:
+                return Collider::CreateSphere(center, size(rng));
+        }
+    }
+
+    bool IsInsideOBB(const XMFLOAT3& point, const OBB& obb)
+    {
+        XMFLOAT3 local;
+        XMStoreFloat3(&local, XMVector3InverseRotate(XMLoadFloat3(&point) - XMLoadFloat3(&obb.center), XMLoadFloat4(&obb.orientation)));
+        return std::abs(local.x) <= obb.extents.x && std::abs(local.y) <= obb.extents.y && std::abs(local.z) <= obb.extents.z;
+    }
+
+    /**
+     * @brief 解析関数の深さが定義どおり（最小押し出し量）になる入力か
+     */
+    bool IsDepthComparable(const Collider& a, const Collider& b)
+    {
+        if (a.type == ColliderType::Sphere && b.type == ColliderType::Box) return !IsInsideOBB(a.sphere.center, b.obb);
+        if (a.type == ColliderType::Box && b.type == ColliderType::Sphere) return !IsInsideOBB(b.sphere.center, a.obb);
+        return true;
+    }
+
+    /**
+     * @brief 1組の形状ペアを計測・照合して結果を出力
+     * @param isExact false なら解析関数は近似（差は報告のみ）
+     * @return 許容範囲内（または近似）なら true
+     */
+    bool RunPair(ColliderType typeA, ColliderType typeB, bool isExact)
+    {
+        using namespace std::chrono;
+
+        std::mt19937 rng(SEED);
+        std::vector<Collider> collidersA(SAMPLE_COUNT);
+        std::vector<Collider> collidersB(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            collidersA[i] = MakeRandomCollider(typeA, rng);
+            collidersB[i] = MakeRandomCollider(typeB, rng);
+        }
+
+        std::vector<Hit> analytic(SAMPLE_COUNT);
+        std::vector<Hit> gjk(SAMPLE_COUNT);
+
+        auto start = high_resolution_clock::now();
+        for (int i = 0; i < SAMPLE_COUNT; ++i) analytic[i] = Collision_Detect(collidersA[i], collidersB[i]);
+        auto middle = high_resolution_clock::now();
+        for (int i = 0; i < SAMPLE_COUNT; ++i) gjk[i] = Collision_DetectGJK(collidersA[i], collidersB[i]);
+        auto end = high_resolution_clock::now();
+
+        int hitCount = 0;
+        int mismatchCount = 0;
+        int skippedCount = 0;
+        float maxDepthError = 0.0f;
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            if (analytic[i].isHit != gjk[i].isHit) { ++mismatchCount; continue; }
+            if (!analytic[i].isHit) continue;
+            ++hitCount;
+            if (!IsDepthComparable(collidersA[i], collidersB[i])) { ++skippedCount; continue; }
+            maxDepthError = std::max(maxDepthError, std::abs(analytic[i].depth - gjk[i].depth));
+        }
+
+        const double analyticNs = duration<double, std::nano>(middle - start).count() / SAMPLE_COUNT;
+        const double gjkNs = duration<double, std::nano>(end - middle).count() / SAMPLE_COUNT;
+        const bool isPassed = !isExact || (mismatchCount <= MAX_MISMATCH && maxDepthError <= DEPTH_TOLERANCE);
+
+        Collider nameA; nameA.type = typeA;
+        Collider nameB; nameB.type = typeB;
+        printf("  %-9s vs %-9s analytic=%7.1fns gjk=%7.1fns hits=%5d mismatch=%4d skipped=%4d maxDepthError=%.4f %s\n",
+               nameA.GetTypeName(), nameB.GetTypeName(), analyticNs, gjkNs, hitCount, mismatchCount, skippedCount, maxDepthError,
+               !isExact ? "approx" : (isPassed ? "ok" : "FAIL"));
+        return isPassed;
+    }
+}
+
+int main()
+{
+    printf("[Collision] analytic vs GJK/EPA (%d samples per pair)\n", SAMPLE_COUNT);
+
+    int failedCount = 0;
+    if (!RunPair(ColliderType::Sphere, ColliderType::Sphere, true)) ++failedCount;
+    if (!RunPair(ColliderType::Sphere, ColliderType::Box, true)) ++failedCount;
+    if (!RunPair(ColliderType::Box, ColliderType::Box, true)) ++failedCount;
+    if (!RunPair(ColliderType::Capsule, ColliderType::Sphere, true)) ++failedCount;
+    if (!RunPair(ColliderType::Capsule, ColliderType::Capsule, true)) ++failedCount;
+    if (!RunPair(ColliderType::Capsule, ColliderType::Box, false)) ++failedCount;
+
+    printf("[Collision] analytic vs GJK/EPA %s (%d failed)\n", failedCount == 0 ? "PASSED" : "FAILED", failedCount);
+    return failedCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
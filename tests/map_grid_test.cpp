@@ -0,0 +1,257 @@
+﻿/****************************************
+ * @file    map_grid_test.cpp
+ * @brief   マップのグリッド問い合わせと総当たりの照合
+ * @detail  ステージの壁（StageConfig::WALL_LAYOUTS）と、焼き込み破片と同程度の大きさの箱を
+ *          プレイエリアに固定シードで散らしてグリッドを構築し、
+ *          AABB の問い合わせ結果とレイの最初の交差を総当たりと比べる。
+ *          一括構築のほか、破片を後から差し込んだ場合と種別除去で添字を振り直した場合も照合する。
+ *          1件でも食い違えば終了コード 1 を返す
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "map_grid.h"
+#include "stage.h"
+#include "ray.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace MapGridTestConfig
+{
+    constexpr int DEBRIS_COUNT = 2000;          // 壁以外に置く箱の数
+    constexpr float DEBRIS_MIN_SIZE = 0.2f;     // 焼き込み破片の大きさの範囲
+    constexpr float DEBRIS_MAX_SIZE = 2.0f;
+    constexpr float DEBRIS_MAX_HEIGHT = 3.0f;
+    constexpr int QUERY_COUNT = 20000;
+    constexpr float QUERY_MAX_SIZE = 8.0f;
+    constexpr int RAY_COUNT = 5000;
+    constexpr float RAY_MAX_DISTANCE = 200.0f;
+    constexpr int INSERT_BATCH = 16;            // 焼き込みで一度に追加する破片の数
+    constexpr int REMOVE_INTERVAL = 3;          // 除去の確認でこの間隔の破片を取り除く
+    constexpr unsigned int SEED = 12345u;
+}
+
+using namespace DirectX;
+using namespace MapGridTestConfig;
+
+namespace
+{
+    AABB MakeBox(const XMFLOAT3& center, const XMFLOAT3& size)
+    {
+        AABB box;
+        box.min = { center.x - size.x * 0.5f, center.y - size.y * 0.5f, center.z - size.z * 0.5f };
+        box.max = { center.x + size.x * 0.5f, center.y + size.y * 0.5f, center.z + size.z * 0.5f };
+        return box;
+    }
+
+    /**
+     * @brief Map_QueryAABB と同じ手順でグリッドから重なる物体を集める
+     */
+    void QueryGrid(const MapGrid& grid, const std::vector<AABB>& objects, const AABB& query, std::vector<int>& out)
+    {
+        out.clear();
+        grid.VisitAABB(query, [&](int index)
+        {
+            if (Collision_IsOverlapAABB(query, objects[index])) out.push_back(index);
+        });
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+
+    /**
+     * @brief Map_Raycast と同じ規則（同距離なら添字の小さい方）で最初に交差する物体を返す
+     */
+    int RaycastGrid(const MapGrid& grid, const std::vector<AABB>& objects, const Ray& ray, float& outDist)
+    {
+        float bestDist = RAY_MAX_DISTANCE;
+        int bestIndex = -1;
+        grid.VisitRay(ray, RAY_MAX_DISTANCE, [&](int index)
+        {
+            float dist = 0.0f;
+            if (!Collision_IntersectRayAABB(ray, objects[index], &dist) || dist > bestDist) return bestDist;
+            if (dist < bestDist || bestIndex < 0 || index < bestIndex)
+            {
+                bestDist = dist;
+                bestIndex = index;
+            }
+            return bestDist;
+        });
+        outDist = bestDist;
+        return bestIndex;
+    }
+
+    int RaycastBruteForce(const std::vector<AABB>& objects, const Ray& ray, float& outDist)
+    {
+        float bestDist = RAY_MAX_DISTANCE;
+        int bestIndex = -1;
+        for (int i = 0; i < static_cast<int>(objects.size()); ++i)
+        {
+            float dist = 0.0f;
+            if (!Collision_IntersectRayAABB(ray, objects[i], &dist) || dist > bestDist) continue;
+            if (dist < bestDist || bestIndex < 0)
+            {
+                bestDist = dist;
+                bestIndex = i;
+            }
+        }
+        outDist = bestDist;
+        return bestIndex;
+    }
+
+    /**
+     * @brief AABB の問い合わせとレイの最初の交差を総当たりと比べ、食い違いの数を返す
+     */
+    int CheckAgainstBruteForce(const char* label, const MapGrid& grid, const std::vector<AABB>& objects, std::mt19937& rng)
+    {
+        using namespace std::chrono;
+        using namespace StageConfig;
+
+        std::uniform_real_distribution<float> areaX(PLAY_AREA_MIN_X, PLAY_AREA_MAX_X);
+        std::uniform_real_distribution<float> areaZ(PLAY_AREA_MIN_Z, PLAY_AREA_MAX_Z);
+        std::uniform_real_distribution<float> height(0.0f, DEBRIS_MAX_HEIGHT);
+        std::uniform_real_distribution<float> querySize(0.0f, QUERY_MAX_SIZE);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+        printf("  [%s] objects=%d cells=%d large=%d\n",
+               label, static_cast<int>(objects.size()), grid.GetCellCount(), grid.GetLargeObjectCount());
+
+        //--------------------------------------
+        // AABB の問い合わせ
+        //--------------------------------------
+        std::vector<AABB> queries(QUERY_COUNT);
+        for (AABB& query : queries)
+        {
+            // 一部は壁をまたぐようにプレイエリアの外側まで散らす
+            const XMFLOAT3 center = { areaX(rng) * 1.1f, height(rng), areaZ(rng) * 1.1f };
+            query = MakeBox(center, { querySize(rng), querySize(rng), querySize(rng) });
+        }
+
+        std::vector<int> gridResult, bruteResult;
+        int queryMismatch = 0;
+        long long hitTotal = 0;
+        double gridMs = 0.0, bruteMs = 0.0;
+        for (const AABB& query : queries)
+        {
+            auto start = high_resolution_clock::now();
+            QueryGrid(grid, objects, query, gridResult);
+            gridMs += duration<double, std::milli>(high_resolution_clock::now() - start).count();
+
+            start = high_resolution_clock::now();
+            bruteResult.clear();
+            for (int i = 0; i < static_cast<int>(objects.size()); ++i)
+            {
+                if (Collision_IsOverlapAABB(query, objects[i])) bruteResult.push_back(i);
+            }
+            bruteMs += duration<double, std::milli>(high_resolution_clock::now() - start).count();
+
+            if (gridResult != bruteResult) ++queryMismatch;
+            hitTotal += static_cast<long long>(bruteResult.size());
+        }
+        printf("    aabb queries=%d hits=%lld grid=%.2fms brute=%.2fms mismatch=%d %s\n",
+               QUERY_COUNT, hitTotal, gridMs, bruteMs, queryMismatch, queryMismatch == 0 ? "ok" : "FAIL");
+
+        //--------------------------------------
+        // レイの最初の交差
+        //--------------------------------------
+        int rayMismatch = 0;
+        int rayHits = 0;
+        for (int i = 0; i < RAY_COUNT; ++i)
+        {
+            const XMFLOAT3 origin = { areaX(rng), height(rng), areaZ(rng) };
+            XMFLOAT3 dir;
+            XMStoreFloat3(&dir, XMVector3Normalize(XMVectorSet(unit(rng), unit(rng) * 0.3f, unit(rng), 0.0f)));
+            const Ray ray(origin, dir);
+
+            float gridDist = 0.0f, bruteDist = 0.0f;
+            const int gridIndex = RaycastGrid(grid, objects, ray, gridDist);
+            const int bruteIndex = RaycastBruteForce(objects, ray, bruteDist);
+            if (gridIndex != bruteIndex || gridDist != bruteDist) ++rayMismatch;
+            if (bruteIndex >= 0) ++rayHits;
+        }
+        printf("    rays=%d hits=%d mismatch=%d %s\n", RAY_COUNT, rayHits, rayMismatch, rayMismatch == 0 ? "ok" : "FAIL");
+
+        return queryMismatch + rayMismatch;
+    }
+}
+
+int main()
+{
+    using namespace StageConfig;
+
+    std::mt19937 rng(SEED);
+    std::uniform_real_distribution<float> areaX(PLAY_AREA_MIN_X, PLAY_AREA_MAX_X);
+    std::uniform_real_distribution<float> areaZ(PLAY_AREA_MIN_Z, PLAY_AREA_MAX_Z);
+    std::uniform_real_distribution<float> height(0.0f, DEBRIS_MAX_HEIGHT);
+    std::uniform_real_distribution<float> debrisSize(DEBRIS_MIN_SIZE, DEBRIS_MAX_SIZE);
+
+    // ステージの壁（巨大な物体としてグリッド外に入る）と、散らばった破片
+    std::vector<AABB> objects;
+    for (const WallLayout& layout : WALL_LAYOUTS)
+    {
+        objects.push_back(MakeBox(layout.center, layout.size));
+    }
+    const int wallCount = static_cast<int>(objects.size());
+    for (int i = 0; i < DEBRIS_COUNT; ++i)
+    {
+        const float size = debrisSize(rng);
+        objects.push_back(MakeBox({ areaX(rng), height(rng), areaZ(rng) }, { size, size * 0.5f, size }));
+    }
+
+    printf("[MapGrid] walls=%d debris=%d\n", wallCount, DEBRIS_COUNT);
+    int mismatch = 0;
+
+    // 一括構築
+    MapGrid grid;
+    grid.Build(objects);
+    mismatch += CheckAgainstBruteForce("build", grid, objects, rng);
+
+    // 壁だけで構築し、破片を焼き込みと同じ単位で差し込む（Map_AddObjects と同じく、差し込めなければ作り直す）
+    std::vector<AABB> inserted(objects.begin(), objects.begin() + wallCount);
+    MapGrid incremental;
+    incremental.Build(inserted);
+    int rebuildCount = 0;
+    for (int first = wallCount; first < static_cast<int>(objects.size()); first += INSERT_BATCH)
+    {
+        const int last = std::min(first + INSERT_BATCH, static_cast<int>(objects.size()));
+        inserted.insert(inserted.end(), objects.begin() + first, objects.begin() + last);
+
+        bool isInserted = true;
+        for (int i = first; i < last && isInserted; ++i)
+        {
+            isInserted = incremental.Insert(i, inserted[i]);
+        }
+        if (!isInserted || incremental.ShouldRebuild())
+        {
+            incremental.Build(inserted);
+            ++rebuildCount;
+        }
+    }
+    printf("  insert batches=%d rebuilds=%d\n", (DEBRIS_COUNT + INSERT_BATCH - 1) / INSERT_BATCH, rebuildCount);
+    mismatch += CheckAgainstBruteForce("insert", incremental, inserted, rng);
+
+    // 一部の破片を除去し、Map_RemoveObjectsByKind と同じく並び順を保って詰める
+    std::vector<int> oldToNew(inserted.size(), -1);
+    std::vector<AABB> remaining;
+    for (int i = 0; i < static_cast<int>(inserted.size()); ++i)
+    {
+        if (i >= wallCount && (i - wallCount) % REMOVE_INTERVAL == 0) continue;
+
+        oldToNew[i] = static_cast<int>(remaining.size());
+        remaining.push_back(inserted[i]);
+    }
+    incremental.RemapIndices(oldToNew);
+    mismatch += CheckAgainstBruteForce("remove", incremental, remaining, rng);
+
+    const bool isPassed = mismatch == 0;
+    printf("[MapGrid] %s\n", isPassed ? "PASSED" : "FAILED");
+    return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
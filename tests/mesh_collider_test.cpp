@@ -0,0 +1,361 @@
+﻿/****************************************
+ * @file    mesh_collider_test.cpp
+ * @brief   三角形メッシュコライダーの BVH と総当たりの照合、ステージの壁の判定の確認
+ * @detail  凹凸をつけた球のメッシュに球・カプセル・OBB・レイを問い合わせ、
+ *          BVH と葉1つだけの木（総当たり）で接触の有無と最深の深さ・交差距離を比べる。
+ *          あわせてステージの壁（StageConfig::WALL_LAYOUTS）を箱のメッシュにし、
+ *          プレイエリア側から触れる球の押し出しが解析解（球 × OBB）と一致することを確かめる。
+ *          どれかが外れれば終了コード 1 を返す
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "mesh_collider.h"
+#include "collider.h"
+#include "stage.h"
+#include "ray.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace MeshColliderTestConfig
+{
+    constexpr int SPHERE_RINGS = 96;            // 凹凸球の緯度方向の分割数
+    constexpr int SPHERE_SEGMENTS = 192;        // 経度方向の分割数
+    constexpr float SPHERE_RADIUS = 10.0f;
+    constexpr int QUERY_COUNT = 2000;           // 形状ごとの問い合わせ数
+    constexpr int WALL_QUERY_COUNT = 500;       // 壁1枚あたりの問い合わせ数
+    constexpr unsigned int SEED = 12345u;
+
+    // BVH は総当たりと同じ三角形を調べるため、食い違いは許さない
+    constexpr int MAX_MISMATCH = 0;
+    // 最深の深さ・交差距離の差の許容値
+    constexpr float MAX_DEPTH_ERROR = 1e-4f;
+    // 壁の押し出しの深さ・法線の差の許容値
+    constexpr float MAX_WALL_ERROR = 1e-3f;
+}
+
+using namespace DirectX;
+using namespace MeshColliderTestConfig;
+
+namespace
+{
+    struct CompareResult
+    {
+        double usPerQuery = 0.0;
+        int hitCount = 0;
+        int mismatchCount = 0;
+        float maxDepthError = 0.0f;
+    };
+
+    // 表面に凹凸をつけた球（外向きが表）
+    std::vector<Triangle> CreateBumpySphere()
+    {
+        auto vertex = [](int ring, int segment)
+        {
+            const float theta = XM_PI * ring / SPHERE_RINGS;
+            const float phi = XM_2PI * segment / SPHERE_SEGMENTS;
+            const float radius = SPHERE_RADIUS * (1.0f + 0.05f * std::sin(theta * 7.0f) * std::cos(phi * 5.0f));
+            return XMFLOAT3{ radius * std::sin(theta) * std::cos(phi), radius * std::cos(theta), radius * std::sin(theta) * std::sin(phi) };
+        };
+
+        std::vector<Triangle> triangles;
+        triangles.reserve(static_cast<size_t>(SPHERE_RINGS) * SPHERE_SEGMENTS * 2);
+        for (int r = 0; r < SPHERE_RINGS; ++r)
+        {
+            for (int s = 0; s < SPHERE_SEGMENTS; ++s)
+            {
+                const XMFLOAT3 a = vertex(r, s);
+                const XMFLOAT3 b = vertex(r, s + 1);
+                const XMFLOAT3 c = vertex(r + 1, s);
+                const XMFLOAT3 d = vertex(r + 1, s + 1);
+
+                // (p1-p0)×(p2-p0) が外向きになる巻き順
+                triangles.push_back({ a, b, c, {} });
+                triangles.push_back({ b, d, c, {} });
+            }
+        }
+        return triangles;
+    }
+
+    // 軸に沿った箱の12枚の三角形（外向きが表。BOXモデルを拡大して置いた壁と同じ形）
+    std::vector<Triangle> CreateBox(const XMFLOAT3& center, const XMFLOAT3& size)
+    {
+        auto corner = [&](int i)
+        {
+            return XMFLOAT3{
+                center.x + size.x * ((i & 1) ? 0.5f : -0.5f),
+                center.y + size.y * ((i & 2) ? 0.5f : -0.5f),
+                center.z + size.z * ((i & 4) ? 0.5f : -0.5f) };
+        };
+
+        // 各面の4隅（外から見て反時計回り）
+        static constexpr int FACES[6][4] = {
+            { 1, 3, 7, 5 }, { 0, 4, 6, 2 },     // +X, -X
+            { 2, 6, 7, 3 }, { 0, 1, 5, 4 },     // +Y, -Y
+            { 4, 5, 7, 6 }, { 0, 2, 3, 1 },     // +Z, -Z
+        };
+
+        std::vector<Triangle> triangles;
+        for (const auto& face : FACES)
+        {
+            triangles.push_back({ corner(face[0]), corner(face[1]), corner(face[2]), {} });
+            triangles.push_back({ corner(face[0]), corner(face[2]), corner(face[3]), {} });
+        }
+        return triangles;
+    }
+
+    const Hit* Deepest(const Hit* hits, int count)
+    {
+        const Hit* deepest = nullptr;
+        for (int i = 0; i < count; ++i)
+        {
+            if (!deepest || hits[i].depth > deepest->depth) deepest = &hits[i];
+        }
+        return deepest;
+    }
+
+    float DeepestDepth(const Hit* hits, int count)
+    {
+        const Hit* deepest = Deepest(hits, count);
+        return deepest ? deepest->depth : 0.0f;
+    }
+
+    /**
+     * @brief 結果を出力
+     * @return 許容範囲内なら true
+     */
+    bool PrintResult(const char* name, const CompareResult& bvh, const CompareResult& brute)
+    {
+        const bool isPassed = bvh.mismatchCount <= MAX_MISMATCH && bvh.maxDepthError <= MAX_DEPTH_ERROR;
+        printf("  %-8s bvh %8.2fus brute %8.2fus (x%.1f) hits=%5d mismatch=%4d maxDepthError=%.6f %s\n",
+               name, bvh.usPerQuery, brute.usPerQuery, brute.usPerQuery / std::max(bvh.usPerQuery, 1e-6),
+               bvh.hitCount, bvh.mismatchCount, bvh.maxDepthError, isPassed ? "ok" : "FAIL");
+        return isPassed;
+    }
+
+    /**
+     * @brief 凹凸球で BVH と総当たりを比べる
+     * @return 不合格の項目数
+     */
+    int RunBumpySphere(std::mt19937& rng)
+    {
+        using namespace std::chrono;
+
+        const std::vector<Triangle> triangles = CreateBumpySphere();
+
+        // 総当たりの基準は葉1つだけの木（根の境界の後は全三角形を調べる）
+        auto start = high_resolution_clock::now();
+        MeshCollider bvh;
+        bvh.Build(triangles);
+        const double buildMs = duration<double, std::milli>(high_resolution_clock::now() - start).count();
+
+        MeshCollider brute;
+        brute.Build(triangles, static_cast<int>(triangles.size()));
+
+        printf("[MeshCollider] %d triangles, %d nodes, build %.2fms, %d queries per shape\n",
+               bvh.GetTriangleCount(), bvh.GetNodeCount(), buildMs, QUERY_COUNT);
+
+        // 問い合わせは表面付近に集める（半分程度が接触する）
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> shell(SPHERE_RADIUS * 0.85f, SPHERE_RADIUS * 1.15f);
+        std::uniform_real_distribution<float> size(0.2f, 1.0f);
+        std::uniform_real_distribution<float> angle(-XM_PI, XM_PI);
+
+        auto randomPoint = [&]()
+        {
+            XMFLOAT3 p;
+            XMStoreFloat3(&p, XMVectorScale(XMVector3Normalize(XMVectorSet(unit(rng), unit(rng), unit(rng), 0.0f)), shell(rng)));
+            return p;
+        };
+
+        std::vector<Collider> colliders;
+        colliders.reserve(QUERY_COUNT * 3);
+        for (int i = 0; i < QUERY_COUNT; ++i)
+        {
+            colliders.push_back(Collider::CreateSphere(randomPoint(), size(rng)));
+        }
+        for (int i = 0; i < QUERY_COUNT; ++i)
+        {
+            const XMFLOAT3 center = randomPoint();
+            const XMFLOAT3 offset = { unit(rng), unit(rng), unit(rng) };
+            Collider col;
+            col.type = ColliderType::Capsule;
+            col.capsule = Capsule({ center.x - offset.x, center.y - offset.y, center.z - offset.z },
+                                  { center.x + offset.x, center.y + offset.y, center.z + offset.z }, size(rng) * 0.5f);
+            colliders.push_back(col);
+        }
+        for (int i = 0; i < QUERY_COUNT; ++i)
+        {
+            Collider col;
+            col.type = ColliderType::Box;
+            col.obb.center = randomPoint();
+            col.obb.extents = { size(rng), size(rng), size(rng) };
+            XMStoreFloat4(&col.obb.orientation, XMQuaternionRotationRollPitchYaw(angle(rng), angle(rng), angle(rng)));
+            colliders.push_back(col);
+        }
+
+        // 接触の有無と最深の深さを比べる（接触の並びは走査順で変わるため比べない）
+        constexpr int MAX_HITS = MeshColliderConfig::MAX_CONTACTS;
+        std::vector<int> bruteCounts(colliders.size());
+        std::vector<float> bruteDepths(colliders.size());
+        Hit hits[MAX_HITS];
+        int failedCount = 0;
+
+        const char* names[3] = { "sphere", "capsule", "obb" };
+        for (int shape = 0; shape < 3; ++shape)
+        {
+            const int begin = shape * QUERY_COUNT;
+            const int end = begin + QUERY_COUNT;
+            CompareResult bruteResult, bvhResult;
+
+            start = high_resolution_clock::now();
+            for (int i = begin; i < end; ++i)
+            {
+                bruteCounts[i] = brute.Collide(colliders[i], hits, MAX_HITS);
+                bruteDepths[i] = DeepestDepth(hits, bruteCounts[i]);
+            }
+            bruteResult.usPerQuery = duration<double, std::micro>(high_resolution_clock::now() - start).count() / QUERY_COUNT;
+
+            start = high_resolution_clock::now();
+            for (int i = begin; i < end; ++i)
+            {
+                const int count = bvh.Collide(colliders[i], hits, MAX_HITS);
+                if ((count > 0) != (bruteCounts[i] > 0)) { ++bvhResult.mismatchCount; continue; }
+                if (count == 0) continue;
+                ++bvhResult.hitCount;
+                bvhResult.maxDepthError = std::max(bvhResult.maxDepthError, std::abs(DeepestDepth(hits, count) - bruteDepths[i]));
+            }
+            bvhResult.usPerQuery = duration<double, std::micro>(high_resolution_clock::now() - start).count() / QUERY_COUNT;
+
+            if (!PrintResult(names[shape], bvhResult, bruteResult)) ++failedCount;
+        }
+
+        // レイ：球の外から中心付近へ向けて飛ばす
+        CompareResult bruteRay, bvhRay;
+        std::vector<Ray> rays;
+        rays.reserve(QUERY_COUNT);
+        for (int i = 0; i < QUERY_COUNT; ++i)
+        {
+            XMFLOAT3 origin, dir;
+            XMStoreFloat3(&origin, XMVectorScale(XMVector3Normalize(XMVectorSet(unit(rng), unit(rng), unit(rng), 0.0f)), SPHERE_RADIUS * 2.0f));
+            XMStoreFloat3(&dir, XMVector3Normalize(XMVectorSubtract(XMVectorSet(unit(rng) * 3.0f, unit(rng) * 3.0f, unit(rng) * 3.0f, 0.0f), XMLoadFloat3(&origin))));
+            rays.emplace_back(origin, dir);
+        }
+
+        std::vector<float> bruteDists(rays.size(), -1.0f);
+        start = high_resolution_clock::now();
+        for (size_t i = 0; i < rays.size(); ++i)
+        {
+            float dist = 0.0f;
+            if (brute.Raycast(rays[i], FLT_MAX, &dist)) bruteDists[i] = dist;
+        }
+        bruteRay.usPerQuery = duration<double, std::micro>(high_resolution_clock::now() - start).count() / QUERY_COUNT;
+
+        start = high_resolution_clock::now();
+        for (size_t i = 0; i < rays.size(); ++i)
+        {
+            float dist = 0.0f;
+            const bool isHit = bvh.Raycast(rays[i], FLT_MAX, &dist);
+            if (isHit != (bruteDists[i] >= 0.0f)) { ++bvhRay.mismatchCount; continue; }
+            if (!isHit) continue;
+            ++bvhRay.hitCount;
+            bvhRay.maxDepthError = std::max(bvhRay.maxDepthError, std::abs(dist - bruteDists[i]));
+        }
+        bvhRay.usPerQuery = duration<double, std::micro>(high_resolution_clock::now() - start).count() / QUERY_COUNT;
+
+        if (!PrintResult("ray", bvhRay, bruteRay)) ++failedCount;
+        return failedCount;
+    }
+
+    /**
+     * @brief ステージの壁のメッシュに内側から触れる球を、球 × OBB の解析解と比べる
+     * @return 不合格の項目数
+     */
+    int RunStageWalls(std::mt19937& rng)
+    {
+        using namespace StageConfig;
+
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::uniform_real_distribution<float> radius(0.3f, 1.5f);
+
+        int hitCount = 0;
+        int mismatchCount = 0;
+        float maxError = 0.0f;
+        Hit hits[MeshColliderConfig::MAX_CONTACTS];
+
+        for (const WallLayout& layout : WALL_LAYOUTS)
+        {
+            MeshCollider wall;
+            wall.Build(CreateBox(layout.center, layout.size));
+
+            Collider box;
+            box.type = ColliderType::Box;
+            box.obb.center = layout.center;
+            box.obb.extents = { layout.size.x * 0.5f, layout.size.y * 0.5f, layout.size.z * 0.5f };
+            XMStoreFloat4(&box.obb.orientation, XMQuaternionIdentity());
+
+            // 壁の薄い軸がプレイエリアを向く面。面の内側（辺から離れた所）に球を置く
+            const int thinAxis = (layout.size.x < layout.size.z) ? 0 : 2;
+            const float center[3] = { layout.center.x, layout.center.y, layout.center.z };
+            const float size[3] = { layout.size.x, layout.size.y, layout.size.z };
+            const float inward = (center[thinAxis] > 0.0f) ? -1.0f : 1.0f;
+
+            for (int i = 0; i < WALL_QUERY_COUNT; ++i)
+            {
+                const float r = radius(rng);
+                float p[3];
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    const float margin = r + 0.5f;
+                    p[axis] = center[axis] - size[axis] * 0.5f + margin + unit(rng) * (size[axis] - margin * 2.0f);
+                }
+                // 中心は面の外側で、面からの距離は r 未満（中心が箱の内側だと解析関数は最短の軸を選ばない）
+                p[thinAxis] = center[thinAxis] + inward * (size[thinAxis] * 0.5f + (0.05f + unit(rng) * 0.9f) * r);
+
+                const Collider sphere = Collider::CreateSphere({ p[0], p[1], p[2] }, r);
+                const Hit reference = Collision_Detect(sphere, box);
+                const int count = wall.Collide(sphere, hits, MeshColliderConfig::MAX_CONTACTS);
+                const Hit* deepest = Deepest(hits, count);
+
+                if ((deepest != nullptr) != reference.isHit) { ++mismatchCount; continue; }
+                if (!deepest) continue;
+                ++hitCount;
+
+                const float errors[4] = {
+                    deepest->depth - reference.depth,
+                    deepest->normal.x - reference.normal.x, deepest->normal.y - reference.normal.y, deepest->normal.z - reference.normal.z,
+                };
+                for (float error : errors)
+                {
+                    maxError = std::max(maxError, std::abs(error));
+                }
+            }
+        }
+
+        const bool isPassed = mismatchCount <= MAX_MISMATCH && maxError <= MAX_WALL_ERROR;
+        printf("  %-8s walls=%d hits=%5d mismatch=%4d maxError=%.6f %s\n",
+               "walls", static_cast<int>(std::size(WALL_LAYOUTS)), hitCount, mismatchCount, maxError, isPassed ? "ok" : "FAIL");
+        return isPassed ? 0 : 1;
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(SEED);
+
+    int failedCount = RunBumpySphere(rng);
+    failedCount += RunStageWalls(rng);
+
+    printf("[MeshCollider] %s (%d failed)\n", failedCount == 0 ? "PASSED" : "FAILED", failedCount);
+    return failedCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
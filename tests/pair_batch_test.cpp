@@ -0,0 +1,210 @@
+﻿/****************************************
+ * @file    pair_batch_test.cpp
+ * @brief   スカラー版と組み合わせ別バッチ版（SoA）の詳細判定の照合と処理時間の比較
+ * @detail  固定シードで配置した球 × 球、球 × OBB の組を Collision_Detect で判定して基準とし、
+ *          WIDTH 組ずつ詰めたバッチ判定の結果と深さ・法線・接触点を比べる。
+ *          当たり・外れの食い違いか成分ごとの差が許容範囲を外れれば終了コード 1 を返す
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "collision_batch.h"
+#include "collider.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace PairBatchTestConfig
+{
+    constexpr int PAIR_COUNT = 65536;
+    constexpr float SPREAD = 4.0f;              // 組の相手を置く範囲（半分程度が当たる）
+    constexpr unsigned int SEED = 12345u;
+
+    // 最近点がほぼ中心に重なると法線は丸め誤差の向きになるため、この範囲は深さだけ比べる
+    constexpr float NOISY_DISTANCE = 1e-4f;
+
+    // 当たり・外れの食い違いの許容数（表面すれすれの組は丸めで分かれうる）
+    constexpr int MAX_MISMATCH = 4;
+    // 深さ・法線・接触点の成分ごとの差の許容値
+    constexpr float MAX_ERROR = 1e-3f;
+}
+
+using namespace DirectX;
+using namespace CollisionPacketConfig;
+using namespace PairBatchTestConfig;
+
+namespace
+{
+    struct CompareResult
+    {
+        double nsPerPair = 0.0;
+        int hitCount = 0;
+        int mismatchCount = 0;
+        float maxError = 0.0f;      // 深さ・法線・接触点の成分ごとの差の最大
+    };
+
+    /**
+     * @param fullDepth 組ごとの距離 0 のときの深さ（これとの差が最近点までの距離）
+     */
+    void Compare(const std::vector<Hit>& reference, const std::vector<Hit>& batch, const std::vector<float>& fullDepth, CompareResult& result)
+    {
+        for (size_t i = 0; i < reference.size(); ++i)
+        {
+            if (reference[i].isHit != batch[i].isHit) { ++result.mismatchCount; continue; }
+            if (!reference[i].isHit) continue;
+            ++result.hitCount;
+
+            const Hit& a = reference[i];
+            const Hit& b = batch[i];
+            if (fullDepth[i] - a.depth < NOISY_DISTANCE)
+            {
+                result.maxError = std::max(result.maxError, std::abs(a.depth - b.depth));
+                continue;
+            }
+
+            const float errors[7] = {
+                a.depth - b.depth,
+                a.normal.x - b.normal.x, a.normal.y - b.normal.y, a.normal.z - b.normal.z,
+                a.contactPoint.x - b.contactPoint.x, a.contactPoint.y - b.contactPoint.y, a.contactPoint.z - b.contactPoint.z,
+            };
+            for (float error : errors)
+            {
+                result.maxError = std::max(result.maxError, std::abs(error));
+            }
+        }
+    }
+
+    /**
+     * @brief 結果を出力
+     * @return 許容範囲内なら true
+     */
+    bool PrintResult(const char* name, const CompareResult& result)
+    {
+        const bool isPassed = result.mismatchCount <= MAX_MISMATCH && result.maxError <= MAX_ERROR;
+        printf("  %-20s %7.2fns/pair hits=%6d mismatch=%5d maxError=%.6f %s\n",
+               name, result.nsPerPair, result.hitCount, result.mismatchCount, result.maxError, isPassed ? "ok" : "FAIL");
+        return isPassed;
+    }
+
+    /**
+     * @brief 組ごとの配列をバッチに詰めて判定（呼び出し側の使い方と同じ）
+     */
+    template<class Batch, class PushFunc, class DetectFunc>
+    void RunBatched(int pairCount, std::vector<Hit>& outHits, PushFunc push, DetectFunc detect)
+    {
+        Batch batch;
+        Hit laneHits[WIDTH];
+        int first = 0;
+
+        for (int i = 0; i < pairCount; ++i)
+        {
+            push(batch, i);
+            if (batch.IsFull() || i + 1 == pairCount)
+            {
+                const uint32_t mask = detect(batch, laneHits);
+                for (int lane = 0; lane < batch.count; ++lane)
+                {
+                    outHits[first + lane] = ((mask >> lane) & 1u) ? laneHits[lane] : Hit();
+                }
+                first += batch.count;
+                batch.Clear();
+            }
+        }
+    }
+}
+
+int main()
+{
+    using namespace std::chrono;
+
+    std::mt19937 rng(SEED);
+    std::uniform_real_distribution<float> pos(-SPREAD, SPREAD);
+    std::uniform_real_distribution<float> size(0.5f, 2.0f);
+    std::uniform_real_distribution<float> angle(-XM_PI, XM_PI);
+
+    std::vector<Collider> spheresA(PAIR_COUNT), spheresB(PAIR_COUNT), boxes(PAIR_COUNT);
+    for (int i = 0; i < PAIR_COUNT; ++i)
+    {
+        spheresA[i] = Collider::CreateSphere({ pos(rng), pos(rng), pos(rng) }, size(rng));
+        spheresB[i] = Collider::CreateSphere({ pos(rng), pos(rng), pos(rng) }, size(rng));
+
+        // 一部は中心を重ねて既定の法線の分岐も通す
+        if (i % 64 == 0) spheresB[i].sphere.center = spheresA[i].sphere.center;
+
+        boxes[i].type = ColliderType::Box;
+        boxes[i].obb.center = { pos(rng), pos(rng), pos(rng) };
+        boxes[i].obb.extents = { size(rng), size(rng), size(rng) };
+        XMStoreFloat4(&boxes[i].obb.orientation, XMQuaternionRotationRollPitchYaw(angle(rng), angle(rng), angle(rng)));
+        if (i % 64 == 0) spheresA[i].sphere.center = boxes[i].obb.center;
+    }
+
+    std::vector<Hit> reference(PAIR_COUNT), batched(PAIR_COUNT);
+    std::vector<float> radiusSums(PAIR_COUNT), radii(PAIR_COUNT);
+    for (int i = 0; i < PAIR_COUNT; ++i)
+    {
+        radiusSums[i] = spheresA[i].sphere.radius + spheresB[i].sphere.radius;
+        radii[i] = spheresA[i].sphere.radius;
+    }
+
+    printf("[Collision] pair batches (%s, %d pairs)\n", Collision_GetPacketInstructionSet(), PAIR_COUNT);
+
+    auto elapsedNs = [](high_resolution_clock::time_point start) {
+        return duration<double, std::nano>(high_resolution_clock::now() - start).count() / PAIR_COUNT;
+    };
+    int failedCount = 0;
+
+    //--------------------------------------
+    // 球 × 球
+    //--------------------------------------
+    CompareResult scalarSphere;
+    auto start = high_resolution_clock::now();
+    for (int i = 0; i < PAIR_COUNT; ++i)
+    {
+        reference[i] = Collision_Detect(spheresA[i], spheresB[i]);
+    }
+    scalarSphere.nsPerPair = elapsedNs(start);
+    Compare(reference, reference, radiusSums, scalarSphere);
+    PrintResult("scalar sphere-sphere", scalarSphere);
+
+    CompareResult batchSphere;
+    start = high_resolution_clock::now();
+    RunBatched<SpherePairBatch>(PAIR_COUNT, batched,
+        [&](SpherePairBatch& batch, int i) { batch.Push(spheresA[i].sphere, spheresB[i].sphere); },
+        [](const SpherePairBatch& batch, Hit* hits) { return Collision_DetectSpherePairBatch(batch, hits); });
+    batchSphere.nsPerPair = elapsedNs(start);
+    Compare(reference, batched, radiusSums, batchSphere);
+    if (!PrintResult("batch sphere-sphere", batchSphere)) ++failedCount;
+
+    //--------------------------------------
+    // 球 × OBB
+    //--------------------------------------
+    CompareResult scalarOBB;
+    start = high_resolution_clock::now();
+    for (int i = 0; i < PAIR_COUNT; ++i)
+    {
+        reference[i] = Collision_Detect(spheresA[i], boxes[i]);
+    }
+    scalarOBB.nsPerPair = elapsedNs(start);
+    Compare(reference, reference, radii, scalarOBB);
+    PrintResult("scalar sphere-OBB", scalarOBB);
+
+    CompareResult batchOBB;
+    start = high_resolution_clock::now();
+    RunBatched<SphereOBBPairBatch>(PAIR_COUNT, batched,
+        [&](SphereOBBPairBatch& batch, int i) { batch.Push(spheresA[i].sphere, boxes[i].obb); },
+        [](const SphereOBBPairBatch& batch, Hit* hits) { return Collision_DetectSphereOBBPairBatch(batch, hits); });
+    batchOBB.nsPerPair = elapsedNs(start);
+    Compare(reference, batched, radii, batchOBB);
+    if (!PrintResult("batch sphere-OBB", batchOBB)) ++failedCount;
+
+    printf("[Collision] pair batches %s (%d failed)\n", failedCount == 0 ? "PASSED" : "FAILED", failedCount);
+    return failedCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
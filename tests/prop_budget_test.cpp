@@ -0,0 +1,225 @@
+﻿/****************************************
+ * @file    prop_budget_test.cpp
+ * @brief   破片予算のストレステスト（上限を大きく超える破片を出し続けて上限が守られるか）
+ * @detail  毎フレーム切断1回分の破片を固定シードで生成し、PropManager の予算適用と同じく
+ *          集計 → PropBudget_Evict → 削除対象を取り除く、を繰り返す。
+ *          予算対象外のプロップ（ファイル由来の共有モデル）も剛体数にだけ数える。
+ *          剛体数・三角形数・GPUバッファ量がそれぞれ効く予算で、毎フレーム次を確かめる。
+ *          - 適用後の集計が上限以内で、残った破片から数え直した値と一致する
+ *          - 削除はスコアの高い順で、最後の1つを戻すと上限を超える（削りすぎない）
+ *          1件でも外れれば終了コード 1 を返す
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "prop_budget.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace PropBudgetTestConfig
+{
+    constexpr int FRAME_COUNT = 600;
+    constexpr int MIN_PIECES_PER_FRAME = 2;     // 1回の切断で出る破片数の範囲
+    constexpr int MAX_PIECES_PER_FRAME = 24;
+    constexpr int MIN_TRIANGLES = 12;           // 破片1つの三角形数の範囲
+    constexpr int MAX_TRIANGLES = 4000;
+    constexpr size_t VERTEX_SIZE = 48;          // Vertex（位置・法線・色・UV）の大きさ
+    constexpr size_t INDEX_SIZE = sizeof(unsigned int);
+    constexpr int STATIC_PROP_COUNT = 40;       // 予算対象外のプロップ数
+    constexpr float DOWNGRADE_RATE = 0.02f;     // 1フレームで見た目だけへ格下げされる割合
+    constexpr float AGE_SCORE_PER_FRAME = 0.01f;
+    constexpr unsigned int SEED = 20261018u;
+}
+
+using namespace PropBudgetTestConfig;
+
+namespace
+{
+    struct Piece
+    {
+        float score;
+        int triangles;
+        size_t gpuBytes;
+        bool isVisual;
+    };
+
+    struct Scenario
+    {
+        const char* name;
+        PropBudget budget;
+    };
+
+    PropBudgetStats CountStats(const std::vector<Piece>& pieces)
+    {
+        PropBudgetStats stats;
+        stats.activeBodies = STATIC_PROP_COUNT;
+        for (const Piece& piece : pieces)
+        {
+            if (piece.isVisual) ++stats.visualBodies;
+            else ++stats.activeBodies;
+            stats.triangles += piece.triangles;
+            stats.gpuBytes += piece.gpuBytes;
+        }
+        return stats;
+    }
+
+    /**
+     * @brief 1シナリオ分を回し、外れたフレーム数を返す
+     */
+    int RunScenario(const Scenario& scenario)
+    {
+        std::mt19937 rng(SEED);
+        std::uniform_int_distribution<int> pieceCount(MIN_PIECES_PER_FRAME, MAX_PIECES_PER_FRAME);
+        std::uniform_int_distribution<int> triangleCount(MIN_TRIANGLES, MAX_TRIANGLES);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        std::vector<Piece> pieces;
+        std::vector<PropBudgetCandidate> candidates;
+        PropBudgetStats stats;
+        int spawnedCount = 0;
+        int failedFrames = 0;
+        PropBudgetStats peak;
+
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            // 経過時間でスコアが上がり、一部は見た目だけへ格下げされる
+            for (Piece& piece : pieces)
+            {
+                piece.score += AGE_SCORE_PER_FRAME;
+                if (!piece.isVisual && unit(rng) < DOWNGRADE_RATE) piece.isVisual = true;
+            }
+
+            const int spawn = pieceCount(rng);
+            for (int i = 0; i < spawn; ++i)
+            {
+                // 切断後の破片は三角形数のおよそ半分の頂点を持つ
+                const int triangles = triangleCount(rng);
+                const size_t vertices = static_cast<size_t>(triangles) / 2 + 3;
+                pieces.push_back({ unit(rng), triangles, vertices * VERTEX_SIZE + triangles * 3 * INDEX_SIZE, false });
+            }
+            spawnedCount += spawn;
+
+            // PropManager と同じ手順：集計 → 削除対象の選択
+            candidates.clear();
+            for (const Piece& piece : pieces)
+            {
+                PropBudgetCandidate candidate;
+                candidate.score = piece.score;
+                candidate.triangles = piece.triangles;
+                candidate.gpuBytes = piece.gpuBytes;
+                candidate.isVisual = piece.isVisual;
+                candidates.push_back(candidate);
+            }
+
+            const PropBudgetStats before = CountStats(pieces);
+            peak.activeBodies = std::max(peak.activeBodies, before.activeBodies);
+            peak.triangles = std::max(peak.triangles, before.triangles);
+            peak.gpuBytes = std::max(peak.gpuBytes, before.gpuBytes);
+
+            const int evictedBefore = stats.evictedCount;
+            stats.activeBodies = before.activeBodies;
+            stats.visualBodies = before.visualBodies;
+            stats.triangles = before.triangles;
+            stats.gpuBytes = before.gpuBytes;
+            PropBudget_Evict(candidates, scenario.budget, stats);
+
+            // 削除されなかった候補を次フレームの破片として残し、削除の順序と最小性を確かめる
+            pieces.clear();
+            float lowestEvictedScore = 1e30f;
+            float highestKeptScore = -1e30f;
+            const PropBudgetCandidate* lastEvicted = nullptr;
+            for (const PropBudgetCandidate& candidate : candidates)
+            {
+                if (candidate.isEvicted)
+                {
+                    lowestEvictedScore = std::min(lowestEvictedScore, candidate.score);
+                    lastEvicted = &candidate;
+                }
+                else
+                {
+                    highestKeptScore = std::max(highestKeptScore, candidate.score);
+                    pieces.push_back({ candidate.score, candidate.triangles, candidate.gpuBytes, candidate.isVisual });
+                }
+            }
+
+            const PropBudgetStats after = CountStats(pieces);
+            bool isPassed = !PropBudget_IsOver(scenario.budget, stats)
+                && after.activeBodies == stats.activeBodies
+                && after.visualBodies == stats.visualBodies
+                && after.triangles == stats.triangles
+                && after.gpuBytes == stats.gpuBytes;
+
+            if (lastEvicted)
+            {
+                PropBudgetStats restored = stats;
+                restored.triangles += lastEvicted->triangles;
+                restored.gpuBytes += lastEvicted->gpuBytes;
+                if (lastEvicted->isVisual) ++restored.visualBodies;
+                else ++restored.activeBodies;
+
+                isPassed = isPassed
+                    && lowestEvictedScore >= highestKeptScore
+                    && PropBudget_IsOver(scenario.budget, restored);
+            }
+            else
+            {
+                isPassed = isPassed && stats.evictedCount == evictedBefore;
+            }
+
+            if (!isPassed)
+            {
+                if (failedFrames == 0)
+                {
+                    printf("  frame %d: bodies=%d triangles=%d bytes=%zu evicted=%d\n",
+                        frame, stats.activeBodies, stats.triangles, stats.gpuBytes, stats.evictedCount - evictedBefore);
+                }
+                ++failedFrames;
+            }
+        }
+
+        printf("  %-10s spawned=%6d evicted=%6d peak(bodies=%4d triangles=%7d bytes=%9zu) final(bodies=%4d visual=%4d triangles=%7d bytes=%9zu) %s\n",
+            scenario.name, spawnedCount, stats.evictedCount,
+            peak.activeBodies, peak.triangles, peak.gpuBytes,
+            stats.activeBodies, stats.visualBodies, stats.triangles, stats.gpuBytes,
+            failedFrames == 0 ? "ok" : "FAIL");
+        return failedFrames;
+    }
+}
+
+//======================================
+// ストレステスト
+//======================================
+int main()
+{
+    // 既定の予算と、剛体数・三角形数・GPUバッファ量のそれぞれだけが効く予算
+    Scenario scenarios[4];
+    scenarios[0].name = "default";
+    scenarios[3].name = "bodies";
+    scenarios[3].budget.maxActiveBodies = 64;
+    scenarios[3].budget.maxTriangles = 100000000;
+    scenarios[3].budget.maxGpuBytes = 1024u * 1024u * 1024u;
+    scenarios[1].name = "triangles";
+    scenarios[1].budget.maxActiveBodies = 100000;
+    scenarios[1].budget.maxTriangles = 40000;
+    scenarios[2].name = "gpuBytes";
+    scenarios[2].budget.maxActiveBodies = 100000;
+    scenarios[2].budget.maxTriangles = 100000000;
+    scenarios[2].budget.maxGpuBytes = 2u * 1024u * 1024u;
+
+    printf("[PropBudget] stress test (%d frames, seed %u)\n", FRAME_COUNT, SEED);
+
+    int failedFrames = 0;
+    for (const Scenario& scenario : scenarios)
+    {
+        failedFrames += RunScenario(scenario);
+    }
+
+    printf("[PropBudget] stress test %s (%d failed frames)\n", failedFrames == 0 ? "PASSED" : "FAILED", failedFrames);
+    return failedFrames == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,282 @@
+﻿/****************************************
+ * @file    ray_packet_test.cpp
+ * @brief   スカラー版とパケット版のレイ × AABB / OBB 判定の照合と処理時間の比較
+ * @detail  固定シードで配置したレイと箱の全組み合わせをスカラー版で判定して基準とし、
+ *          レイパケット × 箱、レイ × 箱パケットの2通りの結果と比べる。
+ *          当たり・外れの食い違いか距離の差が許容範囲を外れれば終了コード 1 を返す
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "collision_packet.h"
+#include "ray.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace RayPacketTestConfig
+{
+    constexpr int RAY_COUNT = 2048;
+    constexpr int BOX_COUNT = 256;
+    constexpr float SPREAD = 20.0f;             // 始点と箱を配置する範囲
+    constexpr unsigned int SEED = 12345u;
+
+    // 当たり・外れの食い違いの許容数（スラブの境界すれすれのレイは丸めで分かれうる）
+    constexpr int MAX_MISMATCH = 4;
+    // 距離の差の許容値（OBB はローカル空間への変換順の違いで数 ulp ずれる）
+    constexpr float DIST_TOLERANCE = 1e-3f;
+}
+
+using namespace DirectX;
+using namespace CollisionPacketConfig;
+using namespace RayPacketTestConfig;
+
+namespace
+{
+    struct CompareResult
+    {
+        double nsPerTest = 0.0;
+        int hitCount = 0;
+        int mismatchCount = 0;
+        float maxDistError = 0.0f;
+    };
+
+    // 基準（スカラー版）と比べてヒット数・不一致・距離誤差を集計
+    void Compare(const std::vector<uint8_t>& reference, const std::vector<float>& referenceDist,
+                 const std::vector<uint8_t>& packet, const std::vector<float>& packetDist, CompareResult& result)
+    {
+        for (size_t i = 0; i < reference.size(); ++i)
+        {
+            if (reference[i] != packet[i]) { ++result.mismatchCount; continue; }
+            if (!reference[i]) continue;
+            ++result.hitCount;
+            result.maxDistError = std::max(result.maxDistError, std::abs(referenceDist[i] - packetDist[i]));
+        }
+    }
+
+    /**
+     * @brief 結果を出力
+     * @return 許容範囲内なら true
+     */
+    bool PrintResult(const char* name, const CompareResult& result)
+    {
+        const bool isPassed = result.mismatchCount <= MAX_MISMATCH && result.maxDistError <= DIST_TOLERANCE;
+        printf("  %-22s %7.2fns/test hits=%7d mismatch=%5d maxDistError=%.6f %s\n",
+               name, result.nsPerTest, result.hitCount, result.mismatchCount, result.maxDistError, isPassed ? "ok" : "FAIL");
+        return isPassed;
+    }
+
+    // スカラー版の OBB 判定の基準：レイを OBB のローカル空間へ移して AABB 判定
+    bool ReferenceRayOBB(const Ray& ray, const OBB& obb, float* outDist)
+    {
+        const XMVECTOR q = XMLoadFloat4(&obb.orientation);
+        const XMFLOAT3 origin = ray.GetOrigin();
+        const XMFLOAT3 dir = ray.GetDirection();
+
+        XMFLOAT3 localOrigin, localDir;
+        XMStoreFloat3(&localOrigin, XMVector3InverseRotate(XMLoadFloat3(&origin) - XMLoadFloat3(&obb.center), q));
+        XMStoreFloat3(&localDir, XMVector3InverseRotate(XMLoadFloat3(&dir), q));
+
+        AABB localBox;
+        localBox.min = { -obb.extents.x, -obb.extents.y, -obb.extents.z };
+        localBox.max = obb.extents;
+        return Collision_IntersectRayAABB(Ray(localOrigin, localDir), localBox, outDist);
+    }
+}
+
+int main()
+{
+    using namespace std::chrono;
+
+    std::mt19937 rng(SEED);
+    std::uniform_real_distribution<float> pos(-SPREAD, SPREAD);
+    std::uniform_real_distribution<float> size(0.5f, 3.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> angle(-XM_PI, XM_PI);
+
+    // レイは原点付近から箱の集まりへ向けて飛ばす（軸に平行なレイも混ぜる）
+    std::vector<Ray> rays;
+    rays.reserve(RAY_COUNT);
+    for (int i = 0; i < RAY_COUNT; ++i)
+    {
+        XMFLOAT3 origin = { pos(rng), pos(rng), pos(rng) };
+        XMFLOAT3 dir = { unit(rng), unit(rng), unit(rng) };
+        if (i % 16 == 0) dir = { 0.0f, 0.0f, (i % 32 == 0) ? 1.0f : -1.0f };
+        XMStoreFloat3(&dir, XMVector3Normalize(XMLoadFloat3(&dir)));
+        rays.emplace_back(origin, dir);
+    }
+
+    std::vector<AABB> aabbs(BOX_COUNT);
+    std::vector<OBB> obbs(BOX_COUNT);
+    for (int i = 0; i < BOX_COUNT; ++i)
+    {
+        const XMFLOAT3 center = { pos(rng), pos(rng), pos(rng) };
+        const XMFLOAT3 extents = { size(rng), size(rng), size(rng) };
+        aabbs[i].min = { center.x - extents.x, center.y - extents.y, center.z - extents.z };
+        aabbs[i].max = { center.x + extents.x, center.y + extents.y, center.z + extents.z };
+
+        obbs[i].center = center;
+        obbs[i].extents = extents;
+        XMStoreFloat4(&obbs[i].orientation, XMQuaternionRotationRollPitchYaw(angle(rng), angle(rng), angle(rng)));
+    }
+
+    const size_t testCount = static_cast<size_t>(RAY_COUNT) * BOX_COUNT;
+    std::vector<uint8_t> referenceHit(testCount), packetHit(testCount);
+    std::vector<float> referenceDist(testCount), packetDist(testCount);
+    float laneDist[WIDTH];
+    int failedCount = 0;
+
+    printf("[Collision] ray packets (%s, %d rays x %d boxes)\n", Collision_GetPacketInstructionSet(), RAY_COUNT, BOX_COUNT);
+
+    auto elapsedNs = [testCount](high_resolution_clock::time_point start) {
+        return duration<double, std::nano>(high_resolution_clock::now() - start).count() / testCount;
+    };
+
+    //--------------------------------------
+    // AABB：スカラー版（基準）
+    //--------------------------------------
+    CompareResult scalarAABB;
+    auto start = high_resolution_clock::now();
+    for (int r = 0; r < RAY_COUNT; ++r)
+    {
+        for (int b = 0; b < BOX_COUNT; ++b)
+        {
+            const size_t index = static_cast<size_t>(r) * BOX_COUNT + b;
+            referenceHit[index] = Collision_IntersectRayAABB(rays[r], aabbs[b], &referenceDist[index]) ? 1 : 0;
+        }
+    }
+    scalarAABB.nsPerTest = elapsedNs(start);
+    Compare(referenceHit, referenceDist, referenceHit, referenceDist, scalarAABB);
+    PrintResult("scalar ray-AABB", scalarAABB);
+
+    //--------------------------------------
+    // AABB：複数本のレイ × 1つの箱
+    //--------------------------------------
+    std::vector<RayPacket> rayPackets;
+    for (int r = 0; r < RAY_COUNT; ++r)
+    {
+        if (r % WIDTH == 0) rayPackets.emplace_back();
+        rayPackets.back().Push(rays[r]);
+    }
+
+    CompareResult raysVsBox;
+    start = high_resolution_clock::now();
+    for (size_t p = 0; p < rayPackets.size(); ++p)
+    {
+        for (int b = 0; b < BOX_COUNT; ++b)
+        {
+            const uint32_t mask = Collision_IntersectRayPacketAABB(rayPackets[p], aabbs[b], laneDist);
+            for (int lane = 0; lane < rayPackets[p].count; ++lane)
+            {
+                const size_t index = (p * WIDTH + lane) * BOX_COUNT + b;
+                packetHit[index] = (mask >> lane) & 1u;
+                packetDist[index] = laneDist[lane];
+            }
+        }
+    }
+    raysVsBox.nsPerTest = elapsedNs(start);
+    Compare(referenceHit, referenceDist, packetHit, packetDist, raysVsBox);
+    if (!PrintResult("ray packet x AABB", raysVsBox)) ++failedCount;
+
+    //--------------------------------------
+    // AABB：1本のレイ × 複数の箱
+    //--------------------------------------
+    std::vector<AABBPacket> aabbPackets;
+    for (int b = 0; b < BOX_COUNT; ++b)
+    {
+        if (b % WIDTH == 0) aabbPackets.emplace_back();
+        aabbPackets.back().Push(aabbs[b]);
+    }
+
+    CompareResult rayVsBoxes;
+    start = high_resolution_clock::now();
+    for (int r = 0; r < RAY_COUNT; ++r)
+    {
+        for (size_t p = 0; p < aabbPackets.size(); ++p)
+        {
+            const uint32_t mask = Collision_IntersectRayAABBPacket(rays[r], aabbPackets[p], laneDist);
+            for (int lane = 0; lane < aabbPackets[p].count; ++lane)
+            {
+                const size_t index = static_cast<size_t>(r) * BOX_COUNT + p * WIDTH + lane;
+                packetHit[index] = (mask >> lane) & 1u;
+                packetDist[index] = laneDist[lane];
+            }
+        }
+    }
+    rayVsBoxes.nsPerTest = elapsedNs(start);
+    Compare(referenceHit, referenceDist, packetHit, packetDist, rayVsBoxes);
+    if (!PrintResult("ray x AABB packet", rayVsBoxes)) ++failedCount;
+
+    //--------------------------------------
+    // OBB：スカラー版（基準）と2種類のパケット
+    //--------------------------------------
+    CompareResult scalarOBB;
+    start = high_resolution_clock::now();
+    for (int r = 0; r < RAY_COUNT; ++r)
+    {
+        for (int b = 0; b < BOX_COUNT; ++b)
+        {
+            const size_t index = static_cast<size_t>(r) * BOX_COUNT + b;
+            referenceHit[index] = ReferenceRayOBB(rays[r], obbs[b], &referenceDist[index]) ? 1 : 0;
+        }
+    }
+    scalarOBB.nsPerTest = elapsedNs(start);
+    Compare(referenceHit, referenceDist, referenceHit, referenceDist, scalarOBB);
+    PrintResult("scalar ray-OBB", scalarOBB);
+
+    CompareResult raysVsOBB;
+    start = high_resolution_clock::now();
+    for (size_t p = 0; p < rayPackets.size(); ++p)
+    {
+        for (int b = 0; b < BOX_COUNT; ++b)
+        {
+            const uint32_t mask = Collision_IntersectRayPacketOBB(rayPackets[p], obbs[b], laneDist);
+            for (int lane = 0; lane < rayPackets[p].count; ++lane)
+            {
+                const size_t index = (p * WIDTH + lane) * BOX_COUNT + b;
+                packetHit[index] = (mask >> lane) & 1u;
+                packetDist[index] = laneDist[lane];
+            }
+        }
+    }
+    raysVsOBB.nsPerTest = elapsedNs(start);
+    Compare(referenceHit, referenceDist, packetHit, packetDist, raysVsOBB);
+    if (!PrintResult("ray packet x OBB", raysVsOBB)) ++failedCount;
+
+    std::vector<OBBPacket> obbPackets;
+    for (int b = 0; b < BOX_COUNT; ++b)
+    {
+        if (b % WIDTH == 0) obbPackets.emplace_back();
+        obbPackets.back().Push(obbs[b]);
+    }
+
+    CompareResult rayVsOBBs;
+    start = high_resolution_clock::now();
+    for (int r = 0; r < RAY_COUNT; ++r)
+    {
+        for (size_t p = 0; p < obbPackets.size(); ++p)
+        {
+            const uint32_t mask = Collision_IntersectRayOBBPacket(rays[r], obbPackets[p], laneDist);
+            for (int lane = 0; lane < obbPackets[p].count; ++lane)
+            {
+                const size_t index = static_cast<size_t>(r) * BOX_COUNT + p * WIDTH + lane;
+                packetHit[index] = (mask >> lane) & 1u;
+                packetDist[index] = laneDist[lane];
+            }
+        }
+    }
+    rayVsOBBs.nsPerTest = elapsedNs(start);
+    Compare(referenceHit, referenceDist, packetHit, packetDist, rayVsOBBs);
+    if (!PrintResult("ray x OBB packet", rayVsOBBs)) ++failedCount;
+
+    printf("[Collision] ray packets %s (%d failed)\n", failedCount == 0 ? "PASSED" : "FAILED", failedCount);
+    return failedCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,214 @@
+﻿/****************************************
+ * @file    stack_sleep_test.cpp
+ * @brief   箱の積み重ねが面クリッピングの多点マニフォールドで静止し、スリープすることの確認
+ * @detail  地面（キネマティックな箱）の上に単位立方体を 1 / 3 / 5 段積み、
+ *          ゲームと同じ順序（積分 → 接触生成 → アイランドのスリープ判定 → 求解）で進める。
+ *          全段が規定ステップ以内に眠り、その後も眠ったまま崩れていなければ合格。
+ *          どれかが外れれば終了コード 1 を返す
+ * @author  Natsume Shidara
+ * @date    2026/10/18
+ ****************************************/
+
+#include "contact_solver.h"
+#include "rigid_body.h"
+#include "rigid_body_store.h"
+#include "collider.h"
+#include "collision.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+//--------------------------------------
+// 定数定義
+//--------------------------------------
+namespace StackSleepTestConfig
+{
+    constexpr float DT = 1.0f / 120.0f;
+    constexpr int VELOCITY_ITERATIONS = 4;         // PropConfig::COLLISION_ITERATIONS と同じ
+    constexpr float BOX_HALF_SIZE = 0.5f;
+
+    // 全段が眠るまでの上限ステップ数（静止判定に 0.5 秒かかるため 60 ステップが下限）
+    constexpr int MAX_SETTLE_STEPS = 240;
+    // 眠った後、眠ったままであることを確かめるステップ数
+    constexpr int HOLD_STEPS = 120;
+    // 積んだ位置からの水平方向のずれの許容値（辺の長さの 5%）
+    constexpr float MAX_HORIZONTAL_DRIFT = 0.05f;
+    // 接触 1 段あたりの沈み込みの許容値（位置補正は CORRECTION_SLOP までのめり込みを残すため、段数分だけ積み重なる）
+    constexpr float MAX_SINK_PER_CONTACT = 0.015f;
+}
+
+using namespace DirectX;
+using namespace StackSleepTestConfig;
+
+namespace
+{
+    /**
+     * @brief 箱同士の接触を面クリッピングで更新（プロップの詳細判定と同じ扱い）
+     */
+    void UpdateBoxContact(ContactManifold& manifold)
+    {
+        manifold.Refresh();
+
+        const Collider colA = manifold.bodyA->GetWorldCollider();
+        const Collider colB = manifold.bodyB->GetWorldCollider();
+        const ContactSet contacts = Collision_ClipOBBOBB(colA.obb, colB.obb);
+        if (contacts.count > 1)
+        {
+            manifold.SetContacts(contacts);
+        }
+        else if (contacts.count == 1)
+        {
+            Hit hit;
+            hit.isHit = true;
+            hit.normal = contacts.normal;
+            hit.depth = contacts.depths[0];
+            hit.contactPoint = contacts.points[0];
+            manifold.AddContact(hit);
+        }
+    }
+
+    /**
+     * @brief 1つのアイランドとしてスリープ・起床を判定（PropManager のアイランド判定と同じ規則）
+     */
+    void UpdateIsland(std::vector<RigidBody>& boxes)
+    {
+        bool isAwake = false;
+        bool canSleep = true;
+        bool isSupported = false;
+        for (const RigidBody& box : boxes)
+        {
+            if (!box.IsSleeping()) isAwake = true;
+            if (!box.IsSleeping() && !box.IsReadyToSleep()) canSleep = false;
+            if (box.IsSleeping() || box.HasGroundContact()) isSupported = true;
+        }
+        if (!isAwake) return;
+
+        for (RigidBody& box : boxes)
+        {
+            if (canSleep && isSupported)
+            {
+                if (!box.IsSleeping()) box.Sleep();
+            }
+            else if (box.IsSleeping())
+            {
+                box.WakeUp();
+            }
+        }
+    }
+
+    /**
+     * @brief height 段の積み重ねを進めて結果を出力
+     * @return 規定ステップ以内に眠り、崩れずに眠り続けたら true
+     */
+    bool RunStack(int height)
+    {
+        RigidBody ground;
+        ground.Initialize({ 0.0f, -0.5f, 0.0f }, Collider::CreateOBB({ 0.0f, 0.0f, 0.0f }, { 10.0f, 0.5f, 10.0f }), 0.0f);
+        RigidBody::Params groundParams = ground.GetParams();
+        groundParams.isKinematic = true;
+        groundParams.useGravity = false;
+        ground.SetParams(groundParams);
+
+        std::vector<XMFLOAT3> stackedPositions(height);
+        std::vector<RigidBody> boxes(height);
+        for (int i = 0; i < height; ++i)
+        {
+            stackedPositions[i] = { 0.0f, BOX_HALF_SIZE + i * BOX_HALF_SIZE * 2.0f, 0.0f };
+            boxes[i].Initialize(stackedPositions[i],
+                Collider::CreateOBB({ 0.0f, 0.0f, 0.0f }, { BOX_HALF_SIZE, BOX_HALF_SIZE, BOX_HALF_SIZE }), 1.0f);
+            boxes[i].SetIslandSleepEnabled(true);
+        }
+
+        // 候補ペア：地面と最下段、上下に隣り合う段
+        std::vector<ContactManifold> manifolds(height);
+        manifolds[0].bodyA = &ground;
+        manifolds[0].bodyB = &boxes[0];
+        for (int i = 1; i < height; ++i)
+        {
+            manifolds[i].bodyA = &boxes[i - 1];
+            manifolds[i].bodyB = &boxes[i];
+        }
+
+        ContactSolver solver;
+        std::vector<ContactManifold*> active;
+        int settleStep = -1;
+        bool isHeld = true;
+
+        for (int step = 0; step < MAX_SETTLE_STEPS + HOLD_STEPS; ++step)
+        {
+            RigidBodyStore::Integrate(DT);
+
+            for (ContactManifold& manifold : manifolds)
+            {
+                UpdateBoxContact(manifold);
+            }
+            if (manifolds[0].pointCount > 0) boxes[0].NotifyGroundContact();
+
+            UpdateIsland(boxes);
+
+            const bool isAsleep = std::all_of(boxes.begin(), boxes.end(), [](const RigidBody& box) { return box.IsSleeping(); });
+            if (settleStep < 0)
+            {
+                if (isAsleep) settleStep = step + 1;
+                else if (step + 1 >= MAX_SETTLE_STEPS) break;
+            }
+            else if (!isAsleep)
+            {
+                isHeld = false;
+            }
+
+            // 地面はゲームではマップの静的な接触として扱われ、眠っている剛体は判定しない。
+            // キネマティックな地面は眠らないため、眠っている側との接触はここで除く
+            active.clear();
+            for (ContactManifold& manifold : manifolds)
+            {
+                if (manifold.pointCount == 0) continue;
+                const bool isRestingA = manifold.bodyA->IsSleeping() || manifold.bodyA->GetParams().isKinematic;
+                if (isRestingA && manifold.bodyB->IsSleeping()) continue;
+                active.push_back(&manifold);
+            }
+            if (active.empty()) continue;
+
+            solver.Begin(active, DT);
+            for (int iter = 0; iter < VELOCITY_ITERATIONS; ++iter)
+            {
+                solver.SolveVelocities();
+            }
+            solver.StoreVelocities();
+            solver.SolvePositions();
+            solver.End();
+        }
+
+        float horizontalDrift = 0.0f;
+        float verticalDrift = 0.0f;
+        for (int i = 0; i < height; ++i)
+        {
+            const XMFLOAT3 pos = boxes[i].GetPosition();
+            horizontalDrift = std::max(horizontalDrift, std::hypot(pos.x - stackedPositions[i].x, pos.z - stackedPositions[i].z));
+            verticalDrift = std::max(verticalDrift, std::abs(pos.y - stackedPositions[i].y));
+        }
+
+        const bool isPassed = settleStep > 0 && isHeld
+            && horizontalDrift <= MAX_HORIZONTAL_DRIFT && verticalDrift <= MAX_SINK_PER_CONTACT * height;
+        printf("  %d box(es): asleep after %4d steps (%.2fs) held=%s drift horizontal=%.4f vertical=%.4f %s\n",
+               height, settleStep, settleStep * DT, isHeld ? "yes" : "no", horizontalDrift, verticalDrift, isPassed ? "ok" : "FAIL");
+        return isPassed;
+    }
+}
+
+int main()
+{
+    printf("[ContactSolver] box stacks settle to sleep (limit %d steps)\n", MAX_SETTLE_STEPS);
+
+    int failedCount = 0;
+    for (int height : { 1, 3, 5 })
+    {
+        if (!RunStack(height)) ++failedCount;
+    }
+
+    printf("[ContactSolver] box stacks %s (%d failed)\n", failedCount == 0 ? "PASSED" : "FAILED", failedCount);
+    return failedCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,185 +1,154 @@
 /****************************************
  * @file trail.cpp
- * @brief OՃGtFNg̕`EXV
+ * @brief 軌跡エフェクトの描画・更新処理
  * @author Natsume Shidara
  * @date 2025/09/03
  * @update 2025/11/21
+ * @update 2026/10/18 - 軌跡を SlotMap で管理（生成時の空き探索と未使用スロットの走査をなくす）
  ****************************************/
 
 #include "trail.h"
 #include "billboard.h"
 #include "direct3d.h"
 #include "shader_billboard.h"
+#include "slot_map.h"
 #include "sprite.h"
 #include "texture.h"
 
 using namespace DirectX;
 
 //================================================================================================
-// 萔`E}N`
+// 定数定義・マクロ定義
 //================================================================================================
-static constexpr unsigned int TRAIL_MAX = 4096; // OՂ̍ő吔
+static constexpr unsigned int TRAIL_MAX = 4096; // 軌跡の最大数
 
-// eNX`pXiJp/{ԗpŐ؂ւ\ɂĂ̂D܂j
+// テクスチャパス（開発用/本番用で切り替え可能にしておくのが好ましい）
 // constexpr const wchar_t* TRAIL_TEXTURE_PATH = L"release/resource/SpaceShooterAssets/Artwork/effect/effect000.jpg";
 constexpr const wchar_t* TRAIL_TEXTURE_PATH = L"assets/white.png";
 
 //================================================================================================
-// \̒`
+// 構造体定義
 //================================================================================================
 /****************************************
  * @struct Trail
- * @brief OՃGtFNǧ̃f[^
- * @detail WAFAȂǂ̃p[^Ǘ
+ * @brief 軌跡エフェクトの個体データ
+ * @detail 座標、色、寿命などのパラメータを管理
  ****************************************/
 struct Trail
 {
-    XMFLOAT3 pos; // ʒu
-    XMFLOAT4 color; // {F
-    float size; // {TCY
-    double lifeTime; // ibj
-    double birthTime; // i0ȉ̏ꍇ͖gpƂ݂Ȃj
+    XMFLOAT3 pos; // 発生位置
+    XMFLOAT4 color; // 基本色
+    float size; // 基本サイズ
+    double lifeTime; // 寿命（秒）
+    double birthTime; // 発生時刻
 };
 
 //================================================================================================
-// O[oϐ
+// グローバル変数
 //================================================================================================
-static int g_TrailTexId = -1; // eNX`ID
-static Trail g_Trails[TRAIL_MAX]{}; // OՃf[^z
-static double g_Time = 0.0; // Šoߎ
+static int g_TrailTexId = -1; // テクスチャID
+static SlotMap<Trail> g_Trails; // 生存中の軌跡
+static double g_Time = 0.0; // 全体経過時間
 
 //================================================================================================
-// ֐`
+// 関数定義
 //================================================================================================
 
 /**
- * @brief OՃVXȅ
- * @detail z̃NAƃeNX`ǂݍ݂s
+ * @brief 軌跡システムの初期化
+ * @detail 配列のクリアとテクスチャ読み込みを行う
  */
 void Trail_Initialize()
 {
-    // z̏ibirthTime0ɂĖgpɂj
-    for (Trail& t : g_Trails)
-    {
-        t.birthTime = 0.0;
-    }
+    g_Trails.Clear();
+    g_Trails.Reserve(TRAIL_MAX);
 
     g_TrailTexId = Texture_Load(TRAIL_TEXTURE_PATH);
 }
 
 /**
- * @brief OՃVXȅI
+ * @brief 軌跡システムの終了処理
  */
 void Trail_Finalize()
 {
-    // Kvł΃eNX`̉ȂǂLq
+    g_Trails.Clear();
 }
 
 /**
- * @brief OՂ̍XV
- * @param elapsed_time Ot[̌oߎ
- * @detail 𒴂OՂ𖳌
+ * @brief 軌跡の更新
+ * @param elapsed_time 前フレームからの経過時間
+ * @detail 寿命を超えた軌跡を削除する
  */
 void Trail_Update(double elapsed_time)
 {
     g_Time += elapsed_time;
 
-    for (Trail& t : g_Trails)
+    g_Trails.RemoveIf([](const Trail& t)
     {
-        // gp̃Xbg̓XLbv
-        if (t.birthTime <= 0.0)
-            continue;
-
-        double trailElapsedTime = g_Time - t.birthTime; // ̃gČoߎ
-
-        // 
-        if (trailElapsedTime > t.lifeTime)
-        {
-            t.birthTime = 0.0; // ؂ɂ薳
-        }
-    }
+        return g_Time - t.birthTime > t.lifeTime; // 寿命判定
+    });
 }
 
 /**
- * @brief OՂ̕`
- * @detail r{[hgpĕ`sBZ𐄏B
+ * @brief 軌跡の描画
+ * @detail ビルボードを使用して描画を行う。加算合成を推奨。
  */
 void Trail_Draw()
 {
     //--------------------------------------
-    // _[Xe[gݒi[vOňxsj
+    // レンダーステート設定（ループ外で一度だけ行う）
     //--------------------------------------
-    // [x݂𖳌î߁j
+    // 深度書き込みを無効化（半透明合成のため）
     Direct3D_SetDepthWriteEnable(false);
     Direct3D_SetBlendState(BlendMode::Add);
 
-    // ZLɂꍇiGtFNgƂČ点ꍇj
+    // 加算合成を有効にする場合（エフェクトとして光らせたい場合）
     // Direct3D_SetAlphaBlend_Add();
 
     //--------------------------------------
-    // `惋[v
+    // 描画ループ
     //--------------------------------------
-    for (Trail& t : g_Trails)
+    for (const Trail& t : g_Trails)
     {
-        if (t.birthTime <= 0.0)
-            continue;
-
         double trailElapsedTime = g_Time - t.birthTime;
 
-        // ɑ΂is (0.0 -> 1.0)
+        // 寿命に対する進行割合 (0.0 -> 1.0)
         float ratio = (float)(trailElapsedTime / t.lifeTime);
 
-        // SFratio1.0𒴂Ȃ悤ɃNvivZ덷΍j
+        // 安全策：ratioが1.0を超えないようにクランプ（計算誤差対策）
         if (ratio > 1.0f)
             ratio = 1.0f;
 
-        // oωvZ
-        //  t.size  t.color Ȃ悤A[JϐŌvZ
+        // 経時変化計算
+        // 元の t.size や t.color を書き換えないよう、ローカル変数で計算する
         float drawSize = t.size * (1.0f - ratio);
 
         XMFLOAT4 drawColor = t.color;
-        drawColor.w = t.color.w * (1.0f - ratio); // At@ltF[hAEg
+        drawColor.w = t.color.w * (1.0f - ratio); // アルファ値をフェードアウト
         XMFLOAT2 pivot = {0.0f,0.0f};
         Billboard_Draw(g_TrailTexId, t.pos, { drawSize, drawSize }, pivot,t.color);
     }
 
     //--------------------------------------
-    // _[Xe[gA
+    // レンダーステート復帰
     //--------------------------------------
     Direct3D_SetBlendState(BlendMode::None);
     Direct3D_SetDepthWriteEnable(true);
 }
 
 /**
- * @brief VOՂ𐶐
- * @param position W
- * @param color F
- * @param size TCY
- * @param lifeTime ibj
+ * @brief 新しい軌跡を生成する
+ * @param position 発生座標
+ * @param color 色
+ * @param size サイズ
+ * @param lifeTime 寿命（秒）
  */
 void Trail_Create(const DirectX::XMFLOAT3& position, const DirectX::XMFLOAT4& color, float size, double lifeTime)
 {
-    for (Trail& t : g_Trails)
-    {
-        // gp̃Xbg̓XLbv
-        if (t.birthTime > 0.0)
-            continue;
-
-        // 󂫃Xbg𔭌Af[^Zbg
-        t.pos = position;
-        t.color = color;
-        t.size = size;
-        t.lifeTime = lifeTime;
-
-        // ݎ𔭐ƂċL^iɂLj
-        t.birthTime = g_Time;
-
-        //  g_Time  0.0 ̏ꍇAɖȂ悤␳iɋHȃP[Xւ̕یj
-        if (t.birthTime == 0.0)
-        {
-            t.birthTime = 0.00001;
-        }
-
-        break; // 1烋[v𔲂
-    }
+    // 上限に達している場合は生成しない
+    if (g_Trails.Size() >= TRAIL_MAX)
+        return;
+
+    // 現在時刻を発生時刻として記録
+    g_Trails.Insert({ position, color, size, lifeTime, g_Time });
 }
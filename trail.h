@@ -1,6 +1,6 @@
 /*==============================================================================
 
-   OՃGtFNg̕` [trail.h]
+   軌跡エフェクトの描画 [trail.h]
 														 Author : Natsume Shidara
 														 Date   : 2025/09/03
 --------------------------------------------------------------------------------
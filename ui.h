@@ -1,7 +1,7 @@
 /****************************************
  * @file ui.h
- * @brief Q[UIǗ
- * @detail HP\ȂǂUIvfǗ
+ * @brief ゲームUI管理
+ * @detail HP表示などのUI要素を管理
  * @author Natsume Shidara
  * @date 2026/01/12
  ****************************************/
@@ -10,29 +10,29 @@
 #define UI_H
 
  //======================================
- // UIǗ֐
+ // UI管理関数
  //======================================
 
  /**
-  * @brief UI
-  * @detail eNX`̓ǂݍ݂Ȃ
+  * @brief UI初期化
+  * @detail テクスチャの読み込みなど
   */
 void UI_Initialize();
 
 /**
- * @brief UII
+ * @brief UI終了処理
  */
 void UI_Finalize();
 
 /**
- * @brief UIXV
- * @param dt f^^C
+ * @brief UI更新
+ * @param dt デルタタイム
  */
 void UI_Update(float dt);
 
 /**
- * @brief UI`
- * @detail 2D`̂߁A3D`̌ɌĂяo
+ * @brief UI描画
+ * @detail 2D描画のため、3D描画の後に呼び出す
  */
 void UI_Draw();
 
@@ -1,7 +1,7 @@
 /**
  * @file debug_ostream.cpp
- * @brief fXNgbvAṽR\[fobOpo
- * @note Shift_JIŜݑΉ
+ * @brief デスクトップアプリのコンソールデバッグ用出力
+ * @note Shift_JISのみ対応
  */
 
 #include "debug_ostream.h"
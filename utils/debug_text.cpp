@@ -1,6 +1,6 @@
 /*==============================================================================
 
-   Direct3D11p fobNeLXg\ [debug_text.cpp]
+   Direct3D11用 デバックテキスト表示 [debug_text.cpp]
 														 Author : Youhei Sato
 														 Date   : 2025/06/15
 --------------------------------------------------------------------------------
@@ -41,7 +41,7 @@ namespace hal
 		}
 		else {
 			if (FAILED(CreateWICTextureFromFile(pDevice, pFontTextureFileName, &m_pTexture, &m_pTextureView))) {
-				MessageBoxW(nullptr, L"tHgeNX`̓ǂݍ݂Ɏs܂", pFontTextureFileName, MB_OK | MB_ICONERROR);
+				MessageBoxW(nullptr, L"フォントテクスチャの読み込みに失敗しました", pFontTextureFileName, MB_OK | MB_ICONERROR);
 				return;
 			}
 
@@ -54,17 +54,17 @@ namespace hal
 		m_TextureHeight = texture2d_desc.Height;
 
 		if (!m_LineSpacing) {
-			m_LineSpacing = m_TextureHeight / 16.0f; // 16̍1s̍Ƃ
+			m_LineSpacing = m_TextureHeight / 16.0f; // 16文字分の高さを1行の高さとする
 		}
 
 		if (!m_CharacterSpacing) {
-			m_CharacterSpacing = m_TextureWidth / 16.0f; // 16̕1̕Ƃ
+			m_CharacterSpacing = m_TextureWidth / 16.0f; // 16文字分の幅を1文字の幅とする
 		}
 
 		m_TextLines.emplace_back();
 
 		if (!m_pBlendState) {
-			// uhXe[gݒ
+			// ブレンドステート設定
 			D3D11_BLEND_DESC blend_desc{};
 			blend_desc.RenderTarget[0].BlendEnable = TRUE;
 			blend_desc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
@@ -79,29 +79,29 @@ namespace hal
 		}
 
 		if (!m_pDepthStencilState) {
-			// [xXeVXe[gݒ
+			// 深度ステンシルステート設定
 			D3D11_DEPTH_STENCIL_DESC depth_stencil_desc{};
 			depth_stencil_desc.DepthFunc = D3D11_COMPARISON_LESS;
 			depth_stencil_desc.StencilEnable = FALSE;
-			depth_stencil_desc.DepthEnable = FALSE; // ɂ
+			depth_stencil_desc.DepthEnable = FALSE; // 無効にする
 			depth_stencil_desc.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ZERO;
 
 			m_pDevice->CreateDepthStencilState(&depth_stencil_desc, m_pDepthStencilState.GetAddressOf());
 		}
 
 		if (!m_pRasterizerState) {
-			// X^CU[Xe[gݒ
+			// ラスタライザーステート設定
 			D3D11_RASTERIZER_DESC rasterizer_desc{};
 			rasterizer_desc.FillMode = D3D11_FILL_SOLID;
 			rasterizer_desc.CullMode = D3D11_CULL_BACK;
-			rasterizer_desc.DepthClipEnable = TRUE; // [xNbsOL
+			rasterizer_desc.DepthClipEnable = TRUE; // 深度クリッピング有効
 
 			m_pDevice->CreateRasterizerState(&rasterizer_desc, m_pRasterizerState.GetAddressOf());
 		}
 
 		if (!m_pVertexShader) {
 
-			// _VF[_[̍쐬
+			// 頂点シェーダーの作成
 			static const char* vs_text = R"(
 				float4x4 mtx;
 
@@ -135,7 +135,7 @@ namespace hal
 			D3DCompile(vs_text, strlen(vs_text), nullptr, nullptr, nullptr, "main", "vs_5_0", 0, 0, pVSBlob.GetAddressOf(), nullptr);
 			m_pDevice->CreateVertexShader(pVSBlob->GetBufferPointer(), pVSBlob->GetBufferSize(), nullptr, m_pVertexShader.GetAddressOf());
 
-			// _VF[_[̓̓CAEg`
+			// 頂点シェーダーの入力レイアウトを定義
 			D3D11_INPUT_ELEMENT_DESC layout[] = {
 				{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,    0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
 				{ "COLOR",    0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
@@ -143,26 +143,26 @@ namespace hal
 			};
 			UINT numElements = ARRAYSIZE(layout);
 
-			// ̓CAEg̍쐬
+			// 入力レイアウトの作成
 			m_pDevice->CreateInputLayout(layout, numElements, pVSBlob->GetBufferPointer(), pVSBlob->GetBufferSize(), m_pInputLayout.GetAddressOf());
 		}
 
 		if (!m_pVSConstantBuffer) {
-			// 萔obt@̍쐬
+			// 定数バッファの作成
 			D3D11_BUFFER_DESC constant_buffer_desc = {};
 			constant_buffer_desc.ByteWidth = sizeof(XMFLOAT4X4);
 			constant_buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
 
 			m_pDevice->CreateBuffer(&constant_buffer_desc, nullptr, m_pVSConstantBuffer.GetAddressOf());
 
-			// 萔obt@ɕϊsݒ
+			// 定数バッファに変換行列を設定
 			XMFLOAT4X4 mtx;
 			XMStoreFloat4x4(&mtx, XMMatrixTranspose(XMMatrixOrthographicOffCenterLH(0.0f, (float)screenWidth, (float)screenHeight, 0.0f, 0.0f, 1.0f)));
 			m_pContext->UpdateSubresource(m_pVSConstantBuffer.Get(), 0, nullptr, &mtx, 0, 0);
 		}
 
 		if (!m_pPixelShader) {
-			// sNZVF[_[̍쐬
+			// ピクセルシェーダーの作成
 			static const char* ps_text = R"(
 				struct PS_INPUT
 				{
@@ -175,7 +175,7 @@ namespace hal
 				float4 main(PS_INPUT psin) : SV_TARGET
 				{
 					float4 color = fontTexture.Sample(fontSampler, psin.uv);
-					return color * psin.color; // eNX`̐Fƒ_J[|킹
+					return color * psin.color; // テクスチャの色と頂点カラーを掛け合わせる
 				}
 			)";
 			ComPtr<ID3DBlob> pPSBlob;
@@ -184,7 +184,7 @@ namespace hal
 		}
 
 		if( !m_pSamplerState) {
-			// Tv[Xe[g̍쐬
+			// サンプラーステートの作成
 			D3D11_SAMPLER_DESC sampler_desc = {};
 			sampler_desc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT;
 			sampler_desc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
@@ -199,7 +199,7 @@ namespace hal
 
 	DebugText::~DebugText()
 	{
-		// eNX`ƃeNX`r[
+		// テクスチャとテクスチャビューを解放
 		if (m_pTextureView) {
 			m_pTexture->Release();
 			if(!m_pTextureView->Release()) {
@@ -210,33 +210,33 @@ namespace hal
 
 	void DebugText::SetText(const char* pText, XMFLOAT4 color)
 	{		
-		m_TextLines.back().strings.emplace_back(color); // Vǉ
+		m_TextLines.back().strings.emplace_back(color); // 新しい文字列を追加
 
 		for(; *pText; pText++) {
 	
 			if (*pText == '\n') {
-				m_TextLines.emplace_back(); // s𑝂₷
-				m_TextLines.back().strings.emplace_back(color); // Vǉ
+				m_TextLines.emplace_back(); // 行を増やす
+				m_TextLines.back().strings.emplace_back(color); // 新しい文字列を追加
 			}
 			else if (*pText == '\r') {
-				// sR[h '\r' ͖
+				// 改行コード '\r' は無視
 			}
 			else if (*pText == '\t') {
 				while (m_TextLines.back().characterCount % 4 != 0) {
 					if (m_MaxCharactersPerLine && m_TextLines.back().characterCount >= m_MaxCharactersPerLine) {
-						m_TextLines.emplace_back(); // s𑝂₷
-						m_TextLines.back().strings.emplace_back(color); // Vǉ
+						m_TextLines.emplace_back(); // 行を増やす
+						m_TextLines.back().strings.emplace_back(color); // 新しい文字列を追加
 						break;
 					}
-					m_TextLines.back().strings.back().characters += ' '; // ^u̓Xy[Xɒu
+					m_TextLines.back().strings.back().characters += ' '; // タブはスペースに置き換え
 					m_TextLines.back().characterCount++;
 					m_TextLines.back().spaceCount++;
 				}
 			}
 			else {
 				if (m_MaxCharactersPerLine && m_TextLines.back().characterCount >= m_MaxCharactersPerLine) {
-					m_TextLines.emplace_back(); // s𑝂₷
-					m_TextLines.back().strings.emplace_back(color); // Vǉ
+					m_TextLines.emplace_back(); // 行を増やす
+					m_TextLines.back().strings.emplace_back(color); // 新しい文字列を追加
 				}
 
 				if (*pText >= ' ' && *pText <= '~') {
@@ -245,7 +245,7 @@ namespace hal
 					m_TextLines.back().characterCount++;
 				}
 				else {
-					m_TextLines.back().strings.back().characters += '?'; // sȕ '?' Œu
+					m_TextLines.back().strings.back().characters += '?'; // 不明な文字は '?' で置き換え
 					m_CharacterCount++;
 					m_TextLines.back().characterCount++;
 				}
@@ -256,34 +256,34 @@ namespace hal
 
 		while(m_MaxLine && m_TextLines.size() + last_line_count > m_MaxLine) {
 			ULONG remove_character_count = m_TextLines.front().characterCount - m_TextLines.front().spaceCount;
-			m_CharacterCount -= remove_character_count; // Âs̕炷
-			m_TextLines.pop_front(); // Âs폜
+			m_CharacterCount -= remove_character_count; // 古い行の文字数を減らす
+			m_TextLines.pop_front(); // 古い行を削除
 		}
 	}
 
 	void DebugText::Draw()
 	{
 		if( !m_CharacterCount){
-			return; // `悷镶Ȃꍇ͉Ȃ
+			return; // 描画する文字がない場合は何もしない
 		}
 
 		if (!m_pVertexBuffer || m_CharacterCount > m_BufferSourceCharacterCount) {
 			createBuffer(m_CharacterCount);
 		}
 
-		// _obt@ƒ_CfbNXbN
+		// 頂点バッファと頂点インデックスをロックする
 		D3D11_MAPPED_SUBRESOURCE msr;
 		m_pContext->Map(m_pVertexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
 
-		// _obt@ւ̉z|C^擾
+		// 頂点バッファへの仮想ポインタを取得
 		Vertex* v = (Vertex*)msr.pData;
 
 		m_pContext->Map(m_pIndexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &msr);
 
-		// CfbNXobt@ւ̉z|C^擾
+		// インデックスバッファへの仮想ポインタを取得
 		WORD* indices = (WORD*)msr.pData;
 
-		// _
+		// 頂点情報を書き込み
 		UINT lineCount = 0;
 		WORD characterCount = 0;
 		const float characterWidth = m_TextureWidth / 16.0f;
@@ -343,60 +343,60 @@ namespace hal
 			lineCount++;
 		}
 
-		// _obt@ƒ_CfbNX̃bN
+		// 頂点バッファと頂点インデックスのロックを解除
 		m_pContext->Unmap(m_pVertexBuffer.Get(), 0);
 		m_pContext->Unmap(m_pIndexBuffer.Get(), 0);
 
-		// _obt@`pCvCɐݒ
+		// 頂点バッファを描画パイプラインに設定
 		UINT stride = sizeof(Vertex);
 		UINT offset = 0;
 		m_pContext->IASetVertexBuffers(0, 1, m_pVertexBuffer.GetAddressOf(), &stride, &offset);
 
-		// CfbNXobt@`pCvCɐݒ
+		// インデックスバッファを描画パイプラインに設定
 		m_pContext->IASetIndexBuffer(m_pIndexBuffer.Get(), DXGI_FORMAT_R16_UINT, 0);
 		
-		// _VF[_[`pCvCɐݒ
+		// 頂点シェーダーを描画パイプラインに設定
 		m_pContext->VSSetShader(m_pVertexShader.Get(), nullptr, 0);
 
-		// 萔obt@`pCvCɐݒ
+		// 定数バッファを描画パイプラインに設定
 		m_pContext->VSSetConstantBuffers(0, 1, m_pVSConstantBuffer.GetAddressOf());
 
-		// ̓CAEg`pCvCɐݒ
+		// 入力レイアウトを描画パイプラインに設定
 		m_pContext->IASetInputLayout(m_pInputLayout.Get());
 
-		// sNZVF[_[ƃeNX`ƃTv[Xe[g`pCvCɐݒ
+		// ピクセルシェーダーとテクスチャとサンプラーステートを描画パイプラインに設定
 		m_pContext->PSSetShader(m_pPixelShader.Get(), nullptr, 0);
 		m_pContext->PSSetShaderResources(0, 1, &m_pTextureView);
 		m_pContext->PSSetSamplers(0, 1, m_pSamplerState.GetAddressOf());
 
-		ComPtr<ID3D11BlendState> pPreviousBlendState; // ݒÕuhXe[g
+		ComPtr<ID3D11BlendState> pPreviousBlendState; // 設定前のブレンドステート
 		float previous_blend_factor[4];
 		UINT previous_sample_mask;
 		m_pContext->OMGetBlendState(pPreviousBlendState.GetAddressOf(), previous_blend_factor, &previous_sample_mask);
 
-		// uhXe[gݒ
+		// ブレンドステートを設定
 		float blend_factor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
 		m_pContext->OMSetBlendState(m_pBlendState.Get(), blend_factor, 0xffffffff);
 
-		ComPtr<ID3D11DepthStencilState> pPreviousDepthStencilState; // ݒO̐[xXeVXe[g
+		ComPtr<ID3D11DepthStencilState> pPreviousDepthStencilState; // 設定前の深度ステンシルステート
 		UINT previous_stencil_ref = 0;
 		m_pContext->OMGetDepthStencilState(pPreviousDepthStencilState.GetAddressOf(), &previous_stencil_ref);
 
-		// [xXeVXe[gݒ ([x)
+		// 深度ステンシルステートを設定 (深度無効化)
 		m_pContext->OMSetDepthStencilState(m_pDepthStencilState.Get(), 0);
 
-		// X^CU[Xe[gݒ
-		ComPtr<ID3D11RasterizerState> pPreviousRasterizerState; // ݒÕX^CU[Xe[g
+		// ラスタライザーステートを設定
+		ComPtr<ID3D11RasterizerState> pPreviousRasterizerState; // 設定前のラスタライザーステート
 		m_pContext->RSGetState(pPreviousRasterizerState.GetAddressOf());
 		m_pContext->RSSetState(m_pRasterizerState.Get());
 
-		// v~eBug|Wݒ
+		// プリミティブトポロジ設定
 		m_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-		// |S`施ߔs
+		// ポリゴン描画命令発行
 		m_pContext->DrawIndexed(m_CharacterCount * 6, 0, 0);
 
-		// `AuhXe[gƐ[xXeVXe[gƃX^CU[Xe[gɖ߂
+		// 描画後、ブレンドステートと深度ステンシルステートとラスタライザーステートを元に戻す
 		m_pContext->OMSetBlendState(pPreviousBlendState.Get(), previous_blend_factor, 0xffffffff);
 		m_pContext->OMSetDepthStencilState(pPreviousDepthStencilState.Get(), previous_stencil_ref);
 		m_pContext->RSSetState(pPreviousRasterizerState.Get());
@@ -405,13 +405,13 @@ namespace hal
 	void DebugText::Clear()
 	{
 		m_TextLines.clear();
-		m_TextLines.emplace_back(); // ŏ̍sēxǉ
+		m_TextLines.emplace_back(); // 最初の行を再度追加
 		m_CharacterCount = 0;
 	}
 
 	void DebugText::createBuffer(ULONG characterCount)
 	{
-		// _obt@
+		// 頂点バッファ生成
 		D3D11_BUFFER_DESC bd = {};
 		bd.Usage = D3D11_USAGE_DYNAMIC;
 		bd.ByteWidth = sizeof(Vertex) * characterCount * 4;
@@ -420,7 +420,7 @@ namespace hal
 
 		m_pDevice->CreateBuffer(&bd, NULL, m_pVertexBuffer.ReleaseAndGetAddressOf());
 
-		// CfbNXobt@
+		// インデックスバッファ生成
 		bd.ByteWidth = sizeof(WORD) * characterCount * 6;
 		bd.BindFlags = D3D11_BIND_INDEX_BUFFER;
 
@@ -1,6 +1,6 @@
 /*==============================================================================
 
-   Direct3D11p fobNeLXg\ [debug_text.h]
+   Direct3D11用 デバックテキスト表示 [debug_text.h]
 														 Author : Youhei Sato
 														 Date   : 2025/06/15
 --------------------------------------------------------------------------------
@@ -14,7 +14,7 @@
 #include <string>
 #include <tuple>
 #include <list>
-#include <wrl/client.h> // Microsoft::WRL::ComPtrgpꍇ͕Kv
+#include <wrl/client.h> // Microsoft::WRL::ComPtrを使用する場合は必要
 #include <DirectXMath.h>
 
 
@@ -23,16 +23,16 @@ namespace hal
 	class DebugText
 	{
 	private:
-		// ӁIŊOݒ肳́BReleasesvB
+		// 注意！初期化で外部から設定されるもの。Release不要。
 		ID3D11Device* m_pDevice = nullptr;
 		ID3D11DeviceContext* m_pContext = nullptr;
 
-		float m_OffsetX{ 0.0f }; // ItZbgXW
-		float m_OffsetY{ 0.0f }; // ItZbgYW
-		ULONG m_MaxLine{ 0 }; // ős
-		ULONG m_MaxCharactersPerLine{ 0 }; // 1s̍ő啶
-		float m_LineSpacing{ 0.0f }; // sԊu
-		float m_CharacterSpacing{ 0.0f }; // Ԋu
+		float m_OffsetX{ 0.0f }; // オフセットX座標
+		float m_OffsetY{ 0.0f }; // オフセットY座標
+		ULONG m_MaxLine{ 0 }; // 最大行数
+		ULONG m_MaxCharactersPerLine{ 0 }; // 1行あたりの最大文字数
+		float m_LineSpacing{ 0.0f }; // 行間隔
+		float m_CharacterSpacing{ 0.0f }; // 文字間隔
 
 		struct Characters { 
 			Characters(const DirectX::XMFLOAT4& color) : color(color) {}
@@ -46,52 +46,52 @@ namespace hal
 			ULONG spaceCount{ 0 };
 		};
 
-		std::list<LineStrings> m_TextLines; // \eLXgs̃Xg
-		UINT m_CharacterCount{ 0 }; // ݂̕i󔒕AsA^u)
+		std::list<LineStrings> m_TextLines; // 表示するテキスト行のリスト
+		UINT m_CharacterCount{ 0 }; // 現在の文字数（空白文字、改行文字、タブ文字を除く)
 
-		// tHgeNX`
-		std::wstring m_FileName; // t@C
+		// フォントテクスチャ
+		std::wstring m_FileName; // ファイル名
 		ID3D11Resource* m_pTexture = nullptr;
 		ID3D11ShaderResourceView* m_pTextureView = nullptr;
-		UINT m_TextureWidth{ 0 }; // eNX`̕
-		UINT m_TextureHeight{ 0 }; // eNX`̍
+		UINT m_TextureWidth{ 0 }; // テクスチャの幅
+		UINT m_TextureHeight{ 0 }; // テクスチャの高さ
 
-		// eNX`ǗMAP
+		// テクスチャ管理MAP
 		static std::unordered_map<std::wstring, std::tuple<ID3D11Resource*, ID3D11ShaderResourceView*>> m_TextureMap;
 
-		Microsoft::WRL::ComPtr<ID3D11Buffer> m_pVertexBuffer; // _obt@
-		Microsoft::WRL::ComPtr<ID3D11Buffer> m_pIndexBuffer; // CfbNXobt@
-		UINT m_BufferSourceCharacterCount{ 0 }; // obt@ɓo^Ă镶
+		Microsoft::WRL::ComPtr<ID3D11Buffer> m_pVertexBuffer; // 頂点バッファ
+		Microsoft::WRL::ComPtr<ID3D11Buffer> m_pIndexBuffer; // インデックスバッファ
+		UINT m_BufferSourceCharacterCount{ 0 }; // バッファに登録されている文字数
 
-		static Microsoft::WRL::ComPtr<ID3D11BlendState> m_pBlendState; // uhXe[g
-		static Microsoft::WRL::ComPtr<ID3D11DepthStencilState> m_pDepthStencilState; // [xXeVXe[g
-		static Microsoft::WRL::ComPtr<ID3D11RasterizerState> m_pRasterizerState; // X^CU[Xe[g
+		static Microsoft::WRL::ComPtr<ID3D11BlendState> m_pBlendState; // ブレンドステート
+		static Microsoft::WRL::ComPtr<ID3D11DepthStencilState> m_pDepthStencilState; // 深度ステンシルステート
+		static Microsoft::WRL::ComPtr<ID3D11RasterizerState> m_pRasterizerState; // ラスタライザーステート
 
-		static Microsoft::WRL::ComPtr<ID3D11VertexShader> m_pVertexShader; // _VF[_[
-		static Microsoft::WRL::ComPtr<ID3D11InputLayout> m_pInputLayout; // ̓CAEg
-		static Microsoft::WRL::ComPtr<ID3D11Buffer> m_pVSConstantBuffer; // _VF[_[萔obt@
-		static Microsoft::WRL::ComPtr<ID3D11PixelShader> m_pPixelShader; // sNZVF[_[
-		static Microsoft::WRL::ComPtr<ID3D11SamplerState> m_pSamplerState; // Tv[Xe[g
+		static Microsoft::WRL::ComPtr<ID3D11VertexShader> m_pVertexShader; // 頂点シェーダー
+		static Microsoft::WRL::ComPtr<ID3D11InputLayout> m_pInputLayout; // 入力レイアウト
+		static Microsoft::WRL::ComPtr<ID3D11Buffer> m_pVSConstantBuffer; // 頂点シェーダー定数バッファ
+		static Microsoft::WRL::ComPtr<ID3D11PixelShader> m_pPixelShader; // ピクセルシェーダー
+		static Microsoft::WRL::ComPtr<ID3D11SamplerState> m_pSamplerState; // サンプラーステート
 
 	public:
 		DebugText() = delete;
 		DebugText(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, const wchar_t* pFontTextureFileName, UINT screenWidth, UINT screenHeight, float offsetX = 0.0f, float offsetY = 0.0f, ULONG maxLine = 0, ULONG maxCharactersPerLine = 0, float lineSpacing = 0.0f, float characterSpacing = 0.0f);
 		~DebugText();
 
-		// ꖜ炢܂œo^\i󔒕AsA^uj
+		// ※一万文字くらいまで登録可能（空白文字、改行文字、タブ文字を除く）
 		void SetText(const char* pText, DirectX::XMFLOAT4 color = { 1.0f, 1.0f, 1.0f, 1.0f });
 
 		void Draw();
 
-		void Clear(); // o^ĂeLXgNA
+		void Clear(); // 登録されているテキストをクリア
 
 	private:
 		
 		struct Vertex
 		{
-			DirectX::XMFLOAT3 position; // W
-			DirectX::XMFLOAT4 color;    // F
-			DirectX::XMFLOAT2 texcoord; // eNX`W
+			DirectX::XMFLOAT3 position; // 座標
+			DirectX::XMFLOAT4 color;    // 色
+			DirectX::XMFLOAT2 texcoord; // テクスチャ座標
 		};
 
 		void createBuffer(ULONG characterCount);
@@ -1,6 +1,6 @@
 /*==============================================================================
 
-   VXe^C}[ [system_timer.h]
+   システムタイマー [system_timer.h]
                                                          Author : Youhei Sato
                                                          Date   : 2018/06/17
 --------------------------------------------------------------------------------
@@ -10,27 +10,27 @@
 
 
 /*------------------------------------------------------------------------------
-   O[oϐ錾
+   グローバル変数宣言
 ------------------------------------------------------------------------------*/
-static bool g_bTimerStopped = true; // XgbvtO
-static LONGLONG g_TicksPerSec = 0;  // PbԂ̌v
-static LONGLONG g_StopTime;         // Xgbv
-static LONGLONG g_LastElapsedTime;  // ŌɋL^XV
-static LONGLONG g_BaseTime;         // {
+static bool g_bTimerStopped = true; // ストップフラグ
+static LONGLONG g_TicksPerSec = 0;  // １秒間の計測時間
+static LONGLONG g_StopTime;         // ストップした時間
+static LONGLONG g_LastElapsedTime;  // 最後に記録した更新時間
+static LONGLONG g_BaseTime;         // 基本時間
 
 
 /*------------------------------------------------------------------------------
-   vg^Cv錾
+   プロトタイプ宣言
 ------------------------------------------------------------------------------*/
-// ~ĂΒ~ԁAłȂΌ݂̎Ԃ̎擾
+// 停止していれば停止時間、そうでなければ現在の時間の取得
 static LARGE_INTEGER GetAdjustedCurrentTime(void);
 
 
 /*------------------------------------------------------------------------------
-   ֐`
+   関数定義
 ------------------------------------------------------------------------------*/
 
-// VXe^C}[̏
+// システムタイマーの初期化
 void SystemTimer_Initialize(void)
 {
     g_bTimerStopped = true;
@@ -39,13 +39,13 @@ void SystemTimer_Initialize(void)
     g_LastElapsedTime = 0;
     g_BaseTime = 0;
 
-    // \ptH[}XJE^g̎擾
+    // 高分解能パフォーマンスカウンタ周波数の取得
     LARGE_INTEGER ticksPerSec = { 0 };
     QueryPerformanceFrequency(&ticksPerSec);
     g_TicksPerSec = ticksPerSec.QuadPart;
 }
 
-// VXe^C}[̃Zbg
+// システムタイマーのリセット
 void SystemTimer_Reset(void)
 {
     LARGE_INTEGER time = GetAdjustedCurrentTime();
@@ -55,16 +55,16 @@ void SystemTimer_Reset(void)
     g_bTimerStopped = false;
 }
 
-// VXe^C}[̃X^[g
+// システムタイマーのスタート
 void SystemTimer_Start(void)
 {
-    // ݂̎Ԃ擾
+    // 現在の時間を取得
     LARGE_INTEGER time = { 0 };
     QueryPerformanceCounter(&time);
 
-    // ܂ŌvXgbvĂ
+    // 今まで計測がストップしていたら
     if( g_bTimerStopped ) {
-        // ~܂ĂԂĊ{ԂXV
+        // 止まっていた時間を差し引いて基本時間を更新
         g_BaseTime += time.QuadPart - g_StopTime;
     }
 
@@ -73,7 +73,7 @@ void SystemTimer_Start(void)
     g_bTimerStopped = false;
 }
 
-// VXe^C}[̃Xgbv
+// システムタイマーのストップ
 void SystemTimer_Stop(void)
 {
     if( g_bTimerStopped ) return;
@@ -81,17 +81,17 @@ void SystemTimer_Stop(void)
     LARGE_INTEGER time = { 0 };
     QueryPerformanceCounter(&time);
 
-    g_LastElapsedTime = g_StopTime = time.QuadPart; // ~ԂL^
+    g_LastElapsedTime = g_StopTime = time.QuadPart; // 停止時間を記録
     g_bTimerStopped = true;
 }
 
-// VXe^C}[0.1bi߂
+// システムタイマーを0.1秒進める
 void SystemTimer_Advance(void)
 {
     g_StopTime += g_TicksPerSec / 10;
 }
 
-// vԂ擾
+// 計測時間を取得
 double SystemTimer_GetTime(void)
 {
     LARGE_INTEGER time = GetAdjustedCurrentTime();
@@ -99,7 +99,7 @@ double SystemTimer_GetTime(void)
     return (double)(time.QuadPart - g_BaseTime) / (double)g_TicksPerSec;
 }
 
-// ݂̎Ԃ擾
+// 現在の時間を取得
 double SystemTimer_GetAbsoluteTime(void)
 {
     LARGE_INTEGER time = { 0 };
@@ -108,7 +108,7 @@ double SystemTimer_GetAbsoluteTime(void)
     return time.QuadPart / (double)g_TicksPerSec;
 }
 
-// oߎԂ̎擾
+// 経過時間の取得
 double SystemTimer_GetElapsedTime(void)
 {
     LARGE_INTEGER time = GetAdjustedCurrentTime();
@@ -116,10 +116,10 @@ double SystemTimer_GetElapsedTime(void)
     double elapsed_time = (double)(time.QuadPart - g_LastElapsedTime) / (double)g_TicksPerSec;
     g_LastElapsedTime = time.QuadPart;
 
-    // ^C}[mł邱Ƃۏ؂邽߂ɁAXVԂOɃNvB
-    // elapsed_timéAvZbTߓd[hɓ邩A炩̌`ŕʂ̃vZbTɃVbtƁA͈̔͊OɂȂ\B
-    // āACXbhSetThreadAffinityMaskĂяoāAʂ̃vZbTɃVbtȂ悤ɂKvB
-    // ̃[J[XbhSetThreadAffinityMaskĂяoׂł͂ȂACXbhWꂽ^C}[f[^̋LRs[gp邱ƁB
+    // タイマーが正確であることを保証するために、更新時間を０にクランプする。
+    // elapsed_timeは、プロセッサが節電モードに入るか、何らかの形で別のプロセッサにシャッフルされると、この範囲外になる可能性がある。
+    // よって、メインスレッドはSetThreadAffinityMaskを呼び出して、別のプロセッサにシャッフルされないようにする必要がある。
+    // 他のワーカースレッドはSetThreadAffinityMaskを呼び出すべきではなく、メインスレッドから収集されたタイマーデータの共有コピーを使用すること。
     if( elapsed_time < 0.0 ) {
         elapsed_time = 0.0;
     }
@@ -127,13 +127,13 @@ double SystemTimer_GetElapsedTime(void)
     return elapsed_time;
 }
 
-// VXe^C}[~܂Ă邩H
+// システムタイマーが止まっているか？
 bool SystemTimer_IsStoped(void)
 {
     return g_bTimerStopped;
 }
 
-// ݂̃Xbh1̃vZbTĩ݂Xbhjɐ
+// 現在のスレッドを1つのプロセッサ（現在のスレッド）に制限
 void LimitThreadAffinityToCurrentProc(void)
 {
     HANDLE hCurrentProcess = GetCurrentProcess();
@@ -158,7 +158,7 @@ void LimitThreadAffinityToCurrentProc(void)
     CloseHandle(hCurrentProcess);
 }
 
-// ~ĂΒ~ԁAłȂΌ݂̎Ԃ̎擾
+// 停止していれば停止時間、そうでなければ現在の時間の取得
 LARGE_INTEGER GetAdjustedCurrentTime(void)
 {
     LARGE_INTEGER time;
@@ -1,6 +1,6 @@
 /*==============================================================================
 
-   VXe^C}[ [system_timer.h]
+   システムタイマー [system_timer.h]
                                                          Author : Youhei Sato
                                                          Date   : 2018/06/17
 --------------------------------------------------------------------------------
@@ -11,37 +11,37 @@
 
 
 /*------------------------------------------------------------------------------
-   ֐̃vg^Cv錾
+   関数のプロトタイプ宣言
 ------------------------------------------------------------------------------*/
 
-// VXe^C}[̏
+// システムタイマーの初期化
 void SystemTimer_Initialize(void);
 
-// VXe^C}[̃Zbg
+// システムタイマーのリセット
 void SystemTimer_Reset(void);
 
-// VXe^C}[̃X^[g
+// システムタイマーのスタート
 void SystemTimer_Start(void);
 
-// VXe^C}[̃Xgbv
+// システムタイマーのストップ
 void SystemTimer_Stop(void);
 
-// VXe^C}[0.1bi߂
+// システムタイマーを0.1秒進める
 void SystemTimer_Advance(void);
 
-// vԂ̎擾
+// 計測時間の取得
 double SystemTimer_GetTime(void);
 
-// ݂̎Ԃ擾
+// 現在の時間を取得
 double SystemTimer_GetAbsoluteTime(void);
 
-// oߎԂ̎擾
+// 経過時間の取得
 double SystemTimer_GetElapsedTime(void);
 
-// VXe^C}[~܂Ă邩H
+// システムタイマーが止まっているか？
 bool SystemTimer_IsStoped(void);
 
-// ݂̃Xbh1̃vZbTĩ݂Xbhjɐ
+// 現在のスレッドを1つのプロセッサ（現在のスレッド）に制限
 void LimitThreadAffinityToCurrentProc(void);
 
 #endif // SYSTEM_TIMER_H_